@@ -0,0 +1,256 @@
+/**
+ * \file bench_tardigrade_automatic_differentiation.cpp
+ *
+ * Benchmark of the point Jacobians of the balance of linear momentum and the balance of energy computed with the
+ * hand-coded expressions and by passing dual numbers through the residual overloads
+ *
+ * Usage: bench_tardigrade_automatic_differentiation [number of evaluations (default 1000000)]
+ */
+
+#include <tardigrade_automatic_differentiation.h>
+#include <tardigrade_balance_of_energy.h>
+#include <tardigrade_balance_of_linear_momentum.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+typedef double floatType;  //!< Define the float type
+
+namespace ad = tardigradeBalanceEquations::automaticDifferentiation;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+//! The number of lanes of the momentum Jacobian: density, displacement, body force, cauchy stress, volume fraction
+constexpr int momentum_lanes = 1 + dim + dim + dim * dim + 1;
+
+//! The number of lanes of the energy Jacobian: density, internal energy, displacement, cauchy stress, volume fraction,
+//! internal heat generation, net interphase force, heat flux
+constexpr int energy_lanes = 1 + 1 + dim + dim * dim + 1 + 1 + dim + dim;
+
+/*!
+ * Fill a container with smoothly varying values
+ *
+ * \param &v: The container to fill
+ * \param &offset: The phase offset of the values
+ */
+template <class container>
+void fill(container &v, const floatType offset) {
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = 0.5 + 0.3 * std::sin(1.7 * i + offset);
+    }
+}
+
+/*!
+ * Time a function and return the nanoseconds per call
+ *
+ * \param &num_evaluations: The number of calls
+ * \param &function: The function to call with the evaluation number
+ */
+template <class function_type>
+double timeEvaluations(const unsigned int num_evaluations, function_type function) {
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_evaluations; ++n) {
+        function(n);
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / num_evaluations;
+}
+
+int main(int argc, char **argv) {
+    const unsigned int num_evaluations = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+    floatType density = 1.2, density_dot = 0.3, internal_energy = 2.4, internal_energy_dot = -0.2;
+
+    floatType volume_fraction = 0.4, internal_heat_generation = 0.8;
+
+    floatType test_function = 0.6, interpolation_function = 0.45;
+
+    floatType dRhoDotdRho = 1.4, dEDotdE = 1.9, dUDotdU = 2.1, dUDDotdU = 3.3;
+
+    std::array<floatType, dim> density_gradient, internal_energy_gradient, velocity, velocity_dot, body_force,
+        net_interphase_force, heat_flux, test_function_gradient, interpolation_function_gradient;
+
+    std::array<floatType, dim * dim> velocity_gradient, cauchy_stress;
+
+    fill(density_gradient, 0.1);
+    fill(internal_energy_gradient, 0.2);
+    fill(velocity, 0.3);
+    fill(velocity_dot, 0.4);
+    fill(body_force, 0.5);
+    fill(net_interphase_force, 0.6);
+    fill(heat_flux, 0.7);
+    fill(test_function_gradient, 0.8);
+    fill(interpolation_function_gradient, 0.9);
+    fill(velocity_gradient, 1.0);
+    fill(cauchy_stress, 1.1);
+
+    volatile floatType sink = 0;
+
+    // Hand-coded balance of linear momentum
+    std::array<floatType, dim>             momentum_result, dRdRho, dRdVolumeFraction;
+    std::array<floatType, dim * dim>       dRdU, dRdB, dRdUMesh;
+    std::array<floatType, dim * dim * dim> dRdCauchy;
+
+    const double momentum_hand = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim>(
+            density + 1e-9 * n, density_dot, std::cbegin(density_gradient), std::cend(density_gradient),
+            std::cbegin(velocity), std::cend(velocity), std::cbegin(velocity_dot), std::cend(velocity_dot),
+            std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::cbegin(body_force),
+            std::cend(body_force), std::cbegin(cauchy_stress), std::cend(cauchy_stress), volume_fraction, test_function,
+            std::cbegin(test_function_gradient), std::cend(test_function_gradient), interpolation_function,
+            std::cbegin(interpolation_function_gradient), std::cend(interpolation_function_gradient), dRhoDotdRho,
+            dUDotdU, dUDDotdU, std::begin(momentum_result), std::end(momentum_result), std::begin(dRdRho),
+            std::end(dRdRho), std::begin(dRdU), std::end(dRdU), std::begin(dRdB), std::end(dRdB), std::begin(dRdCauchy),
+            std::end(dRdCauchy), std::begin(dRdVolumeFraction), std::end(dRdVolumeFraction), std::begin(dRdUMesh),
+            std::end(dRdUMesh));
+
+        sink = sink + dRdU[0];
+    });
+
+    // Automatic differentiation of the balance of linear momentum
+    using momentum_dual = ad::Dual<floatType, momentum_lanes>;
+
+    std::array<momentum_dual, dim>       ad_density_gradient, ad_velocity, ad_velocity_dot, ad_body_force;
+    std::array<momentum_dual, dim * dim> ad_velocity_gradient, ad_cauchy_stress;
+    std::array<momentum_dual, dim>       ad_momentum_result;
+
+    const double momentum_ad = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        momentum_dual ad_density(density + 1e-9 * n, 0, interpolation_function);
+
+        momentum_dual ad_density_dot(density_dot, 0, dRhoDotdRho * interpolation_function);
+
+        momentum_dual ad_volume_fraction(volume_fraction, momentum_lanes - 1);
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            ad_density_gradient[i] = momentum_dual(density_gradient[i], 0, interpolation_function_gradient[i]);
+
+            ad_velocity[i] = momentum_dual(velocity[i], 1 + i, dUDotdU * interpolation_function);
+
+            ad_velocity_dot[i] = momentum_dual(velocity_dot[i], 1 + i, dUDDotdU * interpolation_function);
+
+            for (unsigned int j = 0; j < dim; ++j) {
+                ad_velocity_gradient[dim * i + j] =
+                    momentum_dual(velocity_gradient[dim * i + j], 1 + i, dUDotdU * interpolation_function_gradient[j]);
+            }
+        }
+
+        ad::seedLanes<floatType, momentum_lanes>(std::cbegin(body_force), std::cend(body_force), 1 + dim,
+                                                 std::begin(ad_body_force), std::end(ad_body_force));
+
+        ad::seedLanes<floatType, momentum_lanes>(std::cbegin(cauchy_stress), std::cend(cauchy_stress), 1 + 2 * dim,
+                                                 std::begin(ad_cauchy_stress), std::end(ad_cauchy_stress));
+
+        tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim>(
+            ad_density, ad_density_dot, std::cbegin(ad_density_gradient), std::cend(ad_density_gradient),
+            std::cbegin(ad_velocity), std::cend(ad_velocity), std::cbegin(ad_velocity_dot), std::cend(ad_velocity_dot),
+            std::cbegin(ad_velocity_gradient), std::cend(ad_velocity_gradient), std::cbegin(ad_body_force),
+            std::cend(ad_body_force), std::cbegin(ad_cauchy_stress), std::cend(ad_cauchy_stress), ad_volume_fraction,
+            momentum_dual(test_function), std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+            std::begin(ad_momentum_result), std::end(ad_momentum_result));
+
+        sink = sink + ad_momentum_result[0].derivatives[1];
+    });
+
+    // Hand-coded balance of energy
+    floatType energy_result, dRdRho_e, dRdE, dRdVolumeFraction_e, dRdr;
+
+    std::array<floatType, dim> dRdU_e, dRdpi, dRdq, dRdUMesh_e;
+
+    std::array<floatType, dim * dim> dRdCauchy_e;
+
+    const double energy_hand = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false>(
+            density + 1e-9 * n, density_dot, std::cbegin(density_gradient), std::cend(density_gradient),
+            internal_energy, internal_energy_dot, std::cbegin(internal_energy_gradient),
+            std::cend(internal_energy_gradient), std::cbegin(velocity), std::cend(velocity),
+            std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::cbegin(cauchy_stress),
+            std::cend(cauchy_stress), volume_fraction, internal_heat_generation, std::cbegin(net_interphase_force),
+            std::cend(net_interphase_force), std::cbegin(heat_flux), std::cend(heat_flux), test_function,
+            std::cbegin(test_function_gradient), std::cend(test_function_gradient), interpolation_function,
+            std::cbegin(interpolation_function_gradient), std::cend(interpolation_function_gradient), dRhoDotdRho,
+            dEDotdE, dUDotdU, energy_result, dRdRho_e, dRdE, std::begin(dRdU_e), std::end(dRdU_e),
+            std::begin(dRdCauchy_e), std::end(dRdCauchy_e), dRdVolumeFraction_e, dRdr, std::begin(dRdpi),
+            std::end(dRdpi), std::begin(dRdq), std::end(dRdq), std::begin(dRdUMesh_e), std::end(dRdUMesh_e));
+
+        sink = sink + dRdE;
+    });
+
+    // Automatic differentiation of the balance of energy
+    using energy_dual = ad::Dual<floatType, energy_lanes>;
+
+    constexpr int cauchy_lane          = 2 + dim;
+    constexpr int volume_fraction_lane = cauchy_lane + dim * dim;
+    constexpr int pi_lane              = volume_fraction_lane + 2;
+    constexpr int q_lane               = pi_lane + dim;
+
+    std::array<energy_dual, dim> e_density_gradient, e_internal_energy_gradient, e_velocity, e_net_interphase_force,
+        e_heat_flux;
+
+    std::array<energy_dual, dim * dim> e_velocity_gradient, e_cauchy_stress;
+
+    energy_dual e_result;
+
+    const double energy_ad = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        energy_dual e_density(density + 1e-9 * n, 0, interpolation_function);
+
+        energy_dual e_density_dot(density_dot, 0, dRhoDotdRho * interpolation_function);
+
+        energy_dual e_internal_energy(internal_energy, 1, interpolation_function);
+
+        energy_dual e_internal_energy_dot(internal_energy_dot, 1, dEDotdE * interpolation_function);
+
+        energy_dual e_volume_fraction(volume_fraction, volume_fraction_lane);
+
+        energy_dual e_internal_heat_generation(internal_heat_generation, volume_fraction_lane + 1);
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            e_density_gradient[i] = energy_dual(density_gradient[i], 0, interpolation_function_gradient[i]);
+
+            e_internal_energy_gradient[i] =
+                energy_dual(internal_energy_gradient[i], 1, interpolation_function_gradient[i]);
+
+            e_velocity[i] = energy_dual(velocity[i], 2 + i, dUDotdU * interpolation_function);
+
+            for (unsigned int j = 0; j < dim; ++j) {
+                e_velocity_gradient[dim * i + j] =
+                    energy_dual(velocity_gradient[dim * i + j], 2 + i, dUDotdU * interpolation_function_gradient[j]);
+            }
+        }
+
+        ad::seedLanes<floatType, energy_lanes>(std::cbegin(cauchy_stress), std::cend(cauchy_stress), cauchy_lane,
+                                               std::begin(e_cauchy_stress), std::end(e_cauchy_stress));
+
+        ad::seedLanes<floatType, energy_lanes>(std::cbegin(net_interphase_force), std::cend(net_interphase_force),
+                                               pi_lane, std::begin(e_net_interphase_force),
+                                               std::end(e_net_interphase_force));
+
+        ad::seedLanes<floatType, energy_lanes>(std::cbegin(heat_flux), std::cend(heat_flux), q_lane,
+                                               std::begin(e_heat_flux), std::end(e_heat_flux));
+
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false>(
+            e_density, e_density_dot, std::cbegin(e_density_gradient), std::cend(e_density_gradient),
+            e_internal_energy, e_internal_energy_dot, std::cbegin(e_internal_energy_gradient),
+            std::cend(e_internal_energy_gradient), std::cbegin(e_velocity), std::cend(e_velocity),
+            std::cbegin(e_velocity_gradient), std::cend(e_velocity_gradient), std::cbegin(e_cauchy_stress),
+            std::cend(e_cauchy_stress), e_volume_fraction, e_internal_heat_generation,
+            std::cbegin(e_net_interphase_force), std::cend(e_net_interphase_force), std::cbegin(e_heat_flux),
+            std::cend(e_heat_flux), energy_dual(test_function), std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), e_result);
+
+        sink = sink + e_result.derivatives[1];
+    });
+
+    std::cout << "evaluations:                   " << num_evaluations << "\n";
+    std::cout << "momentum hand-coded (ns/eval): " << momentum_hand << "\n";
+    std::cout << "momentum dual " << momentum_lanes << " lanes (ns/eval): " << momentum_ad << "\n";
+    std::cout << "energy hand-coded (ns/eval):   " << energy_hand << "\n";
+    std::cout << "energy dual " << energy_lanes << " lanes (ns/eval):   " << energy_ad << "\n";
+
+    return 0;
+}
@@ -0,0 +1,1259 @@
+/**
+ * \file bench_tardigrade_balance_equations.cpp
+ *
+ * Microbenchmark suite of the point kernels of the balance equations and of the geometry calls of the elements. The
+ * multiphase residual and Jacobian overloads which consume a material response are timed for one to eight phases as
+ * are the mixture material response and the interpolation of the nodal degrees of freedom. The surface growth balance
+ * and the shape function calls do not depend on the number of phases and are timed once.
+ *
+ * The time is reported in ns per point i.e., per call of a kernel for one test function (and one interpolation
+ * function for the Jacobians) at an integration point or per integration point for the element calls. The floating
+ * point operations of a call are counted once by evaluating the kernel with a counting scalar and the achieved GFLOP/s
+ * is their ratio with the time. The shape functions of the elements are always computed in double precision so the
+ * operations of the shape function calls are not counted. Each case is timed three times and the fastest is reported.
+ * The CPU cycles and retired instructions of the fastest repetition are also reported when the hardware counters of
+ * Linux may be read by the process.
+ *
+ * The floating point operations and the bytes read and written per point of the analytic cost model of
+ * tardigrade_cost_model.h are also reported for each case along with the bandwidth of a STREAM triad so that
+ * roofline_report.py may place each kernel on a roofline. The model operations of the element calls include the
+ * shape function calls which are not counted.
+ *
+ * The results are written to a JSON file when --json is given so that they may be compared against the committed
+ * baseline in baselines/ with compare_benchmarks.py.
+ *
+ * Usage: bench_tardigrade_balance_equations [number of residual evaluations (default 200000)]
+ *                                           [number of Jacobian evaluations (default 2000)]
+ *                                           [--json <output file>]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_balance_of_energy.h>
+#include <tardigrade_balance_of_linear_momentum.h>
+#include <tardigrade_balance_of_mass.h>
+#include <tardigrade_balance_of_surface_growth.h>
+#include <tardigrade_balance_of_volume_fraction.h>
+#include <tardigrade_constraint_equations.h>
+#include <tardigrade_cost_model.h>
+#include <tardigrade_instrumentation.h>
+#include <tardigrade_mesh_assembly.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+typedef double floatType;  //!< Define the float type
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace costModel = tardigradeBalanceEquations::costModel;
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int num_additional_dof = 1;  //!< The number of additional degrees of freedom
+
+constexpr unsigned int material_response_num_dof =
+    4 + 2 * dim + num_additional_dof;  //!< The number of degrees of freedom the material response of a phase depends on
+
+constexpr unsigned int material_response_size = 23;  //!< The size of the material response of each phase
+
+// The layout of the material response of a phase
+constexpr int cauchy_stress_index                       = 0;   //!< The index of the Cauchy stress
+constexpr int predicted_internal_energy_index           = 9;   //!< The index of the predicted internal energy
+constexpr int mass_change_index                         = 10;  //!< The index of the mass change rate
+constexpr int body_force_index                          = 11;  //!< The index of the body force
+constexpr int interphasic_force_index                   = 14;  //!< The index of the net interphasic force
+constexpr int heat_flux_index                           = 17;  //!< The index of the heat flux
+constexpr int internal_heat_generation_index            = 20;  //!< The index of the internal heat generation
+constexpr int interphasic_heat_transfer_index           = 21;  //!< The index of the interphasic heat transfer
+constexpr int trace_mass_change_velocity_gradient_index = 22;  //!< The index of the trace of the mass change velocity
+                                                               //!< gradient
+
+volatile floatType sink = 0;  //!< Keeps the results of the benchmarks alive
+
+/*!
+ * A scalar which counts the floating point operations applied to it. The count is per thread. The scalar converts
+ * implicitly to a double so that it may be accumulated into double precision values e.g., by std::inner_product and
+ * the arithmetic with doubles is counted by the mixed operators.
+ */
+struct CountedFloat {
+    floatType value;  //!< The value
+
+    static thread_local unsigned long long count;  //!< The number of operations
+
+    CountedFloat() : value(0) {}
+
+    /*!
+     * Construct from a value
+     *
+     * \param v: The value
+     */
+    CountedFloat(const floatType v) : value(v) {}
+
+    //! Convert to the value
+    operator floatType() const { return value; }
+
+    CountedFloat &operator+=(const CountedFloat &b) {
+        ++count;
+        value += b.value;
+        return *this;
+    }
+
+    CountedFloat &operator-=(const CountedFloat &b) {
+        ++count;
+        value -= b.value;
+        return *this;
+    }
+
+    CountedFloat &operator*=(const CountedFloat &b) {
+        ++count;
+        value *= b.value;
+        return *this;
+    }
+
+    CountedFloat &operator/=(const CountedFloat &b) {
+        ++count;
+        value /= b.value;
+        return *this;
+    }
+};
+
+thread_local unsigned long long CountedFloat::count = 0;
+
+inline CountedFloat operator+(const CountedFloat &a) { return a; }
+
+inline CountedFloat operator-(const CountedFloat &a) { return CountedFloat(-a.value); }
+
+inline CountedFloat operator+(const CountedFloat &a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value + b.value);
+}
+
+inline CountedFloat operator+(const CountedFloat &a, const floatType b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value + b);
+}
+
+inline CountedFloat operator+(const floatType a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a + b.value);
+}
+
+inline CountedFloat operator-(const CountedFloat &a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value - b.value);
+}
+
+inline CountedFloat operator-(const CountedFloat &a, const floatType b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value - b);
+}
+
+inline CountedFloat operator-(const floatType a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a - b.value);
+}
+
+inline CountedFloat operator*(const CountedFloat &a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value * b.value);
+}
+
+inline CountedFloat operator*(const CountedFloat &a, const floatType b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value * b);
+}
+
+inline CountedFloat operator*(const floatType a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a * b.value);
+}
+
+inline CountedFloat operator/(const CountedFloat &a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value / b.value);
+}
+
+inline CountedFloat operator/(const CountedFloat &a, const floatType b) {
+    ++CountedFloat::count;
+    return CountedFloat(a.value / b);
+}
+
+inline CountedFloat operator/(const floatType a, const CountedFloat &b) {
+    ++CountedFloat::count;
+    return CountedFloat(a / b.value);
+}
+
+inline bool operator<(const CountedFloat &a, const CountedFloat &b) { return a.value < b.value; }
+
+inline bool operator<(const CountedFloat &a, const floatType b) { return a.value < b; }
+
+inline bool operator<(const floatType a, const CountedFloat &b) { return a < b.value; }
+
+inline bool operator>(const CountedFloat &a, const CountedFloat &b) { return a.value > b.value; }
+
+inline bool operator>(const CountedFloat &a, const floatType b) { return a.value > b; }
+
+inline bool operator>(const floatType a, const CountedFloat &b) { return a > b.value; }
+
+inline bool operator<=(const CountedFloat &a, const CountedFloat &b) { return a.value <= b.value; }
+
+inline bool operator<=(const CountedFloat &a, const floatType b) { return a.value <= b; }
+
+inline bool operator<=(const floatType a, const CountedFloat &b) { return a <= b.value; }
+
+inline bool operator>=(const CountedFloat &a, const CountedFloat &b) { return a.value >= b.value; }
+
+inline bool operator>=(const CountedFloat &a, const floatType b) { return a.value >= b; }
+
+inline bool operator>=(const floatType a, const CountedFloat &b) { return a >= b.value; }
+
+inline bool operator==(const CountedFloat &a, const CountedFloat &b) { return a.value == b.value; }
+
+inline bool operator==(const CountedFloat &a, const floatType b) { return a.value == b; }
+
+inline bool operator==(const floatType a, const CountedFloat &b) { return a == b.value; }
+
+inline bool operator!=(const CountedFloat &a, const CountedFloat &b) { return a.value != b.value; }
+
+inline bool operator!=(const CountedFloat &a, const floatType b) { return a.value != b; }
+
+inline bool operator!=(const floatType a, const CountedFloat &b) { return a != b.value; }
+
+/*!
+ * Fill a container with smoothly varying values
+ *
+ * \param &v: The container to fill
+ * \param &offset: The phase offset of the values
+ */
+template <class container>
+void fill(container &v, const floatType offset) {
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = 0.5 + 0.3 * std::sin(1.7 * i + offset);
+    }
+}
+
+constexpr unsigned int num_repetitions = 3;  //!< The number of times each case is timed
+
+/*!
+ * The CPU cycle and retired instruction counters of the calling thread. The counters are unavailable on platforms other
+ * than Linux and when the kernel does not permit the process to read them e.g., in containers or with a restrictive
+ * perf_event_paranoid setting.
+ */
+class HardwareCounters {
+   public:
+    HardwareCounters() : _cycles(-1), _instructions(-1) {
+#if defined(__linux__)
+        _cycles       = open(PERF_COUNT_HW_CPU_CYCLES);
+        _instructions = open(PERF_COUNT_HW_INSTRUCTIONS);
+
+        if ((_cycles < 0) || (_instructions < 0)) {
+            close();
+        }
+#endif
+    }
+
+    ~HardwareCounters() { close(); }
+
+    HardwareCounters(const HardwareCounters &) = delete;
+
+    HardwareCounters &operator=(const HardwareCounters &) = delete;
+
+    //! Check if the counters may be read
+    bool isAvailable() const { return _cycles >= 0; }
+
+    //! Reset and start the counters
+    void start() {
+#if defined(__linux__)
+        if (isAvailable()) {
+            ioctl(_cycles, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_instructions, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_cycles, PERF_EVENT_IOC_ENABLE, 0);
+            ioctl(_instructions, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /*!
+     * Stop the counters and read them
+     *
+     * \param &cycles: The CPU cycles since the start or -1 if the counters are unavailable
+     * \param &instructions: The retired instructions since the start or -1 if the counters are unavailable
+     */
+    void stop(double &cycles, double &instructions) {
+        cycles       = -1;
+        instructions = -1;
+#if defined(__linux__)
+        if (isAvailable()) {
+            ioctl(_cycles, PERF_EVENT_IOC_DISABLE, 0);
+            ioctl(_instructions, PERF_EVENT_IOC_DISABLE, 0);
+
+            long long value;
+
+            if (read(_cycles, &value, sizeof(value)) == sizeof(value)) {
+                cycles = value;
+            }
+
+            if (read(_instructions, &value, sizeof(value)) == sizeof(value)) {
+                instructions = value;
+            }
+        }
+#endif
+    }
+
+   protected:
+#if defined(__linux__)
+    /*!
+     * Open a disabled counter of the calling thread which excludes the kernel
+     *
+     * \param config: The hardware event
+     */
+    static int open(const unsigned long long config) {
+        perf_event_attr attributes;
+
+        std::memset(&attributes, 0, sizeof(attributes));
+
+        attributes.type           = PERF_TYPE_HARDWARE;
+        attributes.size           = sizeof(attributes);
+        attributes.config         = config;
+        attributes.disabled       = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv     = 1;
+
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+    }
+#endif
+
+    //! Close the counters
+    void close() {
+#if defined(__linux__)
+        if (_cycles >= 0) {
+            ::close(_cycles);
+        }
+        if (_instructions >= 0) {
+            ::close(_instructions);
+        }
+#endif
+        _cycles       = -1;
+        _instructions = -1;
+    }
+
+    int _cycles;  //!< The file descriptor of the cycle counter
+
+    int _instructions;  //!< The file descriptor of the instruction counter
+};
+
+HardwareCounters *counters = nullptr;  //!< The hardware counters of the main thread
+
+/*!
+ * The timing of a case per call or per point
+ */
+struct Timing {
+    double ns;  //!< The time in ns
+
+    double cycles;  //!< The CPU cycles or -1 if they are not available
+
+    double instructions;  //!< The retired instructions or -1 if they are not available
+
+    /*!
+     * Get the timing of a fraction of the calls
+     *
+     * \param count: The number of points of a call
+     */
+    Timing operator/(const double count) const {
+        return {ns / count, (cycles < 0) ? cycles : cycles / count,
+                (instructions < 0) ? instructions : instructions / count};
+    }
+};
+
+/*!
+ * A benchmark result
+ */
+struct BenchmarkResult {
+    std::string kernel;  //!< The name of the kernel
+
+    std::string element;  //!< The element or "point" for the point kernels
+
+    std::string path;  //!< The residual or Jacobian path
+
+    unsigned int nphases;  //!< The number of phases or zero if the kernel does not depend on the phases
+
+    Timing timing;  //!< The timing per point
+
+    double flops_per_point;  //!< The floating point operations per point or zero if they are not counted
+
+    costModel::KernelCost model;  //!< The operations and bytes per point of the cost model
+};
+
+std::vector<BenchmarkResult> results;  //!< The results of the benchmarks
+
+/*!
+ * Time a function and return the timing per call of the fastest of the repetitions
+ *
+ * \param &num_evaluations: The number of calls
+ * \param &function: The function to call with the evaluation number
+ */
+template <class function_type>
+Timing timeEvaluations(const unsigned int num_evaluations, function_type function) {
+    Timing best = {std::numeric_limits<double>::max(), -1, -1};
+
+    for (unsigned int r = 0; r < num_repetitions; ++r) {
+        Timing timing;
+
+        counters->start();
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (unsigned int n = 0; n < num_evaluations; ++n) {
+            function(n);
+        }
+
+        auto stop = std::chrono::steady_clock::now();
+
+        counters->stop(timing.cycles, timing.instructions);
+
+        timing.ns = std::chrono::duration<double, std::nano>(stop - start).count();
+
+        if (timing.ns < best.ns) {
+            best = timing;
+        }
+    }
+
+    return best / num_evaluations;
+}
+
+/*!
+ * The inputs and outputs of the point kernels for a number of phases
+ */
+template <typename T, unsigned int nphases>
+struct PointState {
+    static constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The dof of a point
+
+    static constexpr unsigned int rows = nphases * dim;  //!< The largest number of rows of a kernel
+
+    std::array<T, nphases> density, density_dot, internal_energy, internal_energy_dot, volume_fraction,
+        volume_fraction_dot, rest_density;  //!< The phase scalars
+
+    std::array<T, nphases * dim> density_gradient, internal_energy_gradient, volume_fraction_gradient, velocity,
+        velocity_dot;  //!< The phase vectors
+
+    std::array<T, nphases * dim * dim> velocity_gradient;  //!< The velocity gradients
+
+    std::vector<T> material_response;  //!< The material response
+
+    std::vector<T> material_response_jacobian;  //!< The material response Jacobian
+
+    std::vector<T> dof_gradient;  //!< The spatial gradient of the point dof vector
+
+    std::vector<T> mixture_response;  //!< The mixture material response
+
+    std::vector<T> mixture_jacobian;  //!< The mixture material response Jacobian
+
+    std::array<T, dim> surface_growth_velocity, lagrange_multiplier_gradient;  //!< The surface growth inputs
+
+    T lagrange_multiplier;  //!< The Lagrange multiplier of the surface growth
+
+    std::vector<T> result, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ, dRdUMesh, dRdL;  //!< The outputs
+
+    std::array<floatType, dim> test_function_gradient, interpolation_function_gradient;  //!< The gradients
+
+    floatType test_function = 0.6, interpolation_function = 0.45;  //!< The test and interpolation functions
+
+    floatType dRhoDotdRho = 1.4, dEDotdE = 1.9, dUDotdU = 2.1, dUDDotdU = 3.7, dVFDotdVF = 1.3;  //!< The rates
+
+    PointState()
+        : material_response(nphases * material_response_size),
+          material_response_jacobian(nphases * material_response_size * num_dof * (1 + dim)),
+          dof_gradient(num_dof * dim),
+          mixture_response(material_response_size),
+          mixture_jacobian(material_response_size * num_dof * (1 + dim)),
+          result(rows),
+          dRdRho(rows * nphases),
+          dRdU(rows * nphases * dim),
+          dRdW(rows * nphases * dim),
+          dRdTheta(rows * nphases),
+          dRdE(rows * nphases),
+          dRdVF(rows * nphases),
+          dRdZ(rows * num_additional_dof),
+          dRdUMesh(rows * dim),
+          dRdL(rows) {
+        fill(density, 0.1);
+        fill(density_dot, 0.2);
+        fill(internal_energy, 0.25);
+        fill(internal_energy_dot, 0.35);
+        fill(volume_fraction, 0.3);
+        fill(volume_fraction_dot, 0.32);
+        fill(rest_density, 0.37);
+        fill(density_gradient, 0.4);
+        fill(internal_energy_gradient, 0.45);
+        fill(volume_fraction_gradient, 0.47);
+        fill(velocity, 0.5);
+        fill(velocity_dot, 0.55);
+        fill(velocity_gradient, 0.7);
+        fill(material_response, 1.0);
+        fill(material_response_jacobian, 1.1);
+        fill(dof_gradient, 1.2);
+        fill(surface_growth_velocity, 1.3);
+        fill(lagrange_multiplier_gradient, 1.4);
+        fill(test_function_gradient, 0.8);
+        fill(interpolation_function_gradient, 0.9);
+        lagrange_multiplier = 0.65;
+    }
+};
+
+/*!
+ * Time a point kernel and count its floating point operations
+ *
+ * \param &kernel: The name of the kernel
+ * \param &path: The residual or Jacobian path
+ * \param &model: The cost of a point from the cost model
+ * \param &num_evaluations: The number of timed calls
+ * \param &state: The double precision state
+ * \param &counted_state: The counted state
+ * \param &function: The kernel called as function( state, n ) with the evaluation number
+ */
+template <unsigned int nphases, class function_type>
+void runPointBenchmark(const std::string &kernel, const std::string &path, const costModel::KernelCost &model,
+                       const unsigned int num_evaluations, PointState<floatType, nphases> &state,
+                       PointState<CountedFloat, nphases> &counted_state, function_type function) {
+    CountedFloat::count = 0;
+
+    function(counted_state, 0);
+
+    const double flops = CountedFloat::count;
+
+    const Timing timing = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        function(state, n);
+
+        sink = sink + state.result[0];
+    });
+
+    results.push_back({kernel, "point", path, nphases, timing, flops, model});
+}
+
+/*!
+ * Run the benchmarks of the point kernels for a fixed number of phases
+ *
+ * \param &num_evaluations: The number of residual evaluations
+ * \param &num_jacobian_evaluations: The number of Jacobian evaluations
+ */
+template <unsigned int nphases>
+void benchmarkPointKernels(const unsigned int num_evaluations, const unsigned int num_jacobian_evaluations) {
+    PointState<floatType, nphases> state;
+
+    PointState<CountedFloat, nphases> counted_state;
+
+    constexpr unsigned int rows = nphases * dim;
+
+    // The costs of a point from the cost model. The multiphase overloads call the kernel of a phase once per phase.
+    const costModel::KernelCost mass_residual = costModel::getBalanceOfMassResidualCost(dim) * nphases;
+
+    const costModel::KernelCost mass_jacobian =
+        costModel::getBalanceOfMassJacobianCost(dim, nphases, dim, material_response_num_dof) * nphases;
+
+    const costModel::KernelCost momentum_residual = costModel::getBalanceOfLinearMomentumResidualCost(dim) * nphases;
+
+    const costModel::KernelCost momentum_jacobian =
+        costModel::getBalanceOfLinearMomentumJacobianCost(dim, nphases, dim, material_response_num_dof) * nphases;
+
+    const costModel::KernelCost energy_residual = costModel::getBalanceOfEnergyResidualCost(dim) * nphases;
+
+    const costModel::KernelCost energy_jacobian =
+        costModel::getBalanceOfEnergyJacobianCost(dim, nphases, dim, material_response_num_dof) * nphases;
+
+    const costModel::KernelCost volume_fraction_residual =
+        costModel::getBalanceOfVolumeFractionResidualCost(dim) * nphases;
+
+    const costModel::KernelCost volume_fraction_jacobian =
+        costModel::getBalanceOfVolumeFractionJacobianCost(dim, nphases, dim, material_response_num_dof) * nphases;
+
+    const costModel::KernelCost constraint_residual = costModel::getInternalEnergyConstraintResidualCost() * nphases;
+
+    const costModel::KernelCost constraint_jacobian =
+        costModel::getInternalEnergyConstraintJacobianCost(nphases, dim, material_response_num_dof) * nphases;
+
+    const costModel::KernelCost mixture =
+        costModel::getMixtureMaterialResponseCost(dim, nphases, PointState<floatType, nphases>::num_dof);
+
+    // Balance of mass
+    runPointBenchmark("balance of mass", "residual", mass_residual, num_evaluations, state, counted_state,
+                      [](auto &s, const unsigned int n) {
+                          s.density[0] = 0.5 + 1e-9 * n;
+
+                          tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, mass_change_index>(
+                              std::cbegin(s.density), std::cend(s.density), std::cbegin(s.density_dot),
+                              std::cend(s.density_dot), std::cbegin(s.density_gradient),
+                              std::cend(s.density_gradient), std::cbegin(s.velocity), std::cend(s.velocity),
+                              std::cbegin(s.velocity_gradient), std::cend(s.velocity_gradient),
+                              std::cbegin(s.material_response), std::cend(s.material_response), s.test_function,
+                              std::begin(s.result), std::begin(s.result) + nphases);
+                      });
+
+    runPointBenchmark(
+        "balance of mass", "jacobian", mass_jacobian, num_jacobian_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, dim, mass_change_index,
+                                                                             material_response_num_dof>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.density_dot), std::cend(s.density_dot),
+                std::cbegin(s.density_gradient), std::cend(s.density_gradient), std::cbegin(s.velocity),
+                std::cend(s.velocity), std::cbegin(s.velocity_gradient), std::cend(s.velocity_gradient),
+                std::cbegin(s.material_response), std::cend(s.material_response),
+                std::cbegin(s.material_response_jacobian), std::cend(s.material_response_jacobian), s.test_function,
+                s.interpolation_function, std::cbegin(s.interpolation_function_gradient),
+                std::cend(s.interpolation_function_gradient), std::cbegin(s.dof_gradient), std::cend(s.dof_gradient),
+                s.dRhoDotdRho, s.dUDotdU, std::begin(s.result), std::begin(s.result) + nphases, std::begin(s.dRdRho),
+                std::begin(s.dRdRho) + nphases * nphases, std::begin(s.dRdU),
+                std::begin(s.dRdU) + nphases * nphases * dim, std::begin(s.dRdW),
+                std::begin(s.dRdW) + nphases * nphases * dim, std::begin(s.dRdTheta),
+                std::begin(s.dRdTheta) + nphases * nphases, std::begin(s.dRdE), std::begin(s.dRdE) + nphases * nphases,
+                std::begin(s.dRdVF), std::begin(s.dRdVF) + nphases * nphases, std::begin(s.dRdZ),
+                std::begin(s.dRdZ) + nphases * num_additional_dof, std::begin(s.dRdUMesh),
+                std::begin(s.dRdUMesh) + nphases * dim);
+        });
+
+    // Balance of linear momentum
+    runPointBenchmark(
+        "balance of linear momentum", "residual", momentum_residual, num_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                dim, dim, body_force_index, cauchy_stress_index, interphasic_force_index>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.density_dot), std::cend(s.density_dot),
+                std::cbegin(s.density_gradient), std::cend(s.density_gradient), std::cbegin(s.velocity),
+                std::cend(s.velocity), std::cbegin(s.velocity_dot), std::cend(s.velocity_dot),
+                std::cbegin(s.velocity_gradient), std::cend(s.velocity_gradient), std::cbegin(s.material_response),
+                std::cend(s.material_response), std::cbegin(s.volume_fraction), std::cend(s.volume_fraction),
+                s.test_function, std::cbegin(s.test_function_gradient), std::cend(s.test_function_gradient),
+                std::begin(s.result), std::begin(s.result) + rows);
+        });
+
+    runPointBenchmark(
+        "balance of linear momentum", "jacobian", momentum_jacobian, num_jacobian_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                dim, dim, body_force_index, cauchy_stress_index, interphasic_force_index, material_response_num_dof>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.density_dot), std::cend(s.density_dot),
+                std::cbegin(s.density_gradient), std::cend(s.density_gradient), std::cbegin(s.velocity),
+                std::cend(s.velocity), std::cbegin(s.velocity_dot), std::cend(s.velocity_dot),
+                std::cbegin(s.velocity_gradient), std::cend(s.velocity_gradient), std::cbegin(s.material_response),
+                std::cend(s.material_response), std::cbegin(s.material_response_jacobian),
+                std::cend(s.material_response_jacobian), std::cbegin(s.volume_fraction), std::cend(s.volume_fraction),
+                s.test_function, std::cbegin(s.test_function_gradient), std::cend(s.test_function_gradient),
+                s.interpolation_function, std::cbegin(s.interpolation_function_gradient),
+                std::cend(s.interpolation_function_gradient), std::cbegin(s.dof_gradient), std::cend(s.dof_gradient),
+                s.dRhoDotdRho, s.dUDotdU, s.dUDDotdU, std::begin(s.result), std::begin(s.result) + rows,
+                std::begin(s.dRdRho), std::begin(s.dRdRho) + rows * nphases, std::begin(s.dRdU),
+                std::begin(s.dRdU) + rows * nphases * dim, std::begin(s.dRdW),
+                std::begin(s.dRdW) + rows * nphases * dim, std::begin(s.dRdTheta),
+                std::begin(s.dRdTheta) + rows * nphases, std::begin(s.dRdE), std::begin(s.dRdE) + rows * nphases,
+                std::begin(s.dRdVF), std::begin(s.dRdVF) + rows * nphases,
+                std::begin(s.dRdZ), std::begin(s.dRdZ) + rows * num_additional_dof, std::begin(s.dRdUMesh),
+                std::begin(s.dRdUMesh) + rows * dim);
+        });
+
+    // Balance of energy
+    runPointBenchmark(
+        "balance of energy", "residual", energy_residual, num_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<
+                dim, false, dim, cauchy_stress_index, internal_heat_generation_index, heat_flux_index,
+                interphasic_force_index, interphasic_heat_transfer_index>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.density_dot), std::cend(s.density_dot),
+                std::cbegin(s.density_gradient), std::cend(s.density_gradient), std::cbegin(s.internal_energy),
+                std::cend(s.internal_energy), std::cbegin(s.internal_energy_dot), std::cend(s.internal_energy_dot),
+                std::cbegin(s.internal_energy_gradient), std::cend(s.internal_energy_gradient),
+                std::cbegin(s.velocity), std::cend(s.velocity), std::cbegin(s.velocity_gradient),
+                std::cend(s.velocity_gradient), std::cbegin(s.material_response), std::cend(s.material_response),
+                std::cbegin(s.volume_fraction), std::cend(s.volume_fraction), s.test_function,
+                std::cbegin(s.test_function_gradient), std::cend(s.test_function_gradient), std::begin(s.result),
+                std::begin(s.result) + nphases);
+        });
+
+    runPointBenchmark(
+        "balance of energy", "jacobian", energy_jacobian, num_jacobian_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<
+                dim, false, dim, cauchy_stress_index, internal_heat_generation_index, heat_flux_index,
+                interphasic_force_index, interphasic_heat_transfer_index, material_response_num_dof>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.density_dot), std::cend(s.density_dot),
+                std::cbegin(s.density_gradient), std::cend(s.density_gradient), std::cbegin(s.internal_energy),
+                std::cend(s.internal_energy), std::cbegin(s.internal_energy_dot), std::cend(s.internal_energy_dot),
+                std::cbegin(s.internal_energy_gradient), std::cend(s.internal_energy_gradient),
+                std::cbegin(s.velocity), std::cend(s.velocity), std::cbegin(s.velocity_gradient),
+                std::cend(s.velocity_gradient), std::cbegin(s.material_response), std::cend(s.material_response),
+                std::cbegin(s.material_response_jacobian), std::cend(s.material_response_jacobian),
+                std::cbegin(s.volume_fraction), std::cend(s.volume_fraction), s.test_function,
+                std::cbegin(s.test_function_gradient), std::cend(s.test_function_gradient), s.interpolation_function,
+                std::cbegin(s.interpolation_function_gradient), std::cend(s.interpolation_function_gradient),
+                std::cbegin(s.dof_gradient), std::cend(s.dof_gradient), s.dRhoDotdRho, s.dEDotdE, s.dUDotdU,
+                std::begin(s.result), std::begin(s.result) + nphases, std::begin(s.dRdRho),
+                std::begin(s.dRdRho) + nphases * nphases, std::begin(s.dRdU),
+                std::begin(s.dRdU) + nphases * nphases * dim, std::begin(s.dRdW),
+                std::begin(s.dRdW) + nphases * nphases * dim, std::begin(s.dRdTheta),
+                std::begin(s.dRdTheta) + nphases * nphases, std::begin(s.dRdE), std::begin(s.dRdE) + nphases * nphases,
+                std::begin(s.dRdVF), std::begin(s.dRdVF) + nphases * nphases, std::begin(s.dRdZ),
+                std::begin(s.dRdZ) + nphases * num_additional_dof, std::begin(s.dRdUMesh),
+                std::begin(s.dRdUMesh) + nphases * dim);
+        });
+
+    // Balance of volume fraction
+    runPointBenchmark(
+        "balance of volume fraction", "residual", volume_fraction_residual, num_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfVolumeFraction::computeBalanceOfVolumeFraction<
+                dim, mass_change_index, trace_mass_change_velocity_gradient_index>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.velocity), std::cend(s.velocity),
+                std::cbegin(s.volume_fraction), std::cend(s.volume_fraction), std::cbegin(s.volume_fraction_dot),
+                std::cend(s.volume_fraction_dot), std::cbegin(s.volume_fraction_gradient),
+                std::cend(s.volume_fraction_gradient), std::cbegin(s.material_response),
+                std::cend(s.material_response), std::cbegin(s.rest_density), std::cend(s.rest_density),
+                s.test_function, std::begin(s.result), std::begin(s.result) + nphases);
+        });
+
+    runPointBenchmark(
+        "balance of volume fraction", "jacobian", volume_fraction_jacobian, num_jacobian_evaluations, state,
+        counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::balanceOfVolumeFraction::computeBalanceOfVolumeFraction<
+                dim, dim, mass_change_index, trace_mass_change_velocity_gradient_index, material_response_num_dof>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.velocity), std::cend(s.velocity),
+                std::cbegin(s.volume_fraction), std::cend(s.volume_fraction), std::cbegin(s.volume_fraction_dot),
+                std::cend(s.volume_fraction_dot), std::cbegin(s.volume_fraction_gradient),
+                std::cend(s.volume_fraction_gradient), std::cbegin(s.material_response),
+                std::cend(s.material_response), std::cbegin(s.material_response_jacobian),
+                std::cend(s.material_response_jacobian), std::cbegin(s.rest_density), std::cend(s.rest_density),
+                s.test_function, s.interpolation_function, std::cbegin(s.interpolation_function_gradient),
+                std::cend(s.interpolation_function_gradient), std::cbegin(s.dof_gradient), std::cend(s.dof_gradient),
+                s.dUDotdU, s.dVFDotdVF, std::begin(s.result), std::begin(s.result) + nphases, std::begin(s.dRdRho),
+                std::begin(s.dRdRho) + nphases * nphases, std::begin(s.dRdU),
+                std::begin(s.dRdU) + nphases * nphases * dim, std::begin(s.dRdW),
+                std::begin(s.dRdW) + nphases * nphases * dim, std::begin(s.dRdTheta),
+                std::begin(s.dRdTheta) + nphases * nphases, std::begin(s.dRdE), std::begin(s.dRdE) + nphases * nphases,
+                std::begin(s.dRdVF), std::begin(s.dRdVF) + nphases * nphases, std::begin(s.dRdZ),
+                std::begin(s.dRdZ) + nphases * num_additional_dof, std::begin(s.dRdUMesh),
+                std::begin(s.dRdUMesh) + nphases * dim);
+        });
+
+    // Internal energy constraint
+    runPointBenchmark(
+        "internal energy constraint", "residual", constraint_residual, num_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.internal_energy[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::constraintEquations::computeInternalEnergyConstraint<
+                predicted_internal_energy_index>(std::cbegin(s.internal_energy), std::cend(s.internal_energy),
+                                                 std::cbegin(s.material_response), std::cend(s.material_response),
+                                                 s.test_function, std::begin(s.result), std::begin(s.result) + nphases);
+        });
+
+    runPointBenchmark(
+        "internal energy constraint", "jacobian", constraint_jacobian, num_jacobian_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.internal_energy[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::constraintEquations::computeInternalEnergyConstraint<
+                dim, predicted_internal_energy_index, material_response_num_dof>(
+                std::cbegin(s.internal_energy), std::cend(s.internal_energy), std::cbegin(s.material_response),
+                std::cend(s.material_response), std::cbegin(s.material_response_jacobian),
+                std::cend(s.material_response_jacobian), s.test_function, s.interpolation_function,
+                std::cbegin(s.interpolation_function_gradient), std::cend(s.interpolation_function_gradient),
+                std::cbegin(s.dof_gradient), std::cend(s.dof_gradient), s.dUDotdU, std::begin(s.result),
+                std::begin(s.result) + nphases, std::begin(s.dRdRho), std::begin(s.dRdRho) + nphases * nphases,
+                std::begin(s.dRdU), std::begin(s.dRdU) + nphases * nphases * dim, std::begin(s.dRdW),
+                std::begin(s.dRdW) + nphases * nphases * dim, std::begin(s.dRdTheta),
+                std::begin(s.dRdTheta) + nphases * nphases, std::begin(s.dRdE), std::begin(s.dRdE) + nphases * nphases,
+                std::begin(s.dRdVF), std::begin(s.dRdVF) + nphases * nphases, std::begin(s.dRdZ),
+                std::begin(s.dRdZ) + nphases * num_additional_dof, std::begin(s.dRdUMesh),
+                std::begin(s.dRdUMesh) + nphases * dim);
+        });
+
+    // Mixture material response
+    runPointBenchmark(
+        "mixture material response", "jacobian", mixture, num_jacobian_evaluations, state, counted_state,
+        [](auto &s, const unsigned int n) {
+            s.density[0] = 0.5 + 1e-9 * n;
+
+            tardigradeBalanceEquations::constraintEquations::computeMixtureMaterialResponse<
+                dim, cauchy_stress_index, predicted_internal_energy_index, mass_change_index, body_force_index,
+                interphasic_force_index, heat_flux_index, internal_heat_generation_index,
+                interphasic_heat_transfer_index, trace_mass_change_velocity_gradient_index>(
+                std::cbegin(s.density), std::cend(s.density), std::cbegin(s.volume_fraction),
+                std::cend(s.volume_fraction), std::cbegin(s.material_response), std::cend(s.material_response),
+                std::cbegin(s.material_response_jacobian), std::cend(s.material_response_jacobian),
+                std::begin(s.mixture_response), std::end(s.mixture_response), std::begin(s.mixture_jacobian),
+                std::end(s.mixture_jacobian));
+
+            s.result[0] = s.mixture_response[0];
+        });
+}
+
+/*!
+ * Run the benchmarks of the surface growth balance which does not depend on the number of phases
+ *
+ * \param &num_evaluations: The number of residual evaluations
+ * \param &num_jacobian_evaluations: The number of Jacobian evaluations
+ */
+void benchmarkSurfaceGrowth(const unsigned int num_evaluations, const unsigned int num_jacobian_evaluations) {
+    PointState<floatType, 1> state;
+
+    PointState<CountedFloat, 1> counted_state;
+
+    auto residual = [](auto &s, const unsigned int n) {
+        s.lagrange_multiplier = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::surfaceGrowth::computeSurfaceGrowthBalance(
+            std::cbegin(s.surface_growth_velocity), std::cend(s.surface_growth_velocity), s.lagrange_multiplier,
+            std::cbegin(s.lagrange_multiplier_gradient), std::cend(s.lagrange_multiplier_gradient), s.test_function,
+            std::cbegin(s.test_function_gradient), std::cend(s.test_function_gradient), std::begin(s.result),
+            std::begin(s.result) + dim);
+    };
+
+    auto jacobian = [](auto &s, const unsigned int n) {
+        s.lagrange_multiplier = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::surfaceGrowth::computeSurfaceGrowthBalance(
+            std::cbegin(s.surface_growth_velocity), std::cend(s.surface_growth_velocity), s.lagrange_multiplier,
+            std::cbegin(s.lagrange_multiplier_gradient), std::cend(s.lagrange_multiplier_gradient), s.test_function,
+            std::cbegin(s.test_function_gradient), std::cend(s.test_function_gradient), s.interpolation_function,
+            std::cbegin(s.interpolation_function_gradient), std::cend(s.interpolation_function_gradient),
+            std::begin(s.result), std::begin(s.result) + dim, std::begin(s.dRdU), std::begin(s.dRdU) + dim * dim,
+            std::begin(s.dRdL), std::begin(s.dRdL) + dim, std::begin(s.dRdUMesh), std::begin(s.dRdUMesh) + dim * dim);
+    };
+
+    runPointBenchmark("surface growth balance", "residual", costModel::getSurfaceGrowthResidualCost(dim),
+                      num_evaluations, state, counted_state, residual);
+
+    runPointBenchmark("surface growth balance", "jacobian", costModel::getSurfaceGrowthJacobianCost(dim),
+                      num_jacobian_evaluations, state, counted_state, jacobian);
+
+    results.back().nphases = 0;
+
+    results[results.size() - 2].nphases = 0;
+}
+
+/*!
+ * Get the nodal coordinates of a slightly distorted element
+ *
+ * \param &X: The nodal coordinates
+ */
+template <class element_type, unsigned int node_count>
+void getElementCoordinates(std::array<floatType, dim * node_count> &X) {
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<element_type>(1, 1, 1, 1.0, 1.2, 0.9,
+                                                                                       coordinates);
+
+    for (unsigned int a = 0; a < node_count; ++a) {
+        const assembly::size_type node = *(connectivity.getElementNodesBegin(0) + a);
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            X[dim * a + i] = coordinates[dim * node + i] + 0.03 * std::sin(2.3 * (dim * a + i));
+        }
+    }
+}
+
+/*!
+ * Run the benchmarks of the interpolation of the nodal degrees of freedom of an element for a fixed number of phases
+ *
+ * \param &name: The name of the element
+ * \param &num_evaluations: The number of element evaluations
+ */
+template <class element_type, class element_configuration, unsigned int nphases>
+void benchmarkElementInterpolation(const std::string &name, const unsigned int num_evaluations) {
+    constexpr unsigned int node_count = element_configuration::node_count;
+
+    constexpr unsigned int num_points = element_configuration::num_volume_integration_points;
+
+    constexpr unsigned int num_dof = PointState<floatType, nphases>::num_dof;
+
+    std::array<floatType, dim * node_count> X;
+
+    getElementCoordinates<element_type, node_count>(X);
+
+    element_type element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+    std::array<std::array<floatType, element_configuration::local_dim>, num_points> xi;
+
+    for (unsigned int qp = 0; qp < num_points; ++qp) {
+        floatType weight;
+
+        element.GetVolumeIntegrationPointData(qp, std::begin(xi[qp]), std::end(xi[qp]), weight);
+    }
+
+    auto interpolate = [&](auto &dof, auto &value, const unsigned int n) {
+        dof[0] = 0.5 + 1e-9 * n;
+
+        for (unsigned int qp = 0; qp < num_points; ++qp) {
+            element.InterpolateQuantity(std::cbegin(xi[qp]), std::cend(xi[qp]), std::cbegin(dof), std::cend(dof),
+                                        std::begin(value), std::end(value));
+        }
+    };
+
+    auto gradient = [&](auto &dof, auto &value, const unsigned int n) {
+        dof[0] = 0.5 + 1e-9 * n;
+
+        for (unsigned int qp = 0; qp < num_points; ++qp) {
+            element.GetGlobalQuantityGradient(std::cbegin(xi[qp]), std::cend(xi[qp]), std::cbegin(dof),
+                                              std::cend(dof), std::begin(value), std::end(value));
+        }
+    };
+
+    std::array<floatType, node_count * num_dof> dof;
+
+    std::array<CountedFloat, node_count * num_dof> counted_dof;
+
+    std::array<floatType, num_dof * dim> value;
+
+    std::array<CountedFloat, num_dof * dim> counted_value;
+
+    fill(dof, 0.2);
+
+    fill(counted_dof, 0.2);
+
+    auto run = [&](const std::string &kernel, const costModel::KernelCost &model, auto function, auto &v,
+                   auto &counted_v) {
+        CountedFloat::count = 0;
+
+        function(counted_dof, counted_v, 0);
+
+        const double flops = CountedFloat::count;
+
+        const Timing timing = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+            function(dof, v, n);
+
+            sink = sink + v[0];
+        });
+
+        results.push_back({kernel, name, "residual", nphases, timing / num_points, flops / num_points, model});
+    };
+
+    std::array<floatType, num_dof> point_value;
+
+    std::array<CountedFloat, num_dof> counted_point_value;
+
+    // The shape functions and their gradients are computed by each call
+    run("InterpolateQuantity",
+        costModel::getInterpolationCost(node_count, num_dof) + costModel::getShapeFunctionCost(node_count, dim),
+        interpolate, point_value, counted_point_value);
+
+    run("GetGlobalQuantityGradient",
+        costModel::getQuantityGradientCost(node_count, num_dof, dim) +
+            costModel::getShapeFunctionGradientCost(node_count, dim),
+        gradient, value, counted_value);
+}
+
+/*!
+ * Run the benchmarks of the shape function calls of an element
+ *
+ * \param &name: The name of the element
+ * \param &num_evaluations: The number of element evaluations
+ */
+template <class element_type, class element_configuration>
+void benchmarkElementGeometry(const std::string &name, const unsigned int num_evaluations) {
+    constexpr unsigned int node_count = element_configuration::node_count;
+
+    constexpr unsigned int num_points = element_configuration::num_volume_integration_points;
+
+    std::array<floatType, dim * node_count> X;
+
+    getElementCoordinates<element_type, node_count>(X);
+
+    element_type element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+    std::array<floatType, element_configuration::local_dim> xi;
+
+    std::array<floatType, node_count> N;
+
+    std::array<floatType, node_count * dim> dNdx;
+
+    floatType weight, J;
+
+    const Timing shape_functions = timeEvaluations(num_evaluations, [&](const unsigned int) {
+        for (unsigned int qp = 0; qp < num_points; ++qp) {
+            element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight);
+
+            element.GetShapeFunctions(std::cbegin(xi), std::cend(xi), std::begin(N), std::end(N));
+
+            sink = sink + N[0];
+        }
+    });
+
+    const Timing gradients = timeEvaluations(num_evaluations, [&](const unsigned int) {
+        for (unsigned int qp = 0; qp < num_points; ++qp) {
+            element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight);
+
+            element.GetGlobalShapeFunctionGradients(std::cbegin(xi), std::cend(xi), std::cbegin(X), std::cend(X),
+                                                    std::begin(dNdx), std::end(dNdx));
+
+            sink = sink + dNdx[0];
+        }
+    });
+
+    const Timing jacobian = timeEvaluations(num_evaluations, [&](const unsigned int) {
+        for (unsigned int qp = 0; qp < num_points; ++qp) {
+            element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight);
+
+            element.GetVolumeIntegralJacobianOfTransformation(std::cbegin(xi), std::cend(xi), J);
+
+            sink = sink + J;
+        }
+    });
+
+    results.push_back({"GetShapeFunctions", name, "residual", 0, shape_functions / num_points, 0,
+                       costModel::getShapeFunctionCost(node_count, dim)});
+
+    results.push_back({"GetGlobalShapeFunctionGradients", name, "residual", 0, gradients / num_points, 0,
+                       costModel::getShapeFunctionGradientCost(node_count, dim)});
+
+    results.push_back({"GetVolumeIntegralJacobianOfTransformation", name, "residual", 0, jacobian / num_points, 0,
+                       costModel::getJacobianOfTransformationCost(node_count, dim)});
+}
+
+/*!
+ * Run the benchmarks for each number of phases in a sequence
+ *
+ * \param &num_evaluations: The number of residual evaluations
+ * \param &num_jacobian_evaluations: The number of Jacobian evaluations
+ */
+template <unsigned int... nphases>
+void benchmarkPhaseSequence(const unsigned int num_evaluations, const unsigned int num_jacobian_evaluations,
+                            std::integer_sequence<unsigned int, nphases...>) {
+    (benchmarkPointKernels<nphases + 1>(num_evaluations, num_jacobian_evaluations), ...);
+
+    (benchmarkElementInterpolation<LinearHex, tardigradeBalanceEquations::finiteElement::LinearHexConfiguration,
+                                   nphases + 1>("LinearHex", num_jacobian_evaluations),
+     ...);
+
+    (benchmarkElementInterpolation<QuadraticHex,
+                                   tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration, nphases + 1>(
+         "QuadraticHex", num_jacobian_evaluations),
+     ...);
+}
+
+/*!
+ * Measure the bandwidth of the main memory in GB/s with a STREAM triad over arrays much larger than the caches. The
+ * bytes of the write allocation of the result are not counted as in STREAM.
+ */
+double measureTriadBandwidth() {
+    const unsigned int size = 1 << 23;
+
+    const floatType scalar = 1.5;
+
+    std::vector<floatType> a(size, 0.), b(size, 1.), c(size, 2.);
+
+    const Timing timing = timeEvaluations(1, [&](const unsigned int) {
+        for (unsigned int i = 0; i < size; ++i) {
+            a[i] = b[i] + scalar * c[i];
+        }
+
+        sink = sink + a[size / 2];
+    });
+
+    return 3. * sizeof(floatType) * size / timing.ns;
+}
+
+/*!
+ * Escape a string for JSON
+ *
+ * \param &value: The string
+ */
+std::string escapeJSON(const std::string &value) {
+    std::string escaped;
+
+    for (const char c : value) {
+        if ((c == '"') || (c == '\\')) {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+
+    return escaped;
+}
+
+/*!
+ * Write a number to a JSON file or null if it is negative
+ *
+ * \param &file: The file
+ * \param value: The number
+ */
+void writeJSONNumber(std::ofstream &file, const double value) {
+    if (value < 0) {
+        file << "null";
+    } else {
+        file << value;
+    }
+}
+
+/*!
+ * Write the results to a JSON file. Counts which are not available are written as null.
+ *
+ * \param &filename: The name of the file
+ * \param num_evaluations: The number of residual evaluations
+ * \param num_jacobian_evaluations: The number of Jacobian evaluations
+ * \param triad_bandwidth: The bandwidth of a STREAM triad in GB/s
+ */
+void writeJSON(const std::string &filename, const unsigned int num_evaluations,
+               const unsigned int num_jacobian_evaluations, const double triad_bandwidth) {
+    std::ofstream file(filename);
+
+    if (!file) {
+        std::cerr << "could not open " << filename << "\n";
+        std::exit(1);
+    }
+
+    // The operation counts of the Jacobians have more than six digits
+    file << std::setprecision(12);
+
+    file << "{\n";
+    file << "  \"context\": {\n";
+    file << "    \"executable\": \"bench_tardigrade_balance_equations\",\n";
+#if defined(__VERSION__)
+    file << "    \"compiler\": \"" << escapeJSON(__VERSION__) << "\",\n";
+#endif
+    file << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    file << "    \"hardware_counters\": " << (counters->isAvailable() ? "true" : "false") << ",\n";
+    file << "    \"num_evaluations\": " << num_evaluations << ",\n";
+    file << "    \"num_jacobian_evaluations\": " << num_jacobian_evaluations << ",\n";
+    file << "    \"num_repetitions\": " << num_repetitions << ",\n";
+    file << "    \"triad_bandwidth_gbs\": " << triad_bandwidth << "\n";
+    file << "  },\n";
+    file << "  \"benchmarks\": [";
+
+    for (unsigned int i = 0; i < results.size(); ++i) {
+        const BenchmarkResult &result = results[i];
+
+        file << ((i > 0) ? ",\n" : "\n");
+        file << "    {\"kernel\": \"" << escapeJSON(result.kernel) << "\", \"element\": \""
+             << escapeJSON(result.element) << "\", \"path\": \"" << result.path << "\", \"nphases\": " << result.nphases
+             << ", \"ns_per_point\": " << result.timing.ns << ", \"flops_per_point\": ";
+        writeJSONNumber(file, (result.flops_per_point > 0) ? result.flops_per_point : -1);
+        file << ", \"gflops\": ";
+        writeJSONNumber(file, (result.flops_per_point > 0) ? result.flops_per_point / result.timing.ns : -1);
+        file << ", \"model_flops_per_point\": " << result.model.flops
+             << ", \"model_chain_rule_flops_per_point\": " << result.model.chain_rule_flops
+             << ", \"bytes_read_per_point\": " << result.model.bytes_read
+             << ", \"bytes_written_per_point\": " << result.model.bytes_written;
+        file << ", \"cycles_per_point\": ";
+        writeJSONNumber(file, result.timing.cycles);
+        file << ", \"instructions_per_point\": ";
+        writeJSONNumber(file, result.timing.instructions);
+        file << "}";
+    }
+
+    file << "\n  ]\n}\n";
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> positional;
+
+    std::string json_filename;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((std::string(argv[i]) == "--json") && (i + 1 < argc)) {
+            json_filename = argv[++i];
+        } else {
+            positional.push_back(argv[i]);
+        }
+    }
+
+    const unsigned int num_evaluations = (positional.size() > 0) ? std::atoi(positional[0].c_str()) : 200000;
+
+    const unsigned int num_jacobian_evaluations = (positional.size() > 1) ? std::atoi(positional[1].c_str()) : 2000;
+
+    HardwareCounters hardware_counters;
+
+    counters = &hardware_counters;
+
+    benchmarkPhaseSequence(num_evaluations, num_jacobian_evaluations, std::make_integer_sequence<unsigned int, 8>());
+
+    benchmarkSurfaceGrowth(num_evaluations, num_jacobian_evaluations);
+
+    benchmarkElementGeometry<LinearHex, tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>(
+        "LinearHex", num_evaluations / 10);
+
+    benchmarkElementGeometry<QuadraticHex, tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>(
+        "QuadraticHex", num_evaluations / 10);
+
+    const double triad_bandwidth = measureTriadBandwidth();
+
+    std::cout << "residual evaluations: " << num_evaluations << "\n";
+    std::cout << "jacobian evaluations: " << num_jacobian_evaluations << "\n";
+    std::cout << "hardware counters: " << (counters->isAvailable() ? "available" : "unavailable") << "\n";
+    std::cout << "triad bandwidth: " << std::fixed << std::setprecision(1) << triad_bandwidth << " GB/s\n";
+    std::cout << "times are in ns per point and a phase count of - does not depend on the phases\n\n";
+    std::cout << std::left << std::setw(43) << "kernel" << std::setw(14) << "element" << std::setw(10) << "path"
+              << std::right << std::setw(8) << "nphases" << std::setw(12) << "ns/point" << std::setw(12)
+              << "flop/point" << std::setw(10) << "GFLOP/s" << std::setw(14) << "cycles/point"
+              << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    for (const auto &result : results) {
+        std::cout << std::left << std::setw(43) << result.kernel << std::setw(14) << result.element << std::setw(10)
+                  << result.path << std::right << std::setw(8)
+                  << ((result.nphases > 0) ? std::to_string(result.nphases) : std::string("-")) << std::setw(12)
+                  << result.timing.ns;
+
+        if (result.flops_per_point > 0) {
+            std::cout << std::setw(12) << result.flops_per_point << std::setw(10) << std::setprecision(2)
+                      << result.flops_per_point / result.timing.ns << std::setprecision(1);
+        } else {
+            std::cout << std::setw(12) << "-" << std::setw(10) << "-";
+        }
+
+        if (result.timing.cycles >= 0) {
+            std::cout << std::setw(14) << result.timing.cycles;
+        } else {
+            std::cout << std::setw(14) << "-";
+        }
+
+        std::cout << "\n";
+    }
+
+    if (tardigradeBalanceEquations::instrumentation::isEnabled()) {
+        std::cout << "\ninstrumentation counters (the ticks include the nested kernels)\n\n";
+        tardigradeBalanceEquations::instrumentation::writeReport(std::cout);
+    }
+
+    if (!json_filename.empty()) {
+        writeJSON(json_filename, num_evaluations, num_jacobian_evaluations, triad_bandwidth);
+    }
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * \file bench_tardigrade_block_sparse.cpp
+ *
+ * Benchmark of the memory and sparse matrix-vector product of the block compressed sparse row (BSR) Jacobian against
+ * the scalar CSR Jacobian on generated blocks of linear and quadratic hex elements with one and two phases. The time
+ * to compute and apply the block-Jacobi preconditioner is also reported.
+ *
+ * Usage: bench_tardigrade_block_sparse [elements per side (default 6)] [number of products (default 20)]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_block_sparse.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace block = tardigradeBalanceEquations::blockSparse;
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+volatile floatType sink;  //!< Prevents the products from being optimized away
+
+/*!
+ * Benchmark the CSR and BSR Jacobians of a block of elements and print the results
+ *
+ * \param &name: The name of the element
+ * \param nx: The number of elements per side
+ * \param num_products: The number of matrix-vector products to time
+ */
+template <class element_type, int nphases>
+void benchmarkBlock(const std::string &name, const unsigned int nx, const unsigned int num_products) {
+    constexpr int block_size = block::node_block_size<dim, nphases, 0>;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<element_type>(nx, nx, nx, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, 0);
+
+    auto csr = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    auto bsr = block::buildBSRMatrix<floatType, block_size>(connectivity, numbering);
+
+    // A synthetic diagonally dominant element Jacobian
+    const assembly::size_type num_element_dof = connectivity.getNodesPerElement() * block_size;
+
+    auto kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end, auto jacobian_begin,
+                      auto jacobian_end) {
+        for (assembly::size_type i = 0; i < num_element_dof; ++i) {
+            for (assembly::size_type j = 0; j < num_element_dof; ++j) {
+                *(jacobian_begin + num_element_dof * i + j) =
+                    0.01 * std::cos(0.1 * (e + i + 3 * j)) + ((i == j) ? 1.0 : 0.0);
+            }
+        }
+    };
+
+    std::vector<floatType> residual(numbering.getNumDOF());
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(residual), std::end(residual),
+                                          csr);
+
+    block::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(residual), std::end(residual), bsr);
+
+    std::vector<floatType> x(numbering.getNumDOF()), y(numbering.getNumDOF());
+
+    for (unsigned int i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(0.37 * i);
+    }
+
+    auto timeProducts = [&](const auto &matrix) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (unsigned int n = 0; n < num_products; ++n) {
+            matrix.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+            sink = y[n % y.size()];
+        }
+
+        auto stop = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double>(stop - start).count() / num_products;
+    };
+
+    const double csr_seconds = timeProducts(csr);
+
+    const double bsr_seconds = timeProducts(bsr);
+
+    auto start = std::chrono::steady_clock::now();
+
+    block::BlockJacobi<floatType, block_size> preconditioner(bsr);
+
+    auto stop = std::chrono::steady_clock::now();
+
+    const double jacobi_setup_seconds = std::chrono::duration<double>(stop - start).count();
+
+    start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_products; ++n) {
+        preconditioner.apply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+        sink = y[n % y.size()];
+    }
+
+    stop = std::chrono::steady_clock::now();
+
+    const double jacobi_apply_seconds = std::chrono::duration<double>(stop - start).count() / num_products;
+
+    const double csr_bytes = csr.getValues().size() * sizeof(floatType) +
+                             (csr.getColumnIndices().size() + csr.getRowOffsets().size()) * sizeof(assembly::size_type);
+
+    const double bsr_bytes = bsr.getMemoryBytes();
+
+    // Each stored value is read once with one multiply and one add
+    const double flops = 2.0 * csr.getNumNonZeros();
+
+    std::cout << name << " with " << nphases << " phase(s), block size " << block_size << "\n";
+    std::cout << "  dof:                       " << numbering.getNumDOF() << "\n";
+    std::cout << "  non-zeros:                 " << csr.getNumNonZeros() << "\n";
+    std::cout << "  CSR memory (MB):           " << csr_bytes / 1e6 << "\n";
+    std::cout << "  BSR memory (MB):           " << bsr_bytes / 1e6 << "\n";
+    std::cout << "  BSR / CSR memory:          " << bsr_bytes / csr_bytes << "\n";
+    std::cout << "  CSR product (s):           " << csr_seconds << " (" << flops / csr_seconds / 1e9 << " GFLOP/s)\n";
+    std::cout << "  BSR product (s):           " << bsr_seconds << " (" << flops / bsr_seconds / 1e9 << " GFLOP/s)\n";
+    std::cout << "  block-Jacobi setup (s):    " << jacobi_setup_seconds << "\n";
+    std::cout << "  block-Jacobi apply (s):    " << jacobi_apply_seconds << "\n";
+}
+
+int main(int argc, char **argv) {
+    const unsigned int nx           = (argc > 1) ? std::atoi(argv[1]) : 6;
+    const unsigned int num_products = (argc > 2) ? std::atoi(argv[2]) : 20;
+
+    benchmarkBlock<LinearHex, 1>("LinearHex", nx, num_products);
+
+    benchmarkBlock<LinearHex, 2>("LinearHex", nx, num_products);
+
+    benchmarkBlock<QuadraticHex, 1>("QuadraticHex", nx, num_products);
+
+    benchmarkBlock<QuadraticHex, 2>("QuadraticHex", nx, num_products);
+
+    return 0;
+}
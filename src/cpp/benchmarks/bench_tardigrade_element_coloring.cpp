@@ -0,0 +1,306 @@
+/**
+ * \file bench_tardigrade_element_coloring.cpp
+ *
+ * Strong-scaling benchmark of the colored parallel assembly of the balance of linear momentum into a global residual
+ * and a CSR Jacobian on generated blocks of linear and quadratic hex elements. The coloring is computed once per mesh
+ * and reused for every assembly as it would be for every Newton iteration.
+ *
+ * Usage: bench_tardigrade_element_coloring [elements per side (default 6)] [maximum number of threads (default 64)]
+ *                                          [number of assemblies (default 1)]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_element_coloring.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace coloring = tardigradeBalanceEquations::elementColoring;
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int nphases = 1;  //!< The number of phases
+
+constexpr unsigned int num_additional_dof = 0;  //!< The number of additional degrees of freedom
+
+constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The dof of a node
+
+constexpr unsigned int response_size = 16;  //!< The size of the material response vector
+
+/*!
+ * A small-strain linear elastic material model of the displacement gradient
+ */
+struct ElasticModel {
+    floatType lambda = 1.0;  //!< The first Lame parameter
+
+    floatType mu = 1.0;  //!< The shear modulus
+
+    /*!
+     * Compute the Cauchy stress
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        std::fill(response_begin, response_end, 0);
+
+        auto grad_w = point_dof_begin + num_dof + dim * nphases;
+
+        const floatType trace = *(grad_w + 0) + *(grad_w + 4) + *(grad_w + 8);
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            for (unsigned int j = 0; j < dim; ++j) {
+                *(response_begin + 3 + dim * i + j) =
+                    mu * (*(grad_w + dim * i + j) + *(grad_w + dim * j + i)) + ((i == j) ? lambda * trace : 0);
+            }
+        }
+    }
+
+    /*!
+     * Compute the Cauchy stress and its Jacobian w.r.t. the point dof vector
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        (*this)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+
+        std::fill(jacobian_begin, jacobian_end, 0);
+
+        constexpr unsigned int num_columns = num_dof * (1 + dim);
+
+        const unsigned int grad_w = num_dof + dim * nphases;
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            for (unsigned int j = 0; j < dim; ++j) {
+                auto row = jacobian_begin + num_columns * (3 + dim * i + j);
+
+                *(row + grad_w + dim * i + j) += mu;
+                *(row + grad_w + dim * j + i) += mu;
+
+                if (i == j) {
+                    for (unsigned int k = 0; k < dim; ++k) {
+                        *(row + grad_w + dim * k + k) += lambda;
+                    }
+                }
+            }
+        }
+    }
+};
+
+/*!
+ * Print the number of colors and the sizes of the smallest and largest colors of a coloring
+ *
+ * \param &label: The label of the coloring
+ * \param &element_coloring: The element coloring
+ * \param seconds: The time to compute the coloring
+ */
+void printColoring(const std::string &label, const coloring::ElementColoring &element_coloring, const double seconds) {
+    assembly::size_type smallest = element_coloring.getNumElements(), largest = 0;
+
+    for (assembly::size_type color = 0; color < element_coloring.getNumColors(); ++color) {
+        smallest = std::min(smallest, element_coloring.getColorSize(color));
+        largest  = std::max(largest, element_coloring.getColorSize(color));
+    }
+
+    std::cout << "  " << label << " colors:            " << element_coloring.getNumColors() << " (" << smallest
+              << " to " << largest << " elements), " << seconds << " s\n";
+}
+
+/*!
+ * Benchmark the colored assembly on a block of elements for an increasing number of threads and print the results
+ *
+ * \param &name: The name of the element
+ * \param nx: The number of elements per side
+ * \param max_threads: The largest number of threads
+ * \param num_assemblies: The number of assemblies to time
+ */
+template <class element_type>
+void benchmarkBlock(const std::string &name, const unsigned int nx, const unsigned int max_threads,
+                    const unsigned int num_assemblies) {
+    static constexpr unsigned int node_count = element_type::local_nodes.size() / dim;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<element_type>(nx, nx, nx, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, num_additional_dof);
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    auto start = std::chrono::steady_clock::now();
+
+    coloring::ElementColoring greedy = coloring::colorElements(connectivity, coloring::GREEDY);
+
+    auto stop = std::chrono::steady_clock::now();
+
+    const double greedy_seconds = std::chrono::duration<double>(stop - start).count();
+
+    start = std::chrono::steady_clock::now();
+
+    coloring::ElementColoring balanced = coloring::colorElements(connectivity, coloring::BALANCED);
+
+    stop = std::chrono::steady_clock::now();
+
+    const double balanced_seconds = std::chrono::duration<double>(stop - start).count();
+
+    // A shear displacement field
+    std::vector<floatType> dof(numbering.getNumDOF(), 0), dof_dot(numbering.getNumDOF(), 0);
+
+    for (unsigned int node = 0; node < connectivity.getNumNodes(); ++node) {
+        dof[numbering.getGlobalDOF(node, assembly::DENSITY, 0)]         = 1.0;
+        dof[numbering.getGlobalDOF(node, assembly::VOLUME_FRACTION, 0)] = 1.0;
+        dof[numbering.getGlobalDOF(node, assembly::DISPLACEMENT, 0, 0)] = 0.01 * coordinates[dim * node + 2];
+    }
+
+    std::vector<floatType> residual(numbering.getNumDOF());
+
+    auto element_data = [&](const assembly::size_type e, std::array<floatType, node_count * dim> &x,
+                            std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(x) + dim * a);
+        }
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof), std::cend(dof), std::begin(u),
+                                std::end(u));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_dot), std::cend(dof_dot),
+                                std::begin(u_dot), std::end(u_dot));
+    };
+
+    // The kernels own their model and element so they may be called concurrently
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, x, u, u_dot);
+
+        element_type element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        ElasticModel model;
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, response_size, nphases,
+                                                        num_additional_dof>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), model, residual_begin, residual_end);
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, x, u, u_dot);
+
+        element_type element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        ElasticModel model;
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, response_size, nphases,
+                                                        num_additional_dof>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), 1.0, 1.0, model, residual_begin, residual_end, jacobian_begin,
+            jacobian_end);
+    };
+
+    std::cout << name << "\n";
+    std::cout << "  elements:                  " << connectivity.getNumElements() << "\n";
+    std::cout << "  dof:                       " << numbering.getNumDOF() << "\n";
+
+    printColoring("greedy  ", greedy, greedy_seconds);
+    printColoring("balanced", balanced, balanced_seconds);
+
+    std::cout << "  " << std::setw(8) << "threads" << std::setw(14) << "residual (s)" << std::setw(10) << "speedup"
+              << std::setw(14) << "jacobian (s)" << std::setw(10) << "speedup" << std::setw(12) << "efficiency\n";
+
+    double residual_serial = 0, jacobian_serial = 0;
+
+    for (unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        // The threads are created once per thread count so that only the assemblies are timed
+        tardigradeBalanceEquations::threadPool::ThreadPool pool(num_threads);
+
+        start = std::chrono::steady_clock::now();
+
+        for (unsigned int n = 0; n < num_assemblies; ++n) {
+            coloring::assembleResidual(connectivity, numbering, balanced, residual_kernel, std::begin(residual),
+                                       std::end(residual), pool);
+        }
+
+        stop = std::chrono::steady_clock::now();
+
+        const double residual_seconds = std::chrono::duration<double>(stop - start).count() / num_assemblies;
+
+        start = std::chrono::steady_clock::now();
+
+        for (unsigned int n = 0; n < num_assemblies; ++n) {
+            coloring::assembleResidualAndJacobian(connectivity, numbering, balanced, jacobian_kernel,
+                                                  std::begin(residual), std::end(residual), jacobian, pool);
+        }
+
+        stop = std::chrono::steady_clock::now();
+
+        const double jacobian_seconds = std::chrono::duration<double>(stop - start).count() / num_assemblies;
+
+        if (num_threads == 1) {
+            residual_serial = residual_seconds;
+            jacobian_serial = jacobian_seconds;
+        }
+
+        std::cout << "  " << std::setw(8) << num_threads << std::setw(14) << residual_seconds << std::setw(10)
+                  << residual_serial / residual_seconds << std::setw(14) << jacobian_seconds << std::setw(10)
+                  << jacobian_serial / jacobian_seconds << std::setw(11)
+                  << jacobian_serial / jacobian_seconds / num_threads << "\n";
+    }
+}
+
+int main(int argc, char **argv) {
+    const unsigned int nx             = (argc > 1) ? std::atoi(argv[1]) : 6;
+    const unsigned int max_threads    = (argc > 2) ? std::atoi(argv[2]) : 64;
+    const unsigned int num_assemblies = (argc > 3) ? std::atoi(argv[3]) : 1;
+
+    std::cout << "hardware threads:            " << std::thread::hardware_concurrency() << "\n";
+
+    benchmarkBlock<LinearHex>("LinearHex", nx, max_threads, num_assemblies);
+
+    benchmarkBlock<QuadraticHex>("QuadraticHex", nx, max_threads, num_assemblies);
+
+    return 0;
+}
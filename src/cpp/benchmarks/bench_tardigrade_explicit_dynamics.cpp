@@ -0,0 +1,198 @@
+/**
+ * \file bench_tardigrade_explicit_dynamics.cpp
+ *
+ * Benchmark of the residual-only explicit dynamics update on a block of linear hex elements
+ *
+ * Usage: bench_tardigrade_explicit_dynamics [elements per side (default 20)] [number of steps (default 20)]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_explicit_dynamics.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int node_count = 8;  //!< The number of nodes in the element
+
+constexpr unsigned int num_points = 8;  //!< The number of integration points in the element
+
+constexpr unsigned int response_size = 15;  //!< The size of the material response vector
+
+int main(int argc, char **argv) {
+    const unsigned int nx     = (argc > 1) ? std::atoi(argv[1]) : 20;
+    const unsigned int nsteps = (argc > 2) ? std::atoi(argv[2]) : 20;
+
+    const unsigned int nn = nx + 1;
+
+    const unsigned int num_nodes = nn * nn * nn;
+
+    const unsigned int num_elements = nx * nx * nx;
+
+    const floatType h = 1.0 / nx;
+
+    // Linear elastic material parameters
+    const floatType rho0 = 1.0, lambda = 1.0, mu = 1.0;
+
+    const floatType dt = 0.5 * h / std::sqrt((lambda + 2 * mu) / rho0);
+
+    // Build the mesh of the unit cube
+    const std::array<unsigned int, node_count * dim> corner_offsets = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+                                                                       0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1};
+
+    std::vector<unsigned int> connectivity(num_elements * node_count);
+
+    std::vector<std::array<floatType, node_count * dim>> element_coordinates(num_elements);
+
+    std::vector<LinearHex> elements;
+
+    elements.reserve(num_elements);
+
+    for (unsigned int k = 0; k < nx; ++k) {
+        for (unsigned int j = 0; j < nx; ++j) {
+            for (unsigned int i = 0; i < nx; ++i) {
+                const unsigned int e = i + nx * (j + nx * k);
+
+                for (unsigned int a = 0; a < node_count; ++a) {
+                    const unsigned int ii = i + corner_offsets[dim * a + 0];
+                    const unsigned int jj = j + corner_offsets[dim * a + 1];
+                    const unsigned int kk = k + corner_offsets[dim * a + 2];
+
+                    connectivity[node_count * e + a] = ii + nn * (jj + nn * kk);
+
+                    element_coordinates[e][dim * a + 0] = h * ii;
+                    element_coordinates[e][dim * a + 1] = h * jj;
+                    element_coordinates[e][dim * a + 2] = h * kk;
+                }
+
+                elements.emplace_back(std::cbegin(element_coordinates[e]), std::cend(element_coordinates[e]),
+                                      std::cbegin(element_coordinates[e]), std::cend(element_coordinates[e]));
+            }
+        }
+    }
+
+    // Nodal fields
+    std::vector<floatType> mass(num_nodes, 0);
+    std::vector<floatType> force(num_nodes * dim);
+    std::vector<floatType> acceleration(num_nodes * dim);
+    std::vector<floatType> velocity(num_nodes * dim, 0);
+    std::vector<floatType> displacement(num_nodes * dim, 0);
+
+    // Shear the block with an initial velocity field
+    for (unsigned int k = 0; k < nn; ++k) {
+        for (unsigned int n = nn * nn * k; n < nn * nn * (k + 1); ++n) {
+            velocity[dim * n + 0] = 0.01 * h * k;
+        }
+    }
+
+    // Element scratch
+    std::array<floatType, node_count> density;
+    std::array<floatType, node_count> density_dot;
+    std::array<floatType, node_count> volume_fraction;
+    std::array<floatType, node_count> element_mass;
+    std::array<floatType, node_count * dim> element_velocity;
+    std::array<floatType, node_count * dim> element_displacement;
+    std::array<floatType, node_count * dim> element_force;
+    std::array<floatType, num_points * response_size> material_response;
+    std::array<floatType, dim> xi;
+    std::array<floatType, dim * dim> grad_u;
+    floatType weight;
+
+    std::fill(std::begin(density), std::end(density), rho0);
+    std::fill(std::begin(density_dot), std::end(density_dot), 0);
+    std::fill(std::begin(volume_fraction), std::end(volume_fraction), 1);
+    std::fill(std::begin(material_response), std::end(material_response), 0);
+
+    // Assemble the lumped mass
+    for (unsigned int e = 0; e < num_elements; ++e) {
+        tardigradeBalanceEquations::explicitDynamics::computeLumpedMass<1>(
+            elements[e], std::cbegin(density), std::cend(density), std::begin(element_mass), std::end(element_mass));
+
+        for (unsigned int a = 0; a < node_count; ++a) {
+            mass[connectivity[node_count * e + a]] += element_mass[a];
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int step = 0; step < nsteps; ++step) {
+        std::fill(std::begin(force), std::end(force), 0);
+
+        for (unsigned int e = 0; e < num_elements; ++e) {
+            for (unsigned int a = 0; a < node_count; ++a) {
+                const unsigned int n = connectivity[node_count * e + a];
+
+                for (unsigned int i = 0; i < dim; ++i) {
+                    element_velocity[dim * a + i]     = velocity[dim * n + i];
+                    element_displacement[dim * a + i] = displacement[dim * n + i];
+                }
+            }
+
+            // Small-strain linear elastic stress at the integration points
+            for (unsigned int qp = 0; qp < num_points; ++qp) {
+                elements[e].GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight);
+
+                elements[e].GetGlobalQuantityGradient(std::cbegin(xi), std::cend(xi),
+                                                      std::cbegin(element_displacement),
+                                                      std::cend(element_displacement), std::begin(grad_u),
+                                                      std::end(grad_u), false);
+
+                const floatType trace = grad_u[0] + grad_u[4] + grad_u[8];
+
+                for (unsigned int i = 0; i < dim; ++i) {
+                    for (unsigned int j = 0; j < dim; ++j) {
+                        material_response[response_size * qp + 3 + dim * i + j] =
+                            mu * (grad_u[dim * i + j] + grad_u[dim * j + i]) + ((i == j) ? lambda * trace : 0);
+                    }
+                }
+            }
+
+            tardigradeBalanceEquations::explicitDynamics::computeBalanceOfLinearMomentumForce<dim, dim, 0, 3, 12, 1>(
+                elements[e], std::cbegin(element_coordinates[e]), std::cend(element_coordinates[e]),
+                std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+                std::cbegin(element_velocity), std::cend(element_velocity), std::cbegin(material_response),
+                std::cend(material_response), std::cbegin(volume_fraction), std::cend(volume_fraction),
+                std::begin(element_force), std::end(element_force));
+
+            for (unsigned int a = 0; a < node_count; ++a) {
+                const unsigned int n = connectivity[node_count * e + a];
+
+                for (unsigned int i = 0; i < dim; ++i) {
+                    force[dim * n + i] += element_force[dim * a + i];
+                }
+            }
+        }
+
+        tardigradeBalanceEquations::explicitDynamics::computeLumpedAcceleration(
+            std::cbegin(mass), std::cend(mass), std::cbegin(force), std::cend(force), std::begin(acceleration),
+            std::end(acceleration));
+
+        tardigradeBalanceEquations::explicitDynamics::centralDifferenceUpdate(
+            (step == 0) ? 0. : dt, dt, std::cbegin(acceleration), std::cend(acceleration), std::begin(velocity),
+            std::end(velocity), std::begin(displacement), std::end(displacement));
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::cout << "elements:              " << num_elements << "\n";
+    std::cout << "nodes:                 " << num_nodes << "\n";
+    std::cout << "steps:                 " << nsteps << "\n";
+    std::cout << "wall time (s):         " << seconds << "\n";
+    std::cout << "steps per second:      " << nsteps / seconds << "\n";
+    std::cout << "element updates per s: " << num_elements * nsteps / seconds << "\n";
+
+    return 0;
+}
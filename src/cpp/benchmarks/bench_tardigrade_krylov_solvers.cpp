@@ -0,0 +1,122 @@
+/**
+ * \file bench_tardigrade_krylov_solvers.cpp
+ *
+ * Benchmark of GMRES and BiCGStab with the identity, Jacobi, block-Jacobi, and ILU(0) preconditioners on a
+ * non-symmetric system assembled in the BSR format over a generated block of linear hex elements. The setup time of
+ * each preconditioner and the number of iterations and the time of each solve are reported.
+ *
+ * Usage: bench_tardigrade_krylov_solvers [elements per side (default 8)] [number of threads (default 1)]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_krylov_solvers.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace block = tardigradeBalanceEquations::blockSparse;
+
+namespace krylov = tardigradeBalanceEquations::krylovSolvers;
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+constexpr int block_size = block::node_block_size<3, 1, 0>;  //!< The size of the node blocks
+
+using matrix_type = block::BSRMatrix<floatType, block_size>;  //!< The type of the Jacobian
+
+int main(int argc, char **argv) {
+    const unsigned int nx          = (argc > 1) ? std::atoi(argv[1]) : 8;
+    const unsigned int num_threads = (argc > 2) ? std::atoi(argv[2]) : 1;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<LinearHex>(nx, nx, nx, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 0);
+
+    matrix_type jacobian = block::buildBSRMatrix<floatType, block_size>(connectivity, numbering);
+
+    // A synthetic non-symmetric element Jacobian with a Laplacian-like coupling between the nodes
+    const assembly::size_type num_element_dof = connectivity.getNodesPerElement() * block_size;
+
+    auto kernel = [&](const assembly::size_type e, auto, auto, auto jacobian_begin, auto) {
+        for (assembly::size_type i = 0; i < num_element_dof; ++i) {
+            for (assembly::size_type j = 0; j < num_element_dof; ++j) {
+                const bool same_component = (i % block_size) == (j % block_size);
+
+                *(jacobian_begin + num_element_dof * i + j) =
+                    0.01 * std::cos(0.1 * (e + i + 3 * j)) +
+                    (same_component ? ((i == j) ? 1.0 : -1.0 / connectivity.getNodesPerElement()) : 0.0);
+            }
+        }
+    };
+
+    std::vector<floatType> residual(numbering.getNumDOF()), rhs(numbering.getNumDOF(), 1.0), x(numbering.getNumDOF());
+
+    block::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(residual), std::end(residual),
+                                       jacobian);
+
+    tardigradeBalanceEquations::threadPool::ThreadPool pool(num_threads);
+
+    krylov::MatrixOperator<matrix_type> A(jacobian, &pool);
+
+    krylov::KrylovOptions options;
+
+    options.max_iterations = 2000;
+
+    std::cout << "LinearHex block with " << numbering.getNumDOF() << " dof on " << num_threads << " thread(s)\n";
+    std::cout << std::setw(14) << "preconditioner" << std::setw(12) << "setup (s)" << std::setw(12) << "method"
+              << std::setw(8) << "iter" << std::setw(12) << "solve (s)"
+              << "\n";
+
+    auto run = [&](const std::string &name, auto preconditioner) {
+        auto start = std::chrono::steady_clock::now();
+
+        preconditioner.compute(jacobian);
+
+        const double setup_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (const auto method : {krylov::GMRES, krylov::BICGSTAB}) {
+            std::fill(std::begin(x), std::end(x), 0.);
+
+            start = std::chrono::steady_clock::now();
+
+            krylov::KrylovStatistics statistics =
+                (method == krylov::GMRES)
+                    ? krylov::gmres(A, preconditioner, std::cbegin(rhs), std::cend(rhs), std::begin(x), std::end(x),
+                                    options, &pool)
+                    : krylov::bicgstab(A, preconditioner, std::cbegin(rhs), std::cend(rhs), std::begin(x),
+                                       std::end(x), options, &pool);
+
+            const double solve_seconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << std::setw(14) << name << std::setw(12) << setup_seconds << std::setw(12)
+                      << ((method == krylov::GMRES) ? "GMRES" : "BiCGStab") << std::setw(8) << statistics.iterations
+                      << std::setw(12) << solve_seconds << (statistics.converged ? "" : " (not converged)") << "\n";
+        }
+    };
+
+    run("none", krylov::IdentityPreconditioner());
+
+    run("Jacobi", krylov::Jacobi<floatType>(&pool));
+
+    run("block-Jacobi", krylov::BlockJacobi<floatType>(block_size, &pool));
+
+    run("ILU(0)", krylov::ILU0<floatType>(&pool));
+
+    return 0;
+}
@@ -0,0 +1,347 @@
+/**
+ * \file bench_tardigrade_matrix_free.cpp
+ *
+ * Benchmark of the matrix-free element operator against the assembled CSR Jacobian of the balance of linear momentum
+ * of a multiphase material on a generated block of quadratic hex elements. The memory and the time of a product are
+ * reported for the assembled Jacobian, for the element operator which recomputes the material tangents, and for the
+ * element operator which caches them once per linearization.
+ *
+ * Usage: bench_tardigrade_matrix_free [elements per side (default 3)] [number of threads (default 1)]
+ *                                     [number of products (default 5)]
+ */
+
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_matrix_free.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace coloring = tardigradeBalanceEquations::elementColoring;
+
+namespace matrix_free = tardigradeBalanceEquations::matrixFree;
+
+namespace pool = tardigradeBalanceEquations::threadPool;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int nphases = 3;  //!< The number of phases
+
+constexpr unsigned int num_additional_dof = 0;  //!< The number of additional degrees of freedom
+
+constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The dof of a node
+
+constexpr unsigned int node_count =
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration::node_count;  //!< The nodes of an element
+
+constexpr unsigned int num_points = tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration::
+    num_volume_integration_points;  //!< The number of integration points of an element
+
+constexpr unsigned int response_size = 16;  //!< The size of the material response vector of a phase
+
+/*!
+ * A small-strain elastic material model of the displacement gradient of each phase with a pressure quadratic in the
+ * temperature of the phase
+ */
+struct ElasticModel {
+    floatType lambda = 1.0;  //!< The first Lame parameter
+
+    floatType mu = 1.0;  //!< The shear modulus
+
+    floatType thermal = 0.1;  //!< The thermal pressure coefficient
+
+    /*!
+     * Compute the Cauchy stress
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        std::fill(response_begin, response_end, 0);
+
+        for (unsigned int p = 0; p < nphases; ++p) {
+            auto grad_w = point_dof_begin + num_dof + dim * (nphases + dim * p);
+
+            auto stress = response_begin + response_size * p + 3;
+
+            const floatType theta = *(point_dof_begin + nphases * (1 + 2 * dim) + p);
+
+            const floatType trace = *(grad_w + 0) + *(grad_w + 4) + *(grad_w + 8);
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                for (unsigned int j = 0; j < dim; ++j) {
+                    *(stress + dim * i + j) = mu * (*(grad_w + dim * i + j) + *(grad_w + dim * j + i)) +
+                                              ((i == j) ? lambda * trace + thermal * theta * theta : 0);
+                }
+            }
+        }
+    }
+
+    /*!
+     * Compute the Cauchy stress and its Jacobian w.r.t. the point dof vector
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        (*this)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+
+        std::fill(jacobian_begin, jacobian_end, 0);
+
+        constexpr unsigned int num_columns = num_dof * (1 + dim);
+
+        for (unsigned int p = 0; p < nphases; ++p) {
+            const unsigned int grad_w = num_dof + dim * (nphases + dim * p);
+
+            const unsigned int theta = nphases * (1 + 2 * dim) + p;
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                for (unsigned int j = 0; j < dim; ++j) {
+                    auto row = jacobian_begin + num_columns * (response_size * p + 3 + dim * i + j);
+
+                    *(row + grad_w + dim * i + j) += mu;
+                    *(row + grad_w + dim * j + i) += mu;
+
+                    if (i == j) {
+                        *(row + theta) += 2 * thermal * (*(point_dof_begin + theta));
+
+                        for (unsigned int k = 0; k < dim; ++k) {
+                            *(row + grad_w + dim * k + k) += lambda;
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+/*!
+ * Print a row of the results table
+ *
+ * \param &label: The label of the row
+ * \param bytes: The number of bytes stored by the method
+ * \param setup_seconds: The time to assemble the Jacobian or fill the cache
+ * \param product_seconds: The time of a product
+ */
+void printRow(const std::string &label, const std::size_t bytes, const double setup_seconds,
+              const double product_seconds) {
+    std::cout << "  " << std::left << std::setw(24) << label << std::right << std::setw(14) << bytes / 1048576.
+              << std::setw(14) << setup_seconds << std::setw(14) << product_seconds << "\n";
+}
+
+int main(int argc, char **argv) {
+    const unsigned int nx           = (argc > 1) ? std::atoi(argv[1]) : 3;
+    const unsigned int num_threads  = (argc > 2) ? std::atoi(argv[2]) : 1;
+    const unsigned int num_products = (argc > 3) ? std::atoi(argv[3]) : 5;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<QuadraticHex>(nx, nx, nx, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, num_additional_dof);
+
+    coloring::ElementColoring element_coloring = coloring::colorElements(connectivity, coloring::BALANCED);
+
+    pool::ThreadPool thread_pool(num_threads);
+
+    std::vector<floatType> dof(numbering.getNumDOF(), 0), dof_dot(numbering.getNumDOF(), 0);
+
+    for (unsigned int node = 0; node < connectivity.getNumNodes(); ++node) {
+        for (unsigned int p = 0; p < nphases; ++p) {
+            dof[numbering.getGlobalDOF(node, assembly::DENSITY, p)]         = 1.0;
+            dof[numbering.getGlobalDOF(node, assembly::TEMPERATURE, p)]     = 1.0 + 0.1 * coordinates[dim * node];
+            dof[numbering.getGlobalDOF(node, assembly::VOLUME_FRACTION, p)] = 1.0 / nphases;
+            dof[numbering.getGlobalDOF(node, assembly::DISPLACEMENT, p, 0)] = 0.01 * coordinates[dim * node + 2];
+        }
+    }
+
+    std::vector<floatType> x(numbering.getNumDOF()), y(numbering.getNumDOF()), y_answer(numbering.getNumDOF());
+
+    for (unsigned int i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(0.37 * i);
+    }
+
+    ElasticModel model;
+
+    matrix_free::MaterialTangentCache<floatType> cache(connectivity.getNumElements(), num_points,
+                                                       nphases * response_size,
+                                                       nphases * response_size * num_dof * (1 + dim));
+
+    auto element_data = [&](const assembly::size_type e, std::array<floatType, node_count * dim> &X,
+                            std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(X) + dim * a);
+        }
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof), std::cend(dof), std::begin(u),
+                                std::end(u));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_dot), std::cend(dof_dot),
+                                std::begin(u_dot), std::end(u_dot));
+    };
+
+    // The kernels own their element and model so they may be called concurrently
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     X;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, X, u, u_dot);
+
+        QuadraticHex element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+        ElasticModel element_model;
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, response_size, nphases,
+                                                        num_additional_dof>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), 1.0, 1.0, element_model, residual_begin, residual_end,
+            jacobian_begin, jacobian_end);
+    };
+
+    auto element_product = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                               auto product_end, auto &element_model) {
+        std::array<floatType, node_count * dim>     X;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, X, u, u_dot);
+
+        QuadraticHex element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+        matrix_free::applyElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, response_size, nphases,
+                                                         num_additional_dof>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), 1.0, 1.0, element_model, x_begin, x_end, product_begin, product_end);
+    };
+
+    auto product_kernel = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                              auto product_end) {
+        ElasticModel element_model;
+
+        element_product(e, x_begin, x_end, product_begin, product_end, element_model);
+    };
+
+    auto cached_kernel = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                             auto product_end) {
+        matrix_free::CachedMaterialModel<floatType, ElasticModel> cached_model(cache, e, model);
+
+        element_product(e, x_begin, x_end, product_begin, product_end, cached_model);
+    };
+
+    auto timeProducts = [&](const auto &A) {
+        auto start = std::chrono::steady_clock::now();
+
+        for (unsigned int n = 0; n < num_products; ++n) {
+            A.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+        }
+
+        auto stop = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double>(stop - start).count() / num_products;
+    };
+
+    auto maxDifference = [&]() {
+        floatType difference = 0, scale = 0;
+
+        for (unsigned int i = 0; i < y.size(); ++i) {
+            difference = std::max(difference, std::fabs(y[i] - y_answer[i]));
+            scale      = std::max(scale, std::fabs(y_answer[i]));
+        }
+
+        return difference / scale;
+    };
+
+    std::cout << "QuadraticHex\n";
+    std::cout << "  elements:                  " << connectivity.getNumElements() << "\n";
+    std::cout << "  phases:                    " << nphases << "\n";
+    std::cout << "  dof:                       " << numbering.getNumDOF() << "\n";
+    std::cout << "  threads:                   " << thread_pool.getNumThreads() << "\n";
+
+    std::cout << "  " << std::left << std::setw(24) << "method" << std::right << std::setw(14) << "memory (MiB)"
+              << std::setw(14) << "setup (s)" << std::setw(14) << "product (s)\n";
+
+    // The assembled Jacobian
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+        std::vector<floatType> residual(numbering.getNumDOF());
+
+        coloring::assembleResidualAndJacobian(connectivity, numbering, element_coloring, jacobian_kernel,
+                                              std::begin(residual), std::end(residual), jacobian, thread_pool);
+
+        auto stop = std::chrono::steady_clock::now();
+
+        const std::size_t bytes = jacobian.getValues().size() * sizeof(floatType) +
+                                  (jacobian.getColumnIndices().size() + jacobian.getRowOffsets().size()) *
+                                      sizeof(assembly::size_type);
+
+        jacobian.multiply(std::cbegin(x), std::cend(x), std::begin(y_answer), std::end(y_answer));
+
+        const double product_seconds = timeProducts(jacobian);
+
+        printRow("assembled CSR", bytes, std::chrono::duration<double>(stop - start).count(), product_seconds);
+    }
+
+    // Recompute the material tangents for every product
+    {
+        auto element_operator = matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring,
+                                                                            product_kernel, &thread_pool);
+
+        printRow("matrix-free recompute", element_operator.getMemoryBytes(), 0, timeProducts(element_operator));
+
+        std::cout << "    relative difference:     " << maxDifference() << "\n";
+    }
+
+    // Cache the material tangents on the first product
+    {
+        auto element_operator = matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring,
+                                                                            cached_kernel, &thread_pool);
+
+        auto start = std::chrono::steady_clock::now();
+
+        element_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+        auto stop = std::chrono::steady_clock::now();
+
+        printRow("matrix-free cached", element_operator.getMemoryBytes() + cache.getMemoryBytes(),
+                 std::chrono::duration<double>(stop - start).count(), timeProducts(element_operator));
+
+        std::cout << "    relative difference:     " << maxDifference() << "\n";
+    }
+
+    return 0;
+}
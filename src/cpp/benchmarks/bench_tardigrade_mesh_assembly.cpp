@@ -0,0 +1,307 @@
+/**
+ * \file bench_tardigrade_mesh_assembly.cpp
+ *
+ * Benchmark of the mesh-level assembly of the balance of linear momentum into a global residual and a CSR Jacobian on
+ * generated blocks of linear and quadratic hex elements. The scatter of the element Jacobians by searching the rows of
+ * the CSR Jacobian is compared to the scatter with a precomputed scatter map.
+ *
+ * Usage: bench_tardigrade_mesh_assembly [elements per side (default 6)] [number of assemblies (default 2)]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_mesh_assembly.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int nphases = 1;  //!< The number of phases
+
+constexpr unsigned int num_additional_dof = 0;  //!< The number of additional degrees of freedom
+
+constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The dof of a node
+
+constexpr unsigned int response_size = 16;  //!< The size of the material response vector
+
+/*!
+ * A small-strain linear elastic material model of the displacement gradient
+ */
+struct ElasticModel {
+    floatType lambda = 1.0;  //!< The first Lame parameter
+
+    floatType mu = 1.0;  //!< The shear modulus
+
+    /*!
+     * Compute the Cauchy stress
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        std::fill(response_begin, response_end, 0);
+
+        auto grad_w = point_dof_begin + num_dof + dim * nphases;
+
+        const floatType trace = *(grad_w + 0) + *(grad_w + 4) + *(grad_w + 8);
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            for (unsigned int j = 0; j < dim; ++j) {
+                *(response_begin + 3 + dim * i + j) =
+                    mu * (*(grad_w + dim * i + j) + *(grad_w + dim * j + i)) + ((i == j) ? lambda * trace : 0);
+            }
+        }
+    }
+
+    /*!
+     * Compute the Cauchy stress and its Jacobian w.r.t. the point dof vector
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        (*this)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+
+        std::fill(jacobian_begin, jacobian_end, 0);
+
+        constexpr unsigned int num_columns = num_dof * (1 + dim);
+
+        const unsigned int grad_w = num_dof + dim * nphases;
+
+        for (unsigned int i = 0; i < dim; ++i) {
+            for (unsigned int j = 0; j < dim; ++j) {
+                auto row = jacobian_begin + num_columns * (3 + dim * i + j);
+
+                *(row + grad_w + dim * i + j) += mu;
+                *(row + grad_w + dim * j + i) += mu;
+
+                if (i == j) {
+                    for (unsigned int k = 0; k < dim; ++k) {
+                        *(row + grad_w + dim * k + k) += lambda;
+                    }
+                }
+            }
+        }
+    }
+};
+
+/*!
+ * Benchmark the assembly on a block of elements and print the results
+ *
+ * \param &name: The name of the element
+ * \param nx: The number of elements per side
+ * \param num_assemblies: The number of assemblies to time
+ */
+template <class element_type>
+void benchmarkBlock(const std::string &name, const unsigned int nx, const unsigned int num_assemblies) {
+    static constexpr unsigned int node_count = element_type::local_nodes.size() / dim;
+
+    std::vector<floatType> coordinates;
+
+    auto start = std::chrono::steady_clock::now();
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<element_type>(nx, nx, nx, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, num_additional_dof);
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    auto stop = std::chrono::steady_clock::now();
+
+    const double setup_seconds = std::chrono::duration<double>(stop - start).count();
+
+    start = std::chrono::steady_clock::now();
+
+    assembly::ScatterMap scatter_map(connectivity, numbering, jacobian);
+
+    stop = std::chrono::steady_clock::now();
+
+    const double map_seconds = std::chrono::duration<double>(stop - start).count();
+
+    // A shear displacement field
+    std::vector<floatType> dof(numbering.getNumDOF(), 0), dof_dot(numbering.getNumDOF(), 0);
+
+    for (unsigned int node = 0; node < connectivity.getNumNodes(); ++node) {
+        dof[numbering.getGlobalDOF(node, assembly::DENSITY, 0)]         = 1.0;
+        dof[numbering.getGlobalDOF(node, assembly::VOLUME_FRACTION, 0)] = 1.0;
+        dof[numbering.getGlobalDOF(node, assembly::DISPLACEMENT, 0, 0)] = 0.01 * coordinates[dim * node + 2];
+    }
+
+    std::vector<floatType> residual(numbering.getNumDOF());
+
+    ElasticModel model;
+
+    auto element_data = [&](const assembly::size_type e, std::array<floatType, node_count * dim> &x,
+                            std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(x) + dim * a);
+        }
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof), std::cend(dof), std::begin(u),
+                                std::end(u));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_dot), std::cend(dof_dot),
+                                std::begin(u_dot), std::end(u_dot));
+    };
+
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, x, u, u_dot);
+
+        element_type element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, response_size, nphases,
+                                                        num_additional_dof>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), model, residual_begin, residual_end);
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, x, u, u_dot);
+
+        element_type element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, response_size, nphases,
+                                                        num_additional_dof>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), 1.0, 1.0, model, residual_begin, residual_end, jacobian_begin,
+            jacobian_end);
+    };
+
+    start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_assemblies; ++n) {
+        assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual),
+                                   std::end(residual));
+    }
+
+    stop = std::chrono::steady_clock::now();
+
+    const double residual_seconds = std::chrono::duration<double>(stop - start).count() / num_assemblies;
+
+    start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_assemblies; ++n) {
+        assembly::assembleResidualAndJacobian(connectivity, numbering, jacobian_kernel, std::begin(residual),
+                                              std::end(residual), jacobian);
+    }
+
+    stop = std::chrono::steady_clock::now();
+
+    const double jacobian_seconds = std::chrono::duration<double>(stop - start).count() / num_assemblies;
+
+    start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_assemblies; ++n) {
+        assembly::assembleResidualAndJacobian(scatter_map, jacobian_kernel, std::begin(residual), std::end(residual),
+                                              jacobian);
+    }
+
+    stop = std::chrono::steady_clock::now();
+
+    const double mapped_seconds = std::chrono::duration<double>(stop - start).count() / num_assemblies;
+
+    // Isolate the cost of the scatter with a kernel which leaves the element arrays at zero
+    auto empty_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end, auto jacobian_begin,
+                            auto jacobian_end) {};
+
+    const unsigned int num_scatters = 10 * num_assemblies;
+
+    start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_scatters; ++n) {
+        assembly::assembleResidualAndJacobian(connectivity, numbering, empty_kernel, std::begin(residual),
+                                              std::end(residual), jacobian);
+    }
+
+    stop = std::chrono::steady_clock::now();
+
+    const double search_scatter_seconds = std::chrono::duration<double>(stop - start).count() / num_scatters;
+
+    start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_scatters; ++n) {
+        assembly::assembleResidualAndJacobian(scatter_map, empty_kernel, std::begin(residual), std::end(residual),
+                                              jacobian);
+    }
+
+    stop = std::chrono::steady_clock::now();
+
+    const double mapped_scatter_seconds = std::chrono::duration<double>(stop - start).count() / num_scatters;
+
+    const double num_elements = connectivity.getNumElements();
+
+    std::cout << name << "\n";
+    std::cout << "  elements:                  " << connectivity.getNumElements() << "\n";
+    std::cout << "  nodes:                     " << connectivity.getNumNodes() << "\n";
+    std::cout << "  dof:                       " << numbering.getNumDOF() << "\n";
+    std::cout << "  jacobian non-zeros:        " << jacobian.getNumNonZeros() << "\n";
+    std::cout << "  jacobian memory (MB):      "
+              << (jacobian.getNumNonZeros() * (sizeof(floatType) + sizeof(assembly::size_type))) / 1e6 << "\n";
+    std::cout << "  mesh and CSR setup (s):    " << setup_seconds << "\n";
+    std::cout << "  residual assembly (s):     " << residual_seconds << "\n";
+    std::cout << "  residual elements per s:   " << num_elements / residual_seconds << "\n";
+    std::cout << "  jacobian assembly (s):     " << jacobian_seconds << "\n";
+    std::cout << "  jacobian elements per s:   " << num_elements / jacobian_seconds << "\n";
+    std::cout << "  scatter map setup (s):     " << map_seconds << "\n";
+    std::cout << "  scatter map memory (MB):   "
+              << (scatter_map.getNumElements() * scatter_map.getNumElementDOF() *
+                  (scatter_map.getNumElementDOF() + 1) * sizeof(assembly::size_type)) /
+                     1e6
+              << "\n";
+    std::cout << "  mapped jacobian (s):       " << mapped_seconds << "\n";
+    std::cout << "  search scatter only (s):   " << search_scatter_seconds << "\n";
+    std::cout << "  mapped scatter only (s):   " << mapped_scatter_seconds << "\n";
+}
+
+int main(int argc, char **argv) {
+    const unsigned int nx             = (argc > 1) ? std::atoi(argv[1]) : 6;
+    const unsigned int num_assemblies = (argc > 2) ? std::atoi(argv[2]) : 2;
+
+    benchmarkBlock<LinearHex>("LinearHex", nx, num_assemblies);
+
+    benchmarkBlock<QuadraticHex>("QuadraticHex", nx, num_assemblies);
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+/**
+ * \file bench_tardigrade_newton_solver.cpp
+ *
+ * Benchmark of full Newton, modified Newton, and Newton with a line search on a nonlinear system assembled over a
+ * generated block of linear hex elements. Each element couples the degrees of freedom of its nodes linearly and adds
+ * a cubic reaction at each node. The number of residual and Jacobian evaluations and the time spent in the residual,
+ * the Jacobian, the factorization, and the linear solves are reported for each strategy.
+ *
+ * Usage: bench_tardigrade_newton_solver [elements per side (default 6)]
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_newton_solver.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace newton = tardigradeBalanceEquations::newtonSolver;
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+/*!
+ * The nonlinear mesh problem
+ */
+struct MeshProblem {
+    const assembly::MeshConnectivity &connectivity;  //!< The mesh connectivity
+
+    const assembly::DofNumbering &numbering;  //!< The numbering of the degrees of freedom
+
+    /*!
+     * Compute the residual and optionally the Jacobian of an element
+     *
+     * \param e: The element
+     * \param &dof: The node-major element degrees of freedom
+     * \param residual_begin: The starting iterator of the element residual
+     * \param jacobian_begin: The starting iterator of the element Jacobian
+     */
+    template <bool compute_jacobian, class residual_iter, class jacobian_iter>
+    void element(const assembly::size_type e, const std::vector<floatType> &dof, residual_iter residual_begin,
+                 jacobian_iter jacobian_begin) const {
+        const assembly::size_type nodes           = connectivity.getNodesPerElement();
+        const assembly::size_type num_node_dof    = numbering.getNumNodeDOF();
+        const assembly::size_type num_element_dof = nodes * num_node_dof;
+        const floatType           coupling        = 1.0 / nodes;
+
+        for (assembly::size_type a = 0; a < nodes; ++a) {
+            for (assembly::size_type i = 0; i < num_node_dof; ++i) {
+                const assembly::size_type row = num_node_dof * a + i;
+
+                const floatType u = dof[row];
+
+                const floatType f = 1.0 + 0.1 * std::sin(0.01 * e + i);
+
+                floatType value = coupling * (u + u * u * u - f);
+
+                for (assembly::size_type b = 0; b < nodes; ++b) {
+                    value += coupling * (u - dof[num_node_dof * b + i]);
+                }
+
+                *(residual_begin + row) += value;
+
+                if constexpr (compute_jacobian) {
+                    *(jacobian_begin + num_element_dof * row + row) += coupling * (1 + 3 * u * u) + coupling * nodes;
+
+                    for (assembly::size_type b = 0; b < nodes; ++b) {
+                        *(jacobian_begin + num_element_dof * row + num_node_dof * b + i) -= coupling;
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * Evaluate the global residual
+     *
+     * \param dof_begin: The starting iterator of the global degrees of freedom
+     * \param dof_end: The stopping iterator of the global degrees of freedom
+     * \param residual_begin: The starting iterator of the global residual
+     * \param residual_end: The stopping iterator of the global residual
+     */
+    template <class dof_iter, class residual_iter>
+    void operator()(const dof_iter &dof_begin, const dof_iter &dof_end, residual_iter residual_begin,
+                    residual_iter residual_end) const {
+        std::vector<floatType> dof(connectivity.getNodesPerElement() * numbering.getNumNodeDOF());
+
+        auto kernel = [&](const assembly::size_type e, auto element_residual_begin, auto element_residual_end) {
+            assembly::gatherElement(connectivity, numbering, e, dof_begin, dof_end, std::begin(dof), std::end(dof));
+
+            element<false>(e, dof, element_residual_begin, element_residual_begin);
+        };
+
+        assembly::assembleResidual(connectivity, numbering, kernel, residual_begin, residual_end);
+    }
+
+    /*!
+     * Evaluate the global residual and the Jacobian
+     *
+     * \param dof_begin: The starting iterator of the global degrees of freedom
+     * \param dof_end: The stopping iterator of the global degrees of freedom
+     * \param residual_begin: The starting iterator of the global residual
+     * \param residual_end: The stopping iterator of the global residual
+     * \param &jacobian: The global Jacobian
+     */
+    template <class dof_iter, class residual_iter>
+    void operator()(const dof_iter &dof_begin, const dof_iter &dof_end, residual_iter residual_begin,
+                    residual_iter residual_end, assembly::CSRMatrix<floatType> &jacobian) const {
+        std::vector<floatType> dof(connectivity.getNodesPerElement() * numbering.getNumNodeDOF());
+
+        auto kernel = [&](const assembly::size_type e, auto element_residual_begin, auto element_residual_end,
+                          auto element_jacobian_begin, auto element_jacobian_end) {
+            assembly::gatherElement(connectivity, numbering, e, dof_begin, dof_end, std::begin(dof), std::end(dof));
+
+            element<true>(e, dof, element_residual_begin, element_jacobian_begin);
+        };
+
+        assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, residual_begin, residual_end, jacobian);
+    }
+};
+
+int main(int argc, char **argv) {
+    const unsigned int nx = (argc > 1) ? std::atoi(argv[1]) : 6;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<LinearHex>(nx, nx, nx, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, 1, 0);
+
+    MeshProblem problem{connectivity, numbering};
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    std::cout << "LinearHex block with " << connectivity.getNumElements() << " elements and " << numbering.getNumDOF()
+              << " dof\n";
+    std::cout << std::setw(22) << "strategy" << std::setw(7) << "iter" << std::setw(7) << "R" << std::setw(7) << "J"
+              << std::setw(12) << "R (s)" << std::setw(12) << "J (s)" << std::setw(12) << "setup (s)" << std::setw(12)
+              << "solve (s)" << std::setw(12) << "total (s)"
+              << "\n";
+
+    auto run = [&](const std::string &name, const unsigned int max_jacobian_age, const bool line_search) {
+        std::vector<floatType> dof(numbering.getNumDOF(), 3.0);
+
+        newton::SparseLUSolver<floatType> solver;
+
+        newton::NewtonOptions options;
+
+        options.max_jacobian_age = max_jacobian_age;
+
+        options.max_contraction = 0.9;
+
+        options.line_search = line_search;
+
+        options.max_iterations = 100;
+
+        newton::NewtonStatistics statistics =
+            newton::solve(problem, problem, jacobian, solver, std::begin(dof), std::end(dof), options);
+
+        std::cout << std::setw(22) << name << std::setw(7) << statistics.iterations << std::setw(7)
+                  << statistics.residual_evaluations << std::setw(7) << statistics.jacobian_evaluations << std::setw(12)
+                  << statistics.residual_time << std::setw(12) << statistics.jacobian_time << std::setw(12)
+                  << statistics.setup_time << std::setw(12) << statistics.solve_time << std::setw(12)
+                  << statistics.residual_time + statistics.jacobian_time + statistics.setup_time +
+                         statistics.solve_time
+                  << (statistics.converged ? "" : " (not converged)") << "\n";
+    };
+
+    run("full Newton", 1, false);
+
+    run("full Newton + LS", 1, true);
+
+    run("modified Newton (3)", 3, false);
+
+    run("modified Newton (10)", 10, false);
+
+    run("modified Newton + LS", 10, true);
+
+    return 0;
+}
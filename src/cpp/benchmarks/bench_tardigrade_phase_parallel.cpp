@@ -0,0 +1,257 @@
+/**
+ * \file bench_tardigrade_phase_parallel.cpp
+ *
+ * Benchmark of the multiphase balance of mass and balance of energy for one to eight phases. The phase-by-phase
+ * multiphase overloads are compared to the phase-batched kernels and the material-response Jacobians of the balance of
+ * energy are evaluated with the phases on one thread and distributed over the threads of a pool which is created once
+ * before the timings.
+ *
+ * Usage: bench_tardigrade_phase_parallel [number of residual evaluations (default 1000000)] [number of Jacobian
+ * evaluations (default 2000)]
+ */
+
+#include <tardigrade_balance_of_energy.h>
+#include <tardigrade_balance_of_mass.h>
+#include <tardigrade_phase_parallel.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef double floatType;  //!< Define the float type
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int num_additional_dof = 2;  //!< The number of additional degrees of freedom
+
+constexpr unsigned int material_response_size = 17;  //!< The size of the material response of each phase
+
+volatile floatType sink = 0;  //!< Keeps the results of the benchmarks alive
+
+/*!
+ * Fill a container with smoothly varying values
+ *
+ * \param &v: The container to fill
+ * \param &offset: The phase offset of the values
+ */
+template <class container>
+void fill(container &v, const floatType offset) {
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = 0.5 + 0.3 * std::sin(1.7 * i + offset);
+    }
+}
+
+/*!
+ * Time a function and return the nanoseconds per call
+ *
+ * \param &num_evaluations: The number of calls
+ * \param &function: The function to call with the evaluation number
+ */
+template <class function_type>
+double timeEvaluations(const unsigned int num_evaluations, function_type function) {
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int n = 0; n < num_evaluations; ++n) {
+        function(n);
+    }
+
+    auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / num_evaluations;
+}
+
+/*!
+ * Run the benchmarks for a fixed number of phases and print a row of the table
+ *
+ * \param &num_evaluations: The number of residual evaluations
+ * \param &num_jacobian_evaluations: The number of Jacobian evaluations
+ * \param &pool: The thread pool the phases of the Jacobian are distributed over
+ */
+template <unsigned int nphases>
+void benchmarkPhases(const unsigned int num_evaluations, const unsigned int num_jacobian_evaluations,
+                     tardigradeBalanceEquations::threadPool::ThreadPool &pool) {
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+
+    constexpr unsigned int num_dof = nphases * 10 + num_additional_dof;
+
+    std::array<floatType, nphases>             density, density_dot, internal_energy, internal_energy_dot;
+    std::array<floatType, nphases>             volume_fraction, internal_heat_generation;
+    std::array<floatType, nphases * dim>       density_gradient, internal_energy_gradient, velocity;
+    std::array<floatType, nphases * dim>       net_interphase_force, heat_flux;
+    std::array<floatType, nphases * dim * dim> velocity_gradient, cauchy_stress;
+    std::array<floatType, dim>                 test_function_gradient, interpolation_function_gradient;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(internal_energy, 0.25);
+    fill(internal_energy_dot, 0.35);
+    fill(volume_fraction, 0.3);
+    fill(internal_heat_generation, 0.32);
+    fill(density_gradient, 0.4);
+    fill(internal_energy_gradient, 0.45);
+    fill(velocity, 0.5);
+    fill(net_interphase_force, 0.55);
+    fill(heat_flux, 0.6);
+    fill(velocity_gradient, 0.7);
+    fill(cauchy_stress, 0.75);
+    fill(test_function_gradient, 0.8);
+    fill(interpolation_function_gradient, 0.9);
+
+    const floatType test_function = 0.6, interpolation_function = 0.45;
+
+    const floatType dRhoDotdRho = 1.4, dEDotdE = 1.9, dUDotdU = 2.1;
+
+    std::array<floatType, nphases> result;
+
+    // Balance of mass
+    const double mass_loop = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        density[0] = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim>(
+            std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+            std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+            std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(result), std::end(result));
+
+        sink = sink + result[nphases - 1];
+    });
+
+    const double mass_batched = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        density[0] = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+            std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+            std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+            std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(result), std::end(result));
+
+        sink = sink + result[nphases - 1];
+    });
+
+    // Balance of energy
+    const double energy_loop = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        density[0] = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false>(
+            std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+            std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+            std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+            std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(velocity),
+            std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(cauchy_stress), std::cend(cauchy_stress), std::cbegin(volume_fraction),
+            std::cend(volume_fraction), std::cbegin(internal_heat_generation), std::cend(internal_heat_generation),
+            std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+            std::cend(heat_flux), test_function, std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), std::begin(result), std::end(result));
+
+        sink = sink + result[nphases - 1];
+    });
+
+    const double energy_batched = timeEvaluations(num_evaluations, [&](const unsigned int n) {
+        density[0] = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyPhaseBatched<dim, false, nphases>(
+            std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+            std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+            std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+            std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(velocity),
+            std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(cauchy_stress), std::cend(cauchy_stress), std::cbegin(volume_fraction),
+            std::cend(volume_fraction), std::cbegin(internal_heat_generation), std::cend(internal_heat_generation),
+            std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+            std::cend(heat_flux), test_function, std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), std::begin(result), std::end(result));
+
+        sink = sink + result[nphases - 1];
+    });
+
+    // Material response Jacobian of the balance of energy
+    std::vector<floatType> material_response(nphases * material_response_size);
+    std::vector<floatType> material_response_jacobian(nphases * material_response_size * num_dof * (1 + dim));
+    std::vector<floatType> dof_gradient(num_dof * dim);
+
+    fill(material_response, 1.0);
+    fill(material_response_jacobian, 1.1);
+    fill(dof_gradient, 1.2);
+
+    std::array<floatType, nphases * nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+    std::array<floatType, nphases * nphases * dim>      dRdU, dRdW;
+    std::array<floatType, nphases * num_additional_dof> dRdZ;
+    std::array<floatType, nphases * dim>                dRdUMesh;
+
+    auto energy_jacobian = [&](const unsigned int n, tardigradeBalanceEquations::threadPool::ThreadPool *phase_pool) {
+        density[0] = 0.5 + 1e-9 * n;
+
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 9, 10, 13, 16,
+                                                                            material_response_num_dof>(
+            std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+            std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+            std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+            std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(velocity),
+            std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), std::cbegin(volume_fraction), std::cend(volume_fraction),
+            test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+            interpolation_function, std::cbegin(interpolation_function_gradient),
+            std::cend(interpolation_function_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient),
+            dRhoDotdRho, dEDotdE, dUDotdU, std::begin(result), std::end(result), std::begin(dRdRho), std::end(dRdRho),
+            std::begin(dRdU), std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta),
+            std::end(dRdTheta), std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF),
+            std::begin(dRdZ), std::end(dRdZ), std::begin(dRdUMesh), std::end(dRdUMesh), phase_pool);
+
+        sink = sink + dRdU[0];
+    };
+
+    // The phases are only distributed over the pool if there are at least phaseParallel::default_min_threaded_phases
+    const unsigned int num_threads =
+        (nphases >= tardigradeBalanceEquations::phaseParallel::default_min_threaded_phases) ? pool.getNumThreads() : 1;
+
+    const double jacobian_sequential =
+        timeEvaluations(num_jacobian_evaluations, [&](const unsigned int n) { energy_jacobian(n, nullptr); });
+
+    const double jacobian_threaded =
+        timeEvaluations(num_jacobian_evaluations, [&](const unsigned int n) { energy_jacobian(n, &pool); });
+
+    std::cout << std::setw(7) << nphases << std::setw(12) << mass_loop << std::setw(12) << mass_batched
+              << std::setw(12) << energy_loop << std::setw(12) << energy_batched << std::setw(14)
+              << jacobian_sequential << std::setw(14) << jacobian_threaded << std::setw(9) << num_threads << "\n";
+}
+
+/*!
+ * Run the benchmarks for each number of phases in a sequence
+ *
+ * \param &num_evaluations: The number of residual evaluations
+ * \param &num_jacobian_evaluations: The number of Jacobian evaluations
+ * \param &pool: The thread pool the phases of the Jacobian are distributed over
+ */
+template <unsigned int... nphases>
+void benchmarkPhaseSequence(const unsigned int num_evaluations, const unsigned int num_jacobian_evaluations,
+                            tardigradeBalanceEquations::threadPool::ThreadPool &pool,
+                            std::integer_sequence<unsigned int, nphases...>) {
+    (benchmarkPhases<nphases + 1>(num_evaluations, num_jacobian_evaluations, pool), ...);
+}
+
+int main(int argc, char **argv) {
+    const unsigned int num_evaluations = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+    const unsigned int num_jacobian_evaluations = (argc > 2) ? std::atoi(argv[2]) : 2000;
+
+    std::cout << "residual evaluations: " << num_evaluations << "\n";
+    std::cout << "jacobian evaluations: " << num_jacobian_evaluations << "\n";
+    std::cout << "times are in ns per material point\n\n";
+    std::cout << std::setw(7) << "nphases" << std::setw(12) << "mass loop" << std::setw(12) << "mass batch"
+              << std::setw(12) << "energy loop" << std::setw(12) << "energy batch" << std::setw(14) << "energy jac"
+              << std::setw(14) << "energy jac mt" << std::setw(9) << "threads"
+              << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    tardigradeBalanceEquations::threadPool::ThreadPool pool;
+
+    benchmarkPhaseSequence(num_evaluations, num_jacobian_evaluations, pool,
+                           std::make_integer_sequence<unsigned int, 8>());
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Compare the JSON results of bench_tardigrade_balance_equations against a baseline
+
+A case is identified by its kernel, element, path, and number of phases. A case regresses when its time per point
+exceeds the time of the baseline by more than the relative threshold and by more than the absolute floor which keeps
+the timer noise of the cheapest kernels from being flagged. A change in the counted floating point operations of a
+case is always flagged since the counts do not depend on the machine and only change with the code.
+
+The timings of the committed baseline were measured on one machine so a baseline should be regenerated with --json on
+the machine the comparison is run on before the code is changed e.g.,
+
+    bench_tardigrade_balance_equations --json baseline.json
+    # change and rebuild
+    bench_tardigrade_balance_equations --json current.json
+    compare_benchmarks.py baseline.json current.json --threshold 0.1
+
+The timings of shared or frequency-scaled machines vary by tens of percent between runs so the threshold should be
+chosen above the variation of two runs of the unchanged code. The exit code is one if any case regresses and zero
+otherwise.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_cases(filename):
+    """Load the cases of a JSON results file
+
+    :param str filename: The name of the file
+
+    :returns: The context and a dictionary from the case keys to the cases
+    """
+    with open(filename, "r") as results_file:
+        results = json.load(results_file)
+
+    cases = {}
+    for case in results["benchmarks"]:
+        cases[(case["kernel"], case["element"], case["path"], case["nphases"])] = case
+
+    return results.get("context", {}), cases
+
+
+def format_key(key):
+    """Format the key of a case for printing
+
+    :param tuple key: The kernel, element, path, and number of phases
+
+    :returns: The formatted key
+    """
+    kernel, element, path, nphases = key
+    return f"{kernel} [{element}, {path}, nphases={nphases if nphases > 0 else '-'}]"
+
+
+def compare(baseline_cases, current_cases, threshold, floor):
+    """Compare the cases of two results files
+
+    :param dict baseline_cases: The cases of the baseline
+    :param dict current_cases: The current cases
+    :param float threshold: The relative slowdown above which a case regresses
+    :param float floor: The absolute slowdown in ns per point below which a case never regresses
+
+    :returns: The list of regression messages and the rows of the comparison table
+    """
+    regressions = []
+    rows = []
+
+    for key, baseline in baseline_cases.items():
+        if key not in current_cases:
+            regressions.append(f"{format_key(key)}: missing from the current results")
+            continue
+
+        current = current_cases[key]
+
+        ratio = current["ns_per_point"] / baseline["ns_per_point"]
+        slowdown = current["ns_per_point"] - baseline["ns_per_point"]
+
+        status = ""
+        if (ratio > 1 + threshold) and (slowdown > floor):
+            status = "SLOWER"
+            regressions.append(
+                f"{format_key(key)}: {baseline['ns_per_point']:.1f} -> {current['ns_per_point']:.1f} ns/point "
+                f"({100 * (ratio - 1):+.1f}%)"
+            )
+        elif ratio < 1 - threshold:
+            status = "faster"
+
+        if baseline.get("flops_per_point") != current.get("flops_per_point"):
+            status = (status + " FLOPS").strip()
+            regressions.append(
+                f"{format_key(key)}: {baseline.get('flops_per_point')} -> {current.get('flops_per_point')} flop/point"
+            )
+
+        rows.append((format_key(key), baseline["ns_per_point"], current["ns_per_point"], ratio, status))
+
+    for key in current_cases:
+        if key not in baseline_cases:
+            rows.append((format_key(key), None, current_cases[key]["ns_per_point"], None, "new"))
+
+    return regressions, rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="The JSON results of the baseline")
+    parser.add_argument("current", help="The current JSON results")
+    parser.add_argument(
+        "--threshold", type=float, default=0.1, help="The relative slowdown above which a case regresses (default 0.1)"
+    )
+    parser.add_argument(
+        "--floor",
+        type=float,
+        default=2.0,
+        help="The slowdown in ns per point below which a case never regresses (default 2.0)",
+    )
+    parser.add_argument("--quiet", action="store_true", help="Only print the regressions")
+    args = parser.parse_args()
+
+    baseline_context, baseline_cases = load_cases(args.baseline)
+    current_context, current_cases = load_cases(args.current)
+
+    for name in ("compiler", "num_evaluations", "num_jacobian_evaluations"):
+        if baseline_context.get(name) != current_context.get(name):
+            print(
+                f"warning: the {name} of the baseline ({baseline_context.get(name)}) and the current results "
+                f"({current_context.get(name)}) differ"
+            )
+
+    regressions, rows = compare(baseline_cases, current_cases, args.threshold, args.floor)
+
+    if not args.quiet:
+        print(f"{'case':<80}{'baseline':>12}{'current':>12}{'ratio':>8}  status")
+        for name, baseline, current, ratio, status in rows:
+            baseline = f"{baseline:.1f}" if baseline is not None else "-"
+            ratio = f"{ratio:.2f}" if ratio is not None else "-"
+            print(f"{name:<80}{baseline:>12}{current:>12.1f}{ratio:>8}  {status}")
+        print()
+
+    if regressions:
+        print(f"{len(regressions)} regression(s) beyond a threshold of {100 * args.threshold:.0f}%:")
+        for regression in regressions:
+            print(f"  {regression}")
+        return 1
+
+    print(f"no regressions beyond a threshold of {100 * args.threshold:.0f}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Place the kernels of the JSON results of bench_tardigrade_balance_equations on a roofline
+
+Each case of the results carries the floating point operations and the bytes read and written per point of the
+analytic cost model of tardigrade_cost_model.h. The arithmetic intensity of a case is the ratio of the model operations
+to the model bytes and its attainable performance is the smaller of the peak floating point rate and the product of the
+intensity with the memory bandwidth. A case whose intensity is below the ridge point i.e., the ratio of the peak rate to
+the bandwidth, is bound by the memory bandwidth and is otherwise bound by the floating point rate. The efficiency is the
+attained rate over the attainable rate.
+
+The bandwidth defaults to the STREAM triad bandwidth measured by the benchmark and the peak rate defaults to the highest
+rate attained by any case which is only a lower bound of the peak of the machine. The peak of the machine i.e., the
+cores times the clock times the floating point operations per cycle, should be given with --peak-gflops when it is
+known e.g.,
+
+    bench_tardigrade_balance_equations --json results.json
+    roofline_report.py results.json --peak-gflops 32 --nphases 2
+
+The model bytes are the compulsory traffic of a call assuming that nothing is reused from the cache between calls so
+the intensities are lower bounds for kernels whose inputs stay in the cache between the points of an element and an
+efficiency above one hundred percent means that the inputs were read from the cache. The model operations of the point
+kernels are checked against the counted operations and a mismatch is reported since it means that the cost model no
+longer describes the kernel.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_results(filename):
+    """Load a JSON results file
+
+    :param str filename: The name of the file
+
+    :returns: The context and the list of cases
+    """
+    with open(filename, "r") as results_file:
+        results = json.load(results_file)
+
+    return results.get("context", {}), results["benchmarks"]
+
+
+def get_model_bytes(case):
+    """Get the model bytes moved per point of a case
+
+    :param dict case: The case
+
+    :returns: The bytes read plus the bytes written
+    """
+    return case["bytes_read_per_point"] + case["bytes_written_per_point"]
+
+
+def get_attained_gflops(case):
+    """Get the attained floating point rate of a case from the model operations
+
+    :param dict case: The case
+
+    :returns: The rate in GFLOP/s i.e., the operations per ns
+    """
+    return case["model_flops_per_point"] / case["ns_per_point"]
+
+
+def place_case(case, peak_gflops, bandwidth):
+    """Place a case on the roofline
+
+    :param dict case: The case
+    :param float peak_gflops: The peak floating point rate in GFLOP/s
+    :param float bandwidth: The memory bandwidth in GB/s
+
+    :returns: The arithmetic intensity, the attained rate, the attainable rate, the bound, and the efficiency
+    """
+    intensity = case["model_flops_per_point"] / get_model_bytes(case)
+    attained = get_attained_gflops(case)
+    attainable = min(peak_gflops, intensity * bandwidth)
+    bound = "memory" if intensity * bandwidth < peak_gflops else "compute"
+
+    return intensity, attained, attainable, bound, attained / attainable
+
+
+def check_model(cases):
+    """Check the model operations of the point kernels against the counted operations
+
+    :param list cases: The cases
+
+    :returns: The list of mismatch messages
+    """
+    mismatches = []
+    for case in cases:
+        if (case["element"] != "point") or (case.get("flops_per_point") is None):
+            continue
+
+        if abs(case["flops_per_point"] - case["model_flops_per_point"]) > 1e-6 * case["flops_per_point"]:
+            mismatches.append(
+                f"{case['kernel']} [{case['path']}, nphases={case['nphases']}]: counted {case['flops_per_point']} "
+                f"model {case['model_flops_per_point']} flop/point"
+            )
+
+    return mismatches
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("results", help="The JSON results of the benchmark")
+    parser.add_argument("--peak-gflops", type=float, help="The peak floating point rate in GFLOP/s")
+    parser.add_argument("--bandwidth", type=float, help="The memory bandwidth in GB/s (default the triad bandwidth)")
+    parser.add_argument("--nphases", type=int, help="Only report the cases with this number of phases")
+    parser.add_argument("--kernel", help="Only report the cases whose kernel contains this string")
+    args = parser.parse_args()
+
+    context, cases = load_results(args.results)
+
+    cases = [case for case in cases if case.get("model_flops_per_point", 0) > 0]
+
+    if not cases:
+        print(f"error: {args.results} has no cost model counts. Rerun the benchmark to regenerate it.")
+        return 1
+
+    bandwidth = args.bandwidth if args.bandwidth is not None else context.get("triad_bandwidth_gbs")
+    if not bandwidth:
+        print("error: the results have no triad bandwidth so --bandwidth must be given")
+        return 1
+
+    peak_gflops = args.peak_gflops
+    if peak_gflops is None:
+        peak_gflops = max(get_attained_gflops(case) for case in cases)
+        print(f"warning: the peak is the highest attained rate of {peak_gflops:.2f} GFLOP/s. Give --peak-gflops.")
+
+    print(f"peak: {peak_gflops:.2f} GFLOP/s")
+    print(f"bandwidth: {bandwidth:.2f} GB/s")
+    print(f"ridge point: {peak_gflops / bandwidth:.3f} flop/byte")
+    print()
+
+    selected = [
+        case
+        for case in cases
+        if ((args.nphases is None) or (case["nphases"] in (0, args.nphases)))
+        and ((args.kernel is None) or (args.kernel in case["kernel"]))
+    ]
+
+    print(
+        f"{'kernel':<43}{'element':<14}{'path':<10}{'nphases':>8}{'flop/point':>13}{'byte/point':>13}"
+        f"{'flop/byte':>11}{'GFLOP/s':>10}{'roof':>10}{'eff':>7}  bound"
+    )
+    for case in selected:
+        intensity, attained, attainable, bound, efficiency = place_case(case, peak_gflops, bandwidth)
+        nphases = case["nphases"] if case["nphases"] > 0 else "-"
+        print(
+            f"{case['kernel']:<43}{case['element']:<14}{case['path']:<10}{nphases:>8}"
+            f"{case['model_flops_per_point']:>13.0f}{get_model_bytes(case):>13.0f}{intensity:>11.3f}"
+            f"{attained:>10.2f}{attainable:>10.2f}{100 * efficiency:>6.0f}%  {bound}"
+        )
+
+    mismatches = check_model(cases)
+    if mismatches:
+        print()
+        print(f"{len(mismatches)} point kernel(s) whose counted operations differ from the cost model:")
+        for mismatch in mismatches:
+            print(f"  {mismatch}")
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -9,7 +9,9 @@
 #ifndef TARDIGRADE_FINITEELEMENTBASE_H
 #define TARDIGRADE_FINITEELEMENTBASE_H
 
+#include "tardigrade_error_policy.h"
 #include "tardigrade_finite_element_utilities.h"
+#include "tardigrade_instrumentation.h"
 
 namespace tardigradeBalanceEquations {
 
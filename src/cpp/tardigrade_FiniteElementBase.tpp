@@ -182,13 +182,16 @@ namespace tardigradeBalanceEquations {
             const quantity_in &quantity_end, quantity_out value_begin, quantity_out value_end) {
             const size_type quantity_dim = (size_type)(value_end - value_begin);
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(quantity_dim * element_configuration::node_count ==
+            TARDIGRADE_BALANCE_EQS_CHECK(quantity_dim * element_configuration::node_count ==
                                              (size_type)(quantity_end - quantity_begin),
-                                         "The returned value size (" + std::to_string(quantity_dim) +
-                                             ") and the quantity dimension (" +
-                                             std::to_string((size_type)(quantity_end - quantity_begin)) +
-                                             ") are inconsistent with the node count (" +
-                                             std::to_string(element_configuration::node_count) + ")");
+                                         "The returned value size (", quantity_dim, ") and the quantity dimension (",
+                                         (size_type)(quantity_end - quantity_begin),
+                                         ") are inconsistent with the node count (", element_configuration::node_count,
+                                         ")");
+
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                INTERPOLATION,
+                costModel::getInterpolationCost(element_configuration::node_count, quantity_dim).flops)
 
             GetShapeFunctions(xi_begin, xi_end, std::begin(_shapefunctions), std::end(_shapefunctions));
 
@@ -222,13 +225,12 @@ namespace tardigradeBalanceEquations {
             const quantity_in &quantity_end, quantity_gradient_out value_begin, quantity_gradient_out value_end) {
             const size_type quantity_dim = (size_type)(value_end - value_begin) / element_configuration::local_dim;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(quantity_dim * element_configuration::node_count ==
+            TARDIGRADE_BALANCE_EQS_CHECK(quantity_dim * element_configuration::node_count ==
                                              (size_type)(quantity_end - quantity_begin),
-                                         "The returned value size (" + std::to_string(quantity_dim) +
-                                             ") and the quantity dimension (" +
-                                             std::to_string((size_type)(quantity_end - quantity_begin)) +
-                                             ") are inconsistent with the node count (" +
-                                             std::to_string(element_configuration::node_count) + ")");
+                                         "The returned value size (", quantity_dim, ") and the quantity dimension (",
+                                         (size_type)(quantity_end - quantity_begin),
+                                         ") are inconsistent with the node count (", element_configuration::node_count,
+                                         ")");
 
             TARDIGRADE_ERROR_TOOLS_CATCH(GetLocalShapeFunctionGradients(xi_begin, xi_end,
                                                                         std::begin(_local_gradshapefunctions),
@@ -269,13 +271,18 @@ namespace tardigradeBalanceEquations {
             const bool configuration) {
             const size_type quantity_dim = (size_type)(value_end - value_begin) / element_configuration::dim;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(quantity_dim * element_configuration::node_count ==
+            TARDIGRADE_BALANCE_EQS_CHECK(quantity_dim * element_configuration::node_count ==
                                              (size_type)(quantity_end - quantity_begin),
-                                         "The returned value size (" + std::to_string(quantity_dim) +
-                                             ") and the quantity dimension (" +
-                                             std::to_string((size_type)(quantity_end - quantity_begin)) +
-                                             ") are inconsistent with the node count (" +
-                                             std::to_string(element_configuration::node_count) + ")");
+                                         "The returned value size (", quantity_dim, ") and the quantity dimension (",
+                                         (size_type)(quantity_end - quantity_begin),
+                                         ") are inconsistent with the node count (", element_configuration::node_count,
+                                         ")");
+
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                INTERPOLATION,
+                costModel::getQuantityGradientCost(element_configuration::node_count, quantity_dim,
+                                                   element_configuration::dim)
+                    .flops)
 
             if (configuration) {
                 TARDIGRADE_ERROR_TOOLS_CATCH(GetGlobalShapeFunctionGradients(xi_begin, xi_end, x_begin, x_end,
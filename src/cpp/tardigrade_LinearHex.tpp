@@ -40,7 +40,7 @@ namespace tardigradeBalanceEquations {
             const typename element_configuration::local_point_in &xi_end,
             typename element_configuration::shape_functions_out   N_begin,
             typename element_configuration::shape_functions_out   N_end) {
-            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(N_end - N_begin) == 8,
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(N_end - N_begin) == 8,
                                          "The dimension of the shape-function iterator is " +
                                              std::to_string((size_type)(N_end - N_begin)));
 
@@ -68,7 +68,7 @@ namespace tardigradeBalanceEquations {
             const typename element_configuration::local_point_in    &xi_end,
             typename element_configuration::grad_shape_functions_out dNdxi_begin,
             typename element_configuration::grad_shape_functions_out dNdxi_end) {
-            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dNdxi_end - dNdxi_begin) == 24,
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(dNdxi_end - dNdxi_begin) == 24,
                                          "The dimension of the shape-function iterator is " +
                                              std::to_string((size_type)(dNdxi_end - dNdxi_begin)));
 
@@ -103,7 +103,12 @@ namespace tardigradeBalanceEquations {
             const typename element_configuration::node_in           &node_positions_end,
             typename element_configuration::grad_shape_functions_out value_begin,
             typename element_configuration::grad_shape_functions_out value_end) {
-            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(value_end - value_begin) == 24,
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                ELEMENT_GEOMETRY,
+                costModel::getShapeFunctionGradientCost(element_configuration::node_count, element_configuration::dim)
+                    .flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(value_end - value_begin) == 24,
                                          "The shape function global gradient must have a size of 24");
 
             std::array<typename std::iterator_traits<typename element_configuration::node_in>::value_type, 9> dxdxi;
@@ -153,6 +158,12 @@ namespace tardigradeBalanceEquations {
             const typename element_configuration::local_point_in                               &xi_end,
             typename std::iterator_traits<typename element_configuration::node_in>::value_type &value,
             const bool                                                                          configuration) {
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                ELEMENT_GEOMETRY,
+                costModel::getJacobianOfTransformationCost(element_configuration::node_count,
+                                                           element_configuration::dim)
+                    .flops)
+
             std::array<typename std::iterator_traits<typename element_configuration::node_in>::value_type, 9> dxdxi;
 
             if (configuration) {
@@ -254,7 +265,7 @@ namespace tardigradeBalanceEquations {
             const unsigned int i, typename element_configuration::local_point_out xi_begin,
             typename element_configuration::local_point_out                             xi_end,
             typename element_configuration::volume_integration_point_weight_value_type &weight) {
-            TARDIGRADE_ERROR_TOOLS_CHECK(i < 8, "The integration point id " + std::to_string(i) +
+            TARDIGRADE_BALANCE_EQS_CHECK(i < 8, "The integration point id " + std::to_string(i) +
                                                     " must be less than the number of integration points " +
                                                     std::to_string(8));
 
@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_automatic_differentiation.cpp
+ ******************************************************************************
+ * The source file for a forward-mode automatic differentiation number
+ ******************************************************************************
+ */
+
+#include "tardigrade_automatic_differentiation.h"
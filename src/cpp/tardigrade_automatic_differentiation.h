@@ -0,0 +1,187 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_automatic_differentiation.h
+ ******************************************************************************
+ * The header file for a forward-mode automatic differentiation number. The
+ * number carries its value and a fixed number of derivative lanes which are
+ * stored contiguously so that the lane loops are vectorized by the compiler.
+ * The balance equations are templated on their value types so the dual
+ * number can be passed through the residual overloads to compute Jacobians.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_AUTOMATIC_DIFFERENTIATION_H
+#define TARDIGRADE_AUTOMATIC_DIFFERENTIATION_H
+
+#include <array>
+#include <ostream>
+
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace automaticDifferentiation {
+
+        /*!
+         * A forward-mode dual number with a fixed number of derivative lanes
+         *
+         * \f$ a = a_0 + \sum_{l=0}^{N-1} a_l \epsilon_l \f$ with \f$ \epsilon_k \epsilon_l = 0 \f$
+         */
+        template <typename T, int N>
+        class Dual {
+           public:
+            //! The type of the value and the derivatives
+            using value_type = T;
+
+            //! The number of derivative lanes
+            static constexpr int num_lanes = N;
+
+            //! The value of the number
+            T value;
+
+            //! The derivatives of the number w.r.t. each of the lanes
+            alignas(4 * sizeof(T)) std::array<T, N> derivatives;
+
+            /*!
+             * Default constructor. The value and derivatives are zero.
+             */
+            Dual() : value(), derivatives() { derivatives.fill(T()); }
+
+            /*!
+             * Construct a constant i.e., a number with zero derivatives
+             *
+             * \param &v: The value of the number
+             */
+            Dual(const T &v) : value(v), derivatives() { derivatives.fill(T()); }
+
+            /*!
+             * Construct an independent variable
+             *
+             * \param &v: The value of the number
+             * \param &lane: The lane which is seeded
+             * \param &seed: The derivative of the number w.r.t. the lane
+             */
+            Dual(const T &v, const int lane, const T &seed = T(1)) : value(v), derivatives() {
+                derivatives.fill(T());
+                derivatives[lane] = seed;
+            }
+
+            Dual &operator+=(const Dual &rhs);
+
+            Dual &operator-=(const Dual &rhs);
+
+            Dual &operator*=(const Dual &rhs);
+
+            Dual &operator/=(const Dual &rhs);
+
+            Dual &operator+=(const T &rhs);
+
+            Dual &operator-=(const T &rhs);
+
+            Dual &operator*=(const T &rhs);
+
+            Dual &operator/=(const T &rhs);
+        };
+
+        template <typename T, int N>
+        Dual<T, N> operator+(const Dual<T, N> &a);
+
+        template <typename T, int N>
+        Dual<T, N> operator-(const Dual<T, N> &a);
+
+        template <typename T, int N>
+        Dual<T, N> operator+(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator+(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator+(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator-(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator-(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator-(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator*(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator*(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator*(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator/(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator/(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        Dual<T, N> operator/(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        bool operator==(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        bool operator!=(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        bool operator<(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        bool operator<(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        bool operator<(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        bool operator>(const Dual<T, N> &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        bool operator>(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        bool operator>(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b);
+
+        template <typename T, int N>
+        Dual<T, N> chainRule(const Dual<T, N> &a, const T &f, const T &dfda);
+
+        template <typename T, int N>
+        Dual<T, N> sqrt(const Dual<T, N> &a);
+
+        template <typename T, int N>
+        Dual<T, N> exp(const Dual<T, N> &a);
+
+        template <typename T, int N>
+        Dual<T, N> log(const Dual<T, N> &a);
+
+        template <typename T, int N>
+        Dual<T, N> pow(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b);
+
+        template <typename T, int N>
+        Dual<T, N> abs(const Dual<T, N> &a);
+
+        template <typename T, int N>
+        std::ostream &operator<<(std::ostream &os, const Dual<T, N> &a);
+
+        template <typename T, int N, class value_iter, class output_iter>
+        void seedLanes(const value_iter &value_begin, const value_iter &value_end, const int first_lane,
+                       output_iter output_begin, output_iter output_end);
+
+        template <typename T, int N, class dual_iter, class value_iter, class derivative_iter>
+        void extractLanes(const dual_iter &dual_begin, const dual_iter &dual_end, value_iter value_begin,
+                          value_iter value_end, derivative_iter derivative_begin, derivative_iter derivative_end);
+
+    }  // namespace automaticDifferentiation
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_automatic_differentiation.tpp"
+
+#endif
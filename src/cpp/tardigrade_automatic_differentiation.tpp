@@ -0,0 +1,527 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_automatic_differentiation.tpp
+ ******************************************************************************
+ * The template file for a forward-mode automatic differentiation number
+ ******************************************************************************
+ */
+
+#include <cmath>
+
+#include "tardigrade_automatic_differentiation.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace automaticDifferentiation {
+
+        /*!
+         * Add a dual number in place
+         *
+         * \param &rhs: The number to add
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator+=(const Dual<T, N> &rhs) {
+            value += rhs.value;
+            for (int l = 0; l < N; ++l) {
+                derivatives[l] += rhs.derivatives[l];
+            }
+            return *this;
+        }
+
+        /*!
+         * Subtract a dual number in place
+         *
+         * \param &rhs: The number to subtract
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator-=(const Dual<T, N> &rhs) {
+            value -= rhs.value;
+            for (int l = 0; l < N; ++l) {
+                derivatives[l] -= rhs.derivatives[l];
+            }
+            return *this;
+        }
+
+        /*!
+         * Multiply by a dual number in place
+         *
+         * \param &rhs: The number to multiply by
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator*=(const Dual<T, N> &rhs) {
+            for (int l = 0; l < N; ++l) {
+                derivatives[l] = derivatives[l] * rhs.value + value * rhs.derivatives[l];
+            }
+            value *= rhs.value;
+            return *this;
+        }
+
+        /*!
+         * Divide by a dual number in place
+         *
+         * \param &rhs: The number to divide by
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator/=(const Dual<T, N> &rhs) {
+            const T inverse = T(1) / rhs.value;
+            value *= inverse;
+            for (int l = 0; l < N; ++l) {
+                derivatives[l] = (derivatives[l] - value * rhs.derivatives[l]) * inverse;
+            }
+            return *this;
+        }
+
+        /*!
+         * Add a constant in place
+         *
+         * \param &rhs: The constant to add
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator+=(const T &rhs) {
+            value += rhs;
+            return *this;
+        }
+
+        /*!
+         * Subtract a constant in place
+         *
+         * \param &rhs: The constant to subtract
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator-=(const T &rhs) {
+            value -= rhs;
+            return *this;
+        }
+
+        /*!
+         * Multiply by a constant in place
+         *
+         * \param &rhs: The constant to multiply by
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator*=(const T &rhs) {
+            value *= rhs;
+            for (int l = 0; l < N; ++l) {
+                derivatives[l] *= rhs;
+            }
+            return *this;
+        }
+
+        /*!
+         * Divide by a constant in place
+         *
+         * \param &rhs: The constant to divide by
+         */
+        template <typename T, int N>
+        Dual<T, N> &Dual<T, N>::operator/=(const T &rhs) {
+            const T inverse = T(1) / rhs;
+            return (*this) *= inverse;
+        }
+
+        /*!
+         * Unary plus
+         *
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        Dual<T, N> operator+(const Dual<T, N> &a) {
+            return a;
+        }
+
+        /*!
+         * Unary minus
+         *
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        Dual<T, N> operator-(const Dual<T, N> &a) {
+            Dual<T, N> c(a);
+            c *= T(-1);
+            return c;
+        }
+
+        /*!
+         * Add two dual numbers
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator+(const Dual<T, N> &a, const Dual<T, N> &b) {
+            Dual<T, N> c(a);
+            c += b;
+            return c;
+        }
+
+        /*!
+         * Add a constant to a dual number
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator+(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            Dual<T, N> c(a);
+            c += b;
+            return c;
+        }
+
+        /*!
+         * Add a dual number to a constant
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator+(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b) {
+            Dual<T, N> c(b);
+            c += a;
+            return c;
+        }
+
+        /*!
+         * Subtract two dual numbers
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator-(const Dual<T, N> &a, const Dual<T, N> &b) {
+            Dual<T, N> c(a);
+            c -= b;
+            return c;
+        }
+
+        /*!
+         * Subtract a constant from a dual number
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator-(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            Dual<T, N> c(a);
+            c -= b;
+            return c;
+        }
+
+        /*!
+         * Subtract a dual number from a constant
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator-(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b) {
+            Dual<T, N> c = -b;
+            c += a;
+            return c;
+        }
+
+        /*!
+         * Multiply two dual numbers
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator*(const Dual<T, N> &a, const Dual<T, N> &b) {
+            Dual<T, N> c(a);
+            c *= b;
+            return c;
+        }
+
+        /*!
+         * Multiply a dual number by a constant
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator*(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            Dual<T, N> c(a);
+            c *= b;
+            return c;
+        }
+
+        /*!
+         * Multiply a constant by a dual number
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator*(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b) {
+            Dual<T, N> c(b);
+            c *= a;
+            return c;
+        }
+
+        /*!
+         * Divide two dual numbers
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator/(const Dual<T, N> &a, const Dual<T, N> &b) {
+            Dual<T, N> c(a);
+            c /= b;
+            return c;
+        }
+
+        /*!
+         * Divide a dual number by a constant
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator/(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            Dual<T, N> c(a);
+            c /= b;
+            return c;
+        }
+
+        /*!
+         * Divide a constant by a dual number
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        Dual<T, N> operator/(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b) {
+            Dual<T, N> c(a);
+            c /= b;
+            return c;
+        }
+
+        /*!
+         * Compare two dual numbers. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator==(const Dual<T, N> &a, const Dual<T, N> &b) {
+            return a.value == b.value;
+        }
+
+        /*!
+         * Compare two dual numbers. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator!=(const Dual<T, N> &a, const Dual<T, N> &b) {
+            return a.value != b.value;
+        }
+
+        /*!
+         * Compare two dual numbers. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator<(const Dual<T, N> &a, const Dual<T, N> &b) {
+            return a.value < b.value;
+        }
+
+        /*!
+         * Compare a dual number and a constant. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator<(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            return a.value < b;
+        }
+
+        /*!
+         * Compare a constant and a dual number. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator<(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b) {
+            return a < b.value;
+        }
+
+        /*!
+         * Compare two dual numbers. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator>(const Dual<T, N> &a, const Dual<T, N> &b) {
+            return a.value > b.value;
+        }
+
+        /*!
+         * Compare a dual number and a constant. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator>(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            return a.value > b;
+        }
+
+        /*!
+         * Compare a constant and a dual number. Only the values are compared.
+         *
+         * \param &a: The left hand side
+         * \param &b: The right hand side
+         */
+        template <typename T, int N>
+        bool operator>(const typename Dual<T, N>::value_type &a, const Dual<T, N> &b) {
+            return a > b.value;
+        }
+
+        /*!
+         * Apply a scalar function with a known derivative to a dual number
+         *
+         * \param &a: The dual number
+         * \param &f: The value of the function at the value of a
+         * \param &dfda: The derivative of the function at the value of a
+         */
+        template <typename T, int N>
+        Dual<T, N> chainRule(const Dual<T, N> &a, const T &f, const T &dfda) {
+            Dual<T, N> c(f);
+            for (int l = 0; l < N; ++l) {
+                c.derivatives[l] = dfda * a.derivatives[l];
+            }
+            return c;
+        }
+
+        /*!
+         * The square root of a dual number
+         *
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        Dual<T, N> sqrt(const Dual<T, N> &a) {
+            const T f = std::sqrt(a.value);
+            return chainRule(a, f, T(0.5) / f);
+        }
+
+        /*!
+         * The exponential of a dual number
+         *
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        Dual<T, N> exp(const Dual<T, N> &a) {
+            const T f = std::exp(a.value);
+            return chainRule(a, f, f);
+        }
+
+        /*!
+         * The natural logarithm of a dual number
+         *
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        Dual<T, N> log(const Dual<T, N> &a) {
+            return chainRule(a, T(std::log(a.value)), T(1) / a.value);
+        }
+
+        /*!
+         * A dual number raised to a constant power
+         *
+         * \param &a: The dual number
+         * \param &b: The exponent
+         */
+        template <typename T, int N>
+        Dual<T, N> pow(const Dual<T, N> &a, const typename Dual<T, N>::value_type &b) {
+            return chainRule(a, T(std::pow(a.value, b)), T(b * std::pow(a.value, b - 1)));
+        }
+
+        /*!
+         * The absolute value of a dual number
+         *
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        Dual<T, N> abs(const Dual<T, N> &a) {
+            return (a.value < T()) ? -a : a;
+        }
+
+        /*!
+         * Write a dual number to a stream
+         *
+         * \param &os: The output stream
+         * \param &a: The dual number
+         */
+        template <typename T, int N>
+        std::ostream &operator<<(std::ostream &os, const Dual<T, N> &a) {
+            os << a.value << " [";
+            for (int l = 0; l < N; ++l) {
+                os << " " << a.derivatives[l];
+            }
+            os << " ]";
+            return os;
+        }
+
+        /*!
+         * Seed a range of dual numbers as independent variables on consecutive lanes
+         *
+         * \param &value_begin: The starting iterator of the values
+         * \param &value_end: The stopping iterator of the values
+         * \param &first_lane: The lane of the first value
+         * \param &output_begin: The starting iterator of the dual numbers
+         * \param &output_end: The stopping iterator of the dual numbers
+         */
+        template <typename T, int N, class value_iter, class output_iter>
+        void seedLanes(const value_iter &value_begin, const value_iter &value_end, const int first_lane,
+                       output_iter output_begin, output_iter output_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK((value_end - value_begin) == (output_end - output_begin),
+                                         "The values and the output must have the same size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(first_lane + (int)(value_end - value_begin) <= N,
+                                         "The seeded lanes exceed the number of lanes")
+
+            for (auto v = std::pair<int, output_iter>(0, output_begin); v.second != output_end;
+                 ++v.first, ++v.second) {
+                *v.second = Dual<T, N>(*(value_begin + v.first), first_lane + v.first);
+            }
+        }
+
+        /*!
+         * Extract the values and the derivative lanes from a range of dual numbers. The derivatives are stored
+         * row-major i.e., the derivatives of the first dual number are stored first.
+         *
+         * \param &dual_begin: The starting iterator of the dual numbers
+         * \param &dual_end: The stopping iterator of the dual numbers
+         * \param &value_begin: The starting iterator of the values
+         * \param &value_end: The stopping iterator of the values
+         * \param &derivative_begin: The starting iterator of the derivatives
+         * \param &derivative_end: The stopping iterator of the derivatives
+         */
+        template <typename T, int N, class dual_iter, class value_iter, class derivative_iter>
+        void extractLanes(const dual_iter &dual_begin, const dual_iter &dual_end, value_iter value_begin,
+                          value_iter value_end, derivative_iter derivative_begin, derivative_iter derivative_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK((dual_end - dual_begin) == (value_end - value_begin),
+                                         "The dual numbers and the values must have the same size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(N * (dual_end - dual_begin) == (derivative_end - derivative_begin),
+                                         "The derivatives must have a size of the number of lanes times the number of "
+                                         "dual numbers")
+
+            for (auto v = std::pair<unsigned int, dual_iter>(0, dual_begin); v.second != dual_end;
+                 ++v.first, ++v.second) {
+                *(value_begin + v.first) = v.second->value;
+                std::copy(std::begin(v.second->derivatives), std::end(v.second->derivatives),
+                          derivative_begin + N * v.first);
+            }
+        }
+
+    }  // namespace automaticDifferentiation
+
+}  // namespace tardigradeBalanceEquations
@@ -11,12 +11,34 @@
 
 #include <array>
 
+#include "tardigrade_error_policy.h"
 #include "tardigrade_error_tools.h"
+#include "tardigrade_finite_element_utilities.h"
+#include "tardigrade_instrumentation.h"
+#include "tardigrade_jacobian_sparsity.h"
 
 namespace tardigradeBalanceEquations {
 
+    namespace threadPool {
+
+        class ThreadPool;  //!< The thread pool the phases of the multiphase overloads may be distributed over
+
+    }  // namespace threadPool
+
     namespace balanceOfEnergy {
 
+        /*!
+         * The structural sparsity of the Jacobian of the balance of energy of a phase. The residual depends directly
+         * on the density, spatial degree of freedom, internal energy, and volume fraction of its own phase and on
+         * everything the material response depends on.
+         */
+        template <class material_response_pattern>
+        using BalanceOfEnergySparsity = jacobianSparsity::PatternUnion<
+            jacobianSparsity::SparsityPattern<jacobianSparsity::DENSITY | jacobianSparsity::VELOCITY |
+                                                  jacobianSparsity::INTERNAL_ENERGY | jacobianSparsity::VOLUME_FRACTION,
+                                              0>,
+            material_response_pattern>;
+
         template <int dim, bool is_per_unit_volume, typename density_type, typename density_dot_type,
                   class density_gradient_iter, typename internal_energy_type, typename internal_energy_dot_type,
                   class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
@@ -101,6 +123,34 @@ namespace tardigradeBalanceEquations {
             const test_function_gradient_iter &test_function_gradient_end, result_iter result_begin,
             result_iter result_end);
 
+        template <int dim, bool is_per_unit_volume, int nphases, class density_iter, class density_dot_iter,
+                  class density_gradient_iter, class internal_energy_iter, class internal_energy_dot_iter,
+                  class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
+                  class cauchy_stress_iter, class volume_fraction_iter, class internal_heat_generation_iter,
+                  class net_interphase_force_iter, class heat_flux_iter, typename test_function_type,
+                  class test_function_gradient_iter, class result_iter>
+        void computeBalanceOfEnergyPhaseBatched(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const cauchy_stress_iter &cauchy_stress_begin,
+            const cauchy_stress_iter &cauchy_stress_end, const volume_fraction_iter &volume_fraction_begin,
+            const volume_fraction_iter          &volume_fraction_end,
+            const internal_heat_generation_iter &internal_heat_generation_begin,
+            const internal_heat_generation_iter &internal_heat_generation_end,
+            const net_interphase_force_iter     &net_interphase_force_begin,
+            const net_interphase_force_iter &net_interphase_force_end, const heat_flux_iter &heat_flux_begin,
+            const heat_flux_iter &heat_flux_end, const test_function_type &test_function,
+            const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter &test_function_gradient_end, result_iter result_begin,
+            result_iter result_end);
+
         template <int dim, bool is_per_unit_volume, class density_iter, class density_dot_iter,
                   class density_gradient_iter, class internal_energy_iter, class internal_energy_dot_iter,
                   class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
@@ -168,7 +218,7 @@ namespace tardigradeBalanceEquations {
                   class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
                   class material_response_iter, class volume_fraction_iter, typename test_function_type,
                   class test_function_gradient_iter, class result_iter>
-        inline void computeBalanceOfEnergy(
+        void computeBalanceOfEnergy(
             const density_iter &density_begin, const density_iter &density_end,
             const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
             const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
@@ -239,7 +289,7 @@ namespace tardigradeBalanceEquations {
                   class dRdUMesh_iter, int density_index = 0, int displacement_index = 1, int velocity_index = 4,
                   int temperature_index = 7, int internal_energy_index = 8, int volume_fraction_index = 9,
                   int additional_dof_index = 10>
-        inline void computeBalanceOfEnergy(
+        void computeBalanceOfEnergy(
             const density_iter &density_begin, const density_iter &density_end,
             const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
             const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
@@ -268,6 +318,131 @@ namespace tardigradeBalanceEquations {
             dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
             dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end);
 
+        // Defined in tardigrade_phase_parallel.h which provides the thread pool
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class internal_energy_iter,
+                  class internal_energy_dot_iter, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename test_function_type, class test_function_gradient_iter,
+                  typename interpolation_function_type, class interpolation_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, typename dRhoDotdRho_type, typename dEDotdE_type,
+                  typename dUDotdU_type, class result_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
+                  class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter,
+                  class dRdUMesh_iter, int density_index = 0, int displacement_index = 1, int velocity_index = 4,
+                  int temperature_index = 7, int internal_energy_index = 8, int volume_fraction_index = 9,
+                  int additional_dof_index = 10>
+        void computeBalanceOfEnergy(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const test_function_type &test_function, const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter              &test_function_gradient_end,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            result_iter result_begin, result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end,
+            dRdU_iter dRdU_begin, dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end,
+            dRdTheta_iter dRdTheta_begin, dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
+            dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
+            dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
+            threadPool::ThreadPool *pool);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class internal_energy_iter,
+                  class internal_energy_dot_iter, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename test_function_type, class test_function_gradient_iter,
+                  typename interpolation_function_type, class interpolation_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, typename dRhoDotdRho_type, typename dEDotdE_type,
+                  typename dUDotdU_type, class result_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
+                  class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter,
+                  class dRdUMesh_iter, int density_index = 0, int displacement_index = 1, int velocity_index = 4,
+                  int temperature_index = 7, int internal_energy_index = 8, int volume_fraction_index = 9,
+                  int additional_dof_index = 10, class phase_loop_type>
+        void computeBalanceOfEnergyPhaseLoop(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const test_function_type &test_function, const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter              &test_function_gradient_end,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            result_iter result_begin, result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end,
+            dRdU_iter dRdU_begin, dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end,
+            dRdTheta_iter dRdTheta_begin, dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
+            dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
+            dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
+            phase_loop_type phase_loop);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class material_response_pattern,
+                  typename density_type, typename density_dot_type, class density_gradient_iter,
+                  typename internal_energy_type, typename internal_energy_dot_type,
+                  class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
+                  class material_response_iter, class material_response_jacobian_iter, typename volume_fraction_type,
+                  typename test_function_type, class test_function_gradient_iter, typename interpolation_function_type,
+                  class interpolation_function_gradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dRhoDotdRho_type, typename dEDotdE_type, typename dUDotdU_type, typename result_type,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index = 0, int displacement_index = 1,
+                  int velocity_index = 4, int temperature_index = 7, int internal_energy_index = 8,
+                  int volume_fraction_index = 9, int additional_dof_index = 10>
+        void computeBalanceOfEnergyCompressed(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_type &internal_energy, const internal_energy_dot_type &internal_energy_dot,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const test_function_type &test_function,
+            const test_function_gradient_iter              &test_function_gradient_begin,
+            const test_function_gradient_iter              &test_function_gradient_end,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            const unsigned int nphases, const unsigned int phase, result_type &result, jacobian_iter jacobian_begin,
+            jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end);
+
         template <int dim, bool is_per_unit_volume, typename density_type, typename density_dot_type,
                   class density_gradient_iter, typename internal_energy_type, typename internal_energy_dot_type,
                   class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
@@ -404,6 +579,83 @@ namespace tardigradeBalanceEquations {
                                                      dRdGradTestFunction_iter dRdGradTestFunction_end,
                                                      dRdq_iter dRdq_begin, dRdq_iter dRdq_end);
 
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, typename density_type,
+                  typename density_dot_type, class density_gradient_iter, typename internal_energy_type,
+                  typename internal_energy_dot_type, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  typename volume_fraction_type, typename test_function_type, class test_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dRhoDotdRho_type, typename dEDotdE_type, typename dUDotdU_type, typename result_type,
+                  typename jvp_type, int density_index = 0, int velocity_index = 4, int internal_energy_index = 8,
+                  int volume_fraction_index = 9>
+        void computeBalanceOfEnergyJVP(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_type &internal_energy, const internal_energy_dot_type &internal_energy_dot,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter                       &material_response_end,
+            const material_response_jacobian_iter              &material_response_jacobian_begin,
+            const material_response_jacobian_iter              &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const test_function_type &test_function,
+            const test_function_gradient_iter                  &test_function_gradient_begin,
+            const test_function_gradient_iter                  &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            const unsigned int &phase, result_type &result, jvp_type &jvp);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class internal_energy_iter,
+                  class internal_energy_dot_iter, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename test_function_type, class test_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dRhoDotdRho_type, typename dEDotdE_type, typename dUDotdU_type, class result_iter,
+                  class jvp_iter, int density_index = 0, int velocity_index = 4, int internal_energy_index = 8,
+                  int volume_fraction_index = 9>
+        void computeBalanceOfEnergyJVP(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter                       &material_response_end,
+            const material_response_jacobian_iter              &material_response_jacobian_begin,
+            const material_response_jacobian_iter              &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const test_function_type &test_function, const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter                  &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            result_iter result_begin, result_iter result_end, jvp_iter jvp_begin, jvp_iter jvp_end);
+
     }  // namespace balanceOfEnergy
 
 }  // namespace tardigradeBalanceEquations
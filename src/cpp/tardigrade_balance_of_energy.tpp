@@ -417,49 +417,49 @@ namespace tardigradeBalanceEquations {
              * energy
              */
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
+            TARDIGRADE_BALANCE_EQS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density_dot must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The internal energy and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
                                          "The internal energy dot and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
                                                                          internal_energy_gradient_begin),
                                          "The density and internal energy gradient terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
                                          "The density and Cauchy stress terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The volume fraction and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_heat_generation_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_heat_generation_end -
                                                                    internal_heat_generation_begin),
                                          "The internal heat generation and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases ==
                                              (unsigned int)(net_interphase_force_end - net_interphase_force_begin),
                                          "The net interphase force and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(heat_flux_end - heat_flux_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(heat_flux_end - heat_flux_begin),
                                          "The heat flux and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
                                          "The result and density must be the same size");
 
             for (auto rho = std::pair<unsigned int, density_iter>(0, density_begin); rho.second != density_end;
@@ -479,6 +479,208 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        template <int dim, bool is_per_unit_volume, int nphases, class density_iter, class density_dot_iter,
+                  class density_gradient_iter, class internal_energy_iter, class internal_energy_dot_iter,
+                  class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
+                  class cauchy_stress_iter, class volume_fraction_iter, class internal_heat_generation_iter,
+                  class net_interphase_force_iter, class heat_flux_iter, typename test_function_type,
+                  class test_function_gradient_iter, class result_iter>
+        void computeBalanceOfEnergyPhaseBatched(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const cauchy_stress_iter &cauchy_stress_begin,
+            const cauchy_stress_iter &cauchy_stress_end, const volume_fraction_iter &volume_fraction_begin,
+            const volume_fraction_iter          &volume_fraction_end,
+            const internal_heat_generation_iter &internal_heat_generation_begin,
+            const internal_heat_generation_iter &internal_heat_generation_end,
+            const net_interphase_force_iter     &net_interphase_force_begin,
+            const net_interphase_force_iter &net_interphase_force_end, const heat_flux_iter &heat_flux_begin,
+            const heat_flux_iter &heat_flux_end, const test_function_type &test_function,
+            const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter &test_function_gradient_end, result_iter result_begin,
+            result_iter result_end) {
+            /*!
+             * Compute the multiphase balance of energy with the number of phases known at compile time. The phases
+             * are evaluated together so that the innermost loops are over the phases and may be vectorized. The
+             * layout of the inputs and outputs is the same as the multiphase overload of computeBalanceOfEnergy.
+             *
+             * \param &density_begin: The starting iterator of the apparent density (dm / dv) of phase \f$ \alpha \f$
+             * \f$\left(\rho^{\alpha}\right)\f$
+             * \param &density_end: The stopping iterator of the apparent density (dm / dv) of phase \f$ \alpha \f$
+             * \f$\left(\rho^{\alpha}\right)\f$
+             * \param &density_dot_begin: The starting iterator of the partial temporal derivative of the apparent
+             * density (dm / dv) of phase \f$ \alpha \f$ \f$\left(\frac{\partial}{\partial t} \rho^{\alpha}\right)\f$
+             * \param &density_dot_end: The stopping iterator of the partial temporal derivative of the apparent density
+             * (dm / dv) of phase \f$ \alpha \f$ \f$\left(\frac{\partial}{\partial t} \rho^{\alpha}\right)\f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the apparent density
+             * (dm/dv) of phase \f$ \alpha \f$ \f$\left( \rho^{\alpha}_{,i} \right) \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the apparent density
+             * (dm/dv) of phase \f$ \alpha \f$ \f$\left( \rho^{\alpha}_{,i} \right) \f$
+             * \param &internal_energy_begin: The starting iterator of the internal energy of phase \f$ \alpha \f$
+             * \f$\left(e^{\alpha}\right)\f$
+             * \param &internal_energy_end: The stopping iterator of the internal energy of phase \f$ \alpha \f$
+             * \f$\left(e^{\alpha}\right)\f$
+             * \param &internal_energy_dot_begin: The starting iterator of the partial temporal derivative of the
+             * internal energy of phase \f$ \alpha \f$ \f$\left(\frac{\partial}{\partial t} e^{\alpha}\right)\f$
+             * \param &internal_energy_dot_end: The stopping iterator of the partial temporal derivative of the internal
+             * energy of phase \f$ \alpha \f$ \f$\left(\frac{\partial}{\partial t} e^{\alpha}\right)\f$
+             * \param &internal_energy_gradient_begin: The starting iterator of the spatial gradient of the internal
+             * energy of phase \f$ \alpha \f$ \f$\left( e^{\alpha}_{,i} \right) \f$
+             * \param &internal_energy_gradient_end: The stopping iterator of the spatial gradient of the internal
+             * energy of phase \f$ \alpha \f$ \f$\left( e^{\alpha}_{,i} \right) \f$
+             * \param &velocity_begin: The starting iterator of the velocity of phase \f$ \alpha \f$ \f$\left(
+             * v^{\alpha}_i \right) \f$
+             * \param &velocity_end: The stopping iterator of the velocity of phase \f$ \alpha \f$ \f$\left(
+             * v^{\alpha}_i \right) \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity of phase
+             * \f$ \alpha \f$ \f$\left( v^{\alpha}_{i,j} \right) \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity of phase \f$
+             * \alpha \f$ \f$\left( v^{\alpha}_{i,j} \right) \f$
+             * \param &cauchy_stress_begin: The starting iterator of the true Cauchy stress \f$ \bar{\bf{\sigma}} \f$
+             * where \f$ \bf{\sigma} = \phi \bar{\bf{\sigma}} \f$
+             * \param &cauchy_stress_end: The stopping iterator of the true Cauchy stress \f$ \bar{\bf{\sigma}} \f$
+             * where \f$ \bf{\sigma} = \phi \bar{\bf{\sigma}} \f$
+             * \param &volume_fraction_begin: The starting iterator of the volume fraction of phase \f$ \alpha \f$ \f$
+             * \left(\phi^{\alpha}\right) \f$
+             * \param &volume_fraction_end: The stopping iterator of the volume fraction of phase \f$ \alpha \f$ \f$
+             * \left(\phi^{\alpha}\right) \f$
+             * \param &internal_heat_generation_begin: The starting iterator of the internal heat generation per unit
+             * mass of phase \f$ \alpha \f$ \f$\left( r^{\alpha} \right)\f$
+             * \param &internal_heat_generation_end: The stopping iterator of the internal heat generation per unit mass
+             * of phase \f$ \alpha \f$ \f$\left( r^{\alpha} \right)\f$
+             * \param &net_interphase_force_begin: The starting iterator of the net interphase force acting on phase \f$
+             * \alpha \f$ \f$\left( \sum_{\beta} \pi^{\alpha \beta}_i \right) \f$
+             * \param &net_interphase_force_end: The stopping iterator of the net interphase force acting on phase \f$
+             * \alpha \f$ \f$\left( \sum_{\beta} \pi^{\alpha \beta}_i \right) \f$
+             * \param &heat_flux_begin: The starting iterator of the heat flux vector \f$ \left( q_i \right) \f$
+             * \param &heat_flux_end: The stopping iterator of the heat flux vector \f$ \left( q_i \right) \f$
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the spatial gradient of the test function
+             * \f$ \left( \psi_{,i} \right) \f$
+             * \param &test_function_gradient_end: The stopping iterator of the spatial gradient of the test function
+             * \f$ \left( \psi_{,i} \right) \f$
+             * \param &result_begin: The starting iterator of the result of the balance of energy
+             * \param &result_end: The stopping iterator of the result of the balance of energy
+             */
+
+            using result_type = typename std::iterator_traits<result_iter>::value_type;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_end - density_begin),
+                                         "The density must have a size of nphases");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+                                         "The density and density_dot must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+                                         "The density and density gradient terms are of inconsistent sizes");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+                                         "The internal energy and density must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
+                                         "The internal energy dot and density must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
+                                                                         internal_energy_gradient_begin),
+                                         "The density and internal energy gradient terms are of inconsistent sizes");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+                                         "The density and velocity terms are of inconsistent sizes");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
+                                             (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
+                                         "The density and velocity gradient terms are of inconsistent sizes");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
+                                         "The density and Cauchy stress terms are of inconsistent sizes");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+                                         "The volume fraction and density must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_heat_generation_end -
+                                                                   internal_heat_generation_begin),
+                                         "The internal heat generation and density must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases ==
+                                             (unsigned int)(net_interphase_force_end - net_interphase_force_begin),
+                                         "The net interphase force and density must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(heat_flux_end - heat_flux_begin),
+                                         "The heat flux and density must be the same size");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim ==
+                                             (unsigned int)(test_function_gradient_end - test_function_gradient_begin),
+                                         "The test function gradient must have a size of dim");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+                                         "The result and density must be the same size");
+
+            // The phase-wise contractions of the fields
+            std::array<result_type, nphases> trace_velocity_gradient{};
+            std::array<result_type, nphases> grad_rho_dot_v{};
+            std::array<result_type, nphases> v_dot_grad_e{};
+            std::array<result_type, nphases> v_dot_v{};
+            std::array<result_type, nphases> pi_dot_v{};
+            std::array<result_type, nphases> q_dot_grad_psi{};
+            std::array<result_type, nphases> stress_power{};
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                const auto grad_psi = *(test_function_gradient_begin + i);
+
+                for (unsigned int phase = 0; phase < nphases; ++phase) {
+                    const auto v = *(velocity_begin + dim * phase + i);
+
+                    trace_velocity_gradient[phase] += *(velocity_gradient_begin + dim * dim * phase + dim * i + i);
+                    grad_rho_dot_v[phase] += (*(density_gradient_begin + dim * phase + i)) * v;
+                    v_dot_grad_e[phase] += (*(internal_energy_gradient_begin + dim * phase + i)) * v;
+                    v_dot_v[phase] += v * v;
+                    pi_dot_v[phase] += (*(net_interphase_force_begin + dim * phase + i)) * v;
+                    q_dot_grad_psi[phase] += (*(heat_flux_begin + dim * phase + i)) * grad_psi;
+                }
+            }
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                for (unsigned int j = 0; j < dim; ++j) {
+                    for (unsigned int phase = 0; phase < nphases; ++phase) {
+                        stress_power[phase] += (*(cauchy_stress_begin + dim * dim * phase + dim * j + i)) *
+                                               (*(velocity_gradient_begin + dim * dim * phase + dim * i + j));
+                    }
+                }
+            }
+
+            for (unsigned int phase = 0; phase < nphases; ++phase) {
+                const auto rho     = *(density_begin + phase);
+                const auto rho_dot = *(density_dot_begin + phase);
+                const auto e       = *(internal_energy_begin + phase);
+                const auto e_dot   = *(internal_energy_dot_begin + phase);
+
+                const result_type mass_change_rate =
+                    rho_dot + grad_rho_dot_v[phase] + rho * trace_velocity_gradient[phase];
+
+                result_type result;
+
+                if (is_per_unit_volume) {
+                    result = e_dot + e * trace_velocity_gradient[phase] + v_dot_grad_e[phase];
+                } else {
+                    result = rho_dot * e + rho * e_dot + e * grad_rho_dot_v[phase] +
+                             rho * e * trace_velocity_gradient[phase] + rho * v_dot_grad_e[phase];
+                }
+
+                result += -0.5 * mass_change_rate * v_dot_v[phase] + pi_dot_v[phase] -
+                          rho * (*(internal_heat_generation_begin + phase)) -
+                          (*(volume_fraction_begin + phase)) * stress_power[phase];
+
+                *(result_begin + phase) = test_function * result - q_dot_grad_psi[phase];
+            }
+        }
+
         template <int dim, bool is_per_unit_volume, class density_iter, class density_dot_iter,
                   class density_gradient_iter, class internal_energy_iter, class internal_energy_dot_iter,
                   class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
@@ -621,76 +823,76 @@ namespace tardigradeBalanceEquations {
              * displacement
              */
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
+            TARDIGRADE_BALANCE_EQS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density_dot must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The internal energy and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
                                          "The internal energy dot and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
                                                                          internal_energy_gradient_begin),
                                          "The density and internal energy gradient terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
                                          "The density and Cauchy stress terms are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The volume fraction and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_heat_generation_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_heat_generation_end -
                                                                    internal_heat_generation_begin),
                                          "The internal heat generation and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases ==
                                              (unsigned int)(net_interphase_force_end - net_interphase_force_begin),
                                          "The net interphase force and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(heat_flux_end - heat_flux_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(heat_flux_end - heat_flux_begin),
                                          "The heat flux and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
                                          "The result and density must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The result and dRdRho must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The result and dRdE must be the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
                                          "The result and dRdU are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * nphases == (unsigned int)(dRdCauchy_end - dRdCauchy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * nphases == (unsigned int)(dRdCauchy_end - dRdCauchy_begin),
                                          "The result and dRdCauchy are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "The result and dRdVolumeFraction are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdr_end - dRdr_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdr_end - dRdr_begin),
                                          "The result and dRdr are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(3 * nphases == (unsigned int)(dRdpi_end - dRdpi_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(3 * nphases == (unsigned int)(dRdpi_end - dRdpi_begin),
                                          "The result and dRdpi are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(3 * nphases == (unsigned int)(dRdq_end - dRdq_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(3 * nphases == (unsigned int)(dRdq_end - dRdq_begin),
                                          "The result and dRdq are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(3 * nphases == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(3 * nphases == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The result and dRdUMesh are of inconsistent sizes");
 
             for (auto rho = std::pair<unsigned int, density_iter>(0, density_begin); rho.second != density_end;
@@ -772,6 +974,10 @@ namespace tardigradeBalanceEquations {
              * \param &result: The result of the non-divergence part of the balance of energy
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_ENERGY_RESIDUAL,
+                costModel::getBalanceOfEnergyResidualCost(dim).flops)
+
             computeBalanceOfEnergy<dim, is_per_unit_volume>(
                 density, density_dot, density_gradient_begin, density_gradient_end, internal_energy,
                 internal_energy_dot, internal_energy_gradient_begin, internal_energy_gradient_end, velocity_begin,
@@ -904,6 +1110,12 @@ namespace tardigradeBalanceEquations {
              * displacement
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_ENERGY_JACOBIAN,
+                costModel::getBalanceOfEnergyJacobianCost(dim, dRdRho_end - dRdRho_begin, material_response_dim,
+                                                          material_response_num_dof)
+                    .flops)
+
             std::array<result_type, material_response_dim * material_response_dim> dRdCauchy_phase;
 
             result_type dRdr_phase;
@@ -943,6 +1155,12 @@ namespace tardigradeBalanceEquations {
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                CHAIN_RULE,
+                costModel::getBalanceOfEnergyJacobianCost(dim, nphases, material_response_dim,
+                                                          material_response_num_dof)
+                    .chain_rule_flops)
+
             // Scale the volume fraction by the interpolation function
             *(dRdVolumeFraction_begin + phase) *= interpolation_function;
 
@@ -1859,41 +2077,41 @@ namespace tardigradeBalanceEquations {
             const unsigned int material_response_size =
                 (unsigned int)(material_response_end - material_response_begin) / nphases;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient vectors must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The density and internal energy vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
                                          "The density and internal energy dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
                                                                          internal_energy_gradient_begin),
                                          "The density and internal energy gradient vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_size ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_size ==
                                              (unsigned int)(material_response_end - material_response_begin),
                                          "The density and material response vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The density and volume fraction vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim ==
                                              (unsigned int)(test_function_gradient_end - test_function_gradient_begin),
                                          "The test function gradient must be of size dim")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
                                          "The density and result vectors must be the same size")
 
             for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
@@ -1926,8 +2144,9 @@ namespace tardigradeBalanceEquations {
                   typename dUDotdU_type, class result_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
                   class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter,
                   class dRdUMesh_iter, int density_index, int displacement_index, int velocity_index,
-                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index>
-        void computeBalanceOfEnergy(
+                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index,
+                  class phase_loop_type>
+        void computeBalanceOfEnergyPhaseLoop(
             const density_iter &density_begin, const density_iter &density_end,
             const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
             const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
@@ -1954,7 +2173,8 @@ namespace tardigradeBalanceEquations {
             dRdU_iter dRdU_begin, dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end,
             dRdTheta_iter dRdTheta_begin, dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
             dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
-            dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end) {
+            dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
+            phase_loop_type phase_loop) {
             /*!
              * Compute the full balance of energy in a variational context using a generalized material response vector
              * for a multiphasic problem
@@ -2046,6 +2266,8 @@ namespace tardigradeBalanceEquations {
              * displacement
              * \param &dRdUMesh_end: The stopping iterator of the derivative of the residual w.r.t. the mesh
              * displacement
+             * \param phase_loop: The loop over the phases which is called with the number of phases and a function
+             * of the phase
              */
 
             const unsigned int nphases = (unsigned int)(density_end - density_begin);
@@ -2061,34 +2283,34 @@ namespace tardigradeBalanceEquations {
             using volume_fraction_type     = typename std::iterator_traits<volume_fraction_iter>::value_type;
             using result_type              = typename std::iterator_traits<result_iter>::value_type;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient vectors must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The density and internal energy vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
                                          "The density and internal energy dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(internal_energy_gradient_end -
                                                                          internal_energy_gradient_begin),
                                          "The density and internal energy gradient vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_size ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_size ==
                                              (unsigned int)(material_response_end - material_response_begin),
                                          "The density and material response vectors must be a consistent size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size * (nphases * num_phase_dof + num_additional_dof) *
                         (1 + material_response_dim) ==
                     (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
@@ -2105,52 +2327,54 @@ namespace tardigradeBalanceEquations {
                     "\n  actual jacobian size       : " +
                     std::to_string((unsigned int)(material_response_jacobian_end - material_response_jacobian_begin)))
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The density and volume fraction vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim ==
                                              (unsigned int)(test_function_gradient_end - test_function_gradient_begin),
                                          "The test function gradient must be of size dim")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim == (unsigned int)(interpolation_function_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(interpolation_function_gradient_end -
                                                                interpolation_function_gradient_begin),
                                          "The interpolation function gradient must be of size dim")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (nphases * num_phase_dof + num_additional_dof) * material_response_dim ==
                     (unsigned int)(full_material_response_dof_gradient_end - full_material_response_dof_gradient_begin),
                 "The full material response dof gradient vector must be consistent with the material response size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
                                          "The density and result vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The density and dRdRho must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
                                          "The density and dRdU must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
                                          "The density and dRdW must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "The density and dRdTheta must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdE_end - dRdE_begin),
                                          "The density and dRdE must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
                                          "The density and dRdZ must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases ==
                                              (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "The density and dRdVolumeFraction must be of consistent sizes")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The density and dRdUMesh must be of consistent sizes")
 
-            for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
-                 ++v.first, ++v.second) {
+            const unsigned int jacobian_size =
+                material_response_size * (nphases * num_phase_dof + num_additional_dof) * (1 + material_response_dim);
+
+            phase_loop(nphases, [&](const unsigned int phase) {
                 computeBalanceOfEnergy<
                     dim, is_per_unit_volume, material_response_dim, cauchy_stress_index, internal_heat_generation_index,
                     heat_flux_index, interphasic_force_index, interphasic_heat_transfer_index,
@@ -2163,66 +2387,153 @@ namespace tardigradeBalanceEquations {
                     dRdE_iter, dRdVolumeFraction_iter, dRdZ_iter, dRdUMesh_iter, density_index, displacement_index,
                     velocity_index, temperature_index, internal_energy_index, volume_fraction_index,
                     additional_dof_index>(
-                    *(density_begin + v.first), *(density_dot_begin + v.first), density_gradient_begin + dim * v.first,
-                    density_gradient_begin + dim * (v.first + 1), *(internal_energy_begin + v.first),
-                    *(internal_energy_dot_begin + v.first), internal_energy_gradient_begin + dim * v.first,
-                    internal_energy_gradient_begin + dim * (v.first + 1), velocity_begin + dim * v.first,
-                    velocity_begin + dim * (v.first + 1), velocity_gradient_begin + dim * dim * v.first,
-                    velocity_gradient_begin + dim * dim * (v.first + 1),
-                    material_response_begin + material_response_size * v.first,
-                    material_response_begin + material_response_size * (v.first + 1),
-                    material_response_jacobian_begin + material_response_size *
-                                                           (nphases * num_phase_dof + num_additional_dof) *
-                                                           (1 + material_response_dim) * v.first,
-                    material_response_jacobian_begin + material_response_size *
-                                                           (nphases * num_phase_dof + num_additional_dof) *
-                                                           (1 + material_response_dim) * (v.first + 1),
-                    *(volume_fraction_begin + v.first), test_function, test_function_gradient_begin,
-                    test_function_gradient_end, interpolation_function, interpolation_function_gradient_begin,
-                    interpolation_function_gradient_end, full_material_response_dof_gradient_begin,
-                    full_material_response_dof_gradient_end, dRhoDotdRho, dEDotdE, dUDotdU, v.first,
-                    *(result_begin + v.first), dRdRho_begin + nphases * v.first, dRdRho_begin + nphases * (v.first + 1),
-                    dRdU_begin + nphases * dim * v.first, dRdU_begin + nphases * dim * (v.first + 1),
-                    dRdW_begin + nphases * dim * v.first, dRdW_begin + nphases * dim * (v.first + 1),
-                    dRdTheta_begin + nphases * v.first, dRdTheta_begin + nphases * (v.first + 1),
-                    dRdE_begin + nphases * v.first, dRdE_begin + nphases * (v.first + 1),
-                    dRdVolumeFraction_begin + nphases * v.first, dRdVolumeFraction_begin + nphases * (v.first + 1),
-                    dRdZ_begin + num_additional_dof * v.first, dRdZ_begin + num_additional_dof * (v.first + 1),
-                    dRdUMesh_begin + dim * v.first, dRdUMesh_begin + dim * (v.first + 1));
-            }
+                    *(density_begin + phase), *(density_dot_begin + phase), density_gradient_begin + dim * phase,
+                    density_gradient_begin + dim * (phase + 1), *(internal_energy_begin + phase),
+                    *(internal_energy_dot_begin + phase), internal_energy_gradient_begin + dim * phase,
+                    internal_energy_gradient_begin + dim * (phase + 1), velocity_begin + dim * phase,
+                    velocity_begin + dim * (phase + 1), velocity_gradient_begin + dim * dim * phase,
+                    velocity_gradient_begin + dim * dim * (phase + 1),
+                    material_response_begin + material_response_size * phase,
+                    material_response_begin + material_response_size * (phase + 1),
+                    material_response_jacobian_begin + jacobian_size * phase,
+                    material_response_jacobian_begin + jacobian_size * (phase + 1), *(volume_fraction_begin + phase),
+                    test_function, test_function_gradient_begin, test_function_gradient_end, interpolation_function,
+                    interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                    full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dRhoDotdRho,
+                    dEDotdE, dUDotdU, phase, *(result_begin + phase), dRdRho_begin + nphases * phase,
+                    dRdRho_begin + nphases * (phase + 1), dRdU_begin + nphases * dim * phase,
+                    dRdU_begin + nphases * dim * (phase + 1), dRdW_begin + nphases * dim * phase,
+                    dRdW_begin + nphases * dim * (phase + 1), dRdTheta_begin + nphases * phase,
+                    dRdTheta_begin + nphases * (phase + 1), dRdE_begin + nphases * phase,
+                    dRdE_begin + nphases * (phase + 1), dRdVolumeFraction_begin + nphases * phase,
+                    dRdVolumeFraction_begin + nphases * (phase + 1), dRdZ_begin + num_additional_dof * phase,
+                    dRdZ_begin + num_additional_dof * (phase + 1), dRdUMesh_begin + dim * phase,
+                    dRdUMesh_begin + dim * (phase + 1));
+            });
         }
 
-        template <int dim, bool is_per_unit_volume, typename density_type, typename density_dot_type,
-                  class density_gradient_iter, typename internal_energy_type, typename internal_energy_dot_type,
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class internal_energy_iter,
+                  class internal_energy_dot_iter, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename test_function_type, class test_function_gradient_iter,
+                  typename interpolation_function_type, class interpolation_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, typename dRhoDotdRho_type, typename dEDotdE_type,
+                  typename dUDotdU_type, class result_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
+                  class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter,
+                  class dRdUMesh_iter, int density_index, int displacement_index, int velocity_index,
+                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index>
+        void computeBalanceOfEnergy(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const test_function_type &test_function, const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter              &test_function_gradient_end,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            result_iter result_begin, result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end,
+            dRdU_iter dRdU_begin, dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end,
+            dRdTheta_iter dRdTheta_begin, dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
+            dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
+            dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end) {
+            /*!
+             * Compute the balance of energy of all of the phases in order on the calling thread. The phases may be
+             * distributed over a thread pool with the overload defined in tardigrade_phase_parallel.h. See
+             * computeBalanceOfEnergyPhaseLoop for the parameters
+             */
+
+            computeBalanceOfEnergyPhaseLoop<
+                dim, is_per_unit_volume, material_response_dim, cauchy_stress_index, internal_heat_generation_index,
+                heat_flux_index, interphasic_force_index, interphasic_heat_transfer_index, material_response_num_dof,
+                density_iter, density_dot_iter, density_gradient_iter, internal_energy_iter, internal_energy_dot_iter,
+                internal_energy_gradient_iter, velocity_iter, velocity_gradient_iter, material_response_iter,
+                material_response_jacobian_iter, volume_fraction_iter, test_function_type, test_function_gradient_iter,
+                interpolation_function_type, interpolation_function_gradient_iter,
+                full_material_response_dof_gradient_iter, dRhoDotdRho_type, dEDotdE_type, dUDotdU_type, result_iter,
+                dRdRho_iter, dRdU_iter, dRdW_iter, dRdTheta_iter, dRdE_iter, dRdVolumeFraction_iter, dRdZ_iter,
+                dRdUMesh_iter, density_index, displacement_index, velocity_index, temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index>(
+                density_begin, density_end, density_dot_begin, density_dot_end, density_gradient_begin,
+                density_gradient_end, internal_energy_begin, internal_energy_end, internal_energy_dot_begin,
+                internal_energy_dot_end, internal_energy_gradient_begin, internal_energy_gradient_end, velocity_begin,
+                velocity_end, velocity_gradient_begin, velocity_gradient_end, material_response_begin,
+                material_response_end, material_response_jacobian_begin, material_response_jacobian_end,
+                volume_fraction_begin, volume_fraction_end, test_function, test_function_gradient_begin,
+                test_function_gradient_end, interpolation_function, interpolation_function_gradient_begin,
+                interpolation_function_gradient_end, full_material_response_dof_gradient_begin,
+                full_material_response_dof_gradient_end, dRhoDotdRho, dEDotdE, dUDotdU, result_begin, result_end,
+                dRdRho_begin, dRdRho_end, dRdU_begin, dRdU_end, dRdW_begin, dRdW_end, dRdTheta_begin, dRdTheta_end,
+                dRdE_begin, dRdE_end, dRdVolumeFraction_begin, dRdVolumeFraction_end, dRdZ_begin, dRdZ_end,
+                dRdUMesh_begin, dRdUMesh_end,
+                [](const unsigned int nphases, auto function) {
+                    for (unsigned int phase = 0; phase < nphases; ++phase) {
+                        function(phase);
+                    }
+                });
+        }
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class material_response_pattern,
+                  typename density_type, typename density_dot_type, class density_gradient_iter,
+                  typename internal_energy_type, typename internal_energy_dot_type,
                   class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
-                  class cauchy_stress_iter, typename volume_fraction_type, typename internal_heat_generation_type,
-                  class net_interphase_force_iter, typename result_type>
-        void computeBalanceOfEnergyNonDivergence(
+                  class material_response_iter, class material_response_jacobian_iter, typename volume_fraction_type,
+                  typename test_function_type, class test_function_gradient_iter, typename interpolation_function_type,
+                  class interpolation_function_gradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dRhoDotdRho_type, typename dEDotdE_type, typename dUDotdU_type, typename result_type,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index, int displacement_index,
+                  int velocity_index, int temperature_index, int internal_energy_index, int volume_fraction_index,
+                  int additional_dof_index>
+        void computeBalanceOfEnergyCompressed(
             const density_type &density, const density_dot_type &density_dot,
             const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
             const internal_energy_type &internal_energy, const internal_energy_dot_type &internal_energy_dot,
             const internal_energy_gradient_iter &internal_energy_gradient_begin,
             const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
             const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
-            const velocity_gradient_iter &velocity_gradient_end, const cauchy_stress_iter &cauchy_stress_begin,
-            const cauchy_stress_iter &cauchy_stress_end, const volume_fraction_type &volume_fraction,
-            const internal_heat_generation_type &internal_heat_generation,
-            const net_interphase_force_iter     &net_interphase_force_begin,
-            const net_interphase_force_iter &net_interphase_force_end, result_type &result) {
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const test_function_type &test_function,
+            const test_function_gradient_iter              &test_function_gradient_begin,
+            const test_function_gradient_iter              &test_function_gradient_end,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            const unsigned int nphases, const unsigned int phase, result_type &result, jacobian_iter jacobian_begin,
+            jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end) {
             /*!
-             * Compute the non-divergence parts of the balance of energy i.e.
-             *
-             * \f$ \frac{\partial}{\partial t}\left( \rho^{\alpha} e^{\alpha} \right) + \left( \rho^{\alpha}
-             * v_i^{\alpha} e^{\alpha} \right)_{,i} - \frac{1}{2} c^{\alpha} v_i^{\alpha} v_i^{\alpha} + \sum_{\beta}
-             * \pi_i^{\alpha \beta} v_i^{\alpha} - \phi^{\alpha}\bar{\sigma}_{ji}^{\alpha}v_{i,j}^{\alpha} -
-             * \rho^{\alpha} r^{\alpha} \f$
+             * Compute the full balance of energy using a generalized material response vector and its Jacobian in
+             * compressed form. Only the columns of the structurally non-zero field blocks of
+             * BalanceOfEnergySparsity< material_response_pattern > are stored, computed, or zeroed. The layout of the
+             * columns is given by the functions of jacobianSparsity.
              *
-             * NOTE: If is_per_unit_volume is true then the internal energy is assumed to be per unit volume rather than
-             * per unit mass meaning that the balance equation is
+             * The material response Jacobian is assumed to be zero outside of material_response_pattern. If the
+             * pattern is jacobianSparsity::DensePattern the result is identical to the dense overload.
              *
-             * \f$ \frac{\partial}{\partial t}\left( e^{\alpha} \right) + \left( v_i^{\alpha} e^{\alpha} \right)_{,i} -
-             * \frac{1}{2} c^{\alpha} v_i^{\alpha} v_i^{\alpha} + \sum_{\beta} \pi_i^{\alpha \beta} v_i^{\alpha} -
-             * \phi^{\alpha}\bar{\sigma}_{ji}^{\alpha}v_{i,j}^{\alpha} - \rho^{\alpha} r^{\alpha} \f$
+             * material_response_pattern: The structural sparsity pattern of the material response Jacobian
              *
              * \param &density: The apparent density (dm / dv) of phase \f$ \alpha \f$ \f$\left(\rho^{\alpha}\right)\f$
              * \param &density_dot: The partial temporal derivative of the apparent density (dm / dv) of phase \f$
@@ -2246,8 +2557,215 @@ namespace tardigradeBalanceEquations {
              * \f$ \alpha \f$ \f$\left( v^{\alpha}_{i,j} \right) \f$
              * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity of phase \f$
              * \alpha \f$ \f$\left( v^{\alpha}_{i,j} \right) \f$
-             * \param &cauchy_stress_begin: The starting iterator of the true Cauchy stress \f$ \bar{\bf{\sigma}} \f$
-             * where \f$ \bf{\sigma} = \phi \bar{\bf{\sigma}} \f$
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian vector
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian vector
+             * \param &volume_fraction: The the volume fraction of phase \f$ \alpha \f$ \f$ \left(\phi^{\alpha}\right)
+             * \f$
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the spatial gradient of the test function
+             * \f$ \left( \psi_{,i} \right) \f$
+             * \param &test_function_gradient_end: The stopping iterator of the spatial gradient of the test function
+             * \f$ \left( \psi_{,i} \right) \f$
+             * \param &interpolation_function: The value of the interpolation function \f$ \left( N \right) \f$
+             * \param &interpolation_function_gradient_begin: The starting iterator of the spatial gradient of the
+             * interpolation function \f$ \left( N_{,i} \right) \f$
+             * \param &interpolation_function_gradient_end: The stopping iterator of the spatial gradient of the
+             * interpolation function \f$ \left( N_{,i} \right) \f$
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dRhoDotdRho: The derivative of the time rate of change of the density w.r.t. the density
+             * \param &dEDotdE: The derivative of the time rate of change of the internal energy w.r.t. the internal
+             * energy
+             * \param &dUDotdU: The derivative of the time rate of change of the displacement degree of freedom w.r.t.
+             * the displacement degree of freedom
+             * \param nphases: The number of phases
+             * \param phase: The phase that is having the balance of energy computed on
+             * \param &result: The result of the balance of energy
+             * \param &jacobian_begin: The starting iterator of the compressed Jacobian
+             * \param &jacobian_end: The stopping iterator of the compressed Jacobian
+             * \param &dRdUMesh_begin: The starting iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             * \param &dRdUMesh_end: The stopping iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             */
+
+            using jacobian_type = typename std::iterator_traits<jacobian_iter>::value_type;
+            using pattern       = BalanceOfEnergySparsity<material_response_pattern>;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            // The material response rows are the Cauchy stress, the internal heat generation, the interphasic force,
+            // the heat flux, and the interphasic heat transfer
+            constexpr unsigned int num_response_rows =
+                material_response_dim * material_response_dim + 1 + material_response_dim + material_response_dim + 1;
+
+            const unsigned int num_columns = jacobianSparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of the number of compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+                                         "dRdUMesh must have a size of dim")
+
+            jacobian_type dRdRho_phase, dRdE_phase, dRdVF_phase, dRdr_phase;
+
+            std::array<jacobian_type, dim> dRdU_phase;
+
+            std::array<jacobian_type, material_response_dim * material_response_dim> dRdCauchy_phase;
+
+            std::array<jacobian_type, material_response_dim> dRdpi_phase, dRdq_phase;
+
+            computeBalanceOfEnergy<dim, is_per_unit_volume>(
+                density, density_dot, density_gradient_begin, density_gradient_end, internal_energy,
+                internal_energy_dot, internal_energy_gradient_begin, internal_energy_gradient_end, velocity_begin,
+                velocity_end, velocity_gradient_begin, velocity_gradient_end,
+                material_response_begin + cauchy_stress_index,
+                material_response_begin + cauchy_stress_index + material_response_dim * material_response_dim,
+                volume_fraction, *(material_response_begin + internal_heat_generation_index),
+                material_response_begin + interphasic_force_index,
+                material_response_begin + interphasic_force_index + material_response_dim,
+                material_response_begin + heat_flux_index,
+                material_response_begin + heat_flux_index + material_response_dim, test_function,
+                test_function_gradient_begin, test_function_gradient_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end, dRhoDotdRho, dEDotdE,
+                dUDotdU, result, dRdRho_phase, dRdE_phase, std::begin(dRdU_phase), std::end(dRdU_phase),
+                std::begin(dRdCauchy_phase), std::end(dRdCauchy_phase), dRdVF_phase, dRdr_phase,
+                std::begin(dRdpi_phase), std::end(dRdpi_phase), std::begin(dRdq_phase), std::end(dRdq_phase),
+                dRdUMesh_begin, dRdUMesh_end);
+
+            result -= test_function * (*(material_response_begin + interphasic_heat_transfer_index));
+
+            // The material response rows and their coefficients in the residual
+            std::array<unsigned int, num_response_rows>  response_rows;
+            std::array<jacobian_type, num_response_rows> response_coefficients;
+
+            unsigned int row = 0;
+
+            for (unsigned int j = 0; j < material_response_dim * material_response_dim; ++j, ++row) {
+                response_rows[row]         = cauchy_stress_index + j;
+                response_coefficients[row] = dRdCauchy_phase[j];
+            }
+
+            response_rows[row]         = internal_heat_generation_index;
+            response_coefficients[row] = dRdr_phase;
+            ++row;
+
+            for (unsigned int j = 0; j < material_response_dim; ++j, ++row) {
+                response_rows[row]         = interphasic_force_index + j;
+                response_coefficients[row] = dRdpi_phase[j];
+            }
+
+            for (unsigned int j = 0; j < material_response_dim; ++j, ++row) {
+                response_rows[row]         = heat_flux_index + j;
+                response_coefficients[row] = dRdq_phase[j];
+            }
+
+            response_rows[row]         = interphasic_heat_transfer_index;
+            response_coefficients[row] = -test_function;
+
+            const std::array<unsigned int, jacobianSparsity::num_field_blocks> field_indices = {
+                density_index,         velocity_index,        displacement_index,  temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index};
+
+            std::fill(jacobian_begin, jacobian_end, jacobian_type());
+
+            jacobianSparsity::addMaterialResponseJacobian<pattern, material_response_pattern, dim,
+                                                          material_response_dim, num_response_rows>(
+                nphases, num_additional_dof, phase, field_indices, std::cbegin(response_rows),
+                std::cend(response_rows), std::cbegin(response_coefficients), std::cend(response_coefficients),
+                material_response_jacobian_begin, material_response_jacobian_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dUDotdU,
+                jacobian_begin, jacobian_end, dRdUMesh_begin, dRdUMesh_end);
+
+            // Direct dependence on the dof of the current phase
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::DENSITY, dim, nphases,
+                                                                              num_additional_dof, phase)) +=
+                dRdRho_phase;
+
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::INTERNAL_ENERGY, dim,
+                                                                              nphases, num_additional_dof, phase)) +=
+                dRdE_phase;
+
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::VOLUME_FRACTION, dim,
+                                                                              nphases, num_additional_dof, phase)) +=
+                dRdVF_phase * interpolation_function;
+
+            const unsigned int velocity_column = jacobianSparsity::getPhaseFieldOffset<pattern>(
+                jacobianSparsity::VELOCITY, dim, nphases, num_additional_dof, phase);
+
+            for (unsigned int a = 0; a < dim; ++a) {
+                *(jacobian_begin + velocity_column + a) += dRdU_phase[a];
+
+                *(dRdUMesh_begin + a) -= test_function *
+                                         (*(material_response_begin + interphasic_heat_transfer_index)) *
+                                         (*(interpolation_function_gradient_begin + a));
+            }
+        }
+
+        template <int dim, bool is_per_unit_volume, typename density_type, typename density_dot_type,
+                  class density_gradient_iter, typename internal_energy_type, typename internal_energy_dot_type,
+                  class internal_energy_gradient_iter, class velocity_iter, class velocity_gradient_iter,
+                  class cauchy_stress_iter, typename volume_fraction_type, typename internal_heat_generation_type,
+                  class net_interphase_force_iter, typename result_type>
+        void computeBalanceOfEnergyNonDivergence(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_type &internal_energy, const internal_energy_dot_type &internal_energy_dot,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const cauchy_stress_iter &cauchy_stress_begin,
+            const cauchy_stress_iter &cauchy_stress_end, const volume_fraction_type &volume_fraction,
+            const internal_heat_generation_type &internal_heat_generation,
+            const net_interphase_force_iter     &net_interphase_force_begin,
+            const net_interphase_force_iter &net_interphase_force_end, result_type &result) {
+            /*!
+             * Compute the non-divergence parts of the balance of energy i.e.
+             *
+             * \f$ \frac{\partial}{\partial t}\left( \rho^{\alpha} e^{\alpha} \right) + \left( \rho^{\alpha}
+             * v_i^{\alpha} e^{\alpha} \right)_{,i} - \frac{1}{2} c^{\alpha} v_i^{\alpha} v_i^{\alpha} + \sum_{\beta}
+             * \pi_i^{\alpha \beta} v_i^{\alpha} - \phi^{\alpha}\bar{\sigma}_{ji}^{\alpha}v_{i,j}^{\alpha} -
+             * \rho^{\alpha} r^{\alpha} \f$
+             *
+             * NOTE: If is_per_unit_volume is true then the internal energy is assumed to be per unit volume rather than
+             * per unit mass meaning that the balance equation is
+             *
+             * \f$ \frac{\partial}{\partial t}\left( e^{\alpha} \right) + \left( v_i^{\alpha} e^{\alpha} \right)_{,i} -
+             * \frac{1}{2} c^{\alpha} v_i^{\alpha} v_i^{\alpha} + \sum_{\beta} \pi_i^{\alpha \beta} v_i^{\alpha} -
+             * \phi^{\alpha}\bar{\sigma}_{ji}^{\alpha}v_{i,j}^{\alpha} - \rho^{\alpha} r^{\alpha} \f$
+             *
+             * \param &density: The apparent density (dm / dv) of phase \f$ \alpha \f$ \f$\left(\rho^{\alpha}\right)\f$
+             * \param &density_dot: The partial temporal derivative of the apparent density (dm / dv) of phase \f$
+             * \alpha \f$ \f$\left(\frac{\partial}{\partial t} \rho^{\alpha}\right)\f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the apparent density
+             * (dm/dv) of phase \f$ \alpha \f$ \f$\left( \rho^{\alpha}_{,i} \right) \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the apparent density
+             * (dm/dv) of phase \f$ \alpha \f$ \f$\left( \rho^{\alpha}_{,i} \right) \f$
+             * \param &internal_energy: The internal energy of phase \f$ \alpha \f$ \f$\left(e^{\alpha}\right)\f$
+             * \param &internal_energy_dot: The partial temporal derivative of the internal energy of phase \f$ \alpha
+             * \f$ \f$\left(\frac{\partial}{\partial t} e^{\alpha}\right)\f$
+             * \param &internal_energy_gradient_begin: The starting iterator of the spatial gradient of the internal
+             * energy of phase \f$ \alpha \f$ \f$\left( e^{\alpha}_{,i} \right) \f$
+             * \param &internal_energy_gradient_end: The stopping iterator of the spatial gradient of the internal
+             * energy of phase \f$ \alpha \f$ \f$\left( e^{\alpha}_{,i} \right) \f$
+             * \param &velocity_begin: The starting iterator of the velocity of phase \f$ \alpha \f$ \f$\left(
+             * v^{\alpha}_i \right) \f$
+             * \param &velocity_end: The stopping iterator of the velocity of phase \f$ \alpha \f$ \f$\left(
+             * v^{\alpha}_i \right) \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity of phase
+             * \f$ \alpha \f$ \f$\left( v^{\alpha}_{i,j} \right) \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity of phase \f$
+             * \alpha \f$ \f$\left( v^{\alpha}_{i,j} \right) \f$
+             * \param &cauchy_stress_begin: The starting iterator of the true Cauchy stress \f$ \bar{\bf{\sigma}} \f$
+             * where \f$ \bf{\sigma} = \phi \bar{\bf{\sigma}} \f$
              * \param &cauchy_stress_end: The stopping iterator of the true Cauchy stress \f$ \bar{\bf{\sigma}} \f$
              * where \f$ \bf{\sigma} = \phi \bar{\bf{\sigma}} \f$
              * \param &volume_fraction: The volume fraction of phase \f$ \alpha \f$ \f$ \left(\phi^{\alpha}\right) \f$
@@ -2275,19 +2793,23 @@ namespace tardigradeBalanceEquations {
                 trace_velocity_gradient += *(velocity_gradient_begin + dim * i + i);
             }
 
+            const result_type v_dot_grad_e =
+                std::inner_product(velocity_begin, velocity_end, internal_energy_gradient_begin, result_type());
+
             if (is_per_unit_volume) {
-                result = internal_energy_dot + internal_energy * trace_velocity_gradient +
-                         std::inner_product(velocity_begin, velocity_end, internal_energy_gradient_begin, 0.);
+                result = internal_energy_dot + internal_energy * trace_velocity_gradient + v_dot_grad_e;
             } else {
                 result = density_dot * internal_energy + density * internal_energy_dot +
-                         internal_energy *
-                             std::inner_product(density_gradient_begin, density_gradient_end, velocity_begin, 0.) +
-                         density * internal_energy * trace_velocity_gradient +
-                         density * std::inner_product(velocity_begin, velocity_end, internal_energy_gradient_begin, 0.);
+                         internal_energy * std::inner_product(density_gradient_begin, density_gradient_end,
+                                                              velocity_begin, result_type()) +
+                         density * internal_energy * trace_velocity_gradient + density * v_dot_grad_e;
             }
 
-            result += -0.5 * mass_change_rate * std::inner_product(velocity_begin, velocity_end, velocity_begin, 0.) +
-                      std::inner_product(net_interphase_force_begin, net_interphase_force_end, velocity_begin, 0.) -
+            const result_type v_dot_v = std::inner_product(velocity_begin, velocity_end, velocity_begin, result_type());
+
+            result += -0.5 * mass_change_rate * v_dot_v +
+                      std::inner_product(net_interphase_force_begin, net_interphase_force_end, velocity_begin,
+                                         result_type()) -
                       density * internal_heat_generation;
 
             for (unsigned int i = 0; i < dim; i++) {
@@ -2796,7 +3318,8 @@ namespace tardigradeBalanceEquations {
              * \param &result: The resulting divergence term
              */
 
-            result = -std::inner_product(test_function_gradient_begin, test_function_gradient_end, heat_flux_begin, 0.);
+            result = -std::inner_product(test_function_gradient_begin, test_function_gradient_end, heat_flux_begin,
+                                         result_type());
         }
 
         template <int dim, class test_function_gradient_iter, class heat_flux_iter, typename result_type,
@@ -2918,6 +3441,469 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, typename density_type,
+                  typename density_dot_type, class density_gradient_iter, typename internal_energy_type,
+                  typename internal_energy_dot_type, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  typename volume_fraction_type, typename test_function_type, class test_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dRhoDotdRho_type, typename dEDotdE_type, typename dUDotdU_type, typename result_type,
+                  typename jvp_type, int density_index, int velocity_index, int internal_energy_index,
+                  int volume_fraction_index>
+        void computeBalanceOfEnergyJVP(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_type &internal_energy, const internal_energy_dot_type &internal_energy_dot,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter                       &material_response_end,
+            const material_response_jacobian_iter              &material_response_jacobian_begin,
+            const material_response_jacobian_iter              &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const test_function_type &test_function,
+            const test_function_gradient_iter                  &test_function_gradient_begin,
+            const test_function_gradient_iter                  &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            const unsigned int &phase, result_type &result, jvp_type &jvp) {
+            /*!
+             * Compute the full balance of energy in a variational context using a generalized material response vector
+             * and the product of its Jacobian with a perturbation of the degrees of freedom (a Jacobian-vector
+             * product). The product is formed through the same chain rule as the Jacobians of the dense overload so
+             * that the Jacobian never needs to be stored.
+             *
+             * The perturbation is provided in the layout of the material response dof vector and is expected to
+             * already be interpolated to the evaluation point. The velocity block of the perturbation is the
+             * perturbation of the spatial dof (i.e., it is scaled by dUDotdU here).
+             *
+             * \param &density: The apparent density (dm / dv) of phase \f$ \alpha \f$ \f$\left(\rho^{\alpha}\right)\f$
+             * \param &density_dot: The partial temporal derivative of the apparent density (dm / dv) of phase \f$
+             * \alpha \f$ \f$\left(\frac{\partial}{\partial t} \rho^{\alpha}\right)\f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the apparent density
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the apparent density
+             * \param &internal_energy: The internal energy of the phase
+             * \param &internal_energy_dot: The partial temporal derivative of the internal energy of the phase
+             * \param &internal_energy_gradient_begin: The starting iterator of the spatial gradient of the internal
+             * energy
+             * \param &internal_energy_gradient_end: The stopping iterator of the spatial gradient of the internal
+             * energy
+             * \param &velocity_begin: The starting iterator of the velocity of the phase
+             * \param &velocity_end: The stopping iterator of the velocity of the phase
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian
+             * \param &volume_fraction: The volume fraction of the phase
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the spatial gradient of the test function
+             * \param &test_function_gradient_end: The stopping iterator of the spatial gradient of the test function
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dof_perturbation_begin: The starting iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_end: The stopping iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_gradient_begin: The starting iterator of the spatial gradient of the
+             * perturbation of the material response dof vector
+             * \param &dof_perturbation_gradient_end: The stopping iterator of the spatial gradient of the perturbation
+             * of the material response dof vector
+             * \param &mesh_displacement_perturbation_gradient_begin: The starting iterator of the spatial gradient of
+             * the perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &mesh_displacement_perturbation_gradient_end: The stopping iterator of the spatial gradient of the
+             * perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &dRhoDotdRho: The derivative of the time rate of change of the density w.r.t. the density
+             * \param &dEDotdE: The derivative of the time rate of change of the internal energy w.r.t. the internal
+             * energy
+             * \param &dUDotdU: The derivative of the time rate of change of the spatial dof w.r.t. the spatial dof
+             * \param &phase: The phase the balance equation applies to
+             * \param &result: The balance of energy
+             * \param &jvp: The Jacobian-vector product
+             */
+
+            using dRdRhoDot_type           = result_type;
+            using dRdGradRho_type          = result_type;
+            using dRdEDot_type             = result_type;
+            using dRdGradE_type            = result_type;
+            using dRdV_type                = result_type;
+            using dRdGradV_type            = result_type;
+            using dRdGradTestFunction_type = result_type;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int nphases =
+                ((unsigned int)(dof_perturbation_end - dof_perturbation_begin) - num_additional_dof) / num_phase_dof;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            result_type                      dRdRho;
+            dRdRhoDot_type                   dRdRhoDot;
+            std::array<dRdGradRho_type, dim> dRdGradRho;
+
+            result_type                    dRdE;
+            dRdEDot_type                   dRdEDot;
+            std::array<dRdGradE_type, dim> dRdGradE;
+
+            std::array<dRdV_type, dim>           dRdV;
+            std::array<dRdGradV_type, dim * dim> dRdGradV;
+
+            std::array<result_type, material_response_dim * material_response_dim> dRdCauchy;
+
+            result_type dRdVolumeFraction, dRdr;
+
+            std::array<result_type, material_response_dim> dRdpi, dRdq;
+
+            std::array<dRdGradTestFunction_type, dim> dRdGradTestFunction;
+
+            computeBalanceOfEnergyNonDivergence<dim, is_per_unit_volume>(
+                density, density_dot, density_gradient_begin, density_gradient_end, internal_energy,
+                internal_energy_dot, internal_energy_gradient_begin, internal_energy_gradient_end, velocity_begin,
+                velocity_end, velocity_gradient_begin, velocity_gradient_end,
+                material_response_begin + cauchy_stress_index,
+                material_response_begin + cauchy_stress_index + material_response_dim * material_response_dim,
+                volume_fraction, *(material_response_begin + internal_heat_generation_index),
+                material_response_begin + interphasic_force_index,
+                material_response_begin + interphasic_force_index + material_response_dim, result, dRdRho, dRdRhoDot,
+                std::begin(dRdGradRho), std::end(dRdGradRho), dRdE, dRdEDot, std::begin(dRdGradE), std::end(dRdGradE),
+                std::begin(dRdV), std::end(dRdV), std::begin(dRdGradV), std::end(dRdGradV), std::begin(dRdCauchy),
+                std::end(dRdCauchy), dRdVolumeFraction, dRdr, std::begin(dRdpi), std::end(dRdpi));
+
+            result *= test_function;
+
+            result_type result_divergence;
+
+            computeBalanceOfEnergyDivergence<dim>(
+                test_function_gradient_begin, test_function_gradient_end, material_response_begin + heat_flux_index,
+                material_response_begin + heat_flux_index + material_response_dim, result_divergence,
+                std::begin(dRdGradTestFunction), std::end(dRdGradTestFunction), std::begin(dRdq), std::end(dRdq));
+
+            result += result_divergence;
+
+            result -= test_function * (*(material_response_begin + interphasic_heat_transfer_index));
+
+            // Directional derivatives of the material response
+            std::array<result_type, material_response_dim * material_response_dim> delta_cauchy_stress;
+            std::array<result_type, material_response_dim>                         delta_interphasic_force;
+            std::array<result_type, material_response_dim>                         delta_heat_flux;
+            result_type delta_internal_heat_generation, delta_interphasic_heat_transfer;
+
+            for (unsigned int j = 0; j < material_response_dim * material_response_dim; ++j) {
+                finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                            material_response_num_dof, velocity_index>(
+                    cauchy_stress_index + j, material_response_jacobian_begin, material_response_jacobian_end,
+                    dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                    dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                    mesh_displacement_perturbation_gradient_end, dUDotdU, delta_cauchy_stress[j]);
+            }
+
+            for (unsigned int j = 0; j < material_response_dim; ++j) {
+                finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                            material_response_num_dof, velocity_index>(
+                    interphasic_force_index + j, material_response_jacobian_begin, material_response_jacobian_end,
+                    dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                    dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                    mesh_displacement_perturbation_gradient_end, dUDotdU, delta_interphasic_force[j]);
+
+                finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                            material_response_num_dof, velocity_index>(
+                    heat_flux_index + j, material_response_jacobian_begin, material_response_jacobian_end,
+                    dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                    dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                    mesh_displacement_perturbation_gradient_end, dUDotdU, delta_heat_flux[j]);
+            }
+
+            finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                        material_response_num_dof, velocity_index>(
+                internal_heat_generation_index, material_response_jacobian_begin, material_response_jacobian_end,
+                dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                mesh_displacement_perturbation_gradient_end, dUDotdU, delta_internal_heat_generation);
+
+            finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                        material_response_num_dof, velocity_index>(
+                interphasic_heat_transfer_index, material_response_jacobian_begin, material_response_jacobian_end,
+                dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                mesh_displacement_perturbation_gradient_end, dUDotdU, delta_interphasic_heat_transfer);
+
+            // The perturbations of the dof of the current phase
+            const unsigned int density_dof         = nphases * density_index + phase;
+            const unsigned int velocity_dof        = nphases * velocity_index + dim * phase;
+            const unsigned int internal_energy_dof = nphases * internal_energy_index + phase;
+            const unsigned int volume_fraction_dof = nphases * volume_fraction_index + phase;
+
+            // density
+            jvp = test_function * (dRdRho + dRdRhoDot * dRhoDotdRho) * (*(dof_perturbation_begin + density_dof));
+
+            // internal energy
+            jvp += test_function * (dRdE + dRdEDot * dEDotdE) * (*(dof_perturbation_begin + internal_energy_dof));
+
+            // volume fraction
+            jvp += test_function * dRdVolumeFraction * (*(dof_perturbation_begin + volume_fraction_dof));
+
+            // internal heat generation and interphasic heat transfer
+            jvp += test_function * (dRdr * delta_internal_heat_generation - delta_interphasic_heat_transfer);
+
+            // Cauchy stress
+            for (unsigned int j = 0; j < material_response_dim * material_response_dim; ++j) {
+                jvp += test_function * dRdCauchy[j] * delta_cauchy_stress[j];
+            }
+
+            // interphasic force and heat flux
+            for (unsigned int j = 0; j < material_response_dim; ++j) {
+                jvp += test_function * dRdpi[j] * delta_interphasic_force[j] + dRdq[j] * delta_heat_flux[j];
+            }
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                jvp += test_function * dRdGradRho[i] *
+                       (*(dof_perturbation_gradient_begin + material_response_dim * density_dof + i));
+
+                jvp += test_function * dRdGradE[i] *
+                       (*(dof_perturbation_gradient_begin + material_response_dim * internal_energy_dof + i));
+
+                // deformation dof
+                jvp += test_function * dRdV[i] * dUDotdU * (*(dof_perturbation_begin + velocity_dof + i));
+
+                for (unsigned int j = 0; j < dim; ++j) {
+                    jvp += test_function * dRdGradV[dim * i + j] * dUDotdU *
+                           (*(dof_perturbation_gradient_begin + material_response_dim * (velocity_dof + i) + j));
+                }
+            }
+
+            // mesh displacement
+            for (unsigned int a = 0; a < dim; ++a) {
+                jvp += result * (*(mesh_displacement_perturbation_gradient_begin + dim * a + a));
+
+                for (unsigned int i = 0; i < dim; ++i) {
+                    jvp -= (test_function * (dRdGradRho[i] * (*(density_gradient_begin + a)) +
+                                             dRdGradE[i] * (*(internal_energy_gradient_begin + a))) +
+                            dRdGradTestFunction[i] * (*(test_function_gradient_begin + a))) *
+                           (*(mesh_displacement_perturbation_gradient_begin + dim * a + i));
+
+                    for (unsigned int j = 0; j < dim; ++j) {
+                        jvp -= test_function * dRdGradV[dim * i + j] * (*(velocity_gradient_begin + dim * i + a)) *
+                               (*(mesh_displacement_perturbation_gradient_begin + dim * a + j));
+                    }
+                }
+            }
+        }
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class internal_energy_iter,
+                  class internal_energy_dot_iter, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename test_function_type, class test_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dRhoDotdRho_type, typename dEDotdE_type, typename dUDotdU_type, class result_iter,
+                  class jvp_iter, int density_index, int velocity_index, int internal_energy_index,
+                  int volume_fraction_index>
+        void computeBalanceOfEnergyJVP(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter                       &material_response_end,
+            const material_response_jacobian_iter              &material_response_jacobian_begin,
+            const material_response_jacobian_iter              &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const test_function_type &test_function, const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter                  &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            result_iter result_begin, result_iter result_end, jvp_iter jvp_begin, jvp_iter jvp_end) {
+            /*!
+             * Compute the full multiphase balance of energy in a variational context using a generalized material
+             * response vector and the product of its Jacobian with a perturbation of the degrees of freedom
+             *
+             * \param &density_begin: The starting iterator of the apparent density of the phases
+             * \param &density_end: The stopping iterator of the apparent density of the phases
+             * \param &density_dot_begin: The starting iterator of the partial temporal derivative of the apparent
+             * density
+             * \param &density_dot_end: The stopping iterator of the partial temporal derivative of the apparent density
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the apparent density
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the apparent density
+             * \param &internal_energy_begin: The starting iterator of the internal energy of the phases
+             * \param &internal_energy_end: The stopping iterator of the internal energy of the phases
+             * \param &internal_energy_dot_begin: The starting iterator of the partial temporal derivative of the
+             * internal energy
+             * \param &internal_energy_dot_end: The stopping iterator of the partial temporal derivative of the internal
+             * energy
+             * \param &internal_energy_gradient_begin: The starting iterator of the spatial gradient of the internal
+             * energy
+             * \param &internal_energy_gradient_end: The stopping iterator of the spatial gradient of the internal
+             * energy
+             * \param &velocity_begin: The starting iterator of the velocity of the phases
+             * \param &velocity_end: The stopping iterator of the velocity of the phases
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian
+             * \param &volume_fraction_begin: The starting iterator of the volume fractions of the phases
+             * \param &volume_fraction_end: The stopping iterator of the volume fractions of the phases
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the spatial gradient of the test function
+             * \param &test_function_gradient_end: The stopping iterator of the spatial gradient of the test function
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dof_perturbation_begin: The starting iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_end: The stopping iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_gradient_begin: The starting iterator of the spatial gradient of the
+             * perturbation of the material response dof vector
+             * \param &dof_perturbation_gradient_end: The stopping iterator of the spatial gradient of the perturbation
+             * of the material response dof vector
+             * \param &mesh_displacement_perturbation_gradient_begin: The starting iterator of the spatial gradient of
+             * the perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &mesh_displacement_perturbation_gradient_end: The stopping iterator of the spatial gradient of the
+             * perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &dRhoDotdRho: The derivative of the time rate of change of the density w.r.t. the density
+             * \param &dEDotdE: The derivative of the time rate of change of the internal energy w.r.t. the internal
+             * energy
+             * \param &dUDotdU: The derivative of the time rate of change of the spatial dof w.r.t. the spatial dof
+             * \param &result_begin: The starting iterator of the balance of energy
+             * \param &result_end: The stopping iterator of the balance of energy
+             * \param &jvp_begin: The starting iterator of the Jacobian-vector product
+             * \param &jvp_end: The stopping iterator of the Jacobian-vector product
+             */
+
+            using density_type             = typename std::iterator_traits<density_iter>::value_type;
+            using density_dot_type         = typename std::iterator_traits<density_dot_iter>::value_type;
+            using internal_energy_type     = typename std::iterator_traits<internal_energy_iter>::value_type;
+            using internal_energy_dot_type = typename std::iterator_traits<internal_energy_dot_iter>::value_type;
+            using volume_fraction_type     = typename std::iterator_traits<volume_fraction_iter>::value_type;
+            using result_type              = typename std::iterator_traits<result_iter>::value_type;
+            using jvp_type                 = typename std::iterator_traits<jvp_iter>::value_type;
+
+            const unsigned int nphases = (unsigned int)(density_end - density_begin);
+
+            const unsigned int material_response_size =
+                (unsigned int)(material_response_end - material_response_begin) / nphases;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * material_response_dim;
+
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+                                         "The density and density dot vectors must be the same size")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+                                         "The density and density gradient vectors must have consistent sizes")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+                                         "The density and internal energy vectors must be the same size")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                nphases == (unsigned int)(internal_energy_dot_end - internal_energy_dot_begin),
+                "The density and internal energy dot vectors must be the same size")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                nphases * dim == (unsigned int)(internal_energy_gradient_end - internal_energy_gradient_begin),
+                "The density and internal energy gradient vectors must have consistent sizes")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+                                         "The density and velocity vectors must have consistent sizes")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
+                                             (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
+                                         "The density and velocity gradient vectors must have consistent sizes")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+                                         "The density and volume fraction vectors must be the same size")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                nphases * material_response_size * (nphases * num_phase_dof + num_additional_dof) *
+                        (1 + material_response_dim) ==
+                    (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
+                "The material response jacobian must have a consistent size with the material response vector and the "
+                "material_response_num_dof")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * num_phase_dof + num_additional_dof ==
+                                             (unsigned int)(dof_perturbation_end - dof_perturbation_begin),
+                                         "The dof perturbation must have a consistent size with the density vector")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+                                         "The density and result vectors must be the same size")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(jvp_end - jvp_begin),
+                                         "The density and Jacobian-vector product vectors must be the same size")
+
+            for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
+                 ++v.first, ++v.second) {
+                computeBalanceOfEnergyJVP<
+                    dim, is_per_unit_volume, material_response_dim, cauchy_stress_index, internal_heat_generation_index,
+                    heat_flux_index, interphasic_force_index, interphasic_heat_transfer_index,
+                    material_response_num_dof, density_type, density_dot_type, density_gradient_iter,
+                    internal_energy_type, internal_energy_dot_type, internal_energy_gradient_iter, velocity_iter,
+                    velocity_gradient_iter, material_response_iter, material_response_jacobian_iter,
+                    volume_fraction_type, test_function_type, test_function_gradient_iter,
+                    full_material_response_dof_gradient_iter, dof_perturbation_iter, dof_perturbation_gradient_iter,
+                    mesh_displacement_perturbation_gradient_iter, dRhoDotdRho_type, dEDotdE_type, dUDotdU_type,
+                    result_type, jvp_type, density_index, velocity_index, internal_energy_index,
+                    volume_fraction_index>(
+                    *(density_begin + v.first), *(density_dot_begin + v.first), density_gradient_begin + dim * v.first,
+                    density_gradient_begin + dim * (v.first + 1), *(internal_energy_begin + v.first),
+                    *(internal_energy_dot_begin + v.first), internal_energy_gradient_begin + dim * v.first,
+                    internal_energy_gradient_begin + dim * (v.first + 1), velocity_begin + dim * v.first,
+                    velocity_begin + dim * (v.first + 1), velocity_gradient_begin + dim * dim * v.first,
+                    velocity_gradient_begin + dim * dim * (v.first + 1),
+                    material_response_begin + material_response_size * v.first,
+                    material_response_begin + material_response_size * (v.first + 1),
+                    material_response_jacobian_begin + material_response_size *
+                                                           (nphases * num_phase_dof + num_additional_dof) *
+                                                           (1 + material_response_dim) * v.first,
+                    material_response_jacobian_begin + material_response_size *
+                                                           (nphases * num_phase_dof + num_additional_dof) *
+                                                           (1 + material_response_dim) * (v.first + 1),
+                    *(volume_fraction_begin + v.first), test_function, test_function_gradient_begin,
+                    test_function_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, dof_perturbation_begin, dof_perturbation_end,
+                    dof_perturbation_gradient_begin, dof_perturbation_gradient_end,
+                    mesh_displacement_perturbation_gradient_begin, mesh_displacement_perturbation_gradient_end,
+                    dRhoDotdRho, dEDotdE, dUDotdU, v.first, *(result_begin + v.first), *(jvp_begin + v.first));
+            }
+        }
+
     }  // namespace balanceOfEnergy
 
 }  // namespace tardigradeBalanceEquations
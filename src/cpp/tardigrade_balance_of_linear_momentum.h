@@ -12,12 +12,28 @@
 
 #include <array>
 
+#include "tardigrade_error_policy.h"
 #include "tardigrade_error_tools.h"
+#include "tardigrade_finite_element_utilities.h"
+#include "tardigrade_instrumentation.h"
+#include "tardigrade_jacobian_sparsity.h"
 
 namespace tardigradeBalanceEquations {
 
     namespace balanceOfLinearMomentum {
 
+        /*!
+         * The structural sparsity of the Jacobian of the balance of linear momentum of a phase. The residual depends
+         * directly on the density, spatial degree of freedom, and volume fraction of its own phase and on everything
+         * the material response depends on.
+         */
+        template <class material_response_pattern>
+        using BalanceOfLinearMomentumSparsity = jacobianSparsity::PatternUnion<
+            jacobianSparsity::SparsityPattern<jacobianSparsity::DENSITY | jacobianSparsity::VELOCITY |
+                                                  jacobianSparsity::VOLUME_FRACTION,
+                                              0>,
+            material_response_pattern>;
+
         template <int dim, typename density_type, typename density_dot_type, class density_gradient_iter,
                   class velocity_iter, class velocity_dot_iter, class velocity_gradient_iter, class body_force_iter,
                   class result_iter>
@@ -287,6 +303,106 @@ namespace tardigradeBalanceEquations {
             dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
             dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end);
 
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, typename density_type,
+                  typename density_dot_type, class density_gradient_iter, class velocity_iter, class velocity_dot_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  typename volume_fraction_type, typename testFunction_type, class testFunctionGradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, typename dUDDotdU_type, class result_iter,
+                  class jvp_iter, int density_index = 0, int velocity_index = 4, int volume_fraction_index = 9>
+        void computeBalanceOfLinearMomentumJVP(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocity_dot_iter &velocity_dot_begin, const velocity_dot_iter &velocity_dot_end,
+            const velocity_gradient_iter &velocity_gradient_begin, const velocity_gradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const testFunction_type &test_function,
+            const testFunctionGradient_iter                    &test_function_gradient_begin,
+            const testFunctionGradient_iter                    &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const dUDDotdU_type &dUDDotdU, const unsigned int phase, result_iter result_begin, result_iter result_end,
+            jvp_iter jvp_begin, jvp_iter jvp_end);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, class material_response_pattern,
+                  typename density_type, typename density_dot_type, class density_gradient_iter, class velocity_iter,
+                  class velocity_dot_iter, class velocity_gradient_iter, class material_response_iter,
+                  class material_response_jacobian_iter, typename volume_fraction_type, typename testFunction_type,
+                  class testFunctionGradient_iter, typename interpolationFunction_type,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, typename dUDDotdU_type, class result_iter,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index = 0, int displacement_index = 1,
+                  int velocity_index = 4, int temperature_index = 7, int internal_energy_index = 8,
+                  int volume_fraction_index = 9, int additional_dof_index = 10>
+        void computeBalanceOfLinearMomentumCompressed(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocity_dot_iter &velocity_dot_begin, const velocity_dot_iter &velocity_dot_end,
+            const velocity_gradient_iter &velocity_gradient_begin, const velocity_gradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const testFunction_type &test_function,
+            const testFunctionGradient_iter                &test_function_gradient_begin,
+            const testFunctionGradient_iter                &test_function_gradient_end,
+            const interpolationFunction_type               &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const dUDDotdU_type &dUDDotdU, const unsigned int nphases, const unsigned int phase,
+            result_iter result_begin, result_iter result_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class velocity_iter, class velocity_dot_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename testFunction_type, class testFunctionGradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, typename dUDDotdU_type, class result_iter,
+                  class jvp_iter, int density_index = 0, int velocity_index = 4, int volume_fraction_index = 9>
+        void computeBalanceOfLinearMomentumJVP(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocity_dot_iter &velocity_dot_begin, const velocity_dot_iter &velocity_dot_end,
+            const velocity_gradient_iter &velocity_gradient_begin, const velocity_gradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const testFunction_type &test_function, const testFunctionGradient_iter &test_function_gradient_begin,
+            const testFunctionGradient_iter                    &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const dUDDotdU_type &dUDDotdU, result_iter result_begin, result_iter result_end, jvp_iter jvp_begin,
+            jvp_iter jvp_end);
+
     }  // namespace balanceOfLinearMomentum
 
 }  // namespace tardigradeBalanceEquations
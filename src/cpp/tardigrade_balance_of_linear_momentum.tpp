@@ -75,8 +75,8 @@ namespace tardigradeBalanceEquations {
             using grad_rho_dot_type = decltype(std::declval<density_gradient_type &>() * std::declval<velocity_type>());
             using velocity_gradient_type = typename std::iterator_traits<velocity_gradient_iter>::value_type;
 
-            grad_rho_dot_type grad_rho_dot_v =
-                std::inner_product(density_gradient_begin, density_gradient_end, velocity_begin, 0.);
+            grad_rho_dot_type grad_rho_dot_v = std::inner_product(density_gradient_begin, density_gradient_end,
+                                                                  velocity_begin, grad_rho_dot_type());
 
             // Compute the trace of the velocity gradient
             velocity_gradient_type trace_velocity_gradient = 0;
@@ -233,6 +233,10 @@ namespace tardigradeBalanceEquations {
              * \param &result_end: The stopping iterator of the non-divergence part of the balance of linear momentum
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_LINEAR_MOMENTUM_RESIDUAL,
+                costModel::getBalanceOfLinearMomentumResidualCost(dim).flops)
+
             computeBalanceOfLinearMomentum<dim>(density, density_dot, density_gradient_begin, density_gradient_end,
                                                 velocity_begin, velocity_end, velocity_dot_begin, velocity_dot_end,
                                                 velocity_gradient_begin, velocity_gradient_end,
@@ -361,6 +365,12 @@ namespace tardigradeBalanceEquations {
              * \param &dRdUMesh_end: The stopping iterator of the Jacobian of the result w.r.t. the mesh displacement
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_LINEAR_MOMENTUM_JACOBIAN,
+                costModel::getBalanceOfLinearMomentumJacobianCost(dim, (dRdRho_end - dRdRho_begin) / dim,
+                                                                  material_response_dim, material_response_num_dof)
+                    .flops)
+
             using result_type = typename std::iterator_traits<result_iter>::value_type;
 
             std::array<result_type, dim>             dRdRho_phase;
@@ -394,6 +404,12 @@ namespace tardigradeBalanceEquations {
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                CHAIN_RULE,
+                costModel::getBalanceOfLinearMomentumJacobianCost(dim, nphases, material_response_dim,
+                                                                  material_response_num_dof)
+                    .chain_rule_flops)
+
             std::fill(dRdRho_begin, dRdRho_end, 0);
             std::fill(dRdU_begin, dRdU_end, 0);
             std::fill(dRdW_begin, dRdW_end, 0);
@@ -1063,38 +1079,38 @@ namespace tardigradeBalanceEquations {
 
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The length of density dot and density must be the same")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The length of the density gradient and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
                                          "The length of the velocity and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_dot_end - velocity_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_dot_end - velocity_dot_begin),
                                          "The length of the velocity dot and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The length of the velocity gradient and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The length of the volume fraction and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (body_force_index + dim) < material_response_size,
                 "The material response vector must be larger than the body force index plus the dimension")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (cauchy_stress_index + dim * dim) < material_response_size,
                 "The material response vector must be larger than the Cauchy stress index plus the dimension squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (interphasic_force_index + dim) < material_response_size,
                 "The material response vector must be larger than the interphasic force index plus the dimension")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size * (nphases * num_phase_dof + num_additional_dof) *
                         (1 + material_response_dim) ==
                     (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
@@ -1112,38 +1128,38 @@ namespace tardigradeBalanceEquations {
                     "\n  actual jacobian size       : " +
                     std::to_string((unsigned int)(material_response_jacobian_end - material_response_jacobian_begin)))
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim == (unsigned int)(interpolation_function_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(interpolation_function_gradient_end -
                                                                interpolation_function_gradient_begin),
                                          "The interpolation function gradient must have a size of dim")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(result_end - result_begin),
                                          "The result vector must be the same size as the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * nphases * 1 == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * nphases * 1 == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "dRdRho must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * nphases * material_response_dim ==
                                              (unsigned int)(dRdU_end - dRdU_begin),
                                          "dRdU must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * nphases * material_response_dim ==
                                              (unsigned int)(dRdW_end - dRdW_begin),
                                          "dRdW must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * nphases * 1 == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * nphases * 1 == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * nphases * 1 == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * nphases * 1 == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
                                          "dRdZ must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * nphases * 1 ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * nphases * 1 ==
                                              (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "dRdVF must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "dRdUMesh must have a consistent size with the density vector")
 
             for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
@@ -1571,52 +1587,52 @@ namespace tardigradeBalanceEquations {
              * phase's residual w.r.t. the mesh displacement
              */
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int nphases = (unsigned int)(density_end - density_begin))
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int nphases = (unsigned int)(density_end - density_begin))
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and the time derivative of the density must have the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 dim * nphases == (unsigned int)(density_gradient_end - density_gradient_begin),
                 "The density and the spatial gradient of the density must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
                                          "The density and the velocity must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 dim * nphases == (unsigned int)(velocity_dot_end - velocity_dot_begin),
                 "The density and the time derivative of the velocity must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * nphases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * nphases ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and the velocity gradient must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(body_force_end - body_force_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(body_force_end - body_force_begin),
                                          "The density and the body force must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * nphases == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * nphases == (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
                                          "The density and the Cauchy stress must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The density and the volume fraction must have the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The density and dRdRho must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * dim == (unsigned int)(dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * dim == (unsigned int)(dRdU_end - dRdU_begin),
                                          "The density and dRdU must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * dim == (unsigned int)(dRdB_end - dRdB_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * dim == (unsigned int)(dRdB_end - dRdB_begin),
                                          "The density and dRdB must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * dim * dim == (unsigned int)(dRdCauchy_end - dRdCauchy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * dim * dim == (unsigned int)(dRdCauchy_end - dRdCauchy_begin),
                                          "The density and dRdCauchy must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases ==
                                              (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "The density and dRdVolumeFraction must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The density and dRdUMesh must have consistent sizes");
 
             for (auto rho = std::pair<unsigned int, density_iter>(0, density_begin); rho.second != density_end;
@@ -1703,37 +1719,37 @@ namespace tardigradeBalanceEquations {
              * \param &result_end: The stopping iterator of the non-divergence part of the balance of linear momentum
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and the time derivative of the density must have the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 dim * (unsigned int)(density_end - density_begin) ==
                     (unsigned int)(density_gradient_end - density_gradient_begin),
                 "The density and the spatial gradient of the density must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density and the velocity must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 dim * (unsigned int)(density_end - density_begin) ==
                     (unsigned int)(velocity_dot_end - velocity_dot_begin),
                 "The density and the time derivative of the velocity must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and the velocity gradient must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(body_force_end - body_force_begin),
                                          "The density and the body force must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(cauchy_stress_end - cauchy_stress_begin),
                                          "The density and the Cauchy stress must have consistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The density and the volume fraction must have the same size");
 
@@ -1836,8 +1852,8 @@ namespace tardigradeBalanceEquations {
             using grad_rho_dot_type = decltype(std::declval<density_gradient_type &>() * std::declval<velocity_type>());
             using velocity_gradient_type = typename std::iterator_traits<velocity_gradient_iter>::value_type;
 
-            grad_rho_dot_type grad_rho_dot_v =
-                std::inner_product(density_gradient_begin, density_gradient_end, velocity_begin, 0.);
+            grad_rho_dot_type grad_rho_dot_v = std::inner_product(density_gradient_begin, density_gradient_end,
+                                                                  velocity_begin, grad_rho_dot_type());
 
             // Compute the trace of the velocity gradient
             velocity_gradient_type trace_velocity_gradient = 0;
@@ -1946,31 +1962,31 @@ namespace tardigradeBalanceEquations {
              * \param &result_end: The stopping iterator of the non-divergence part of the balance of linear momentum
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot vectors are not the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_dot_end - velocity_dot_begin),
                                          "The density and velocity dot vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(body_force_end - body_force_begin),
                                          "The density and body force vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(result_end - result_begin),
                                          "The density and result vectors are of inconsistent sizes");
 
@@ -2072,55 +2088,55 @@ namespace tardigradeBalanceEquations {
              * \param &dRdB_end: The stopping iterator of the derivative of the result w.r.t. the body force
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot vectors are not the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_dot_end - velocity_dot_begin),
                                          "The density and velocity dot vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(body_force_end - body_force_begin),
                                          "The density and body force vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(result_end - result_begin),
                                          "The density and result vectors are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The density and dRdRho are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdRhoDot_end - dRdRhoDot_begin),
                                          "The density and dRdRhoDot are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdGradRho_end - dRdGradRho_begin),
                                          "The density and dRdGradRho are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdV_end - dRdV_begin),
                                          "The density and dRdV are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdGradV_end - dRdGradV_begin),
                                          "The density and dRdGradV are of inconsistent sizes");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdB_end - dRdB_begin),
                                          "The density and dRdB are of inconsistent sizes");
 
@@ -2409,6 +2425,663 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, typename density_type,
+                  typename density_dot_type, class density_gradient_iter, class velocity_iter, class velocity_dot_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  typename volume_fraction_type, typename testFunction_type, class testFunctionGradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, typename dUDDotdU_type, class result_iter,
+                  class jvp_iter, int density_index, int velocity_index, int volume_fraction_index>
+        void computeBalanceOfLinearMomentumJVP(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocity_dot_iter &velocity_dot_begin, const velocity_dot_iter &velocity_dot_end,
+            const velocity_gradient_iter &velocity_gradient_begin, const velocity_gradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const testFunction_type &test_function,
+            const testFunctionGradient_iter                    &test_function_gradient_begin,
+            const testFunctionGradient_iter                    &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const dUDDotdU_type &dUDDotdU, const unsigned int phase, result_iter result_begin, result_iter result_end,
+            jvp_iter jvp_begin, jvp_iter jvp_end) {
+            /*!
+             * Compute the balance of linear momentum including the inter-phasic force and the product of its Jacobian
+             * with a perturbation of the degrees of freedom (a Jacobian-vector product). The product is formed
+             * through the same chain rule as the Jacobians of the dense overload so that the Jacobian never needs to
+             * be stored.
+             *
+             * The perturbation is provided in the layout of the material response dof vector and is expected to
+             * already be interpolated to the evaluation point. The velocity block of the perturbation is the
+             * perturbation of the spatial dof (i.e., it is scaled by dUDotdU here).
+             *
+             * material_response_dim: The spatial dimension of the material response
+             * body_force_index: The index of the material response vector where the body force is located
+             * cauchy_stress_index: The index of the material response vector where the cauchy stress force is located
+             * interphasic_force_index: The index of the material response vector where the net interphasic force is
+             * located
+             *
+             * \param &density: The mass density per unit current volume \f$ \left( \rho \right) \f$
+             * \param &density_dot: The partial time derivative of the density \f$ \left( \frac{\partial}{\partial t}
+             * \rho \right) \f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the density \f$ \left(
+             * \rho_{,i} \right) \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the density \f$ \left(
+             * \rho_{,i} \right) \f$
+             * \param &velocity_begin: The starting iterator of the velocity \f$ \left( v_i \right) \f$
+             * \param &velocity_end: The stopping iterator of the velocity \f$ \left( v_i \right) \f$
+             * \param &velocity_dot_begin: The starting iterator of the partial time derivative of the velocity \f$
+             * \left( \frac{\partial}{\partial t} v_i \right) \f$
+             * \param &velocity_dot_end: The stopping iterator of the partial time derivative of the velocity \f$ \left(
+             * \frac{\partial}{\partial t} v_i \right) \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity \f$ \left(
+             * v_{i,j} \right) \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity \f$ \left(
+             * v_{i,j} \right) \f$
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response vector Jacobian
+             * \param &material_response_jacobian_end: The stopping iterator of the material response vector Jacobian
+             * \param &volume_fraction: The volume fraction of the phase
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the gradient of the test function \f$
+             * \left( \psi_{,i} \right) \f$
+             * \param &test_function_gradient_end: The stopping iterator of the gradient of the test function \f$ \left(
+             * \psi_{,i} \right) \f$
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dof_perturbation_begin: The starting iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_end: The stopping iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_gradient_begin: The starting iterator of the spatial gradient of the
+             * perturbation of the material response dof vector
+             * \param &dof_perturbation_gradient_end: The stopping iterator of the spatial gradient of the perturbation
+             * of the material response dof vector
+             * \param &mesh_displacement_perturbation_gradient_begin: The starting iterator of the spatial gradient of
+             * the perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &mesh_displacement_perturbation_gradient_end: The stopping iterator of the spatial gradient of the
+             * perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &dDensityDotdDensity: The total derivative of the time derivative of the density w.r.t. the
+             * density
+             * \param &dUDotdU: The total derivative of the time derivative of the spatial dof w.r.t. the spatial dof (1
+             * if the spatial DOF is the velocity)
+             * \param &dUDDotdU: The total derivative of the second time derivative of the spatial dof w.r.t. the
+             * spatial dof
+             * \param &phase: The phase the balance equation applies to
+             * \param &result_begin: The starting iterator of the balance of linear momentum
+             * \param &result_end: The stopping iterator of the balance of linear momentum
+             * \param &jvp_begin: The starting iterator of the Jacobian-vector product
+             * \param &jvp_end: The stopping iterator of the Jacobian-vector product
+             */
+
+            using result_type = typename std::iterator_traits<result_iter>::value_type;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int nphases =
+                ((unsigned int)(dof_perturbation_end - dof_perturbation_begin) - num_additional_dof) / num_phase_dof;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(result_end - result_begin),
+                                         "The result must have a size of dim")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(jvp_end - jvp_begin),
+                                         "The Jacobian-vector product must have a size of dim")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            std::array<result_type, dim> non_divergence_result;
+            std::array<result_type, dim> divergence_result;
+
+            std::array<result_type, dim>             dNonDivRdRho;
+            std::array<result_type, dim>             dNonDivRdRhoDot;
+            std::array<result_type, dim * dim>       dNonDivRdGradRho;
+            std::array<result_type, dim * dim>       dNonDivRdV;
+            std::array<result_type, dim * dim>       dNonDivRdVDot;
+            std::array<result_type, dim * dim * dim> dNonDivRdGradV;
+            std::array<result_type, dim * dim>       dNonDivRdB;
+
+            std::array<result_type, dim * dim>       dDivRdGradPsi;
+            std::array<result_type, dim * dim * dim> dDivRdCauchy;
+            std::array<result_type, dim>             dDivRdVolumeFraction;
+
+            computeBalanceOfLinearMomentumNonDivergence<dim>(
+                density, density_dot, density_gradient_begin, density_gradient_end, velocity_begin, velocity_end,
+                velocity_dot_begin, velocity_dot_end, velocity_gradient_begin, velocity_gradient_end,
+                material_response_begin + body_force_index,
+                material_response_begin + body_force_index + material_response_dim,
+                std::begin(non_divergence_result), std::end(non_divergence_result), std::begin(dNonDivRdRho),
+                std::end(dNonDivRdRho), std::begin(dNonDivRdRhoDot), std::end(dNonDivRdRhoDot),
+                std::begin(dNonDivRdGradRho), std::end(dNonDivRdGradRho), std::begin(dNonDivRdV), std::end(dNonDivRdV),
+                std::begin(dNonDivRdVDot), std::end(dNonDivRdVDot), std::begin(dNonDivRdGradV),
+                std::end(dNonDivRdGradV), std::begin(dNonDivRdB), std::end(dNonDivRdB));
+
+            computeBalanceOfLinearMomentumDivergence<dim>(
+                test_function_gradient_begin, test_function_gradient_end, material_response_begin + cauchy_stress_index,
+                material_response_begin + cauchy_stress_index + material_response_dim * material_response_dim,
+                volume_fraction, std::begin(divergence_result), std::end(divergence_result), std::begin(dDivRdGradPsi),
+                std::end(dDivRdGradPsi), std::begin(dDivRdCauchy), std::end(dDivRdCauchy),
+                std::begin(dDivRdVolumeFraction), std::end(dDivRdVolumeFraction));
+
+            // Directional derivatives of the material response
+            std::array<result_type, dim>       delta_body_force;
+            std::array<result_type, dim * dim> delta_cauchy_stress;
+            std::array<result_type, dim>       delta_interphasic_force;
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                            material_response_num_dof, velocity_index>(
+                    body_force_index + i, material_response_jacobian_begin, material_response_jacobian_end,
+                    dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                    dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                    mesh_displacement_perturbation_gradient_end, dUDotdU, delta_body_force[i]);
+
+                finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                            material_response_num_dof, velocity_index>(
+                    interphasic_force_index + i, material_response_jacobian_begin, material_response_jacobian_end,
+                    dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                    dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                    mesh_displacement_perturbation_gradient_end, dUDotdU, delta_interphasic_force[i]);
+            }
+
+            for (unsigned int j = 0; j < dim * dim; ++j) {
+                finiteElement::computeMaterialResponseDirectionalDerivative<material_response_dim,
+                                                                            material_response_num_dof, velocity_index>(
+                    cauchy_stress_index + j, material_response_jacobian_begin, material_response_jacobian_end,
+                    dof_perturbation_begin, dof_perturbation_end, dof_perturbation_gradient_begin,
+                    dof_perturbation_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, mesh_displacement_perturbation_gradient_begin,
+                    mesh_displacement_perturbation_gradient_end, dUDotdU, delta_cauchy_stress[j]);
+            }
+
+            // The perturbations of the dof of the current phase
+            const unsigned int density_dof         = nphases * density_index + phase;
+            const unsigned int velocity_dof        = nphases * velocity_index + dim * phase;
+            const unsigned int volume_fraction_dof = nphases * volume_fraction_index + phase;
+
+            result_type mesh_displacement_perturbation_divergence = result_type();
+            for (unsigned int a = 0; a < dim; ++a) {
+                mesh_displacement_perturbation_divergence +=
+                    *(mesh_displacement_perturbation_gradient_begin + dim * a + a);
+            }
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                *(result_begin + i) = test_function * non_divergence_result[i] + divergence_result[i] +
+                                      test_function * (*(material_response_begin + interphasic_force_index + i));
+
+                // density
+                *(jvp_begin + i) = test_function * (dNonDivRdRho[i] + dNonDivRdRhoDot[i] * dDensityDotdDensity) *
+                                   (*(dof_perturbation_begin + density_dof));
+
+                // volume fraction
+                *(jvp_begin + i) += dDivRdVolumeFraction[i] * (*(dof_perturbation_begin + volume_fraction_dof));
+
+                // interphasic force
+                *(jvp_begin + i) += test_function * delta_interphasic_force[i];
+
+                // change in volume of the mesh
+                *(jvp_begin + i) += (*(result_begin + i)) * mesh_displacement_perturbation_divergence;
+
+                for (unsigned int j = 0; j < dim; ++j) {
+                    *(jvp_begin + i) +=
+                        test_function * dNonDivRdGradRho[dim * i + j] *
+                        (*(dof_perturbation_gradient_begin + material_response_dim * density_dof + j));
+
+                    *(jvp_begin + i) += test_function *
+                                        (dNonDivRdV[dim * i + j] * dUDotdU + dNonDivRdVDot[dim * i + j] * dUDDotdU) *
+                                        (*(dof_perturbation_begin + velocity_dof + j));
+
+                    // body force
+                    *(jvp_begin + i) += test_function * dNonDivRdB[dim * i + j] * delta_body_force[j];
+
+                    for (unsigned int k = 0; k < dim; ++k) {
+                        *(jvp_begin + i) +=
+                            test_function * dNonDivRdGradV[dim * dim * i + dim * j + k] * dUDotdU *
+                            (*(dof_perturbation_gradient_begin + material_response_dim * (velocity_dof + j) + k));
+
+                        // mesh displacement
+                        *(jvp_begin + i) -=
+                            (test_function * dNonDivRdGradRho[dim * i + j] * (*(density_gradient_begin + k)) +
+                             dDivRdGradPsi[dim * i + j] * (*(test_function_gradient_begin + k))) *
+                            (*(mesh_displacement_perturbation_gradient_begin + dim * k + j));
+
+                        for (unsigned int a = 0; a < dim; ++a) {
+                            *(jvp_begin + i) -= test_function * dNonDivRdGradV[dim * dim * i + dim * j + k] *
+                                                (*(velocity_gradient_begin + dim * j + a)) *
+                                                (*(mesh_displacement_perturbation_gradient_begin + dim * a + k));
+                        }
+                    }
+                }
+
+                // Cauchy stress
+                for (unsigned int j = 0; j < dim * dim; ++j) {
+                    *(jvp_begin + i) += dDivRdCauchy[dim * dim * i + j] * delta_cauchy_stress[j];
+                }
+            }
+        }
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, class material_response_pattern,
+                  typename density_type, typename density_dot_type, class density_gradient_iter, class velocity_iter,
+                  class velocity_dot_iter, class velocity_gradient_iter, class material_response_iter,
+                  class material_response_jacobian_iter, typename volume_fraction_type, typename testFunction_type,
+                  class testFunctionGradient_iter, typename interpolationFunction_type,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, typename dUDDotdU_type, class result_iter,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index, int displacement_index,
+                  int velocity_index, int temperature_index, int internal_energy_index, int volume_fraction_index,
+                  int additional_dof_index>
+        void computeBalanceOfLinearMomentumCompressed(
+            const density_type &density, const density_dot_type &density_dot,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocity_dot_iter &velocity_dot_begin, const velocity_dot_iter &velocity_dot_end,
+            const velocity_gradient_iter &velocity_gradient_begin, const velocity_gradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_type &volume_fraction, const testFunction_type &test_function,
+            const testFunctionGradient_iter                &test_function_gradient_begin,
+            const testFunctionGradient_iter                &test_function_gradient_end,
+            const interpolationFunction_type               &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const dUDDotdU_type &dUDDotdU, const unsigned int nphases, const unsigned int phase,
+            result_iter result_begin, result_iter result_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end) {
+            /*!
+             * Compute the balance of linear momentum including the inter-phasic force and its Jacobian in compressed
+             * form. Only the columns of the structurally non-zero field blocks of
+             * BalanceOfLinearMomentumSparsity< material_response_pattern > are stored, computed, or zeroed. The
+             * layout of the columns is given by the functions of jacobianSparsity and the Jacobian is stored row-major
+             * i.e., the Jacobian of the first component of the residual is stored first.
+             *
+             * The material response Jacobian is assumed to be zero outside of material_response_pattern. If the
+             * pattern is jacobianSparsity::DensePattern the result is identical to the dense overload.
+             *
+             * material_response_dim: The spatial dimension of the material response
+             * body_force_index: The index of the material response vector where the body force is located
+             * cauchy_stress_index: The index of the material response vector where the cauchy stress force is located
+             * interphasic_force_index: The index of the material response vector where the net interphasic force is
+             * located
+             * material_response_num_dof: The number of degrees of freedom of a single phase and the additional
+             * degrees of freedom of the material response
+             * material_response_pattern: The structural sparsity pattern of the material response Jacobian
+             *
+             * \param &density: The mass density per unit current volume \f$ \left( \rho \right) \f$
+             * \param &density_dot: The partial time derivative of the density \f$ \left( \frac{\partial}{\partial t}
+             * \rho \right) \f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the density \f$ \left(
+             * \rho_{,i} \right) \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the density \f$ \left(
+             * \rho_{,i} \right) \f$
+             * \param &velocity_begin: The starting iterator of the velocity \f$ \left( v_i \right) \f$
+             * \param &velocity_end: The stopping iterator of the velocity \f$ \left( v_i \right) \f$
+             * \param &velocity_dot_begin: The starting iterator of the partial time derivative of the velocity \f$
+             * \left( \frac{\partial}{\partial t} v_i \right) \f$
+             * \param &velocity_dot_end: The stopping iterator of the partial time derivative of the velocity \f$ \left(
+             * \frac{\partial}{\partial t} v_i \right) \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity \f$ \left(
+             * v_{i,j} \right) \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity \f$ \left(
+             * v_{i,j} \right) \f$
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian
+             * vector
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian vector
+             * \param &volume_fraction: The volume fraction of the phase
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the gradient of the test function \f$
+             * \left( \psi_{,i} \right) \f$
+             * \param &test_function_gradient_end: The stopping iterator of the gradient of the test function \f$ \left(
+             * \psi_{,i} \right) \f$
+             * \param &interpolation_function: The value of the interpolation function \f$ \left( \phi \right) \f$
+             * \param &interpolation_function_gradient_begin: The starting iterator of the gradient of the
+             * interpolation function \f$ \left( \phi_{,i} \right) \f$
+             * \param &interpolation_function_gradient_end: The stopping iterator of the gradient of the interpolation
+             * function \f$ \left( \phi_{,i} \right) \f$
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of all
+             * of the degrees of freedom used by the material response
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of all of
+             * the degrees of freedom used by the material response
+             * \param &dDensityDotdDensity: The derivative of the time derivative of the density w.r.t. the density
+             * \param &dUDotdU: The derivative of the time derivative of the spatial dof w.r.t. the spatial dof
+             * \param &dUDDotdU: The derivative of the second time derivative of the spatial dof w.r.t. the spatial dof
+             * \param nphases: The number of phases
+             * \param phase: The phase the balance equation is being computed for
+             * \param &result_begin: The starting iterator of the balance of linear momentum
+             * \param &result_end: The stopping iterator of the balance of linear momentum
+             * \param &jacobian_begin: The starting iterator of the compressed Jacobian
+             * \param &jacobian_end: The stopping iterator of the compressed Jacobian
+             * \param &dRdUMesh_begin: The starting iterator of the Jacobian of the result w.r.t. the mesh displacement
+             * \param &dRdUMesh_end: The stopping iterator of the Jacobian of the result w.r.t. the mesh displacement
+             */
+
+            using result_type = typename std::iterator_traits<result_iter>::value_type;
+            using pattern     = BalanceOfLinearMomentumSparsity<material_response_pattern>;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            // The material response rows are the body force, the Cauchy stress, and the interphasic force
+            constexpr unsigned int num_response_rows = dim + dim * dim + dim;
+
+            const unsigned int num_dof     = nphases * num_phase_dof + num_additional_dof;
+            const unsigned int num_columns = jacobianSparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(result_end - result_begin),
+                                         "The result must have a size of dim")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of dim times the number of compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+                                         "dRdUMesh must have a size of dim * dim")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                num_dof * material_response_dim ==
+                    (unsigned int)(full_material_response_dof_gradient_end - full_material_response_dof_gradient_begin),
+                "The full material response dof gradient is inconsistent with the number of phases")
+
+            std::array<result_type, dim>             dRdRho_phase;
+            std::array<result_type, dim * dim>       dRdU_phase;
+            std::array<result_type, dim * dim>       dRdB_phase;
+            std::array<result_type, dim * dim * dim> dRdCauchy_phase;
+            std::array<result_type, dim>             dRdVF_phase;
+
+            computeBalanceOfLinearMomentum<dim>(
+                density, density_dot, density_gradient_begin, density_gradient_end, velocity_begin, velocity_end,
+                velocity_dot_begin, velocity_dot_end, velocity_gradient_begin, velocity_gradient_end,
+                material_response_begin + body_force_index,
+                material_response_begin + body_force_index + material_response_dim,
+                material_response_begin + cauchy_stress_index,
+                material_response_begin + cauchy_stress_index + material_response_dim * material_response_dim,
+                volume_fraction, test_function, test_function_gradient_begin, test_function_gradient_end,
+                interpolation_function, interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                dDensityDotdDensity, dUDotdU, dUDDotdU, result_begin, result_end, std::begin(dRdRho_phase),
+                std::end(dRdRho_phase), std::begin(dRdU_phase), std::end(dRdU_phase), std::begin(dRdB_phase),
+                std::end(dRdB_phase), std::begin(dRdCauchy_phase), std::end(dRdCauchy_phase), std::begin(dRdVF_phase),
+                std::end(dRdVF_phase), dRdUMesh_begin, dRdUMesh_end);
+
+            // Add the contribution from the interphasic force
+            for (unsigned int i = 0; i < dim; ++i) {
+                *(result_begin + i) += test_function * (*(material_response_begin + interphasic_force_index + i));
+
+                for (unsigned int a = 0; a < dim; ++a) {
+                    *(dRdUMesh_begin + dim * i + a) += test_function *
+                                                       (*(material_response_begin + interphasic_force_index + i)) *
+                                                       (*(interpolation_function_gradient_begin + a));
+                }
+            }
+
+            // The material response rows and their coefficients in each component of the residual
+            std::array<unsigned int, num_response_rows> response_rows;
+            std::array<result_type, dim * num_response_rows> response_coefficients;
+
+            for (unsigned int j = 0; j < dim; ++j) {
+                response_rows[j]                  = body_force_index + j;
+                response_rows[dim + dim * dim + j] = interphasic_force_index + j;
+            }
+
+            for (unsigned int j = 0; j < dim * dim; ++j) {
+                response_rows[dim + j] = cauchy_stress_index + j;
+            }
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                for (unsigned int j = 0; j < dim; ++j) {
+                    response_coefficients[num_response_rows * i + j] = dRdB_phase[dim * i + j];
+                    response_coefficients[num_response_rows * i + dim + dim * dim + j] =
+                        (i == j) ? result_type(test_function) : result_type();
+                }
+
+                for (unsigned int j = 0; j < dim * dim; ++j) {
+                    response_coefficients[num_response_rows * i + dim + j] = dRdCauchy_phase[dim * dim * i + j];
+                }
+            }
+
+            const std::array<unsigned int, jacobianSparsity::num_field_blocks> field_indices = {
+                density_index,         velocity_index,        displacement_index,  temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index};
+
+            std::fill(jacobian_begin, jacobian_end, result_type());
+
+            jacobianSparsity::addMaterialResponseJacobian<pattern, material_response_pattern, dim,
+                                                          material_response_dim, num_response_rows>(
+                nphases, num_additional_dof, phase, field_indices, std::cbegin(response_rows),
+                std::cend(response_rows), std::cbegin(response_coefficients), std::cend(response_coefficients),
+                material_response_jacobian_begin, material_response_jacobian_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dUDotdU,
+                jacobian_begin, jacobian_end, dRdUMesh_begin, dRdUMesh_end);
+
+            // Direct dependence on the dof of the current phase
+            const unsigned int density_column = jacobianSparsity::getPhaseFieldOffset<pattern>(
+                jacobianSparsity::DENSITY, dim, nphases, num_additional_dof, phase);
+            const unsigned int velocity_column = jacobianSparsity::getPhaseFieldOffset<pattern>(
+                jacobianSparsity::VELOCITY, dim, nphases, num_additional_dof, phase);
+            const unsigned int volume_fraction_column = jacobianSparsity::getPhaseFieldOffset<pattern>(
+                jacobianSparsity::VOLUME_FRACTION, dim, nphases, num_additional_dof, phase);
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                *(jacobian_begin + num_columns * i + density_column) += dRdRho_phase[i];
+
+                for (unsigned int k = 0; k < dim; ++k) {
+                    *(jacobian_begin + num_columns * i + velocity_column + k) += dRdU_phase[dim * i + k];
+                }
+
+                *(jacobian_begin + num_columns * i + volume_fraction_column) += dRdVF_phase[i] * interpolation_function;
+            }
+        }
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class velocity_iter, class velocity_dot_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename testFunction_type, class testFunctionGradient_iter,
+                  class full_material_response_dof_gradient_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class mesh_displacement_perturbation_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, typename dUDDotdU_type, class result_iter,
+                  class jvp_iter, int density_index, int velocity_index, int volume_fraction_index>
+        void computeBalanceOfLinearMomentumJVP(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocity_dot_iter &velocity_dot_begin, const velocity_dot_iter &velocity_dot_end,
+            const velocity_gradient_iter &velocity_gradient_begin, const velocity_gradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const testFunction_type &test_function, const testFunctionGradient_iter &test_function_gradient_begin,
+            const testFunctionGradient_iter                    &test_function_gradient_end,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter     &full_material_response_dof_gradient_end,
+            const dof_perturbation_iter                        &dof_perturbation_begin,
+            const dof_perturbation_iter                        &dof_perturbation_end,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter               &dof_perturbation_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const dUDDotdU_type &dUDDotdU, result_iter result_begin, result_iter result_end, jvp_iter jvp_begin,
+            jvp_iter jvp_end) {
+            /*!
+             * Compute the multiphase balance of linear momentum including the inter-phasic force and the product of
+             * its Jacobian with a perturbation of the degrees of freedom
+             *
+             * material_response_dim: The spatial dimension of the material response
+             * body_force_index: The index of the material response vector where the body force is located
+             * cauchy_stress_index: The index of the material response vector where the cauchy stress force is located
+             * interphasic_force_index: The index of the material response vector where the net interphasic force is
+             * located
+             *
+             * \param &density_begin: The starting iterator of the mass density per unit current volume \f$ \left( \rho
+             * \right) \f$
+             * \param &density_end: The stopping iterator of the mass density per unit current volume \f$ \left( \rho
+             * \right) \f$
+             * \param &density_dot_begin: The starting iterator of the partial time derivative of the density \f$
+             * \left( \frac{\partial}{\partial t} \rho \right) \f$
+             * \param &density_dot_end: The stopping iterator of the partial time derivative of the density \f$ \left(
+             * \frac{\partial}{\partial t} \rho \right) \f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the density \f$ \left(
+             * \rho_{,i} \right) \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the density \f$ \left(
+             * \rho_{,i} \right) \f$
+             * \param &velocity_begin: The starting iterator of the velocity \f$ \left( v_i \right) \f$
+             * \param &velocity_end: The stopping iterator of the velocity \f$ \left( v_i \right) \f$
+             * \param &velocity_dot_begin: The starting iterator of the partial time derivative of the velocity \f$
+             * \left( \frac{\partial}{\partial t} v_i \right) \f$
+             * \param &velocity_dot_end: The stopping iterator of the partial time derivative of the velocity \f$ \left(
+             * \frac{\partial}{\partial t} v_i \right) \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity \f$ \left(
+             * v_{i,j} \right) \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity \f$ \left(
+             * v_{i,j} \right) \f$
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response vector Jacobian
+             * \param &material_response_jacobian_end: The stopping iterator of the material response vector Jacobian
+             * \param &volume_fraction_begin: The starting iterator of the volume fractions of the phases
+             * \param &volume_fraction_end: The stopping iterator of the volume fractions of the phases
+             * \param &test_function: The value of the test function \f$ \left( \psi \right) \f$
+             * \param &test_function_gradient_begin: The starting iterator of the gradient of the test function \f$
+             * \left( \psi_{,i} \right) \f$
+             * \param &test_function_gradient_end: The stopping iterator of the gradient of the test function \f$ \left(
+             * \psi_{,i} \right) \f$
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dof_perturbation_begin: The starting iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_end: The stopping iterator of the perturbation of the material response dof
+             * vector
+             * \param &dof_perturbation_gradient_begin: The starting iterator of the spatial gradient of the
+             * perturbation of the material response dof vector
+             * \param &dof_perturbation_gradient_end: The stopping iterator of the spatial gradient of the perturbation
+             * of the material response dof vector
+             * \param &mesh_displacement_perturbation_gradient_begin: The starting iterator of the spatial gradient of
+             * the perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &mesh_displacement_perturbation_gradient_end: The stopping iterator of the spatial gradient of the
+             * perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+             * \param &dDensityDotdDensity: The total derivative of the time derivative of the density w.r.t. the
+             * density
+             * \param &dUDotdU: The total derivative of the time derivative of the spatial dof w.r.t. the spatial dof (1
+             * if the spatial DOF is the velocity)
+             * \param &dUDDotdU: The total derivative of the second time derivative of the spatial dof w.r.t. the
+             * spatial dof
+             * \param &result_begin: The starting iterator of the balance of linear momentum
+             * \param &result_end: The stopping iterator of the balance of linear momentum
+             * \param &jvp_begin: The starting iterator of the Jacobian-vector product
+             * \param &jvp_end: The stopping iterator of the Jacobian-vector product
+             */
+
+            using density_type         = typename std::iterator_traits<density_iter>::value_type;
+            using density_dot_type     = typename std::iterator_traits<density_dot_iter>::value_type;
+            using volume_fraction_type = typename std::iterator_traits<volume_fraction_iter>::value_type;
+
+            const unsigned int nphases = (unsigned int)(density_end - density_begin);
+
+            const unsigned int material_response_size =
+                (unsigned int)(material_response_end - material_response_begin) / nphases;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * material_response_dim;
+
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+                                         "The length of density dot and density must be the same")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+                                         "The length of the density gradient and the density must be consistent")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+                                         "The length of the velocity and the density must be consistent")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_dot_end - velocity_dot_begin),
+                                         "The length of the velocity dot and the density must be consistent")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
+                                             (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
+                                         "The length of the velocity gradient and the density must be consistent")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+                                         "The length of the volume fraction and the density must be consistent")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                nphases * material_response_size * (nphases * num_phase_dof + num_additional_dof) *
+                        (1 + material_response_dim) ==
+                    (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
+                "The material response jacobian must have a consistent size with the material response vector and the "
+                "material_response_num_dof")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * num_phase_dof + num_additional_dof ==
+                                             (unsigned int)(dof_perturbation_end - dof_perturbation_begin),
+                                         "The dof perturbation must have a consistent size with the density vector")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(result_end - result_begin),
+                                         "The result vector must be the same size as the density vector")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(jvp_end - jvp_begin),
+                                         "The Jacobian-vector product must be the same size as the result vector")
+
+            for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
+                 ++v.first, ++v.second) {
+                computeBalanceOfLinearMomentumJVP<
+                    dim, material_response_dim, body_force_index, cauchy_stress_index, interphasic_force_index,
+                    material_response_num_dof, density_type, density_dot_type, density_gradient_iter, velocity_iter,
+                    velocity_dot_iter, velocity_gradient_iter, material_response_iter, material_response_jacobian_iter,
+                    volume_fraction_type, testFunction_type, testFunctionGradient_iter,
+                    full_material_response_dof_gradient_iter, dof_perturbation_iter, dof_perturbation_gradient_iter,
+                    mesh_displacement_perturbation_gradient_iter, dDensityDotdDensity_type, dUDotdU_type,
+                    dUDDotdU_type, result_iter, jvp_iter, density_index, velocity_index, volume_fraction_index>(
+                    *(density_begin + v.first), *(density_dot_begin + v.first), density_gradient_begin + dim * v.first,
+                    density_gradient_begin + dim * (v.first + 1), velocity_begin + dim * v.first,
+                    velocity_begin + dim * (v.first + 1), velocity_dot_begin + dim * v.first,
+                    velocity_dot_begin + dim * (v.first + 1), velocity_gradient_begin + dim * dim * v.first,
+                    velocity_gradient_begin + dim * dim * (v.first + 1),
+                    material_response_begin + material_response_size * v.first,
+                    material_response_begin + material_response_size * (v.first + 1),
+                    material_response_jacobian_begin + material_response_size *
+                                                           (nphases * num_phase_dof + num_additional_dof) *
+                                                           (1 + material_response_dim) * v.first,
+                    material_response_jacobian_begin + material_response_size *
+                                                           (nphases * num_phase_dof + num_additional_dof) *
+                                                           (1 + material_response_dim) * (v.first + 1),
+                    *(volume_fraction_begin + v.first), test_function, test_function_gradient_begin,
+                    test_function_gradient_end, full_material_response_dof_gradient_begin,
+                    full_material_response_dof_gradient_end, dof_perturbation_begin, dof_perturbation_end,
+                    dof_perturbation_gradient_begin, dof_perturbation_gradient_end,
+                    mesh_displacement_perturbation_gradient_begin, mesh_displacement_perturbation_gradient_end,
+                    dDensityDotdDensity, dUDotdU, dUDDotdU, v.first, result_begin + dim * v.first,
+                    result_begin + dim * (v.first + 1), jvp_begin + dim * v.first, jvp_begin + dim * (v.first + 1));
+            }
+        }
+
     }  // namespace balanceOfLinearMomentum
 
 }  // namespace tardigradeBalanceEquations
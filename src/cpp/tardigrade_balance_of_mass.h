@@ -12,10 +12,19 @@
 #include <array>
 
 #define USE_EIGEN
+#include "tardigrade_error_policy.h"
 #include "tardigrade_error_tools.h"
+#include "tardigrade_instrumentation.h"
+#include "tardigrade_jacobian_sparsity.h"
 
 namespace tardigradeBalanceEquations {
 
+    namespace threadPool {
+
+        class ThreadPool;  //!< The thread pool the phases of the multiphase overloads may be distributed over
+
+    }  // namespace threadPool
+
     namespace balanceOfMass {
 
         constexpr unsigned int global_dim = 3;  //!< Set the dimension as 3D by default
@@ -29,6 +38,16 @@ namespace tardigradeBalanceEquations {
 
         typedef std::array<floatType, global_sot_dim> secondOrderTensor;  //!< Define a standard second-order tensor
 
+        /*!
+         * The structural sparsity of the Jacobian of the balance of mass of a phase. The residual depends directly on
+         * the density and spatial degree of freedom of its own phase and on everything the material response depends
+         * on.
+         */
+        template <class material_response_pattern>
+        using BalanceOfMassSparsity = jacobianSparsity::PatternUnion<
+            jacobianSparsity::SparsityPattern<jacobianSparsity::DENSITY | jacobianSparsity::VELOCITY, 0>,
+            material_response_pattern>;
+
         inline void computeBalanceOfMass(const floatType &density, const floatType &density_dot,
                                          const floatVector &density_gradient, const floatVector &velocity,
                                          const secondOrderTensor &velocity_gradient, floatType &result);
@@ -211,7 +230,7 @@ namespace tardigradeBalanceEquations {
                   typename dUDotdU_type, int density_index = 0, int displacement_index = 1, int velocity_index = 4,
                   int temperature_index = 7, int internal_energy_index = 8, int volume_fraction_index = 9,
                   int additional_dof_index = 10>
-        inline void computeBalanceOfMass(
+        void computeBalanceOfMass(
             const density_iter &density_begin, const density_iter &density_end,
             const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
             const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
@@ -232,6 +251,119 @@ namespace tardigradeBalanceEquations {
             dRdVF_iter dRdVF_end, dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin,
             dRdUMesh_iter dRdUMesh_end);
 
+        // Defined in tardigrade_phase_parallel.h which provides the thread pool
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  class density_iter, class densityDot_iter, class result_iter, typename testFunction_type,
+                  typename interpolationFunction_type, class densityGradient_iter, class velocity_iter,
+                  class velocityGradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  class dRdRho_iter, class dRdU_iter, class dRdW_iter, class dRdTheta_iter, class dRdE_iter,
+                  class dRdVF_iter, class dRdZ_iter, class dRdUMesh_iter, typename dDensityDotdDensity_type,
+                  typename dUDotdU_type, int density_index = 0, int displacement_index = 1, int velocity_index = 4,
+                  int temperature_index = 7, int internal_energy_index = 8, int volume_fraction_index = 9,
+                  int additional_dof_index = 10>
+        void computeBalanceOfMass(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const testFunction_type &test_function, const interpolationFunction_type &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU, result_iter result_begin,
+            result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end, dRdU_iter dRdU_begin,
+            dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
+            dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end, dRdVF_iter dRdVF_begin,
+            dRdVF_iter dRdVF_end, dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin,
+            dRdUMesh_iter dRdUMesh_end, threadPool::ThreadPool *pool);
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  class density_iter, class densityDot_iter, class result_iter, typename testFunction_type,
+                  typename interpolationFunction_type, class densityGradient_iter, class velocity_iter,
+                  class velocityGradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  class dRdRho_iter, class dRdU_iter, class dRdW_iter, class dRdTheta_iter, class dRdE_iter,
+                  class dRdVF_iter, class dRdZ_iter, class dRdUMesh_iter, typename dDensityDotdDensity_type,
+                  typename dUDotdU_type, int density_index = 0, int displacement_index = 1, int velocity_index = 4,
+                  int temperature_index = 7, int internal_energy_index = 8, int volume_fraction_index = 9,
+                  int additional_dof_index = 10, class phase_loop_type>
+        void computeBalanceOfMassPhaseLoop(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const testFunction_type &test_function, const interpolationFunction_type &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU, result_iter result_begin,
+            result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end, dRdU_iter dRdU_begin,
+            dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
+            dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end, dRdVF_iter dRdVF_begin,
+            dRdVF_iter dRdVF_end, dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin,
+            dRdUMesh_iter dRdUMesh_end, phase_loop_type phase_loop);
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  class material_response_pattern, typename density_type, typename densityDot_type,
+                  typename result_type, typename testFunction_type, typename interpolationFunction_type,
+                  class densityGradient_iter, class velocity_iter, class velocityGradient_iter,
+                  class material_response_iter, class material_response_jacobian_iter,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, class jacobian_iter, class dRdUMesh_iter,
+                  int density_index = 0, int displacement_index = 1, int velocity_index = 4, int temperature_index = 7,
+                  int internal_energy_index = 8, int volume_fraction_index = 9, int additional_dof_index = 10>
+        void computeBalanceOfMassCompressed(
+            const density_type &density, const densityDot_type &density_dot,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const testFunction_type &test_function, const interpolationFunction_type &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const unsigned int nphases, const unsigned int phase, result_type &result, jacobian_iter jacobian_begin,
+            jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end);
+
+        template <int dim, int nphases, class density_iter, class densityDot_iter, class densityGradient_iter,
+                  class velocity_iter, class velocityGradient_iter, class result_iter>
+        void computeBalanceOfMassPhaseBatched(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            result_iter result_begin, result_iter result_end);
+
+        template <int dim, int nphases, class density_iter, class densityDot_iter, class densityGradient_iter,
+                  class velocity_iter, class velocityGradient_iter, class result_iter, class dRdRho_iter,
+                  class dRdRhoDot_iter, class dRdGradRho_iter, class dRdV_iter, class dRdGradV_iter>
+        void computeBalanceOfMassPhaseBatched(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            result_iter result_begin, result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end,
+            dRdRhoDot_iter dRdRhoDot_begin, dRdRhoDot_iter dRdRhoDot_end, dRdGradRho_iter dRdGradRho_begin,
+            dRdGradRho_iter dRdGradRho_end, dRdV_iter dRdV_begin, dRdV_iter dRdV_end, dRdGradV_iter dRdGradV_begin,
+            dRdGradV_iter dRdGradV_end);
+
         template <int diffusion_index, typename result_type, class testFunctionGradient_iter,
                   class material_response_iter>
         inline void computeDiffusionTerm(const material_response_iter    &material_response_begin,
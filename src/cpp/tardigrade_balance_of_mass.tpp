@@ -102,11 +102,11 @@ namespace tardigradeBalanceEquations {
              * \param &result: The net mass change per unit volume \f$ c \f$
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_gradient_end - density_gradient_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_gradient_end - density_gradient_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density gradient and the velocity must have the same size");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(velocity_gradient_end - velocity_gradient_begin) == dim * dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(velocity_gradient_end - velocity_gradient_begin) == dim * dim,
                                          "The velocity gradient has a size of " +
                                              std::to_string((unsigned int)(velocity_gradient_end -
                                                                            velocity_gradient_begin)) +
@@ -372,23 +372,23 @@ namespace tardigradeBalanceEquations {
              * \param &result_end: The stopping iterator of the net mass change per unit volume \f$ c \f$
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(result_end - result_begin),
                                          "The density and result arrays must be the same length");
 
@@ -514,43 +514,43 @@ namespace tardigradeBalanceEquations {
              * gradient of the velocity \f$ v_{i,j} \f$
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(result_end - result_begin),
                                          "The density and result arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The density and dRdRho arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdRhoDot_end - dRdRhoDot_begin),
                                          "The density and dRdRhoDot arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdGradRho_end - dRdGradRho_begin),
                                          "The density and dRdGradRho arrays must have consistent lengths");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdV_end - dRdV_begin),
                                          "The density and dRdV arrays must have consistent lengths");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdGradV_end - dRdGradV_begin),
                                          "The density and dRdGradV arrays must have consistent lengths");
 
@@ -648,44 +648,44 @@ namespace tardigradeBalanceEquations {
              * displacement in that order
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient arrays are of inconsistent length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(result_end - result_begin),
                                          "The density and result arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dDensityDotdDensity_end - dDensityDotdDensity_begin),
                                          "The density and the derivative of the density time derivative w.r.t. the "
                                          "density must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (unsigned int)(density_end - density_begin) == (unsigned int)(dUDotdU_end - dUDotdU_begin),
                 "The density and the derivative of the dof time derivative w.r.t. the dof must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The density and dRdRho arrays must be the same length");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdU_end - dRdU_begin),
                                          "The density and dRdU arrays must have consistent lengths");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * (unsigned int)(density_end - density_begin) ==
                                              (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The density and dRdUMesh arrays must have consistent lengths");
 
@@ -743,6 +743,10 @@ namespace tardigradeBalanceEquations {
              * \param &result: The net mass change per unit volume \f$ c \f$
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_MASS_RESIDUAL,
+                costModel::getBalanceOfMassResidualCost(dim).flops)
+
             // Compute the non-mass change parts of the balance of mass
             computeBalanceOfMass<dim>(density, density_dot, density_gradient_begin, density_gradient_end,
                                       velocity_begin, velocity_end, velocity_gradient_begin, velocity_gradient_end,
@@ -798,25 +802,25 @@ namespace tardigradeBalanceEquations {
             const unsigned int material_response_size =
                 (unsigned int)(material_response_end - material_response_begin) / num_phases;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(num_phases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(num_phases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The density and density dot arrays must have the same length")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * num_phases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * num_phases ==
                                              (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The density and density gradient arrays must have consistent lengths")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * num_phases == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * num_phases == (unsigned int)(velocity_end - velocity_begin),
                                          "The density and velocity arrays must have consistent lengths")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * dim * num_phases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * dim * num_phases ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The density and velocity gradient arrays must have consistent lengths")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_size * num_phases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_size * num_phases ==
                                              (unsigned int)(material_response_end - material_response_begin),
                                          "The density and material response arrays must have consistent lengths")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(num_phases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(num_phases == (unsigned int)(result_end - result_begin),
                                          "The density and result arrays must have the same length")
 
             for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
@@ -967,6 +971,12 @@ namespace tardigradeBalanceEquations {
              * displacement
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_MASS_JACOBIAN,
+                costModel::getBalanceOfMassJacobianCost(dim, dRdRho_end - dRdRho_begin, material_response_dim,
+                                                        material_response_num_dof)
+                    .flops)
+
             using dRdRho_type = typename std::iterator_traits<dRdRho_iter>::value_type;
 
             using dRdU_type = typename std::iterator_traits<dRdU_iter>::value_type;
@@ -1000,6 +1010,11 @@ namespace tardigradeBalanceEquations {
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             const unsigned int     num_additional_dof = (material_response_num_dof - num_phase_dof);
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                CHAIN_RULE,
+                costModel::getBalanceOfMassJacobianCost(dim, nphases, material_response_dim, material_response_num_dof)
+                    .chain_rule_flops)
+
             // Add the material response contributions to the density Jacobian
             for (auto p = std::pair<unsigned int, dRdRho_iter>(0, dRdRho_begin); p.second != dRdRho_end;
                  ++p.first, ++p.second) {
@@ -1197,8 +1212,9 @@ namespace tardigradeBalanceEquations {
                   class dRdRho_iter, class dRdU_iter, class dRdW_iter, class dRdTheta_iter, class dRdE_iter,
                   class dRdVF_iter, class dRdZ_iter, class dRdUMesh_iter, typename dDensityDotdDensity_type,
                   typename dUDotdU_type, int density_index, int displacement_index, int velocity_index,
-                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index>
-        void computeBalanceOfMass(
+                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index,
+                  class phase_loop_type>
+        void computeBalanceOfMassPhaseLoop(
             const density_iter &density_begin, const density_iter &density_end,
             const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
             const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
@@ -1217,7 +1233,7 @@ namespace tardigradeBalanceEquations {
             dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
             dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end, dRdVF_iter dRdVF_begin,
             dRdVF_iter dRdVF_end, dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin,
-            dRdUMesh_iter dRdUMesh_end) {
+            dRdUMesh_iter dRdUMesh_end, phase_loop_type phase_loop) {
             /*!
              * A balance of mass function for a general material response problem where the change in mass may be
              * a function of many different variables. Evaluates for all phases.
@@ -1326,6 +1342,8 @@ namespace tardigradeBalanceEquations {
              * displacement
              * \param &dRdUMesh_end: The stopping iterator of the derivative of the mass change rate w.r.t. the mesh
              * displacement
+             * \param phase_loop: The loop over the phases which is called with the number of phases and a function
+             * of the phase
              */
 
             using density_type = typename std::iterator_traits<density_iter>::value_type;
@@ -1343,24 +1361,24 @@ namespace tardigradeBalanceEquations {
 
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
                                          "The length of density dot and density must be the same")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
                                          "The length of the density gradient and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
                                          "The length of the velocity and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
                                              (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
                                          "The length of the velocity gradient and the density must be consistent")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 mass_change_index < material_response_size,
                 "The material response vector must be larger than the mass-change index times the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size * (nphases * num_phase_dof + num_additional_dof) *
                         (1 + material_response_dim) ==
                     (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
@@ -1377,41 +1395,43 @@ namespace tardigradeBalanceEquations {
                     "\n  actual jacobian size       : " +
                     std::to_string((unsigned int)(material_response_jacobian_end - material_response_jacobian_begin)))
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim == (unsigned int)(interpolation_function_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(interpolation_function_gradient_end -
                                                                interpolation_function_gradient_begin),
                                          "The interpolation function gradient must have a size of dim")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
                                          "The result vector must be the same size as the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "dRdRho must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * material_response_dim ==
                                              (unsigned int)(dRdU_end - dRdU_begin),
                                          "dRdU must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * material_response_dim ==
                                              (unsigned int)(dRdW_end - dRdW_begin),
                                          "dRdW must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdVF_end - dRdVF_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdVF_end - dRdVF_begin),
                                          "dRdVF must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
                                          "dRdZ must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "dRdUMesh must have a consistent size with the density vector")
 
-            for (auto v = std::pair<unsigned int, density_iter>(0, density_begin); v.second != density_end;
-                 ++v.first, ++v.second) {
+            const unsigned int jacobian_size =
+                material_response_size * (nphases * num_phase_dof + num_additional_dof) * (1 + material_response_dim);
+
+            phase_loop(nphases, [&](const unsigned int phase) {
                 computeBalanceOfMass<
                     dim, material_response_dim, mass_change_index, material_response_num_dof, density_type,
                     density_dot_type, result_type, testFunction_type, interpolationFunction_type, densityGradient_iter,
@@ -1420,30 +1440,414 @@ namespace tardigradeBalanceEquations {
                     dRdU_iter, dRdW_iter, dRdTheta_iter, dRdE_iter, dRdVF_iter, dRdZ_iter, dRdUMesh_iter,
                     dDensityDotdDensity_type, dUDotdU_type, density_index, displacement_index, velocity_index,
                     temperature_index, internal_energy_index, volume_fraction_index, additional_dof_index>(
-                    *(density_begin + v.first), *(density_dot_begin + v.first), density_gradient_begin + dim * v.first,
-                    density_gradient_begin + dim * (v.first + 1), velocity_begin + dim * v.first,
-                    velocity_begin + dim * (v.first + 1), velocity_gradient_begin + dim * dim * v.first,
-                    velocity_gradient_begin + dim * dim * (v.first + 1),
-                    material_response_begin + material_response_size * v.first,
-                    material_response_begin + material_response_size * (v.first + 1),
-                    material_response_jacobian_begin + material_response_size *
-                                                           (nphases * num_phase_dof + num_additional_dof) *
-                                                           (1 + material_response_dim) * v.first,
-                    material_response_jacobian_begin + material_response_size *
-                                                           (nphases * num_phase_dof + num_additional_dof) *
-                                                           (1 + material_response_dim) * (v.first + 1),
-                    test_function, interpolation_function, interpolation_function_gradient_begin,
-                    interpolation_function_gradient_end, full_material_response_dof_gradient_begin,
-                    full_material_response_dof_gradient_end, dDensityDotdDensity, dUDotdU, v.first,
-                    *(result_begin + v.first), dRdRho_begin + nphases * 1 * v.first,
-                    dRdRho_begin + nphases * 1 * (v.first + 1), dRdU_begin + nphases * dim * v.first,
-                    dRdU_begin + nphases * dim * (v.first + 1), dRdW_begin + nphases * dim * v.first,
-                    dRdW_begin + nphases * dim * (v.first + 1), dRdTheta_begin + nphases * 1 * v.first,
-                    dRdTheta_begin + nphases * 1 * (v.first + 1), dRdE_begin + nphases * 1 * v.first,
-                    dRdE_begin + nphases * 1 * (v.first + 1), dRdVF_begin + nphases * 1 * v.first,
-                    dRdVF_begin + nphases * 1 * (v.first + 1), dRdZ_begin + num_additional_dof * v.first,
-                    dRdZ_begin + num_additional_dof * (v.first + 1), dRdUMesh_begin + 1 * dim * v.first,
-                    dRdUMesh_begin + 1 * dim * (v.first + 1));
+                    *(density_begin + phase), *(density_dot_begin + phase), density_gradient_begin + dim * phase,
+                    density_gradient_begin + dim * (phase + 1), velocity_begin + dim * phase,
+                    velocity_begin + dim * (phase + 1), velocity_gradient_begin + dim * dim * phase,
+                    velocity_gradient_begin + dim * dim * (phase + 1),
+                    material_response_begin + material_response_size * phase,
+                    material_response_begin + material_response_size * (phase + 1),
+                    material_response_jacobian_begin + jacobian_size * phase,
+                    material_response_jacobian_begin + jacobian_size * (phase + 1), test_function,
+                    interpolation_function, interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                    full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end,
+                    dDensityDotdDensity, dUDotdU, phase, *(result_begin + phase), dRdRho_begin + nphases * 1 * phase,
+                    dRdRho_begin + nphases * 1 * (phase + 1), dRdU_begin + nphases * dim * phase,
+                    dRdU_begin + nphases * dim * (phase + 1), dRdW_begin + nphases * dim * phase,
+                    dRdW_begin + nphases * dim * (phase + 1), dRdTheta_begin + nphases * 1 * phase,
+                    dRdTheta_begin + nphases * 1 * (phase + 1), dRdE_begin + nphases * 1 * phase,
+                    dRdE_begin + nphases * 1 * (phase + 1), dRdVF_begin + nphases * 1 * phase,
+                    dRdVF_begin + nphases * 1 * (phase + 1), dRdZ_begin + num_additional_dof * phase,
+                    dRdZ_begin + num_additional_dof * (phase + 1), dRdUMesh_begin + 1 * dim * phase,
+                    dRdUMesh_begin + 1 * dim * (phase + 1));
+            });
+        }
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  class density_iter, class densityDot_iter, class result_iter, typename testFunction_type,
+                  typename interpolationFunction_type, class densityGradient_iter, class velocity_iter,
+                  class velocityGradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  class dRdRho_iter, class dRdU_iter, class dRdW_iter, class dRdTheta_iter, class dRdE_iter,
+                  class dRdVF_iter, class dRdZ_iter, class dRdUMesh_iter, typename dDensityDotdDensity_type,
+                  typename dUDotdU_type, int density_index, int displacement_index, int velocity_index,
+                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index>
+        void computeBalanceOfMass(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const testFunction_type &test_function, const interpolationFunction_type &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU, result_iter result_begin,
+            result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end, dRdU_iter dRdU_begin,
+            dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
+            dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end, dRdVF_iter dRdVF_begin,
+            dRdVF_iter dRdVF_end, dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin,
+            dRdUMesh_iter dRdUMesh_end) {
+            /*!
+             * Compute the balance of mass of all of the phases in order on the calling thread. The phases may be
+             * distributed over a thread pool with the overload defined in tardigrade_phase_parallel.h. See
+             * computeBalanceOfMassPhaseLoop for the parameters
+             */
+
+            computeBalanceOfMassPhaseLoop<
+                dim, material_response_dim, mass_change_index, material_response_num_dof, density_iter, densityDot_iter,
+                result_iter, testFunction_type, interpolationFunction_type, densityGradient_iter, velocity_iter,
+                velocityGradient_iter, material_response_iter, material_response_jacobian_iter,
+                interpolationFunctionGradient_iter, full_material_response_dof_gradient_iter, dRdRho_iter, dRdU_iter,
+                dRdW_iter, dRdTheta_iter, dRdE_iter, dRdVF_iter, dRdZ_iter, dRdUMesh_iter, dDensityDotdDensity_type,
+                dUDotdU_type, density_index, displacement_index, velocity_index, temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index>(
+                density_begin, density_end, density_dot_begin, density_dot_end, density_gradient_begin,
+                density_gradient_end, velocity_begin, velocity_end, velocity_gradient_begin, velocity_gradient_end,
+                material_response_begin, material_response_end, material_response_jacobian_begin,
+                material_response_jacobian_end, test_function, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dDensityDotdDensity,
+                dUDotdU, result_begin, result_end, dRdRho_begin, dRdRho_end, dRdU_begin, dRdU_end, dRdW_begin, dRdW_end,
+                dRdTheta_begin, dRdTheta_end, dRdE_begin, dRdE_end, dRdVF_begin, dRdVF_end, dRdZ_begin, dRdZ_end,
+                dRdUMesh_begin, dRdUMesh_end,
+                [](const unsigned int nphases, auto function) {
+                    for (unsigned int phase = 0; phase < nphases; ++phase) {
+                        function(phase);
+                    }
+                });
+        }
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  class material_response_pattern, typename density_type, typename densityDot_type,
+                  typename result_type, typename testFunction_type, typename interpolationFunction_type,
+                  class densityGradient_iter, class velocity_iter, class velocityGradient_iter,
+                  class material_response_iter, class material_response_jacobian_iter,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dDensityDotdDensity_type, typename dUDotdU_type, class jacobian_iter, class dRdUMesh_iter,
+                  int density_index, int displacement_index, int velocity_index, int temperature_index,
+                  int internal_energy_index, int volume_fraction_index, int additional_dof_index>
+        void computeBalanceOfMassCompressed(
+            const density_type &density, const densityDot_type &density_dot,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const testFunction_type &test_function, const interpolationFunction_type &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU,
+            const unsigned int nphases, const unsigned int phase, result_type &result, jacobian_iter jacobian_begin,
+            jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end) {
+            /*!
+             * Compute the balance of mass for a general material response and its Jacobian in compressed form. Only
+             * the columns of the structurally non-zero field blocks of
+             * BalanceOfMassSparsity< material_response_pattern > are stored, computed, or zeroed. The layout of the
+             * columns is given by the functions of jacobianSparsity.
+             *
+             * The material response Jacobian is assumed to be zero outside of material_response_pattern. If the
+             * pattern is jacobianSparsity::DensePattern the result is identical to the dense overload.
+             *
+             * material_response_dim: The spatial dimension of the material response
+             * mass_change_index: The index of the material response vector where the mass change rate is located
+             * material_response_num_dof: The number of degrees of freedom of a single phase and the additional
+             * degrees of freedom of the material response
+             * material_response_pattern: The structural sparsity pattern of the material response Jacobian
+             *
+             * \param &density: The value of \f$ \rho \f$
+             * \param &density_dot: The value of \f$ \frac{\partial \rho}{\partial t} \f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of \f$ \rho \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of \f$ \rho \f$
+             * \param &velocity_begin: The starting iterator of the velocity \f$ v_i \f$
+             * \param &velocity_end: The stopping iterator of the velocity \f$ v_i \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity \f$
+             * v_{i,j} \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity \f$ v_{i,j}
+             * \f$
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian
+             * vector
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian vector
+             * \param &test_function: The value of the test function
+             * \param &interpolation_function: The value of the interpolation function
+             * \param &interpolation_function_gradient_begin: The starting iterator of the spatial gradient of the
+             * interpolation function
+             * \param &interpolation_function_gradient_end: The stopping iterator of the spatial gradient of the
+             * interpolation function
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of all
+             * of the degrees of freedom used by the material response
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of all of
+             * the degrees of freedom used by the material response
+             * \param &dDensityDotdDensity: The derivative of the time derivative of the density w.r.t. the density
+             * \param &dUDotdU: The derivative of the time derivative of the spatial dof w.r.t. the spatial dof
+             * \param nphases: The number of phases
+             * \param phase: The phase the balance equation is being computed for
+             * \param &result: The balance of mass
+             * \param &jacobian_begin: The starting iterator of the compressed Jacobian
+             * \param &jacobian_end: The stopping iterator of the compressed Jacobian
+             * \param &dRdUMesh_begin: The starting iterator of the Jacobian of the result w.r.t. the mesh displacement
+             * \param &dRdUMesh_end: The stopping iterator of the Jacobian of the result w.r.t. the mesh displacement
+             */
+
+            using jacobian_type = typename std::iterator_traits<jacobian_iter>::value_type;
+            using pattern       = BalanceOfMassSparsity<material_response_pattern>;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int num_columns = jacobianSparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of the number of compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+                                         "dRdUMesh must have a size of dim")
+
+            jacobian_type phase_dRdRho;
+
+            std::array<jacobian_type, dim> phase_dRdU;
+
+            // Compute the non-mass change parts of the balance of mass
+            computeBalanceOfMass<dim>(density, density_dot, density_gradient_begin, density_gradient_end,
+                                      velocity_begin, velocity_end, velocity_gradient_begin, velocity_gradient_end,
+                                      test_function, interpolation_function, interpolation_function_gradient_begin,
+                                      interpolation_function_gradient_end, dDensityDotdDensity, dUDotdU, result,
+                                      phase_dRdRho, std::begin(phase_dRdU), std::end(phase_dRdU), dRdUMesh_begin,
+                                      dRdUMesh_end);
+
+            // Add in the contributions from the change in mass
+            result -= test_function * (*(material_response_begin + mass_change_index));
+
+            const std::array<unsigned int, 1> response_rows = {mass_change_index};
+
+            const std::array<jacobian_type, 1> response_coefficients = {-test_function};
+
+            const std::array<unsigned int, jacobianSparsity::num_field_blocks> field_indices = {
+                density_index,         velocity_index,        displacement_index,  temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index};
+
+            std::fill(jacobian_begin, jacobian_end, jacobian_type());
+
+            jacobianSparsity::addMaterialResponseJacobian<pattern, material_response_pattern, dim,
+                                                          material_response_dim, 1>(
+                nphases, num_additional_dof, phase, field_indices, std::cbegin(response_rows),
+                std::cend(response_rows), std::cbegin(response_coefficients), std::cend(response_coefficients),
+                material_response_jacobian_begin, material_response_jacobian_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dUDotdU,
+                jacobian_begin, jacobian_end, dRdUMesh_begin, dRdUMesh_end);
+
+            // Direct dependence on the dof of the current phase
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::DENSITY, dim, nphases,
+                                                                              num_additional_dof, phase)) +=
+                phase_dRdRho;
+
+            const unsigned int velocity_column = jacobianSparsity::getPhaseFieldOffset<pattern>(
+                jacobianSparsity::VELOCITY, dim, nphases, num_additional_dof, phase);
+
+            for (unsigned int a = 0; a < dim; ++a) {
+                *(jacobian_begin + velocity_column + a) += phase_dRdU[a];
+
+                *(dRdUMesh_begin + a) -= test_function * (*(material_response_begin + mass_change_index)) *
+                                         (*(interpolation_function_gradient_begin + a));
+            }
+        }
+
+        template <int dim, int nphases, class density_iter, class densityDot_iter, class densityGradient_iter,
+                  class velocity_iter, class velocityGradient_iter, class result_iter>
+        void computeBalanceOfMassPhaseBatched(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            result_iter result_begin, result_iter result_end) {
+            /*!
+             * Compute the balance of mass for a multi-phase continuum returning the values of the mass-change rate
+             *
+             * \f$ \frac{\partial \rho}{\partial t} + \left( \rho v_i \right)_{,i} = c \f$
+             *
+             * The number of phases is known at compile time and the phases are evaluated together so that the
+             * innermost loops are over the phases and may be vectorized. The layout of the inputs and outputs is the
+             * same as the multiphase overload of computeBalanceOfMass.
+             *
+             * \param &density_begin: The starting iterator of the density \f$ \rho \f$
+             * \param &density_end: The stopping iterator of the density \f$ \rho \f$
+             * \param &density_dot_begin: The starting iterator of the partial time derivative of the density \f$
+             * \frac{\partial \rho}{\partial t} \f$
+             * \param &density_dot_end: The stopping iterator of the partial time derivative of the density \f$
+             * \frac{\partial \rho}{\partial t} \f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the density \f$
+             * \rho_{,i} \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the density \f$ \rho_{,i}
+             * \f$
+             * \param &velocity_begin: The starting iterator of the velocity \f$ v_i \f$
+             * \param &velocity_end: The stopping iterator of the velocity \f$ v_i \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity \f$
+             * v_{i,j} \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity \f$ v_{i,j}
+             * \f$
+             * \param &result_begin: The starting iterator of the net mass change per unit volume \f$ c \f$
+             * \param &result_end: The stopping iterator of the net mass change per unit volume \f$ c \f$
+             */
+
+            using result_type = typename std::iterator_traits<result_iter>::value_type;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_end - density_begin),
+                                         "The density array must have a length of nphases");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_dot_end - density_dot_begin),
+                                         "The density dot array must have a length of nphases");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(density_gradient_end - density_gradient_begin),
+                                         "The density gradient array must have a length of nphases * dim");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(velocity_end - velocity_begin),
+                                         "The velocity array must have a length of nphases * dim");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim ==
+                                             (unsigned int)(velocity_gradient_end - velocity_gradient_begin),
+                                         "The velocity gradient array must have a length of nphases * dim * dim");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+                                         "The result array must have a length of nphases");
+
+            std::array<result_type, nphases> result;
+
+            for (unsigned int phase = 0; phase < nphases; ++phase) {
+                result[phase] = *(density_dot_begin + phase);
+            }
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                for (unsigned int phase = 0; phase < nphases; ++phase) {
+                    result[phase] +=
+                        (*(density_gradient_begin + dim * phase + i)) * (*(velocity_begin + dim * phase + i));
+
+                    result[phase] +=
+                        (*(density_begin + phase)) * (*(velocity_gradient_begin + dim * dim * phase + dim * i + i));
+                }
+            }
+
+            std::copy(std::begin(result), std::end(result), result_begin);
+        }
+
+        template <int dim, int nphases, class density_iter, class densityDot_iter, class densityGradient_iter,
+                  class velocity_iter, class velocityGradient_iter, class result_iter, class dRdRho_iter,
+                  class dRdRhoDot_iter, class dRdGradRho_iter, class dRdV_iter, class dRdGradV_iter>
+        void computeBalanceOfMassPhaseBatched(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            result_iter result_begin, result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end,
+            dRdRhoDot_iter dRdRhoDot_begin, dRdRhoDot_iter dRdRhoDot_end, dRdGradRho_iter dRdGradRho_begin,
+            dRdGradRho_iter dRdGradRho_end, dRdV_iter dRdV_begin, dRdV_iter dRdV_end, dRdGradV_iter dRdGradV_begin,
+            dRdGradV_iter dRdGradV_end) {
+            /*!
+             * Compute the balance of mass for a multi-phase continuum returning the values of the mass-change rate
+             * and the derivatives w.r.t. the fields of each phase
+             *
+             * \f$ \frac{\partial \rho}{\partial t} + \left( \rho v_i \right)_{,i} = c \f$
+             *
+             * The number of phases is known at compile time and the phases are evaluated together so that the
+             * innermost loops are over the phases and may be vectorized. The layout of the inputs and outputs is the
+             * same as the multiphase overload of computeBalanceOfMass.
+             *
+             * \param &density_begin: The starting iterator of the density \f$ \rho \f$
+             * \param &density_end: The stopping iterator of the density \f$ \rho \f$
+             * \param &density_dot_begin: The starting iterator of the partial time derivative of the density \f$
+             * \frac{\partial \rho}{\partial t} \f$
+             * \param &density_dot_end: The stopping iterator of the partial time derivative of the density \f$
+             * \frac{\partial \rho}{\partial t} \f$
+             * \param &density_gradient_begin: The starting iterator of the spatial gradient of the density \f$
+             * \rho_{,i} \f$
+             * \param &density_gradient_end: The stopping iterator of the spatial gradient of the density \f$ \rho_{,i}
+             * \f$
+             * \param &velocity_begin: The starting iterator of the velocity \f$ v_i \f$
+             * \param &velocity_end: The stopping iterator of the velocity \f$ v_i \f$
+             * \param &velocity_gradient_begin: The starting iterator of the spatial gradient of the velocity \f$
+             * v_{i,j} \f$
+             * \param &velocity_gradient_end: The stopping iterator of the spatial gradient of the velocity \f$ v_{i,j}
+             * \f$
+             * \param &result_begin: The starting iterator of the net mass change per unit volume \f$ c \f$
+             * \param &result_end: The stopping iterator of the net mass change per unit volume \f$ c \f$
+             * \param &dRdRho_begin: The starting iterator of the derivative of the result w.r.t. the density \f$
+             * \rho \f$
+             * \param &dRdRho_end: The stopping iterator of the derivative of the result w.r.t. the density \f$ \rho
+             * \f$
+             * \param &dRdRhoDot_begin: The starting iterator of the derivative of the result w.r.t. the partial time
+             * derivative of the density \f$ \frac{\partial \rho}{\partial t} \f$
+             * \param &dRdRhoDot_end: The stopping iterator of the derivative of the result w.r.t. the partial time
+             * derivative of the density \f$ \frac{\partial \rho}{\partial t} \f$
+             * \param &dRdGradRho_begin: The starting iterator of the derivative of the result w.r.t. the spatial
+             * gradient of the density \f$ \rho_{,i} \f$
+             * \param &dRdGradRho_end: The stopping iterator of the derivative of the result w.r.t. the spatial
+             * gradient of the density \f$ \rho_{,i} \f$
+             * \param &dRdV_begin: The starting iterator of the derivative of the result w.r.t. the velocity \f$ v_{i}
+             * \f$
+             * \param &dRdV_end: The stopping iterator of the derivative of the result w.r.t. the velocity \f$ v_{i}
+             * \f$
+             * \param &dRdGradV_begin: The starting iterator of the derivative of the result w.r.t. the spatial
+             * gradient of the velocity \f$ v_{i,j} \f$
+             * \param &dRdGradV_end: The stopping iterator of the derivative of the result w.r.t. the spatial gradient
+             * of the velocity \f$ v_{i,j} \f$
+             */
+
+            using dRdRho_type = typename std::iterator_traits<dRdRho_iter>::value_type;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+                                         "dRdRho must have a length of nphases");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdRhoDot_end - dRdRhoDot_begin),
+                                         "dRdRhoDot must have a length of nphases");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(dRdGradRho_end - dRdGradRho_begin),
+                                         "dRdGradRho must have a length of nphases * dim");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (unsigned int)(dRdV_end - dRdV_begin),
+                                         "dRdV must have a length of nphases * dim");
+
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * dim == (unsigned int)(dRdGradV_end - dRdGradV_begin),
+                                         "dRdGradV must have a length of nphases * dim * dim");
+
+            computeBalanceOfMassPhaseBatched<dim, nphases>(
+                density_begin, density_end, density_dot_begin, density_dot_end, density_gradient_begin,
+                density_gradient_end, velocity_begin, velocity_end, velocity_gradient_begin, velocity_gradient_end,
+                result_begin, result_end);
+
+            std::array<dRdRho_type, nphases> dRdRho{};
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                for (unsigned int phase = 0; phase < nphases; ++phase) {
+                    dRdRho[phase] += *(velocity_gradient_begin + dim * dim * phase + dim * i + i);
+                }
+            }
+
+            std::copy(std::begin(dRdRho), std::end(dRdRho), dRdRho_begin);
+
+            std::fill(dRdRhoDot_begin, dRdRhoDot_end, 1);
+
+            std::copy(velocity_begin, velocity_end, dRdGradRho_begin);
+
+            std::copy(density_gradient_begin, density_gradient_end, dRdV_begin);
+
+            std::fill(dRdGradV_begin, dRdGradV_end, 0);
+
+            for (unsigned int phase = 0; phase < nphases; ++phase) {
+                for (unsigned int i = 0; i < dim; ++i) {
+                    *(dRdGradV_begin + dim * dim * phase + dim * i + i) = *(density_begin + phase);
+                }
             }
         }
 
@@ -1468,13 +1872,13 @@ namespace tardigradeBalanceEquations {
              * \param &result: The result
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 diffusion_index < (unsigned int)(material_response_end - material_response_begin),
                 "The diffusion index (" + std::to_string(diffusion_index) +
                     ") is greater than the material response vector (" +
                     std::to_string((unsigned int)(material_response_end - material_response_begin)) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (unsigned int)(test_function_gradient_end - test_function_gradient_begin) <=
                     (unsigned int)(material_response_end - (material_response_begin + diffusion_index)),
                 "The material response vector size (" +
@@ -1576,7 +1980,7 @@ namespace tardigradeBalanceEquations {
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             const unsigned int     num_additional_dof = (material_response_num_dof - num_phase_dof);
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(test_function_gradient_end - test_function_gradient_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(test_function_gradient_end - test_function_gradient_begin) ==
                                              (unsigned int)(test_function_gradient_end - test_function_gradient_begin),
                                          "The test function gradient size (" +
                                              std::to_string((unsigned int)(test_function_gradient_end -
@@ -1586,37 +1990,37 @@ namespace tardigradeBalanceEquations {
                                                                            interpolation_function_gradient_begin)) +
                                              ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdU_end - dRdU_begin) == nphases * material_response_dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdU_end - dRdU_begin) == nphases * material_response_dim,
                                          "dRdU is an inconsistent size (" + std::to_string(dRdU_end - dRdU_begin) +
                                              ") with the number of phases (" + std::to_string(nphases) +
                                              ") and the material response dimension (" +
                                              std::to_string(material_response_dim) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdW_end - dRdW_begin) == nphases * material_response_dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdW_end - dRdW_begin) == nphases * material_response_dim,
                                          "dRdW is an inconsistent size (" + std::to_string(dRdW_end - dRdW_begin) +
                                              ") with the number of phases (" + std::to_string(nphases) +
                                              ") and the material response dimension (" +
                                              std::to_string(material_response_dim) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdTheta_end - dRdTheta_begin) == nphases,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdTheta_end - dRdTheta_begin) == nphases,
                                          "dRdTheta is an inconsistent size (" +
                                              std::to_string(dRdTheta_end - dRdTheta_begin) +
                                              ") with the number of phases (" + std::to_string(nphases) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdE_end - dRdE_begin) == nphases,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdE_end - dRdE_begin) == nphases,
                                          "dRdE is an inconsistent size (" + std::to_string(dRdE_end - dRdE_begin) +
                                              ") with the number of phases (" + std::to_string(nphases) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdVF_end - dRdVF_begin) == nphases,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdVF_end - dRdVF_begin) == nphases,
                                          "dRdVF is an inconsistent size (" + std::to_string(dRdVF_end - dRdVF_begin) +
                                              ") with the number of phases (" + std::to_string(nphases) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdZ_end - dRdZ_begin) == num_additional_dof,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdZ_end - dRdZ_begin) == num_additional_dof,
                                          "dRdZ is an inconsistent size (" + std::to_string(dRdZ_end - dRdZ_begin) +
                                              ") with the number of additional degrees of freedom (" +
                                              std::to_string(num_additional_dof) + ")")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdUMesh_end - dRdUMesh_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdUMesh_end - dRdUMesh_begin) ==
                                              (unsigned int)(test_function_gradient_end - test_function_gradient_begin),
                                          "dRdUMesh is an inconsistent size (" +
                                              std::to_string(dRdUMesh_end - dRdUMesh_begin) +
@@ -1838,7 +2242,7 @@ namespace tardigradeBalanceEquations {
             auto num_phases             = (result_end - result_begin);
             auto material_response_size = (material_response_end - material_response_begin) / num_phases;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((material_response_end - material_response_begin) ==
+            TARDIGRADE_BALANCE_EQS_CHECK((material_response_end - material_response_begin) ==
                                              material_response_size * num_phases,
                                          "The multiphase material response size (" +
                                              std::to_string(material_response_end - material_response_begin) +
@@ -1947,11 +2351,11 @@ namespace tardigradeBalanceEquations {
 
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 diffusion_index < material_response_size,
                 "The material response vector must be larger than the diffusion index times the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size * (nphases * num_phase_dof + num_additional_dof) *
                         (1 + material_response_dim) ==
                     (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
@@ -1968,37 +2372,37 @@ namespace tardigradeBalanceEquations {
                     "\n  actual jacobian size       : " +
                     std::to_string((unsigned int)(material_response_jacobian_end - material_response_jacobian_begin)))
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_dim == (unsigned int)(interpolation_function_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_dim == (unsigned int)(interpolation_function_gradient_end -
                                                                                  interpolation_function_gradient_begin),
                                          "The interpolation function gradient must have a size of dim")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(result_end - result_begin),
                                          "The result vector must be the same size as the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "dRdRho must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * material_response_dim ==
                                              (unsigned int)(dRdU_end - dRdU_begin),
                                          "dRdU must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * material_response_dim ==
                                              (unsigned int)(dRdW_end - dRdW_begin),
                                          "dRdW must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdVF_end - dRdVF_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases * 1 == (unsigned int)(dRdVF_end - dRdVF_begin),
                                          "dRdVF must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
                                          "dRdZ must have a consistent size with the density vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_dim ==
                                              (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "dRdUMesh must have a consistent size with the density vector")
 
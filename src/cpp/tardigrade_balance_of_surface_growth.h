@@ -13,7 +13,9 @@
 #include <array>
 
 #define USE_EIGEN
+#include "tardigrade_error_policy.h"
 #include "tardigrade_error_tools.h"
+#include "tardigrade_instrumentation.h"
 
 namespace tardigradeBalanceEquations {
 
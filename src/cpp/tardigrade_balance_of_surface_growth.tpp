@@ -44,8 +44,12 @@ namespace tardigradeBalanceEquations {
              * \param &result_end: The stopping iterator for the result
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                SURFACE_GROWTH_RESIDUAL,
+                costModel::getSurfaceGrowthResidualCost(surfaceGrowthVelocity_end - surfaceGrowthVelocity_begin).flops)
+
             // Definitions only used for error handling
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int surface_growth_velocity_size =
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int surface_growth_velocity_size =
                                             (unsigned int)(surfaceGrowthVelocity_end - surfaceGrowthVelocity_begin);
                                         const unsigned int lagrange_multiplier_gradient_size =
                                             (unsigned int)(lagrangeMultiplierGradient_end -
@@ -54,20 +58,17 @@ namespace tardigradeBalanceEquations {
                                             (unsigned int)(testFunctionGradient_end - testFunctionGradient_begin);
                                         const unsigned int result_size = (unsigned int)(result_end - result_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(surface_growth_velocity_size == result_size,
-                                         "The surface growth velocity must be the same size as the result ( " +
-                                             std::to_string(surface_growth_velocity_size) + " vs. " +
-                                             std::to_string(result_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(surface_growth_velocity_size == result_size,
+                                         "The surface growth velocity must be the same size as the result ( ",
+                                         surface_growth_velocity_size, " vs. ", result_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(lagrange_multiplier_gradient_size == result_size,
-                                         "The lagrange multiplier gradient must be the same size as the result ( " +
-                                             std::to_string(lagrange_multiplier_gradient_size) + " vs. " +
-                                             std::to_string(result_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(lagrange_multiplier_gradient_size == result_size,
+                                         "The lagrange multiplier gradient must be the same size as the result ( ",
+                                         lagrange_multiplier_gradient_size, " vs. ", result_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(test_function_gradient_size == result_size,
-                                         "The test function gradient must be the same size as the result ( " +
-                                             std::to_string(test_function_gradient_size) + " vs. " +
-                                             std::to_string(result_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(test_function_gradient_size == result_size,
+                                         "The test function gradient must be the same size as the result ( ",
+                                         test_function_gradient_size, " vs. ", result_size)
 
             for (auto v = std::pair<unsigned int, result_iter>(0, result_begin); v.second != result_end;
                  ++v.first, ++v.second) {
@@ -129,13 +130,17 @@ namespace tardigradeBalanceEquations {
              *     Includes the derivative of the current differential volume
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                SURFACE_GROWTH_JACOBIAN,
+                costModel::getSurfaceGrowthJacobianCost(surfaceGrowthVelocity_end - surfaceGrowthVelocity_begin).flops)
+
             const unsigned int surface_growth_velocity_size =
                 (unsigned int)(surfaceGrowthVelocity_end - surfaceGrowthVelocity_begin);
             const unsigned int interpolation_function_gradient_size =
                 (unsigned int)(interpolationFunctionGradient_end - interpolationFunctionGradient_begin);
 
             // Definitions only used for error handling
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int test_function_gradient_size =
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int test_function_gradient_size =
                                             (unsigned int)(testFunctionGradient_end - testFunctionGradient_begin);
                                         const unsigned int result_size = (unsigned int)(result_end - result_begin);
                                         const unsigned int dRdV_size   = (unsigned int)(dRdV_end - dRdV_begin);
@@ -145,24 +150,22 @@ namespace tardigradeBalanceEquations {
 
             )
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(interpolation_function_gradient_size == test_function_gradient_size,
-                                         "dRdV must have a size of " +
-                                             std::to_string(result_size * surface_growth_velocity_size) +
-                                             " rather than " + std::to_string(dRdV_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(interpolation_function_gradient_size == test_function_gradient_size,
+                                         "The interpolation function gradient must be the same size as the test "
+                                         "function gradient ( ",
+                                         interpolation_function_gradient_size, " vs. ", test_function_gradient_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dRdV_size == result_size * surface_growth_velocity_size,
-                                         "dRdV must have a size of " +
-                                             std::to_string(result_size * surface_growth_velocity_size) +
-                                             " rather than " + std::to_string(dRdV_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(dRdV_size == result_size * surface_growth_velocity_size,
+                                         "dRdV must have a size of ", result_size * surface_growth_velocity_size,
+                                         " rather than ", dRdV_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dRdL_size == result_size * 1, "dRdL must have a size of " +
-                                                                           std::to_string(result_size * 1) +
-                                                                           " rather than " + std::to_string(dRdL_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(dRdL_size == result_size * 1, "dRdL must have a size of ", result_size * 1,
+                                         " rather than ", dRdL_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dRdUMesh_size == result_size * interpolation_function_gradient_size,
-                                         "dRdUMesh must have a size of " +
-                                             std::to_string(result_size * interpolation_function_gradient_size) +
-                                             " rather than " + std::to_string(dRdUMesh_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(dRdUMesh_size == result_size * interpolation_function_gradient_size,
+                                         "dRdUMesh must have a size of ",
+                                         result_size * interpolation_function_gradient_size, " rather than ",
+                                         dRdUMesh_size)
 
             computeSurfaceGrowthBalance(surfaceGrowthVelocity_begin, surfaceGrowthVelocity_end, lagrangeMultiplier,
                                         lagrangeMultiplierGradient_begin, lagrangeMultiplierGradient_end, testFunction,
@@ -224,24 +227,22 @@ namespace tardigradeBalanceEquations {
                 (unsigned int)(surfaceGrowthVelocity_end - surfaceGrowthVelocity_begin);
 
             // Definitions only used for error handling
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int surface_growth_velocity_gradient_size =
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int surface_growth_velocity_gradient_size =
                                             (unsigned int)(surfaceGrowthVelocityGradient_end -
                                                            surfaceGrowthVelocityGradient_begin);
                                         const unsigned int test_function_gradient_size =
                                             (unsigned int)(testFunctionGradient_end - testFunctionGradient_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(surface_growth_velocity_gradient_size ==
+            TARDIGRADE_BALANCE_EQS_CHECK(surface_growth_velocity_gradient_size ==
                                              surface_growth_velocity_size * surface_growth_velocity_size,
                                          "The surface growth velocity gradient must be the square of the size of the "
-                                         "surface growth velocity ( " +
-                                             std::to_string(surface_growth_velocity_gradient_size) + " vs. " +
-                                             std::to_string(surface_growth_velocity_size))
+                                         "surface growth velocity ( ",
+                                         surface_growth_velocity_gradient_size, " vs. ", surface_growth_velocity_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
-                test_function_gradient_size == surface_growth_velocity_size,
-                "The test function gradient must be the same size as the surface growth velocity ( " +
-                    std::to_string(test_function_gradient_size) + " vs. " +
-                    std::to_string(surface_growth_velocity_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(test_function_gradient_size == surface_growth_velocity_size,
+                                         "The test function gradient must be the same size as the surface growth "
+                                         "velocity ( ",
+                                         test_function_gradient_size, " vs. ", surface_growth_velocity_size)
 
             result = 0;
             for (auto v = std::pair<unsigned int, surfaceGrowthVelocity_iter>(0, surfaceGrowthVelocity_begin);
@@ -301,7 +302,7 @@ namespace tardigradeBalanceEquations {
             // Definitions only used for error handling
             const unsigned int test_function_gradient_size =
                 (unsigned int)(testFunctionGradient_end - testFunctionGradient_begin);
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int surface_growth_velocity_size =
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int surface_growth_velocity_size =
                                             (unsigned int)(surfaceGrowthVelocity_end - surfaceGrowthVelocity_begin);
                                         const unsigned int interpolation_function_gradient_size =
                                             (unsigned int)(interpolationFunctionGradient_end -
@@ -311,20 +312,19 @@ namespace tardigradeBalanceEquations {
                                         const unsigned int dRdUMesh_size =
                                             (unsigned int)(dRdUMesh_end - dRdUMesh_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(interpolation_function_gradient_size == test_function_gradient_size,
-                                         "dRdV must have a size of " +
-                                             std::to_string(result_size * surface_growth_velocity_size) +
-                                             " rather than " + std::to_string(dRdV_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(interpolation_function_gradient_size == test_function_gradient_size,
+                                         "The interpolation function gradient must be the same size as the test "
+                                         "function gradient ( ",
+                                         interpolation_function_gradient_size, " vs. ", test_function_gradient_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dRdV_size == result_size * surface_growth_velocity_size,
-                                         "dRdV must have a size of " +
-                                             std::to_string(result_size * surface_growth_velocity_size) +
-                                             " rather than " + std::to_string(dRdV_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(dRdV_size == result_size * surface_growth_velocity_size,
+                                         "dRdV must have a size of ", result_size * surface_growth_velocity_size,
+                                         " rather than ", dRdV_size)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dRdUMesh_size == result_size * interpolation_function_gradient_size,
-                                         "dRdUMesh must have a size of " +
-                                             std::to_string(result_size * interpolation_function_gradient_size) +
-                                             " rather than " + std::to_string(dRdUMesh_size))
+            TARDIGRADE_BALANCE_EQS_CHECK(dRdUMesh_size == result_size * interpolation_function_gradient_size,
+                                         "dRdUMesh must have a size of ",
+                                         result_size * interpolation_function_gradient_size, " rather than ",
+                                         dRdUMesh_size)
 
             computeLagrangeMultiplierBalance(surfaceGrowthVelocity_begin, surfaceGrowthVelocity_end,
                                              surfaceGrowthVelocityGradient_begin, surfaceGrowthVelocityGradient_end,
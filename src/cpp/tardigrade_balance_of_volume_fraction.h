@@ -13,12 +13,26 @@
 #include <array>
 
 #define USE_EIGEN
+#include "tardigrade_error_policy.h"
 #include "tardigrade_error_tools.h"
+#include "tardigrade_instrumentation.h"
+#include "tardigrade_jacobian_sparsity.h"
 
 namespace tardigradeBalanceEquations {
 
     namespace balanceOfVolumeFraction {
 
+        /*!
+         * The structural sparsity of the Jacobian of the balance of volume fraction of a phase. The residual depends
+         * directly on the density, spatial degree of freedom, and volume fraction of its own phase and on everything
+         * the material response depends on.
+         */
+        template <class material_response_pattern>
+        using BalanceOfVolumeFractionSparsity = jacobianSparsity::PatternUnion<
+            jacobianSparsity::SparsityPattern<
+                jacobianSparsity::DENSITY | jacobianSparsity::VELOCITY | jacobianSparsity::VOLUME_FRACTION, 0>,
+            material_response_pattern>;
+
         template <int dim, typename density_type, class velocity_iter, typename volume_fraction_type,
                   typename volume_fraction_dot_type, class volume_fraction_gradient_iter,
                   typename mass_change_rate_type, typename rest_density_type,
@@ -68,7 +82,7 @@ namespace tardigradeBalanceEquations {
                   class density_iter, class velocity_iter, class volume_fraction_iter, class volume_fraction_dot_iter,
                   class volume_fraction_gradient_iter, class material_response_iter, class rest_density_iter,
                   typename test_function_type, class result_iter>
-        inline void computeBalanceOfVolumeFraction(
+        void computeBalanceOfVolumeFraction(
             const density_iter &density_begin, const density_iter &density_end, const velocity_iter &velocity_begin,
             const velocity_iter &velocity_end, const volume_fraction_iter &volume_fraction_begin,
             const volume_fraction_iter &volume_fraction_end, const volume_fraction_dot_iter &volume_fraction_dot_begin,
@@ -137,6 +151,36 @@ namespace tardigradeBalanceEquations {
             dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
             const double volume_fraction_tolerance = 1e-8);
 
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_num_dof,
+                  class material_response_pattern, typename density_type, class velocity_iter,
+                  typename volume_fraction_type, typename volume_fraction_dot_type, class volume_fraction_gradient_iter,
+                  class material_response_iter, class material_response_jacobian_iter, typename rest_density_type,
+                  typename test_function_type, typename interpolation_function_type,
+                  class interpolation_function_gradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dUDotdU_type, typename dVolumeFractionDotdVolumeFraction_type, typename result_type,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index = 0, int displacement_index = 1,
+                  int velocity_index = 4, int temperature_index = 7, int internal_energy_index = 8,
+                  int volume_fraction_index = 9, int additional_dof_index = 10>
+        void computeBalanceOfVolumeFractionCompressed(
+            const density_type &density, const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const volume_fraction_type &volume_fraction, const volume_fraction_dot_type &volume_fraction_dot,
+            const volume_fraction_gradient_iter &volume_fraction_gradient_begin,
+            const volume_fraction_gradient_iter &volume_fraction_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const rest_density_type &rest_density, const test_function_type &test_function,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dUDotdU_type dUDotdU, const dVolumeFractionDotdVolumeFraction_type dVolumeFractionDotdVolumeFraction,
+            const unsigned int nphases, const unsigned int phase, result_type &result, jacobian_iter jacobian_begin,
+            jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
+            const double volume_fraction_tolerance = 1e-8);
+
         template <int dim, class density_iter, class velocity_iter, class volume_fraction_iter,
                   class volume_fraction_dot_iter, class volume_fraction_gradient_iter, class mass_change_rate_iter,
                   class rest_density_iter, class trace_mass_change_velocity_gradient_iter, typename test_function_type,
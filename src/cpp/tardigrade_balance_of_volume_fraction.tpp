@@ -53,10 +53,10 @@ namespace tardigradeBalanceEquations {
              * tolerance, the true density is assumed to be the rest density.
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(velocity_end - velocity_begin) == dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(velocity_end - velocity_begin) == dim,
                                          "The velocity must be the same size as the spatial dimension");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(volume_fraction_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(volume_fraction_gradient_end -
                                                         volume_fraction_gradient_begin) == dim,
                                          "The volume fraction gradient must be the same size as the spatial dimension");
 
@@ -73,6 +73,8 @@ namespace tardigradeBalanceEquations {
 
             if (volume_fraction >= volume_fraction_tolerance) {
                 true_density = (density / volume_fraction);
+            } else {
+                TARDIGRADE_BALANCE_EQUATIONS_COUNT(VOLUME_FRACTION_CUTOFF)
             }
 
             result -= mass_change_rate / true_density;
@@ -118,6 +120,10 @@ namespace tardigradeBalanceEquations {
              * tolerance, the true density is assumed to be the rest density.
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_VOLUME_FRACTION_RESIDUAL,
+                costModel::getBalanceOfVolumeFractionResidualCost(dim).flops)
+
             computeBalanceOfVolumeFraction<dim>(density, velocity_begin, velocity_end, volume_fraction,
                                                 volume_fraction_dot, volume_fraction_gradient_begin,
                                                 volume_fraction_gradient_end,
@@ -193,18 +199,18 @@ namespace tardigradeBalanceEquations {
              * tolerance, the true density is assumed to be the rest density.
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(velocity_end - velocity_begin) == dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(velocity_end - velocity_begin) == dim,
                                          "The velocity must be the same size as the spatial dimension");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(volume_fraction_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(volume_fraction_gradient_end -
                                                         volume_fraction_gradient_begin) == dim,
                                          "The volume fraction gradient must be the same size as the spatial dimension");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdU_end - dRdU_begin) == dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdU_end - dRdU_begin) == dim,
                                          "The derivative of the residual w.r.t. the phase displacement dof must be the "
                                          "same size as the spatial dimension");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dRdUMesh_end - dRdUMesh_begin) == dim,
+            TARDIGRADE_BALANCE_EQS_CHECK((unsigned int)(dRdUMesh_end - dRdUMesh_begin) == dim,
                                          "The derivative of the residual w.r.t. the mesh displacement must be the same "
                                          "size as the spatial dimension");
 
@@ -245,6 +251,8 @@ namespace tardigradeBalanceEquations {
                 dGammadVolumeFraction = -density / (volume_fraction * volume_fraction) * interpolation_function;
 
                 dGammadRho = interpolation_function / volume_fraction;
+            } else {
+                TARDIGRADE_BALANCE_EQUATIONS_COUNT(VOLUME_FRACTION_CUTOFF)
             }
 
             result -= mass_change_rate / true_density;
@@ -364,26 +372,38 @@ namespace tardigradeBalanceEquations {
              * tolerance, the true density is assumed to be the rest density.
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                BALANCE_OF_VOLUME_FRACTION_JACOBIAN,
+                costModel::getBalanceOfVolumeFractionJacobianCost(dim, dRdRho_end - dRdRho_begin, material_response_dim,
+                                                                  material_response_num_dof)
+                    .flops)
+
             const unsigned int     nphases            = (unsigned int)(dRdRho_end - dRdRho_begin);
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             const unsigned int     num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                CHAIN_RULE,
+                costModel::getBalanceOfVolumeFractionJacobianCost(dim, nphases, material_response_dim,
+                                                                  material_response_num_dof)
+                    .chain_rule_flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
                                          "The dRdU must be a consistent size with the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(dRdW_end - dRdW_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(dRdW_end - dRdW_begin),
                                          "The dRdW must be a consistent size with the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "The dRdTheta must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdE_end - dRdE_begin),
                                          "The dRdE must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "The dRdVolumeFraction must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The dRdUMesh must be the same size as the dimension")
 
             result_type dRdC_phase, dRdTraceVA_phase;
@@ -736,6 +756,154 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_num_dof,
+                  class material_response_pattern, typename density_type, class velocity_iter,
+                  typename volume_fraction_type, typename volume_fraction_dot_type, class volume_fraction_gradient_iter,
+                  class material_response_iter, class material_response_jacobian_iter, typename rest_density_type,
+                  typename test_function_type, typename interpolation_function_type,
+                  class interpolation_function_gradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dUDotdU_type, typename dVolumeFractionDotdVolumeFraction_type, typename result_type,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index, int displacement_index,
+                  int velocity_index, int temperature_index, int internal_energy_index, int volume_fraction_index,
+                  int additional_dof_index>
+        void computeBalanceOfVolumeFractionCompressed(
+            const density_type &density, const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const volume_fraction_type &volume_fraction, const volume_fraction_dot_type &volume_fraction_dot,
+            const volume_fraction_gradient_iter &volume_fraction_gradient_begin,
+            const volume_fraction_gradient_iter &volume_fraction_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const rest_density_type &rest_density, const test_function_type &test_function,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dUDotdU_type dUDotdU, const dVolumeFractionDotdVolumeFraction_type dVolumeFractionDotdVolumeFraction,
+            const unsigned int nphases, const unsigned int phase, result_type &result, jacobian_iter jacobian_begin,
+            jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
+            const double volume_fraction_tolerance) {
+            /*!
+             * Compute the balance of the volume fraction for a reacting continuum with the Jacobian in compressed
+             * form. Only the columns of the structurally non-zero field blocks of
+             * BalanceOfVolumeFractionSparsity< material_response_pattern > are stored, computed, or zeroed. The layout
+             * of the columns is given by the functions of jacobianSparsity.
+             *
+             * The material response Jacobian is assumed to be zero outside of material_response_pattern. If the
+             * pattern is jacobianSparsity::DensePattern the result is identical to the dense overload.
+             *
+             * material_response_pattern: The structural sparsity pattern of the material response Jacobian
+             *
+             * \param &density: The current apparent density \f$ \left( \rho^{\alpha} \right) \f$
+             * \param &velocity_begin: The starting iterator of the phase velocity \f$ \left( v_i^{\alpha} \right) \f$
+             * \param &velocity_end: The stopping iterator of the phase velocity \f$ \left( v_i^{\alpha} \right) \f$
+             * \param &volume_fraction: The current volume fraction \f$ \left( \phi^{\alpha} \right) \f$
+             * \param &volume_fraction_dot: The partial time derivative of the current volume fraction \f$ \left(
+             * \frac{\partial \phi^{\alpha}}{\partial t} \right) \f$
+             * \param &volume_fraction_gradient_begin: The starting iterator of the spatial gradient of the volume
+             * fraction \f$ \left( \phi_{,i}^{\alpha} \right) \f$
+             * \param &volume_fraction_gradient_end: The stopping iterator of the spatial gradient of the volume
+             * fraction \f$ \left( \phi_{,i}^{\alpha} \right) \f$
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian vector
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian vector
+             * \param &rest_density: The rest density of the material \f$ \left( \bar{\gamma}^{\alpha} \right) \f$
+             * \param &test_function: The current value of the test function
+             * \param &interpolation_function: The current value of the interpolation function
+             * \param &interpolation_function_gradient_begin: The starting iterator of the current value of the spatial
+             * gradient of the interpolation function
+             * \param &interpolation_function_gradient_end: The stopping iterator of the current value of the spatial
+             * gradient of the interpolation function
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dUDotdU: The derivative of the phase velocity w.r.t. the phase displacement dof
+             * \param &dVolumeFractionDotdVolumeFraction: The derivative of the partial time derivative of the volume
+             * fraction phase w.r.t. the volume fraction
+             * \param nphases: The number of phases
+             * \param phase: The current active phase
+             * \param &result: The value of the balance of volume fraction
+             * \param &jacobian_begin: The starting iterator of the compressed Jacobian
+             * \param &jacobian_end: The stopping iterator of the compressed Jacobian
+             * \param &dRdUMesh_begin: The starting iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             * \param &dRdUMesh_end: The stopping iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             * \param volume_fraction_tolerance: The tolerance of the volume fraction where if it is less than the
+             * tolerance, the true density is assumed to be the rest density.
+             */
+
+            using jacobian_type = typename std::iterator_traits<jacobian_iter>::value_type;
+            using pattern       = BalanceOfVolumeFractionSparsity<material_response_pattern>;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int num_columns = jacobianSparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of the number of compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+                                         "dRdUMesh must have a size of dim")
+
+            jacobian_type dRdRho_phase, dRdVF_phase, dRdC_phase, dRdTraceVA_phase;
+
+            std::array<jacobian_type, dim> dRdU_phase;
+
+            computeBalanceOfVolumeFraction<dim>(
+                density, velocity_begin, velocity_end, volume_fraction, volume_fraction_dot,
+                volume_fraction_gradient_begin, volume_fraction_gradient_end,
+                *(material_response_begin + mass_change_rate_index), rest_density,
+                *(material_response_begin + trace_mass_change_velocity_gradient_index), test_function,
+                interpolation_function, interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                dUDotdU, dVolumeFractionDotdVolumeFraction, result, dRdRho_phase, std::begin(dRdU_phase),
+                std::end(dRdU_phase), dRdVF_phase, dRdC_phase, dRdTraceVA_phase, dRdUMesh_begin, dRdUMesh_end,
+                volume_fraction_tolerance);
+
+            const std::array<unsigned int, 2> response_rows = {mass_change_rate_index,
+                                                               trace_mass_change_velocity_gradient_index};
+
+            const std::array<jacobian_type, 2> response_coefficients = {dRdC_phase, dRdTraceVA_phase};
+
+            const std::array<unsigned int, jacobianSparsity::num_field_blocks> field_indices = {
+                density_index,         velocity_index,        displacement_index,  temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index};
+
+            std::fill(jacobian_begin, jacobian_end, jacobian_type());
+
+            jacobianSparsity::addMaterialResponseJacobian<pattern, material_response_pattern, dim,
+                                                          material_response_dim, 2>(
+                nphases, num_additional_dof, phase, field_indices, std::cbegin(response_rows),
+                std::cend(response_rows), std::cbegin(response_coefficients), std::cend(response_coefficients),
+                material_response_jacobian_begin, material_response_jacobian_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dUDotdU,
+                jacobian_begin, jacobian_end, dRdUMesh_begin, dRdUMesh_end);
+
+            // Direct dependence on the dof of the current phase
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::DENSITY, dim, nphases,
+                                                                              num_additional_dof, phase)) +=
+                dRdRho_phase;
+
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::VOLUME_FRACTION, dim,
+                                                                              nphases, num_additional_dof, phase)) +=
+                dRdVF_phase;
+
+            const unsigned int velocity_column = jacobianSparsity::getPhaseFieldOffset<pattern>(
+                jacobianSparsity::VELOCITY, dim, nphases, num_additional_dof, phase);
+
+            for (unsigned int a = 0; a < dim; ++a) {
+                *(jacobian_begin + velocity_column + a) += dRdU_phase[a];
+            }
+        }
+
         template <int dim, class density_iter, class velocity_iter, class volume_fraction_iter,
                   class volume_fraction_dot_iter, class volume_fraction_gradient_iter, class mass_change_rate_iter,
                   class rest_density_iter, class trace_mass_change_velocity_gradient_iter, typename test_function_type,
@@ -793,26 +961,26 @@ namespace tardigradeBalanceEquations {
              * tolerance, the true density is assumed to be the rest density.
              */
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
+            TARDIGRADE_BALANCE_EQS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
                                          "The velocity size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The volume fraction size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases == (unsigned int)(volume_fraction_dot_end - volume_fraction_dot_begin),
                 "The partial derivative of the volume fraction w.r.t. time size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(volume_fraction_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(volume_fraction_gradient_end -
                                                                          volume_fraction_gradient_begin),
                                          "The volume fraction gradient size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(mass_change_rate_end - mass_change_rate_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(mass_change_rate_end - mass_change_rate_begin),
                                          "The mass change rate size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases ==
                     (unsigned int)(trace_mass_change_velocity_gradient_end - trace_mass_change_velocity_gradient_begin),
                 "The trace of the mass change velocity gradient size is not equal to the number of phases");
@@ -886,29 +1054,29 @@ namespace tardigradeBalanceEquations {
             const unsigned int material_response_size =
                 (unsigned int)(material_response_end - material_response_begin) / nphases;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
                                          "The velocity size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The volume fraction size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases == (unsigned int)(volume_fraction_dot_end - volume_fraction_dot_begin),
                 "The partial derivative of the volume fraction w.r.t. time size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(volume_fraction_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(volume_fraction_gradient_end -
                                                                          volume_fraction_gradient_begin),
                                          "The volume fraction gradient size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size == (unsigned int)(material_response_end - material_response_begin),
                 "The material response vector size must be a integer multiple of the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 (material_response_size > mass_change_rate_index),
                 "The material response vector size must larger than the index for the mass change rate")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((material_response_size > trace_mass_change_velocity_gradient_index),
+            TARDIGRADE_BALANCE_EQS_CHECK((material_response_size > trace_mass_change_velocity_gradient_index),
                                          "The material response vector size must larger than the index for the trace "
                                          "of the mass change rate velocity gradient")
 
@@ -1023,46 +1191,46 @@ namespace tardigradeBalanceEquations {
              * tolerance, the true density is assumed to be the rest density.
              */
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
+            TARDIGRADE_BALANCE_EQS_EVAL(unsigned int nphases = (unsigned int)(density_end - density_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
                                          "The velocity size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The volume fraction size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases == (unsigned int)(volume_fraction_dot_end - volume_fraction_dot_begin),
                 "The partial derivative of the volume fraction w.r.t. time size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(volume_fraction_gradient_end -
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(volume_fraction_gradient_end -
                                                                          volume_fraction_gradient_begin),
                                          "The volume fraction gradient size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(mass_change_rate_end - mass_change_rate_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(mass_change_rate_end - mass_change_rate_begin),
                                          "The mass change rate size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases ==
                     (unsigned int)(trace_mass_change_velocity_gradient_end - trace_mass_change_velocity_gradient_begin),
                 "The trace of the mass change velocity gradient size is not equal to the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
                                          "The dRdRho size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(dRdU_end - dRdU_begin),
                                          "The dRdU size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "The dRdVolumeFraction size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdC_end - dRdC_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdC_end - dRdC_begin),
                                          "The dRdC size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdTraceVA_end - dRdTraceVA_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdTraceVA_end - dRdTraceVA_begin),
                                          "The dRdTraceVA size is inconsistent with the number of phases");
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The dRdUMesh size is inconsistent with the number of phases");
 
             for (auto rho = std::pair<unsigned int, density_iter>(0, density_begin); rho.second != density_end;
@@ -1205,27 +1373,27 @@ namespace tardigradeBalanceEquations {
             using rest_density_type        = typename std::iterator_traits<rest_density_iter>::value_type;
             using result_type              = typename std::iterator_traits<result_iter>::value_type;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(density_end - density_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(density_end - density_begin),
                                          "The density must have the same size as the result vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(dim * nphases == (unsigned int)(velocity_end - velocity_begin),
                                          "The velocity must be consistent with the size of the result vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_end - volume_fraction_begin),
                                          "The volume fraction must have the same size as the result vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(volume_fraction_dot_end - volume_fraction_dot_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(volume_fraction_dot_end - volume_fraction_dot_begin),
                                          "The volume fraction dot must have the same size as the result vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 dim * nphases == (unsigned int)(volume_fraction_gradient_end - volume_fraction_gradient_begin),
                 "The patial gradient of the volume fraction must be consistent with the size of the result vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size == (unsigned int)(material_response_end - material_response_begin),
                 "The material response vector size must be an integer multiple of the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_size *
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_size *
                                                  (nphases * num_phase_dof + num_additional_dof) *
                                                  (1 + material_response_dim) ==
                                              (unsigned int)(material_response_jacobian_end -
@@ -1233,31 +1401,31 @@ namespace tardigradeBalanceEquations {
                                          "The material response Jacobian vector size must be consistent with the "
                                          "number of phases and the number of DOF in the material repsonse")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(rest_density_end - rest_density_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(rest_density_end - rest_density_begin),
                                          "The rest density must have the same size as the result vector")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK((nphases * num_phase_dof + num_additional_dof) * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK((nphases * num_phase_dof + num_additional_dof) * material_response_dim ==
                                              (unsigned int)(full_material_response_dof_gradient_end -
                                                             full_material_response_dof_gradient_begin),
                                          "The full material response dof spatial gradient vector must be the material "
                                          "response dimension times the number of DOF in the material response in size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * nphases == (dRdU_end - dRdU_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * nphases == (dRdU_end - dRdU_begin),
                                          "The dRdU must be a consistent size with the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim * nphases == (dRdW_end - dRdW_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim * nphases == (dRdW_end - dRdW_begin),
                                          "The dRdW must be a consistent size with the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (dRdTheta_end - dRdTheta_begin),
                                          "The dRdTheta must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (dRdE_end - dRdE_begin),
                                          "The dRdE must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (dRdVolumeFraction_end - dRdVolumeFraction_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (dRdVolumeFraction_end - dRdVolumeFraction_begin),
                                          "The dRdVolumeFraction must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * dim == (dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * dim == (dRdUMesh_end - dRdUMesh_begin),
                                          "The dRdUMesh must be the same size as the dimension")
 
             for (auto v = std::pair<unsigned int, result_iter>(0, result_begin); v.second != result_end;
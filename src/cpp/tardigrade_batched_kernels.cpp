@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_batched_kernels.cpp
+ ******************************************************************************
+ * The source file for evaluating the residuals of the multiphase balance
+ * equations over batches of points
+ ******************************************************************************
+ */
+
+#include "tardigrade_batched_kernels.h"
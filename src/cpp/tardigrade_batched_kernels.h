@@ -0,0 +1,80 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_batched_kernels.h
+ ******************************************************************************
+ * The header file for evaluating the residuals of the multiphase balance
+ * equations over batches of points. The values of the points are stored
+ * contiguously in point-major order i.e., all of the values of a point are
+ * followed by all of the values of the next point, which is the layout of a
+ * C-contiguous array whose first index is the point. The points are
+ * independent so a batch may be distributed over a thread pool. The batches
+ * are the entry points of the python bindings which evaluate the kernels on
+ * NumPy arrays without copying them.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_BATCHED_KERNELS_H
+#define TARDIGRADE_BATCHED_KERNELS_H
+
+#include <cstddef>
+
+#include "tardigrade_balance_of_energy.h"
+#include "tardigrade_balance_of_linear_momentum.h"
+#include "tardigrade_balance_of_mass.h"
+#include "tardigrade_error_policy.h"
+#include "tardigrade_error_tools.h"
+#include "tardigrade_thread_pool.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace batchedKernels {
+
+        typedef std::size_t size_type;  //!< The type of the indices of the points
+
+        constexpr size_type default_point_grain_size = 256;  //!< The default number of points of each task
+
+        template <class point_function>
+        void forEachPoint(const size_type num_points, threadPool::ThreadPool *pool, const size_type grain_size,
+                          point_function function);
+
+        template <class point_function>
+        void forEachValidatedPoint(const size_type num_points, threadPool::ThreadPool *pool,
+                                   const size_type grain_size, point_function function);
+
+        template <int dim, int mass_change_index, typename T>
+        void computeBalanceOfMass(const size_type num_points, const unsigned int nphases,
+                                  const unsigned int material_response_size, const T *density, const T *density_dot,
+                                  const T *density_gradient, const T *velocity, const T *velocity_gradient,
+                                  const T *material_response, const T *test_function, T *result,
+                                  threadPool::ThreadPool *pool       = nullptr,
+                                  const size_type         grain_size = default_point_grain_size);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, typename T>
+        void computeBalanceOfLinearMomentum(const size_type num_points, const unsigned int nphases,
+                                            const unsigned int material_response_size, const T *density,
+                                            const T *density_dot, const T *density_gradient, const T *velocity,
+                                            const T *velocity_dot, const T *velocity_gradient,
+                                            const T *material_response, const T *volume_fraction,
+                                            const T *test_function, const T *test_function_gradient, T *result,
+                                            threadPool::ThreadPool *pool       = nullptr,
+                                            const size_type         grain_size = default_point_grain_size);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, typename T>
+        void computeBalanceOfEnergy(const size_type num_points, const unsigned int nphases,
+                                    const unsigned int material_response_size, const T *density, const T *density_dot,
+                                    const T *density_gradient, const T *internal_energy, const T *internal_energy_dot,
+                                    const T *internal_energy_gradient, const T *velocity, const T *velocity_gradient,
+                                    const T *material_response, const T *volume_fraction, const T *test_function,
+                                    const T *test_function_gradient, T *result, threadPool::ThreadPool *pool = nullptr,
+                                    const size_type grain_size = default_point_grain_size);
+
+    }  // namespace batchedKernels
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_batched_kernels.tpp"
+
+#endif
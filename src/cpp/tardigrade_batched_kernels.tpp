@@ -0,0 +1,296 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_batched_kernels.tpp
+ ******************************************************************************
+ * The template file for evaluating the residuals of the multiphase balance
+ * equations over batches of points
+ ******************************************************************************
+ */
+
+#include "tardigrade_batched_kernels.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace batchedKernels {
+
+        /*!
+         * Call a function for each of the points of a batch. If a pool is given and the batch has more than
+         * grain_size points the points are distributed over the threads of the pool in tasks of grain_size points.
+         * The function must only write to the outputs of the point it is called with.
+         *
+         * \param num_points: The number of points
+         * \param pool: The thread pool. nullptr evaluates the points in order on the calling thread
+         * \param grain_size: The number of points of each task
+         * \param function: The function to call which takes the point as its only argument
+         */
+        template <class point_function>
+        void forEachPoint(const size_type num_points, threadPool::ThreadPool *pool, const size_type grain_size,
+                          point_function function) {
+            if ((pool == nullptr) || (num_points <= grain_size)) {
+                for (size_type point = 0; point < num_points; ++point) {
+                    function(point);
+                }
+
+                return;
+            }
+
+            pool->parallelFor(num_points, grain_size,
+                              [&function](const unsigned int, const threadPool::size_type point) { function(point); });
+        }
+
+        /*!
+         * Call a function for each of the points of a batch whose points all have the same sizes. The first point is
+         * evaluated on the calling thread with the checks of the kernels and the remaining points are evaluated by
+         * forEachPoint in a trusted batch so that the sizes are only checked once per batch.
+         *
+         * \param num_points: The number of points
+         * \param pool: The thread pool. nullptr evaluates the points in order on the calling thread
+         * \param grain_size: The number of points of each task
+         * \param function: The function to call which takes the point as its only argument
+         */
+        template <class point_function>
+        void forEachValidatedPoint(const size_type num_points, threadPool::ThreadPool *pool,
+                                   const size_type grain_size, point_function function) {
+            if (num_points == 0) {
+                return;
+            }
+
+            function(size_type(0));
+
+            forEachPoint(num_points - 1, pool, grain_size, [&function](const size_type point) {
+                errorPolicy::TrustedBatch trusted;
+
+                function(point + 1);
+            });
+        }
+
+        /*!
+         * Compute the residuals of the balance of mass of a batch of multiphase points. The arrays are point-major
+         * with the shapes
+         *
+         * density, density_dot, result: ( num_points, nphases )
+         * density_gradient, velocity: ( num_points, nphases, dim )
+         * velocity_gradient: ( num_points, nphases, dim, dim )
+         * material_response: ( num_points, nphases, material_response_size )
+         * test_function: ( num_points )
+         *
+         * \param num_points: The number of points
+         * \param nphases: The number of phases of each point
+         * \param material_response_size: The number of values of the material response of a phase
+         * \param *density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param *density_dot: The partial time derivatives of the apparent densities
+         * \param *density_gradient: The spatial gradients of the apparent densities
+         * \param *velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param *velocity_gradient: The spatial gradients of the velocities
+         * \param *material_response: The material responses
+         * \param *test_function: The test functions \f$ \psi \f$
+         * \param *result: The residuals
+         * \param pool: The thread pool. nullptr evaluates the points on the calling thread
+         * \param grain_size: The number of points of each task
+         */
+        template <int dim, int mass_change_index, typename T>
+        void computeBalanceOfMass(const size_type num_points, const unsigned int nphases,
+                                  const unsigned int material_response_size, const T *density, const T *density_dot,
+                                  const T *density_gradient, const T *velocity, const T *velocity_gradient,
+                                  const T *material_response, const T *test_function, T *result,
+                                  threadPool::ThreadPool *pool, const size_type grain_size) {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(nphases > 0, "The points must have at least one phase")
+
+            const size_type scalar_size = nphases;
+
+            const size_type vector_size = nphases * dim;
+
+            const size_type tensor_size = nphases * dim * dim;
+
+            const size_type response_size = nphases * material_response_size;
+
+            forEachValidatedPoint(num_points, pool, grain_size, [&](const size_type point) {
+                const T *rho = density + scalar_size * point;
+
+                const T *rho_dot = density_dot + scalar_size * point;
+
+                const T *grad_rho = density_gradient + vector_size * point;
+
+                const T *v = velocity + vector_size * point;
+
+                const T *grad_v = velocity_gradient + tensor_size * point;
+
+                const T *response = material_response + response_size * point;
+
+                T *r = result + scalar_size * point;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((balanceOfMass::computeBalanceOfMass<dim, mass_change_index>(
+                    rho, rho + scalar_size, rho_dot, rho_dot + scalar_size, grad_rho, grad_rho + vector_size, v,
+                    v + vector_size, grad_v, grad_v + tensor_size, response, response + response_size,
+                    test_function[point], r, r + scalar_size)));
+            });
+        }
+
+        /*!
+         * Compute the residuals of the balance of linear momentum of a batch of multiphase points. The arrays are
+         * point-major with the shapes
+         *
+         * density, density_dot, volume_fraction: ( num_points, nphases )
+         * density_gradient, velocity, velocity_dot, result: ( num_points, nphases, dim )
+         * velocity_gradient: ( num_points, nphases, dim, dim )
+         * material_response: ( num_points, nphases, material_response_size )
+         * test_function: ( num_points )
+         * test_function_gradient: ( num_points, dim )
+         *
+         * \param num_points: The number of points
+         * \param nphases: The number of phases of each point
+         * \param material_response_size: The number of values of the material response of a phase
+         * \param *density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param *density_dot: The partial time derivatives of the apparent densities
+         * \param *density_gradient: The spatial gradients of the apparent densities
+         * \param *velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param *velocity_dot: The partial time derivatives of the velocities
+         * \param *velocity_gradient: The spatial gradients of the velocities
+         * \param *material_response: The material responses
+         * \param *volume_fraction: The volume fractions \f$ \phi^{\alpha} \f$
+         * \param *test_function: The test functions \f$ \psi \f$
+         * \param *test_function_gradient: The spatial gradients of the test functions
+         * \param *result: The residuals
+         * \param pool: The thread pool. nullptr evaluates the points on the calling thread
+         * \param grain_size: The number of points of each task
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, typename T>
+        void computeBalanceOfLinearMomentum(const size_type num_points, const unsigned int nphases,
+                                            const unsigned int material_response_size, const T *density,
+                                            const T *density_dot, const T *density_gradient, const T *velocity,
+                                            const T *velocity_dot, const T *velocity_gradient,
+                                            const T *material_response, const T *volume_fraction,
+                                            const T *test_function, const T *test_function_gradient, T *result,
+                                            threadPool::ThreadPool *pool, const size_type grain_size) {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(nphases > 0, "The points must have at least one phase")
+
+            const size_type scalar_size = nphases;
+
+            const size_type vector_size = nphases * dim;
+
+            const size_type tensor_size = nphases * dim * dim;
+
+            const size_type response_size = nphases * material_response_size;
+
+            forEachValidatedPoint(num_points, pool, grain_size, [&](const size_type point) {
+                const T *rho = density + scalar_size * point;
+
+                const T *rho_dot = density_dot + scalar_size * point;
+
+                const T *grad_rho = density_gradient + vector_size * point;
+
+                const T *v = velocity + vector_size * point;
+
+                const T *v_dot = velocity_dot + vector_size * point;
+
+                const T *grad_v = velocity_gradient + tensor_size * point;
+
+                const T *response = material_response + response_size * point;
+
+                const T *phi = volume_fraction + scalar_size * point;
+
+                const T *grad_psi = test_function_gradient + dim * point;
+
+                T *r = result + vector_size * point;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                        dim, material_response_dim, body_force_index, cauchy_stress_index, interphasic_force_index>(
+                        rho, rho + scalar_size, rho_dot, rho_dot + scalar_size, grad_rho, grad_rho + vector_size, v,
+                        v + vector_size, v_dot, v_dot + vector_size, grad_v, grad_v + tensor_size, response,
+                        response + response_size, phi, phi + scalar_size, test_function[point], grad_psi,
+                        grad_psi + dim, r, r + vector_size)));
+            });
+        }
+
+        /*!
+         * Compute the residuals of the balance of energy of a batch of multiphase points. The arrays are point-major
+         * with the shapes
+         *
+         * density, density_dot, internal_energy, internal_energy_dot, volume_fraction, result: ( num_points, nphases )
+         * density_gradient, internal_energy_gradient, velocity: ( num_points, nphases, dim )
+         * velocity_gradient: ( num_points, nphases, dim, dim )
+         * material_response: ( num_points, nphases, material_response_size )
+         * test_function: ( num_points )
+         * test_function_gradient: ( num_points, dim )
+         *
+         * \param num_points: The number of points
+         * \param nphases: The number of phases of each point
+         * \param material_response_size: The number of values of the material response of a phase
+         * \param *density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param *density_dot: The partial time derivatives of the apparent densities
+         * \param *density_gradient: The spatial gradients of the apparent densities
+         * \param *internal_energy: The internal energies \f$ e^{\alpha} \f$
+         * \param *internal_energy_dot: The partial time derivatives of the internal energies
+         * \param *internal_energy_gradient: The spatial gradients of the internal energies
+         * \param *velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param *velocity_gradient: The spatial gradients of the velocities
+         * \param *material_response: The material responses
+         * \param *volume_fraction: The volume fractions \f$ \phi^{\alpha} \f$
+         * \param *test_function: The test functions \f$ \psi \f$
+         * \param *test_function_gradient: The spatial gradients of the test functions
+         * \param *result: The residuals
+         * \param pool: The thread pool. nullptr evaluates the points on the calling thread
+         * \param grain_size: The number of points of each task
+         */
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, typename T>
+        void computeBalanceOfEnergy(const size_type num_points, const unsigned int nphases,
+                                    const unsigned int material_response_size, const T *density, const T *density_dot,
+                                    const T *density_gradient, const T *internal_energy, const T *internal_energy_dot,
+                                    const T *internal_energy_gradient, const T *velocity, const T *velocity_gradient,
+                                    const T *material_response, const T *volume_fraction, const T *test_function,
+                                    const T *test_function_gradient, T *result, threadPool::ThreadPool *pool,
+                                    const size_type grain_size) {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(nphases > 0, "The points must have at least one phase")
+
+            const size_type scalar_size = nphases;
+
+            const size_type vector_size = nphases * dim;
+
+            const size_type tensor_size = nphases * dim * dim;
+
+            const size_type response_size = nphases * material_response_size;
+
+            forEachValidatedPoint(num_points, pool, grain_size, [&](const size_type point) {
+                const T *rho = density + scalar_size * point;
+
+                const T *rho_dot = density_dot + scalar_size * point;
+
+                const T *grad_rho = density_gradient + vector_size * point;
+
+                const T *e = internal_energy + scalar_size * point;
+
+                const T *e_dot = internal_energy_dot + scalar_size * point;
+
+                const T *grad_e = internal_energy_gradient + vector_size * point;
+
+                const T *v = velocity + vector_size * point;
+
+                const T *grad_v = velocity_gradient + tensor_size * point;
+
+                const T *response = material_response + response_size * point;
+
+                const T *phi = volume_fraction + scalar_size * point;
+
+                const T *grad_psi = test_function_gradient + dim * point;
+
+                T *r = result + scalar_size * point;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (balanceOfEnergy::computeBalanceOfEnergy<dim, is_per_unit_volume, material_response_dim,
+                                                             cauchy_stress_index, internal_heat_generation_index,
+                                                             heat_flux_index, interphasic_force_index,
+                                                             interphasic_heat_transfer_index>(
+                        rho, rho + scalar_size, rho_dot, rho_dot + scalar_size, grad_rho, grad_rho + vector_size, e,
+                        e + scalar_size, e_dot, e_dot + scalar_size, grad_e, grad_e + vector_size, v, v + vector_size,
+                        grad_v, grad_v + tensor_size, response, response + response_size, phi, phi + scalar_size,
+                        test_function[point], grad_psi, grad_psi + dim, r, r + scalar_size)));
+            });
+        }
+
+    }  // namespace batchedKernels
+
+}  // namespace tardigradeBalanceEquations
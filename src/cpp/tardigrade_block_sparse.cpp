@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_block_sparse.cpp
+ ******************************************************************************
+ * The source file for the block compressed sparse row (BSR) storage of the
+ * global Jacobian
+ ******************************************************************************
+ */
+
+#include "tardigrade_block_sparse.h"
@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_block_sparse.h
+ ******************************************************************************
+ * The header file for the block compressed sparse row (BSR) storage of the
+ * global Jacobian. Every degree of freedom of a node is coupled to every
+ * degree of freedom of the adjacent nodes so the Jacobian is made of dense
+ * node blocks whose size is the number of degrees of freedom of a node. The
+ * BSR format stores one column index per block rather than per entry and
+ * the compile-time block size lets the block kernels be unrolled.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_BLOCK_SPARSE_H
+#define TARDIGRADE_BLOCK_SPARSE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace blockSparse {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        /*!
+         * The size of the node block of the multiphase degrees of freedom i.e., the density, displacement, velocity,
+         * temperature, internal energy, and volume fraction of each phase followed by the additional degrees of
+         * freedom
+         *
+         * dim: The spatial dimension
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         */
+        template <int dim, int nphases, int num_additional_dof>
+        constexpr int node_block_size = nphases * (4 + 2 * dim) + num_additional_dof;
+
+        /*!
+         * A block compressed sparse row (BSR) matrix with square blocks. The block column indices of each block row
+         * are sorted and the blocks are stored row-major.
+         *
+         * block_size: The number of rows and columns of each block
+         */
+        template <typename T, int block_size>
+        class BSRMatrix {
+           public:
+            static_assert(block_size > 0, "The block size must be positive");
+
+            //! The type of the values
+            using value_type = T;
+
+            static constexpr size_type block_entries = block_size * block_size;  //!< The number of values of a block
+
+            /*!
+             * Default constructor
+             */
+            BSRMatrix() : _num_block_rows(0), _num_block_columns(0), _row_offsets(1, 0), _column_indices(), _values() {}
+
+            template <class row_offset_iter, class column_index_iter>
+            BSRMatrix(const size_type num_block_rows, const size_type num_block_columns,
+                      const row_offset_iter &row_offsets_begin, const row_offset_iter &row_offsets_end,
+                      const column_index_iter &column_indices_begin, const column_index_iter &column_indices_end);
+
+            //! Get the number of block rows
+            size_type getNumBlockRows() const { return _num_block_rows; }
+
+            //! Get the number of block columns
+            size_type getNumBlockColumns() const { return _num_block_columns; }
+
+            //! Get the number of scalar rows
+            size_type getNumRows() const { return block_size * _num_block_rows; }
+
+            //! Get the number of scalar columns
+            size_type getNumColumns() const { return block_size * _num_block_columns; }
+
+            //! Get the number of stored blocks
+            size_type getNumBlocks() const { return (size_type)_column_indices.size(); }
+
+            //! Get the number of stored scalar entries
+            size_type getNumNonZeros() const { return block_entries * getNumBlocks(); }
+
+            //! Get the offsets of the block rows into the block column indices
+            const std::vector<size_type> &getRowOffsets() const { return _row_offsets; }
+
+            //! Get the block column indices
+            const std::vector<size_type> &getColumnIndices() const { return _column_indices; }
+
+            //! Get the row-major values of the blocks
+            const std::vector<T> &getValues() const { return _values; }
+
+            //! Get a mutable reference to the row-major values of the blocks
+            std::vector<T> &getValues() { return _values; }
+
+            //! Get the number of bytes used by the values and the indices
+            std::size_t getMemoryBytes() const {
+                return _values.size() * sizeof(T) + (_column_indices.size() + _row_offsets.size()) * sizeof(size_type);
+            }
+
+            void setZero();
+
+            size_type findBlock(const size_type block_row, const size_type block_column) const;
+
+            template <class x_iter, class y_iter>
+            void multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin, y_iter y_end) const;
+
+           protected:
+            size_type _num_block_rows;  //!< The number of block rows
+
+            size_type _num_block_columns;  //!< The number of block columns
+
+            std::vector<size_type> _row_offsets;  //!< The offsets of the block rows
+
+            std::vector<size_type> _column_indices;  //!< The sorted block column indices of each block row
+
+            std::vector<T> _values;  //!< The row-major values of the stored blocks
+        };
+
+        /*!
+         * A block-Jacobi preconditioner which applies the inverses of the diagonal blocks of a BSR matrix
+         *
+         * block_size: The number of rows and columns of each block
+         */
+        template <typename T, int block_size>
+        class BlockJacobi {
+           public:
+            static constexpr size_type block_entries = block_size * block_size;  //!< The number of values of a block
+
+            /*!
+             * Default constructor
+             */
+            BlockJacobi() : _inverse_blocks() {}
+
+            /*!
+             * Constructor for the block-Jacobi preconditioner
+             *
+             * \param &matrix: The matrix to precondition
+             */
+            BlockJacobi(const BSRMatrix<T, block_size> &matrix) { compute(matrix); }
+
+            //! Get the number of blocks
+            size_type getNumBlocks() const { return (size_type)_inverse_blocks.size() / block_entries; }
+
+            //! Get the row-major inverses of the diagonal blocks
+            const std::vector<T> &getInverseBlocks() const { return _inverse_blocks; }
+
+            void compute(const BSRMatrix<T, block_size> &matrix);
+
+            template <class r_iter, class z_iter>
+            void apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const;
+
+           protected:
+            std::vector<T> _inverse_blocks;  //!< The row-major inverses of the diagonal blocks
+        };
+
+        template <typename T, int block_size>
+        BSRMatrix<T, block_size> buildBSRMatrix(const meshAssembly::MeshConnectivity &connectivity,
+                                                const meshAssembly::DofNumbering   &numbering);
+
+        template <typename T, int block_size, class element_jacobian_iter>
+        void scatterElementJacobian(const meshAssembly::MeshConnectivity &connectivity, const size_type element,
+                                    const element_jacobian_iter &element_jacobian_begin,
+                                    const element_jacobian_iter &element_jacobian_end,
+                                    BSRMatrix<T, block_size>    &jacobian);
+
+        template <typename T, int block_size, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const meshAssembly::MeshConnectivity &connectivity,
+                                         const meshAssembly::DofNumbering &numbering, element_kernel &kernel,
+                                         residual_iter residual_begin, residual_iter residual_end,
+                                         BSRMatrix<T, block_size> &jacobian);
+
+    }  // namespace blockSparse
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_block_sparse.tpp"
+
+#endif
@@ -0,0 +1,327 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_block_sparse.tpp
+ ******************************************************************************
+ * The template file for the block compressed sparse row (BSR) storage of the
+ * global Jacobian
+ ******************************************************************************
+ */
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include "tardigrade_block_sparse.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace blockSparse {
+
+        /*!
+         * Constructor for the BSR matrix. The values are initialized to zero.
+         *
+         * \param num_block_rows: The number of block rows
+         * \param num_block_columns: The number of block columns
+         * \param &row_offsets_begin: The starting iterator of the block row offsets
+         * \param &row_offsets_end: The stopping iterator of the block row offsets
+         * \param &column_indices_begin: The starting iterator of the sorted block column indices
+         * \param &column_indices_end: The stopping iterator of the sorted block column indices
+         */
+        template <typename T, int block_size>
+        template <class row_offset_iter, class column_index_iter>
+        BSRMatrix<T, block_size>::BSRMatrix(const size_type num_block_rows, const size_type num_block_columns,
+                                            const row_offset_iter   &row_offsets_begin,
+                                            const row_offset_iter   &row_offsets_end,
+                                            const column_index_iter &column_indices_begin,
+                                            const column_index_iter &column_indices_end)
+            : _num_block_rows(num_block_rows),
+              _num_block_columns(num_block_columns),
+              _row_offsets(row_offsets_begin, row_offsets_end),
+              _column_indices(column_indices_begin, column_indices_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(_row_offsets.size() == num_block_rows + 1,
+                                         "The row offsets must have a size of the number of block rows plus one")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((_row_offsets.front() == 0) && (_row_offsets.back() == _column_indices.size()),
+                                         "The row offsets must start at zero and end at the number of blocks")
+
+            for (size_type row = 0; row < num_block_rows; ++row) {
+                TARDIGRADE_ERROR_TOOLS_CHECK(
+                    std::is_sorted(std::cbegin(_column_indices) + _row_offsets[row],
+                                   std::cbegin(_column_indices) + _row_offsets[row + 1]),
+                    "The block column indices of block row " + std::to_string(row) + " must be sorted")
+            }
+
+            for (const auto &column : _column_indices) {
+                TARDIGRADE_ERROR_TOOLS_CHECK(column < num_block_columns,
+                                             "The block column indices must be less than the number of block columns")
+            }
+
+            _values.assign(block_entries * _column_indices.size(), T());
+        }
+
+        /*!
+         * Set all of the stored values to zero
+         */
+        template <typename T, int block_size>
+        void BSRMatrix<T, block_size>::setZero() {
+            std::fill(std::begin(_values), std::end(_values), T());
+        }
+
+        /*!
+         * Find the index of a block. The values of the block start at block_entries times the index. An error is raised
+         * if the block is not stored.
+         *
+         * \param block_row: The block row
+         * \param block_column: The block column
+         */
+        template <typename T, int block_size>
+        size_type BSRMatrix<T, block_size>::findBlock(const size_type block_row, const size_type block_column) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK(block_row < _num_block_rows,
+                                         "The block row " + std::to_string(block_row) +
+                                             " is not less than the number of block rows " +
+                                             std::to_string(_num_block_rows))
+
+            auto row_begin = std::cbegin(_column_indices) + _row_offsets[block_row];
+            auto row_end   = std::cbegin(_column_indices) + _row_offsets[block_row + 1];
+
+            auto block = std::lower_bound(row_begin, row_end, block_column);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((block != row_end) && (*block == block_column),
+                                         "The block (" + std::to_string(block_row) + ", " +
+                                             std::to_string(block_column) + ") is not in the sparsity pattern")
+
+            return (size_type)(block - std::cbegin(_column_indices));
+        }
+
+        /*!
+         * Compute the product of the matrix and a vector \f$ y_i = A_{ij} x_j \f$. The block products have a
+         * compile-time size so that they may be unrolled.
+         *
+         * \param &x_begin: The starting iterator of the vector
+         * \param &x_end: The stopping iterator of the vector
+         * \param y_begin: The starting iterator of the product
+         * \param y_end: The stopping iterator of the product
+         */
+        template <typename T, int block_size>
+        template <class x_iter, class y_iter>
+        void BSRMatrix<T, block_size>::multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin,
+                                                y_iter y_end) const {
+            using y_type = typename std::iterator_traits<y_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == getNumColumns(),
+                                         "The vector must have a size equal to the number of columns")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(y_end - y_begin) == getNumRows(),
+                                         "The product must have a size equal to the number of rows")
+
+            std::array<y_type, block_size> sum;
+
+            for (size_type row = 0; row < _num_block_rows; ++row) {
+                std::fill(std::begin(sum), std::end(sum), y_type());
+
+                for (size_type k = _row_offsets[row]; k < _row_offsets[row + 1]; ++k) {
+                    auto block = std::cbegin(_values) + block_entries * k;
+
+                    auto x = x_begin + block_size * _column_indices[k];
+
+                    for (int i = 0; i < block_size; ++i) {
+                        for (int j = 0; j < block_size; ++j) {
+                            sum[i] += *(block + block_size * i + j) * (*(x + j));
+                        }
+                    }
+                }
+
+                std::copy(std::cbegin(sum), std::cend(sum), y_begin + block_size * row);
+            }
+        }
+
+        /*!
+         * Compute the inverses of the diagonal blocks of a matrix. An error is raised if a diagonal block is missing
+         * or singular.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T, int block_size>
+        void BlockJacobi<T, block_size>::compute(const BSRMatrix<T, block_size> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumBlockRows() == matrix.getNumBlockColumns(),
+                                         "The matrix must have the same number of block rows and block columns")
+
+            using block_matrix = Eigen::Matrix<T, block_size, block_size, Eigen::RowMajor>;
+
+            _inverse_blocks.resize(block_entries * matrix.getNumBlockRows());
+
+            for (size_type row = 0; row < matrix.getNumBlockRows(); ++row) {
+                size_type diagonal;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(diagonal = matrix.findBlock(row, row));
+
+                Eigen::Map<const block_matrix> block(matrix.getValues().data() + block_entries * diagonal);
+
+                Eigen::Map<block_matrix> inverse(_inverse_blocks.data() + block_entries * row);
+
+                Eigen::FullPivLU<block_matrix> lu(block);
+
+                TARDIGRADE_ERROR_TOOLS_CHECK(lu.isInvertible(),
+                                             "The diagonal block " + std::to_string(row) + " is singular")
+
+                inverse = lu.inverse();
+            }
+        }
+
+        /*!
+         * Apply the preconditioner \f$ z_I = D_{II}^{-1} r_I \f$
+         *
+         * \param &r_begin: The starting iterator of the vector to precondition
+         * \param &r_end: The stopping iterator of the vector to precondition
+         * \param z_begin: The starting iterator of the preconditioned vector
+         * \param z_end: The stopping iterator of the preconditioned vector
+         */
+        template <typename T, int block_size>
+        template <class r_iter, class z_iter>
+        void BlockJacobi<T, block_size>::apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin,
+                                               z_iter z_end) const {
+            using z_type = typename std::iterator_traits<z_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(r_end - r_begin) == block_size * getNumBlocks(),
+                                         "The vector must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(z_end - z_begin) == block_size * getNumBlocks(),
+                                         "The preconditioned vector must have a size equal to the number of rows")
+
+            for (size_type row = 0; row < getNumBlocks(); ++row) {
+                auto inverse = std::cbegin(_inverse_blocks) + block_entries * row;
+
+                auto r = r_begin + block_size * row;
+
+                for (int i = 0; i < block_size; ++i) {
+                    z_type sum = z_type();
+
+                    for (int j = 0; j < block_size; ++j) {
+                        sum += *(inverse + block_size * i + j) * (*(r + j));
+                    }
+
+                    *(z_begin + block_size * row + i) = sum;
+                }
+            }
+        }
+
+        /*!
+         * Build the BSR Jacobian of a mesh from the node adjacency. The block size must be the number of degrees of
+         * freedom of a node. The values are initialized to zero.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         */
+        template <typename T, int block_size>
+        BSRMatrix<T, block_size> buildBSRMatrix(const meshAssembly::MeshConnectivity &connectivity,
+                                                const meshAssembly::DofNumbering   &numbering) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(numbering.getNumNodeDOF() == (size_type)block_size,
+                                         "The block size must be equal to the number of dof of a node")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(numbering.getNumNodes() == connectivity.getNumNodes(),
+                                         "The numbering must have the same number of nodes as the connectivity")
+
+            std::vector<size_type> adjacency_offsets, adjacency;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getNodeAdjacency(connectivity, adjacency_offsets, adjacency));
+
+            return BSRMatrix<T, block_size>(connectivity.getNumNodes(), connectivity.getNumNodes(),
+                                            std::cbegin(adjacency_offsets), std::cend(adjacency_offsets),
+                                            std::cbegin(adjacency), std::cend(adjacency));
+        }
+
+        /*!
+         * Add the Jacobian of an element to the global BSR Jacobian. Each node pair of the element is one block.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param element: The element
+         * \param &element_jacobian_begin: The starting iterator of the row-major node-major element Jacobian
+         * \param &element_jacobian_end: The stopping iterator of the row-major node-major element Jacobian
+         * \param &jacobian: The global Jacobian
+         */
+        template <typename T, int block_size, class element_jacobian_iter>
+        void scatterElementJacobian(const meshAssembly::MeshConnectivity &connectivity, const size_type element,
+                                    const element_jacobian_iter &element_jacobian_begin,
+                                    const element_jacobian_iter &element_jacobian_end,
+                                    BSRMatrix<T, block_size>    &jacobian) {
+            const size_type nodes_per_element = connectivity.getNodesPerElement();
+            const size_type num_element_dof   = block_size * nodes_per_element;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(element_jacobian_end - element_jacobian_begin) == num_element_dof * num_element_dof,
+                "The element Jacobian must have a size equal to the square of the number of element dof")
+
+            std::vector<T> &values = jacobian.getValues();
+
+            auto nodes = connectivity.getElementNodesBegin(element);
+
+            for (size_type a = 0; a < nodes_per_element; ++a) {
+                for (size_type b = 0; b < nodes_per_element; ++b) {
+                    const size_type index = jacobian.findBlock(*(nodes + a), *(nodes + b));
+
+                    auto block = std::begin(values) + BSRMatrix<T, block_size>::block_entries * index;
+
+                    auto element_block =
+                        element_jacobian_begin + num_element_dof * block_size * a + block_size * b;
+
+                    for (int i = 0; i < block_size; ++i) {
+                        for (int j = 0; j < block_size; ++j) {
+                            *(block + block_size * i + j) += *(element_block + num_element_dof * i + j);
+                        }
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Assemble the global residual and BSR Jacobian of a mesh by looping over the elements. The element kernel has
+         * the interface of meshAssembly::assembleResidualAndJacobian.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         * \param &jacobian: The global Jacobian from buildBSRMatrix
+         */
+        template <typename T, int block_size, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const meshAssembly::MeshConnectivity &connectivity,
+                                         const meshAssembly::DofNumbering &numbering, element_kernel &kernel,
+                                         residual_iter residual_begin, residual_iter residual_end,
+                                         BSRMatrix<T, block_size> &jacobian) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(numbering.getNumNodeDOF() == (size_type)block_size,
+                                         "The block size must be equal to the number of dof of a node")
+
+            const size_type num_element_dof = connectivity.getNodesPerElement() * block_size;
+
+            std::vector<residual_type> element_residual(num_element_dof);
+
+            std::vector<T> element_jacobian(num_element_dof * num_element_dof);
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            jacobian.setZero();
+
+            for (size_type e = 0; e < connectivity.getNumElements(); ++e) {
+                std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                std::fill(std::begin(element_jacobian), std::end(element_jacobian), T());
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(kernel(e, std::begin(element_residual), std::end(element_residual),
+                                                    std::begin(element_jacobian), std::end(element_jacobian)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::scatterElementResidual(
+                    connectivity, numbering, e, std::cbegin(element_residual), std::cend(element_residual),
+                    residual_begin, residual_end));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementJacobian(connectivity, e, std::cbegin(element_jacobian),
+                                                                    std::cend(element_jacobian), jacobian));
+            }
+        }
+
+    }  // namespace blockSparse
+
+}  // namespace tardigradeBalanceEquations
@@ -46,7 +46,11 @@ namespace tardigradeBalanceEquations {
              * \param &result: The resulting error between the internal energy DOF and the material response
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                INTERNAL_ENERGY_CONSTRAINT_RESIDUAL,
+                costModel::getInternalEnergyConstraintResidualCost().flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 predicted_internal_energy_index < (unsigned int)(material_response_end - material_response_begin),
                 "The index for the predicted internal energy is out of range for the material response")
 
@@ -84,7 +88,11 @@ namespace tardigradeBalanceEquations {
              * \param &result: The resulting error between the internal energy DOF and the material response
              */
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                INTERNAL_ENERGY_CONSTRAINT_RESIDUAL,
+                costModel::getInternalEnergyConstraintResidualCost().flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 predicted_internal_energy_index < (unsigned int)(material_response_end - material_response_begin),
                 "The index for the predicted internal energy is out of range for the material response")
 
@@ -179,25 +187,37 @@ namespace tardigradeBalanceEquations {
              * displacement
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                INTERNAL_ENERGY_CONSTRAINT_JACOBIAN,
+                costModel::getInternalEnergyConstraintJacobianCost(dRdRho_end - dRdRho_begin, material_response_dim,
+                                                                   material_response_num_dof)
+                    .flops)
+
             const unsigned int     nphases            = (unsigned int)(dRdRho_end - dRdRho_begin);
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                CHAIN_RULE,
+                costModel::getInternalEnergyConstraintJacobianCost(nphases, material_response_dim,
+                                                                   material_response_num_dof)
+                    .chain_rule_flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_dim == (unsigned int)(dRdU_end - dRdU_begin),
                 "dRdU must be a consistent size with the material response dimension and the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_dim == (unsigned int)(dRdW_end - dRdW_begin),
                 "dRdW must be a consistent size with the material response dimension and the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 material_response_dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                 "dRdUMesh must be the same size as the spatial dimension of the material response")
 
@@ -385,6 +405,118 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        template <int material_response_dim, int predicted_internal_energy_index, int material_response_num_dof,
+                  class material_response_pattern, typename internal_energy_type, class material_response_iter,
+                  class material_response_jacobian_iter, typename test_function_type,
+                  typename interpolation_function_type, class interpolation_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, typename dUDotdU_type, typename result_type,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index, int displacement_index,
+                  int velocity_index, int temperature_index, int internal_energy_index, int volume_fraction_index,
+                  int additional_dof_index>
+        void computeInternalEnergyConstraintCompressed(
+            const internal_energy_type &internal_energy, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const test_function_type &test_function, const interpolation_function_type &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dUDotdU_type dUDotdU, const unsigned int nphases, const unsigned int phase, result_type &result,
+            jacobian_iter jacobian_begin, jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin,
+            dRdUMesh_iter dRdUMesh_end) {
+            /*!
+             * Compute the value of the constraint on the internal energy and its Jacobian w.r.t. the degrees of freedom
+             * in compressed form. Only the columns of the structurally non-zero field blocks of
+             * InternalEnergyConstraintSparsity< material_response_pattern > are stored, computed, or zeroed. The
+             * layout of the columns is given by the functions of jacobianSparsity.
+             *
+             * The material response Jacobian is assumed to be zero outside of material_response_pattern. If the
+             * pattern is jacobianSparsity::DensePattern the result is identical to the dense overload.
+             *
+             * material_response_pattern: The structural sparsity pattern of the material response Jacobian
+             *
+             * \param &internal_energy: The internal energy degree of freedom
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian vector
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian vector
+             * \param &test_function: The test function from the variational solution strategy
+             * \param &interpolation_function: The current value of the interpolation function
+             * \param &interpolation_function_gradient_begin: The starting iterator of the current value of the spatial
+             * gradient of the interpolation function
+             * \param &interpolation_function_gradient_end: The stopping iterator of the current value of the spatial
+             * gradient of the interpolation function
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dUDotdU: The derivative of the phase velocity w.r.t. the phase displacement dof
+             * \param nphases: The number of phases
+             * \param phase: The current active phase
+             * \param &result: The resulting error between the internal energy DOF and the material response
+             * \param &jacobian_begin: The starting iterator of the compressed Jacobian
+             * \param &jacobian_end: The stopping iterator of the compressed Jacobian
+             * \param &dRdUMesh_begin: The starting iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             * \param &dRdUMesh_end: The stopping iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             */
+
+            using jacobian_type = typename std::iterator_traits<jacobian_iter>::value_type;
+            using pattern       = InternalEnergyConstraintSparsity<material_response_pattern>;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int num_columns =
+                jacobianSparsity::getNumColumns<pattern>(material_response_dim, nphases, num_additional_dof);
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of the number of compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                material_response_dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+                "dRdUMesh must be the same size as the spatial dimension of the material response")
+
+            computeInternalEnergyConstraint<predicted_internal_energy_index>(internal_energy, material_response_begin,
+                                                                             material_response_end, test_function,
+                                                                             result);
+
+            const std::array<unsigned int, 1>  response_rows         = {predicted_internal_energy_index};
+            const std::array<jacobian_type, 1> response_coefficients = {test_function};
+
+            const std::array<unsigned int, jacobianSparsity::num_field_blocks> field_indices = {
+                density_index,         velocity_index,        displacement_index,  temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index};
+
+            std::fill(jacobian_begin, jacobian_end, jacobian_type());
+
+            std::fill(dRdUMesh_begin, dRdUMesh_end, jacobian_type());
+
+            jacobianSparsity::addMaterialResponseJacobian<pattern, material_response_pattern, material_response_dim,
+                                                          material_response_dim, 1>(
+                nphases, num_additional_dof, phase, field_indices, std::cbegin(response_rows),
+                std::cend(response_rows), std::cbegin(response_coefficients), std::cend(response_coefficients),
+                material_response_jacobian_begin, material_response_jacobian_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dUDotdU,
+                jacobian_begin, jacobian_end, dRdUMesh_begin, dRdUMesh_end);
+
+            // Direct dependence on the dof of the current phase
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::INTERNAL_ENERGY,
+                                                                              material_response_dim, nphases,
+                                                                              num_additional_dof, phase)) -=
+                test_function * interpolation_function;
+
+            for (unsigned int a = 0; a < material_response_dim; ++a) {
+                *(dRdUMesh_begin + a) += result * (*(interpolation_function_gradient_begin + a));
+            }
+        }
+
         template <int material_response_dim, int predicted_internal_energy_index, int material_response_num_dof,
                   typename internal_energy_type, typename density_type, class material_response_iter,
                   class material_response_jacobian_iter, typename test_function_type,
@@ -476,25 +608,37 @@ namespace tardigradeBalanceEquations {
              * displacement
              */
 
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                INTERNAL_ENERGY_CONSTRAINT_JACOBIAN,
+                costModel::getInternalEnergyConstraintJacobianCost(dRdRho_end - dRdRho_begin, material_response_dim,
+                                                                   material_response_num_dof)
+                    .flops)
+
             const unsigned int     nphases            = (unsigned int)(dRdRho_end - dRdRho_begin);
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                CHAIN_RULE,
+                costModel::getInternalEnergyConstraintJacobianCost(nphases, material_response_dim,
+                                                                   material_response_num_dof)
+                    .chain_rule_flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_dim == (unsigned int)(dRdU_end - dRdU_begin),
                 "dRdU must be a consistent size with the material response dimension and the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_dim == (unsigned int)(dRdW_end - dRdW_begin),
                 "dRdW must be a consistent size with the material response dimension and the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must be the same size as the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 material_response_dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                 "dRdUMesh must be the same size as the spatial dimension of the material response")
 
@@ -685,6 +829,126 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        template <int material_response_dim, int predicted_internal_energy_index, int material_response_num_dof,
+                  class material_response_pattern, typename internal_energy_type, typename density_type,
+                  class material_response_iter, class material_response_jacobian_iter, typename test_function_type,
+                  typename interpolation_function_type, class interpolation_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, typename dUDotdU_type, typename result_type,
+                  class jacobian_iter, class dRdUMesh_iter, int density_index, int displacement_index,
+                  int velocity_index, int temperature_index, int internal_energy_index, int volume_fraction_index,
+                  int additional_dof_index>
+        void computeInternalEnergyConstraintCompressed(
+            const internal_energy_type &internal_energy, const density_type &density,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const test_function_type &test_function, const interpolation_function_type &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dUDotdU_type dUDotdU, const unsigned int nphases, const unsigned int phase, result_type &result,
+            jacobian_iter jacobian_begin, jacobian_iter jacobian_end, dRdUMesh_iter dRdUMesh_begin,
+            dRdUMesh_iter dRdUMesh_end) {
+            /*!
+             * Compute the value of the constraint on the internal energy scaled by the apparent density and its
+             * Jacobian w.r.t. the degrees of freedom
+             * in compressed form. Only the columns of the structurally non-zero field blocks of
+             * DensityInternalEnergyConstraintSparsity< material_response_pattern > are stored, computed, or zeroed. The
+             * layout of the columns is given by the functions of jacobianSparsity.
+             *
+             * The material response Jacobian is assumed to be zero outside of material_response_pattern. If the
+             * pattern is jacobianSparsity::DensePattern the result is identical to the dense overload.
+             *
+             * material_response_pattern: The structural sparsity pattern of the material response Jacobian
+             *
+             * \param &internal_energy: The internal energy degree of freedom
+             * \param &density: The apparent density degree of freedom
+             * \param &material_response_begin: The starting iterator of the material response vector
+             * \param &material_response_end: The stopping iterator of the material response vector
+             * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian vector
+             * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian vector
+             * \param &test_function: The test function from the variational solution strategy
+             * \param &interpolation_function: The current value of the interpolation function
+             * \param &interpolation_function_gradient_begin: The starting iterator of the current value of the spatial
+             * gradient of the interpolation function
+             * \param &interpolation_function_gradient_end: The stopping iterator of the current value of the spatial
+             * gradient of the interpolation function
+             * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+             * material response dof vector
+             * \param &dUDotdU: The derivative of the phase velocity w.r.t. the phase displacement dof
+             * \param nphases: The number of phases
+             * \param phase: The current active phase
+             * \param &result: The resulting error between the internal energy DOF and the material response
+             * \param &jacobian_begin: The starting iterator of the compressed Jacobian
+             * \param &jacobian_end: The stopping iterator of the compressed Jacobian
+             * \param &dRdUMesh_begin: The starting iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             * \param &dRdUMesh_end: The stopping iterator of the derivative of the residual w.r.t. the mesh
+             * displacement
+             */
+
+            using jacobian_type = typename std::iterator_traits<jacobian_iter>::value_type;
+            using pattern       = DensityInternalEnergyConstraintSparsity<material_response_pattern>;
+
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int num_columns =
+                jacobianSparsity::getNumColumns<pattern>(material_response_dim, nphases, num_additional_dof);
+
+            TARDIGRADE_BALANCE_EQS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of the number of compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                material_response_dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+                "dRdUMesh must be the same size as the spatial dimension of the material response")
+
+            computeInternalEnergyConstraint<predicted_internal_energy_index>(internal_energy, density,
+                                                                             material_response_begin,
+                                                                             material_response_end, test_function,
+                                                                             result);
+
+            const std::array<unsigned int, 1>  response_rows         = {predicted_internal_energy_index};
+            const std::array<jacobian_type, 1> response_coefficients = {test_function * density};
+
+            const std::array<unsigned int, jacobianSparsity::num_field_blocks> field_indices = {
+                density_index,         velocity_index,        displacement_index,  temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index};
+
+            std::fill(jacobian_begin, jacobian_end, jacobian_type());
+
+            std::fill(dRdUMesh_begin, dRdUMesh_end, jacobian_type());
+
+            jacobianSparsity::addMaterialResponseJacobian<pattern, material_response_pattern, material_response_dim,
+                                                          material_response_dim, 1>(
+                nphases, num_additional_dof, phase, field_indices, std::cbegin(response_rows),
+                std::cend(response_rows), std::cbegin(response_coefficients), std::cend(response_coefficients),
+                material_response_jacobian_begin, material_response_jacobian_end, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dUDotdU,
+                jacobian_begin, jacobian_end, dRdUMesh_begin, dRdUMesh_end);
+
+            // Direct dependence on the dof of the current phase
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::DENSITY,
+                                                                              material_response_dim, nphases,
+                                                                              num_additional_dof, phase)) +=
+                test_function * (*(material_response_begin + predicted_internal_energy_index)) * interpolation_function;
+
+            *(jacobian_begin + jacobianSparsity::getPhaseFieldOffset<pattern>(jacobianSparsity::INTERNAL_ENERGY,
+                                                                              material_response_dim, nphases,
+                                                                              num_additional_dof, phase)) -=
+                test_function * interpolation_function;
+
+            for (unsigned int a = 0; a < material_response_dim; ++a) {
+                *(dRdUMesh_begin + a) += result * (*(interpolation_function_gradient_begin + a));
+            }
+        }
+
         template <int predicted_internal_energy_index, class internal_energy_iter, class material_response_iter,
                   typename test_function_type, class result_iter>
         void computeInternalEnergyConstraint(const internal_energy_iter   &internal_energy_begin,
@@ -723,10 +987,10 @@ namespace tardigradeBalanceEquations {
             const unsigned int material_response_size =
                 (unsigned int)(material_response_end - material_response_begin) / nphases;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The number of internal energy values must be equal to the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size == (unsigned int)(material_response_end - material_response_begin),
                 "The material response vector must be a scalar multiple of the number of phases")
 
@@ -781,10 +1045,10 @@ namespace tardigradeBalanceEquations {
             const unsigned int material_response_size =
                 (unsigned int)(material_response_end - material_response_begin) / nphases;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The number of internal energy values must be equal to the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size == (unsigned int)(material_response_end - material_response_begin),
                 "The material response vector must be a scalar multiple of the number of phases")
 
@@ -896,14 +1160,14 @@ namespace tardigradeBalanceEquations {
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The number of internal energy values must be equal to the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size == (unsigned int)(material_response_end - material_response_begin),
                 "The material response vector must be a scalar multiple of the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size * (1 + material_response_dim) *
                         (nphases * num_phase_dof + num_additional_dof) ==
                     (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
@@ -920,27 +1184,27 @@ namespace tardigradeBalanceEquations {
                     "\n  actual jacobian size       : " +
                     std::to_string((unsigned int)(material_response_jacobian_end - material_response_jacobian_begin)))
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_dim * (nphases * num_phase_dof + num_additional_dof) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_dim * (nphases * num_phase_dof + num_additional_dof) ==
                                              (unsigned int)(full_material_response_dof_gradient_end -
                                                             full_material_response_dof_gradient_begin),
                                          "The full material response dof gradient have a size of the material response "
                                          "dimension times the number of dof in the material response")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * nphases * material_response_dim == (unsigned int)(dRdU_end - dRdU_begin),
                 "dRdU must be a consistent size with the material response dimension and the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * nphases * material_response_dim == (unsigned int)(dRdW_end - dRdW_begin),
                 "dRdW must be a consistent size with the material response dimension and the number of phases squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must be the same size as the number of phases squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must be the same size as the number of phases squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_dim ==
                                              (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "dRdUMesh must be the same size as the spatial dimension of the material "
                                          "response times the number of phases")
@@ -1083,14 +1347,14 @@ namespace tardigradeBalanceEquations {
             constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
             constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases == (unsigned int)(internal_energy_end - internal_energy_begin),
                                          "The number of internal energy values must be equal to the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * material_response_size == (unsigned int)(material_response_end - material_response_begin),
                 "The material response vector must be a scalar multiple of the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_size * (1 + material_response_dim) *
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_size * (1 + material_response_dim) *
                                                  (nphases * num_phase_dof + num_additional_dof) ==
                                              (unsigned int)(material_response_jacobian_end -
                                                             material_response_jacobian_begin),
@@ -1098,27 +1362,27 @@ namespace tardigradeBalanceEquations {
                                          "number of phases, the material response size and 1 + the material response "
                                          "dimension times the number of dof in the material response")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_dim * (nphases * num_phase_dof + num_additional_dof) ==
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_dim * (nphases * num_phase_dof + num_additional_dof) ==
                                              (unsigned int)(full_material_response_dof_gradient_end -
                                                             full_material_response_dof_gradient_begin),
                                          "The full material response dof gradient have a size of the material response "
                                          "dimension times the number of dof in the material resionse")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * nphases * material_response_dim == (unsigned int)(dRdU_end - dRdU_begin),
                 "dRdU must be a consistent size with the material response dimension and the number of phases")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(
+            TARDIGRADE_BALANCE_EQS_CHECK(
                 nphases * nphases * material_response_dim == (unsigned int)(dRdW_end - dRdW_begin),
                 "dRdW must be a consistent size with the material response dimension and the number of phases squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
                                          "dRdTheta must be the same size as the number of phases squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * nphases == (unsigned int)(dRdE_end - dRdE_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * nphases == (unsigned int)(dRdE_end - dRdE_begin),
                                          "dRdE must be the same size as the number of phases squared")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(nphases * material_response_dim ==
+            TARDIGRADE_BALANCE_EQS_CHECK(nphases * material_response_dim ==
                                              (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "dRdUMesh must be the same size as the spatial dimension of the material "
                                          "response times the number of phases")
@@ -1184,13 +1448,13 @@ namespace tardigradeBalanceEquations {
 
             using result_type = typename std::iterator_traits<result_iter>::value_type;
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int length =
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int length =
                                             (unsigned int)(displacement_dot_end - displacement_dot_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(length == (unsigned int)(velocity_end - velocity_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(length == (unsigned int)(velocity_end - velocity_begin),
                                          "The velocity and density dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(length == (unsigned int)(result_end - result_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(length == (unsigned int)(result_end - result_begin),
                                          "The result and density dot vectors must be the same size")
 
             std::transform(displacement_dot_begin, displacement_dot_end, velocity_begin, result_begin,
@@ -1251,16 +1515,16 @@ namespace tardigradeBalanceEquations {
              * displacement
              */
 
-            TARDIGRADE_ERROR_TOOLS_EVAL(const unsigned int length =
+            TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int length =
                                             (unsigned int)(displacement_dot_end - displacement_dot_begin);)
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(length == (unsigned int)(dRdD_end - dRdD_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(length == (unsigned int)(dRdD_end - dRdD_begin),
                                          "The dRdD and density dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(length == (unsigned int)(dRdV_end - dRdV_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(length == (unsigned int)(dRdV_end - dRdV_begin),
                                          "The dRdV and density dot vectors must be the same size")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(length * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
+            TARDIGRADE_BALANCE_EQS_CHECK(length * dim == (unsigned int)(dRdUMesh_end - dRdUMesh_begin),
                                          "The dRdUMesh vector must be the length of the density dot vector time the "
                                          "length of the interpolation function gradient vector")
 
@@ -1289,7 +1553,7 @@ namespace tardigradeBalanceEquations {
                   int trace_mass_change_velocity_gradient_index, class density_iter, class volume_fraction_iter,
                   class material_response_iter, class material_response_jacobian_iter, class mixture_response_iter,
                   class mixture_jacobian_iter, int density_index, int volume_fraction_index>
-        inline void computeMixtureMaterialResponse(
+        void computeMixtureMaterialResponse(
             const density_iter &density_begin, const density_iter &density_end,
             const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
             const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
@@ -1328,17 +1592,21 @@ namespace tardigradeBalanceEquations {
 
             auto num_phases = (material_response_end - material_response_begin) / material_response_size;
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_size * num_dof ==
+            TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(
+                MIXTURE_MATERIAL_RESPONSE,
+                costModel::getMixtureMaterialResponseCost(dim, num_phases, num_dof).flops)
+
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_size * num_dof ==
                                              (unsigned int)(mixture_jacobian_end - mixture_jacobian_begin),
                                          "The mixture jacobian size must be an integer multiple of the material "
                                          "response size (i.e., the number of degrees of freedom)")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_size * num_phases ==
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_size * num_phases ==
                                              (unsigned int)(material_response_end - material_response_begin),
                                          "The material response size must be an integer multiple of the mixture "
                                          "response size (i.e., the number of true phases) )")
 
-            TARDIGRADE_ERROR_TOOLS_CHECK(material_response_size * num_phases * num_dof ==
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_size * num_phases * num_dof ==
                                              (unsigned int)(material_response_jacobian_end -
                                                             material_response_jacobian_begin),
                                          "The material response jacobian size must be an integer multiple of the "
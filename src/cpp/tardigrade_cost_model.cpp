@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_cost_model.cpp
+ ******************************************************************************
+ * The source file for the analytic cost model of the kernels
+ ******************************************************************************
+ */
+
+#include "tardigrade_cost_model.h"
\ No newline at end of file
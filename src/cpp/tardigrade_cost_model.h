@@ -0,0 +1,161 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_cost_model.h
+ ******************************************************************************
+ * The header file for the analytic cost model of the kernels. Each kernel
+ * exposes the floating point operations and the bytes it reads and writes
+ * for one call as a function of the spatial dimension, the number of phases,
+ * the dimension and number of degrees of freedom of the material response,
+ * and the node count of the element. The operation counts are exact for the
+ * balance equations with a material response dimension equal to the spatial
+ * dimension. They were fit to the operations counted by
+ * bench_tardigrade_balance_equations for spatial dimensions of two through
+ * eight and are checked against the counts of the benchmark. The bytes are
+ * the compulsory traffic of the values a call reads and writes assuming that
+ * nothing is reused from the cache between calls. The counts may be combined
+ * with measured times to place each kernel on a roofline.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_COST_MODEL_H
+#define TARDIGRADE_COST_MODEL_H
+
+namespace tardigradeBalanceEquations {
+
+    namespace costModel {
+
+        typedef unsigned int size_type;  //!< The type of the sizes of the kernels
+
+        typedef double floatType;  //!< The type of the counts
+
+        constexpr size_type bytes_per_value = sizeof(floatType);  //!< The bytes of each value read or written
+
+        /*!
+         * The cost of a call of a kernel
+         */
+        struct KernelCost {
+            floatType flops = 0;  //!< The floating point operations
+
+            floatType chain_rule_flops = 0;  //!< The operations of the contractions with the material response Jacobian
+
+            floatType bytes_read = 0;  //!< The bytes read
+
+            floatType bytes_written = 0;  //!< The bytes written
+
+            //! Get the total bytes moved
+            floatType getBytes() const { return bytes_read + bytes_written; }
+
+            //! Get the arithmetic intensity in floating point operations per byte
+            floatType getArithmeticIntensity() const { return (getBytes() > 0) ? flops / getBytes() : 0; }
+
+            /*!
+             * Add the cost of another call
+             *
+             * \param &other: The cost of the other call
+             */
+            KernelCost &operator+=(const KernelCost &other) {
+                flops += other.flops;
+                chain_rule_flops += other.chain_rule_flops;
+                bytes_read += other.bytes_read;
+                bytes_written += other.bytes_written;
+                return *this;
+            }
+
+            /*!
+             * Get the sum of the cost and the cost of another call
+             *
+             * \param &other: The cost of the other call
+             */
+            KernelCost operator+(const KernelCost &other) const {
+                KernelCost cost = *this;
+                cost += other;
+                return cost;
+            }
+
+            /*!
+             * Scale the cost by a number of calls
+             *
+             * \param calls: The number of calls
+             */
+            KernelCost operator*(const floatType calls) const {
+                KernelCost cost = *this;
+                cost.flops *= calls;
+                cost.chain_rule_flops *= calls;
+                cost.bytes_read *= calls;
+                cost.bytes_written *= calls;
+                return cost;
+            }
+        };
+
+        inline KernelCost makeKernelCost(const floatType flops, const floatType chain_rule_flops,
+                                         const floatType values_read, const floatType values_written);
+
+        inline KernelCost makeJacobianCost(const floatType fixed_flops, const floatType dof_flops,
+                                           const floatType phase_flops, const floatType residual_values,
+                                           const floatType response_rows, const floatType output_dim,
+                                           const size_type dim, const size_type nphases,
+                                           const size_type material_response_dim,
+                                           const size_type material_response_num_dof);
+
+        inline size_type getPhaseDOFCount(const size_type material_response_dim);
+
+        inline size_type getMaterialPointDOFCount(const size_type nphases, const size_type material_response_dim,
+                                                  const size_type material_response_num_dof);
+
+        inline size_type getMaterialResponseSize(const size_type material_response_dim);
+
+        inline KernelCost getBalanceOfMassResidualCost(const size_type dim);
+
+        inline KernelCost getBalanceOfMassJacobianCost(const size_type dim, const size_type nphases,
+                                                       const size_type material_response_dim,
+                                                       const size_type material_response_num_dof);
+
+        inline KernelCost getBalanceOfLinearMomentumResidualCost(const size_type dim);
+
+        inline KernelCost getBalanceOfLinearMomentumJacobianCost(const size_type dim, const size_type nphases,
+                                                                 const size_type material_response_dim,
+                                                                 const size_type material_response_num_dof);
+
+        inline KernelCost getBalanceOfEnergyResidualCost(const size_type dim);
+
+        inline KernelCost getBalanceOfEnergyJacobianCost(const size_type dim, const size_type nphases,
+                                                         const size_type material_response_dim,
+                                                         const size_type material_response_num_dof);
+
+        inline KernelCost getBalanceOfVolumeFractionResidualCost(const size_type dim);
+
+        inline KernelCost getBalanceOfVolumeFractionJacobianCost(const size_type dim, const size_type nphases,
+                                                                 const size_type material_response_dim,
+                                                                 const size_type material_response_num_dof);
+
+        inline KernelCost getInternalEnergyConstraintResidualCost();
+
+        inline KernelCost getInternalEnergyConstraintJacobianCost(const size_type nphases,
+                                                                  const size_type material_response_dim,
+                                                                  const size_type material_response_num_dof);
+
+        inline KernelCost getSurfaceGrowthResidualCost(const size_type dim);
+
+        inline KernelCost getSurfaceGrowthJacobianCost(const size_type dim);
+
+        inline KernelCost getMixtureMaterialResponseCost(const size_type dim, const size_type nphases,
+                                                         const size_type num_dof);
+
+        inline KernelCost getShapeFunctionCost(const size_type node_count, const size_type dim);
+
+        inline KernelCost getShapeFunctionGradientCost(const size_type node_count, const size_type dim);
+
+        inline KernelCost getJacobianOfTransformationCost(const size_type node_count, const size_type dim);
+
+        inline KernelCost getInterpolationCost(const size_type node_count, const size_type num_values);
+
+        inline KernelCost getQuantityGradientCost(const size_type node_count, const size_type num_values,
+                                                  const size_type dim);
+
+    }  // namespace costModel
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_cost_model.tpp"
+
+#endif
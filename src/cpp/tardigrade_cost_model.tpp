@@ -0,0 +1,378 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_cost_model.tpp
+ ******************************************************************************
+ * The template file for the analytic cost model of the kernels
+ ******************************************************************************
+ */
+
+#include "tardigrade_cost_model.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace costModel {
+
+        /*!
+         * Build the cost of a call from the number of values read and written
+         *
+         * \param flops: The floating point operations
+         * \param chain_rule_flops: The operations of the contractions with the material response Jacobian
+         * \param values_read: The number of values read
+         * \param values_written: The number of values written
+         */
+        inline KernelCost makeKernelCost(const floatType flops, const floatType chain_rule_flops,
+                                         const floatType values_read, const floatType values_written) {
+            KernelCost cost;
+
+            cost.flops            = flops;
+            cost.chain_rule_flops = chain_rule_flops;
+            cost.bytes_read       = bytes_per_value * values_read;
+            cost.bytes_written    = bytes_per_value * values_written;
+
+            return cost;
+        }
+
+        /*!
+         * Get the number of degrees of freedom of a phase i.e., the density, the velocity, the internal energy, the
+         * volume fraction, and the displacement
+         *
+         * \param material_response_dim: The spatial dimension of the material response
+         */
+        inline size_type getPhaseDOFCount(const size_type material_response_dim) {
+            return 4 + 2 * material_response_dim;
+        }
+
+        /*!
+         * Get the number of degrees of freedom of a material point i.e., the number of phases times the number of
+         * degrees of freedom of a phase plus the number of additional degrees of freedom
+         *
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline size_type getMaterialPointDOFCount(const size_type nphases, const size_type material_response_dim,
+                                                  const size_type material_response_num_dof) {
+            const size_type num_phase_dof = getPhaseDOFCount(material_response_dim);
+
+            return nphases * num_phase_dof + material_response_num_dof - num_phase_dof;
+        }
+
+        /*!
+         * Get the number of values of the material response of a phase i.e., the Cauchy stress, the predicted
+         * internal energy, the specific heat, the body force, the interphasic force, the heat flux, the internal
+         * heat generation, the interphasic heat transfer, and the trace of the mass change velocity gradient
+         *
+         * \param material_response_dim: The spatial dimension of the material response
+         */
+        inline size_type getMaterialResponseSize(const size_type material_response_dim) {
+            return material_response_dim * material_response_dim + 3 * material_response_dim + 5;
+        }
+
+        /*!
+         * Build the cost of a Jacobian of a phase. The Jacobian contracts the rows of the material response Jacobian
+         * it uses with each degree of freedom of the material point and its gradient.
+         *
+         * \param fixed_flops: The operations which do not depend on the degrees of freedom
+         * \param dof_flops: The operations of each degree of freedom of the material point
+         * \param phase_flops: The operations of each phase
+         * \param residual_values: The values read by the residual
+         * \param response_rows: The rows of the material response Jacobian used by the kernel
+         * \param output_dim: The number of components of the residual
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline KernelCost makeJacobianCost(const floatType fixed_flops, const floatType dof_flops,
+                                           const floatType phase_flops, const floatType residual_values,
+                                           const floatType response_rows, const floatType output_dim,
+                                           const size_type dim, const size_type nphases,
+                                           const size_type material_response_dim,
+                                           const size_type material_response_num_dof) {
+            const floatType num_dof =
+                getMaterialPointDOFCount(nphases, material_response_dim, material_response_num_dof);
+
+            const floatType chain_rule_flops = dof_flops * num_dof + phase_flops * nphases;
+
+            // The residual values, the interpolation function and its gradient, the two rate derivative scalars, the
+            // rows of the material response Jacobian, and the gradients of the degrees of freedom
+            const floatType values_read = residual_values + 1 + dim + 2 +
+                                          response_rows * (1 + material_response_dim) * num_dof +
+                                          material_response_dim * num_dof;
+
+            // The derivatives w.r.t. the degrees of freedom and the mesh displacement and the residual
+            const floatType values_written = output_dim * (num_dof + dim) + output_dim;
+
+            return makeKernelCost(fixed_flops + chain_rule_flops, chain_rule_flops, values_read, values_written);
+        }
+
+        /*!
+         * Get the cost of the residual of the balance of mass of a phase for one test function
+         *
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getBalanceOfMassResidualCost(const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(4 * d + 3, 0, d * d + 2 * d + 4, 1);
+        }
+
+        /*!
+         * Get the cost of the Jacobian of the balance of mass of a phase for one test and interpolation function
+         *
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline KernelCost getBalanceOfMassJacobianCost(const size_type dim, const size_type nphases,
+                                                       const size_type material_response_dim,
+                                                       const size_type material_response_num_dof) {
+            const floatType d = dim;
+
+            return makeJacobianCost(4 * d * d * d + 8 * d * d + 17 * d + 9, 4 * d * d + 3 * d + 3, d * d + d,
+                                    d * d + 2 * d + 4, 1, 1, dim, nphases, material_response_dim,
+                                    material_response_num_dof);
+        }
+
+        /*!
+         * Get the cost of the residual of the balance of linear momentum of a phase for one test function
+         *
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getBalanceOfLinearMomentumResidualCost(const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(6 * d * d + 15 * d, 0, 2 * d * d + 6 * d + 4, d);
+        }
+
+        /*!
+         * Get the cost of the Jacobian of the balance of linear momentum of a phase for one test and interpolation
+         * function. The contraction of the Cauchy stress rows of the material response Jacobian with the gradients of
+         * the degrees of freedom grows with the fifth power of the spatial dimension.
+         *
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline KernelCost getBalanceOfLinearMomentumJacobianCost(const size_type dim, const size_type nphases,
+                                                                 const size_type material_response_dim,
+                                                                 const size_type material_response_num_dof) {
+            const floatType d = dim;
+
+            const floatType m = material_response_dim;
+
+            return makeJacobianCost(4 * d * d * d * d + 10 * d * d * d + 38 * d * d + 28 * d,
+                                    4 * d * d * d * d * d + 7 * d * d * d * d + 10 * d * d * d + 6 * d * d + 3 * d,
+                                    d * d * d * d * d + 2 * d * d * d * d + 2 * d * d * d + d * d,
+                                    2 * d * d + 6 * d + 4, m * m + 2 * m, d, dim, nphases, material_response_dim,
+                                    material_response_num_dof);
+        }
+
+        /*!
+         * Get the cost of the residual of the balance of energy of a phase for one test function
+         *
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getBalanceOfEnergyResidualCost(const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(3 * d * d + 15 * d + 20, 0, 2 * d * d + 6 * d + 8, 1);
+        }
+
+        /*!
+         * Get the cost of the Jacobian of the balance of energy of a phase for one test and interpolation function
+         *
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline KernelCost getBalanceOfEnergyJacobianCost(const size_type dim, const size_type nphases,
+                                                         const size_type material_response_dim,
+                                                         const size_type material_response_num_dof) {
+            const floatType d = dim;
+
+            const floatType m = material_response_dim;
+
+            return makeJacobianCost(4 * d * d * d + 23 * d * d + 51 * d + 52,
+                                    4 * d * d * d * d + 11 * d * d * d + 17 * d * d + 12 * d + 6,
+                                    d * d * d * d + 3 * d * d * d + 4 * d * d + 2 * d, 2 * d * d + 6 * d + 8,
+                                    m * m + 2 * m + 2, 1, dim, nphases, material_response_dim,
+                                    material_response_num_dof);
+        }
+
+        /*!
+         * Get the cost of the residual of the balance of volume fraction of a phase for one test function
+         *
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getBalanceOfVolumeFractionResidualCost(const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(2 * d + 6, 0, 2 * d + 7, 1);
+        }
+
+        /*!
+         * Get the cost of the Jacobian of the balance of volume fraction of a phase for one test and interpolation
+         * function
+         *
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline KernelCost getBalanceOfVolumeFractionJacobianCost(const size_type dim, const size_type nphases,
+                                                                 const size_type material_response_dim,
+                                                                 const size_type material_response_num_dof) {
+            const floatType d = dim;
+
+            return makeJacobianCost(4 * d * d + 10 * d + 23, 8 * d * d + 6 * d + 6, 2 * d * d + 2 * d, 2 * d + 7, 2,
+                                    1, dim, nphases, material_response_dim, material_response_num_dof);
+        }
+
+        /*!
+         * Get the cost of the residual of the internal energy constraint of a phase for one test function
+         */
+        inline KernelCost getInternalEnergyConstraintResidualCost() { return makeKernelCost(2, 0, 3, 1); }
+
+        /*!
+         * Get the cost of the Jacobian of the internal energy constraint of a phase for one test and interpolation
+         * function. The constraint has no spatial derivatives so the spatial dimension is the dimension of the
+         * material response.
+         *
+         * \param nphases: The number of phases
+         * \param material_response_dim: The spatial dimension of the material response
+         * \param material_response_num_dof: The number of degrees of freedom of a phase plus the number of additional
+         *     degrees of freedom
+         */
+        inline KernelCost getInternalEnergyConstraintJacobianCost(const size_type nphases,
+                                                                  const size_type material_response_dim,
+                                                                  const size_type material_response_num_dof) {
+            const floatType d = material_response_dim;
+
+            return makeJacobianCost(2 * d + 3, 4 * d * d + 3 * d + 3, d * d + d, 3, 1, 1, material_response_dim,
+                                    nphases, material_response_dim, material_response_num_dof);
+        }
+
+        /*!
+         * Get the cost of the residual of the surface growth balance for one test function
+         *
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getSurfaceGrowthResidualCost(const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(5 * d, 0, 3 * d + 2, d);
+        }
+
+        /*!
+         * Get the cost of the Jacobian of the surface growth balance for one test and interpolation function
+         *
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getSurfaceGrowthJacobianCost(const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(7 * d * d + 7 * d, 0, 4 * d + 3, 2 * d * d + 2 * d);
+        }
+
+        /*!
+         * Get the cost of the mixture material response and its Jacobian. Every phase reads its material response
+         * and Jacobian and accumulates them into the mixture so the cost grows with the product of the number of
+         * phases and the number of degrees of freedom.
+         *
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param num_dof: The number of degrees of freedom of the material point
+         */
+        inline KernelCost getMixtureMaterialResponseCost(const size_type dim, const size_type nphases,
+                                                         const size_type num_dof) {
+            const floatType d = dim;
+
+            const floatType n = nphases;
+
+            const floatType N = num_dof;
+
+            const floatType S = getMaterialResponseSize(dim);
+
+            const floatType chain_rule_flops =
+                n * ((2 * d * d * d + 7 * d * d + 15 * d + 10) * N + (4 * d + 8) * n);
+
+            // The material responses, their Jacobians, and the densities and volume fractions of each phase
+            const floatType values_read = n * (S + S * (1 + d) * N) + 2 * n;
+
+            const floatType values_written = S + S * (1 + d) * N;
+
+            return makeKernelCost(n * (3 * d * d + 7 * d + 16) + chain_rule_flops, chain_rule_flops, values_read,
+                                  values_written);
+        }
+
+        /*!
+         * Get the cost of the shape functions of an element at a point
+         *
+         * \param node_count: The number of nodes of the element
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getShapeFunctionCost(const size_type node_count, const size_type dim) {
+            return makeKernelCost(3 * node_count * dim, 0, node_count * dim + dim, node_count);
+        }
+
+        /*!
+         * Get the cost of the global shape function gradients of an element at a point. The local gradient of the
+         * positions, its inverse, and the product of the local shape function gradients with the inverse are counted.
+         *
+         * \param node_count: The number of nodes of the element
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getShapeFunctionGradientCost(const size_type node_count, const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(4 * node_count * d * d + 2 * d * d * d, 0, node_count * d + d, node_count * d);
+        }
+
+        /*!
+         * Get the cost of the determinant of the Jacobian of the transformation of an element at a point
+         *
+         * \param node_count: The number of nodes of the element
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getJacobianOfTransformationCost(const size_type node_count, const size_type dim) {
+            const floatType d = dim;
+
+            return makeKernelCost(2 * node_count * d * d + d * d * d, 0, node_count * d, 1);
+        }
+
+        /*!
+         * Get the cost of interpolating nodal values at a point
+         *
+         * \param node_count: The number of nodes of the element
+         * \param num_values: The number of values at each node
+         */
+        inline KernelCost getInterpolationCost(const size_type node_count, const size_type num_values) {
+            return makeKernelCost(2 * node_count * num_values, 0, node_count * num_values + node_count, num_values);
+        }
+
+        /*!
+         * Get the cost of the global gradient of nodal values at a point excluding the shape function gradients
+         *
+         * \param node_count: The number of nodes of the element
+         * \param num_values: The number of values at each node
+         * \param dim: The spatial dimension
+         */
+        inline KernelCost getQuantityGradientCost(const size_type node_count, const size_type num_values,
+                                                  const size_type dim) {
+            return makeKernelCost(2 * node_count * num_values * dim, 0, node_count * num_values + node_count * dim,
+                                  num_values * dim);
+        }
+
+    }  // namespace costModel
+
+}  // namespace tardigradeBalanceEquations
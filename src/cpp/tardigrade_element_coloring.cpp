@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_element_coloring.cpp
+ ******************************************************************************
+ * The source file for the coloring of the elements of a mesh
+ ******************************************************************************
+ */
+
+#include "tardigrade_element_coloring.h"
@@ -0,0 +1,131 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_element_coloring.h
+ ******************************************************************************
+ * The header file for the coloring of the elements of a mesh. Two elements
+ * which share a node scatter into the same rows of the global residual and
+ * Jacobian. A coloring partitions the elements so that no two elements of the
+ * same color share a node and so all of the elements of a color may be
+ * assembled concurrently without atomics or locks. The coloring only depends
+ * on the connectivity so it is computed once per mesh and reused for every
+ * assembly.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_ELEMENT_COLORING_H
+#define TARDIGRADE_ELEMENT_COLORING_H
+
+#include <vector>
+
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+#include "tardigrade_thread_pool.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace elementColoring {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        /*!
+         * The strategies for coloring the elements
+         */
+        enum ColoringStrategy : unsigned int {
+            GREEDY   = 0,  //!< Assign each element the lowest color not used by a neighboring element
+            BALANCED = 1   //!< Greedy followed by moving elements from over-full colors to under-full colors
+        };
+
+        /*!
+         * A partition of the elements of a mesh into colors
+         */
+        class ElementColoring {
+           public:
+            /*!
+             * Default constructor
+             */
+            ElementColoring() : _element_colors(), _color_offsets(1, 0), _color_elements() {}
+
+            template <class color_iter>
+            ElementColoring(const color_iter &element_colors_begin, const color_iter &element_colors_end);
+
+            //! Get the number of colors
+            size_type getNumColors() const { return (size_type)_color_offsets.size() - 1; }
+
+            //! Get the number of colored elements
+            size_type getNumElements() const { return (size_type)_element_colors.size(); }
+
+            /*!
+             * Get the color of an element
+             *
+             * \param element: The element
+             */
+            size_type getColor(const size_type element) const { return _element_colors[element]; }
+
+            /*!
+             * Get the number of elements of a color
+             *
+             * \param color: The color
+             */
+            size_type getColorSize(const size_type color) const {
+                return _color_offsets[color + 1] - _color_offsets[color];
+            }
+
+            /*!
+             * Get the starting iterator of the elements of a color
+             *
+             * \param color: The color
+             */
+            std::vector<size_type>::const_iterator getColorElementsBegin(const size_type color) const {
+                return std::cbegin(_color_elements) + _color_offsets[color];
+            }
+
+            /*!
+             * Get the stopping iterator of the elements of a color
+             *
+             * \param color: The color
+             */
+            std::vector<size_type>::const_iterator getColorElementsEnd(const size_type color) const {
+                return std::cbegin(_color_elements) + _color_offsets[color + 1];
+            }
+
+           protected:
+            std::vector<size_type> _element_colors;  //!< The color of each element
+
+            std::vector<size_type> _color_offsets;  //!< The offsets of the colors into the color elements
+
+            std::vector<size_type> _color_elements;  //!< The elements of each color in increasing order
+        };
+
+        inline void getElementAdjacency(const meshAssembly::MeshConnectivity &connectivity,
+                                        std::vector<size_type> &adjacency_offsets, std::vector<size_type> &adjacency);
+
+        inline ElementColoring colorElements(const meshAssembly::MeshConnectivity &connectivity,
+                                             const ColoringStrategy strategy = GREEDY);
+
+        inline bool isValidColoring(const meshAssembly::MeshConnectivity &connectivity,
+                                    const ElementColoring &coloring);
+
+        template <class element_function>
+        void forEachColoredElement(const ElementColoring &coloring, const size_type color, threadPool::ThreadPool &pool,
+                                   element_function function, const size_type grain_size = 1);
+
+        template <class element_kernel, class residual_iter>
+        void assembleResidual(const meshAssembly::MeshConnectivity &connectivity,
+                              const meshAssembly::DofNumbering &numbering, const ElementColoring &coloring,
+                              element_kernel &kernel, residual_iter residual_begin, residual_iter residual_end,
+                              threadPool::ThreadPool &pool, const size_type grain_size = 1);
+
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const meshAssembly::MeshConnectivity &connectivity,
+                                         const meshAssembly::DofNumbering &numbering, const ElementColoring &coloring,
+                                         element_kernel &kernel, residual_iter residual_begin,
+                                         residual_iter residual_end, meshAssembly::CSRMatrix<T> &jacobian,
+                                         threadPool::ThreadPool &pool, const size_type grain_size = 1);
+
+    }  // namespace elementColoring
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_element_coloring.tpp"
+
+#endif
@@ -0,0 +1,388 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_element_coloring.tpp
+ ******************************************************************************
+ * The template file for the coloring of the elements of a mesh
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "tardigrade_element_coloring.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace elementColoring {
+
+        /*!
+         * Constructor for the element coloring
+         *
+         * \param &element_colors_begin: The starting iterator of the color of each element
+         * \param &element_colors_end: The stopping iterator of the color of each element
+         */
+        template <class color_iter>
+        ElementColoring::ElementColoring(const color_iter &element_colors_begin, const color_iter &element_colors_end)
+            : _element_colors(element_colors_begin, element_colors_end) {
+            const size_type num_colors =
+                _element_colors.empty() ? 0 : *std::max_element(std::cbegin(_element_colors),
+                                                                std::cend(_element_colors)) + 1;
+
+            _color_offsets.assign(num_colors + 1, 0);
+
+            for (const auto &color : _element_colors) {
+                ++_color_offsets[color + 1];
+            }
+
+            for (size_type color = 0; color < num_colors; ++color) {
+                TARDIGRADE_ERROR_TOOLS_CHECK(_color_offsets[color + 1] > 0, "Every color must have an element")
+            }
+
+            std::partial_sum(std::begin(_color_offsets), std::end(_color_offsets), std::begin(_color_offsets));
+
+            _color_elements.resize(_element_colors.size());
+
+            std::vector<size_type> position(std::cbegin(_color_offsets), std::cend(_color_offsets) - 1);
+
+            for (size_type e = 0; e < (size_type)_element_colors.size(); ++e) {
+                _color_elements[position[_element_colors[e]]++] = e;
+            }
+        }
+
+        /*!
+         * Get the elements which share at least one node with each element. The neighbors of each element are sorted
+         * and do not include the element itself.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &adjacency_offsets: The offsets of the neighbors of each element into the adjacency
+         * \param &adjacency: The neighbors of each element
+         */
+        void getElementAdjacency(const meshAssembly::MeshConnectivity &connectivity,
+                                 std::vector<size_type> &adjacency_offsets, std::vector<size_type> &adjacency) {
+            const size_type num_nodes    = connectivity.getNumNodes();
+            const size_type num_elements = connectivity.getNumElements();
+
+            // Build the node-to-element map
+            std::vector<size_type> element_offsets(num_nodes + 1, 0);
+
+            for (const auto &node : connectivity.getConnectivity()) {
+                ++element_offsets[node + 1];
+            }
+
+            std::partial_sum(std::begin(element_offsets), std::end(element_offsets), std::begin(element_offsets));
+
+            std::vector<size_type> node_elements(element_offsets.back());
+
+            std::vector<size_type> position(std::cbegin(element_offsets), std::cend(element_offsets) - 1);
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                for (auto node = connectivity.getElementNodesBegin(e); node != connectivity.getElementNodesEnd(e);
+                     ++node) {
+                    node_elements[position[*node]++] = e;
+                }
+            }
+
+            // Collect the elements of the nodes of each element
+            adjacency_offsets.assign(num_elements + 1, 0);
+
+            adjacency.clear();
+
+            std::vector<size_type> neighbors;
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                neighbors.clear();
+
+                for (auto node = connectivity.getElementNodesBegin(e); node != connectivity.getElementNodesEnd(e);
+                     ++node) {
+                    neighbors.insert(std::end(neighbors), std::cbegin(node_elements) + element_offsets[*node],
+                                     std::cbegin(node_elements) + element_offsets[*node + 1]);
+                }
+
+                std::sort(std::begin(neighbors), std::end(neighbors));
+
+                neighbors.erase(std::unique(std::begin(neighbors), std::end(neighbors)), std::end(neighbors));
+
+                neighbors.erase(std::lower_bound(std::begin(neighbors), std::end(neighbors), e));
+
+                adjacency.insert(std::end(adjacency), std::cbegin(neighbors), std::cend(neighbors));
+
+                adjacency_offsets[e + 1] = (size_type)adjacency.size();
+            }
+        }
+
+        /*!
+         * Color the elements of a mesh so that no two elements of the same color share a node. The greedy strategy
+         * visits the elements in order and assigns each one the lowest color which none of its neighbors have. The
+         * balanced strategy then visits the elements again and moves each element of a color with more than the
+         * average number of elements to the smallest color which none of its neighbors have if that color has fewer
+         * than the average. Balancing never increases the number of colors and evens out the work of each color so
+         * that the threads are not starved by small colors.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param strategy: The coloring strategy
+         */
+        ElementColoring colorElements(const meshAssembly::MeshConnectivity &connectivity,
+                                      const ColoringStrategy strategy) {
+            const size_type num_elements = connectivity.getNumElements();
+
+            std::vector<size_type> adjacency_offsets, adjacency;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(getElementAdjacency(connectivity, adjacency_offsets, adjacency));
+
+            const size_type uncolored = num_elements;
+
+            std::vector<size_type> element_colors(num_elements, uncolored);
+
+            // The last element which marked each color as used by one of its neighbors
+            std::vector<size_type> marked;
+
+            std::vector<size_type> color_sizes;
+
+            auto markNeighborColors = [&](const size_type e) {
+                for (size_type k = adjacency_offsets[e]; k < adjacency_offsets[e + 1]; ++k) {
+                    const size_type color = element_colors[adjacency[k]];
+
+                    if (color != uncolored) {
+                        marked[color] = e;
+                    }
+                }
+            };
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                markNeighborColors(e);
+
+                size_type color = 0;
+
+                while ((color < (size_type)marked.size()) && (marked[color] == e)) {
+                    ++color;
+                }
+
+                if (color == (size_type)marked.size()) {
+                    marked.push_back(uncolored);
+
+                    color_sizes.push_back(0);
+                }
+
+                element_colors[e] = color;
+
+                ++color_sizes[color];
+            }
+
+            if ((strategy == BALANCED) && (num_elements > 0)) {
+                const size_type num_colors = (size_type)color_sizes.size();
+
+                const size_type target = (num_elements + num_colors - 1) / num_colors;
+
+                std::fill(std::begin(marked), std::end(marked), uncolored);
+
+                for (size_type e = 0; e < num_elements; ++e) {
+                    const size_type current = element_colors[e];
+
+                    if (color_sizes[current] <= target) {
+                        continue;
+                    }
+
+                    markNeighborColors(e);
+
+                    size_type best = current;
+
+                    for (size_type color = 0; color < num_colors; ++color) {
+                        if ((marked[color] != e) && (color_sizes[color] < target) &&
+                            (color_sizes[color] < color_sizes[best])) {
+                            best = color;
+                        }
+                    }
+
+                    --color_sizes[current];
+
+                    ++color_sizes[best];
+
+                    element_colors[e] = best;
+                }
+            }
+
+            return ElementColoring(std::cbegin(element_colors), std::cend(element_colors));
+        }
+
+        /*!
+         * Check that every element of a mesh is colored and that no two elements of the same color share a node
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &coloring: The element coloring
+         */
+        bool isValidColoring(const meshAssembly::MeshConnectivity &connectivity, const ElementColoring &coloring) {
+            if (coloring.getNumElements() != connectivity.getNumElements()) {
+                return false;
+            }
+
+            const size_type unowned = connectivity.getNumElements();
+
+            std::vector<size_type> owner(connectivity.getNumNodes());
+
+            for (size_type color = 0; color < coloring.getNumColors(); ++color) {
+                std::fill(std::begin(owner), std::end(owner), unowned);
+
+                for (auto e = coloring.getColorElementsBegin(color); e != coloring.getColorElementsEnd(color); ++e) {
+                    for (auto node = connectivity.getElementNodesBegin(*e); node != connectivity.getElementNodesEnd(*e);
+                         ++node) {
+                        if ((owner[*node] != unowned) && (owner[*node] != *e)) {
+                            return false;
+                        }
+
+                        owner[*node] = *e;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /*!
+         * Call a function for each of the elements of a color using a work-stealing thread pool. The elements are split
+         * into tasks of grain_size elements which are balanced over the threads of the pool so that colors with
+         * elements of differing cost do not leave threads idle. The function is called as
+         *
+         * function( worker, element )
+         *
+         * where worker is the index of the thread in the pool.
+         *
+         * \param &coloring: The element coloring
+         * \param color: The color
+         * \param &pool: The thread pool
+         * \param function: The function to call for each element
+         * \param grain_size: The number of elements of each task
+         */
+        template <class element_function>
+        void forEachColoredElement(const ElementColoring &coloring, const size_type color, threadPool::ThreadPool &pool,
+                                   element_function function, const size_type grain_size) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(color < coloring.getNumColors(),
+                                         "The color must be less than the number of colors")
+
+            auto elements_begin = coloring.getColorElementsBegin(color);
+
+            pool.parallelFor(coloring.getColorSize(color), grain_size,
+                             [&](const unsigned int worker, const threadPool::size_type index) {
+                                 function(worker, *(elements_begin + index));
+                             });
+        }
+
+        /*!
+         * Assemble the global residual of a mesh by looping over the colors and assembling the elements of each color
+         * with a work-stealing thread pool. The element kernel may start loops on the same pool, e.g. over the
+         * integration points, and is called concurrently for different elements so it must not modify shared state.
+         * Since each node receives at most one contribution from each color the result does not depend on the number
+         * of threads.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &coloring: The element coloring from colorElements
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         * \param &pool: The thread pool
+         * \param grain_size: The number of elements of each task
+         */
+        template <class element_kernel, class residual_iter>
+        void assembleResidual(const meshAssembly::MeshConnectivity &connectivity,
+                              const meshAssembly::DofNumbering &numbering, const ElementColoring &coloring,
+                              element_kernel &kernel, residual_iter residual_begin, residual_iter residual_end,
+                              threadPool::ThreadPool &pool, const size_type grain_size) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(coloring.getNumElements() == connectivity.getNumElements(),
+                                         "The coloring must have a color for each element")
+
+            const size_type num_element_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+            threadPool::PerThreadScratch<std::vector<residual_type>> element_residuals(
+                pool.getNumThreads(), std::vector<residual_type>(num_element_dof));
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            for (size_type color = 0; color < coloring.getNumColors(); ++color) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(forEachColoredElement(
+                    coloring, color, pool,
+                    [&](const unsigned int worker, const size_type e) {
+                        auto &element_residual = element_residuals[worker];
+
+                        std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                        kernel(e, std::begin(element_residual), std::end(element_residual));
+
+                        meshAssembly::scatterElementResidual(connectivity, numbering, e, std::cbegin(element_residual),
+                                                             std::cend(element_residual), residual_begin,
+                                                             residual_end);
+                    },
+                    grain_size));
+            }
+        }
+
+        /*!
+         * Assemble the global residual and CSR Jacobian of a mesh by looping over the colors and assembling the
+         * elements of each color with a work-stealing thread pool. The element kernel may start loops on the same
+         * pool and is called concurrently for different elements so it must not modify shared state. Since no two
+         * elements of a color share a node the scatters of a color write to disjoint rows and no synchronization is
+         * needed other than finishing the loop of a color before starting the next.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &coloring: The element coloring from colorElements
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         * \param &jacobian: The global Jacobian from meshAssembly::buildCSRMatrix
+         * \param &pool: The thread pool
+         * \param grain_size: The number of elements of each task
+         */
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const meshAssembly::MeshConnectivity &connectivity,
+                                         const meshAssembly::DofNumbering &numbering, const ElementColoring &coloring,
+                                         element_kernel &kernel, residual_iter residual_begin,
+                                         residual_iter residual_end, meshAssembly::CSRMatrix<T> &jacobian,
+                                         threadPool::ThreadPool &pool, const size_type grain_size) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(coloring.getNumElements() == connectivity.getNumElements(),
+                                         "The coloring must have a color for each element")
+
+            const size_type num_element_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+            threadPool::PerThreadScratch<std::vector<residual_type>> element_residuals(
+                pool.getNumThreads(), std::vector<residual_type>(num_element_dof));
+
+            threadPool::PerThreadScratch<std::vector<T>> element_jacobians(
+                pool.getNumThreads(), std::vector<T>(num_element_dof * num_element_dof));
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            jacobian.setZero();
+
+            for (size_type color = 0; color < coloring.getNumColors(); ++color) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(forEachColoredElement(
+                    coloring, color, pool,
+                    [&](const unsigned int worker, const size_type e) {
+                        auto &element_residual = element_residuals[worker];
+
+                        auto &element_jacobian = element_jacobians[worker];
+
+                        std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                        std::fill(std::begin(element_jacobian), std::end(element_jacobian), T());
+
+                        kernel(e, std::begin(element_residual), std::end(element_residual),
+                               std::begin(element_jacobian), std::end(element_jacobian));
+
+                        meshAssembly::scatterElementResidual(connectivity, numbering, e, std::cbegin(element_residual),
+                                                             std::cend(element_residual), residual_begin,
+                                                             residual_end);
+
+                        meshAssembly::scatterElementJacobian(connectivity, numbering, e, std::cbegin(element_jacobian),
+                                                             std::cend(element_jacobian), jacobian);
+                    },
+                    grain_size));
+            }
+        }
+
+    }  // namespace elementColoring
+
+}  // namespace tardigradeBalanceEquations
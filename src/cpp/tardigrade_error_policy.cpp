@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_error_policy.cpp
+ ******************************************************************************
+ * The source file for the error checking policy of the kernels
+ ******************************************************************************
+ */
+
+#include "tardigrade_error_policy.h"
@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_error_policy.h
+ ******************************************************************************
+ * The header file for the error checking policy of the kernels. The checks
+ * are split into the checks at the entry points of an assembly e.g., the
+ * sizes of the arrays of a batch, and the checks of the point and element
+ * kernels which are called many times by the inner loops. Which checks are
+ * compiled is set by TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL
+ *
+ * 0: No checks
+ * 1: The checks at the entry points
+ * 2: The checks at the entry points and in the kernels (default)
+ *
+ * independently of TARDIGRADE_ERROR_TOOLS_OPT, which removes all of the
+ * checks. The messages of the checks are only formatted if a check fails
+ * and are formatted by a function which is not inlined so that a passing
+ * check costs only the comparison. The checks of the kernels may also be
+ * skipped at run time in a trusted batch i.e., a loop over points or
+ * elements whose sizes have been validated once by the caller.
+ *
+ * TARDIGRADE_BALANCE_EQS_CHECK and TARDIGRADE_BALANCE_EQS_EVAL are the
+ * checks of the kernels and replace TARDIGRADE_ERROR_TOOLS_CHECK and
+ * TARDIGRADE_ERROR_TOOLS_EVAL there. TARDIGRADE_BALANCE_EQS_ENTRY_CHECK is
+ * the check of an entry point.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_ERROR_POLICY_H
+#define TARDIGRADE_ERROR_POLICY_H
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifdef TARDIGRADE_ERROR_TOOLS_OPT
+#undef TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL
+#define TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL 0
+#endif
+
+#ifndef TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL
+#define TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL 2
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TARDIGRADE_BALANCE_EQUATIONS_COLD __attribute__((noinline, cold))
+#else
+#define TARDIGRADE_BALANCE_EQUATIONS_COLD
+#endif
+
+namespace tardigradeBalanceEquations {
+
+    namespace errorPolicy {
+
+        /*!
+         * The levels of the error checking
+         */
+        enum CheckLevel : int {
+            CHECK_NONE   = 0,  //!< No checks
+            CHECK_ENTRY  = 1,  //!< The checks at the entry points of an assembly
+            CHECK_KERNEL = 2   //!< The checks at the entry points and in the point and element kernels
+        };
+
+        constexpr CheckLevel check_level =
+            CheckLevel(TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL);  //!< The compiled level of the checks
+
+        static_assert((check_level >= CHECK_NONE) && (check_level <= CHECK_KERNEL),
+                      "TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL must be 0, 1, or 2");
+
+        /*!
+         * Skip the checks of the kernels on the calling thread while the batch is alive. The caller must have
+         * validated the sizes of the arrays passed to the kernels of the batch. Batches may be nested.
+         */
+        class TrustedBatch {
+           public:
+            inline TrustedBatch();
+
+            inline ~TrustedBatch();
+
+            TrustedBatch(const TrustedBatch &) = delete;
+
+            TrustedBatch &operator=(const TrustedBatch &) = delete;
+        };
+
+        inline unsigned int &getTrustedDepth();
+
+        inline bool isTrusted();
+
+        template <typename... message_types>
+        std::string formatMessage(const message_types &...parts);
+
+        template <typename... message_types>
+        [[noreturn]] TARDIGRADE_BALANCE_EQUATIONS_COLD void throwError(const char *function,
+                                                                        const message_types &...parts);
+
+    }  // namespace errorPolicy
+
+}  // namespace tardigradeBalanceEquations
+
+#if TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL >= 1
+//! Check a condition at the entry point of an assembly. The parts of the message are only formatted on failure
+#define TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(condition, ...)                                                            \
+    {                                                                                                                 \
+        if (!(condition)) {                                                                                           \
+            tardigradeBalanceEquations::errorPolicy::throwError(__func__, __VA_ARGS__);                               \
+        }                                                                                                             \
+    }
+#else
+#define TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(condition, ...)
+#endif
+
+#if TARDIGRADE_BALANCE_EQUATIONS_CHECK_LEVEL >= 2
+//! Check a condition in a kernel unless the calling thread is in a trusted batch. The trusted depth of the thread is
+//! only read if the condition fails so that a passing check costs only the comparison
+#define TARDIGRADE_BALANCE_EQS_CHECK(condition, ...)                                                                  \
+    {                                                                                                                 \
+        if (!(condition) && !tardigradeBalanceEquations::errorPolicy::isTrusted()) {                                  \
+            tardigradeBalanceEquations::errorPolicy::throwError(__func__, __VA_ARGS__);                               \
+        }                                                                                                             \
+    }
+//! Evaluate an expression which is only used by the checks of a kernel e.g., the definition of a size
+#define TARDIGRADE_BALANCE_EQS_EVAL(expression) expression;
+#else
+#define TARDIGRADE_BALANCE_EQS_CHECK(condition, ...)
+#define TARDIGRADE_BALANCE_EQS_EVAL(expression)
+#endif
+
+#include "tardigrade_error_policy.tpp"
+
+#endif
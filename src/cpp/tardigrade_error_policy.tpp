@@ -0,0 +1,59 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_error_policy.tpp
+ ******************************************************************************
+ * The template file for the error checking policy of the kernels
+ ******************************************************************************
+ */
+
+#include "tardigrade_error_policy.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace errorPolicy {
+
+        //! Enter a trusted batch on the calling thread
+        inline TrustedBatch::TrustedBatch() { ++getTrustedDepth(); }
+
+        //! Leave the trusted batch
+        inline TrustedBatch::~TrustedBatch() { --getTrustedDepth(); }
+
+        //! Get the number of trusted batches which the calling thread is in
+        inline unsigned int &getTrustedDepth() {
+            thread_local unsigned int depth = 0;
+
+            return depth;
+        }
+
+        //! Check if the calling thread is in a trusted batch
+        inline bool isTrusted() { return getTrustedDepth() > 0; }
+
+        /*!
+         * Format the parts of a message e.g., formatMessage( "The size ", size, " must be ", expected )
+         *
+         * \param &parts: The parts of the message which may be written to a std::ostream
+         */
+        template <typename... message_types>
+        std::string formatMessage(const message_types &...parts) {
+            std::ostringstream message;
+
+            (message << ... << parts);
+
+            return message.str();
+        }
+
+        /*!
+         * Throw the error of a failed check. The message is formatted here so that the callers only pass references
+         * to the parts of the message.
+         *
+         * \param *function: The name of the function of the check
+         * \param &parts: The parts of the message which may be written to a std::ostream
+         */
+        template <typename... message_types>
+        [[noreturn]] void throwError(const char *function, const message_types &...parts) {
+            throw std::runtime_error(std::string(function) + ": " + formatMessage(parts...));
+        }
+
+    }  // namespace errorPolicy
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_explicit_dynamics.cpp
+ ******************************************************************************
+ * The source file for the residual-only explicit dynamics utilities
+ ******************************************************************************
+ */
+
+#include "tardigrade_explicit_dynamics.h"
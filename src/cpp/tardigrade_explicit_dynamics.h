@@ -0,0 +1,65 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_explicit_dynamics.h
+ ******************************************************************************
+ * The header file for the residual-only explicit dynamics utilities. These
+ * compute the lumped mass of an element, the element force vector from the
+ * residual overloads of the balance of linear momentum, and advance the
+ * nodal fields with a central-difference update. No Jacobians are formed.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_EXPLICIT_DYNAMICS_H
+#define TARDIGRADE_EXPLICIT_DYNAMICS_H
+
+#include <array>
+
+#include "tardigrade_FiniteElementBase.h"
+#include "tardigrade_balance_of_linear_momentum.h"
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace explicitDynamics {
+
+        typedef finiteElement::size_type size_type;  //!< Define the size type to be the same as the finite elements
+
+        template <int nphases, class element_configuration, class density_iter, class mass_iter>
+        void computeLumpedMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                               const density_iter &density_begin, const density_iter &density_end,
+                               mass_iter mass_begin, mass_iter mass_end, const bool configuration = true);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int nphases, class element_configuration, class density_iter,
+                  class density_dot_iter, class velocity_iter, class material_response_iter, class volume_fraction_iter,
+                  class result_iter>
+        void computeBalanceOfLinearMomentumForce(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const density_iter &density_begin,
+            const density_iter &density_end, const density_dot_iter &density_dot_begin,
+            const density_dot_iter &density_dot_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const material_response_iter &material_response_begin,
+            const material_response_iter &material_response_end, const volume_fraction_iter &volume_fraction_begin,
+            const volume_fraction_iter &volume_fraction_end, result_iter result_begin, result_iter result_end,
+            const bool configuration = true);
+
+        template <class mass_iter, class force_iter, class acceleration_iter>
+        void computeLumpedAcceleration(const mass_iter &mass_begin, const mass_iter &mass_end,
+                                       const force_iter &force_begin, const force_iter &force_end,
+                                       acceleration_iter acceleration_begin, acceleration_iter acceleration_end);
+
+        template <typename dt_type, class acceleration_iter, class velocity_iter, class displacement_iter>
+        void centralDifferenceUpdate(const dt_type &dt_previous, const dt_type &dt,
+                                     const acceleration_iter &acceleration_begin,
+                                     const acceleration_iter &acceleration_end, velocity_iter velocity_begin,
+                                     velocity_iter velocity_end, displacement_iter displacement_begin,
+                                     displacement_iter displacement_end);
+
+    }  // namespace explicitDynamics
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_explicit_dynamics.tpp"
+
+#endif
@@ -0,0 +1,431 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_explicit_dynamics.tpp
+ ******************************************************************************
+ * The template file for the residual-only explicit dynamics utilities
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "tardigrade_explicit_dynamics.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace explicitDynamics {
+
+        /*!
+         * Compute the lumped mass of an element using the diagonal scaling (HRZ) procedure. The diagonal of the
+         * consistent mass matrix \f$ \int \rho N_A N_A dv \f$ is scaled such that the sum of the nodal masses is equal
+         * to the mass of the element \f$ \int \rho dv \f$. Unlike row-sum lumping this gives strictly positive nodal
+         * masses for the corner nodes of the QuadraticHex element.
+         *
+         * nphases: The number of phases
+         *
+         * \param &element: The finite element
+         * \param &density_begin: The starting iterator of the nodal apparent densities (node-major with nphases
+         * values per node)
+         * \param &density_end: The stopping iterator of the nodal apparent densities
+         * \param mass_begin: The starting iterator of the lumped mass (node-major with nphases values per node)
+         * \param mass_end: The stopping iterator of the lumped mass
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int nphases, class element_configuration, class density_iter, class mass_iter>
+        void computeLumpedMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                               const density_iter &density_begin, const density_iter &density_end,
+                               mass_iter mass_begin, mass_iter mass_end, const bool configuration) {
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using weight_type           = typename element_configuration::volume_integration_point_weight_value_type;
+            using mass_type             = typename std::iterator_traits<mass_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(density_end - density_begin) == node_count * nphases,
+                                         "The density has a size of " +
+                                             std::to_string((size_type)(density_end - density_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * nphases));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(mass_end - mass_begin) == node_count * nphases,
+                                         "The mass has a size of " +
+                                             std::to_string((size_type)(mass_end - mass_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * nphases));
+
+            std::array<local_node_value_type, element_configuration::local_dim> xi;
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<mass_type, nphases> element_mass;
+
+            std::array<mass_type, nphases> diagonal_sum;
+
+            weight_type weight;
+
+            node_value_type J;
+
+            std::fill(mass_begin, mass_end, 0);
+
+            std::fill(std::begin(element_mass), std::end(element_mass), 0);
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    element.GetShapeFunctions(std::cbegin(xi), std::cend(xi), std::begin(N), std::end(N)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(element.GetVolumeIntegralJacobianOfTransformation(
+                    std::cbegin(xi), std::cend(xi), J, configuration));
+
+                for (unsigned int p = 0; p < nphases; ++p) {
+                    mass_type rho = 0;
+
+                    for (unsigned int node = 0; node < node_count; ++node) {
+                        rho += N[node] * (*(density_begin + nphases * node + p));
+                    }
+
+                    element_mass[p] += rho * J * weight;
+
+                    for (unsigned int node = 0; node < node_count; ++node) {
+                        *(mass_begin + nphases * node + p) += rho * N[node] * N[node] * J * weight;
+                    }
+                }
+            }
+
+            std::fill(std::begin(diagonal_sum), std::end(diagonal_sum), 0);
+
+            for (unsigned int node = 0; node < node_count; ++node) {
+                for (unsigned int p = 0; p < nphases; ++p) {
+                    diagonal_sum[p] += *(mass_begin + nphases * node + p);
+                }
+            }
+
+            for (unsigned int node = 0; node < node_count; ++node) {
+                for (unsigned int p = 0; p < nphases; ++p) {
+                    if (diagonal_sum[p] != 0) {
+                        *(mass_begin + nphases * node + p) *= element_mass[p] / diagonal_sum[p];
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Compute the element force vector of the balance of linear momentum for an explicit update. The force is
+         * the weak-form residual of the balance of linear momentum evaluated with a zero rate of change of the
+         * velocity i.e., the full residual is
+         *
+         * \f$ R_{Ai} = F_{Ai} - \sum_B M_{AB} a_{Bi} \f$
+         *
+         * so that the nodal accelerations follow from \f$ F_{Ai} \f$ and the lumped mass. Only the residual
+         * overloads of computeBalanceOfLinearMomentum are called so none of the Jacobians are formed. The residual is
+         * linear in the test function so it is evaluated once per integration point for each of the 1 + dim virtual
+         * test functions and contracted with the shape functions and their gradients rather than once per node.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * body_force_index: The index of the material response vector where the body force is located
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * nphases: The number of phases
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &density_begin: The starting iterator of the nodal apparent densities (node-major with nphases
+         * values per node)
+         * \param &density_end: The stopping iterator of the nodal apparent densities
+         * \param &density_dot_begin: The starting iterator of the nodal partial time derivatives of the densities
+         * \param &density_dot_end: The stopping iterator of the nodal partial time derivatives of the densities
+         * \param &velocity_begin: The starting iterator of the nodal velocities (node-major with nphases * dim
+         * values per node)
+         * \param &velocity_end: The stopping iterator of the nodal velocities
+         * \param &material_response_begin: The starting iterator of the material responses at the integration points
+         * (integration-point-major with nphases material response vectors per point)
+         * \param &material_response_end: The stopping iterator of the material responses at the integration points
+         * \param &volume_fraction_begin: The starting iterator of the nodal volume fractions (node-major with
+         * nphases values per node)
+         * \param &volume_fraction_end: The stopping iterator of the nodal volume fractions
+         * \param result_begin: The starting iterator of the nodal force vector (node-major with nphases * dim values
+         * per node)
+         * \param result_end: The stopping iterator of the nodal force vector
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int nphases, class element_configuration, class density_iter,
+                  class density_dot_iter, class velocity_iter, class material_response_iter, class volume_fraction_iter,
+                  class result_iter>
+        void computeBalanceOfLinearMomentumForce(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const density_iter &density_begin,
+            const density_iter &density_end, const density_dot_iter &density_dot_begin,
+            const density_dot_iter &density_dot_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const material_response_iter &material_response_begin,
+            const material_response_iter &material_response_end, const volume_fraction_iter &volume_fraction_begin,
+            const volume_fraction_iter &volume_fraction_end, result_iter result_begin, result_iter result_end,
+            const bool configuration) {
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using weight_type           = typename element_configuration::volume_integration_point_weight_value_type;
+            using density_type          = typename std::iterator_traits<density_iter>::value_type;
+            using velocity_type         = typename std::iterator_traits<velocity_iter>::value_type;
+            using volume_fraction_type  = typename std::iterator_traits<volume_fraction_iter>::value_type;
+            using result_type           = typename std::iterator_traits<result_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_points = element_configuration::num_volume_integration_points;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(density_end - density_begin) == node_count * nphases,
+                                         "The density has a size of " +
+                                             std::to_string((size_type)(density_end - density_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * nphases));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(density_dot_end - density_dot_begin) == node_count * nphases,
+                                         "The density dot has a size of " +
+                                             std::to_string((size_type)(density_dot_end - density_dot_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * nphases));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(velocity_end - velocity_begin) == node_count * nphases * dim,
+                                         "The velocity has a size of " +
+                                             std::to_string((size_type)(velocity_end - velocity_begin)) +
+                                             " but should have a size of " +
+                                             std::to_string(node_count * nphases * dim));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(volume_fraction_end - volume_fraction_begin) == node_count * nphases,
+                "The volume fraction has a size of " +
+                    std::to_string((size_type)(volume_fraction_end - volume_fraction_begin)) +
+                    " but should have a size of " + std::to_string(node_count * nphases));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(result_end - result_begin) == node_count * nphases * dim,
+                                         "The result has a size of " +
+                                             std::to_string((size_type)(result_end - result_begin)) +
+                                             " but should have a size of " +
+                                             std::to_string(node_count * nphases * dim));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                ((size_type)(material_response_end - material_response_begin) % (num_points * nphases)) == 0,
+                "The material response has a size of " +
+                    std::to_string((size_type)(material_response_end - material_response_begin)) +
+                    " which is not a multiple of the number of integration points times the number of phases");
+
+            const unsigned int point_response_size =
+                (size_type)(material_response_end - material_response_begin) / num_points;
+
+            std::array<local_node_value_type, element_configuration::local_dim> xi;
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * element_configuration::local_dim> dNdx;
+
+            std::array<density_type, nphases> rho;
+
+            std::array<density_type, nphases> rho_dot;
+
+            std::array<density_type, nphases * dim> grad_rho;
+
+            std::array<velocity_type, nphases * dim> v;
+
+            std::array<velocity_type, nphases * dim> v_dot;
+
+            std::array<velocity_type, nphases * dim * dim> grad_v;
+
+            std::array<volume_fraction_type, nphases> phi;
+
+            // The virtual test functions ( psi = 1, grad psi = 0 ) and ( psi = 0, grad psi = e_k )
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            std::array<result_type, num_virtual * nphases * dim> point_result;
+
+            weight_type weight;
+
+            node_value_type J;
+
+            std::fill(result_begin, result_end, 0);
+
+            std::fill(std::begin(v_dot), std::end(v_dot), 0);
+
+            std::fill(std::begin(virtual_N), std::end(virtual_N), 0);
+
+            std::fill(std::begin(virtual_dNdx), std::end(virtual_dNdx), 0);
+
+            virtual_N[0] = 1;
+
+            for (unsigned int k = 0; k < dim; ++k) {
+                virtual_dNdx[dim * (k + 1) + k] = 1;
+            }
+
+            for (unsigned int qp = 0; qp < num_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    element.GetShapeFunctions(std::cbegin(xi), std::cend(xi), std::begin(N), std::end(N)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(element.GetGlobalShapeFunctionGradients(
+                    std::cbegin(xi), std::cend(xi), node_positions_begin, node_positions_end, std::begin(dNdx),
+                    std::end(dNdx)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(element.GetVolumeIntegralJacobianOfTransformation(
+                    std::cbegin(xi), std::cend(xi), J, configuration));
+
+                // Interpolate the nodal fields to the integration point
+                std::fill(std::begin(rho), std::end(rho), 0);
+                std::fill(std::begin(rho_dot), std::end(rho_dot), 0);
+                std::fill(std::begin(grad_rho), std::end(grad_rho), 0);
+                std::fill(std::begin(v), std::end(v), 0);
+                std::fill(std::begin(grad_v), std::end(grad_v), 0);
+                std::fill(std::begin(phi), std::end(phi), 0);
+
+                for (unsigned int node = 0; node < node_count; ++node) {
+                    for (unsigned int p = 0; p < nphases; ++p) {
+                        const density_type rho_node = *(density_begin + nphases * node + p);
+
+                        rho[p] += N[node] * rho_node;
+                        rho_dot[p] += N[node] * (*(density_dot_begin + nphases * node + p));
+                        phi[p] += N[node] * (*(volume_fraction_begin + nphases * node + p));
+
+                        for (unsigned int i = 0; i < dim; ++i) {
+                            const velocity_type v_node = *(velocity_begin + nphases * dim * node + dim * p + i);
+
+                            grad_rho[dim * p + i] += dNdx[dim * node + i] * rho_node;
+                            v[dim * p + i] += N[node] * v_node;
+
+                            for (unsigned int j = 0; j < dim; ++j) {
+                                grad_v[dim * dim * p + dim * i + j] += dNdx[dim * node + j] * v_node;
+                            }
+                        }
+                    }
+                }
+
+                // Evaluate the residual for each virtual test function and contract it with the shape functions
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                            dim, material_response_dim, body_force_index, cauchy_stress_index,
+                            interphasic_force_index>(
+                            std::cbegin(rho), std::cend(rho), std::cbegin(rho_dot), std::cend(rho_dot),
+                            std::cbegin(grad_rho), std::cend(grad_rho), std::cbegin(v), std::cend(v),
+                            std::cbegin(v_dot), std::cend(v_dot), std::cbegin(grad_v), std::cend(grad_v),
+                            material_response_begin + point_response_size * qp,
+                            material_response_begin + point_response_size * (qp + 1), std::cbegin(phi),
+                            std::cend(phi), virtual_N[t], std::cbegin(virtual_dNdx) + dim * t,
+                            std::cbegin(virtual_dNdx) + dim * (t + 1), std::begin(point_result) + nphases * dim * t,
+                            std::begin(point_result) + nphases * dim * (t + 1))));
+                }
+
+                for (unsigned int node = 0; node < node_count; ++node) {
+                    for (unsigned int k = 0; k < nphases * dim; ++k) {
+                        result_type value = N[node] * point_result[k];
+
+                        for (unsigned int a = 0; a < dim; ++a) {
+                            value += dNdx[dim * node + a] * point_result[nphases * dim * (a + 1) + k];
+                        }
+
+                        *(result_begin + nphases * dim * node + k) += value * J * weight;
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Compute the nodal accelerations from the lumped mass and the nodal force vector
+         *
+         * \f$ a_{Ai} = \frac{F_{Ai}}{M_A} \f$
+         *
+         * The number of components associated with each mass is determined from the ratio of the size of the force
+         * vector to the size of the mass vector.
+         *
+         * \param &mass_begin: The starting iterator of the lumped mass
+         * \param &mass_end: The stopping iterator of the lumped mass
+         * \param &force_begin: The starting iterator of the force vector
+         * \param &force_end: The stopping iterator of the force vector
+         * \param acceleration_begin: The starting iterator of the acceleration
+         * \param acceleration_end: The stopping iterator of the acceleration
+         */
+        template <class mass_iter, class force_iter, class acceleration_iter>
+        void computeLumpedAcceleration(const mass_iter &mass_begin, const mass_iter &mass_end,
+                                       const force_iter &force_begin, const force_iter &force_end,
+                                       acceleration_iter acceleration_begin, acceleration_iter acceleration_end) {
+            const size_type mass_size = (size_type)(mass_end - mass_begin);
+
+            const size_type force_size = (size_type)(force_end - force_begin);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((mass_size > 0) && ((force_size % mass_size) == 0),
+                                         "The force vector size (" + std::to_string(force_size) +
+                                             ") is not a multiple of the mass vector size (" +
+                                             std::to_string(mass_size) + ")");
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(acceleration_end - acceleration_begin) == force_size,
+                                         "The acceleration has a size of " +
+                                             std::to_string((size_type)(acceleration_end - acceleration_begin)) +
+                                             " but should have a size of " + std::to_string(force_size));
+
+            const size_type ncomponents = force_size / mass_size;
+
+            for (auto m = std::pair<unsigned int, mass_iter>(0, mass_begin); m.second != mass_end;
+                 ++m.first, ++m.second) {
+                TARDIGRADE_ERROR_TOOLS_CHECK(*m.second > 0, "The lumped mass at index " + std::to_string(m.first) +
+                                                                " is not positive");
+
+                for (unsigned int i = 0; i < ncomponents; ++i) {
+                    *(acceleration_begin + ncomponents * m.first + i) =
+                        (*(force_begin + ncomponents * m.first + i)) / (*m.second);
+                }
+            }
+        }
+
+        /*!
+         * Perform a central-difference update of the velocity and the displacement
+         *
+         * \f$ v^{n+\frac{1}{2}} = v^{n-\frac{1}{2}} + \frac{1}{2} \left( \Delta t^{n-\frac{1}{2}} + \Delta
+         * t^{n+\frac{1}{2}} \right) a^{n} \f$
+         *
+         * \f$ u^{n+1} = u^{n} + \Delta t^{n+\frac{1}{2}} v^{n+\frac{1}{2}} \f$
+         *
+         * The first step is started from the velocity at \f$ t^0 \f$ by setting the previous timestep to zero.
+         *
+         * \param &dt_previous: The previous timestep \f$ \Delta t^{n-\frac{1}{2}} \f$
+         * \param &dt: The current timestep \f$ \Delta t^{n+\frac{1}{2}} \f$
+         * \param &acceleration_begin: The starting iterator of the acceleration at \f$ t^n \f$
+         * \param &acceleration_end: The stopping iterator of the acceleration at \f$ t^n \f$
+         * \param velocity_begin: The starting iterator of the mid-step velocity which is updated in place
+         * \param velocity_end: The stopping iterator of the mid-step velocity which is updated in place
+         * \param displacement_begin: The starting iterator of the displacement which is updated in place
+         * \param displacement_end: The stopping iterator of the displacement which is updated in place
+         */
+        template <typename dt_type, class acceleration_iter, class velocity_iter, class displacement_iter>
+        void centralDifferenceUpdate(const dt_type &dt_previous, const dt_type &dt,
+                                     const acceleration_iter &acceleration_begin,
+                                     const acceleration_iter &acceleration_end, velocity_iter velocity_begin,
+                                     velocity_iter velocity_end, displacement_iter displacement_begin,
+                                     displacement_iter displacement_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(acceleration_end - acceleration_begin) == (size_type)(velocity_end - velocity_begin),
+                "The acceleration and velocity must have the same size");
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(displacement_end - displacement_begin) == (size_type)(velocity_end - velocity_begin),
+                "The displacement and velocity must have the same size");
+
+            const dt_type dt_mid = 0.5 * (dt_previous + dt);
+
+            for (auto v = std::pair<unsigned int, velocity_iter>(0, velocity_begin); v.second != velocity_end;
+                 ++v.first, ++v.second) {
+                *v.second += dt_mid * (*(acceleration_begin + v.first));
+
+                *(displacement_begin + v.first) += dt * (*v.second);
+            }
+        }
+
+    }  // namespace explicitDynamics
+
+}  // namespace tardigradeBalanceEquations
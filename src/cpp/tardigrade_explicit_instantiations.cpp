@@ -0,0 +1,15 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_explicit_instantiations.cpp
+ ******************************************************************************
+ * The source file for the explicit instantiations of the kernels for the
+ * standard configuration
+ ******************************************************************************
+ */
+
+#define TARDIGRADE_BALANCE_EQUATIONS_COMPILE_EXPLICIT_INSTANTIATIONS
+
+#include "tardigrade_explicit_instantiations.h"
+
+static_assert(tardigradeBalanceEquations::explicitInstantiations::has_pointer_iterators,
+              "The kernels are instantiated for pointers which are not the iterators of std::array");
\ No newline at end of file
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_explicit_instantiations.h
+ ******************************************************************************
+ * The header file for the explicit instantiations of the kernels for the
+ * standard configuration. The standard configuration is a spatial dimension
+ * of three with double precision values stored in std::array containers, the
+ * material response layout listed below, the linear and quadratic
+ * hexahedral elements, and one through max_nphases phases for the kernels
+ * which take the number of phases as a template parameter.
+ *
+ * Including this header declares the instantiations as extern templates so
+ * that a translation unit which calls the kernels with the standard
+ * configuration does not instantiate them again and instead links against
+ * the compiled tardigrade_explicit_instantiations library. The header must
+ * be included before the kernels are called. Calls with any other
+ * configuration are instantiated implicitly as usual. The library is built
+ * when TARDIGRADE_BALANCE_EQUATIONS_BUILD_EXPLICIT_INSTANTIATIONS is set.
+ *
+ * The kernels are instantiated for const double * incoming and double *
+ * outgoing iterators. These are the iterators of std::array for libstdc++
+ * and libc++ so one instantiation covers the arrays of every size as well as
+ * raw pointers. The iterators of std::vector are not covered.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_EXPLICIT_INSTANTIATIONS_H
+#define TARDIGRADE_EXPLICIT_INSTANTIATIONS_H
+
+#include <array>
+#include <type_traits>
+
+#include "tardigrade_LinearHex.h"
+#include "tardigrade_QuadraticHex.h"
+#include "tardigrade_balance_of_energy.h"
+#include "tardigrade_balance_of_linear_momentum.h"
+#include "tardigrade_balance_of_mass.h"
+#include "tardigrade_balance_of_volume_fraction.h"
+#include "tardigrade_constraint_equations.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace explicitInstantiations {
+
+        typedef double floatType;  //!< The type of the values
+
+        constexpr int dim = 3;  //!< The spatial dimension
+
+        constexpr int material_response_dim = 3;  //!< The spatial dimension of the material response
+
+        constexpr int num_additional_dof = 0;  //!< The number of additional degrees of freedom
+
+        //! The number of degrees of freedom the material response of a phase depends on
+        constexpr int material_response_num_dof = 4 + 2 * material_response_dim + num_additional_dof;
+
+        constexpr int max_nphases = 4;  //!< The largest number of phases instantiated for the phase batched kernels
+
+        constexpr bool is_per_unit_volume = false;  //!< Whether the internal energy is per unit volume
+
+        // The layout of the material response of a phase
+        constexpr int cauchy_stress_index                       = 0;   //!< The index of the Cauchy stress
+        constexpr int predicted_internal_energy_index           = 9;   //!< The index of the predicted internal energy
+        constexpr int mass_change_index                         = 10;  //!< The index of the mass change rate
+        constexpr int body_force_index                          = 11;  //!< The index of the body force
+        constexpr int interphasic_force_index                   = 14;  //!< The index of the net interphasic force
+        constexpr int heat_flux_index                           = 17;  //!< The index of the heat flux
+        constexpr int internal_heat_generation_index            = 20;  //!< The index of the internal heat generation
+        constexpr int interphasic_heat_transfer_index           = 21;  //!< The index of the interphasic heat transfer
+        constexpr int trace_mass_change_velocity_gradient_index = 22;  //!< The index of the trace of the mass change
+                                                                       //!< velocity gradient
+
+        constexpr unsigned int material_response_size = 23;  //!< The size of the material response of a phase
+
+        //! Whether the iterators of std::array are the pointers the kernels are instantiated for
+        constexpr bool has_pointer_iterators =
+            std::is_same<std::array<floatType, 1>::const_iterator, const floatType *>::value &&
+            std::is_same<std::array<floatType, 1>::iterator, floatType *>::value;
+
+    }  // namespace explicitInstantiations
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_explicit_instantiations.tpp"
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_explicit_instantiations.tpp
+ ******************************************************************************
+ * The template file for the explicit instantiations of the kernels for the
+ * standard configuration. The instantiations are definitions when
+ * TARDIGRADE_BALANCE_EQUATIONS_COMPILE_EXPLICIT_INSTANTIATIONS is defined
+ * i.e., in tardigrade_explicit_instantiations.cpp, and are extern
+ * declarations otherwise.
+ ******************************************************************************
+ */
+
+#include "tardigrade_explicit_instantiations.h"
+
+#ifdef TARDIGRADE_BALANCE_EQUATIONS_COMPILE_EXPLICIT_INSTANTIATIONS
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION template
+#else
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION extern template
+#endif
+
+// The starting and stopping iterators of an incoming and an outgoing range of values
+#define TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE const double *const &, const double *const &
+#define TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE double *, double *
+
+namespace tardigradeBalanceEquations {
+
+    namespace balanceOfMass {
+
+        // The residual and the Jacobian of all of the phases
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void
+        computeBalanceOfMass<explicitInstantiations::dim, explicitInstantiations::mass_change_index>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void
+        computeBalanceOfMass<explicitInstantiations::dim, explicitInstantiations::material_response_dim,
+                             explicitInstantiations::mass_change_index,
+                             explicitInstantiations::material_response_num_dof>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &, const double &,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &,
+            const double &, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        // The phase batched residual and Jacobian for each number of phases
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_MASS(nphases)                                                        \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfMassPhaseBatched<explicitInstantiations::dim,      \
+                                                                                     nphases>(                         \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);                          \
+                                                                                                                       \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfMassPhaseBatched<explicitInstantiations::dim,      \
+                                                                                     nphases>(                         \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,                           \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,                          \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,                          \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_MASS(1)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_MASS(2)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_MASS(3)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_MASS(4)
+
+#undef TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_MASS
+
+    }  // namespace balanceOfMass
+
+    namespace balanceOfLinearMomentum {
+
+        // The residual and the Jacobian of all of the phases
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfLinearMomentum<
+            explicitInstantiations::dim, explicitInstantiations::material_response_dim,
+            explicitInstantiations::body_force_index, explicitInstantiations::cauchy_stress_index,
+            explicitInstantiations::interphasic_force_index>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfLinearMomentum<
+            explicitInstantiations::dim, explicitInstantiations::material_response_dim,
+            explicitInstantiations::body_force_index, explicitInstantiations::cauchy_stress_index,
+            explicitInstantiations::interphasic_force_index, explicitInstantiations::material_response_num_dof>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            const double &, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            const double &, const double &, const double &, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+    }  // namespace balanceOfLinearMomentum
+
+    namespace balanceOfEnergy {
+
+        // The residual and the Jacobian of all of the phases
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfEnergy<
+            explicitInstantiations::dim, explicitInstantiations::is_per_unit_volume,
+            explicitInstantiations::material_response_dim, explicitInstantiations::cauchy_stress_index,
+            explicitInstantiations::internal_heat_generation_index, explicitInstantiations::heat_flux_index,
+            explicitInstantiations::interphasic_force_index, explicitInstantiations::interphasic_heat_transfer_index>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfEnergy<
+            explicitInstantiations::dim, explicitInstantiations::is_per_unit_volume,
+            explicitInstantiations::material_response_dim, explicitInstantiations::cauchy_stress_index,
+            explicitInstantiations::internal_heat_generation_index, explicitInstantiations::heat_flux_index,
+            explicitInstantiations::interphasic_force_index, explicitInstantiations::interphasic_heat_transfer_index,
+            explicitInstantiations::material_response_num_dof>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            const double &, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            const double &, double, const double &, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        // The phase batched residual for each number of phases
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ENERGY(nphases)                                                      \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeBalanceOfEnergyPhaseBatched<                                \
+        explicitInstantiations::dim, explicitInstantiations::is_per_unit_volume, nphases>(                             \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,            \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ENERGY(1)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ENERGY(2)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ENERGY(3)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ENERGY(4)
+
+#undef TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ENERGY
+
+    }  // namespace balanceOfEnergy
+
+    namespace balanceOfVolumeFraction {
+
+        // The residual and the Jacobian of all of the phases
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void
+        computeBalanceOfVolumeFraction<explicitInstantiations::dim, explicitInstantiations::mass_change_index,
+                                       explicitInstantiations::trace_mass_change_velocity_gradient_index>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            double);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void
+        computeBalanceOfVolumeFraction<explicitInstantiations::dim, explicitInstantiations::material_response_dim,
+                                       explicitInstantiations::mass_change_index,
+                                       explicitInstantiations::trace_mass_change_velocity_gradient_index,
+                                       explicitInstantiations::material_response_num_dof>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &,
+            const double &, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            double, double, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, double);
+
+    }  // namespace balanceOfVolumeFraction
+
+    namespace constraintEquations {
+
+        // The residual and the Jacobian of all of the phases
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void
+        computeInternalEnergyConstraint<explicitInstantiations::predicted_internal_energy_index>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void
+        computeInternalEnergyConstraint<explicitInstantiations::material_response_dim,
+                                        explicitInstantiations::predicted_internal_energy_index,
+                                        explicitInstantiations::material_response_num_dof>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, const double &, const double &,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, double,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);
+
+        // The mixture material response
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void computeMixtureMaterialResponse<
+            explicitInstantiations::dim, explicitInstantiations::cauchy_stress_index,
+            explicitInstantiations::predicted_internal_energy_index, explicitInstantiations::mass_change_index,
+            explicitInstantiations::body_force_index, explicitInstantiations::interphasic_force_index,
+            explicitInstantiations::heat_flux_index, explicitInstantiations::internal_heat_generation_index,
+            explicitInstantiations::interphasic_heat_transfer_index,
+            explicitInstantiations::trace_mass_change_velocity_gradient_index>(
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,
+            double *const &, double *const &, double *const &, double *const &);
+
+    }  // namespace constraintEquations
+
+    namespace finiteElement {
+
+        // The elements and the interpolation of their nodal quantities
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ELEMENT(element, element_configuration)                              \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION class FiniteElementBase<element_configuration>;                         \
+                                                                                                                       \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION class element<element_configuration>;                                   \
+                                                                                                                       \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void                                                                    \
+    FiniteElementBase<element_configuration>::InterpolateQuantity<const double *, double *>(                           \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);                                                                    \
+                                                                                                                       \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void                                                                    \
+    FiniteElementBase<element_configuration>::GetLocalQuantityGradient<const double *, double *>(                      \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE);                                                                    \
+                                                                                                                       \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION void                                                                    \
+    FiniteElementBase<element_configuration>::GetGlobalQuantityGradient<const double *, double *>(                     \
+        TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE, TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE,                            \
+        TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE, const bool);
+
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ELEMENT(LinearHex, LinearHexConfiguration)
+        TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ELEMENT(QuadraticHex, QuadraticHexConfiguration)
+
+#undef TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATE_ELEMENT
+
+    }  // namespace finiteElement
+
+}  // namespace tardigradeBalanceEquations
+
+#undef TARDIGRADE_BALANCE_EQUATIONS_INPUT_RANGE
+#undef TARDIGRADE_BALANCE_EQUATIONS_OUTPUT_RANGE
+#undef TARDIGRADE_BALANCE_EQUATIONS_INSTANTIATION
@@ -15,6 +15,7 @@
 
 #include <array>
 
+#include "tardigrade_error_policy.h"
 #include "tardigrade_error_tools.h"
 
 namespace tardigradeBalanceEquations {
@@ -38,6 +39,23 @@ namespace tardigradeBalanceEquations {
                                             floatVector grad_interp, const unsigned int index,
                                             output_iterator dgrad_adui_start);
 
+        template <int material_response_dim, int material_response_num_dof, int velocity_index,
+                  class material_response_jacobian_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class full_material_response_dof_gradient_iter,
+                  class mesh_displacement_perturbation_gradient_iter, typename dUDotdU_type, typename result_type>
+        void computeMaterialResponseDirectionalDerivative(
+            const unsigned int response_index, const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter         &material_response_jacobian_end,
+            const dof_perturbation_iter                   &dof_perturbation_begin,
+            const dof_perturbation_iter                   &dof_perturbation_end,
+            const dof_perturbation_gradient_iter          &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter          &dof_perturbation_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dUDotdU_type &dUDotdU, result_type &result);
+
     }  // namespace finiteElement
 
 }  // namespace tardigradeBalanceEquations
@@ -32,7 +32,7 @@ namespace tardigradeBalanceEquations {
         void computeGradientSpatialJacobian(const grad_iterator &grad_a_start, const unsigned int grad_a_size,
                                             floatVector grad_interp, const unsigned int index,
                                             output_iterator dgrad_adui_start) {
-            TARDIGRADE_ERROR_TOOLS_CHECK((grad_a_size % dim) == 0, "The incoming spatial gradient has a dimension of " +
+            TARDIGRADE_BALANCE_EQS_CHECK((grad_a_size % dim) == 0, "The incoming spatial gradient has a dimension of " +
                                                                        std::to_string(grad_a_size) +
                                                                        " which is not a multiple of " +
                                                                        std::to_string(dim));
@@ -48,6 +48,120 @@ namespace tardigradeBalanceEquations {
             }
         }
 
+        /*!
+         * Compute the directional derivative of one entry of a material response vector along a perturbation of the
+         * degrees of freedom i.e.
+         *
+         * \f$ \delta m_r = \frac{\partial m_r}{\partial q_K} \delta q_K + \frac{\partial m_r}{\partial q_{K,a}} \left(
+         * \delta q_{K,a} - q_{K,b} \delta u^{mesh}_{b,a} \right) \f$
+         *
+         * where the perturbation of the dof and its gradient are evaluated at the point by the caller and the columns
+         * of the velocity dof are scaled by \f$ \frac{D \dot{U}}{D U} \f$ to be consistent with the Jacobians of the
+         * balance equations.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * material_response_num_dof: The number of degrees of freedom for the material response
+         * velocity_index: The index of the velocity block in the material response dof vector
+         *
+         * \param &response_index: The index of the material response vector to differentiate
+         * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian
+         * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian
+         * \param &dof_perturbation_begin: The starting iterator of the perturbation of the material response dof
+         * vector
+         * \param &dof_perturbation_end: The stopping iterator of the perturbation of the material response dof vector
+         * \param &dof_perturbation_gradient_begin: The starting iterator of the spatial gradient of the perturbation
+         * of the material response dof vector
+         * \param &dof_perturbation_gradient_end: The stopping iterator of the spatial gradient of the perturbation of
+         * the material response dof vector
+         * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of the
+         * material response dof vector
+         * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of the
+         * material response dof vector
+         * \param &mesh_displacement_perturbation_gradient_begin: The starting iterator of the spatial gradient of the
+         * perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+         * \param &mesh_displacement_perturbation_gradient_end: The stopping iterator of the spatial gradient of the
+         * perturbation of the mesh displacement \f$ \left( \delta u^{mesh}_{a,b} \right) \f$
+         * \param &dUDotdU: The total derivative of the time derivative of the spatial dof w.r.t. the spatial dof
+         * \param &result: The directional derivative of the material response entry
+         */
+        template <int material_response_dim, int material_response_num_dof, int velocity_index,
+                  class material_response_jacobian_iter, class dof_perturbation_iter,
+                  class dof_perturbation_gradient_iter, class full_material_response_dof_gradient_iter,
+                  class mesh_displacement_perturbation_gradient_iter, typename dUDotdU_type, typename result_type>
+        void computeMaterialResponseDirectionalDerivative(
+            const unsigned int response_index, const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter         &material_response_jacobian_end,
+            const dof_perturbation_iter                   &dof_perturbation_begin,
+            const dof_perturbation_iter                   &dof_perturbation_end,
+            const dof_perturbation_gradient_iter          &dof_perturbation_gradient_begin,
+            const dof_perturbation_gradient_iter          &dof_perturbation_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_begin,
+            const mesh_displacement_perturbation_gradient_iter &mesh_displacement_perturbation_gradient_end,
+            const dUDotdU_type &dUDotdU, result_type &result) {
+            constexpr unsigned int num_phase_dof      = 4 + 2 * material_response_dim;
+            constexpr unsigned int num_additional_dof = material_response_num_dof - num_phase_dof;
+
+            const unsigned int num_dof = (unsigned int)(dof_perturbation_end - dof_perturbation_begin);
+
+            const unsigned int nphases = (num_dof - num_additional_dof) / num_phase_dof;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_dof == nphases * num_phase_dof + num_additional_dof,
+                                         "The dof perturbation has a size of " + std::to_string(num_dof) +
+                                             " which is not consistent with the material response number of dof")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                num_dof * material_response_dim ==
+                    (unsigned int)(dof_perturbation_gradient_end - dof_perturbation_gradient_begin),
+                "The dof perturbation gradient must be consistent with the dof perturbation")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                num_dof * material_response_dim == (unsigned int)(full_material_response_dof_gradient_end -
+                                                                  full_material_response_dof_gradient_begin),
+                "The full material response dof gradient must be consistent with the dof perturbation")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(material_response_dim * material_response_dim ==
+                                             (unsigned int)(mesh_displacement_perturbation_gradient_end -
+                                                            mesh_displacement_perturbation_gradient_begin),
+                                         "The mesh displacement perturbation gradient must have a size of dim * dim")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                num_dof * (1 + material_response_dim) * (response_index + 1) <=
+                    (unsigned int)(material_response_jacobian_end - material_response_jacobian_begin),
+                "The response index is outside of the material response Jacobian")
+
+            const material_response_jacobian_iter row_begin =
+                material_response_jacobian_begin + num_dof * (1 + material_response_dim) * response_index;
+
+            result = result_type();
+
+            for (unsigned int K = 0; K < num_dof; ++K) {
+                const bool is_velocity = (K >= nphases * velocity_index) &&
+                                         (K < nphases * (velocity_index + material_response_dim));
+
+                const dUDotdU_type scale = is_velocity ? dUDotdU : dUDotdU_type(1);
+
+                // DOF value contributions
+                result += (*(row_begin + K)) * scale * (*(dof_perturbation_begin + K));
+
+                // DOF spatial gradient contributions
+                for (unsigned int k = 0; k < material_response_dim; ++k) {
+                    result_type gradient_perturbation =
+                        scale * (*(dof_perturbation_gradient_begin + material_response_dim * K + k));
+
+                    // Change in the spatial gradient due to the motion of the mesh
+                    for (unsigned int a = 0; a < material_response_dim; ++a) {
+                        gradient_perturbation -=
+                            (*(full_material_response_dof_gradient_begin + material_response_dim * K + a)) *
+                            (*(mesh_displacement_perturbation_gradient_begin + material_response_dim * a + k));
+                    }
+
+                    result += (*(row_begin + num_dof + material_response_dim * K + k)) * gradient_perturbation;
+                }
+            }
+        }
+
     }  // namespace finiteElement
 
 }  // namespace tardigradeBalanceEquations
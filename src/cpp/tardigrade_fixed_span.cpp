@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_fixed_span.cpp
+ ******************************************************************************
+ * The source file for a non-owning view of a contiguous row-major array
+ * whose extents are known at compile time
+ ******************************************************************************
+ */
+
+#include "tardigrade_fixed_span.h"
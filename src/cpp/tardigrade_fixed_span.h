@@ -0,0 +1,117 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_fixed_span.h
+ ******************************************************************************
+ * The header file for a non-owning view of a contiguous row-major array
+ * whose extents are known at compile time. The view is the size of a
+ * pointer, its size and strides are constants, and a view of the wrong
+ * extents does not convert to the view a function expects so that size
+ * mismatches are found by the compiler rather than checked at run time.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_FIXED_SPAN_H
+#define TARDIGRADE_FIXED_SPAN_H
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace tardigradeBalanceEquations {
+
+    namespace fixedSpan {
+
+        typedef std::size_t size_type;  //!< The type of the extents and indices
+
+        template <typename T, size_type... extents>
+        class FixedSpan;
+
+        /*!
+         * The view of the trailing extents of a view i.e., the view of one index of the leading extent
+         */
+        template <typename T, size_type first, size_type... rest>
+        struct Trailing {
+            typedef FixedSpan<T, rest...> type;  //!< The view of the trailing extents
+
+            static constexpr size_type stride = (rest * ... * size_type(1));  //!< The size of the trailing extents
+        };
+
+        /*!
+         * A non-owning view of a contiguous row-major array with compile-time extents. The last index is contiguous.
+         * A view of const T is read only. A view of T converts to a view of const T with the same extents.
+         */
+        template <typename T, size_type... extents>
+        class FixedSpan {
+            static_assert(sizeof...(extents) > 0, "A view must have at least one extent");
+
+           public:
+            typedef T element_type;  //!< The type of the elements
+
+            typedef typename std::remove_cv<T>::type value_type;  //!< The type of the values
+
+            typedef T *iterator;  //!< The type of the iterators
+
+            typedef T &reference;  //!< The type of a reference to an element
+
+            static constexpr size_type rank = sizeof...(extents);  //!< The number of extents
+
+            static constexpr size_type static_size = (extents * ... * size_type(1));  //!< The number of elements
+
+            /*!
+             * Constructor for a view of an array
+             *
+             * \param *data: The first element of the array
+             */
+            constexpr explicit FixedSpan(T *data) : _data(data) {}
+
+            template <typename U, std::size_t N,
+                      typename = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+            constexpr FixedSpan(std::array<U, N> &array);
+
+            template <typename U, std::size_t N,
+                      typename = typename std::enable_if<std::is_convertible<const U (*)[], T (*)[]>::value>::type>
+            constexpr FixedSpan(const std::array<U, N> &array);
+
+            template <typename U,
+                      typename = typename std::enable_if<std::is_convertible<U (*)[], T (*)[]>::value>::type>
+            constexpr FixedSpan(const FixedSpan<U, extents...> &other);
+
+            //! Get the number of elements
+            static constexpr size_type size() { return static_size; }
+
+            //! Get the first element
+            constexpr T *data() const { return _data; }
+
+            //! Get the starting iterator
+            constexpr iterator begin() const { return _data; }
+
+            //! Get the stopping iterator
+            constexpr iterator end() const { return _data + static_size; }
+
+            /*!
+             * Get an element by its flat index
+             *
+             * \param index: The flat index
+             */
+            constexpr reference operator[](const size_type index) const { return _data[index]; }
+
+            template <typename... index_types>
+            constexpr reference operator()(const index_types... indices) const;
+
+            template <size_type r = rank, typename = typename std::enable_if<(r > 1)>::type>
+            constexpr typename Trailing<T, extents...>::type row(const size_type index) const;
+
+           protected:
+            T *_data;  //!< The first element of the array
+        };
+
+        template <size_type... extents, typename T>
+        constexpr FixedSpan<T, extents...> makeFixedSpan(T *data);
+
+    }  // namespace fixedSpan
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_fixed_span.tpp"
+
+#endif
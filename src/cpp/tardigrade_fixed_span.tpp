@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_fixed_span.tpp
+ ******************************************************************************
+ * The template file for a non-owning view of a contiguous row-major array
+ * whose extents are known at compile time
+ ******************************************************************************
+ */
+
+#include "tardigrade_fixed_span.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace fixedSpan {
+
+        /*!
+         * Constructor for a view of a std::array. The array must have as many elements as the view.
+         *
+         * \param &array: The array
+         */
+        template <typename T, size_type... extents>
+        template <typename U, std::size_t N, typename>
+        constexpr FixedSpan<T, extents...>::FixedSpan(std::array<U, N> &array) : _data(array.data()) {
+            static_assert(N == static_size, "The array must have as many elements as the view");
+        }
+
+        /*!
+         * Constructor for a view of a constant std::array. The array must have as many elements as the view.
+         *
+         * \param &array: The array
+         */
+        template <typename T, size_type... extents>
+        template <typename U, std::size_t N, typename>
+        constexpr FixedSpan<T, extents...>::FixedSpan(const std::array<U, N> &array) : _data(array.data()) {
+            static_assert(N == static_size, "The array must have as many elements as the view");
+        }
+
+        /*!
+         * Constructor for a view from a view of the same extents e.g., a read only view of a writeable view
+         *
+         * \param &other: The other view
+         */
+        template <typename T, size_type... extents>
+        template <typename U, typename>
+        constexpr FixedSpan<T, extents...>::FixedSpan(const FixedSpan<U, extents...> &other) : _data(other.data()) {}
+
+        /*!
+         * Get an element by its multi-dimensional index. The number of indices must be equal to the rank. The offset
+         * of the element is computed from the constant extents so no divisions are required.
+         *
+         * \param indices: The index of each extent
+         */
+        template <typename T, size_type... extents>
+        template <typename... index_types>
+        constexpr typename FixedSpan<T, extents...>::reference FixedSpan<T, extents...>::operator()(
+            const index_types... indices) const {
+            static_assert(sizeof...(index_types) == rank, "The number of indices must be equal to the rank");
+
+            constexpr size_type shape[rank] = {extents...};
+
+            const size_type index[rank] = {size_type(indices)...};
+
+            size_type offset = 0;
+
+            for (size_type r = 0; r < rank; ++r) {
+                offset = shape[r] * offset + index[r];
+            }
+
+            return _data[offset];
+        }
+
+        /*!
+         * Get the view of one index of the leading extent. For example, the row of a phase of a view with extents of
+         * ( nphases, dim ) is a view with an extent of ( dim ).
+         *
+         * \param index: The index of the leading extent
+         */
+        template <typename T, size_type... extents>
+        template <size_type r, typename>
+        constexpr typename Trailing<T, extents...>::type FixedSpan<T, extents...>::row(const size_type index) const {
+            return typename Trailing<T, extents...>::type(_data + Trailing<T, extents...>::stride * index);
+        }
+
+        /*!
+         * Make a view of an array from its first element
+         *
+         * \param *data: The first element of the array
+         */
+        template <size_type... extents, typename T>
+        constexpr FixedSpan<T, extents...> makeFixedSpan(T *data) {
+            return FixedSpan<T, extents...>(data);
+        }
+
+    }  // namespace fixedSpan
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_instrumentation.cpp
+ ******************************************************************************
+ * The source file for the instrumentation of the hot paths
+ ******************************************************************************
+ */
+
+#include "tardigrade_instrumentation.h"
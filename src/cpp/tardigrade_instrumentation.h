@@ -0,0 +1,220 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_instrumentation.h
+ ******************************************************************************
+ * The header file for the instrumentation of the hot paths. The element
+ * geometry, the interpolation of the degrees of freedom, the residual and
+ * Jacobian paths of each balance equation, the chain-rule contractions with
+ * the material response Jacobian, and the volume fraction cutoff branches
+ * count their calls, elapsed ticks, and estimated floating point operations
+ * so that the time of a simulation may be attributed to the physics without
+ * an external profiler. The counters are kept per thread and are merged when
+ * they are reported.
+ *
+ * The instrumentation is compiled out unless
+ * TARDIGRADE_BALANCE_EQUATIONS_ENABLE_INSTRUMENTATION is defined. Otherwise
+ * the macros of the kernels expand to nothing and the estimates of the
+ * operations are never evaluated. The estimates are the floating point
+ * operations of the cost model of tardigrade_cost_model.h.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_INSTRUMENTATION_H
+#define TARDIGRADE_INSTRUMENTATION_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+#include "tardigrade_cost_model.h"
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace instrumentation {
+
+        typedef double floatType;  //!< The type of the estimated operations
+
+        /*!
+         * The instrumented kernels. The counters are inclusive so the time of the element geometry called by the
+         * interpolation of gradients and the time of the chain rule called by the Jacobians is also counted by the
+         * callers.
+         */
+        enum Kernel : unsigned int {
+            ELEMENT_GEOMETRY                    = 0,   //!< The shape function gradients and Jacobian of transformation
+            INTERPOLATION                       = 1,   //!< The interpolation of quantities and their gradients
+            BALANCE_OF_MASS_RESIDUAL            = 2,   //!< The residual of the balance of mass of a phase
+            BALANCE_OF_MASS_JACOBIAN            = 3,   //!< The Jacobian of the balance of mass of a phase
+            BALANCE_OF_LINEAR_MOMENTUM_RESIDUAL = 4,   //!< The residual of the balance of linear momentum of a phase
+            BALANCE_OF_LINEAR_MOMENTUM_JACOBIAN = 5,   //!< The Jacobian of the balance of linear momentum of a phase
+            BALANCE_OF_ENERGY_RESIDUAL          = 6,   //!< The residual of the balance of energy of a phase
+            BALANCE_OF_ENERGY_JACOBIAN          = 7,   //!< The Jacobian of the balance of energy of a phase
+            BALANCE_OF_VOLUME_FRACTION_RESIDUAL = 8,   //!< The residual of the balance of volume fraction of a phase
+            BALANCE_OF_VOLUME_FRACTION_JACOBIAN = 9,   //!< The Jacobian of the balance of volume fraction of a phase
+            INTERNAL_ENERGY_CONSTRAINT_RESIDUAL = 10,  //!< The residual of the internal energy constraint of a phase
+            INTERNAL_ENERGY_CONSTRAINT_JACOBIAN = 11,  //!< The Jacobian of the internal energy constraint of a phase
+            SURFACE_GROWTH_RESIDUAL             = 12,  //!< The residual of the surface growth balance
+            SURFACE_GROWTH_JACOBIAN             = 13,  //!< The Jacobian of the surface growth balance
+            MIXTURE_MATERIAL_RESPONSE           = 14,  //!< The mixture material response and its Jacobian
+            CHAIN_RULE                          = 15,  //!< The contractions with the material response Jacobian
+            VOLUME_FRACTION_CUTOFF              = 16,  //!< The volume fractions below the tolerance
+            NUM_KERNELS                         = 17   //!< The number of kernels
+        };
+
+        /*!
+         * The merged counters of a kernel
+         */
+        struct KernelCounters {
+            std::uint64_t calls = 0;  //!< The number of calls
+
+            std::uint64_t ticks = 0;  //!< The elapsed ticks
+
+            std::uint64_t flops = 0;  //!< The estimated floating point operations
+        };
+
+        /*!
+         * The counters of one thread. Only the owning thread writes to the counters. The counters are atomic so that
+         * they may be read while the thread is running but the updates are relaxed loads and stores and so are as
+         * cheap as plain increments.
+         */
+        class ThreadCounters {
+           public:
+            ThreadCounters() {
+                for (auto &value : _values) {
+                    value.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            /*!
+             * Add a call of a kernel
+             *
+             * \param kernel: The kernel
+             * \param ticks: The elapsed ticks of the call
+             * \param flops: The estimated floating point operations of the call
+             */
+            void add(const Kernel kernel, const std::uint64_t ticks, const std::uint64_t flops) {
+                increment(3 * kernel + 0, 1);
+                increment(3 * kernel + 1, ticks);
+                increment(3 * kernel + 2, flops);
+            }
+
+            /*!
+             * Get the counters of a kernel
+             *
+             * \param kernel: The kernel
+             */
+            KernelCounters get(const Kernel kernel) const {
+                KernelCounters counters;
+                counters.calls = _values[3 * kernel + 0].load(std::memory_order_relaxed);
+                counters.ticks = _values[3 * kernel + 1].load(std::memory_order_relaxed);
+                counters.flops = _values[3 * kernel + 2].load(std::memory_order_relaxed);
+                return counters;
+            }
+
+            //! Reset the counters
+            void reset() {
+                for (auto &value : _values) {
+                    value.store(0, std::memory_order_relaxed);
+                }
+            }
+
+           protected:
+            /*!
+             * Increment a counter of the owning thread
+             *
+             * \param index: The index of the counter
+             * \param amount: The amount to add
+             */
+            void increment(const unsigned int index, const std::uint64_t amount) {
+                _values[index].store(_values[index].load(std::memory_order_relaxed) + amount,
+                                     std::memory_order_relaxed);
+            }
+
+            std::array<std::atomic<std::uint64_t>, 3 * NUM_KERNELS> _values;  //!< The calls, ticks, and flops
+        };
+
+        /*!
+         * The counters of all of the threads which have called an instrumented kernel. The counters of a thread are
+         * kept after the thread exits so that the calls of short-lived threads are still reported.
+         */
+        struct CounterRegistry {
+            std::mutex mutex;  //!< The mutex protecting the counters
+
+            std::vector<std::unique_ptr<ThreadCounters>> counters;  //!< The counters of each thread
+        };
+
+        /*!
+         * Time a call of a kernel from construction to destruction and add it to the counters of the calling thread
+         */
+        class ScopedKernelTimer {
+           public:
+            inline ScopedKernelTimer(const Kernel kernel, const floatType flops);
+
+            inline ~ScopedKernelTimer();
+
+            ScopedKernelTimer(const ScopedKernelTimer &) = delete;
+
+            ScopedKernelTimer &operator=(const ScopedKernelTimer &) = delete;
+
+           protected:
+            Kernel _kernel;  //!< The kernel
+
+            std::uint64_t _flops;  //!< The estimated floating point operations of the call
+
+            std::uint64_t _start;  //!< The ticks at the start of the call
+        };
+
+        //! Check if the instrumentation of the kernels is compiled in
+        constexpr bool isEnabled() {
+#ifdef TARDIGRADE_BALANCE_EQUATIONS_ENABLE_INSTRUMENTATION
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        inline const char *getKernelName(const Kernel kernel);
+
+        inline std::uint64_t readTicks();
+
+        inline CounterRegistry &getCounterRegistry();
+
+        inline ThreadCounters &getThreadCounters();
+
+        inline void countCall(const Kernel kernel);
+
+        inline std::array<KernelCounters, NUM_KERNELS> getCounters();
+
+        inline void resetCounters();
+
+        inline void writeReport(std::ostream &stream);
+
+    }  // namespace instrumentation
+
+}  // namespace tardigradeBalanceEquations
+
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENTATION_CONCATENATE_IMPLEMENTATION(a, b) a##b
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENTATION_CONCATENATE(a, b)                                                \
+    TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENTATION_CONCATENATE_IMPLEMENTATION(a, b)
+
+#ifdef TARDIGRADE_BALANCE_EQUATIONS_ENABLE_INSTRUMENTATION
+//! Time the enclosing scope as a call of a kernel with an estimate of its floating point operations
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(kernel, flops)                                                        \
+    const tardigradeBalanceEquations::instrumentation::ScopedKernelTimer                                              \
+        TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENTATION_CONCATENATE(_instrumentation_timer_, __LINE__)(                  \
+            tardigradeBalanceEquations::instrumentation::kernel, flops);
+//! Count a call of a kernel which is not timed e.g., a branch
+#define TARDIGRADE_BALANCE_EQUATIONS_COUNT(kernel)                                                                    \
+    tardigradeBalanceEquations::instrumentation::countCall(tardigradeBalanceEquations::instrumentation::kernel);
+#else
+#define TARDIGRADE_BALANCE_EQUATIONS_INSTRUMENT(kernel, flops)
+#define TARDIGRADE_BALANCE_EQUATIONS_COUNT(kernel)
+#endif
+
+#include "tardigrade_instrumentation.tpp"
+
+#endif
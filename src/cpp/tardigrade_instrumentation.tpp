@@ -0,0 +1,198 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_instrumentation.tpp
+ ******************************************************************************
+ * The template file for the instrumentation of the hot paths
+ ******************************************************************************
+ */
+
+#include <chrono>
+#include <iomanip>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+#include "tardigrade_instrumentation.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace instrumentation {
+
+        /*!
+         * Start timing a call of a kernel
+         *
+         * \param kernel: The kernel
+         * \param flops: The estimated floating point operations of the call
+         */
+        inline ScopedKernelTimer::ScopedKernelTimer(const Kernel kernel, const floatType flops)
+            : _kernel(kernel), _flops((std::uint64_t)flops), _start(readTicks()) {}
+
+        /*!
+         * Stop timing the call and add it to the counters of the calling thread
+         */
+        inline ScopedKernelTimer::~ScopedKernelTimer() {
+            const std::uint64_t stop = readTicks();
+
+            getThreadCounters().add(_kernel, stop - _start, _flops);
+        }
+
+        /*!
+         * Get the name of a kernel
+         *
+         * \param kernel: The kernel
+         */
+        inline const char *getKernelName(const Kernel kernel) {
+            static const char *names[NUM_KERNELS] = {"element geometry",
+                                                     "interpolation",
+                                                     "balance of mass residual",
+                                                     "balance of mass jacobian",
+                                                     "balance of linear momentum residual",
+                                                     "balance of linear momentum jacobian",
+                                                     "balance of energy residual",
+                                                     "balance of energy jacobian",
+                                                     "balance of volume fraction residual",
+                                                     "balance of volume fraction jacobian",
+                                                     "internal energy constraint residual",
+                                                     "internal energy constraint jacobian",
+                                                     "surface growth residual",
+                                                     "surface growth jacobian",
+                                                     "mixture material response",
+                                                     "chain rule",
+                                                     "volume fraction cutoff"};
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(kernel < NUM_KERNELS, "The kernel " + std::to_string(kernel) +
+                                                                   " is larger than the number of kernels")
+
+            return names[kernel];
+        }
+
+        /*!
+         * Read the tick counter. The time stamp counter is used on x86 and the steady clock in nanoseconds otherwise.
+         */
+        inline std::uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+            return (std::uint64_t)__rdtsc();
+#else
+            return (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+#endif
+        }
+
+        /*!
+         * Get the registry of the counters of all of the threads
+         */
+        inline CounterRegistry &getCounterRegistry() {
+            static CounterRegistry registry;
+
+            return registry;
+        }
+
+        /*!
+         * Get the counters of the calling thread. The counters are registered the first time a thread calls an
+         * instrumented kernel and later calls only read a thread-local pointer.
+         */
+        inline ThreadCounters &getThreadCounters() {
+            static thread_local ThreadCounters *counters = nullptr;
+
+            if (!counters) {
+                CounterRegistry &registry = getCounterRegistry();
+
+                std::lock_guard<std::mutex> lock(registry.mutex);
+
+                registry.counters.push_back(std::unique_ptr<ThreadCounters>(new ThreadCounters()));
+
+                counters = registry.counters.back().get();
+            }
+
+            return *counters;
+        }
+
+        /*!
+         * Count a call of a kernel which is not timed
+         *
+         * \param kernel: The kernel
+         */
+        inline void countCall(const Kernel kernel) { getThreadCounters().add(kernel, 0, 0); }
+
+        /*!
+         * Get the counters of each kernel merged over all of the threads. The counters of threads which are running
+         * kernels may be read but the counts of their calls in progress are not included.
+         */
+        inline std::array<KernelCounters, NUM_KERNELS> getCounters() {
+            std::array<KernelCounters, NUM_KERNELS> merged;
+
+            CounterRegistry &registry = getCounterRegistry();
+
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            for (const auto &counters : registry.counters) {
+                for (unsigned int kernel = 0; kernel < NUM_KERNELS; ++kernel) {
+                    const KernelCounters thread_counters = counters->get(Kernel(kernel));
+
+                    merged[kernel].calls += thread_counters.calls;
+                    merged[kernel].ticks += thread_counters.ticks;
+                    merged[kernel].flops += thread_counters.flops;
+                }
+            }
+
+            return merged;
+        }
+
+        /*!
+         * Reset the counters of all of the threads. The counters should only be reset while no instrumented kernels
+         * are running.
+         */
+        inline void resetCounters() {
+            CounterRegistry &registry = getCounterRegistry();
+
+            std::lock_guard<std::mutex> lock(registry.mutex);
+
+            for (const auto &counters : registry.counters) {
+                counters->reset();
+            }
+        }
+
+        /*!
+         * Write the merged counters of the kernels which have been called as a table. The ticks are inclusive of
+         * the nested kernels.
+         *
+         * \param &stream: The stream to write to
+         */
+        inline void writeReport(std::ostream &stream) {
+            const std::array<KernelCounters, NUM_KERNELS> counters = getCounters();
+
+            const std::ios_base::fmtflags flags     = stream.flags();
+            const std::streamsize         precision = stream.precision();
+
+            stream << std::left << std::setw(37) << "kernel" << std::right << std::setw(14) << "calls" << std::setw(18)
+                   << "ticks" << std::setw(14) << "ticks/call" << std::setw(18) << "flops" << std::setw(12)
+                   << "flops/tick"
+                   << "\n";
+
+            stream << std::fixed << std::setprecision(2);
+
+            for (unsigned int kernel = 0; kernel < NUM_KERNELS; ++kernel) {
+                const KernelCounters &c = counters[kernel];
+
+                if (c.calls == 0) {
+                    continue;
+                }
+
+                stream << std::left << std::setw(37) << getKernelName(Kernel(kernel)) << std::right << std::setw(14)
+                       << c.calls << std::setw(18) << c.ticks << std::setw(14) << (double)c.ticks / c.calls
+                       << std::setw(18) << c.flops << std::setw(12)
+                       << ((c.ticks > 0) ? (double)c.flops / c.ticks : 0.)
+                       << "\n";
+            }
+
+            stream.flags(flags);
+            stream.precision(precision);
+        }
+
+    }  // namespace instrumentation
+
+}  // namespace tardigradeBalanceEquations
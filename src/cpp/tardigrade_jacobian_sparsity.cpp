@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_jacobian_sparsity.cpp
+ ******************************************************************************
+ * The source file for the structural sparsity of the multiphase Jacobians
+ ******************************************************************************
+ */
+
+#include "tardigrade_jacobian_sparsity.h"
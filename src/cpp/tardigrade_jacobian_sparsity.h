@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_jacobian_sparsity.h
+ ******************************************************************************
+ * The header file for the structural sparsity of the multiphase Jacobians.
+ * The degrees of freedom of a multiphase material point are grouped into
+ * field blocks. A sparsity pattern states at compile time which field blocks
+ * a residual depends on and whether it depends on the block of its own phase
+ * only or on the blocks of all phases. Jacobians may then be written in a
+ * compressed form which only stores the structurally non-zero columns.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_JACOBIAN_SPARSITY_H
+#define TARDIGRADE_JACOBIAN_SPARSITY_H
+
+#include <array>
+
+#include "tardigrade_error_policy.h"
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace jacobianSparsity {
+
+        /*!
+         * The field blocks of the degrees of freedom of a multiphase material point. The order of the flags is the
+         * order of the blocks in the dense and compressed Jacobians.
+         */
+        enum FieldBlock : unsigned int {
+            DENSITY         = 1u << 0,  //!< The density of each phase
+            VELOCITY        = 1u << 1,  //!< The spatial degree of freedom of each phase whose rate is the velocity
+            DISPLACEMENT    = 1u << 2,  //!< The displacement of each phase
+            TEMPERATURE     = 1u << 3,  //!< The temperature of each phase
+            INTERNAL_ENERGY = 1u << 4,  //!< The internal energy of each phase
+            VOLUME_FRACTION = 1u << 5,  //!< The volume fraction of each phase
+            ADDITIONAL_DOF  = 1u << 6   //!< The additional degrees of freedom which are shared by all of the phases
+        };
+
+        constexpr unsigned int num_field_blocks = 7;  //!< The number of field blocks
+
+        constexpr unsigned int all_fields = (1u << num_field_blocks) - 1;  //!< The mask of all of the field blocks
+
+        /*!
+         * The structural sparsity pattern of a residual of a phase
+         *
+         * \param local_field_mask: The field blocks the residual depends on only through its own phase
+         * \param global_field_mask: The field blocks the residual depends on through all of the phases
+         */
+        template <unsigned int local_field_mask, unsigned int global_field_mask>
+        struct SparsityPattern {
+            static constexpr unsigned int local_fields = local_field_mask;  //!< The phase-local field blocks
+
+            static constexpr unsigned int global_fields = global_field_mask;  //!< The field blocks of all phases
+
+            static constexpr unsigned int fields = local_field_mask | global_field_mask;  //!< All non-zero blocks
+
+            /*!
+             * Check if a field block is structurally non-zero
+             *
+             * \param field: The field block
+             */
+            static constexpr bool hasField(const unsigned int field) { return (fields & field) != 0; }
+
+            /*!
+             * Check if a field block couples all of the phases
+             *
+             * \param field: The field block
+             */
+            static constexpr bool isGlobal(const unsigned int field) { return (global_fields & field) != 0; }
+        };
+
+        //! A pattern where the residual depends on every field block of every phase
+        using DensePattern = SparsityPattern<0, all_fields>;
+
+        //! The union of two sparsity patterns
+        template <class pattern_a, class pattern_b>
+        using PatternUnion = SparsityPattern<(pattern_a::local_fields | pattern_b::local_fields) &
+                                                 ~(pattern_a::global_fields | pattern_b::global_fields),
+                                             pattern_a::global_fields | pattern_b::global_fields>;
+
+        constexpr unsigned int getFieldWidth(const unsigned int field, const unsigned int dim,
+                                             const unsigned int num_additional_dof);
+
+        template <class pattern>
+        constexpr unsigned int getFieldColumns(const unsigned int field, const unsigned int dim,
+                                               const unsigned int nphases, const unsigned int num_additional_dof);
+
+        template <class pattern>
+        constexpr unsigned int getFieldOffset(const unsigned int field, const unsigned int dim,
+                                              const unsigned int nphases, const unsigned int num_additional_dof);
+
+        template <class pattern>
+        constexpr unsigned int getNumColumns(const unsigned int dim, const unsigned int nphases,
+                                             const unsigned int num_additional_dof);
+
+        template <class pattern>
+        constexpr unsigned int getPhaseFieldOffset(const unsigned int field, const unsigned int dim,
+                                                   const unsigned int nphases, const unsigned int num_additional_dof,
+                                                   const unsigned int phase);
+
+        template <class pattern, int dim, class column_iter>
+        void getDenseColumnIndices(const unsigned int nphases, const unsigned int num_additional_dof,
+                                   const unsigned int phase, column_iter column_begin, column_iter column_end);
+
+        template <class pattern, int dim, class compressed_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
+                  class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter>
+        void expandCompressedJacobian(const unsigned int nphases, const unsigned int num_additional_dof,
+                                      const unsigned int phase, const compressed_iter &compressed_begin,
+                                      const compressed_iter &compressed_end, dRdRho_iter dRdRho_begin,
+                                      dRdRho_iter dRdRho_end, dRdU_iter dRdU_begin, dRdU_iter dRdU_end,
+                                      dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
+                                      dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
+                                      dRdVolumeFraction_iter dRdVolumeFraction_begin,
+                                      dRdVolumeFraction_iter dRdVolumeFraction_end, dRdZ_iter dRdZ_begin,
+                                      dRdZ_iter dRdZ_end);
+
+        template <class pattern, class material_response_pattern, int dim, int material_response_dim,
+                  unsigned int num_response_rows, class response_row_iter, class response_coefficient_iter,
+                  class material_response_jacobian_iter, typename interpolation_function_type,
+                  class interpolation_function_gradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dUDotdU_type, class jacobian_iter, class dRdUMesh_iter>
+        void addMaterialResponseJacobian(
+            const unsigned int nphases, const unsigned int num_additional_dof, const unsigned int phase,
+            const std::array<unsigned int, num_field_blocks> &field_indices,
+            const response_row_iter &response_row_begin, const response_row_iter &response_row_end,
+            const response_coefficient_iter               &response_coefficient_begin,
+            const response_coefficient_iter               &response_coefficient_end,
+            const material_response_jacobian_iter         &material_response_jacobian_begin,
+            const material_response_jacobian_iter         &material_response_jacobian_end,
+            const interpolation_function_type             &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dUDotdU_type &dUDotdU, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end);
+
+    }  // namespace jacobianSparsity
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_jacobian_sparsity.tpp"
+
+#endif
@@ -0,0 +1,418 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_jacobian_sparsity.tpp
+ ******************************************************************************
+ * The template file for the structural sparsity of the multiphase Jacobians
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <iterator>
+
+#include "tardigrade_jacobian_sparsity.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace jacobianSparsity {
+
+        /*!
+         * Get the number of degrees of freedom of a field block for a single phase. The additional degrees of freedom
+         * are shared by all of the phases.
+         *
+         * \param field: The field block
+         * \param dim: The spatial dimension
+         * \param num_additional_dof: The number of additional degrees of freedom
+         */
+        constexpr unsigned int getFieldWidth(const unsigned int field, const unsigned int dim,
+                                             const unsigned int num_additional_dof) {
+            return (field == ADDITIONAL_DOF)                      ? num_additional_dof
+                   : ((field == VELOCITY) || (field == DISPLACEMENT)) ? dim
+                                                                      : 1;
+        }
+
+        /*!
+         * Get the number of columns of a field block in the compressed Jacobian
+         *
+         * \param field: The field block
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         */
+        template <class pattern>
+        constexpr unsigned int getFieldColumns(const unsigned int field, const unsigned int dim,
+                                               const unsigned int nphases, const unsigned int num_additional_dof) {
+            return !pattern::hasField(field) ? 0
+                   : ((field == ADDITIONAL_DOF) || !pattern::isGlobal(field))
+                       ? getFieldWidth(field, dim, num_additional_dof)
+                       : nphases * getFieldWidth(field, dim, num_additional_dof);
+        }
+
+        /*!
+         * Get the column of the compressed Jacobian where a field block starts
+         *
+         * \param field: The field block
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         */
+        template <class pattern>
+        constexpr unsigned int getFieldOffset(const unsigned int field, const unsigned int dim,
+                                              const unsigned int nphases, const unsigned int num_additional_dof) {
+            unsigned int offset = 0;
+
+            for (unsigned int block = 1; block < field; block <<= 1) {
+                offset += getFieldColumns<pattern>(block, dim, nphases, num_additional_dof);
+            }
+
+            return offset;
+        }
+
+        /*!
+         * Get the number of columns of the compressed Jacobian
+         *
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         */
+        template <class pattern>
+        constexpr unsigned int getNumColumns(const unsigned int dim, const unsigned int nphases,
+                                             const unsigned int num_additional_dof) {
+            return getFieldOffset<pattern>(1u << num_field_blocks, dim, nphases, num_additional_dof);
+        }
+
+        /*!
+         * Get the column of the compressed Jacobian where the degrees of freedom of a phase in a field block start.
+         * The field block must be structurally non-zero.
+         *
+         * \param field: The field block
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         * \param phase: The phase the residual is computed for
+         */
+        template <class pattern>
+        constexpr unsigned int getPhaseFieldOffset(const unsigned int field, const unsigned int dim,
+                                                   const unsigned int nphases, const unsigned int num_additional_dof,
+                                                   const unsigned int phase) {
+            return getFieldOffset<pattern>(field, dim, nphases, num_additional_dof) +
+                   (((field != ADDITIONAL_DOF) && pattern::isGlobal(field))
+                        ? phase * getFieldWidth(field, dim, num_additional_dof)
+                        : 0);
+        }
+
+        /*!
+         * Get the columns of the dense multiphase Jacobian which correspond to the columns of the compressed Jacobian.
+         * The dense columns are ordered as the concatenation of the dRdRho, dRdU, dRdW, dRdTheta, dRdE,
+         * dRdVolumeFraction, and dRdZ rows of the multiphase Jacobians so that the compressed Jacobian can be scattered
+         * directly into a global matrix.
+         *
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         * \param phase: The phase the residual is computed for
+         * \param column_begin: The starting iterator of the dense columns
+         * \param column_end: The stopping iterator of the dense columns
+         */
+        template <class pattern, int dim, class column_iter>
+        void getDenseColumnIndices(const unsigned int nphases, const unsigned int num_additional_dof,
+                                   const unsigned int phase, column_iter column_begin, column_iter column_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                getNumColumns<pattern>(dim, nphases, num_additional_dof) == (unsigned int)(column_end - column_begin),
+                "The columns must have a size equal to the number of compressed columns")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(phase < nphases, "The phase must be less than the number of phases")
+
+            unsigned int dense_offset = 0;
+
+            column_iter column = column_begin;
+
+            for (unsigned int field = 1; field < (1u << num_field_blocks); field <<= 1) {
+                const unsigned int width = getFieldWidth(field, dim, num_additional_dof);
+
+                if (pattern::hasField(field)) {
+                    if (field == ADDITIONAL_DOF) {
+                        for (unsigned int z = 0; z < width; ++z, ++column) {
+                            *column = dense_offset + z;
+                        }
+                    } else {
+                        const unsigned int first_phase = pattern::isGlobal(field) ? 0 : phase;
+                        const unsigned int last_phase  = pattern::isGlobal(field) ? nphases : phase + 1;
+
+                        for (unsigned int p = first_phase; p < last_phase; ++p) {
+                            for (unsigned int k = 0; k < width; ++k, ++column) {
+                                *column = dense_offset + width * p + k;
+                            }
+                        }
+                    }
+                }
+
+                dense_offset += (field == ADDITIONAL_DOF) ? width : nphases * width;
+            }
+        }
+
+        /*!
+         * Expand a compressed Jacobian into the dense multiphase Jacobians. The dense Jacobians are zero wherever the
+         * pattern is structurally zero.
+         *
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         * \param phase: The phase the residual is computed for
+         * \param &compressed_begin: The starting iterator of the compressed Jacobian
+         * \param &compressed_end: The stopping iterator of the compressed Jacobian
+         * \param dRdRho_begin: The starting iterator of the Jacobian w.r.t. the density
+         * \param dRdRho_end: The stopping iterator of the Jacobian w.r.t. the density
+         * \param dRdU_begin: The starting iterator of the Jacobian w.r.t. the spatial degree of freedom
+         * \param dRdU_end: The stopping iterator of the Jacobian w.r.t. the spatial degree of freedom
+         * \param dRdW_begin: The starting iterator of the Jacobian w.r.t. the displacement
+         * \param dRdW_end: The stopping iterator of the Jacobian w.r.t. the displacement
+         * \param dRdTheta_begin: The starting iterator of the Jacobian w.r.t. the temperature
+         * \param dRdTheta_end: The stopping iterator of the Jacobian w.r.t. the temperature
+         * \param dRdE_begin: The starting iterator of the Jacobian w.r.t. the internal energy
+         * \param dRdE_end: The stopping iterator of the Jacobian w.r.t. the internal energy
+         * \param dRdVolumeFraction_begin: The starting iterator of the Jacobian w.r.t. the volume fraction
+         * \param dRdVolumeFraction_end: The stopping iterator of the Jacobian w.r.t. the volume fraction
+         * \param dRdZ_begin: The starting iterator of the Jacobian w.r.t. the additional dof
+         * \param dRdZ_end: The stopping iterator of the Jacobian w.r.t. the additional dof
+         */
+        template <class pattern, int dim, class compressed_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
+                  class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter>
+        void expandCompressedJacobian(const unsigned int nphases, const unsigned int num_additional_dof,
+                                      const unsigned int phase, const compressed_iter &compressed_begin,
+                                      const compressed_iter &compressed_end, dRdRho_iter dRdRho_begin,
+                                      dRdRho_iter dRdRho_end, dRdU_iter dRdU_begin, dRdU_iter dRdU_end,
+                                      dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
+                                      dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
+                                      dRdVolumeFraction_iter dRdVolumeFraction_begin,
+                                      dRdVolumeFraction_iter dRdVolumeFraction_end, dRdZ_iter dRdZ_begin,
+                                      dRdZ_iter dRdZ_end) {
+            const unsigned int num_columns = getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_columns > 0, "The pattern must have at least one column")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(compressed_end - compressed_begin) % num_columns == 0,
+                                         "The compressed Jacobian must have a whole number of rows")
+
+            const unsigned int num_rows = (unsigned int)(compressed_end - compressed_begin) / num_columns;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_rows * nphases == (unsigned int)(dRdRho_end - dRdRho_begin),
+                                         "dRdRho has an inconsistent size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_rows * nphases * dim == (unsigned int)(dRdU_end - dRdU_begin),
+                                         "dRdU has an inconsistent size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_rows * nphases * dim == (unsigned int)(dRdW_end - dRdW_begin),
+                                         "dRdW has an inconsistent size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_rows * nphases == (unsigned int)(dRdTheta_end - dRdTheta_begin),
+                                         "dRdTheta has an inconsistent size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_rows * nphases == (unsigned int)(dRdE_end - dRdE_begin),
+                                         "dRdE has an inconsistent size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                num_rows * nphases == (unsigned int)(dRdVolumeFraction_end - dRdVolumeFraction_begin),
+                "dRdVolumeFraction has an inconsistent size")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(num_rows * num_additional_dof == (unsigned int)(dRdZ_end - dRdZ_begin),
+                                         "dRdZ has an inconsistent size")
+
+            auto expand = [&](const unsigned int field, auto dense_begin, auto dense_end) {
+                using dense_type = typename std::iterator_traits<decltype(dense_begin)>::value_type;
+
+                std::fill(dense_begin, dense_end, dense_type());
+
+                if (!pattern::hasField(field)) {
+                    return;
+                }
+
+                const unsigned int width  = getFieldWidth(field, dim, num_additional_dof);
+                const unsigned int offset = getFieldOffset<pattern>(field, dim, nphases, num_additional_dof);
+                const unsigned int dense_width = (unsigned int)(dense_end - dense_begin) / num_rows;
+
+                const unsigned int first_column =
+                    ((field == ADDITIONAL_DOF) || pattern::isGlobal(field)) ? 0 : width * phase;
+                const unsigned int num_field_columns =
+                    getFieldColumns<pattern>(field, dim, nphases, num_additional_dof);
+
+                for (unsigned int i = 0; i < num_rows; ++i) {
+                    std::copy(compressed_begin + num_columns * i + offset,
+                              compressed_begin + num_columns * i + offset + num_field_columns,
+                              dense_begin + dense_width * i + first_column);
+                }
+            };
+
+            expand(DENSITY, dRdRho_begin, dRdRho_end);
+            expand(VELOCITY, dRdU_begin, dRdU_end);
+            expand(DISPLACEMENT, dRdW_begin, dRdW_end);
+            expand(TEMPERATURE, dRdTheta_begin, dRdTheta_end);
+            expand(INTERNAL_ENERGY, dRdE_begin, dRdE_end);
+            expand(VOLUME_FRACTION, dRdVolumeFraction_begin, dRdVolumeFraction_end);
+            expand(ADDITIONAL_DOF, dRdZ_begin, dRdZ_end);
+        }
+
+        /*!
+         * Add the contribution of the material response to a compressed Jacobian and to the Jacobian w.r.t. the mesh
+         * displacement. Each row of the residual is a linear combination of rows of the material response
+         *
+         * \f$ \frac{\partial R_i}{\partial U_K} \mathrel{+}= c_{ir} \left( \frac{\partial M_r}{\partial U_K} \phi +
+         * \frac{\partial M_r}{\partial U_{K,a}} \phi_{,a} \right) \f$
+         *
+         * where \f$ c_{ir} \f$ are the response coefficients. The velocity columns are scaled by dUDotdU. The
+         * material response Jacobian is assumed to be zero outside of material_response_pattern so only the columns of
+         * the field blocks of material_response_pattern are visited. The Jacobians are not zeroed.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * num_response_rows: The number of rows of the material response the residual depends on
+         *
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         * \param phase: The phase the residual is computed for
+         * \param &field_indices: The index of each field block in the degrees of freedom of the material response in
+         * the order of the flags of FieldBlock
+         * \param &response_row_begin: The starting iterator of the rows of the material response
+         * \param &response_row_end: The stopping iterator of the rows of the material response
+         * \param &response_coefficient_begin: The starting iterator of the coefficients of the rows of the material
+         * response in each row of the residual stored row-major
+         * \param &response_coefficient_end: The stopping iterator of the coefficients of the rows of the material
+         * response in each row of the residual stored row-major
+         * \param &material_response_jacobian_begin: The starting iterator of the material response Jacobian
+         * \param &material_response_jacobian_end: The stopping iterator of the material response Jacobian
+         * \param &interpolation_function: The value of the interpolation function \f$ \left( \phi \right) \f$
+         * \param &interpolation_function_gradient_begin: The starting iterator of the gradient of the interpolation
+         * function \f$ \left( \phi_{,i} \right) \f$
+         * \param &interpolation_function_gradient_end: The stopping iterator of the gradient of the interpolation
+         * function \f$ \left( \phi_{,i} \right) \f$
+         * \param &full_material_response_dof_gradient_begin: The starting iterator of the spatial gradient of all of
+         * the degrees of freedom used by the material response
+         * \param &full_material_response_dof_gradient_end: The stopping iterator of the spatial gradient of all of
+         * the degrees of freedom used by the material response
+         * \param &dUDotdU: The derivative of the time derivative of the spatial dof w.r.t. the spatial dof
+         * \param jacobian_begin: The starting iterator of the compressed Jacobian
+         * \param jacobian_end: The stopping iterator of the compressed Jacobian
+         * \param dRdUMesh_begin: The starting iterator of the Jacobian w.r.t. the mesh displacement
+         * \param dRdUMesh_end: The stopping iterator of the Jacobian w.r.t. the mesh displacement
+         */
+        template <class pattern, class material_response_pattern, int dim, int material_response_dim,
+                  unsigned int num_response_rows, class response_row_iter, class response_coefficient_iter,
+                  class material_response_jacobian_iter, typename interpolation_function_type,
+                  class interpolation_function_gradient_iter, class full_material_response_dof_gradient_iter,
+                  typename dUDotdU_type, class jacobian_iter, class dRdUMesh_iter>
+        void addMaterialResponseJacobian(
+            const unsigned int nphases, const unsigned int num_additional_dof, const unsigned int phase,
+            const std::array<unsigned int, num_field_blocks> &field_indices,
+            const response_row_iter &response_row_begin, const response_row_iter &response_row_end,
+            const response_coefficient_iter               &response_coefficient_begin,
+            const response_coefficient_iter               &response_coefficient_end,
+            const material_response_jacobian_iter         &material_response_jacobian_begin,
+            const material_response_jacobian_iter         &material_response_jacobian_end,
+            const interpolation_function_type             &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dUDotdU_type &dUDotdU, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end) {
+            using result_type = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * material_response_dim;
+
+            const unsigned int num_dof     = nphases * num_phase_dof + num_additional_dof;
+            const unsigned int num_columns = getNumColumns<pattern>(dim, nphases, num_additional_dof);
+            const unsigned int num_rows    = (unsigned int)(dRdUMesh_end - dRdUMesh_begin) / dim;
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_response_rows == (unsigned int)(response_row_end - response_row_begin),
+                                         "The response rows must have a size of num_response_rows")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                num_rows * num_response_rows == (unsigned int)(response_coefficient_end - response_coefficient_begin),
+                "The response coefficients must have a size of the number of rows times num_response_rows")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(num_rows * num_columns == (unsigned int)(jacobian_end - jacobian_begin),
+                                         "The Jacobian must have a size of the number of rows times the number of "
+                                         "compressed columns")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(
+                num_dof * material_response_dim ==
+                    (unsigned int)(full_material_response_dof_gradient_end - full_material_response_dof_gradient_begin),
+                "The full material response dof gradient is inconsistent with the number of phases")
+
+            std::array<result_type, num_response_rows> dResponsedDOF;
+            std::array<result_type, num_response_rows> dResponsedGradDOF;
+
+            unsigned int column = 0;
+
+            for (unsigned int f = 0; f < num_field_blocks; ++f) {
+                const unsigned int field = 1u << f;
+
+                if (!pattern::hasField(field)) {
+                    continue;
+                }
+
+                const bool         is_shared   = (field == ADDITIONAL_DOF);
+                const unsigned int width       = getFieldWidth(field, dim, num_additional_dof);
+                const bool         is_global   = !is_shared && pattern::isGlobal(field);
+                const unsigned int first_phase = is_global ? 0 : phase;
+                const unsigned int last_phase  = is_global ? nphases : phase + 1;
+
+                if (!material_response_pattern::hasField(field)) {
+                    column += (last_phase - first_phase) * width;
+
+                    continue;
+                }
+
+                const result_type scale = (field == VELOCITY) ? result_type(dUDotdU) : result_type(1);
+
+                for (unsigned int p = first_phase; p < last_phase; ++p) {
+                    if (!is_shared && !material_response_pattern::isGlobal(field) && (p != phase)) {
+                        column += width;
+
+                        continue;
+                    }
+
+                    for (unsigned int k = 0; k < width; ++k, ++column) {
+                        const unsigned int K = nphases * field_indices[f] + (is_shared ? 0 : width * p) + k;
+
+                        // Derivatives of the material response rows w.r.t. the dof and its spatial gradient
+                        for (unsigned int r = 0; r < num_response_rows; ++r) {
+                            const material_response_jacobian_iter row_begin =
+                                material_response_jacobian_begin +
+                                num_dof * (1 + material_response_dim) * (*(response_row_begin + r));
+
+                            dResponsedDOF[r]     = (*(row_begin + K)) * interpolation_function;
+                            dResponsedGradDOF[r] = result_type();
+
+                            for (unsigned int a = 0; a < material_response_dim; ++a) {
+                                dResponsedGradDOF[r] += (*(row_begin + num_dof + material_response_dim * K + a)) *
+                                                        (*(interpolation_function_gradient_begin + a));
+                            }
+                        }
+
+                        for (unsigned int i = 0; i < num_rows; ++i) {
+                            result_type value          = result_type();
+                            result_type gradient_value = result_type();
+
+                            for (unsigned int r = 0; r < num_response_rows; ++r) {
+                                const result_type coefficient =
+                                    *(response_coefficient_begin + num_response_rows * i + r);
+
+                                value += coefficient * (dResponsedDOF[r] + dResponsedGradDOF[r]);
+
+                                gradient_value += coefficient * dResponsedGradDOF[r];
+                            }
+
+                            *(jacobian_begin + num_columns * i + column) += value * scale;
+
+                            // mesh displacement
+                            for (unsigned int a = 0; a < dim; ++a) {
+                                *(dRdUMesh_begin + dim * i + a) -=
+                                    gradient_value *
+                                    (*(full_material_response_dof_gradient_begin + material_response_dim * K + a));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+    }  // namespace jacobianSparsity
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_krylov_solvers.cpp
+ ******************************************************************************
+ * The source file for the preconditioned Krylov solvers of the assembled
+ * balance equations
+ ******************************************************************************
+ */
+
+#include "tardigrade_krylov_solvers.h"
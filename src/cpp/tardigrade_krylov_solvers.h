@@ -0,0 +1,318 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_krylov_solvers.h
+ ******************************************************************************
+ * The header file for the preconditioned Krylov solvers of the assembled
+ * balance equations. The multiphase Jacobians are non-symmetric so the
+ * solvers are restarted GMRES and BiCGStab. The solvers only need the
+ * product of the operator with a vector so they work on the CSR and BSR
+ * Jacobians and on matrix-free operators. The preconditioners are point
+ * Jacobi, block Jacobi over the node blocks, and the incomplete LU
+ * factorization without fill (ILU(0)). The matrix-vector products, the
+ * vector operations, and the preconditioner applications may be distributed
+ * over a thread pool.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_KRYLOV_SOLVERS_H
+#define TARDIGRADE_KRYLOV_SOLVERS_H
+
+#include <vector>
+
+#include "tardigrade_block_sparse.h"
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+#include "tardigrade_thread_pool.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace krylovSolvers {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        typedef meshAssembly::floatType floatType;  //!< Define the float type to be the same as the mesh assembly
+
+        constexpr size_type row_grain_size = 256;  //!< The number of rows of each task of the threaded row loops
+
+        /*!
+         * The Krylov methods
+         */
+        enum KrylovMethod : unsigned int {
+            GMRES    = 0,  //!< Restarted GMRES with right preconditioning
+            BICGSTAB = 1   //!< BiCGStab with right preconditioning
+        };
+
+        /*!
+         * The options of the Krylov solvers. The solvers stop when the residual norm is less than the larger of the
+         * absolute tolerance and the relative tolerance times the norm of the right hand side.
+         */
+        struct KrylovOptions {
+            unsigned int max_iterations = 1000;  //!< The maximum number of operator applications
+
+            unsigned int restart = 30;  //!< The number of GMRES iterations between restarts
+
+            floatType relative_tolerance = 1e-8;  //!< The tolerance relative to the norm of the right hand side
+
+            floatType absolute_tolerance = 0;  //!< The absolute tolerance of the residual norm
+        };
+
+        /*!
+         * The result of a Krylov solve
+         */
+        struct KrylovStatistics {
+            bool converged = false;  //!< Flag indicating that the solve converged
+
+            unsigned int iterations = 0;  //!< The number of iterations
+
+            floatType initial_residual_norm = 0;  //!< The norm of the initial residual
+
+            floatType residual_norm = 0;  //!< The norm of the final residual
+        };
+
+        /*!
+         * A matrix as an operator whose product with a vector may be distributed over a thread pool
+         */
+        template <class matrix_type>
+        class MatrixOperator {
+           public:
+            /*!
+             * Constructor for the operator
+             *
+             * \param &matrix: The CSR or BSR matrix which must outlive the operator
+             * \param *pool: The thread pool used for the products. The product is serial if it is null
+             */
+            MatrixOperator(const matrix_type &matrix, threadPool::ThreadPool *pool = nullptr)
+                : _matrix(&matrix), _pool(pool) {}
+
+            //! Get the number of rows
+            size_type getNumRows() const { return _matrix->getNumRows(); }
+
+            template <class x_iter, class y_iter>
+            void multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin, y_iter y_end) const;
+
+           protected:
+            const matrix_type *_matrix;  //!< The matrix
+
+            threadPool::ThreadPool *_pool;  //!< The thread pool
+        };
+
+        /*!
+         * The identity preconditioner
+         */
+        class IdentityPreconditioner {
+           public:
+            /*!
+             * Compute the preconditioner which does nothing
+             */
+            template <class matrix_type>
+            void compute(const matrix_type &) {}
+
+            template <class r_iter, class z_iter>
+            void apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const;
+        };
+
+        /*!
+         * The point Jacobi preconditioner which applies the inverse of the diagonal
+         */
+        template <typename T>
+        class Jacobi {
+           public:
+            /*!
+             * Constructor for the preconditioner
+             *
+             * \param *pool: The thread pool used to apply the preconditioner. The application is serial if it is null
+             */
+            Jacobi(threadPool::ThreadPool *pool = nullptr) : _pool(pool), _inverse_diagonal() {}
+
+            //! Get the inverse of the diagonal
+            const std::vector<T> &getInverseDiagonal() const { return _inverse_diagonal; }
+
+            void compute(const meshAssembly::CSRMatrix<T> &matrix);
+
+            template <int block_size>
+            void compute(const blockSparse::BSRMatrix<T, block_size> &matrix);
+
+            template <class diagonal_iter>
+            void setDiagonal(const diagonal_iter &diagonal_begin, const diagonal_iter &diagonal_end);
+
+            template <class r_iter, class z_iter>
+            void apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const;
+
+           protected:
+            threadPool::ThreadPool *_pool;  //!< The thread pool
+
+            std::vector<T> _inverse_diagonal;  //!< The inverse of the diagonal
+        };
+
+        /*!
+         * The block Jacobi preconditioner which applies the inverses of the diagonal blocks e.g., the node blocks of
+         * the degrees of freedom
+         */
+        template <typename T>
+        class BlockJacobi {
+           public:
+            /*!
+             * Constructor for the preconditioner
+             *
+             * \param block_size: The size of the diagonal blocks of a CSR matrix e.g., the number of dof of a node.
+             *     The block size of a BSR matrix is used for BSR matrices.
+             * \param *pool: The thread pool used to apply the preconditioner. The application is serial if it is null
+             */
+            BlockJacobi(const size_type block_size = 1, threadPool::ThreadPool *pool = nullptr)
+                : _block_size(block_size), _pool(pool), _inverse_blocks() {}
+
+            //! Get the block size
+            size_type getBlockSize() const { return _block_size; }
+
+            //! Get the row-major inverses of the diagonal blocks
+            const std::vector<T> &getInverseBlocks() const { return _inverse_blocks; }
+
+            void compute(const meshAssembly::CSRMatrix<T> &matrix);
+
+            template <int block_size>
+            void compute(const blockSparse::BSRMatrix<T, block_size> &matrix);
+
+            template <class r_iter, class z_iter>
+            void apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const;
+
+           protected:
+            size_type _block_size;  //!< The size of the diagonal blocks
+
+            threadPool::ThreadPool *_pool;  //!< The thread pool
+
+            std::vector<T> _inverse_blocks;  //!< The row-major inverses of the diagonal blocks
+        };
+
+        /*!
+         * The incomplete LU factorization without fill (ILU(0)). The factors have the sparsity pattern of the matrix.
+         * The triangular solves are level scheduled so that the rows of a level may be solved concurrently.
+         */
+        template <typename T>
+        class ILU0 {
+           public:
+            /*!
+             * Constructor for the preconditioner
+             *
+             * \param *pool: The thread pool used to apply the preconditioner. The application is serial if it is null
+             */
+            ILU0(threadPool::ThreadPool *pool = nullptr) : _pool(pool) {}
+
+            //! Get the factors where the strictly lower part is L without its unit diagonal and the rest is U
+            const meshAssembly::CSRMatrix<T> &getFactors() const { return _factors; }
+
+            //! Get the number of levels of the forward substitution
+            size_type getNumLowerLevels() const { return (size_type)_lower_level_offsets.size() - 1; }
+
+            //! Get the number of levels of the backward substitution
+            size_type getNumUpperLevels() const { return (size_type)_upper_level_offsets.size() - 1; }
+
+            void compute(const meshAssembly::CSRMatrix<T> &matrix);
+
+            template <int block_size>
+            void compute(const blockSparse::BSRMatrix<T, block_size> &matrix);
+
+            template <class r_iter, class z_iter>
+            void apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const;
+
+           protected:
+            threadPool::ThreadPool *_pool;  //!< The thread pool
+
+            meshAssembly::CSRMatrix<T> _factors;  //!< The combined L and U factors
+
+            std::vector<size_type> _diagonal;  //!< The offset of the diagonal entry of each row
+
+            std::vector<size_type> _lower_level_offsets;  //!< The offsets of the levels of the forward substitution
+
+            std::vector<size_type> _lower_level_rows;  //!< The rows of each level of the forward substitution
+
+            std::vector<size_type> _upper_level_offsets;  //!< The offsets of the levels of the backward substitution
+
+            std::vector<size_type> _upper_level_rows;  //!< The rows of each level of the backward substitution
+        };
+
+        /*!
+         * A linear solver with the interface of the Newton solver which solves with a preconditioned Krylov method.
+         * The preconditioner is computed when the matrix is set and is reused for every solve with that matrix.
+         */
+        template <class matrix_type, class preconditioner_type>
+        class KrylovSolver {
+           public:
+            /*!
+             * Constructor for the solver
+             *
+             * \param method: The Krylov method
+             * \param &options: The options of the Krylov method
+             * \param &preconditioner: The preconditioner
+             * \param *pool: The thread pool used for the products and the vector operations
+             */
+            KrylovSolver(const KrylovMethod method = GMRES, const KrylovOptions &options = KrylovOptions(),
+                         const preconditioner_type &preconditioner = preconditioner_type(),
+                         threadPool::ThreadPool *pool = nullptr)
+                : _method(method),
+                  _options(options),
+                  _preconditioner(preconditioner),
+                  _pool(pool),
+                  _matrix(nullptr),
+                  _statistics() {}
+
+            //! Get the statistics of the last solve
+            const KrylovStatistics &getStatistics() const { return _statistics; }
+
+            //! Get the preconditioner
+            const preconditioner_type &getPreconditioner() const { return _preconditioner; }
+
+            void compute(const matrix_type &matrix);
+
+            template <class b_iter, class x_iter>
+            void solve(const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end);
+
+           protected:
+            KrylovMethod _method;  //!< The Krylov method
+
+            KrylovOptions _options;  //!< The options of the Krylov method
+
+            preconditioner_type _preconditioner;  //!< The preconditioner
+
+            threadPool::ThreadPool *_pool;  //!< The thread pool
+
+            const matrix_type *_matrix;  //!< The matrix of the last call to compute
+
+            KrylovStatistics _statistics;  //!< The statistics of the last solve
+        };
+
+        template <class row_function>
+        void forEachRow(const size_type num_rows, threadPool::ThreadPool *pool, row_function function);
+
+        template <typename T, class x_iter, class y_iter>
+        void multiply(const meshAssembly::CSRMatrix<T> &matrix, const x_iter &x_begin, const x_iter &x_end,
+                      y_iter y_begin, y_iter y_end, threadPool::ThreadPool &pool);
+
+        template <typename T, int block_size, class x_iter, class y_iter>
+        void multiply(const blockSparse::BSRMatrix<T, block_size> &matrix, const x_iter &x_begin, const x_iter &x_end,
+                      y_iter y_begin, y_iter y_end, threadPool::ThreadPool &pool);
+
+        template <typename T, int block_size>
+        meshAssembly::CSRMatrix<T> convertToCSR(const blockSparse::BSRMatrix<T, block_size> &matrix);
+
+        template <typename T>
+        T dot(const std::vector<T> &a, const std::vector<T> &b, threadPool::ThreadPool *pool = nullptr);
+
+        template <class operator_type, class preconditioner_type, class b_iter, class x_iter>
+        KrylovStatistics gmres(const operator_type &A, const preconditioner_type &preconditioner,
+                               const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end,
+                               const KrylovOptions &options = KrylovOptions(),
+                               threadPool::ThreadPool *pool = nullptr);
+
+        template <class operator_type, class preconditioner_type, class b_iter, class x_iter>
+        KrylovStatistics bicgstab(const operator_type &A, const preconditioner_type &preconditioner,
+                                  const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end,
+                                  const KrylovOptions &options = KrylovOptions(),
+                                  threadPool::ThreadPool *pool = nullptr);
+
+    }  // namespace krylovSolvers
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_krylov_solvers.tpp"
+
+#endif
@@ -0,0 +1,945 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_krylov_solvers.tpp
+ ******************************************************************************
+ * The template file for the preconditioned Krylov solvers of the assembled
+ * balance equations
+ ******************************************************************************
+ */
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+
+#include "tardigrade_krylov_solvers.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace krylovSolvers {
+
+        /*!
+         * Call a function for each row of a loop. The rows are distributed over the thread pool in tasks of
+         * row_grain_size rows if the pool is not null and there is more than one task. The function is called as
+         *
+         * function( row )
+         *
+         * \param num_rows: The number of rows
+         * \param *pool: The thread pool
+         * \param function: The function to call for each row
+         */
+        template <class row_function>
+        void forEachRow(const size_type num_rows, threadPool::ThreadPool *pool, row_function function) {
+            if ((pool == nullptr) || (num_rows <= row_grain_size)) {
+                for (size_type row = 0; row < num_rows; ++row) {
+                    function(row);
+                }
+
+                return;
+            }
+
+            pool->parallelFor(num_rows, row_grain_size,
+                              [&function](const unsigned int, const threadPool::size_type row) { function(row); });
+        }
+
+        /*!
+         * Compute the product of a CSR matrix and a vector \f$ y_i = A_{ij} x_j \f$ with the rows distributed over a
+         * thread pool
+         *
+         * \param &matrix: The matrix
+         * \param &x_begin: The starting iterator of the vector
+         * \param &x_end: The stopping iterator of the vector
+         * \param y_begin: The starting iterator of the product
+         * \param y_end: The stopping iterator of the product
+         * \param &pool: The thread pool
+         */
+        template <typename T, class x_iter, class y_iter>
+        void multiply(const meshAssembly::CSRMatrix<T> &matrix, const x_iter &x_begin, const x_iter &x_end,
+                      y_iter y_begin, y_iter y_end, threadPool::ThreadPool &pool) {
+            using y_type = typename std::iterator_traits<y_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == matrix.getNumColumns(),
+                                         "The vector must have a size equal to the number of columns")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(y_end - y_begin) == matrix.getNumRows(),
+                                         "The product must have a size equal to the number of rows")
+
+            const std::vector<size_type> &row_offsets    = matrix.getRowOffsets();
+            const std::vector<size_type> &column_indices = matrix.getColumnIndices();
+            const std::vector<T>         &values         = matrix.getValues();
+
+            forEachRow(matrix.getNumRows(), &pool, [&](const size_type row) {
+                y_type sum = y_type();
+
+                for (size_type k = row_offsets[row]; k < row_offsets[row + 1]; ++k) {
+                    sum += values[k] * (*(x_begin + column_indices[k]));
+                }
+
+                *(y_begin + row) = sum;
+            });
+        }
+
+        /*!
+         * Compute the product of a BSR matrix and a vector \f$ y_i = A_{ij} x_j \f$ with the block rows distributed
+         * over a thread pool
+         *
+         * \param &matrix: The matrix
+         * \param &x_begin: The starting iterator of the vector
+         * \param &x_end: The stopping iterator of the vector
+         * \param y_begin: The starting iterator of the product
+         * \param y_end: The stopping iterator of the product
+         * \param &pool: The thread pool
+         */
+        template <typename T, int block_size, class x_iter, class y_iter>
+        void multiply(const blockSparse::BSRMatrix<T, block_size> &matrix, const x_iter &x_begin, const x_iter &x_end,
+                      y_iter y_begin, y_iter y_end, threadPool::ThreadPool &pool) {
+            using y_type = typename std::iterator_traits<y_iter>::value_type;
+
+            constexpr size_type block_entries = blockSparse::BSRMatrix<T, block_size>::block_entries;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == matrix.getNumColumns(),
+                                         "The vector must have a size equal to the number of columns")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(y_end - y_begin) == matrix.getNumRows(),
+                                         "The product must have a size equal to the number of rows")
+
+            const std::vector<size_type> &row_offsets    = matrix.getRowOffsets();
+            const std::vector<size_type> &column_indices = matrix.getColumnIndices();
+            const std::vector<T>         &values         = matrix.getValues();
+
+            forEachRow(matrix.getNumBlockRows(), &pool, [&](const size_type row) {
+                std::array<y_type, block_size> sum;
+
+                std::fill(std::begin(sum), std::end(sum), y_type());
+
+                for (size_type k = row_offsets[row]; k < row_offsets[row + 1]; ++k) {
+                    auto block = std::cbegin(values) + block_entries * k;
+
+                    auto x = x_begin + block_size * column_indices[k];
+
+                    for (int i = 0; i < block_size; ++i) {
+                        for (int j = 0; j < block_size; ++j) {
+                            sum[i] += *(block + block_size * i + j) * (*(x + j));
+                        }
+                    }
+                }
+
+                std::copy(std::cbegin(sum), std::cend(sum), y_begin + block_size * row);
+            });
+        }
+
+        /*!
+         * Convert a BSR matrix to a CSR matrix with the same stored entries
+         *
+         * \param &matrix: The BSR matrix
+         */
+        template <typename T, int block_size>
+        meshAssembly::CSRMatrix<T> convertToCSR(const blockSparse::BSRMatrix<T, block_size> &matrix) {
+            constexpr size_type block_entries = blockSparse::BSRMatrix<T, block_size>::block_entries;
+
+            const std::vector<size_type> &block_row_offsets    = matrix.getRowOffsets();
+            const std::vector<size_type> &block_column_indices = matrix.getColumnIndices();
+            const std::vector<T>         &block_values         = matrix.getValues();
+
+            std::vector<size_type> row_offsets(matrix.getNumRows() + 1, 0);
+
+            std::vector<size_type> column_indices;
+
+            column_indices.reserve(matrix.getNumNonZeros());
+
+            std::vector<T> values;
+
+            values.reserve(matrix.getNumNonZeros());
+
+            for (size_type block_row = 0; block_row < matrix.getNumBlockRows(); ++block_row) {
+                for (int i = 0; i < block_size; ++i) {
+                    for (size_type k = block_row_offsets[block_row]; k < block_row_offsets[block_row + 1]; ++k) {
+                        for (int j = 0; j < block_size; ++j) {
+                            column_indices.push_back(block_size * block_column_indices[k] + j);
+
+                            values.push_back(block_values[block_entries * k + block_size * i + j]);
+                        }
+                    }
+
+                    row_offsets[block_size * block_row + i + 1] = (size_type)column_indices.size();
+                }
+            }
+
+            meshAssembly::CSRMatrix<T> csr(matrix.getNumRows(), matrix.getNumColumns(), std::cbegin(row_offsets),
+                                           std::cend(row_offsets), std::cbegin(column_indices),
+                                           std::cend(column_indices));
+
+            csr.getValues() = values;
+
+            return csr;
+        }
+
+        /*!
+         * Compute the dot product of two vectors. With a thread pool the partial sums are combined in a fixed order
+         * so that the result does not depend on the number of threads.
+         *
+         * \param &a: The first vector
+         * \param &b: The second vector
+         * \param *pool: The thread pool
+         */
+        template <typename T>
+        T dot(const std::vector<T> &a, const std::vector<T> &b, threadPool::ThreadPool *pool) {
+            if (pool == nullptr) {
+                T result = T();
+
+                for (size_type i = 0; i < a.size(); ++i) {
+                    result += a[i] * b[i];
+                }
+
+                return result;
+            }
+
+            return pool->parallelReduce(
+                a.size(), row_grain_size, T(),
+                [&](const unsigned int, const threadPool::size_type i, T &partial) { partial += a[i] * b[i]; },
+                [](T &result, const T &partial) { result += partial; });
+        }
+
+        /*!
+         * Compute the product of the matrix and a vector \f$ y_i = A_{ij} x_j \f$
+         *
+         * \param &x_begin: The starting iterator of the vector
+         * \param &x_end: The stopping iterator of the vector
+         * \param y_begin: The starting iterator of the product
+         * \param y_end: The stopping iterator of the product
+         */
+        template <class matrix_type>
+        template <class x_iter, class y_iter>
+        void MatrixOperator<matrix_type>::multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin,
+                                                   y_iter y_end) const {
+            if (_pool == nullptr) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(_matrix->multiply(x_begin, x_end, y_begin, y_end));
+            } else {
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    krylovSolvers::multiply(*_matrix, x_begin, x_end, y_begin, y_end, *_pool));
+            }
+        }
+
+        /*!
+         * Apply the identity \f$ z = r \f$
+         *
+         * \param &r_begin: The starting iterator of the vector to precondition
+         * \param &r_end: The stopping iterator of the vector to precondition
+         * \param z_begin: The starting iterator of the preconditioned vector
+         * \param z_end: The stopping iterator of the preconditioned vector
+         */
+        template <class r_iter, class z_iter>
+        void IdentityPreconditioner::apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin,
+                                           z_iter z_end) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK((r_end - r_begin) == (z_end - z_begin),
+                                         "The vectors must have the same size")
+
+            std::copy(r_begin, r_end, z_begin);
+        }
+
+        /*!
+         * Compute the inverse of the diagonal of a CSR matrix. An error is raised if a diagonal entry is missing or
+         * zero.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T>
+        void Jacobi<T>::compute(const meshAssembly::CSRMatrix<T> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumRows() == matrix.getNumColumns(), "The matrix must be square")
+
+            _inverse_diagonal.resize(matrix.getNumRows());
+
+            for (size_type row = 0; row < matrix.getNumRows(); ++row) {
+                size_type diagonal;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(diagonal = matrix.findEntry(row, row));
+
+                TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getValues()[diagonal] != T(),
+                                             "The diagonal entry of row " + std::to_string(row) + " is zero")
+
+                _inverse_diagonal[row] = T(1) / matrix.getValues()[diagonal];
+            }
+        }
+
+        /*!
+         * Compute the inverse of the diagonal of a BSR matrix. An error is raised if a diagonal entry is missing or
+         * zero.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T>
+        template <int block_size>
+        void Jacobi<T>::compute(const blockSparse::BSRMatrix<T, block_size> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumRows() == matrix.getNumColumns(), "The matrix must be square")
+
+            _inverse_diagonal.resize(matrix.getNumRows());
+
+            for (size_type block_row = 0; block_row < matrix.getNumBlockRows(); ++block_row) {
+                size_type diagonal;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(diagonal = matrix.findBlock(block_row, block_row));
+
+                for (int i = 0; i < block_size; ++i) {
+                    const T value =
+                        matrix.getValues()[blockSparse::BSRMatrix<T, block_size>::block_entries * diagonal +
+                                           (block_size + 1) * i];
+
+                    TARDIGRADE_ERROR_TOOLS_CHECK(value != T(), "The diagonal entry of row " +
+                                                                   std::to_string(block_size * block_row + i) +
+                                                                   " is zero")
+
+                    _inverse_diagonal[block_size * block_row + i] = T(1) / value;
+                }
+            }
+        }
+
+        /*!
+         * Set the diagonal of the operator directly e.g., from a matrix-free operator whose entries are not stored.
+         * An error is raised if a diagonal entry is zero.
+         *
+         * \param &diagonal_begin: The starting iterator of the diagonal
+         * \param &diagonal_end: The stopping iterator of the diagonal
+         */
+        template <typename T>
+        template <class diagonal_iter>
+        void Jacobi<T>::setDiagonal(const diagonal_iter &diagonal_begin, const diagonal_iter &diagonal_end) {
+            _inverse_diagonal.resize((size_type)(diagonal_end - diagonal_begin));
+
+            for (size_type row = 0; row < _inverse_diagonal.size(); ++row) {
+                const T value = *(diagonal_begin + row);
+
+                TARDIGRADE_ERROR_TOOLS_CHECK(value != T(), "The diagonal entry of row " + std::to_string(row) +
+                                                               " is zero")
+
+                _inverse_diagonal[row] = T(1) / value;
+            }
+        }
+
+        /*!
+         * Apply the preconditioner \f$ z_i = r_i / A_{ii} \f$
+         *
+         * \param &r_begin: The starting iterator of the vector to precondition
+         * \param &r_end: The stopping iterator of the vector to precondition
+         * \param z_begin: The starting iterator of the preconditioned vector
+         * \param z_end: The stopping iterator of the preconditioned vector
+         */
+        template <typename T>
+        template <class r_iter, class z_iter>
+        void Jacobi<T>::apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(r_end - r_begin) == _inverse_diagonal.size(),
+                                         "The vector must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(z_end - z_begin) == _inverse_diagonal.size(),
+                                         "The preconditioned vector must have a size equal to the number of rows")
+
+            forEachRow(_inverse_diagonal.size(), _pool,
+                       [&](const size_type row) { *(z_begin + row) = _inverse_diagonal[row] * (*(r_begin + row)); });
+        }
+
+        /*!
+         * Compute the inverses of the diagonal blocks of a CSR matrix. Entries of a block which are not stored are
+         * zero. An error is raised if a diagonal block is singular.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T>
+        void BlockJacobi<T>::compute(const meshAssembly::CSRMatrix<T> &matrix) {
+            using block_matrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumRows() == matrix.getNumColumns(), "The matrix must be square")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((_block_size > 0) && (matrix.getNumRows() % _block_size == 0),
+                                         "The number of rows must be a multiple of the block size")
+
+            const size_type num_blocks    = matrix.getNumRows() / _block_size;
+            const size_type block_entries = _block_size * _block_size;
+
+            const std::vector<size_type> &row_offsets    = matrix.getRowOffsets();
+            const std::vector<size_type> &column_indices = matrix.getColumnIndices();
+            const std::vector<T>         &values         = matrix.getValues();
+
+            _inverse_blocks.resize(block_entries * num_blocks);
+
+            forEachRow(num_blocks, _pool, [&](const size_type block) {
+                const size_type first = _block_size * block;
+
+                block_matrix A = block_matrix::Zero(_block_size, _block_size);
+
+                for (size_type i = 0; i < _block_size; ++i) {
+                    for (size_type k = row_offsets[first + i]; k < row_offsets[first + i + 1]; ++k) {
+                        if ((column_indices[k] >= first) && (column_indices[k] < first + _block_size)) {
+                            A(i, column_indices[k] - first) = values[k];
+                        }
+                    }
+                }
+
+                Eigen::FullPivLU<block_matrix> lu(A);
+
+                TARDIGRADE_ERROR_TOOLS_CHECK(lu.isInvertible(),
+                                             "The diagonal block " + std::to_string(block) + " is singular")
+
+                Eigen::Map<block_matrix>(_inverse_blocks.data() + block_entries * block, _block_size, _block_size) =
+                    lu.inverse();
+            });
+        }
+
+        /*!
+         * Compute the inverses of the diagonal blocks of a BSR matrix. The block size of the preconditioner is set
+         * to the block size of the matrix. An error is raised if a diagonal block is missing or singular.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T>
+        template <int block_size>
+        void BlockJacobi<T>::compute(const blockSparse::BSRMatrix<T, block_size> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumRows() == matrix.getNumColumns(), "The matrix must be square")
+
+            blockSparse::BlockJacobi<T, block_size> block_jacobi;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(block_jacobi.compute(matrix));
+
+            _block_size = block_size;
+
+            _inverse_blocks = block_jacobi.getInverseBlocks();
+        }
+
+        /*!
+         * Apply the preconditioner \f$ z_I = D_{II}^{-1} r_I \f$
+         *
+         * \param &r_begin: The starting iterator of the vector to precondition
+         * \param &r_end: The stopping iterator of the vector to precondition
+         * \param z_begin: The starting iterator of the preconditioned vector
+         * \param z_end: The stopping iterator of the preconditioned vector
+         */
+        template <typename T>
+        template <class r_iter, class z_iter>
+        void BlockJacobi<T>::apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const {
+            using z_type = typename std::iterator_traits<z_iter>::value_type;
+
+            const size_type block_entries = _block_size * _block_size;
+            const size_type num_blocks    = (size_type)_inverse_blocks.size() / block_entries;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(r_end - r_begin) == _block_size * num_blocks,
+                                         "The vector must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(z_end - z_begin) == _block_size * num_blocks,
+                                         "The preconditioned vector must have a size equal to the number of rows")
+
+            forEachRow(num_blocks, _pool, [&](const size_type block) {
+                auto inverse = std::cbegin(_inverse_blocks) + block_entries * block;
+
+                auto r = r_begin + _block_size * block;
+
+                for (size_type i = 0; i < _block_size; ++i) {
+                    z_type sum = z_type();
+
+                    for (size_type j = 0; j < _block_size; ++j) {
+                        sum += *(inverse + _block_size * i + j) * (*(r + j));
+                    }
+
+                    *(z_begin + _block_size * block + i) = sum;
+                }
+            });
+        }
+
+        /*!
+         * Compute the incomplete LU factorization of a CSR matrix and the levels of the triangular solves. The rows of
+         * a level of the forward (backward) substitution only depend on rows of earlier levels. An error is raised if
+         * a diagonal entry is missing or a pivot is zero.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T>
+        void ILU0<T>::compute(const meshAssembly::CSRMatrix<T> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumRows() == matrix.getNumColumns(), "The matrix must be square")
+
+            const size_type num_rows = matrix.getNumRows();
+            const size_type unset    = num_rows + 1;
+
+            _factors = matrix;
+
+            const std::vector<size_type> &row_offsets    = _factors.getRowOffsets();
+            const std::vector<size_type> &column_indices = _factors.getColumnIndices();
+            std::vector<T>               &values         = _factors.getValues();
+
+            _diagonal.resize(num_rows);
+
+            for (size_type row = 0; row < num_rows; ++row) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(_diagonal[row] = _factors.findEntry(row, row));
+            }
+
+            // The IKJ variant of Gaussian elimination restricted to the pattern of the matrix
+            std::vector<size_type> position(num_rows, unset);
+
+            for (size_type i = 0; i < num_rows; ++i) {
+                for (size_type p = row_offsets[i]; p < row_offsets[i + 1]; ++p) {
+                    position[column_indices[p]] = p;
+                }
+
+                for (size_type p = row_offsets[i]; p < _diagonal[i]; ++p) {
+                    const size_type k = column_indices[p];
+
+                    values[p] /= values[_diagonal[k]];
+
+                    for (size_type q = _diagonal[k] + 1; q < row_offsets[k + 1]; ++q) {
+                        if (position[column_indices[q]] != unset) {
+                            values[position[column_indices[q]]] -= values[p] * values[q];
+                        }
+                    }
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CHECK(values[_diagonal[i]] != T(),
+                                             "The pivot of row " + std::to_string(i) + " is zero")
+
+                for (size_type p = row_offsets[i]; p < row_offsets[i + 1]; ++p) {
+                    position[column_indices[p]] = unset;
+                }
+            }
+
+            // Group the rows into levels
+            auto bucket = [&](const std::vector<size_type> &levels, std::vector<size_type> &level_offsets,
+                              std::vector<size_type> &level_rows) {
+                const size_type num_levels =
+                    levels.empty() ? 0 : *std::max_element(std::cbegin(levels), std::cend(levels)) + 1;
+
+                level_offsets.assign(num_levels + 1, 0);
+
+                for (const auto level : levels) {
+                    ++level_offsets[level + 1];
+                }
+
+                for (size_type level = 0; level < num_levels; ++level) {
+                    level_offsets[level + 1] += level_offsets[level];
+                }
+
+                level_rows.resize(num_rows);
+
+                std::vector<size_type> next(std::cbegin(level_offsets), std::cend(level_offsets) - 1);
+
+                for (size_type row = 0; row < num_rows; ++row) {
+                    level_rows[next[levels[row]]++] = row;
+                }
+            };
+
+            std::vector<size_type> levels(num_rows, 0);
+
+            for (size_type i = 0; i < num_rows; ++i) {
+                for (size_type p = row_offsets[i]; p < _diagonal[i]; ++p) {
+                    levels[i] = std::max(levels[i], levels[column_indices[p]] + 1);
+                }
+            }
+
+            bucket(levels, _lower_level_offsets, _lower_level_rows);
+
+            std::fill(std::begin(levels), std::end(levels), 0);
+
+            for (size_type i = num_rows; i-- > 0;) {
+                for (size_type p = _diagonal[i] + 1; p < row_offsets[i + 1]; ++p) {
+                    levels[i] = std::max(levels[i], levels[column_indices[p]] + 1);
+                }
+            }
+
+            bucket(levels, _upper_level_offsets, _upper_level_rows);
+        }
+
+        /*!
+         * Compute the incomplete LU factorization of a BSR matrix. The factorization has the pattern of the scalar
+         * entries of the stored blocks.
+         *
+         * \param &matrix: The matrix to precondition
+         */
+        template <typename T>
+        template <int block_size>
+        void ILU0<T>::compute(const blockSparse::BSRMatrix<T, block_size> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CATCH(compute(convertToCSR(matrix)));
+        }
+
+        /*!
+         * Apply the preconditioner \f$ z = U^{-1} L^{-1} r \f$. The rows of each level are solved concurrently if the
+         * preconditioner has a thread pool.
+         *
+         * \param &r_begin: The starting iterator of the vector to precondition
+         * \param &r_end: The stopping iterator of the vector to precondition
+         * \param z_begin: The starting iterator of the preconditioned vector
+         * \param z_end: The stopping iterator of the preconditioned vector
+         */
+        template <typename T>
+        template <class r_iter, class z_iter>
+        void ILU0<T>::apply(const r_iter &r_begin, const r_iter &r_end, z_iter z_begin, z_iter z_end) const {
+            using z_type = typename std::iterator_traits<z_iter>::value_type;
+
+            const size_type num_rows = _factors.getNumRows();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(r_end - r_begin) == num_rows,
+                                         "The vector must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(z_end - z_begin) == num_rows,
+                                         "The preconditioned vector must have a size equal to the number of rows")
+
+            const std::vector<size_type> &row_offsets    = _factors.getRowOffsets();
+            const std::vector<size_type> &column_indices = _factors.getColumnIndices();
+            const std::vector<T>         &values         = _factors.getValues();
+
+            auto forward = [&](const size_type i) {
+                z_type sum = *(r_begin + i);
+
+                for (size_type p = row_offsets[i]; p < _diagonal[i]; ++p) {
+                    sum -= values[p] * (*(z_begin + column_indices[p]));
+                }
+
+                *(z_begin + i) = sum;
+            };
+
+            auto backward = [&](const size_type i) {
+                z_type sum = *(z_begin + i);
+
+                for (size_type p = _diagonal[i] + 1; p < row_offsets[i + 1]; ++p) {
+                    sum -= values[p] * (*(z_begin + column_indices[p]));
+                }
+
+                *(z_begin + i) = sum / values[_diagonal[i]];
+            };
+
+            if (_pool == nullptr) {
+                for (size_type i = 0; i < num_rows; ++i) {
+                    forward(i);
+                }
+
+                for (size_type i = num_rows; i-- > 0;) {
+                    backward(i);
+                }
+
+                return;
+            }
+
+            auto solveLevels = [&](const std::vector<size_type> &level_offsets,
+                                   const std::vector<size_type> &level_rows, auto &row_function) {
+                for (size_type level = 0; level + 1 < level_offsets.size(); ++level) {
+                    const size_type first = level_offsets[level];
+
+                    forEachRow(level_offsets[level + 1] - first, _pool,
+                               [&](const size_type k) { row_function(level_rows[first + k]); });
+                }
+            };
+
+            solveLevels(_lower_level_offsets, _lower_level_rows, forward);
+
+            solveLevels(_upper_level_offsets, _upper_level_rows, backward);
+        }
+
+        /*!
+         * Solve \f$ A x = b \f$ with restarted GMRES with right preconditioning. The preconditioned basis vectors are
+         * stored so that the preconditioner may change between iterations (flexible GMRES). The residual norm of the
+         * statistics is the norm of the true residual \f$ b - A x \f$.
+         *
+         * \param &A: The operator with getNumRows() and multiply( x_begin, x_end, y_begin, y_end )
+         * \param &preconditioner: The preconditioner with apply( r_begin, r_end, z_begin, z_end )
+         * \param &b_begin: The starting iterator of the right hand side
+         * \param &b_end: The stopping iterator of the right hand side
+         * \param x_begin: The starting iterator of the initial guess which is overwritten by the solution
+         * \param x_end: The stopping iterator of the initial guess which is overwritten by the solution
+         * \param &options: The options of the solver
+         * \param *pool: The thread pool used for the vector operations
+         */
+        template <class operator_type, class preconditioner_type, class b_iter, class x_iter>
+        KrylovStatistics gmres(const operator_type &A, const preconditioner_type &preconditioner,
+                               const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end,
+                               const KrylovOptions &options, threadPool::ThreadPool *pool) {
+            using T = typename std::iterator_traits<x_iter>::value_type;
+
+            const size_type n = A.getNumRows();
+            const size_type m = std::max(options.restart, 1u);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(b_end - b_begin) == n,
+                                         "The right hand side must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == n,
+                                         "The solution must have a size equal to the number of rows")
+
+            KrylovStatistics statistics;
+
+            std::vector<T> b(b_begin, b_end), x(x_begin, x_end), r(n), w(n);
+
+            std::vector<std::vector<T>> V(m + 1, std::vector<T>(n)), Z(m, std::vector<T>(n));
+
+            std::vector<T> H((m + 1) * m), cs(m), sn(m), g(m + 1), y(m);
+
+            auto residual = [&] {
+                TARDIGRADE_ERROR_TOOLS_CATCH(A.multiply(std::cbegin(x), std::cend(x), std::begin(r), std::end(r)));
+
+                forEachRow(n, pool, [&](const size_type i) { r[i] = b[i] - r[i]; });
+
+                return std::sqrt(dot(r, r, pool));
+            };
+
+            const T tolerance =
+                std::max(options.absolute_tolerance, options.relative_tolerance * std::sqrt(dot(b, b, pool)));
+
+            T beta = residual();
+
+            statistics.initial_residual_norm = beta;
+
+            statistics.residual_norm = beta;
+
+            while ((beta > tolerance) && (statistics.iterations < options.max_iterations)) {
+                forEachRow(n, pool, [&](const size_type i) { V[0][i] = r[i] / beta; });
+
+                std::fill(std::begin(g), std::end(g), T());
+
+                g[0] = beta;
+
+                size_type k = 0;
+
+                while (k < m) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(preconditioner.apply(std::cbegin(V[k]), std::cend(V[k]),
+                                                                      std::begin(Z[k]), std::end(Z[k])));
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        A.multiply(std::cbegin(Z[k]), std::cend(Z[k]), std::begin(w), std::end(w)));
+
+                    ++statistics.iterations;
+
+                    // Modified Gram-Schmidt
+                    for (size_type i = 0; i <= k; ++i) {
+                        const T h = dot(w, V[i], pool);
+
+                        H[m * i + k] = h;
+
+                        forEachRow(n, pool, [&](const size_type j) { w[j] -= h * V[i][j]; });
+                    }
+
+                    const T h_next = std::sqrt(dot(w, w, pool));
+
+                    if (h_next != T()) {
+                        forEachRow(n, pool, [&](const size_type j) { V[k + 1][j] = w[j] / h_next; });
+                    }
+
+                    // Apply the previous Givens rotations to the new column and eliminate the subdiagonal
+                    for (size_type i = 0; i < k; ++i) {
+                        const T upper = H[m * i + k];
+                        const T lower = H[m * (i + 1) + k];
+
+                        H[m * i + k]       = cs[i] * upper + sn[i] * lower;
+                        H[m * (i + 1) + k] = -sn[i] * upper + cs[i] * lower;
+                    }
+
+                    const T denominator = std::sqrt(H[m * k + k] * H[m * k + k] + h_next * h_next);
+
+                    TARDIGRADE_ERROR_TOOLS_CHECK(denominator != T(),
+                                                 "GMRES broke down with a singular Hessenberg matrix")
+
+                    cs[k] = H[m * k + k] / denominator;
+
+                    sn[k] = h_next / denominator;
+
+                    H[m * k + k] = denominator;
+
+                    g[k + 1] = -sn[k] * g[k];
+
+                    g[k] = cs[k] * g[k];
+
+                    ++k;
+
+                    if ((std::abs(g[k]) <= tolerance) || (h_next == T()) ||
+                        (statistics.iterations >= options.max_iterations)) {
+                        break;
+                    }
+                }
+
+                // Solve the upper triangular least squares system and update the solution
+                for (size_type i = k; i-- > 0;) {
+                    y[i] = g[i];
+
+                    for (size_type j = i + 1; j < k; ++j) {
+                        y[i] -= H[m * i + j] * y[j];
+                    }
+
+                    y[i] /= H[m * i + i];
+                }
+
+                forEachRow(n, pool, [&](const size_type j) {
+                    for (size_type i = 0; i < k; ++i) {
+                        x[j] += y[i] * Z[i][j];
+                    }
+                });
+
+                beta = residual();
+
+                statistics.residual_norm = beta;
+            }
+
+            statistics.converged = beta <= tolerance;
+
+            std::copy(std::cbegin(x), std::cend(x), x_begin);
+
+            return statistics;
+        }
+
+        /*!
+         * Solve \f$ A x = b \f$ with BiCGStab with right preconditioning
+         *
+         * \param &A: The operator with getNumRows() and multiply( x_begin, x_end, y_begin, y_end )
+         * \param &preconditioner: The preconditioner with apply( r_begin, r_end, z_begin, z_end )
+         * \param &b_begin: The starting iterator of the right hand side
+         * \param &b_end: The stopping iterator of the right hand side
+         * \param x_begin: The starting iterator of the initial guess which is overwritten by the solution
+         * \param x_end: The stopping iterator of the initial guess which is overwritten by the solution
+         * \param &options: The options of the solver
+         * \param *pool: The thread pool used for the vector operations
+         */
+        template <class operator_type, class preconditioner_type, class b_iter, class x_iter>
+        KrylovStatistics bicgstab(const operator_type &A, const preconditioner_type &preconditioner,
+                                  const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end,
+                                  const KrylovOptions &options, threadPool::ThreadPool *pool) {
+            using T = typename std::iterator_traits<x_iter>::value_type;
+
+            const size_type n = A.getNumRows();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(b_end - b_begin) == n,
+                                         "The right hand side must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == n,
+                                         "The solution must have a size equal to the number of rows")
+
+            KrylovStatistics statistics;
+
+            std::vector<T> b(b_begin, b_end), x(x_begin, x_end), r(n), r_hat(n), p(n, T()), v(n, T()), p_hat(n),
+                s(n), s_hat(n), t(n);
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(A.multiply(std::cbegin(x), std::cend(x), std::begin(r), std::end(r)));
+
+            forEachRow(n, pool, [&](const size_type i) { r[i] = b[i] - r[i]; });
+
+            r_hat = r;
+
+            const T tolerance =
+                std::max(options.absolute_tolerance, options.relative_tolerance * std::sqrt(dot(b, b, pool)));
+
+            T r_norm = std::sqrt(dot(r, r, pool));
+
+            statistics.initial_residual_norm = r_norm;
+
+            T rho = 1, alpha = 1, omega = 1;
+
+            while ((r_norm > tolerance) && (statistics.iterations < options.max_iterations)) {
+                const T rho_next = dot(r_hat, r, pool);
+
+                if (rho_next == T()) {
+                    break;
+                }
+
+                const T beta = (rho_next / rho) * (alpha / omega);
+
+                forEachRow(n, pool, [&](const size_type i) { p[i] = r[i] + beta * (p[i] - omega * v[i]); });
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    preconditioner.apply(std::cbegin(p), std::cend(p), std::begin(p_hat), std::end(p_hat)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    A.multiply(std::cbegin(p_hat), std::cend(p_hat), std::begin(v), std::end(v)));
+
+                ++statistics.iterations;
+
+                const T r_hat_v = dot(r_hat, v, pool);
+
+                if (r_hat_v == T()) {
+                    break;
+                }
+
+                alpha = rho_next / r_hat_v;
+
+                forEachRow(n, pool, [&](const size_type i) { s[i] = r[i] - alpha * v[i]; });
+
+                const T s_norm = std::sqrt(dot(s, s, pool));
+
+                if (s_norm <= tolerance) {
+                    forEachRow(n, pool, [&](const size_type i) { x[i] += alpha * p_hat[i]; });
+
+                    r.swap(s);
+
+                    r_norm = s_norm;
+
+                    break;
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    preconditioner.apply(std::cbegin(s), std::cend(s), std::begin(s_hat), std::end(s_hat)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    A.multiply(std::cbegin(s_hat), std::cend(s_hat), std::begin(t), std::end(t)));
+
+                const T t_t = dot(t, t, pool);
+
+                omega = (t_t == T()) ? T() : dot(t, s, pool) / t_t;
+
+                forEachRow(n, pool, [&](const size_type i) {
+                    x[i] += alpha * p_hat[i] + omega * s_hat[i];
+
+                    r[i] = s[i] - omega * t[i];
+                });
+
+                r_norm = std::sqrt(dot(r, r, pool));
+
+                rho = rho_next;
+
+                if (omega == T()) {
+                    break;
+                }
+            }
+
+            statistics.residual_norm = r_norm;
+
+            statistics.converged = r_norm <= tolerance;
+
+            std::copy(std::cbegin(x), std::cend(x), x_begin);
+
+            return statistics;
+        }
+
+        /*!
+         * Set the matrix of the linear systems and compute the preconditioner. The matrix must outlive the solves.
+         *
+         * \param &matrix: The matrix
+         */
+        template <class matrix_type, class preconditioner_type>
+        void KrylovSolver<matrix_type, preconditioner_type>::compute(const matrix_type &matrix) {
+            _matrix = &matrix;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(_preconditioner.compute(matrix));
+        }
+
+        /*!
+         * Solve \f$ A x = b \f$ from a zero initial guess. The statistics of the solve are available from
+         * getStatistics. A solve which does not converge returns the last iterate so that an inexact Newton method
+         * may still use it.
+         *
+         * \param &b_begin: The starting iterator of the right hand side
+         * \param &b_end: The stopping iterator of the right hand side
+         * \param x_begin: The starting iterator of the solution
+         * \param x_end: The stopping iterator of the solution
+         */
+        template <class matrix_type, class preconditioner_type>
+        template <class b_iter, class x_iter>
+        void KrylovSolver<matrix_type, preconditioner_type>::solve(const b_iter &b_begin, const b_iter &b_end,
+                                                                   x_iter x_begin, x_iter x_end) {
+            using x_type = typename std::iterator_traits<x_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(_matrix != nullptr, "The matrix must be set before solving")
+
+            std::fill(x_begin, x_end, x_type());
+
+            MatrixOperator<matrix_type> A(*_matrix, _pool);
+
+            if (_method == GMRES) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    _statistics = gmres(A, _preconditioner, b_begin, b_end, x_begin, x_end, _options, _pool));
+            } else {
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    _statistics = bicgstab(A, _preconditioner, b_begin, b_end, x_begin, x_end, _options, _pool));
+            }
+        }
+
+    }  // namespace krylovSolvers
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_material_provider.cpp
+ ******************************************************************************
+ * The source file for the batched evaluation of the material response
+ ******************************************************************************
+ */
+
+#include "tardigrade_material_provider.h"
@@ -0,0 +1,371 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_material_provider.h
+ ******************************************************************************
+ * The header file for the batched evaluation of the material response. The
+ * kernels of the balance equations consume a material response and its
+ * Jacobian at each integration point. A material provider computes them for
+ * a whole batch of points at once from structure of arrays inputs to
+ * structure of arrays outputs i.e., the values of one component of every
+ * point of the batch are contiguous, so that the provider may vectorize and
+ * thread over the points internally. The assembly loop interpolates the
+ * point dof vectors of a block of elements, evaluates the provider once for
+ * the block, and then integrates the elements with a material model which
+ * reads the responses of the block.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_MATERIAL_PROVIDER_H
+#define TARDIGRADE_MATERIAL_PROVIDER_H
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "tardigrade_FiniteElementBase.h"
+#include "tardigrade_error_policy.h"
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace materialProvider {
+
+        typedef std::size_t size_type;  //!< The type of the indices of the points and components
+
+        /*!
+         * A non-owning view of the values of a batch of points stored as a structure of arrays. The value of
+         * component c of point p is located at data[ stride * c + p ] so that the values of one component of all of
+         * the points are contiguous. The stride may be larger than the number of points so that a view of a subset of
+         * the points of a larger array may be formed.
+         */
+        template <typename T>
+        class PointArray {
+           public:
+            /*!
+             * Default constructor for an empty view
+             */
+            PointArray() : _data(nullptr), _num_components(0), _num_points(0), _stride(0) {}
+
+            /*!
+             * Constructor for a view of an array
+             *
+             * \param *data: The first value of the array
+             * \param num_components: The number of components of each point
+             * \param num_points: The number of points
+             * \param stride: The distance between the first values of consecutive components
+             */
+            PointArray(T *data, const size_type num_components, const size_type num_points, const size_type stride)
+                : _data(data), _num_components(num_components), _num_points(num_points), _stride(stride) {}
+
+            /*!
+             * Constructor for a view of an array whose stride is the number of points
+             *
+             * \param *data: The first value of the array
+             * \param num_components: The number of components of each point
+             * \param num_points: The number of points
+             */
+            PointArray(T *data, const size_type num_components, const size_type num_points)
+                : PointArray(data, num_components, num_points, num_points) {}
+
+            /*!
+             * Constructor for a read only view of a writeable view
+             *
+             * \param &other: The writeable view
+             */
+            template <typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+            PointArray(const PointArray<U> &other)
+                : PointArray(other.data(), other.getNumComponents(), other.getNumPoints(), other.getStride()) {}
+
+            //! Get the first value
+            T *data() const { return _data; }
+
+            //! Get the number of components of each point
+            size_type getNumComponents() const { return _num_components; }
+
+            //! Get the number of points
+            size_type getNumPoints() const { return _num_points; }
+
+            //! Get the distance between the first values of consecutive components
+            size_type getStride() const { return _stride; }
+
+            /*!
+             * Get the first value of a component
+             *
+             * \param c: The component
+             */
+            T *component(const size_type c) const { return _data + _stride * c; }
+
+            /*!
+             * Get the value of a component of a point
+             *
+             * \param c: The component
+             * \param p: The point
+             */
+            T &operator()(const size_type c, const size_type p) const { return _data[_stride * c + p]; }
+
+            /*!
+             * Get the view of a contiguous subset of the points
+             *
+             * \param first_point: The first point of the subset
+             * \param num_points: The number of points of the subset
+             */
+            PointArray block(const size_type first_point, const size_type num_points) const {
+                return PointArray(_data + first_point, _num_components, num_points, _stride);
+            }
+
+           protected:
+            T *_data;  //!< The first value
+
+            size_type _num_components;  //!< The number of components of each point
+
+            size_type _num_points;  //!< The number of points
+
+            size_type _stride;  //!< The distance between the first values of consecutive components
+        };
+
+        /*!
+         * The interface of a material which computes the material response and its Jacobian for a batch of points.
+         * The inputs are the point dof vectors i.e., the interpolated degrees of freedom followed by their spatial
+         * gradients, and the outputs are the phase-major material responses and the row-major derivatives of the
+         * material responses w.r.t. the point dof vectors. Component point_dof_size * i + j of the Jacobian is the
+         * derivative of component i of the response w.r.t. component j of the point dof vector.
+         *
+         * The index of the first point of a batch is passed to the provider so that providers with history variables
+         * may locate the values of the points of the batch.
+         */
+        template <typename T>
+        class BatchedMaterialProvider {
+           public:
+            virtual ~BatchedMaterialProvider() {}
+
+            //! Get the size of the point dof vector of a point
+            virtual size_type getPointDofSize() const = 0;
+
+            //! Get the size of the material response of a point
+            virtual size_type getResponseSize() const = 0;
+
+            //! Get the size of the material response Jacobian of a point
+            size_type getJacobianSize() const { return getResponseSize() * getPointDofSize(); }
+
+            void evaluate(const size_type first_point, const PointArray<const T> &point_dof,
+                          const PointArray<T> &response);
+
+            void evaluate(const size_type first_point, const PointArray<const T> &point_dof,
+                          const PointArray<T> &response, const PointArray<T> &jacobian);
+
+           protected:
+            /*!
+             * Compute the material responses of a batch of points. The sizes of the arrays have been checked.
+             *
+             * \param first_point: The index of the first point of the batch
+             * \param &point_dof: The point dof vectors
+             * \param &response: The material responses
+             */
+            virtual void computeResponse(const size_type first_point, const PointArray<const T> &point_dof,
+                                         const PointArray<T> &response) = 0;
+
+            /*!
+             * Compute the material responses and their Jacobians of a batch of points. The sizes of the arrays have
+             * been checked.
+             *
+             * \param first_point: The index of the first point of the batch
+             * \param &point_dof: The point dof vectors
+             * \param &response: The material responses
+             * \param &jacobian: The material response Jacobians
+             */
+            virtual void computeResponseAndJacobian(const size_type first_point, const PointArray<const T> &point_dof,
+                                                    const PointArray<T> &response, const PointArray<T> &jacobian) = 0;
+        };
+
+        /*!
+         * A batched material provider which calls a material model of the element kernels for each of the points
+         * of a batch i.e.,
+         *
+         * model( qp, point_dof_begin, point_dof_end, response_begin, response_end )
+         * model( qp, point_dof_begin, point_dof_end, response_begin, response_end, jacobian_begin, jacobian_end )
+         *
+         * The points are assumed to be ordered by element so that the integration point of point n is
+         * n % points_per_element.
+         */
+        template <typename T, class material_model>
+        class PointwiseMaterialProvider : public BatchedMaterialProvider<T> {
+           public:
+            PointwiseMaterialProvider(material_model &model, const size_type point_dof_size,
+                                      const size_type response_size, const size_type points_per_element);
+
+            //! Get the size of the point dof vector of a point
+            virtual size_type getPointDofSize() const override { return _point_dof_size; }
+
+            //! Get the size of the material response of a point
+            virtual size_type getResponseSize() const override { return _response_size; }
+
+           protected:
+            virtual void computeResponse(const size_type first_point, const PointArray<const T> &point_dof,
+                                         const PointArray<T> &response) override;
+
+            virtual void computeResponseAndJacobian(const size_type first_point, const PointArray<const T> &point_dof,
+                                                    const PointArray<T> &response,
+                                                    const PointArray<T> &jacobian) override;
+
+            material_model *_model;  //!< The material model
+
+            size_type _point_dof_size;  //!< The size of the point dof vector of a point
+
+            size_type _response_size;  //!< The size of the material response of a point
+
+            size_type _points_per_element;  //!< The number of integration points of an element
+
+            std::vector<T> _point_dof;  //!< The point dof vector of the current point
+
+            std::vector<T> _response;  //!< The material response of the current point
+
+            std::vector<T> _jacobian;  //!< The material response Jacobian of the current point
+        };
+
+        /*!
+         * Storage of the point dof vectors, material responses, and material response Jacobians of the integration
+         * points of a block of elements as structures of arrays. The point dof vectors of the elements are set, the
+         * block is evaluated by a material provider with one call, and the responses are read back by the element
+         * kernels through a BlockMaterialModel. The elements of the block are indexed from zero.
+         */
+        template <typename T>
+        class MaterialResponseBlock {
+           public:
+            MaterialResponseBlock(const size_type max_elements, const size_type points_per_element,
+                                  const size_type point_dof_size, const size_type response_size);
+
+            //! Get the largest number of elements of the block
+            size_type getMaxElements() const { return _max_elements; }
+
+            //! Get the number of integration points of an element
+            size_type getPointsPerElement() const { return _points_per_element; }
+
+            //! Get the size of the point dof vector of a point
+            size_type getPointDofSize() const { return _point_dof_size; }
+
+            //! Get the size of the material response of a point
+            size_type getResponseSize() const { return _response_size; }
+
+            //! Get the size of the material response Jacobian of a point
+            size_type getJacobianSize() const { return _response_size * _point_dof_size; }
+
+            //! Get the number of points of the block
+            size_type getNumPoints() const { return _max_elements * _points_per_element; }
+
+            //! Get the point dof vectors of all of the points of the block
+            PointArray<T> getPointDof() { return PointArray<T>(_point_dof.data(), _point_dof_size, getNumPoints()); }
+
+            //! Get the material responses of all of the points of the block
+            PointArray<T> getResponse() { return PointArray<T>(_response.data(), _response_size, getNumPoints()); }
+
+            //! Get the material response Jacobians of all of the points of the block
+            PointArray<T> getJacobian() {
+                return PointArray<T>(_jacobian.data(), _jacobian.empty() ? 0 : getJacobianSize(), getNumPoints());
+            }
+
+            template <class dof_iter>
+            void setPointDof(const size_type element, const size_type qp, const dof_iter &point_dof_begin,
+                             const dof_iter &point_dof_end);
+
+            void evaluate(BatchedMaterialProvider<T> &provider, const size_type first_element,
+                          const size_type num_elements, const bool compute_jacobian);
+
+            template <class response_iter>
+            void getResponse(const size_type element, const size_type qp, response_iter response_begin,
+                             response_iter response_end) const;
+
+            template <class jacobian_iter>
+            void getJacobian(const size_type element, const size_type qp, jacobian_iter jacobian_begin,
+                             jacobian_iter jacobian_end) const;
+
+           protected:
+            size_type _max_elements;  //!< The largest number of elements of the block
+
+            size_type _points_per_element;  //!< The number of integration points of an element
+
+            size_type _point_dof_size;  //!< The size of the point dof vector of a point
+
+            size_type _response_size;  //!< The size of the material response of a point
+
+            std::vector<T> _point_dof;  //!< The point dof vectors
+
+            std::vector<T> _response;  //!< The material responses
+
+            std::vector<T> _jacobian;  //!< The material response Jacobians which are allocated when first computed
+        };
+
+        /*!
+         * A material model for one element of a block which reads the material response and its Jacobian from the
+         * block. The model has the interface of the material models of the element kernels so it may be passed to
+         * e.g., computeElementBalanceOfLinearMomentum. The point dof vectors passed to the model are ignored since
+         * the block was evaluated at the point dof vectors set by interpolatePointDof.
+         */
+        template <typename T>
+        class BlockMaterialModel {
+           public:
+            /*!
+             * Constructor for the block model
+             *
+             * \param &block: The evaluated block
+             * \param element: The element of the block the model is called for
+             */
+            BlockMaterialModel(const MaterialResponseBlock<T> &block, const size_type element)
+                : _block(&block), _element(element) {}
+
+            /*!
+             * Get the material response from the block
+             *
+             * \param qp: The integration point
+             * \param &point_dof_begin: The starting iterator of the point dof vector
+             * \param &point_dof_end: The stopping iterator of the point dof vector
+             * \param response_begin: The starting iterator of the material response
+             * \param response_end: The stopping iterator of the material response
+             */
+            template <class dof_iter, class response_iter>
+            void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                            response_iter response_begin, response_iter response_end) {
+                _block->getResponse(_element, qp, response_begin, response_end);
+            }
+
+            /*!
+             * Get the material response and its Jacobian from the block
+             *
+             * \param qp: The integration point
+             * \param &point_dof_begin: The starting iterator of the point dof vector
+             * \param &point_dof_end: The stopping iterator of the point dof vector
+             * \param response_begin: The starting iterator of the material response
+             * \param response_end: The stopping iterator of the material response
+             * \param jacobian_begin: The starting iterator of the material response Jacobian
+             * \param jacobian_end: The stopping iterator of the material response Jacobian
+             */
+            template <class dof_iter, class response_iter, class jacobian_iter>
+            void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                            response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                            jacobian_iter jacobian_end) {
+                _block->getResponse(_element, qp, response_begin, response_end);
+
+                _block->getJacobian(_element, qp, jacobian_begin, jacobian_end);
+            }
+
+           protected:
+            const MaterialResponseBlock<T> *_block;  //!< The evaluated block
+
+            size_type _element;  //!< The element of the block the model is called for
+        };
+
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_iter,
+                  class dof_dot_iter, typename T>
+        void interpolatePointDof(finiteElement::FiniteElementBase<element_configuration> &element,
+                                 const typename element_configuration::node_in &node_positions_begin,
+                                 const typename element_configuration::node_in &node_positions_end,
+                                 const dof_iter &dof_begin, const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin,
+                                 const dof_dot_iter &dof_dot_end, MaterialResponseBlock<T> &block,
+                                 const size_type block_element);
+
+    }  // namespace materialProvider
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_material_provider.tpp"
+
+#endif
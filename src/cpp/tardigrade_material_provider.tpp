@@ -0,0 +1,400 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_material_provider.tpp
+ ******************************************************************************
+ * The template file for the batched evaluation of the material response
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <array>
+
+#include "tardigrade_material_provider.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace materialProvider {
+
+        /*!
+         * Compute the material responses of a batch of points
+         *
+         * \param first_point: The index of the first point of the batch
+         * \param &point_dof: The point dof vectors
+         * \param &response: The material responses
+         */
+        template <typename T>
+        void BatchedMaterialProvider<T>::evaluate(const size_type first_point, const PointArray<const T> &point_dof,
+                                                  const PointArray<T> &response) {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(point_dof.getNumComponents() == getPointDofSize(),
+                                               "The point dof vectors have ", point_dof.getNumComponents(),
+                                               " components but the provider requires ", getPointDofSize())
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(response.getNumComponents() == getResponseSize(),
+                                               "The material responses have ", response.getNumComponents(),
+                                               " components but the provider computes ", getResponseSize())
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(response.getNumPoints() == point_dof.getNumPoints(),
+                                               "The material responses have ", response.getNumPoints(),
+                                               " points but the point dof vectors have ", point_dof.getNumPoints())
+
+            computeResponse(first_point, point_dof, response);
+        }
+
+        /*!
+         * Compute the material responses and their Jacobians of a batch of points
+         *
+         * \param first_point: The index of the first point of the batch
+         * \param &point_dof: The point dof vectors
+         * \param &response: The material responses
+         * \param &jacobian: The material response Jacobians
+         */
+        template <typename T>
+        void BatchedMaterialProvider<T>::evaluate(const size_type first_point, const PointArray<const T> &point_dof,
+                                                  const PointArray<T> &response, const PointArray<T> &jacobian) {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(point_dof.getNumComponents() == getPointDofSize(),
+                                               "The point dof vectors have ", point_dof.getNumComponents(),
+                                               " components but the provider requires ", getPointDofSize())
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(response.getNumComponents() == getResponseSize(),
+                                               "The material responses have ", response.getNumComponents(),
+                                               " components but the provider computes ", getResponseSize())
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(jacobian.getNumComponents() == getJacobianSize(),
+                                               "The material response Jacobians have ", jacobian.getNumComponents(),
+                                               " components but the provider computes ", getJacobianSize())
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK((response.getNumPoints() == point_dof.getNumPoints()) &&
+                                                   (jacobian.getNumPoints() == point_dof.getNumPoints()),
+                                               "The material responses and Jacobians must have the same number of "
+                                               "points as the point dof vectors ( ",
+                                               point_dof.getNumPoints(), " )")
+
+            computeResponseAndJacobian(first_point, point_dof, response, jacobian);
+        }
+
+        /*!
+         * Constructor for a batched provider which calls a material model for each point
+         *
+         * \param &model: The material model
+         * \param point_dof_size: The size of the point dof vector of a point
+         * \param response_size: The size of the material response of a point
+         * \param points_per_element: The number of integration points of an element
+         */
+        template <typename T, class material_model>
+        PointwiseMaterialProvider<T, material_model>::PointwiseMaterialProvider(material_model &model,
+                                                                                const size_type point_dof_size,
+                                                                                const size_type response_size,
+                                                                                const size_type points_per_element)
+            : _model(&model),
+              _point_dof_size(point_dof_size),
+              _response_size(response_size),
+              _points_per_element(points_per_element),
+              _point_dof(point_dof_size),
+              _response(response_size),
+              _jacobian() {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(points_per_element > 0,
+                                               "An element must have at least one integration point")
+        }
+
+        /*!
+         * Compute the material responses of a batch of points by calling the material model for each point
+         *
+         * \param first_point: The index of the first point of the batch
+         * \param &point_dof: The point dof vectors
+         * \param &response: The material responses
+         */
+        template <typename T, class material_model>
+        void PointwiseMaterialProvider<T, material_model>::computeResponse(const size_type           first_point,
+                                                                           const PointArray<const T> &point_dof,
+                                                                           const PointArray<T>       &response) {
+            for (size_type p = 0; p < point_dof.getNumPoints(); ++p) {
+                for (size_type c = 0; c < _point_dof_size; ++c) {
+                    _point_dof[c] = point_dof(c, p);
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (*_model)((unsigned int)((first_point + p) % _points_per_element), std::cbegin(_point_dof),
+                              std::cend(_point_dof), std::begin(_response), std::end(_response)));
+
+                for (size_type c = 0; c < _response_size; ++c) {
+                    response(c, p) = _response[c];
+                }
+            }
+        }
+
+        /*!
+         * Compute the material responses and their Jacobians of a batch of points by calling the material model for
+         * each point
+         *
+         * \param first_point: The index of the first point of the batch
+         * \param &point_dof: The point dof vectors
+         * \param &response: The material responses
+         * \param &jacobian: The material response Jacobians
+         */
+        template <typename T, class material_model>
+        void PointwiseMaterialProvider<T, material_model>::computeResponseAndJacobian(
+            const size_type first_point, const PointArray<const T> &point_dof, const PointArray<T> &response,
+            const PointArray<T> &jacobian) {
+            _jacobian.resize(_response_size * _point_dof_size);
+
+            for (size_type p = 0; p < point_dof.getNumPoints(); ++p) {
+                for (size_type c = 0; c < _point_dof_size; ++c) {
+                    _point_dof[c] = point_dof(c, p);
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((*_model)((unsigned int)((first_point + p) % _points_per_element),
+                                                       std::cbegin(_point_dof), std::cend(_point_dof),
+                                                       std::begin(_response), std::end(_response),
+                                                       std::begin(_jacobian), std::end(_jacobian)));
+
+                for (size_type c = 0; c < _response_size; ++c) {
+                    response(c, p) = _response[c];
+                }
+
+                for (size_type c = 0; c < _jacobian.size(); ++c) {
+                    jacobian(c, p) = _jacobian[c];
+                }
+            }
+        }
+
+        /*!
+         * Constructor for the storage of a block of elements. The material response Jacobians are allocated the
+         * first time the block is evaluated with them.
+         *
+         * \param max_elements: The largest number of elements of the block
+         * \param points_per_element: The number of integration points of an element
+         * \param point_dof_size: The size of the point dof vector of a point
+         * \param response_size: The size of the material response of a point
+         */
+        template <typename T>
+        MaterialResponseBlock<T>::MaterialResponseBlock(const size_type max_elements,
+                                                        const size_type points_per_element,
+                                                        const size_type point_dof_size, const size_type response_size)
+            : _max_elements(max_elements),
+              _points_per_element(points_per_element),
+              _point_dof_size(point_dof_size),
+              _response_size(response_size),
+              _point_dof(max_elements * points_per_element * point_dof_size),
+              _response(max_elements * points_per_element * response_size),
+              _jacobian() {}
+
+        /*!
+         * Set the point dof vector of an integration point of an element of the block
+         *
+         * \param element: The element of the block
+         * \param qp: The integration point
+         * \param &point_dof_begin: The starting iterator of the point dof vector
+         * \param &point_dof_end: The stopping iterator of the point dof vector
+         */
+        template <typename T>
+        template <class dof_iter>
+        void MaterialResponseBlock<T>::setPointDof(const size_type element, const size_type qp,
+                                                   const dof_iter &point_dof_begin, const dof_iter &point_dof_end) {
+            TARDIGRADE_BALANCE_EQS_CHECK((element < _max_elements) && (qp < _points_per_element), "The point (",
+                                         element, ", ", qp, ") is outside of the block")
+
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(point_dof_end - point_dof_begin) == _point_dof_size,
+                                         "The point dof vector has a size of ",
+                                         (size_type)(point_dof_end - point_dof_begin), " but the block has a size of ",
+                                         _point_dof_size)
+
+            const size_type num_points = getNumPoints();
+
+            const size_type point = _points_per_element * element + qp;
+
+            for (size_type c = 0; c < _point_dof_size; ++c) {
+                _point_dof[num_points * c + point] = *(point_dof_begin + c);
+            }
+        }
+
+        /*!
+         * Evaluate the material responses of the first elements of the block with one call of a material provider
+         *
+         * \param &provider: The material provider
+         * \param first_element: The index of the first element of the block in the mesh which locates the first
+         * point of the block for the provider
+         * \param num_elements: The number of elements of the block to evaluate
+         * \param compute_jacobian: Compute the material response Jacobians ( true ) or only the responses ( false )
+         */
+        template <typename T>
+        void MaterialResponseBlock<T>::evaluate(BatchedMaterialProvider<T> &provider, const size_type first_element,
+                                                const size_type num_elements, const bool compute_jacobian) {
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(num_elements <= _max_elements, "The block can hold ", _max_elements,
+                                               " elements but ", num_elements, " were requested")
+
+            const size_type num_points = num_elements * _points_per_element;
+
+            const size_type first_point = first_element * _points_per_element;
+
+            const PointArray<const T> point_dof = PointArray<const T>(getPointDof()).block(0, num_points);
+
+            if (compute_jacobian) {
+                _jacobian.resize(getNumPoints() * getJacobianSize());
+
+                provider.evaluate(first_point, point_dof, getResponse().block(0, num_points),
+                                  getJacobian().block(0, num_points));
+
+            } else {
+                provider.evaluate(first_point, point_dof, getResponse().block(0, num_points));
+            }
+        }
+
+        /*!
+         * Get the material response of an integration point of an element of the block
+         *
+         * \param element: The element of the block
+         * \param qp: The integration point
+         * \param response_begin: The starting iterator of the material response
+         * \param response_end: The stopping iterator of the material response
+         */
+        template <typename T>
+        template <class response_iter>
+        void MaterialResponseBlock<T>::getResponse(const size_type element, const size_type qp,
+                                                   response_iter response_begin, response_iter response_end) const {
+            TARDIGRADE_BALANCE_EQS_CHECK((element < _max_elements) && (qp < _points_per_element), "The point (",
+                                         element, ", ", qp, ") is outside of the block")
+
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(response_end - response_begin) == _response_size,
+                                         "The material response has a size of ",
+                                         (size_type)(response_end - response_begin), " but the block has a size of ",
+                                         _response_size)
+
+            const size_type num_points = getNumPoints();
+
+            const size_type point = _points_per_element * element + qp;
+
+            for (size_type c = 0; c < _response_size; ++c) {
+                *(response_begin + c) = _response[num_points * c + point];
+            }
+        }
+
+        /*!
+         * Get the material response Jacobian of an integration point of an element of the block
+         *
+         * \param element: The element of the block
+         * \param qp: The integration point
+         * \param jacobian_begin: The starting iterator of the material response Jacobian
+         * \param jacobian_end: The stopping iterator of the material response Jacobian
+         */
+        template <typename T>
+        template <class jacobian_iter>
+        void MaterialResponseBlock<T>::getJacobian(const size_type element, const size_type qp,
+                                                   jacobian_iter jacobian_begin, jacobian_iter jacobian_end) const {
+            TARDIGRADE_BALANCE_EQS_CHECK((element < _max_elements) && (qp < _points_per_element), "The point (",
+                                         element, ", ", qp, ") is outside of the block")
+
+            TARDIGRADE_BALANCE_EQS_CHECK(!_jacobian.empty(), "The Jacobians of the block have not been computed")
+
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(jacobian_end - jacobian_begin) == getJacobianSize(),
+                                         "The material response Jacobian has a size of ",
+                                         (size_type)(jacobian_end - jacobian_begin), " but the block has a size of ",
+                                         getJacobianSize())
+
+            const size_type num_points = getNumPoints();
+
+            const size_type point = _points_per_element * element + qp;
+
+            const size_type jacobian_size = getJacobianSize();
+
+            for (size_type c = 0; c < jacobian_size; ++c) {
+                *(jacobian_begin + c) = _jacobian[num_points * c + point];
+            }
+        }
+
+        /*!
+         * Interpolate the point dof vectors of the volume integration points of an element into a block. The point
+         * dof vector contains the interpolated degrees of freedom followed by their spatial gradients with the velocity
+         * in place of the spatial degree of freedom whose rate it is i.e., the point dof vector passed to the material
+         * models by the element kernels.
+         *
+         * dim: The spatial dimension
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &block: The block
+         * \param block_element: The element of the block
+         */
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_iter,
+                  class dof_dot_iter, typename T>
+        void interpolatePointDof(finiteElement::FiniteElementBase<element_configuration> &element,
+                                 const typename element_configuration::node_in &node_positions_begin,
+                                 const typename element_configuration::node_in &node_positions_end,
+                                 const dof_iter &dof_begin, const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin,
+                                 const dof_dot_iter &dof_dot_end, MaterialResponseBlock<T> &block,
+                                 const size_type block_element) {
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using weight_type           = typename element_configuration::volume_integration_point_weight_value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                               "The dof has a size of ", (size_type)(dof_end - dof_begin),
+                                               " but should have a size of ", node_count * num_dof)
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                               "The dof dot has a size of ", (size_type)(dof_dot_end - dof_dot_begin),
+                                               " but should have a size of ", node_count * num_dof)
+
+            TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(
+                (block.getPointDofSize() == num_dof * (1 + dim)) &&
+                    (block.getPointsPerElement() == element_configuration::num_volume_integration_points),
+                "The block does not hold the point dof vectors of the integration points of the element")
+
+            std::array<local_node_value_type, element_configuration::local_dim> xi;
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<T, num_dof * (1 + dim)> point_dof;
+
+            weight_type weight;
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    element.GetShapeFunctions(std::cbegin(xi), std::cend(xi), std::begin(N), std::end(N)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(element.GetGlobalShapeFunctionGradients(
+                    std::cbegin(xi), std::cend(xi), node_positions_begin, node_positions_end, std::begin(dNdx),
+                    std::end(dNdx)));
+
+                std::fill(std::begin(point_dof), std::end(point_dof), T());
+
+                for (unsigned int node = 0; node < node_count; ++node) {
+                    for (unsigned int K = 0; K < num_dof; ++K) {
+                        const bool is_velocity = (K >= velocity_offset) && (K < velocity_offset + nphases * dim);
+
+                        const T value = is_velocity ? *(dof_dot_begin + num_dof * node + K)
+                                                    : *(dof_begin + num_dof * node + K);
+
+                        point_dof[K] += N[node] * value;
+
+                        for (unsigned int a = 0; a < dim; ++a) {
+                            point_dof[num_dof + dim * K + a] += dNdx[dim * node + a] * value;
+                        }
+                    }
+                }
+
+                block.setPointDof(block_element, qp, std::cbegin(point_dof), std::cend(point_dof));
+            }
+        }
+
+    }  // namespace materialProvider
+
+}  // namespace tardigradeBalanceEquations
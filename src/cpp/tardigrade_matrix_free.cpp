@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_matrix_free.cpp
+ ******************************************************************************
+ * The source file for the matrix-free application of the linearized balance
+ * equations
+ ******************************************************************************
+ */
+
+#include "tardigrade_matrix_free.h"
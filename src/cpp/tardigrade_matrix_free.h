@@ -0,0 +1,335 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_matrix_free.h
+ ******************************************************************************
+ * The header file for the matrix-free application of the linearized balance
+ * equations. For quadratic hex elements with many phases every degree of
+ * freedom of a node is coupled to those of dozens of nodes so the assembled
+ * Jacobian dominates the memory of a solve. The element operator applies the
+ * Jacobian to a vector element by element and never forms a Jacobian. The
+ * weak form is linear in both the test and the trial functions so the
+ * element product only calls the chain-rule kernels of the balance equations
+ * for (1 + dim)^2 virtual shape functions at each integration point rather
+ * than for every pair of nodes. The material tangents of the integration
+ * points may either be recomputed for every product or be cached once per
+ * linearization so that the material model is only called once per Newton
+ * iteration. The elements are looped over by color so that the products may
+ * be distributed over a thread pool without atomics.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_MATRIX_FREE_H
+#define TARDIGRADE_MATRIX_FREE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "tardigrade_element_coloring.h"
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+#include "tardigrade_thread_pool.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace matrixFree {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        /*!
+         * Storage of the material response and the material response Jacobian at each integration point of each
+         * element. The values of a point are computed by the material model the first time the point is evaluated
+         * after the cache is invalidated and are reused until the next invalidation. The cache should be invalidated
+         * whenever the degrees of freedom the operator is linearized about change.
+         *
+         * Each point is only written by the thread evaluating its element so the cache may be filled concurrently
+         * by the colored element loops.
+         */
+        template <typename T>
+        class MaterialTangentCache {
+           public:
+            /*!
+             * Default constructor
+             */
+            MaterialTangentCache()
+                : _num_elements(0),
+                  _num_points(0),
+                  _response_size(0),
+                  _jacobian_size(0),
+                  _responses(),
+                  _jacobians(),
+                  _cached() {}
+
+            MaterialTangentCache(const size_type num_elements, const size_type num_points,
+                                 const size_type response_size, const size_type jacobian_size);
+
+            //! Get the number of elements
+            size_type getNumElements() const { return _num_elements; }
+
+            //! Get the number of integration points of an element
+            size_type getNumPoints() const { return _num_points; }
+
+            //! Get the size of the material response of a point
+            size_type getResponseSize() const { return _response_size; }
+
+            //! Get the size of the material response Jacobian of a point
+            size_type getJacobianSize() const { return _jacobian_size; }
+
+            //! Get the number of bytes used by the cached values
+            std::size_t getMemoryBytes() const {
+                return (_responses.size() + _jacobians.size()) * sizeof(T) + _cached.size() * sizeof(char);
+            }
+
+            /*!
+             * Check if the values of a point are cached
+             *
+             * \param element: The element
+             * \param qp: The integration point
+             */
+            bool isCached(const size_type element, const size_type qp) const {
+                return _cached[_num_points * element + qp] != 0;
+            }
+
+            void invalidate();
+
+            template <class material_model, class dof_iter, class response_iter, class jacobian_iter>
+            void evaluate(const size_type element, const unsigned int qp, material_model &model,
+                          const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                          response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                          jacobian_iter jacobian_end);
+
+           protected:
+            size_type _num_elements;  //!< The number of elements
+
+            size_type _num_points;  //!< The number of integration points of an element
+
+            size_type _response_size;  //!< The size of the material response of a point
+
+            size_type _jacobian_size;  //!< The size of the material response Jacobian of a point
+
+            std::vector<T> _responses;  //!< The material responses of the points
+
+            std::vector<T> _jacobians;  //!< The material response Jacobians of the points
+
+            std::vector<char> _cached;  //!< Flags indicating that the values of a point are cached
+        };
+
+        /*!
+         * A material model for one element which reads the material response and its Jacobian from a cache. The
+         * model has the interface of the material models of the element kernels so it may be passed to e.g.,
+         * applyElementBalanceOfLinearMomentum in place of the model it wraps. The material response
+         * alone is never cached since it is only requested by residual evaluations at new degrees of freedom.
+         */
+        template <typename T, class material_model>
+        class CachedMaterialModel {
+           public:
+            /*!
+             * Constructor for the cached model
+             *
+             * \param &cache: The cache of the material tangents
+             * \param element: The element the model is called for
+             * \param &model: The material model which fills the cache
+             */
+            CachedMaterialModel(MaterialTangentCache<T> &cache, const size_type element, material_model &model)
+                : _cache(&cache), _element(element), _model(&model) {}
+
+            /*!
+             * Compute the material response with the wrapped model
+             *
+             * \param qp: The integration point
+             * \param &point_dof_begin: The starting iterator of the point dof vector
+             * \param &point_dof_end: The stopping iterator of the point dof vector
+             * \param response_begin: The starting iterator of the material response
+             * \param response_end: The stopping iterator of the material response
+             */
+            template <class dof_iter, class response_iter>
+            void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                            response_iter response_begin, response_iter response_end) {
+                (*_model)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+            }
+
+            /*!
+             * Get the material response and its Jacobian from the cache
+             *
+             * \param qp: The integration point
+             * \param &point_dof_begin: The starting iterator of the point dof vector
+             * \param &point_dof_end: The stopping iterator of the point dof vector
+             * \param response_begin: The starting iterator of the material response
+             * \param response_end: The stopping iterator of the material response
+             * \param jacobian_begin: The starting iterator of the material response Jacobian
+             * \param jacobian_end: The stopping iterator of the material response Jacobian
+             */
+            template <class dof_iter, class response_iter, class jacobian_iter>
+            void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                            response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                            jacobian_iter jacobian_end) {
+                _cache->evaluate(_element, qp, *_model, point_dof_begin, point_dof_end, response_begin, response_end,
+                                 jacobian_begin, jacobian_end);
+            }
+
+           protected:
+            MaterialTangentCache<T> *_cache;  //!< The cache of the material tangents
+
+            size_type _element;  //!< The element the model is called for
+
+            material_model *_model;  //!< The material model which fills the cache
+        };
+
+        /*!
+         * The Jacobian of a mesh as an operator which is applied element by element. The element product kernel
+         * computes the product of the element Jacobian and the node-major element degrees of freedom of a vector i.e.,
+         *
+         * kernel( e, x_begin, x_end, product_begin, product_end )
+         *
+         * where the product starts at zero. The kernel is linearized about the degrees of freedom it captures e.g.,
+         * by calling applyElementBalanceOfLinearMomentum. It is called concurrently for different elements when a
+         * thread pool is given so it must not modify shared state other than a MaterialTangentCache.
+         */
+        template <typename T, class element_kernel>
+        class ElementOperator {
+           public:
+            ElementOperator(const meshAssembly::MeshConnectivity   &connectivity,
+                            const meshAssembly::DofNumbering       &numbering,
+                            const elementColoring::ElementColoring &coloring, element_kernel &kernel,
+                            threadPool::ThreadPool *pool = nullptr);
+
+            //! Get the number of rows
+            size_type getNumRows() const { return _numbering->getNumDOF(); }
+
+            //! Get the number of degrees of freedom of an element
+            size_type getNumElementDOF() const { return _num_element_dof; }
+
+            //! Get the number of bytes used by the per-thread element vectors
+            std::size_t getMemoryBytes() const { return _element_x.size() * 2 * _num_element_dof * sizeof(T); }
+
+            template <class x_iter, class y_iter>
+            void multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin, y_iter y_end) const;
+
+           protected:
+            const meshAssembly::MeshConnectivity *_connectivity;  //!< The mesh connectivity
+
+            const meshAssembly::DofNumbering *_numbering;  //!< The numbering of the degrees of freedom
+
+            const elementColoring::ElementColoring *_coloring;  //!< The element coloring
+
+            element_kernel *_kernel;  //!< The element product kernel
+
+            threadPool::ThreadPool *_pool;  //!< The thread pool
+
+            size_type _num_element_dof;  //!< The number of degrees of freedom of an element
+
+            mutable threadPool::PerThreadScratch<std::vector<T>> _element_x;  //!< The gathered element vectors
+
+            mutable threadPool::PerThreadScratch<std::vector<T>> _element_y;  //!< The element products
+        };
+
+        template <typename T, class element_kernel>
+        ElementOperator<T, element_kernel> makeElementOperator(const meshAssembly::MeshConnectivity   &connectivity,
+                                                               const meshAssembly::DofNumbering       &numbering,
+                                                               const elementColoring::ElementColoring &coloring,
+                                                               element_kernel                         &kernel,
+                                                               threadPool::ThreadPool *pool = nullptr);
+
+        template <class element_function>
+        void forEachElement(const elementColoring::ElementColoring &coloring, threadPool::ThreadPool *pool,
+                            element_function function);
+
+        template <typename T, class element_kernel, class diagonal_iter>
+        void assembleDiagonal(const meshAssembly::MeshConnectivity &connectivity,
+                              const meshAssembly::DofNumbering &numbering,
+                              const elementColoring::ElementColoring &coloring, element_kernel &kernel,
+                              diagonal_iter diagonal_begin, diagonal_iter diagonal_end,
+                              threadPool::ThreadPool *pool = nullptr);
+
+        template <typename T, int dim, int nphases, int num_additional_dof, int num_rows, class point_x_iter,
+                  class point_product_iter>
+        void addPointJacobianProduct(
+            const meshAssembly::PointJacobianBlock<T, dim, nphases, num_additional_dof, num_rows> &block,
+            const unsigned int s, const point_x_iter &point_x_begin, const point_x_iter &point_x_end,
+            point_product_iter point_product_begin, point_product_iter point_product_end);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class dof_ddot_iter,
+                  typename dDotdDOF_type, typename dDDotdDOF_type, class material_model, class x_iter,
+                  class product_iter>
+        void applyElementBalanceOfLinearMomentum(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dof_ddot_iter &dof_ddot_begin, const dof_ddot_iter &dof_ddot_end, const dDotdDOF_type &dDotdDOF,
+            const dDDotdDOF_type &dDDotdDOF, material_model &model, const x_iter &x_begin, const x_iter &x_end,
+            product_iter product_begin, product_iter product_end, const bool configuration = true);
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  typename dDotdDOF_type, class material_model, class x_iter, class product_iter>
+        void applyElementBalanceOfMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                                       const typename element_configuration::node_in &node_positions_begin,
+                                       const typename element_configuration::node_in &node_positions_end,
+                                       const dof_iter &dof_begin, const dof_iter &dof_end,
+                                       const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                       const dDotdDOF_type &dDotdDOF, material_model &model, const x_iter &x_begin,
+                                       const x_iter &x_end, product_iter product_begin, product_iter product_end,
+                                       const bool configuration = true);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, typename dDotdDOF_type,
+                  class material_model, class x_iter, class product_iter>
+        void applyElementBalanceOfEnergy(finiteElement::FiniteElementBase<element_configuration> &element,
+                                         const typename element_configuration::node_in &node_positions_begin,
+                                         const typename element_configuration::node_in &node_positions_end,
+                                         const dof_iter &dof_begin, const dof_iter &dof_end,
+                                         const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                         const dDotdDOF_type &dDotdDOF, material_model &model, const x_iter &x_begin,
+                                         const x_iter &x_end, product_iter product_begin, product_iter product_end,
+                                         const bool configuration = true);
+
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class rest_density_iter, typename dDotdDOF_type, class material_model, class x_iter,
+                  class product_iter>
+        void applyElementBalanceOfVolumeFraction(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                 const typename element_configuration::node_in &node_positions_begin,
+                                                 const typename element_configuration::node_in &node_positions_end,
+                                                 const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                 const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                 const rest_density_iter &rest_density_begin,
+                                                 const rest_density_iter &rest_density_end,
+                                                 const dDotdDOF_type &dDotdDOF, material_model &model,
+                                                 const x_iter &x_begin, const x_iter &x_end, product_iter product_begin,
+                                                 product_iter product_end, const bool configuration = true);
+
+        template <int dim, int material_response_dim, int predicted_internal_energy_index, int material_response_size,
+                  int nphases, int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  typename dDotdDOF_type, class material_model, class x_iter, class product_iter>
+        void applyElementInternalEnergyConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                  const typename element_configuration::node_in &node_positions_begin,
+                                                  const typename element_configuration::node_in &node_positions_end,
+                                                  const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                  const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                  const dDotdDOF_type &dDotdDOF, material_model &model,
+                                                  const x_iter &x_begin, const x_iter &x_end,
+                                                  product_iter product_begin, product_iter product_end,
+                                                  const bool configuration = true);
+
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_dot_iter,
+                  typename dDotdDOF_type, class x_iter, class product_iter>
+        void applyElementDisplacementConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                const typename element_configuration::node_in &node_positions_begin,
+                                                const typename element_configuration::node_in &node_positions_end,
+                                                const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                const dDotdDOF_type &dDotdDOF, const x_iter &x_begin,
+                                                const x_iter &x_end, product_iter product_begin,
+                                                product_iter product_end, const bool configuration = true);
+
+    }  // namespace matrixFree
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_matrix_free.tpp"
+
+#endif
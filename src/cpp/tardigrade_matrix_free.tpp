@@ -0,0 +1,1395 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_matrix_free.tpp
+ ******************************************************************************
+ * The template file for the matrix-free application of the linearized balance
+ * equations
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <string>
+
+#include "tardigrade_matrix_free.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace matrixFree {
+
+        /*!
+         * Constructor for the material tangent cache. The cache starts out invalidated.
+         *
+         * \param num_elements: The number of elements
+         * \param num_points: The number of integration points of an element
+         * \param response_size: The size of the material response of a point
+         * \param jacobian_size: The size of the material response Jacobian of a point
+         */
+        template <typename T>
+        MaterialTangentCache<T>::MaterialTangentCache(const size_type num_elements, const size_type num_points,
+                                                      const size_type response_size, const size_type jacobian_size)
+            : _num_elements(num_elements),
+              _num_points(num_points),
+              _response_size(response_size),
+              _jacobian_size(jacobian_size),
+              _responses((std::size_t)num_elements * num_points * response_size),
+              _jacobians((std::size_t)num_elements * num_points * jacobian_size),
+              _cached((std::size_t)num_elements * num_points, 0) {}
+
+        /*!
+         * Invalidate all of the cached points so that the material model is called for each of them again
+         */
+        template <typename T>
+        void MaterialTangentCache<T>::invalidate() {
+            std::fill(std::begin(_cached), std::end(_cached), 0);
+        }
+
+        /*!
+         * Get the material response and its Jacobian at a point. If the point is not cached the material model is
+         * called as
+         *
+         * model( qp, point_dof_begin, point_dof_end, response_begin, response_end, jacobian_begin, jacobian_end )
+         *
+         * and the result is stored. Otherwise the stored values are copied and the point dof vector is ignored.
+         *
+         * \param element: The element
+         * \param qp: The integration point
+         * \param &model: The material model
+         * \param &point_dof_begin: The starting iterator of the point dof vector
+         * \param &point_dof_end: The stopping iterator of the point dof vector
+         * \param response_begin: The starting iterator of the material response
+         * \param response_end: The stopping iterator of the material response
+         * \param jacobian_begin: The starting iterator of the material response Jacobian
+         * \param jacobian_end: The stopping iterator of the material response Jacobian
+         */
+        template <typename T>
+        template <class material_model, class dof_iter, class response_iter, class jacobian_iter>
+        void MaterialTangentCache<T>::evaluate(const size_type element, const unsigned int qp, material_model &model,
+                                               const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                                               response_iter response_begin, response_iter response_end,
+                                               jacobian_iter jacobian_begin, jacobian_iter jacobian_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK((element < _num_elements) && (qp < _num_points),
+                                         "The point (" + std::to_string(element) + ", " + std::to_string(qp) +
+                                             ") is outside of the cache")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(response_end - response_begin) == _response_size,
+                                         "The material response has a size of " +
+                                             std::to_string((size_type)(response_end - response_begin)) +
+                                             " but the cache has a size of " + std::to_string(_response_size))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) == _jacobian_size,
+                                         "The material response Jacobian has a size of " +
+                                             std::to_string((size_type)(jacobian_end - jacobian_begin)) +
+                                             " but the cache has a size of " + std::to_string(_jacobian_size))
+
+            const std::size_t point = (std::size_t)_num_points * element + qp;
+
+            auto response = std::begin(_responses) + _response_size * point;
+
+            auto jacobian = std::begin(_jacobians) + _jacobian_size * point;
+
+            if (_cached[point] == 0) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, point_dof_begin, point_dof_end, response_begin, response_end,
+                                                   jacobian_begin, jacobian_end));
+
+                std::copy(response_begin, response_end, response);
+
+                std::copy(jacobian_begin, jacobian_end, jacobian);
+
+                _cached[point] = 1;
+            } else {
+                std::copy(response, response + _response_size, response_begin);
+
+                std::copy(jacobian, jacobian + _jacobian_size, jacobian_begin);
+            }
+        }
+
+        /*!
+         * Constructor for the element operator. The mesh, the numbering, the coloring, and the kernel must outlive
+         * the operator.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &coloring: The element coloring from elementColoring::colorElements
+         * \param &kernel: The element product kernel
+         * \param *pool: The thread pool used for the products. The products are serial if it is null
+         */
+        template <typename T, class element_kernel>
+        ElementOperator<T, element_kernel>::ElementOperator(const meshAssembly::MeshConnectivity   &connectivity,
+                                                            const meshAssembly::DofNumbering       &numbering,
+                                                            const elementColoring::ElementColoring &coloring,
+                                                            element_kernel &kernel, threadPool::ThreadPool *pool)
+            : _connectivity(&connectivity),
+              _numbering(&numbering),
+              _coloring(&coloring),
+              _kernel(&kernel),
+              _pool(pool),
+              _num_element_dof(connectivity.getNodesPerElement() * numbering.getNumNodeDOF()),
+              _element_x((pool == nullptr) ? 1 : pool->getNumThreads(), std::vector<T>(_num_element_dof)),
+              _element_y((pool == nullptr) ? 1 : pool->getNumThreads(), std::vector<T>(_num_element_dof)) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(coloring.getNumElements() == connectivity.getNumElements(),
+                                         "The coloring must have a color for each element")
+        }
+
+        /*!
+         * Compute the product of the Jacobian and a vector element by element \f$ y = \sum_e P_e^T J_e P_e x \f$
+         * where \f$ P_e \f$ gathers the degrees of freedom of element e
+         *
+         * \param &x_begin: The starting iterator of the vector
+         * \param &x_end: The stopping iterator of the vector
+         * \param y_begin: The starting iterator of the product
+         * \param y_end: The stopping iterator of the product
+         */
+        template <typename T, class element_kernel>
+        template <class x_iter, class y_iter>
+        void ElementOperator<T, element_kernel>::multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin,
+                                                          y_iter y_end) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == getNumRows(),
+                                         "The vector must have a size equal to the number of dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(y_end - y_begin) == getNumRows(),
+                                         "The product must have a size equal to the number of dof")
+
+            std::fill(y_begin, y_end, T());
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(forEachElement(*_coloring, _pool, [&](const unsigned int worker,
+                                                                               const size_type e) {
+                auto &element_x = _element_x[worker];
+
+                auto &element_y = _element_y[worker];
+
+                meshAssembly::gatherElement(*_connectivity, *_numbering, e, x_begin, x_end, std::begin(element_x),
+                                            std::end(element_x));
+
+                std::fill(std::begin(element_y), std::end(element_y), T());
+
+                (*_kernel)(e, std::cbegin(element_x), std::cend(element_x), std::begin(element_y), std::end(element_y));
+
+                meshAssembly::scatterElementResidual(*_connectivity, *_numbering, e, std::cbegin(element_y),
+                                                     std::cend(element_y), y_begin, y_end);
+            }));
+        }
+
+        /*!
+         * Make an element operator deducing the type of the kernel
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &coloring: The element coloring from elementColoring::colorElements
+         * \param &kernel: The element product kernel
+         * \param *pool: The thread pool used for the products. The products are serial if it is null
+         */
+        template <typename T, class element_kernel>
+        ElementOperator<T, element_kernel> makeElementOperator(const meshAssembly::MeshConnectivity   &connectivity,
+                                                               const meshAssembly::DofNumbering       &numbering,
+                                                               const elementColoring::ElementColoring &coloring,
+                                                               element_kernel &kernel, threadPool::ThreadPool *pool) {
+            return ElementOperator<T, element_kernel>(connectivity, numbering, coloring, kernel, pool);
+        }
+
+        /*!
+         * Call a function for each element of a mesh one color at a time. The function is called as
+         *
+         * function( worker, element )
+         *
+         * where worker selects the per-thread scratch. The elements of a color are distributed over the thread pool
+         * if there is one and are visited in order on the calling thread (worker 0) otherwise.
+         *
+         * \param &coloring: The element coloring
+         * \param *pool: The thread pool. The loop is serial if it is null
+         * \param function: The function to call for each element
+         */
+        template <class element_function>
+        void forEachElement(const elementColoring::ElementColoring &coloring, threadPool::ThreadPool *pool,
+                            element_function function) {
+            for (size_type color = 0; color < coloring.getNumColors(); ++color) {
+                if (pool == nullptr) {
+                    for (auto e = coloring.getColorElementsBegin(color); e != coloring.getColorElementsEnd(color);
+                         ++e) {
+                        function(0, *e);
+                    }
+                } else {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(elementColoring::forEachColoredElement(coloring, color, *pool,
+                                                                                        function));
+                }
+            }
+        }
+
+        /*!
+         * Assemble the diagonal of the Jacobian of a mesh from the element Jacobians e.g., for a Jacobi
+         * preconditioner of an element operator. The element kernel has the interface of
+         * meshAssembly::assembleResidualAndJacobian. Only one element Jacobian per thread is stored.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &coloring: The element coloring from elementColoring::colorElements
+         * \param &kernel: The element Jacobian kernel
+         * \param diagonal_begin: The starting iterator of the diagonal
+         * \param diagonal_end: The stopping iterator of the diagonal
+         * \param *pool: The thread pool. The assembly is serial if it is null
+         */
+        template <typename T, class element_kernel, class diagonal_iter>
+        void assembleDiagonal(const meshAssembly::MeshConnectivity &connectivity,
+                              const meshAssembly::DofNumbering &numbering,
+                              const elementColoring::ElementColoring &coloring, element_kernel &kernel,
+                              diagonal_iter diagonal_begin, diagonal_iter diagonal_end, threadPool::ThreadPool *pool) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(coloring.getNumElements() == connectivity.getNumElements(),
+                                         "The coloring must have a color for each element")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(diagonal_end - diagonal_begin) == numbering.getNumDOF(),
+                                         "The diagonal must have a size equal to the number of dof")
+
+            const size_type num_element_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+            const unsigned int num_threads = (pool == nullptr) ? 1 : pool->getNumThreads();
+
+            threadPool::PerThreadScratch<std::vector<T>> element_residuals(num_threads,
+                                                                           std::vector<T>(num_element_dof));
+
+            threadPool::PerThreadScratch<std::vector<T>> element_jacobians(
+                num_threads, std::vector<T>(num_element_dof * num_element_dof));
+
+            std::fill(diagonal_begin, diagonal_end, T());
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(forEachElement(coloring, pool, [&](const unsigned int worker,
+                                                                            const size_type e) {
+                auto &element_residual = element_residuals[worker];
+
+                auto &element_jacobian = element_jacobians[worker];
+
+                std::fill(std::begin(element_residual), std::end(element_residual), T());
+
+                std::fill(std::begin(element_jacobian), std::end(element_jacobian), T());
+
+                kernel(e, std::begin(element_residual), std::end(element_residual), std::begin(element_jacobian),
+                       std::end(element_jacobian));
+
+                // Reuse the element residual for the diagonal of the element Jacobian
+                for (size_type i = 0; i < num_element_dof; ++i) {
+                    element_residual[i] = element_jacobian[(num_element_dof + 1) * i];
+                }
+
+                meshAssembly::scatterElementResidual(connectivity, numbering, e, std::cbegin(element_residual),
+                                                     std::cend(element_residual), diagonal_begin, diagonal_end);
+            }));
+        }
+
+        /*!
+         * Add the product of a point Jacobian block and the element vector contracted with a virtual interpolation
+         * function to the rows of a point product. The virtual interpolation function \f$ (1, 0) \f$ selects the
+         * interpolated vector and \f$ (0, e_k) \f$ selects the k-th component of its spatial gradient.
+         *
+         * \param &block: The derivatives of the rows for the virtual interpolation function
+         * \param s: The index of the virtual interpolation function
+         * \param &point_x_begin: The starting iterator of the interpolated vector followed by its spatial gradient
+         * \param &point_x_end: The stopping iterator of the interpolated vector followed by its spatial gradient
+         * \param point_product_begin: The starting iterator of the rows of the point product
+         * \param point_product_end: The stopping iterator of the rows of the point product
+         */
+        template <typename T, int dim, int nphases, int num_additional_dof, int num_rows, class point_x_iter,
+                  class point_product_iter>
+        void addPointJacobianProduct(
+            const meshAssembly::PointJacobianBlock<T, dim, nphases, num_additional_dof, num_rows> &block,
+            const unsigned int s, const point_x_iter &point_x_begin, const point_x_iter &point_x_end,
+            point_product_iter point_product_begin, point_product_iter point_product_end) {
+            using product_type = typename std::iterator_traits<point_product_iter>::value_type;
+
+            constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;
+
+            // The offsets of the fields in the degrees of freedom of a node
+            constexpr std::array<unsigned int, 7> field_offsets = {
+                0, nphases, nphases * (1 + dim), nphases * (1 + 2 * dim), nphases * (2 + 2 * dim),
+                nphases * (3 + 2 * dim), nphases * (4 + 2 * dim)};
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(point_x_end - point_x_begin) == num_dof * (1 + dim),
+                                         "The interpolated vector must have a size of the number of dof of a node "
+                                         "times one plus the dimension")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(point_product_end - point_product_begin) == num_rows,
+                                         "The point product must have a size of the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(s < 1 + dim, "The virtual interpolation function must be less than 1 + dim")
+
+            // The vector contracted with the virtual interpolation function is the value or a gradient component
+            const auto         x      = (s == 0) ? point_x_begin : point_x_begin + num_dof + s - 1;
+            const unsigned int stride = (s == 0) ? 1 : dim;
+
+            for (unsigned int r = 0; r < num_rows; ++r) {
+                product_type sum = product_type();
+
+                for (unsigned int q = 0; q < nphases; ++q) {
+                    sum += block.dRdRho[nphases * r + q] * (*(x + stride * (field_offsets[0] + q)));
+                    sum += block.dRdTheta[nphases * r + q] * (*(x + stride * (field_offsets[3] + q)));
+                    sum += block.dRdE[nphases * r + q] * (*(x + stride * (field_offsets[4] + q)));
+                    sum += block.dRdVolumeFraction[nphases * r + q] * (*(x + stride * (field_offsets[5] + q)));
+                }
+
+                for (unsigned int k = 0; k < nphases * dim; ++k) {
+                    sum += block.dRdW[nphases * dim * r + k] * (*(x + stride * (field_offsets[1] + k)));
+                    sum += block.dRdU[nphases * dim * r + k] * (*(x + stride * (field_offsets[2] + k)));
+                }
+
+                for (unsigned int z = 0; z < num_additional_dof; ++z) {
+                    sum += block.dRdZ[num_additional_dof * r + z] * (*(x + stride * (field_offsets[6] + z)));
+                }
+
+                *(point_product_begin + r) += sum;
+            }
+        }
+
+        /*!
+         * Compute the product of the Jacobian of the balance of linear momentum of an element and a vector without
+         * forming the Jacobian. The product is added to the rows of the velocity field of the node-major element
+         * product. The arguments and the material model are the same as those of the Jacobian overload of
+         * meshAssembly::computeElementBalanceOfLinearMomentum which this function reproduces the product of.
+         *
+         * The residual of a test function is linear in the test function and its gradient and its derivative w.r.t.
+         * the degrees of freedom of a node is linear in the shape function of the node and its gradient. The chain-rule
+         * kernel is therefore evaluated at each integration point for the virtual shape functions \f$ (1, 0) \f$ and
+         * \f$ (0, e_k) \f$ of both the test and the trial functions and the result is contracted with the shape
+         * functions of the nodes and the interpolated vector and its gradient. This costs \f$ (1 + dim)^2 \f$ kernel
+         * calls per point rather than the square of the number of nodes of the assembled element Jacobian.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * body_force_index: The index of the material response vector where the body force is located
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dof_ddot_begin: The starting iterator of the second time derivative of the degrees of freedom
+         * \param &dof_ddot_end: The stopping iterator of the second time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &dDDotdDOF: The derivative of the second time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param &x_begin: The starting iterator of the node-major element vector
+         * \param &x_end: The stopping iterator of the node-major element vector
+         * \param product_begin: The starting iterator of the node-major element product
+         * \param product_end: The stopping iterator of the node-major element product
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class dof_ddot_iter,
+                  typename dDotdDOF_type, typename dDDotdDOF_type, class material_model, class x_iter,
+                  class product_iter>
+        void applyElementBalanceOfLinearMomentum(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dof_ddot_iter &dof_ddot_begin, const dof_ddot_iter &dof_ddot_end, const dDotdDOF_type &dDotdDOF,
+            const dDDotdDOF_type &dDDotdDOF, material_model &model, const x_iter &x_begin, const x_iter &x_end,
+            product_iter product_begin, product_iter product_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using product_type          = typename std::iterator_traits<product_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases * dim;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_ddot_end - dof_ddot_begin) == node_count * num_dof,
+                                         "The dof ddot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == node_count * num_dof,
+                                         "The vector must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(product_end - product_begin) == node_count * num_dof,
+                                         "The product must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot, point_dof_ddot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            // The vector and its gradient interpolated to the point i.e., the vector contracted with the virtual
+            // interpolation functions
+            std::array<product_type, num_dof * (1 + dim)> point_x;
+
+            // The product of the point Jacobian and the interpolated vector for each virtual test function
+            std::array<product_type, num_virtual * num_rows> point_product;
+
+            meshAssembly::PointJacobianBlock<product_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            meshAssembly::getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N),
+                                                        std::begin(virtual_dNdx), std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getElementPointData(
+                    element, qp, node_positions_begin, node_positions_end, std::begin(N), std::end(N),
+                    std::begin(dNdx), std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_ddot_begin, dof_ddot_end,
+                    std::begin(point_dof_ddot), std::end(point_dof_ddot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), x_begin, x_end,
+                    std::begin(point_x), std::end(point_x)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                        std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof),
+                        std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_product), std::end(point_product), product_type());
+
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    for (unsigned int s = 0; s < num_virtual; ++s) {
+                        TARDIGRADE_ERROR_TOOLS_CATCH(
+                            (balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                                dim, material_response_dim, body_force_index, cauchy_stress_index,
+                                interphasic_force_index, num_phase_dof + num_additional_dof>(
+                                std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                                std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                                std::cbegin(point_dof) + num_dof + nphases * dim,
+                                std::cbegin(point_dof_dot) + velocity_offset,
+                                std::cbegin(point_dof_dot) + velocity_offset + num_rows,
+                                std::cbegin(point_dof_ddot) + velocity_offset,
+                                std::cbegin(point_dof_ddot) + velocity_offset + num_rows,
+                                std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                                std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + num_rows),
+                                std::cbegin(material_response), std::cend(material_response),
+                                std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                                std::cbegin(point_dof) + volume_fraction_offset,
+                                std::cbegin(point_dof) + volume_fraction_offset + nphases, virtual_N[t],
+                                std::cbegin(virtual_dNdx) + dim * t, std::cbegin(virtual_dNdx) + dim * (t + 1),
+                                virtual_N[s], std::cbegin(virtual_dNdx) + dim * s,
+                                std::cbegin(virtual_dNdx) + dim * (s + 1), std::cbegin(point_dof) + num_dof,
+                                std::cend(point_dof), dDotdDOF, dDotdDOF, dDDotdDOF, std::begin(block.result),
+                                std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                                std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                                std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                                std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                                std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                                std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                        TARDIGRADE_ERROR_TOOLS_CATCH(addPointJacobianProduct(
+                            block, s, std::cbegin(point_x), std::cend(point_x),
+                            std::begin(point_product) + num_rows * t, std::begin(point_product) + num_rows * (t + 1)));
+                    }
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::integrateElementResidual<dim, num_dof, num_rows, num_virtual>(
+                        std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_product),
+                        std::cend(point_product), velocity_offset, Jxw, product_begin, product_end)));
+            }
+        }
+
+        /*!
+         * Compute the product of the Jacobian of the balance of mass of an element and a vector without forming the
+         * Jacobian. The product is added to the rows of the density field of the node-major element product. The
+         * arguments and the material model are the same as those of the Jacobian overload of
+         * meshAssembly::computeElementBalanceOfMass which this function reproduces the product of.
+         *
+         * The balance of mass does not depend on the gradient of the test function so the chain-rule kernel is only
+         * evaluated for the virtual test function \f$ (1, 0) \f$ and the virtual trial functions \f$ (1, 0) \f$ and
+         * \f$ (0, e_k) \f$ at each integration point and the results are contracted with the interpolated vector and
+         * its gradient.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * mass_change_index: The index of the material response vector where the mass change rate is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param &x_begin: The starting iterator of the node-major element vector
+         * \param &x_end: The stopping iterator of the node-major element vector
+         * \param product_begin: The starting iterator of the node-major element product
+         * \param product_end: The stopping iterator of the node-major element product
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  typename dDotdDOF_type, class material_model, class x_iter, class product_iter>
+        void applyElementBalanceOfMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                                       const typename element_configuration::node_in &node_positions_begin,
+                                       const typename element_configuration::node_in &node_positions_end,
+                                       const dof_iter &dof_begin, const dof_iter &dof_end,
+                                       const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                       const dDotdDOF_type &dDotdDOF, material_model &model, const x_iter &x_begin,
+                                       const x_iter &x_end, product_iter product_begin, product_iter product_end,
+                                       const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using product_type          = typename std::iterator_traits<product_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == node_count * num_dof,
+                                         "The vector must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(product_end - product_begin) == node_count * num_dof,
+                                         "The product must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            // The vector and its gradient interpolated to the point i.e., the vector contracted with the virtual
+            // interpolation functions
+            std::array<product_type, num_dof * (1 + dim)> point_x;
+
+            // The product of the point Jacobian and the interpolated vector for each virtual test function
+            std::array<product_type, num_rows> point_product;
+
+            meshAssembly::PointJacobianBlock<product_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            meshAssembly::getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N),
+                                                        std::begin(virtual_dNdx), std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getElementPointData(
+                    element, qp, node_positions_begin, node_positions_end, std::begin(N), std::end(N),
+                    std::begin(dNdx), std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), x_begin, x_end,
+                    std::begin(point_x), std::end(point_x)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                        std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof),
+                        std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_product), std::end(point_product), product_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfMass::computeBalanceOfMass<dim, material_response_dim, mass_change_index,
+                                                             num_phase_dof + num_additional_dof>(
+                            std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                            std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                            std::cbegin(point_dof) + num_dof + nphases * dim,
+                            std::cbegin(point_dof_dot) + velocity_offset,
+                            std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                            std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                            std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + nphases * dim),
+                            std::cbegin(material_response), std::cend(material_response),
+                            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                            virtual_N[0], virtual_N[s], std::cbegin(virtual_dNdx) + dim * s,
+                            std::cbegin(virtual_dNdx) + dim * (s + 1), std::cbegin(point_dof) + num_dof,
+                            std::cend(point_dof), dDotdDOF, dDotdDOF, std::begin(block.result),
+                            std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                            std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                            std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                            std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                            std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                            std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(addPointJacobianProduct(
+                        block, s, std::cbegin(point_x), std::cend(point_x), std::begin(point_product),
+                        std::end(point_product)));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((meshAssembly::integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_product),
+                    std::cend(point_product), 0, Jxw, product_begin, product_end)));
+            }
+        }
+
+        /*!
+         * Compute the product of the Jacobian of the balance of energy of an element and a vector without forming the
+         * Jacobian. The product is added to the rows of the temperature field of the node-major element product. The
+         * arguments and the material model are the same as those of the Jacobian overload of
+         * meshAssembly::computeElementBalanceOfEnergy which this function reproduces the product of.
+         *
+         * The chain-rule kernel is evaluated at each integration point for the virtual shape functions \f$ (1, 0) \f$
+         * and \f$ (0, e_k) \f$ of both the test and the trial functions as in applyElementBalanceOfLinearMomentum.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * internal_heat_generation_index: The index of the material response vector where the internal heat generation
+         * is located
+         * heat_flux_index: The index of the material response vector where the heat flux is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * interphasic_heat_transfer_index: The index of the material response vector where the net interphasic heat
+         * transfer is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param &x_begin: The starting iterator of the node-major element vector
+         * \param &x_end: The stopping iterator of the node-major element vector
+         * \param product_begin: The starting iterator of the node-major element product
+         * \param product_end: The stopping iterator of the node-major element product
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, typename dDotdDOF_type,
+                  class material_model, class x_iter, class product_iter>
+        void applyElementBalanceOfEnergy(finiteElement::FiniteElementBase<element_configuration> &element,
+                                         const typename element_configuration::node_in &node_positions_begin,
+                                         const typename element_configuration::node_in &node_positions_end,
+                                         const dof_iter &dof_begin, const dof_iter &dof_end,
+                                         const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                         const dDotdDOF_type &dDotdDOF, material_model &model, const x_iter &x_begin,
+                                         const x_iter &x_end, product_iter product_begin, product_iter product_end,
+                                         const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using product_type          = typename std::iterator_traits<product_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int temperature_offset = nphases * (1 + 2 * dim);
+
+            constexpr unsigned int internal_energy_offset = nphases * (2 + 2 * dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == node_count * num_dof,
+                                         "The vector must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(product_end - product_begin) == node_count * num_dof,
+                                         "The product must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            // The vector and its gradient interpolated to the point i.e., the vector contracted with the virtual
+            // interpolation functions
+            std::array<product_type, num_dof * (1 + dim)> point_x;
+
+            // The product of the point Jacobian and the interpolated vector for each virtual test function
+            std::array<product_type, num_virtual * num_rows> point_product;
+
+            meshAssembly::PointJacobianBlock<product_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            meshAssembly::getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N),
+                                                        std::begin(virtual_dNdx), std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getElementPointData(
+                    element, qp, node_positions_begin, node_positions_end, std::begin(N), std::end(N),
+                    std::begin(dNdx), std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), x_begin, x_end,
+                    std::begin(point_x), std::end(point_x)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                        std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof),
+                        std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_product), std::end(point_product), product_type());
+
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    for (unsigned int s = 0; s < num_virtual; ++s) {
+                        TARDIGRADE_ERROR_TOOLS_CATCH(
+                            (balanceOfEnergy::computeBalanceOfEnergy<
+                                dim, is_per_unit_volume, material_response_dim, cauchy_stress_index,
+                                internal_heat_generation_index, heat_flux_index, interphasic_force_index,
+                                interphasic_heat_transfer_index, num_phase_dof + num_additional_dof>(
+                                std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                                std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                                std::cbegin(point_dof) + num_dof + nphases * dim,
+                                std::cbegin(point_dof) + internal_energy_offset,
+                                std::cbegin(point_dof) + internal_energy_offset + nphases,
+                                std::cbegin(point_dof_dot) + internal_energy_offset,
+                                std::cbegin(point_dof_dot) + internal_energy_offset + nphases,
+                                std::cbegin(point_dof) + num_dof + dim * internal_energy_offset,
+                                std::cbegin(point_dof) + num_dof + dim * (internal_energy_offset + nphases),
+                                std::cbegin(point_dof_dot) + velocity_offset,
+                                std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                                std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                                std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + nphases * dim),
+                                std::cbegin(material_response), std::cend(material_response),
+                                std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                                std::cbegin(point_dof) + volume_fraction_offset,
+                                std::cbegin(point_dof) + volume_fraction_offset + nphases, virtual_N[t],
+                                std::cbegin(virtual_dNdx) + dim * t, std::cbegin(virtual_dNdx) + dim * (t + 1),
+                                virtual_N[s], std::cbegin(virtual_dNdx) + dim * s,
+                                std::cbegin(virtual_dNdx) + dim * (s + 1), std::cbegin(point_dof) + num_dof,
+                                std::cend(point_dof), dDotdDOF, dDotdDOF, dDotdDOF, std::begin(block.result),
+                                std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                                std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                                std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                                std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                                std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                                std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                        TARDIGRADE_ERROR_TOOLS_CATCH(addPointJacobianProduct(
+                            block, s, std::cbegin(point_x), std::cend(point_x),
+                            std::begin(point_product) + num_rows * t, std::begin(point_product) + num_rows * (t + 1)));
+                    }
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::integrateElementResidual<dim, num_dof, num_rows, num_virtual>(
+                        std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_product),
+                        std::cend(point_product), temperature_offset, Jxw, product_begin, product_end)));
+            }
+        }
+
+        /*!
+         * Compute the product of the Jacobian of the balance of volume fraction of an element and a vector without
+         * forming the Jacobian. The product is added to the rows of the volume fraction field of the node-major element
+         * product. The arguments and the material model are the same as those of the Jacobian overload of
+         * meshAssembly::computeElementBalanceOfVolumeFraction which this function reproduces the product of.
+         *
+         * The balance of volume fraction does not depend on the gradient of the test function so the chain-rule kernel
+         * is only evaluated for the virtual test function \f$ (1, 0) \f$ and the virtual trial functions \f$ (1, 0) \f$
+         * and \f$ (0, e_k) \f$ at each integration point and the results are contracted with the interpolated vector
+         * and its gradient.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * mass_change_rate_index: The index of the material response vector where the mass change rate is located
+         * trace_mass_change_velocity_gradient_index: The index of the material response vector where the trace of the
+         * mass change velocity gradient is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &rest_density_begin: The starting iterator of the rest densities of the phases
+         * \param &rest_density_end: The stopping iterator of the rest densities of the phases
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param &x_begin: The starting iterator of the node-major element vector
+         * \param &x_end: The stopping iterator of the node-major element vector
+         * \param product_begin: The starting iterator of the node-major element product
+         * \param product_end: The stopping iterator of the node-major element product
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class rest_density_iter, typename dDotdDOF_type, class material_model, class x_iter,
+                  class product_iter>
+        void applyElementBalanceOfVolumeFraction(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                 const typename element_configuration::node_in &node_positions_begin,
+                                                 const typename element_configuration::node_in &node_positions_end,
+                                                 const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                 const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                 const rest_density_iter &rest_density_begin,
+                                                 const rest_density_iter &rest_density_end,
+                                                 const dDotdDOF_type &dDotdDOF, material_model &model,
+                                                 const x_iter &x_begin, const x_iter &x_end, product_iter product_begin,
+                                                 product_iter product_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using product_type          = typename std::iterator_traits<product_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == node_count * num_dof,
+                                         "The vector must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(product_end - product_begin) == node_count * num_dof,
+                                         "The product must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            // The vector and its gradient interpolated to the point i.e., the vector contracted with the virtual
+            // interpolation functions
+            std::array<product_type, num_dof * (1 + dim)> point_x;
+
+            // The product of the point Jacobian and the interpolated vector for each virtual test function
+            std::array<product_type, num_rows> point_product;
+
+            meshAssembly::PointJacobianBlock<product_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            meshAssembly::getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N),
+                                                        std::begin(virtual_dNdx), std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getElementPointData(
+                    element, qp, node_positions_begin, node_positions_end, std::begin(N), std::end(N),
+                    std::begin(dNdx), std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), x_begin, x_end,
+                    std::begin(point_x), std::end(point_x)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                        std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof),
+                        std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_product), std::end(point_product), product_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfVolumeFraction::computeBalanceOfVolumeFraction<
+                            dim, material_response_dim, mass_change_rate_index,
+                            trace_mass_change_velocity_gradient_index, num_phase_dof + num_additional_dof>(
+                            std::cbegin(point_dof), std::cbegin(point_dof) + nphases,
+                            std::cbegin(point_dof_dot) + velocity_offset,
+                            std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                            std::cbegin(point_dof) + volume_fraction_offset,
+                            std::cbegin(point_dof) + volume_fraction_offset + nphases,
+                            std::cbegin(point_dof_dot) + volume_fraction_offset,
+                            std::cbegin(point_dof_dot) + volume_fraction_offset + nphases,
+                            std::cbegin(point_dof) + num_dof + dim * volume_fraction_offset,
+                            std::cbegin(point_dof) + num_dof + dim * (volume_fraction_offset + nphases),
+                            std::cbegin(material_response), std::cend(material_response),
+                            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                            rest_density_begin, rest_density_end, virtual_N[0], virtual_N[s],
+                            std::cbegin(virtual_dNdx) + dim * s, std::cbegin(virtual_dNdx) + dim * (s + 1),
+                            std::cbegin(point_dof) + num_dof, std::cend(point_dof), dDotdDOF, dDotdDOF,
+                            std::begin(block.result), std::end(block.result), std::begin(block.dRdRho),
+                            std::end(block.dRdRho), std::begin(block.dRdU), std::end(block.dRdU),
+                            std::begin(block.dRdW), std::end(block.dRdW), std::begin(block.dRdTheta),
+                            std::end(block.dRdTheta), std::begin(block.dRdE), std::end(block.dRdE),
+                            std::begin(block.dRdVolumeFraction), std::end(block.dRdVolumeFraction),
+                            std::begin(block.dRdZ), std::end(block.dRdZ), std::begin(block.dRdUMesh),
+                            std::end(block.dRdUMesh))));
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(addPointJacobianProduct(
+                        block, s, std::cbegin(point_x), std::cend(point_x), std::begin(point_product),
+                        std::end(point_product)));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((meshAssembly::integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_product),
+                    std::cend(point_product), volume_fraction_offset, Jxw, product_begin, product_end)));
+            }
+        }
+
+        /*!
+         * Compute the product of the Jacobian of the internal energy constraint of an element and a vector without
+         * forming the Jacobian. The product is added to the rows of the internal energy field of the node-major element
+         * product. The arguments and the material model are the same as those of the Jacobian overload of
+         * meshAssembly::computeElementInternalEnergyConstraint which this function reproduces the product of.
+         *
+         * The constraint does not depend on the gradient of the test function so the chain-rule kernel is only
+         * evaluated for the virtual test function \f$ (1, 0) \f$ and the virtual trial functions \f$ (1, 0) \f$ and
+         * \f$ (0, e_k) \f$ at each integration point and the results are contracted with the interpolated vector and
+         * its gradient.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * predicted_internal_energy_index: The index of the material response vector where the predicted internal
+         * energy is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param &x_begin: The starting iterator of the node-major element vector
+         * \param &x_end: The stopping iterator of the node-major element vector
+         * \param product_begin: The starting iterator of the node-major element product
+         * \param product_end: The stopping iterator of the node-major element product
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int predicted_internal_energy_index, int material_response_size,
+                  int nphases, int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  typename dDotdDOF_type, class material_model, class x_iter, class product_iter>
+        void applyElementInternalEnergyConstraint(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dDotdDOF_type &dDotdDOF, material_model &model, const x_iter &x_begin, const x_iter &x_end,
+            product_iter product_begin, product_iter product_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using product_type          = typename std::iterator_traits<product_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int internal_energy_offset = nphases * (2 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == node_count * num_dof,
+                                         "The vector must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(product_end - product_begin) == node_count * num_dof,
+                                         "The product must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            // The vector and its gradient interpolated to the point i.e., the vector contracted with the virtual
+            // interpolation functions
+            std::array<product_type, num_dof * (1 + dim)> point_x;
+
+            // The product of the point Jacobian and the interpolated vector for each virtual test function
+            std::array<product_type, num_rows> point_product;
+
+            meshAssembly::PointJacobianBlock<product_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            meshAssembly::getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N),
+                                                        std::begin(virtual_dNdx), std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getElementPointData(
+                    element, qp, node_positions_begin, node_positions_end, std::begin(N), std::end(N),
+                    std::begin(dNdx), std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), x_begin, x_end,
+                    std::begin(point_x), std::end(point_x)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (meshAssembly::setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                        std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof),
+                        std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_product), std::end(point_product), product_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (constraintEquations::computeInternalEnergyConstraint<
+                            material_response_dim, predicted_internal_energy_index,
+                            num_phase_dof + num_additional_dof>(
+                            std::cbegin(point_dof) + internal_energy_offset,
+                            std::cbegin(point_dof) + internal_energy_offset + nphases, std::cbegin(material_response),
+                            std::cend(material_response), std::cbegin(material_response_jacobian),
+                            std::cend(material_response_jacobian), virtual_N[0], virtual_N[s],
+                            std::cbegin(virtual_dNdx) + dim * s, std::cbegin(virtual_dNdx) + dim * (s + 1),
+                            std::cbegin(point_dof) + num_dof, std::cend(point_dof), dDotdDOF, std::begin(block.result),
+                            std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                            std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                            std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                            std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                            std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                            std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(addPointJacobianProduct(
+                        block, s, std::cbegin(point_x), std::cend(point_x), std::begin(point_product),
+                        std::end(point_product)));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((meshAssembly::integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_product),
+                    std::cend(point_product), internal_energy_offset, Jxw, product_begin, product_end)));
+            }
+        }
+
+        /*!
+         * Compute the product of the Jacobian of the displacement constraint of an element and a vector without forming
+         * the Jacobian. The product is added to the rows of the displacement field of the node-major element product.
+         * The arguments are the same as those of the Jacobian overload of
+         * meshAssembly::computeElementDisplacementConstraint which this function reproduces the product of.
+         *
+         * The constraint does not depend on the gradient of the test function so the chain-rule kernel is only
+         * evaluated for the virtual test function \f$ (1, 0) \f$ and the virtual trial functions \f$ (1, 0) \f$ and
+         * \f$ (0, e_k) \f$ at each integration point and the results are contracted with the interpolated vector and
+         * its gradient.
+         *
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &x_begin: The starting iterator of the node-major element vector
+         * \param &x_end: The stopping iterator of the node-major element vector
+         * \param product_begin: The starting iterator of the node-major element product
+         * \param product_end: The stopping iterator of the node-major element product
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_dot_iter,
+                  typename dDotdDOF_type, class x_iter, class product_iter>
+        void applyElementDisplacementConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                const typename element_configuration::node_in &node_positions_begin,
+                                                const typename element_configuration::node_in &node_positions_end,
+                                                const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                const dDotdDOF_type &dDotdDOF, const x_iter &x_begin,
+                                                const x_iter &x_end, product_iter product_begin,
+                                                product_iter product_end, const bool configuration) {
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_dot_iter>::value_type;
+            using product_type          = typename std::iterator_traits<product_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases * dim;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int displacement_offset = nphases;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot has a size of " +
+                                             std::to_string((size_type)(dof_dot_end - dof_dot_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == node_count * num_dof,
+                                         "The vector must have the same size as the dof dot")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(product_end - product_begin) == node_count * num_dof,
+                                         "The product must have the same size as the dof dot")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The rates of the degrees of freedom at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof_dot;
+
+            // The vector and its gradient interpolated to the point i.e., the vector contracted with the virtual
+            // interpolation functions
+            std::array<product_type, num_dof * (1 + dim)> point_x;
+
+            // The product of the point Jacobian and the interpolated vector for each virtual test function
+            std::array<product_type, num_rows> point_product;
+
+            std::array<product_type, num_rows> dRdD, dRdV;
+
+            std::array<product_type, num_rows * dim> dRdUMesh;
+
+            // Only the diagonals of the derivatives w.r.t. the displacement and velocity are set below
+            meshAssembly::PointJacobianBlock<product_type, dim, nphases, num_additional_dof, num_rows> block{};
+
+            node_value_type Jxw;
+
+            meshAssembly::getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N),
+                                                        std::begin(virtual_dNdx), std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::getElementPointData(
+                    element, qp, node_positions_begin, node_positions_end, std::begin(N), std::end(N),
+                    std::begin(dNdx), std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), x_begin, x_end,
+                    std::begin(point_x), std::end(point_x)));
+
+                std::fill(std::begin(point_product), std::end(point_product), product_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH((constraintEquations::computeDisplacementConstraint<dim>(
+                        std::cbegin(point_dof_dot) + displacement_offset,
+                        std::cbegin(point_dof_dot) + displacement_offset + num_rows,
+                        std::cbegin(point_dof_dot) + velocity_offset,
+                        std::cbegin(point_dof_dot) + velocity_offset + num_rows, virtual_N[0], virtual_N[s],
+                        std::cbegin(virtual_dNdx) + dim * s, std::cbegin(virtual_dNdx) + dim * (s + 1), dDotdDOF,
+                        std::begin(block.result), std::end(block.result), std::begin(dRdD), std::end(dRdD),
+                        std::begin(dRdV), std::end(dRdV), std::begin(dRdUMesh), std::end(dRdUMesh))));
+
+                    // The velocity is the rate of the spatial degree of freedom
+                    for (unsigned int r = 0; r < num_rows; ++r) {
+                        block.dRdW[num_rows * r + r] = dRdD[r];
+
+                        block.dRdU[num_rows * r + r] = dRdV[r] * dDotdDOF;
+                    }
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(addPointJacobianProduct(
+                        block, s, std::cbegin(point_x), std::cend(point_x), std::begin(point_product),
+                        std::end(point_product)));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((meshAssembly::integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_product),
+                    std::cend(point_product), displacement_offset, Jxw, product_begin, product_end)));
+            }
+        }
+
+    }  // namespace matrixFree
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_mesh_assembly.cpp
+ ******************************************************************************
+ * The source file for the mesh-level assembly of the balance equations
+ ******************************************************************************
+ */
+
+#include "tardigrade_mesh_assembly.h"
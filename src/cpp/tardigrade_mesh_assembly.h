@@ -0,0 +1,589 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_mesh_assembly.h
+ ******************************************************************************
+ * The header file for the mesh-level assembly of the balance equations. A
+ * mesh is described by its element connectivity and the degrees of freedom
+ * are numbered node-major where the degrees of freedom of a node follow the
+ * layout of the material response dof vector i.e., the density,
+ * displacement, velocity, temperature, internal energy, and volume fraction
+ * of each phase followed by the additional degrees of freedom. Element
+ * contributions are computed by an element kernel and scattered into a
+ * global residual vector and a compressed sparse row (CSR) Jacobian. The
+ * element integrators of the balance equations each fill the rows of one
+ * field and evaluate the chain-rule kernels for the virtual shape functions
+ * (1, 0) and (0, e_k) at each integration point which are contracted with the
+ * shape functions of the nodes.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_MESH_ASSEMBLY_H
+#define TARDIGRADE_MESH_ASSEMBLY_H
+
+#include <array>
+#include <vector>
+
+#include "tardigrade_FiniteElementBase.h"
+#include "tardigrade_balance_of_energy.h"
+#include "tardigrade_balance_of_linear_momentum.h"
+#include "tardigrade_balance_of_mass.h"
+#include "tardigrade_balance_of_volume_fraction.h"
+#include "tardigrade_constraint_equations.h"
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace meshAssembly {
+
+        typedef finiteElement::size_type size_type;  //!< Define the size type to be the same as the finite elements
+
+        typedef finiteElement::floatType floatType;  //!< Define the float type to be the same as the finite elements
+
+        /*!
+         * The fields of the degrees of freedom of a node. The order is the order of the fields in the material response
+         * dof vector.
+         */
+        enum Field : unsigned int {
+            DENSITY         = 0,  //!< The density of each phase
+            DISPLACEMENT    = 1,  //!< The displacement of each phase
+            VELOCITY        = 2,  //!< The spatial degree of freedom of each phase whose rate is the velocity
+            TEMPERATURE     = 3,  //!< The temperature of each phase
+            INTERNAL_ENERGY = 4,  //!< The internal energy of each phase
+            VOLUME_FRACTION = 5,  //!< The volume fraction of each phase
+            ADDITIONAL_DOF  = 6   //!< The additional degrees of freedom which are shared by all of the phases
+        };
+
+        constexpr unsigned int num_fields = 7;  //!< The number of fields
+
+        /*!
+         * The connectivity of a mesh of a single element type
+         */
+        class MeshConnectivity {
+           public:
+            /*!
+             * Default constructor
+             */
+            MeshConnectivity() : _num_nodes(0), _nodes_per_element(1), _connectivity() {}
+
+            template <class connectivity_iter>
+            MeshConnectivity(const size_type num_nodes, const size_type nodes_per_element,
+                             const connectivity_iter &connectivity_begin, const connectivity_iter &connectivity_end);
+
+            //! Get the number of nodes of the mesh
+            size_type getNumNodes() const { return _num_nodes; }
+
+            //! Get the number of nodes of each element
+            size_type getNodesPerElement() const { return _nodes_per_element; }
+
+            //! Get the number of elements of the mesh
+            size_type getNumElements() const { return (size_type)_connectivity.size() / _nodes_per_element; }
+
+            //! Get the flattened element-major connectivity
+            const std::vector<size_type> &getConnectivity() const { return _connectivity; }
+
+            /*!
+             * Get the starting iterator of the nodes of an element
+             *
+             * \param element: The element
+             */
+            std::vector<size_type>::const_iterator getElementNodesBegin(const size_type element) const {
+                return std::cbegin(_connectivity) + _nodes_per_element * element;
+            }
+
+            /*!
+             * Get the stopping iterator of the nodes of an element
+             *
+             * \param element: The element
+             */
+            std::vector<size_type>::const_iterator getElementNodesEnd(const size_type element) const {
+                return std::cbegin(_connectivity) + _nodes_per_element * (element + 1);
+            }
+
+           protected:
+            size_type _num_nodes;  //!< The number of nodes
+
+            size_type _nodes_per_element;  //!< The number of nodes of each element
+
+            std::vector<size_type> _connectivity;  //!< The element-major connectivity
+        };
+
+        /*!
+         * The node-major numbering of the degrees of freedom of a mesh
+         */
+        class DofNumbering {
+           public:
+            inline DofNumbering(const size_type num_nodes, const size_type dim, const size_type nphases,
+                                const size_type num_additional_dof);
+
+            //! Get the number of nodes
+            size_type getNumNodes() const { return _num_nodes; }
+
+            //! Get the spatial dimension
+            size_type getDim() const { return _dim; }
+
+            //! Get the number of phases
+            size_type getNumPhases() const { return _nphases; }
+
+            //! Get the number of additional degrees of freedom
+            size_type getNumAdditionalDOF() const { return _num_additional_dof; }
+
+            //! Get the number of degrees of freedom of each node
+            size_type getNumNodeDOF() const { return _nphases * (4 + 2 * _dim) + _num_additional_dof; }
+
+            //! Get the total number of degrees of freedom
+            size_type getNumDOF() const { return _num_nodes * getNumNodeDOF(); }
+
+            inline size_type getFieldWidth(const Field field) const;
+
+            inline size_type getFieldOffset(const Field field) const;
+
+            inline size_type getLocalDOF(const Field field, const size_type phase,
+                                         const size_type component = 0) const;
+
+            inline size_type getGlobalDOF(const size_type node, const Field field, const size_type phase,
+                                          const size_type component = 0) const;
+
+           protected:
+            size_type _num_nodes;  //!< The number of nodes
+
+            size_type _dim;  //!< The spatial dimension
+
+            size_type _nphases;  //!< The number of phases
+
+            size_type _num_additional_dof;  //!< The number of additional degrees of freedom
+        };
+
+        /*!
+         * A compressed sparse row (CSR) matrix. The column indices of each row are sorted.
+         */
+        template <typename T>
+        class CSRMatrix {
+           public:
+            //! The type of the values
+            using value_type = T;
+
+            /*!
+             * Default constructor
+             */
+            CSRMatrix() : _num_rows(0), _num_columns(0), _row_offsets(1, 0), _column_indices(), _values() {}
+
+            template <class row_offset_iter, class column_index_iter>
+            CSRMatrix(const size_type num_rows, const size_type num_columns, const row_offset_iter &row_offsets_begin,
+                      const row_offset_iter &row_offsets_end, const column_index_iter &column_indices_begin,
+                      const column_index_iter &column_indices_end);
+
+            //! Get the number of rows
+            size_type getNumRows() const { return _num_rows; }
+
+            //! Get the number of columns
+            size_type getNumColumns() const { return _num_columns; }
+
+            //! Get the number of stored entries
+            size_type getNumNonZeros() const { return (size_type)_column_indices.size(); }
+
+            //! Get the offsets of the rows into the column indices and values
+            const std::vector<size_type> &getRowOffsets() const { return _row_offsets; }
+
+            //! Get the column indices
+            const std::vector<size_type> &getColumnIndices() const { return _column_indices; }
+
+            //! Get the values
+            const std::vector<T> &getValues() const { return _values; }
+
+            //! Get a mutable reference to the values
+            std::vector<T> &getValues() { return _values; }
+
+            void setZero();
+
+            size_type findEntry(const size_type row, const size_type column) const;
+
+            void addValue(const size_type row, const size_type column, const T &value);
+
+            template <class x_iter, class y_iter>
+            void multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin, y_iter y_end) const;
+
+           protected:
+            size_type _num_rows;  //!< The number of rows
+
+            size_type _num_columns;  //!< The number of columns
+
+            std::vector<size_type> _row_offsets;  //!< The offsets of the rows
+
+            std::vector<size_type> _column_indices;  //!< The sorted column indices of each row
+
+            std::vector<T> _values;  //!< The values of the stored entries
+        };
+
+        /*!
+         * The precomputed positions of the entries of the element residuals and Jacobians in a global residual and CSR
+         * Jacobian. The map is built once for a mesh so that the numeric assembly of every Newton iteration is an
+         * indexed add without searching the rows of the Jacobian. The map stores one offset for each entry of each
+         * element Jacobian.
+         */
+        class ScatterMap {
+           public:
+            /*!
+             * Default constructor
+             */
+            ScatterMap() : _num_element_dof(0), _num_non_zeros(0), _element_dof(), _element_offsets() {}
+
+            template <typename T>
+            ScatterMap(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                       const CSRMatrix<T> &jacobian);
+
+            //! Get the number of elements
+            size_type getNumElements() const {
+                return (_num_element_dof == 0) ? 0 : (size_type)_element_dof.size() / _num_element_dof;
+            }
+
+            //! Get the number of degrees of freedom of each element
+            size_type getNumElementDOF() const { return _num_element_dof; }
+
+            //! Get the number of stored entries of the Jacobian the map was built for
+            size_type getNumNonZeros() const { return _num_non_zeros; }
+
+            /*!
+             * Get the starting iterator of the global degrees of freedom of an element
+             *
+             * \param element: The element
+             */
+            std::vector<size_type>::const_iterator getElementDOFBegin(const size_type element) const {
+                return std::cbegin(_element_dof) + _num_element_dof * element;
+            }
+
+            /*!
+             * Get the stopping iterator of the global degrees of freedom of an element
+             *
+             * \param element: The element
+             */
+            std::vector<size_type>::const_iterator getElementDOFEnd(const size_type element) const {
+                return std::cbegin(_element_dof) + _num_element_dof * (element + 1);
+            }
+
+            /*!
+             * Get the starting iterator of the row-major Jacobian value offsets of an element
+             *
+             * \param element: The element
+             */
+            std::vector<size_type>::const_iterator getElementOffsetsBegin(const size_type element) const {
+                return std::cbegin(_element_offsets) + _num_element_dof * _num_element_dof * element;
+            }
+
+            /*!
+             * Get the stopping iterator of the row-major Jacobian value offsets of an element
+             *
+             * \param element: The element
+             */
+            std::vector<size_type>::const_iterator getElementOffsetsEnd(const size_type element) const {
+                return std::cbegin(_element_offsets) + _num_element_dof * _num_element_dof * (element + 1);
+            }
+
+           protected:
+            size_type _num_element_dof;  //!< The number of degrees of freedom of each element
+
+            size_type _num_non_zeros;  //!< The number of stored entries of the Jacobian
+
+            std::vector<size_type> _element_dof;  //!< The global degrees of freedom of each element
+
+            std::vector<size_type> _element_offsets;  //!< The Jacobian value offsets of each element
+        };
+
+        /*!
+         * The value and the derivatives of num_rows rows of a balance equation at an integration point as returned by
+         * the chain-rule kernels of the balance equations. The columns of each derivative are the phases (or the
+         * components of the phases) of one field.
+         */
+        template <typename T, int dim, int nphases, int num_additional_dof, int num_rows>
+        struct PointJacobianBlock {
+            static constexpr unsigned int num_dof =
+                nphases * (4 + 2 * dim) + num_additional_dof;  //!< The number of degrees of freedom of a node
+
+            std::array<T, num_rows> result;  //!< The value of the rows
+
+            std::array<T, num_rows * nphases> dRdRho;  //!< The derivative w.r.t. the density
+
+            std::array<T, num_rows * nphases * dim> dRdU;  //!< The derivative w.r.t. the spatial degree of freedom
+
+            std::array<T, num_rows * nphases * dim> dRdW;  //!< The derivative w.r.t. the displacement
+
+            std::array<T, num_rows * nphases> dRdTheta;  //!< The derivative w.r.t. the temperature
+
+            std::array<T, num_rows * nphases> dRdE;  //!< The derivative w.r.t. the internal energy
+
+            std::array<T, num_rows * nphases> dRdVolumeFraction;  //!< The derivative w.r.t. the volume fraction
+
+            std::array<T, num_rows * num_additional_dof> dRdZ;  //!< The derivative w.r.t. the additional dof
+
+            std::array<T, num_rows * dim> dRdUMesh;  //!< The derivative w.r.t. the mesh displacement (not assembled)
+
+            template <class point_jacobian_iter>
+            void addTo(point_jacobian_iter point_jacobian_begin, point_jacobian_iter point_jacobian_end) const;
+        };
+
+        template <class element_type>
+        MeshConnectivity generateHexBlock(const size_type nx, const size_type ny, const size_type nz,
+                                          const floatType length_x, const floatType length_y,
+                                          const floatType length_z, std::vector<floatType> &coordinates);
+
+        inline void getNodeAdjacency(const MeshConnectivity &connectivity, std::vector<size_type> &adjacency_offsets,
+                                     std::vector<size_type> &adjacency);
+
+        template <typename T>
+        CSRMatrix<T> buildCSRMatrix(const MeshConnectivity &connectivity, const DofNumbering &numbering);
+
+        template <typename T>
+        CSRMatrix<T> buildCSRMatrix(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                    ScatterMap &scatter_map);
+
+        template <class global_iter, class element_iter>
+        void gatherElement(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                           const size_type element, const global_iter &global_begin, const global_iter &global_end,
+                           element_iter element_begin, element_iter element_end);
+
+        template <class element_residual_iter, class residual_iter>
+        void scatterElementResidual(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                    const size_type element, const element_residual_iter &element_residual_begin,
+                                    const element_residual_iter &element_residual_end, residual_iter residual_begin,
+                                    residual_iter residual_end);
+
+        template <typename T, class element_jacobian_iter>
+        void scatterElementJacobian(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                    const size_type element, const element_jacobian_iter &element_jacobian_begin,
+                                    const element_jacobian_iter &element_jacobian_end, CSRMatrix<T> &jacobian);
+
+        template <class element_residual_iter, class residual_iter>
+        void scatterElementResidual(const ScatterMap &scatter_map, const size_type element,
+                                    const element_residual_iter &element_residual_begin,
+                                    const element_residual_iter &element_residual_end, residual_iter residual_begin,
+                                    residual_iter residual_end);
+
+        template <typename T, class element_jacobian_iter>
+        void scatterElementJacobian(const ScatterMap &scatter_map, const size_type element,
+                                    const element_jacobian_iter &element_jacobian_begin,
+                                    const element_jacobian_iter &element_jacobian_end, CSRMatrix<T> &jacobian);
+
+        template <class element_kernel, class residual_iter>
+        void assembleResidual(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                              element_kernel &kernel, residual_iter residual_begin, residual_iter residual_end);
+
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                         element_kernel &kernel, residual_iter residual_begin,
+                                         residual_iter residual_end, CSRMatrix<T> &jacobian);
+
+        template <class element_kernel, class residual_iter>
+        void assembleResidual(const ScatterMap &scatter_map, element_kernel &kernel, residual_iter residual_begin,
+                              residual_iter residual_end);
+
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const ScatterMap &scatter_map, element_kernel &kernel,
+                                         residual_iter residual_begin, residual_iter residual_end,
+                                         CSRMatrix<T> &jacobian);
+
+        template <class element_configuration>
+        void getElementPointData(finiteElement::FiniteElementBase<element_configuration> &element,
+                                 const unsigned int                                       qp,
+                                 const typename element_configuration::node_in           &node_positions_begin,
+                                 const typename element_configuration::node_in           &node_positions_end,
+                                 typename element_configuration::shape_functions_out      N_begin,
+                                 typename element_configuration::shape_functions_out      N_end,
+                                 typename element_configuration::grad_shape_functions_out dNdx_begin,
+                                 typename element_configuration::grad_shape_functions_out dNdx_end,
+                                 typename element_configuration::node_value_type &Jxw, const bool configuration);
+
+        template <int dim, class shape_function_iter, class shape_function_gradient_iter, class value_iter,
+                  class point_iter>
+        void interpolateElementValues(const shape_function_iter &N_begin, const shape_function_iter &N_end,
+                                      const shape_function_gradient_iter &dNdx_begin,
+                                      const shape_function_gradient_iter &dNdx_end, const value_iter &values_begin,
+                                      const value_iter &values_end, point_iter point_begin, point_iter point_end);
+
+        template <int dim, int nphases, int num_additional_dof, class point_dof_dot_iter, class point_dof_iter>
+        void setMaterialResponseVelocity(const point_dof_dot_iter &point_dof_dot_begin,
+                                         const point_dof_dot_iter &point_dof_dot_end, point_dof_iter point_dof_begin,
+                                         point_dof_iter point_dof_end);
+
+        template <int dim, class virtual_shape_function_iter, class virtual_shape_function_gradient_iter>
+        void getVirtualShapeFunctions(virtual_shape_function_iter          virtual_N_begin,
+                                      virtual_shape_function_iter          virtual_N_end,
+                                      virtual_shape_function_gradient_iter virtual_dNdx_begin,
+                                      virtual_shape_function_gradient_iter virtual_dNdx_end);
+
+        template <int dim, int num_dof, int num_rows, int num_test_functions, class shape_function_iter,
+                  class shape_function_gradient_iter, class point_residual_iter, typename Jxw_type,
+                  class residual_iter>
+        void integrateElementResidual(const shape_function_iter &N_begin, const shape_function_iter &N_end,
+                                      const shape_function_gradient_iter &dNdx_begin,
+                                      const shape_function_gradient_iter &dNdx_end,
+                                      const point_residual_iter &point_residual_begin,
+                                      const point_residual_iter &point_residual_end, const unsigned int row_offset,
+                                      const Jxw_type &Jxw, residual_iter residual_begin, residual_iter residual_end);
+
+        template <int dim, int num_dof, int num_rows, int num_test_functions, class shape_function_iter,
+                  class shape_function_gradient_iter, class point_jacobian_iter, typename Jxw_type,
+                  class jacobian_iter>
+        void integrateElementJacobian(const shape_function_iter &N_begin, const shape_function_iter &N_end,
+                                      const shape_function_gradient_iter &dNdx_begin,
+                                      const shape_function_gradient_iter &dNdx_end,
+                                      const point_jacobian_iter &point_jacobian_begin,
+                                      const point_jacobian_iter &point_jacobian_end, const unsigned int row_offset,
+                                      const Jxw_type &Jxw, jacobian_iter jacobian_begin, jacobian_iter jacobian_end);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class dof_ddot_iter,
+                  class material_model, class residual_iter>
+        void computeElementBalanceOfLinearMomentum(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dof_ddot_iter &dof_ddot_begin, const dof_ddot_iter &dof_ddot_end, material_model &model,
+            residual_iter residual_begin, residual_iter residual_end, const bool configuration = true);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class dof_ddot_iter,
+                  typename dDotdDOF_type, typename dDDotdDOF_type, class material_model, class residual_iter,
+                  class jacobian_iter>
+        void computeElementBalanceOfLinearMomentum(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dof_ddot_iter &dof_ddot_begin, const dof_ddot_iter &dof_ddot_end, const dDotdDOF_type &dDotdDOF,
+            const dDDotdDOF_type &dDDotdDOF, material_model &model, residual_iter residual_begin,
+            residual_iter residual_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            const bool configuration = true);
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class material_model, class residual_iter>
+        void computeElementBalanceOfMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                                         const typename element_configuration::node_in &node_positions_begin,
+                                         const typename element_configuration::node_in &node_positions_end,
+                                         const dof_iter &dof_begin, const dof_iter &dof_end,
+                                         const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                         material_model &model, residual_iter residual_begin,
+                                         residual_iter residual_end, const bool configuration = true);
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  typename dDotdDOF_type, class material_model, class residual_iter, class jacobian_iter>
+        void computeElementBalanceOfMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                                         const typename element_configuration::node_in &node_positions_begin,
+                                         const typename element_configuration::node_in &node_positions_end,
+                                         const dof_iter &dof_begin, const dof_iter &dof_end,
+                                         const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                         const dDotdDOF_type &dDotdDOF, material_model &model,
+                                         residual_iter residual_begin, residual_iter residual_end,
+                                         jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                                         const bool configuration = true);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class material_model,
+                  class residual_iter>
+        void computeElementBalanceOfEnergy(finiteElement::FiniteElementBase<element_configuration> &element,
+                                           const typename element_configuration::node_in &node_positions_begin,
+                                           const typename element_configuration::node_in &node_positions_end,
+                                           const dof_iter &dof_begin, const dof_iter &dof_end,
+                                           const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                           material_model &model, residual_iter residual_begin,
+                                           residual_iter residual_end, const bool configuration = true);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, typename dDotdDOF_type,
+                  class material_model, class residual_iter, class jacobian_iter>
+        void computeElementBalanceOfEnergy(finiteElement::FiniteElementBase<element_configuration> &element,
+                                           const typename element_configuration::node_in &node_positions_begin,
+                                           const typename element_configuration::node_in &node_positions_end,
+                                           const dof_iter &dof_begin, const dof_iter &dof_end,
+                                           const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                           const dDotdDOF_type &dDotdDOF, material_model &model,
+                                           residual_iter residual_begin, residual_iter residual_end,
+                                           jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                                           const bool configuration = true);
+
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class rest_density_iter, class material_model, class residual_iter>
+        void computeElementBalanceOfVolumeFraction(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const rest_density_iter &rest_density_begin, const rest_density_iter &rest_density_end,
+            material_model &model, residual_iter residual_begin, residual_iter residual_end,
+            const bool configuration = true);
+
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class rest_density_iter, typename dDotdDOF_type, class material_model, class residual_iter,
+                  class jacobian_iter>
+        void computeElementBalanceOfVolumeFraction(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const rest_density_iter &rest_density_begin, const rest_density_iter &rest_density_end,
+            const dDotdDOF_type &dDotdDOF, material_model &model, residual_iter residual_begin,
+            residual_iter residual_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            const bool configuration = true);
+
+        template <int dim, int material_response_dim, int predicted_internal_energy_index, int material_response_size,
+                  int nphases, int num_additional_dof, class element_configuration, class dof_iter,
+                  class dof_dot_iter, class material_model, class residual_iter>
+        void computeElementInternalEnergyConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                    const typename element_configuration::node_in &node_positions_begin,
+                                                    const typename element_configuration::node_in &node_positions_end,
+                                                    const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                    const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                    material_model &model, residual_iter residual_begin,
+                                                    residual_iter residual_end, const bool configuration = true);
+
+        template <int dim, int material_response_dim, int predicted_internal_energy_index, int material_response_size,
+                  int nphases, int num_additional_dof, class element_configuration, class dof_iter,
+                  class dof_dot_iter, typename dDotdDOF_type, class material_model, class residual_iter,
+                  class jacobian_iter>
+        void computeElementInternalEnergyConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                    const typename element_configuration::node_in &node_positions_begin,
+                                                    const typename element_configuration::node_in &node_positions_end,
+                                                    const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                    const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                    const dDotdDOF_type &dDotdDOF, material_model &model,
+                                                    residual_iter residual_begin, residual_iter residual_end,
+                                                    jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                                                    const bool configuration = true);
+
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_dot_iter,
+                  class residual_iter>
+        void computeElementDisplacementConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                  const typename element_configuration::node_in &node_positions_begin,
+                                                  const typename element_configuration::node_in &node_positions_end,
+                                                  const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                  residual_iter residual_begin, residual_iter residual_end,
+                                                  const bool configuration = true);
+
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_dot_iter,
+                  typename dDotdDOF_type, class residual_iter, class jacobian_iter>
+        void computeElementDisplacementConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                  const typename element_configuration::node_in &node_positions_begin,
+                                                  const typename element_configuration::node_in &node_positions_end,
+                                                  const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                  const dDotdDOF_type &dDotdDOF, residual_iter residual_begin,
+                                                  residual_iter residual_end, jacobian_iter jacobian_begin,
+                                                  jacobian_iter jacobian_end, const bool configuration = true);
+
+    }  // namespace meshAssembly
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_mesh_assembly.tpp"
+
+#endif
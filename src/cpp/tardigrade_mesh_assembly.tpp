@@ -0,0 +1,3045 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_mesh_assembly.tpp
+ ******************************************************************************
+ * The template file for the mesh-level assembly of the balance equations
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "tardigrade_mesh_assembly.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace meshAssembly {
+
+        /*!
+         * Constructor for the mesh connectivity
+         *
+         * \param num_nodes: The number of nodes of the mesh
+         * \param nodes_per_element: The number of nodes of each element
+         * \param &connectivity_begin: The starting iterator of the element-major connectivity
+         * \param &connectivity_end: The stopping iterator of the element-major connectivity
+         */
+        template <class connectivity_iter>
+        MeshConnectivity::MeshConnectivity(const size_type num_nodes, const size_type nodes_per_element,
+                                           const connectivity_iter &connectivity_begin,
+                                           const connectivity_iter &connectivity_end)
+            : _num_nodes(num_nodes), _nodes_per_element(nodes_per_element), _connectivity(connectivity_begin,
+                                                                                          connectivity_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(nodes_per_element > 0, "The elements must have at least one node")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(_connectivity.size() % nodes_per_element == 0,
+                                         "The connectivity has a size of " + std::to_string(_connectivity.size()) +
+                                             " which is not a multiple of the number of nodes per element " +
+                                             std::to_string(nodes_per_element))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                std::all_of(std::cbegin(_connectivity), std::cend(_connectivity),
+                            [&](const size_type node) { return node < num_nodes; }),
+                "The connectivity refers to a node which is not less than the number of nodes")
+        }
+
+        /*!
+         * Constructor for the numbering of the degrees of freedom
+         *
+         * \param num_nodes: The number of nodes
+         * \param dim: The spatial dimension
+         * \param nphases: The number of phases
+         * \param num_additional_dof: The number of additional degrees of freedom
+         */
+        DofNumbering::DofNumbering(const size_type num_nodes, const size_type dim, const size_type nphases,
+                                   const size_type num_additional_dof)
+            : _num_nodes(num_nodes), _dim(dim), _nphases(nphases), _num_additional_dof(num_additional_dof) {}
+
+        /*!
+         * Get the number of degrees of freedom of a field for a single phase. The width of the additional degrees of
+         * freedom is the number of additional degrees of freedom.
+         *
+         * \param field: The field
+         */
+        size_type DofNumbering::getFieldWidth(const Field field) const {
+            return (field == ADDITIONAL_DOF)                          ? _num_additional_dof
+                   : ((field == DISPLACEMENT) || (field == VELOCITY)) ? _dim
+                                                                      : 1;
+        }
+
+        /*!
+         * Get the offset of a field in the degrees of freedom of a node
+         *
+         * \param field: The field
+         */
+        size_type DofNumbering::getFieldOffset(const Field field) const {
+            size_type offset = 0;
+
+            for (unsigned int f = 0; f < field; ++f) {
+                offset += _nphases * getFieldWidth(static_cast<Field>(f));
+            }
+
+            return offset;
+        }
+
+        /*!
+         * Get the index of a degree of freedom in the degrees of freedom of a node
+         *
+         * \param field: The field
+         * \param phase: The phase (ignored for the additional degrees of freedom)
+         * \param component: The component of the field
+         */
+        size_type DofNumbering::getLocalDOF(const Field field, const size_type phase, const size_type component) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK(component < getFieldWidth(field),
+                                         "The component " + std::to_string(component) +
+                                             " is not less than the width of the field " +
+                                             std::to_string(getFieldWidth(field)))
+
+            if (field == ADDITIONAL_DOF) {
+                return getFieldOffset(field) + component;
+            }
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(phase < _nphases, "The phase " + std::to_string(phase) +
+                                                               " is not less than the number of phases " +
+                                                               std::to_string(_nphases))
+
+            return getFieldOffset(field) + getFieldWidth(field) * phase + component;
+        }
+
+        /*!
+         * Get the index of a degree of freedom in the global degree of freedom vector
+         *
+         * \param node: The node
+         * \param field: The field
+         * \param phase: The phase (ignored for the additional degrees of freedom)
+         * \param component: The component of the field
+         */
+        size_type DofNumbering::getGlobalDOF(const size_type node, const Field field, const size_type phase,
+                                             const size_type component) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK(node < _num_nodes, "The node " + std::to_string(node) +
+                                                                " is not less than the number of nodes " +
+                                                                std::to_string(_num_nodes))
+
+            return getNumNodeDOF() * node + getLocalDOF(field, phase, component);
+        }
+
+        /*!
+         * Constructor for the CSR matrix. The values are initialized to zero.
+         *
+         * \param num_rows: The number of rows
+         * \param num_columns: The number of columns
+         * \param &row_offsets_begin: The starting iterator of the row offsets (num_rows + 1 values)
+         * \param &row_offsets_end: The stopping iterator of the row offsets
+         * \param &column_indices_begin: The starting iterator of the column indices which are sorted in each row
+         * \param &column_indices_end: The stopping iterator of the column indices
+         */
+        template <typename T>
+        template <class row_offset_iter, class column_index_iter>
+        CSRMatrix<T>::CSRMatrix(const size_type num_rows, const size_type num_columns,
+                                const row_offset_iter &row_offsets_begin, const row_offset_iter &row_offsets_end,
+                                const column_index_iter &column_indices_begin,
+                                const column_index_iter &column_indices_end)
+            : _num_rows(num_rows),
+              _num_columns(num_columns),
+              _row_offsets(row_offsets_begin, row_offsets_end),
+              _column_indices(column_indices_begin, column_indices_end),
+              _values(_column_indices.size(), T()) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(_row_offsets.size() == num_rows + 1,
+                                         "The row offsets must have a size of the number of rows plus one")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(_row_offsets.back() == _column_indices.size(),
+                                         "The last row offset must be equal to the number of column indices")
+        }
+
+        /*!
+         * Set all of the stored values to zero
+         */
+        template <typename T>
+        void CSRMatrix<T>::setZero() {
+            std::fill(std::begin(_values), std::end(_values), T());
+        }
+
+        /*!
+         * Find the index of an entry in the values. An error is raised if the entry is not stored.
+         *
+         * \param row: The row of the entry
+         * \param column: The column of the entry
+         */
+        template <typename T>
+        size_type CSRMatrix<T>::findEntry(const size_type row, const size_type column) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK(row < _num_rows, "The row " + std::to_string(row) +
+                                                              " is not less than the number of rows " +
+                                                              std::to_string(_num_rows))
+
+            auto row_begin = std::cbegin(_column_indices) + _row_offsets[row];
+            auto row_end   = std::cbegin(_column_indices) + _row_offsets[row + 1];
+
+            auto entry = std::lower_bound(row_begin, row_end, column);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((entry != row_end) && (*entry == column),
+                                         "The entry (" + std::to_string(row) + ", " + std::to_string(column) +
+                                             ") is not in the sparsity pattern")
+
+            return (size_type)(entry - std::cbegin(_column_indices));
+        }
+
+        /*!
+         * Add a value to a stored entry
+         *
+         * \param row: The row of the entry
+         * \param column: The column of the entry
+         * \param &value: The value to add
+         */
+        template <typename T>
+        void CSRMatrix<T>::addValue(const size_type row, const size_type column, const T &value) {
+            _values[findEntry(row, column)] += value;
+        }
+
+        /*!
+         * Compute the product of the matrix and a vector \f$ y_i = A_{ij} x_j \f$
+         *
+         * \param &x_begin: The starting iterator of the vector
+         * \param &x_end: The stopping iterator of the vector
+         * \param y_begin: The starting iterator of the product
+         * \param y_end: The stopping iterator of the product
+         */
+        template <typename T>
+        template <class x_iter, class y_iter>
+        void CSRMatrix<T>::multiply(const x_iter &x_begin, const x_iter &x_end, y_iter y_begin, y_iter y_end) const {
+            using y_type = typename std::iterator_traits<y_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(x_end - x_begin) == _num_columns,
+                                         "The vector must have a size equal to the number of columns")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(y_end - y_begin) == _num_rows,
+                                         "The product must have a size equal to the number of rows")
+
+            for (size_type row = 0; row < _num_rows; ++row) {
+                y_type sum = y_type();
+
+                for (size_type k = _row_offsets[row]; k < _row_offsets[row + 1]; ++k) {
+                    sum += _values[k] * (*(x_begin + _column_indices[k]));
+                }
+
+                *(y_begin + row) = sum;
+            }
+        }
+
+        /*!
+         * Constructor for the scatter map which finds the position of every entry of every element Jacobian in the
+         * CSR Jacobian. The Jacobian must have the node-block structure of buildCSRMatrix so that the row of each node
+         * pair is searched once and the offsets of the remaining entries of the block follow from the row offsets.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &jacobian: The global Jacobian the element Jacobians will be scattered into
+         */
+        template <typename T>
+        ScatterMap::ScatterMap(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                               const CSRMatrix<T> &jacobian)
+            : _num_element_dof(connectivity.getNodesPerElement() * numbering.getNumNodeDOF()),
+              _num_non_zeros(jacobian.getNumNonZeros()) {
+            const size_type num_node_dof      = numbering.getNumNodeDOF();
+            const size_type nodes_per_element = connectivity.getNodesPerElement();
+            const size_type num_elements      = connectivity.getNumElements();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(jacobian.getNumRows() == numbering.getNumDOF(),
+                                         "The Jacobian must have a number of rows equal to the number of dof")
+
+            const std::vector<size_type> &row_offsets    = jacobian.getRowOffsets();
+            const std::vector<size_type> &column_indices = jacobian.getColumnIndices();
+
+            _element_dof.resize(num_elements * _num_element_dof);
+
+            _element_offsets.resize(num_elements * _num_element_dof * _num_element_dof);
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                auto nodes = connectivity.getElementNodesBegin(e);
+
+                auto element_dof = std::begin(_element_dof) + _num_element_dof * e;
+
+                auto element_offsets = std::begin(_element_offsets) + _num_element_dof * _num_element_dof * e;
+
+                for (size_type a = 0; a < nodes_per_element; ++a) {
+                    const size_type first_row = num_node_dof * (*(nodes + a));
+
+                    for (size_type i = 0; i < num_node_dof; ++i) {
+                        *(element_dof + num_node_dof * a + i) = first_row + i;
+                    }
+
+                    for (size_type b = 0; b < nodes_per_element; ++b) {
+                        const size_type first_column = num_node_dof * (*(nodes + b));
+
+                        size_type relative_offset;
+
+                        TARDIGRADE_ERROR_TOOLS_CATCH(relative_offset = jacobian.findEntry(first_row, first_column) -
+                                                                       row_offsets[first_row]);
+
+                        TARDIGRADE_ERROR_TOOLS_CHECK(
+                            column_indices[row_offsets[first_row] + relative_offset + num_node_dof - 1] ==
+                                first_column + num_node_dof - 1,
+                            "The Jacobian does not store the full block of a node pair")
+
+                        for (size_type i = 0; i < num_node_dof; ++i) {
+                            auto offsets = element_offsets + _num_element_dof * (num_node_dof * a + i) +
+                                           num_node_dof * b;
+
+                            for (size_type j = 0; j < num_node_dof; ++j) {
+                                *(offsets + j) = row_offsets[first_row + i] + relative_offset + j;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Generate a structured block of hexahedral elements. The nodes of the elements are placed on a lattice with
+         * two lattice spacings per element so that both the linear and quadratic hex elements can be generated from
+         * their local nodes. Lattice points which are not a node of any element (e.g., the face centers of the
+         * serendipity QuadraticHex) are not numbered.
+         *
+         * \param nx: The number of elements in the x direction
+         * \param ny: The number of elements in the y direction
+         * \param nz: The number of elements in the z direction
+         * \param length_x: The length of the block in the x direction
+         * \param length_y: The length of the block in the y direction
+         * \param length_z: The length of the block in the z direction
+         * \param &coordinates: The node-major coordinates of the nodes
+         */
+        template <class element_type>
+        MeshConnectivity generateHexBlock(const size_type nx, const size_type ny, const size_type nz,
+                                          const floatType length_x, const floatType length_y,
+                                          const floatType length_z, std::vector<floatType> &coordinates) {
+            constexpr size_type node_count = (size_type)element_type::local_nodes.size() / 3;
+
+            const size_type lx = 2 * nx + 1;
+            const size_type ly = 2 * ny + 1;
+            const size_type lz = 2 * nz + 1;
+
+            const size_type num_elements = nx * ny * nz;
+
+            auto lattice_index = [&](const size_type e, const size_type a) {
+                const size_type i = e % nx;
+                const size_type j = (e / nx) % ny;
+                const size_type k = e / (nx * ny);
+
+                const size_type li = 2 * i + 1 + (int)std::lround(element_type::local_nodes[3 * a + 0]);
+                const size_type lj = 2 * j + 1 + (int)std::lround(element_type::local_nodes[3 * a + 1]);
+                const size_type lk = 2 * k + 1 + (int)std::lround(element_type::local_nodes[3 * a + 2]);
+
+                return li + lx * (lj + ly * lk);
+            };
+
+            // Number the lattice points which are used in lattice order
+            std::vector<size_type> lattice_node(lx * ly * lz, 0);
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                for (size_type a = 0; a < node_count; ++a) {
+                    lattice_node[lattice_index(e, a)] = 1;
+                }
+            }
+
+            size_type num_nodes = 0;
+
+            coordinates.clear();
+
+            for (size_type l = 0; l < lattice_node.size(); ++l) {
+                if (lattice_node[l] == 0) {
+                    continue;
+                }
+
+                lattice_node[l] = num_nodes++;
+
+                coordinates.push_back(0.5 * length_x * (l % lx) / nx);
+                coordinates.push_back(0.5 * length_y * ((l / lx) % ly) / ny);
+                coordinates.push_back(0.5 * length_z * (l / (lx * ly)) / nz);
+            }
+
+            std::vector<size_type> connectivity(num_elements * node_count);
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                for (size_type a = 0; a < node_count; ++a) {
+                    connectivity[node_count * e + a] = lattice_node[lattice_index(e, a)];
+                }
+            }
+
+            return MeshConnectivity(num_nodes, node_count, std::cbegin(connectivity), std::cend(connectivity));
+        }
+
+        /*!
+         * Compute the node-to-node adjacency of a mesh. Two nodes are adjacent if they share an element and every node
+         * is adjacent to itself. The adjacent nodes of each node are sorted.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &adjacency_offsets: The offsets of the adjacent nodes of each node (num_nodes + 1 values)
+         * \param &adjacency: The adjacent nodes of each node
+         */
+        void getNodeAdjacency(const MeshConnectivity &connectivity, std::vector<size_type> &adjacency_offsets,
+                              std::vector<size_type> &adjacency) {
+            const size_type num_nodes         = connectivity.getNumNodes();
+            const size_type num_elements      = connectivity.getNumElements();
+            const size_type nodes_per_element = connectivity.getNodesPerElement();
+
+            // Build the node-to-element map
+            std::vector<size_type> element_offsets(num_nodes + 1, 0);
+
+            for (const auto &node : connectivity.getConnectivity()) {
+                ++element_offsets[node + 1];
+            }
+
+            std::partial_sum(std::begin(element_offsets), std::end(element_offsets), std::begin(element_offsets));
+
+            std::vector<size_type> node_elements(element_offsets.back());
+
+            std::vector<size_type> position(std::cbegin(element_offsets), std::cend(element_offsets) - 1);
+
+            for (size_type e = 0; e < num_elements; ++e) {
+                for (auto node = connectivity.getElementNodesBegin(e); node != connectivity.getElementNodesEnd(e);
+                     ++node) {
+                    node_elements[position[*node]++] = e;
+                }
+            }
+
+            // Collect the nodes of the elements of each node
+            adjacency_offsets.assign(num_nodes + 1, 0);
+
+            adjacency.clear();
+
+            adjacency.reserve(num_nodes * nodes_per_element);
+
+            std::vector<size_type> neighbors;
+
+            for (size_type node = 0; node < num_nodes; ++node) {
+                neighbors.assign(1, node);
+
+                for (size_type k = element_offsets[node]; k < element_offsets[node + 1]; ++k) {
+                    neighbors.insert(std::end(neighbors), connectivity.getElementNodesBegin(node_elements[k]),
+                                     connectivity.getElementNodesEnd(node_elements[k]));
+                }
+
+                std::sort(std::begin(neighbors), std::end(neighbors));
+
+                neighbors.erase(std::unique(std::begin(neighbors), std::end(neighbors)), std::end(neighbors));
+
+                adjacency.insert(std::end(adjacency), std::cbegin(neighbors), std::cend(neighbors));
+
+                adjacency_offsets[node + 1] = (size_type)adjacency.size();
+            }
+        }
+
+        /*!
+         * Build the CSR Jacobian of a mesh. Every degree of freedom of a node is coupled to every degree of freedom of
+         * the adjacent nodes which is the structure of the multiphase material-response Jacobians. The values are
+         * initialized to zero.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         */
+        template <typename T>
+        CSRMatrix<T> buildCSRMatrix(const MeshConnectivity &connectivity, const DofNumbering &numbering) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(connectivity.getNumNodes() == numbering.getNumNodes(),
+                                         "The connectivity and the dof numbering must have the same number of nodes")
+
+            const size_type num_nodes    = connectivity.getNumNodes();
+            const size_type num_node_dof = numbering.getNumNodeDOF();
+
+            std::vector<size_type> adjacency_offsets, adjacency;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(getNodeAdjacency(connectivity, adjacency_offsets, adjacency));
+
+            std::vector<size_type> row_offsets(num_nodes * num_node_dof + 1, 0);
+
+            std::vector<size_type> column_indices;
+
+            column_indices.reserve(adjacency.size() * num_node_dof * num_node_dof);
+
+            for (size_type node = 0; node < num_nodes; ++node) {
+                for (size_type i = 0; i < num_node_dof; ++i) {
+                    for (size_type k = adjacency_offsets[node]; k < adjacency_offsets[node + 1]; ++k) {
+                        for (size_type j = 0; j < num_node_dof; ++j) {
+                            column_indices.push_back(num_node_dof * adjacency[k] + j);
+                        }
+                    }
+
+                    row_offsets[num_node_dof * node + i + 1] = (size_type)column_indices.size();
+                }
+            }
+
+            return CSRMatrix<T>(num_nodes * num_node_dof, num_nodes * num_node_dof, std::cbegin(row_offsets),
+                                std::cend(row_offsets), std::cbegin(column_indices), std::cend(column_indices));
+        }
+
+        /*!
+         * Build the CSR Jacobian of a mesh and the map of the entries of the element Jacobians into it. This is the
+         * symbolic phase of the assembly which only needs to be repeated if the connectivity changes.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &scatter_map: The map of the element residuals and Jacobians into the global system
+         */
+        template <typename T>
+        CSRMatrix<T> buildCSRMatrix(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                    ScatterMap &scatter_map) {
+            CSRMatrix<T> jacobian;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(jacobian = buildCSRMatrix<T>(connectivity, numbering));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(scatter_map = ScatterMap(connectivity, numbering, jacobian));
+
+            return jacobian;
+        }
+
+        /*!
+         * Gather the degrees of freedom of the nodes of an element from a global vector. The element vector is
+         * node-major with the degrees of freedom of each node in the order of the dof numbering.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param element: The element
+         * \param &global_begin: The starting iterator of the global vector
+         * \param &global_end: The stopping iterator of the global vector
+         * \param element_begin: The starting iterator of the element vector
+         * \param element_end: The stopping iterator of the element vector
+         */
+        template <class global_iter, class element_iter>
+        void gatherElement(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                           const size_type element, const global_iter &global_begin, const global_iter &global_end,
+                           element_iter element_begin, element_iter element_end) {
+            const size_type num_node_dof = numbering.getNumNodeDOF();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(global_end - global_begin) == numbering.getNumDOF(),
+                                         "The global vector must have a size equal to the number of dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(element_end - element_begin) == connectivity.getNodesPerElement() * num_node_dof,
+                "The element vector must have a size equal to the number of element dof")
+
+            for (auto node = connectivity.getElementNodesBegin(element);
+                 node != connectivity.getElementNodesEnd(element); ++node, element_begin += num_node_dof) {
+                std::copy(global_begin + num_node_dof * (*node), global_begin + num_node_dof * ((*node) + 1),
+                          element_begin);
+            }
+        }
+
+        /*!
+         * Add the residual of an element to the global residual
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param element: The element
+         * \param &element_residual_begin: The starting iterator of the node-major element residual
+         * \param &element_residual_end: The stopping iterator of the node-major element residual
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         */
+        template <class element_residual_iter, class residual_iter>
+        void scatterElementResidual(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                    const size_type element, const element_residual_iter &element_residual_begin,
+                                    const element_residual_iter &element_residual_end, residual_iter residual_begin,
+                                    residual_iter residual_end) {
+            const size_type num_node_dof = numbering.getNumNodeDOF();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == numbering.getNumDOF(),
+                                         "The residual must have a size equal to the number of dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(element_residual_end - element_residual_begin) ==
+                                             connectivity.getNodesPerElement() * num_node_dof,
+                                         "The element residual must have a size equal to the number of element dof")
+
+            auto element_value = element_residual_begin;
+
+            for (auto node = connectivity.getElementNodesBegin(element);
+                 node != connectivity.getElementNodesEnd(element); ++node) {
+                for (auto value = residual_begin + num_node_dof * (*node);
+                     value != residual_begin + num_node_dof * ((*node) + 1); ++value, ++element_value) {
+                    *value += *element_value;
+                }
+            }
+        }
+
+        /*!
+         * Add the Jacobian of an element to the global CSR Jacobian. The Jacobian must have the node-block structure
+         * of buildCSRMatrix so that the position of the columns of a node pair is found once and shared by all of the
+         * rows of the node.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param element: The element
+         * \param &element_jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param &element_jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param &jacobian: The global Jacobian
+         */
+        template <typename T, class element_jacobian_iter>
+        void scatterElementJacobian(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                    const size_type element, const element_jacobian_iter &element_jacobian_begin,
+                                    const element_jacobian_iter &element_jacobian_end, CSRMatrix<T> &jacobian) {
+            const size_type num_node_dof      = numbering.getNumNodeDOF();
+            const size_type nodes_per_element = connectivity.getNodesPerElement();
+            const size_type num_element_dof   = nodes_per_element * num_node_dof;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(jacobian.getNumRows() == numbering.getNumDOF(),
+                                         "The Jacobian must have a number of rows equal to the number of dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(element_jacobian_end - element_jacobian_begin) == num_element_dof * num_element_dof,
+                "The element Jacobian must have a size equal to the square of the number of element dof")
+
+            const std::vector<size_type> &row_offsets    = jacobian.getRowOffsets();
+            const std::vector<size_type> &column_indices = jacobian.getColumnIndices();
+            std::vector<T>               &values         = jacobian.getValues();
+
+            auto nodes = connectivity.getElementNodesBegin(element);
+
+            for (size_type a = 0; a < nodes_per_element; ++a) {
+                const size_type row_node = *(nodes + a);
+
+                const size_type first_row = num_node_dof * row_node;
+
+                for (size_type b = 0; b < nodes_per_element; ++b) {
+                    const size_type column_node = *(nodes + b);
+
+                    const size_type relative_offset =
+                        jacobian.findEntry(first_row, num_node_dof * column_node) - row_offsets[first_row];
+
+                    TARDIGRADE_ERROR_TOOLS_CHECK(
+                        column_indices[row_offsets[first_row] + relative_offset + num_node_dof - 1] ==
+                            num_node_dof * column_node + num_node_dof - 1,
+                        "The Jacobian does not store the full block of a node pair")
+
+                    for (size_type i = 0; i < num_node_dof; ++i) {
+                        auto element_row = element_jacobian_begin + num_element_dof * (num_node_dof * a + i) +
+                                           num_node_dof * b;
+
+                        auto global_row = std::begin(values) + row_offsets[first_row + i] + relative_offset;
+
+                        for (size_type j = 0; j < num_node_dof; ++j) {
+                            *(global_row + j) += *(element_row + j);
+                        }
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Add the residual of an element to the global residual using a precomputed scatter map
+         *
+         * \param &scatter_map: The map of the element residuals and Jacobians into the global system
+         * \param element: The element
+         * \param &element_residual_begin: The starting iterator of the node-major element residual
+         * \param &element_residual_end: The stopping iterator of the node-major element residual
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         */
+        template <class element_residual_iter, class residual_iter>
+        void scatterElementResidual(const ScatterMap &scatter_map, const size_type element,
+                                    const element_residual_iter &element_residual_begin,
+                                    const element_residual_iter &element_residual_end, residual_iter residual_begin,
+                                    residual_iter residual_end) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(element < scatter_map.getNumElements(),
+                                         "The element must be less than the number of elements of the scatter map")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(element_residual_end - element_residual_begin) == scatter_map.getNumElementDOF(),
+                "The element residual must have a size equal to the number of element dof")
+
+            auto dof = scatter_map.getElementDOFBegin(element);
+
+            for (auto value = element_residual_begin; value != element_residual_end; ++value, ++dof) {
+                *(residual_begin + *dof) += *value;
+            }
+        }
+
+        /*!
+         * Add the Jacobian of an element to the global CSR Jacobian using a precomputed scatter map
+         *
+         * \param &scatter_map: The map of the element residuals and Jacobians into the global system
+         * \param element: The element
+         * \param &element_jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param &element_jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param &jacobian: The global Jacobian the scatter map was built for
+         */
+        template <typename T, class element_jacobian_iter>
+        void scatterElementJacobian(const ScatterMap &scatter_map, const size_type element,
+                                    const element_jacobian_iter &element_jacobian_begin,
+                                    const element_jacobian_iter &element_jacobian_end, CSRMatrix<T> &jacobian) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(element < scatter_map.getNumElements(),
+                                         "The element must be less than the number of elements of the scatter map")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(jacobian.getNumNonZeros() == scatter_map.getNumNonZeros(),
+                                         "The Jacobian must be the Jacobian the scatter map was built for")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(element_jacobian_end - element_jacobian_begin) ==
+                                             scatter_map.getNumElementDOF() * scatter_map.getNumElementDOF(),
+                                         "The element Jacobian must have a size equal to the square of the number of "
+                                         "element dof")
+
+            std::vector<T> &values = jacobian.getValues();
+
+            auto offset = scatter_map.getElementOffsetsBegin(element);
+
+            for (auto value = element_jacobian_begin; value != element_jacobian_end; ++value, ++offset) {
+                values[*offset] += *value;
+            }
+        }
+
+        /*!
+         * Assemble the global residual of a mesh by looping over the elements. The element kernel is called as
+         *
+         * kernel( element, element_residual_begin, element_residual_end )
+         *
+         * and adds the node-major residual of the element to the element residual which is zeroed before each call.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         */
+        template <class element_kernel, class residual_iter>
+        void assembleResidual(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                              element_kernel &kernel, residual_iter residual_begin, residual_iter residual_end) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            const size_type num_element_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+            std::vector<residual_type> element_residual(num_element_dof);
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            for (size_type e = 0; e < connectivity.getNumElements(); ++e) {
+                std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(kernel(e, std::begin(element_residual), std::end(element_residual)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementResidual(connectivity, numbering, e,
+                                                                    std::cbegin(element_residual),
+                                                                    std::cend(element_residual), residual_begin,
+                                                                    residual_end));
+            }
+        }
+
+        /*!
+         * Assemble the global residual and CSR Jacobian of a mesh by looping over the elements. The element kernel is
+         * called as
+         *
+         * kernel( element, element_residual_begin, element_residual_end, element_jacobian_begin, element_jacobian_end )
+         *
+         * and adds the node-major residual and row-major Jacobian of the element to the element arrays which are
+         * zeroed before each call.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the degrees of freedom
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         * \param &jacobian: The global Jacobian from buildCSRMatrix
+         */
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const MeshConnectivity &connectivity, const DofNumbering &numbering,
+                                         element_kernel &kernel, residual_iter residual_begin,
+                                         residual_iter residual_end, CSRMatrix<T> &jacobian) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            const size_type num_element_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+            std::vector<residual_type> element_residual(num_element_dof);
+
+            std::vector<T> element_jacobian(num_element_dof * num_element_dof);
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            jacobian.setZero();
+
+            for (size_type e = 0; e < connectivity.getNumElements(); ++e) {
+                std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                std::fill(std::begin(element_jacobian), std::end(element_jacobian), T());
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(kernel(e, std::begin(element_residual), std::end(element_residual),
+                                                    std::begin(element_jacobian), std::end(element_jacobian)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementResidual(connectivity, numbering, e,
+                                                                    std::cbegin(element_residual),
+                                                                    std::cend(element_residual), residual_begin,
+                                                                    residual_end));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementJacobian(connectivity, numbering, e,
+                                                                    std::cbegin(element_jacobian),
+                                                                    std::cend(element_jacobian), jacobian));
+            }
+        }
+
+        /*!
+         * Assemble the global residual of a mesh using a precomputed scatter map. The element kernel has the interface
+         * of the assembleResidual overload which takes the connectivity.
+         *
+         * \param &scatter_map: The map of the element residuals and Jacobians into the global system
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         */
+        template <class element_kernel, class residual_iter>
+        void assembleResidual(const ScatterMap &scatter_map, element_kernel &kernel, residual_iter residual_begin,
+                              residual_iter residual_end) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            std::vector<residual_type> element_residual(scatter_map.getNumElementDOF());
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            for (size_type e = 0; e < scatter_map.getNumElements(); ++e) {
+                std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(kernel(e, std::begin(element_residual), std::end(element_residual)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementResidual(scatter_map, e, std::cbegin(element_residual),
+                                                                    std::cend(element_residual), residual_begin,
+                                                                    residual_end));
+            }
+        }
+
+        /*!
+         * Assemble the global residual and CSR Jacobian of a mesh using a precomputed scatter map. The element kernel
+         * has the interface of the assembleResidualAndJacobian overload which takes the connectivity. The numeric
+         * assembly only adds the element values to the precomputed positions without searching the Jacobian.
+         *
+         * \param &scatter_map: The map of the element residuals and Jacobians into the global system
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the global residual
+         * \param residual_end: The stopping iterator of the global residual
+         * \param &jacobian: The global Jacobian the scatter map was built for
+         */
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const ScatterMap &scatter_map, element_kernel &kernel,
+                                         residual_iter residual_begin, residual_iter residual_end,
+                                         CSRMatrix<T> &jacobian) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            const size_type num_element_dof = scatter_map.getNumElementDOF();
+
+            std::vector<residual_type> element_residual(num_element_dof);
+
+            std::vector<T> element_jacobian(num_element_dof * num_element_dof);
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            jacobian.setZero();
+
+            for (size_type e = 0; e < scatter_map.getNumElements(); ++e) {
+                std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                std::fill(std::begin(element_jacobian), std::end(element_jacobian), T());
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(kernel(e, std::begin(element_residual), std::end(element_residual),
+                                                    std::begin(element_jacobian), std::end(element_jacobian)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementResidual(scatter_map, e, std::cbegin(element_residual),
+                                                                    std::cend(element_residual), residual_begin,
+                                                                    residual_end));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(scatterElementJacobian(scatter_map, e, std::cbegin(element_jacobian),
+                                                                    std::cend(element_jacobian), jacobian));
+            }
+        }
+
+        /*!
+         * Add the derivatives of the rows to a row-major point Jacobian whose columns are the degrees of freedom of a
+         * node
+         *
+         * \param point_jacobian_begin: The starting iterator of the point Jacobian
+         * \param point_jacobian_end: The stopping iterator of the point Jacobian
+         */
+        template <typename T, int dim, int nphases, int num_additional_dof, int num_rows>
+        template <class point_jacobian_iter>
+        void PointJacobianBlock<T, dim, nphases, num_additional_dof, num_rows>::addTo(
+            point_jacobian_iter point_jacobian_begin, point_jacobian_iter point_jacobian_end) const {
+            // The offsets of the fields in the degrees of freedom of a node
+            constexpr std::array<unsigned int, num_fields> field_offsets = {
+                0, nphases, nphases * (1 + dim), nphases * (1 + 2 * dim), nphases * (2 + 2 * dim),
+                nphases * (3 + 2 * dim), nphases * (4 + 2 * dim)};
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(point_jacobian_end - point_jacobian_begin) == num_rows * num_dof,
+                                         "The point Jacobian must have a size of the number of rows times the number "
+                                         "of dof of a node")
+
+            for (unsigned int r = 0; r < num_rows; ++r) {
+                auto row = point_jacobian_begin + num_dof * r;
+
+                for (unsigned int q = 0; q < nphases; ++q) {
+                    *(row + field_offsets[DENSITY] + q) += dRdRho[nphases * r + q];
+                    *(row + field_offsets[TEMPERATURE] + q) += dRdTheta[nphases * r + q];
+                    *(row + field_offsets[INTERNAL_ENERGY] + q) += dRdE[nphases * r + q];
+                    *(row + field_offsets[VOLUME_FRACTION] + q) += dRdVolumeFraction[nphases * r + q];
+                }
+
+                for (unsigned int k = 0; k < nphases * dim; ++k) {
+                    *(row + field_offsets[DISPLACEMENT] + k) += dRdW[nphases * dim * r + k];
+                    *(row + field_offsets[VELOCITY] + k) += dRdU[nphases * dim * r + k];
+                }
+
+                for (unsigned int z = 0; z < num_additional_dof; ++z) {
+                    *(row + field_offsets[ADDITIONAL_DOF] + z) += dRdZ[num_additional_dof * r + z];
+                }
+            }
+        }
+
+        /*!
+         * Get the shape functions, their spatial gradients, and the product of the Jacobian of the transformation and
+         * the weight of an integration point of an element
+         *
+         * \param &element: The finite element
+         * \param qp: The integration point
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param N_begin: The starting iterator of the shape functions
+         * \param N_end: The stopping iterator of the shape functions
+         * \param dNdx_begin: The starting iterator of the node-major spatial gradients of the shape functions
+         * \param dNdx_end: The stopping iterator of the node-major spatial gradients of the shape functions
+         * \param &Jxw: The Jacobian of the transformation times the weight of the integration point
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <class element_configuration>
+        void getElementPointData(finiteElement::FiniteElementBase<element_configuration> &element,
+                                 const unsigned int                                       qp,
+                                 const typename element_configuration::node_in           &node_positions_begin,
+                                 const typename element_configuration::node_in           &node_positions_end,
+                                 typename element_configuration::shape_functions_out      N_begin,
+                                 typename element_configuration::shape_functions_out      N_end,
+                                 typename element_configuration::grad_shape_functions_out dNdx_begin,
+                                 typename element_configuration::grad_shape_functions_out dNdx_end,
+                                 typename element_configuration::node_value_type &Jxw, const bool configuration) {
+            std::array<typename element_configuration::local_node_value_type, element_configuration::local_dim> xi;
+
+            typename element_configuration::volume_integration_point_weight_value_type weight;
+
+            typename element_configuration::node_value_type J;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(
+                element.GetVolumeIntegrationPointData(qp, std::begin(xi), std::end(xi), weight));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(element.GetShapeFunctions(std::cbegin(xi), std::cend(xi), N_begin, N_end));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(element.GetGlobalShapeFunctionGradients(
+                std::cbegin(xi), std::cend(xi), node_positions_begin, node_positions_end, dNdx_begin, dNdx_end));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(
+                element.GetVolumeIntegralJacobianOfTransformation(std::cbegin(xi), std::cend(xi), J, configuration));
+
+            Jxw = J * weight;
+        }
+
+        /*!
+         * Interpolate node-major values of an element to a point. The point values are in the layout of the material
+         * response dof vector i.e., the values followed by their row-major spatial gradients.
+         *
+         * \param &N_begin: The starting iterator of the shape functions
+         * \param &N_end: The stopping iterator of the shape functions
+         * \param &dNdx_begin: The starting iterator of the node-major spatial gradients of the shape functions
+         * \param &dNdx_end: The stopping iterator of the node-major spatial gradients of the shape functions
+         * \param &values_begin: The starting iterator of the node-major values
+         * \param &values_end: The stopping iterator of the node-major values
+         * \param point_begin: The starting iterator of the values and gradients at the point
+         * \param point_end: The stopping iterator of the values and gradients at the point
+         */
+        template <int dim, class shape_function_iter, class shape_function_gradient_iter, class value_iter,
+                  class point_iter>
+        void interpolateElementValues(const shape_function_iter &N_begin, const shape_function_iter &N_end,
+                                      const shape_function_gradient_iter &dNdx_begin,
+                                      const shape_function_gradient_iter &dNdx_end, const value_iter &values_begin,
+                                      const value_iter &values_end, point_iter point_begin, point_iter point_end) {
+            using point_type = typename std::iterator_traits<point_iter>::value_type;
+
+            const unsigned int node_count = (unsigned int)(N_end - N_begin);
+
+            const unsigned int num_values = (unsigned int)(values_end - values_begin) / node_count;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dNdx_end - dNdx_begin) == dim * node_count,
+                                         "The shape function gradients must have a size of dim times the number of "
+                                         "nodes")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(values_end - values_begin) == node_count * num_values,
+                                         "The values must have a size of an integer multiple of the number of nodes")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(point_end - point_begin) == num_values * (1 + dim),
+                                         "The point values must have a size of the number of values times one plus "
+                                         "dim")
+
+            std::fill(point_begin, point_end, point_type());
+
+            for (unsigned int node = 0; node < node_count; ++node) {
+                for (unsigned int K = 0; K < num_values; ++K) {
+                    const point_type value = *(values_begin + num_values * node + K);
+
+                    *(point_begin + K) += (*(N_begin + node)) * value;
+
+                    for (unsigned int a = 0; a < dim; ++a) {
+                        *(point_begin + num_values + dim * K + a) += (*(dNdx_begin + dim * node + a)) * value;
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Replace the spatial degree of freedom and its gradient in the interpolated degrees of freedom at a point with
+         * its rate i.e., the velocity and the velocity gradient. The material response and the chain-rule kernels
+         * treat the velocity field of the material response dof vector as the velocity so this is the point dof
+         * vector which is passed to the material model.
+         *
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &point_dof_dot_begin: The starting iterator of the rates of the degrees of freedom at the point
+         * followed by their spatial gradients
+         * \param &point_dof_dot_end: The stopping iterator of the rates of the degrees of freedom at the point
+         * followed by their spatial gradients
+         * \param point_dof_begin: The starting iterator of the degrees of freedom at the point followed by their
+         * spatial gradients
+         * \param point_dof_end: The stopping iterator of the degrees of freedom at the point followed by their spatial
+         * gradients
+         */
+        template <int dim, int nphases, int num_additional_dof, class point_dof_dot_iter, class point_dof_iter>
+        void setMaterialResponseVelocity(const point_dof_dot_iter &point_dof_dot_begin,
+                                         const point_dof_dot_iter &point_dof_dot_end, point_dof_iter point_dof_begin,
+                                         point_dof_iter point_dof_end) {
+            constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(point_dof_end - point_dof_begin) == num_dof * (1 + dim),
+                                         "The point dof must have a size of the number of dof times one plus dim")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(point_dof_dot_end - point_dof_dot_begin) == num_dof * (1 + dim),
+                                         "The point dof dot must have the same size as the point dof")
+
+            std::copy(point_dof_dot_begin + velocity_offset, point_dof_dot_begin + velocity_offset + nphases * dim,
+                      point_dof_begin + velocity_offset);
+
+            std::copy(point_dof_dot_begin + num_dof + dim * velocity_offset,
+                      point_dof_dot_begin + num_dof + dim * (velocity_offset + nphases * dim),
+                      point_dof_begin + num_dof + dim * velocity_offset);
+        }
+
+        /*!
+         * Get the virtual shape functions \f$ (1, 0) \f$ and \f$ (0, e_k) \f$ i.e., the values and spatial gradients
+         * which pick out the value and each component of the gradient of a test or interpolation function
+         *
+         * \param virtual_N_begin: The starting iterator of the values of the 1 + dim virtual shape functions
+         * \param virtual_N_end: The stopping iterator of the values of the 1 + dim virtual shape functions
+         * \param virtual_dNdx_begin: The starting iterator of the gradients of the virtual shape functions
+         * \param virtual_dNdx_end: The stopping iterator of the gradients of the virtual shape functions
+         */
+        template <int dim, class virtual_shape_function_iter, class virtual_shape_function_gradient_iter>
+        void getVirtualShapeFunctions(virtual_shape_function_iter          virtual_N_begin,
+                                      virtual_shape_function_iter          virtual_N_end,
+                                      virtual_shape_function_gradient_iter virtual_dNdx_begin,
+                                      virtual_shape_function_gradient_iter virtual_dNdx_end) {
+            using virtual_type = typename std::iterator_traits<virtual_shape_function_iter>::value_type;
+
+            using virtual_gradient_type =
+                typename std::iterator_traits<virtual_shape_function_gradient_iter>::value_type;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(virtual_N_end - virtual_N_begin) == 1 + dim,
+                                         "There are one plus dim virtual shape functions")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(virtual_dNdx_end - virtual_dNdx_begin) == (1 + dim) * dim,
+                                         "The virtual shape function gradients must have a size of one plus dim times "
+                                         "dim")
+
+            std::fill(virtual_N_begin, virtual_N_end, virtual_type());
+
+            std::fill(virtual_dNdx_begin, virtual_dNdx_end, virtual_gradient_type());
+
+            *virtual_N_begin = 1;
+
+            for (unsigned int k = 0; k < dim; ++k) {
+                *(virtual_dNdx_begin + dim * (k + 1) + k) = 1;
+            }
+        }
+
+        /*!
+         * Integrate the residual of a balance equation at a point into the node-major element residual. The point
+         * residual contains the num_rows rows of the equation for each virtual test function i.e., the coefficients
+         * of the test function and of each component of its gradient. Equations which do not depend on the gradient
+         * of the test function only have the first virtual test function.
+         *
+         * num_dof: The number of degrees of freedom of a node
+         * num_rows: The number of rows of the balance equation
+         * num_test_functions: The number of virtual test functions i.e., 1 or 1 + dim
+         *
+         * \param &N_begin: The starting iterator of the shape functions
+         * \param &N_end: The stopping iterator of the shape functions
+         * \param &dNdx_begin: The starting iterator of the node-major spatial gradients of the shape functions
+         * \param &dNdx_end: The stopping iterator of the node-major spatial gradients of the shape functions
+         * \param &point_residual_begin: The starting iterator of the residual of each virtual test function
+         * \param &point_residual_end: The stopping iterator of the residual of each virtual test function
+         * \param row_offset: The offset of the rows of the equation in the degrees of freedom of a node
+         * \param &Jxw: The Jacobian of the transformation times the weight of the integration point
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         */
+        template <int dim, int num_dof, int num_rows, int num_test_functions, class shape_function_iter,
+                  class shape_function_gradient_iter, class point_residual_iter, typename Jxw_type,
+                  class residual_iter>
+        void integrateElementResidual(const shape_function_iter &N_begin, const shape_function_iter &N_end,
+                                      const shape_function_gradient_iter &dNdx_begin,
+                                      const shape_function_gradient_iter &dNdx_end,
+                                      const point_residual_iter &point_residual_begin,
+                                      const point_residual_iter &point_residual_end, const unsigned int row_offset,
+                                      const Jxw_type &Jxw, residual_iter residual_begin, residual_iter residual_end) {
+            static_assert((num_test_functions == 1) || (num_test_functions == 1 + dim),
+                          "The number of virtual test functions must be 1 or 1 + dim");
+
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            const unsigned int node_count = (unsigned int)(N_end - N_begin);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dNdx_end - dNdx_begin) == dim * node_count,
+                                         "The shape function gradients must have a size of dim times the number of "
+                                         "nodes")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (unsigned int)(point_residual_end - point_residual_begin) == num_test_functions * num_rows,
+                "The point residual must have a size of the number of virtual test functions times the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have a size of the number of nodes times the number of "
+                                         "dof of a node")
+
+            for (unsigned int A = 0; A < node_count; ++A) {
+                auto residual_row = residual_begin + num_dof * A + row_offset;
+
+                for (unsigned int r = 0; r < num_rows; ++r) {
+                    residual_type sum = (*(N_begin + A)) * (*(point_residual_begin + r));
+
+                    for (unsigned int a = 0; a + 1 < num_test_functions; ++a) {
+                        sum += (*(dNdx_begin + dim * A + a)) * (*(point_residual_begin + num_rows * (a + 1) + r));
+                    }
+
+                    *(residual_row + r) += sum * Jxw;
+                }
+            }
+        }
+
+        /*!
+         * Integrate the Jacobian of a balance equation at a point into the row-major element Jacobian whose columns
+         * are the node-major element degrees of freedom. The point Jacobian contains the num_rows by num_dof
+         * derivatives of the equation for each pair of a virtual test function and a virtual interpolation function
+         * ( test-major ). The weak forms are linear in both the test and the interpolation functions so the Jacobian
+         * of the nodes A and B is
+         *
+         * \f$ J_{AB} = \sum_{t, s} \phi_t^A P_{ts} \phi_s^B \f$
+         *
+         * where \f$ \phi^A = ( N^A, N^A_{,k} ) \f$. The virtual test functions are contracted first so that the cost
+         * is linear in the number of pairs of nodes.
+         *
+         * num_dof: The number of degrees of freedom of a node
+         * num_rows: The number of rows of the balance equation
+         * num_test_functions: The number of virtual test functions i.e., 1 or 1 + dim
+         *
+         * \param &N_begin: The starting iterator of the shape functions
+         * \param &N_end: The stopping iterator of the shape functions
+         * \param &dNdx_begin: The starting iterator of the node-major spatial gradients of the shape functions
+         * \param &dNdx_end: The stopping iterator of the node-major spatial gradients of the shape functions
+         * \param &point_jacobian_begin: The starting iterator of the point Jacobian of each pair of virtual functions
+         * \param &point_jacobian_end: The stopping iterator of the point Jacobian of each pair of virtual functions
+         * \param row_offset: The offset of the rows of the equation in the degrees of freedom of a node
+         * \param &Jxw: The Jacobian of the transformation times the weight of the integration point
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         */
+        template <int dim, int num_dof, int num_rows, int num_test_functions, class shape_function_iter,
+                  class shape_function_gradient_iter, class point_jacobian_iter, typename Jxw_type,
+                  class jacobian_iter>
+        void integrateElementJacobian(const shape_function_iter &N_begin, const shape_function_iter &N_end,
+                                      const shape_function_gradient_iter &dNdx_begin,
+                                      const shape_function_gradient_iter &dNdx_end,
+                                      const point_jacobian_iter &point_jacobian_begin,
+                                      const point_jacobian_iter &point_jacobian_end, const unsigned int row_offset,
+                                      const Jxw_type &Jxw, jacobian_iter jacobian_begin, jacobian_iter jacobian_end) {
+            static_assert((num_test_functions == 1) || (num_test_functions == 1 + dim),
+                          "The number of virtual test functions must be 1 or 1 + dim");
+
+            using jacobian_type = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            const unsigned int node_count = (unsigned int)(N_end - N_begin);
+
+            const unsigned int num_element_dof = node_count * num_dof;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(dNdx_end - dNdx_begin) == dim * node_count,
+                                         "The shape function gradients must have a size of dim times the number of "
+                                         "nodes")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(point_jacobian_end - point_jacobian_begin) ==
+                                             num_test_functions * num_virtual * block_size,
+                                         "The point Jacobian must have a size of the number of pairs of virtual "
+                                         "functions times the number of rows times the number of dof of a node")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((unsigned int)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            // The point Jacobian of each virtual interpolation function contracted with the test function of a node
+            std::array<jacobian_type, num_virtual * block_size> test_jacobian;
+
+            for (unsigned int A = 0; A < node_count; ++A) {
+                for (unsigned int i = 0; i < num_virtual * block_size; ++i) {
+                    jacobian_type sum = (*(N_begin + A)) * (*(point_jacobian_begin + i));
+
+                    for (unsigned int a = 0; a + 1 < num_test_functions; ++a) {
+                        sum += (*(dNdx_begin + dim * A + a)) *
+                               (*(point_jacobian_begin + num_virtual * block_size * (a + 1) + i));
+                    }
+
+                    test_jacobian[i] = sum * Jxw;
+                }
+
+                for (unsigned int B = 0; B < node_count; ++B) {
+                    for (unsigned int r = 0; r < num_rows; ++r) {
+                        auto jacobian_row =
+                            jacobian_begin + num_element_dof * (num_dof * A + row_offset + r) + num_dof * B;
+
+                        for (unsigned int K = 0; K < num_dof; ++K) {
+                            jacobian_type sum = (*(N_begin + B)) * test_jacobian[num_dof * r + K];
+
+                            for (unsigned int a = 0; a < dim; ++a) {
+                                sum += (*(dNdx_begin + dim * B + a)) *
+                                       test_jacobian[block_size * (a + 1) + num_dof * r + K];
+                            }
+
+                            *(jacobian_row + K) += sum;
+                        }
+                    }
+                }
+            }
+        }
+
+        /*!
+         * Compute the residual of the balance of linear momentum of an element. The residual is added to the rows of
+         * the velocity field of the node-major element residual. The material model is called at each integration
+         * point as
+         *
+         * model( qp, point_dof_begin, point_dof_end, material_response_begin, material_response_end )
+         *
+         * where the point dof vector contains the interpolated degrees of freedom followed by their spatial gradients
+         * (the layout of the material response dof vector) with the velocity in place of the spatial degree of freedom
+         * (see setMaterialResponseVelocity) and the material response is phase-major.
+         *
+         * The residual is linear in the test function and its gradient so the kernel is evaluated once for each of
+         * the virtual test functions \f$ (1, 0) \f$ and \f$ (0, e_k) \f$ at each integration point and the result is
+         * contracted with the shape functions of the nodes (see integrateElementResidual).
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * body_force_index: The index of the material response vector where the body force is located
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dof_ddot_begin: The starting iterator of the second time derivative of the degrees of freedom
+         * \param &dof_ddot_end: The stopping iterator of the second time derivative of the degrees of freedom
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class dof_ddot_iter,
+                  class material_model, class residual_iter>
+        void computeElementBalanceOfLinearMomentum(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dof_ddot_iter &dof_ddot_begin, const dof_ddot_iter &dof_ddot_end, material_model &model,
+            residual_iter residual_begin, residual_iter residual_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases * dim;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_ddot_end - dof_ddot_begin) == node_count * num_dof,
+                                         "The dof ddot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot, point_dof_ddot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<residual_type, num_virtual * num_rows> point_residual;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_ddot_begin, dof_ddot_end,
+                    std::begin(point_dof_ddot), std::end(point_dof_ddot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response)));
+
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                            dim, material_response_dim, body_force_index, cauchy_stress_index,
+                            interphasic_force_index>(
+                            std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                            std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                            std::cbegin(point_dof) + num_dof + nphases * dim,
+                            std::cbegin(point_dof_dot) + velocity_offset,
+                            std::cbegin(point_dof_dot) + velocity_offset + num_rows,
+                            std::cbegin(point_dof_ddot) + velocity_offset,
+                            std::cbegin(point_dof_ddot) + velocity_offset + num_rows,
+                            std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                            std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + num_rows),
+                            std::cbegin(material_response), std::cend(material_response),
+                            std::cbegin(point_dof) + volume_fraction_offset,
+                            std::cbegin(point_dof) + volume_fraction_offset + nphases, virtual_N[t],
+                            std::cbegin(virtual_dNdx) + dim * t, std::cbegin(virtual_dNdx) + dim * (t + 1),
+                            std::begin(point_residual) + num_rows * t,
+                            std::begin(point_residual) + num_rows * (t + 1))));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, num_virtual>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), velocity_offset, Jxw, residual_begin, residual_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual and Jacobian of the balance of linear momentum of an element. The residual is added to
+         * the rows of the velocity field of the node-major element residual and the Jacobian is added to the same rows
+         * of the row-major element Jacobian whose columns are the node-major element degrees of freedom. The material
+         * model is called at each integration point as
+         *
+         * model( qp, point_dof_begin, point_dof_end, material_response_begin, material_response_end,
+         *        material_response_jacobian_begin, material_response_jacobian_end )
+         *
+         * where the point dof vector contains the interpolated degrees of freedom followed by their spatial gradients
+         * (the layout of the material response dof vector) with the velocity in place of the spatial degree of freedom
+         * (see setMaterialResponseVelocity) and the material response Jacobian is the phase-major derivative of the
+         * material response w.r.t. the point dof vector.
+         *
+         * The chain-rule kernel is evaluated once for each pair of the virtual test and interpolation functions
+         * \f$ (1, 0) \f$ and \f$ (0, e_k) \f$ at each integration point i.e., \f$ (1 + dim)^2 \f$ times rather than
+         * for every pair of nodes, and the point Jacobians are contracted with the shape functions of the nodes (see
+         * integrateElementJacobian). The mesh is held fixed i.e., the Jacobian w.r.t. the mesh displacement is not
+         * assembled.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * body_force_index: The index of the material response vector where the body force is located
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dof_ddot_begin: The starting iterator of the second time derivative of the degrees of freedom
+         * \param &dof_ddot_end: The stopping iterator of the second time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &dDDotdDOF: The derivative of the second time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class dof_ddot_iter,
+                  typename dDotdDOF_type, typename dDDotdDOF_type, class material_model, class residual_iter,
+                  class jacobian_iter>
+        void computeElementBalanceOfLinearMomentum(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const dof_ddot_iter &dof_ddot_begin, const dof_ddot_iter &dof_ddot_end, const dDotdDOF_type &dDotdDOF,
+            const dDDotdDOF_type &dDDotdDOF, material_model &model, residual_iter residual_begin,
+            residual_iter residual_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+            using jacobian_type         = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_element_dof = node_count * num_dof;
+
+            constexpr unsigned int num_rows = nphases * dim;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_ddot_end - dof_ddot_begin) == node_count * num_dof,
+                                         "The dof ddot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot, point_dof_ddot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            std::array<residual_type, num_virtual * num_rows> point_residual;
+
+            std::array<jacobian_type, num_virtual * num_virtual * block_size> point_jacobian;
+
+            PointJacobianBlock<jacobian_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_ddot_begin, dof_ddot_end,
+                    std::begin(point_dof_ddot), std::end(point_dof_ddot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_jacobian), std::end(point_jacobian), jacobian_type());
+
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    for (unsigned int s = 0; s < num_virtual; ++s) {
+                        TARDIGRADE_ERROR_TOOLS_CATCH(
+                            (balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                                dim, material_response_dim, body_force_index, cauchy_stress_index,
+                                interphasic_force_index, num_phase_dof + num_additional_dof>(
+                                std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                                std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                                std::cbegin(point_dof) + num_dof + nphases * dim,
+                                std::cbegin(point_dof_dot) + velocity_offset,
+                                std::cbegin(point_dof_dot) + velocity_offset + num_rows,
+                                std::cbegin(point_dof_ddot) + velocity_offset,
+                                std::cbegin(point_dof_ddot) + velocity_offset + num_rows,
+                                std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                                std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + num_rows),
+                                std::cbegin(material_response), std::cend(material_response),
+                                std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                                std::cbegin(point_dof) + volume_fraction_offset,
+                                std::cbegin(point_dof) + volume_fraction_offset + nphases, virtual_N[t],
+                                std::cbegin(virtual_dNdx) + dim * t, std::cbegin(virtual_dNdx) + dim * (t + 1),
+                                virtual_N[s], std::cbegin(virtual_dNdx) + dim * s,
+                                std::cbegin(virtual_dNdx) + dim * (s + 1), std::cbegin(point_dof) + num_dof,
+                                std::cend(point_dof), dDotdDOF, dDotdDOF, dDDotdDOF, std::begin(block.result),
+                                std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                                std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                                std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                                std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                                std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                                std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                        if (s == 0) {
+                            std::copy(std::cbegin(block.result), std::cend(block.result),
+                                      std::begin(point_residual) + num_rows * t);
+                        }
+
+                        block.addTo(std::begin(point_jacobian) + block_size * (num_virtual * t + s),
+                                    std::begin(point_jacobian) + block_size * (num_virtual * t + s + 1));
+                    }
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, num_virtual>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), velocity_offset, Jxw, residual_begin, residual_end)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementJacobian<dim, num_dof, num_rows, num_virtual>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_jacobian),
+                    std::cend(point_jacobian), velocity_offset, Jxw, jacobian_begin, jacobian_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual of the balance of mass of an element. The residual is added to the rows of the density
+         * field of the node-major element residual. The material model is called as in
+         * computeElementBalanceOfLinearMomentum and the velocity is the first time derivative of the spatial degree of
+         * freedom. The balance of mass does not depend on the gradient of the test function so the kernel is only
+         * evaluated for the virtual test function \f$ (1, 0) \f$.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * mass_change_index: The index of the material response vector where the mass change rate is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class material_model, class residual_iter>
+        void computeElementBalanceOfMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                                         const typename element_configuration::node_in &node_positions_begin,
+                                         const typename element_configuration::node_in &node_positions_end,
+                                         const dof_iter &dof_begin, const dof_iter &dof_end,
+                                         const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                         material_model &model, residual_iter residual_begin,
+                                         residual_iter residual_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            node_value_type Jxw;
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((balanceOfMass::computeBalanceOfMass<dim, mass_change_index>(
+                    std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                    std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                    std::cbegin(point_dof) + num_dof + nphases * dim, std::cbegin(point_dof_dot) + velocity_offset,
+                    std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                    std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                    std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + nphases * dim),
+                    std::cbegin(material_response), std::cend(material_response), 1., std::begin(point_residual),
+                    std::end(point_residual))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), 0, Jxw, residual_begin, residual_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual and Jacobian of the balance of mass of an element. The residual and Jacobian are added
+         * to the rows of the density field. The material model is called as in the Jacobian overload of
+         * computeElementBalanceOfLinearMomentum. The chain-rule kernel is evaluated for each virtual interpolation
+         * function and the virtual test function \f$ (1, 0) \f$ at each integration point. The mesh is held fixed.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * mass_change_index: The index of the material response vector where the mass change rate is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  typename dDotdDOF_type, class material_model, class residual_iter, class jacobian_iter>
+        void computeElementBalanceOfMass(finiteElement::FiniteElementBase<element_configuration> &element,
+                                         const typename element_configuration::node_in &node_positions_begin,
+                                         const typename element_configuration::node_in &node_positions_end,
+                                         const dof_iter &dof_begin, const dof_iter &dof_end,
+                                         const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                         const dDotdDOF_type &dDotdDOF, material_model &model,
+                                         residual_iter residual_begin, residual_iter residual_end,
+                                         jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                                         const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+            using jacobian_type         = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_element_dof = node_count * num_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            std::array<jacobian_type, num_virtual * block_size> point_jacobian;
+
+            PointJacobianBlock<jacobian_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_jacobian), std::end(point_jacobian), jacobian_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfMass::computeBalanceOfMass<dim, material_response_dim, mass_change_index,
+                                                             num_phase_dof + num_additional_dof>(
+                            std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                            std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                            std::cbegin(point_dof) + num_dof + nphases * dim,
+                            std::cbegin(point_dof_dot) + velocity_offset,
+                            std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                            std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                            std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + nphases * dim),
+                            std::cbegin(material_response), std::cend(material_response),
+                            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                            virtual_N[0], virtual_N[s], std::cbegin(virtual_dNdx) + dim * s,
+                            std::cbegin(virtual_dNdx) + dim * (s + 1), std::cbegin(point_dof) + num_dof,
+                            std::cend(point_dof), dDotdDOF, dDotdDOF, std::begin(block.result),
+                            std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                            std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                            std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                            std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                            std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                            std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                    if (s == 0) {
+                        std::copy(std::cbegin(block.result), std::cend(block.result), std::begin(point_residual));
+                    }
+
+                    block.addTo(std::begin(point_jacobian) + block_size * s,
+                                std::begin(point_jacobian) + block_size * (s + 1));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), 0, Jxw, residual_begin, residual_end)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementJacobian<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_jacobian),
+                    std::cend(point_jacobian), 0, Jxw, jacobian_begin, jacobian_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual of the balance of energy of an element. The residual is added to the rows of the
+         * temperature field of the node-major element residual. The material model is called as in
+         * computeElementBalanceOfLinearMomentum and the kernel is evaluated once for each of the virtual test functions
+         * at each integration point.
+         *
+         * is_per_unit_volume: Whether the internal energy degree of freedom is per unit volume
+         * material_response_dim: The spatial dimension of the material response
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * internal_heat_generation_index: The index of the material response vector where the internal heat generation
+         * is located
+         * heat_flux_index: The index of the material response vector where the heat flux is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * interphasic_heat_transfer_index: The index of the material response vector where the net interphasic heat
+         * transfer is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, class material_model,
+                  class residual_iter>
+        void computeElementBalanceOfEnergy(finiteElement::FiniteElementBase<element_configuration> &element,
+                                           const typename element_configuration::node_in &node_positions_begin,
+                                           const typename element_configuration::node_in &node_positions_end,
+                                           const dof_iter &dof_begin, const dof_iter &dof_end,
+                                           const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                           material_model &model, residual_iter residual_begin,
+                                           residual_iter residual_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int temperature_offset = nphases * (1 + 2 * dim);
+
+            constexpr unsigned int internal_energy_offset = nphases * (2 + 2 * dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<residual_type, num_virtual * num_rows> point_residual;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response)));
+
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfEnergy::computeBalanceOfEnergy<dim, is_per_unit_volume, material_response_dim,
+                                                                 cauchy_stress_index, internal_heat_generation_index,
+                                                                 heat_flux_index, interphasic_force_index,
+                                                                 interphasic_heat_transfer_index>(
+                            std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                            std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                            std::cbegin(point_dof) + num_dof + nphases * dim,
+                            std::cbegin(point_dof) + internal_energy_offset,
+                            std::cbegin(point_dof) + internal_energy_offset + nphases,
+                            std::cbegin(point_dof_dot) + internal_energy_offset,
+                            std::cbegin(point_dof_dot) + internal_energy_offset + nphases,
+                            std::cbegin(point_dof) + num_dof + dim * internal_energy_offset,
+                            std::cbegin(point_dof) + num_dof + dim * (internal_energy_offset + nphases),
+                            std::cbegin(point_dof_dot) + velocity_offset,
+                            std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                            std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                            std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + nphases * dim),
+                            std::cbegin(material_response), std::cend(material_response),
+                            std::cbegin(point_dof) + volume_fraction_offset,
+                            std::cbegin(point_dof) + volume_fraction_offset + nphases, virtual_N[t],
+                            std::cbegin(virtual_dNdx) + dim * t, std::cbegin(virtual_dNdx) + dim * (t + 1),
+                            std::begin(point_residual) + num_rows * t,
+                            std::begin(point_residual) + num_rows * (t + 1))));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, num_virtual>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), temperature_offset, Jxw, residual_begin, residual_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual and Jacobian of the balance of energy of an element. The residual and Jacobian are
+         * added to the rows of the temperature field. The material model is called as in the Jacobian overload of
+         * computeElementBalanceOfLinearMomentum and the chain-rule kernel is evaluated once for each pair of the
+         * virtual test and interpolation functions at each integration point. The mesh is held fixed.
+         *
+         * is_per_unit_volume: Whether the internal energy degree of freedom is per unit volume
+         * material_response_dim: The spatial dimension of the material response
+         * cauchy_stress_index: The index of the material response vector where the cauchy stress is located
+         * internal_heat_generation_index: The index of the material response vector where the internal heat generation
+         * is located
+         * heat_flux_index: The index of the material response vector where the heat flux is located
+         * interphasic_force_index: The index of the material response vector where the net interphasic force is
+         * located
+         * interphasic_heat_transfer_index: The index of the material response vector where the net interphasic heat
+         * transfer is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_size, int nphases, int num_additional_dof,
+                  class element_configuration, class dof_iter, class dof_dot_iter, typename dDotdDOF_type,
+                  class material_model, class residual_iter, class jacobian_iter>
+        void computeElementBalanceOfEnergy(finiteElement::FiniteElementBase<element_configuration> &element,
+                                           const typename element_configuration::node_in &node_positions_begin,
+                                           const typename element_configuration::node_in &node_positions_end,
+                                           const dof_iter &dof_begin, const dof_iter &dof_end,
+                                           const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                           const dDotdDOF_type &dDotdDOF, material_model &model,
+                                           residual_iter residual_begin, residual_iter residual_end,
+                                           jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                                           const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+            using jacobian_type         = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_element_dof = node_count * num_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int temperature_offset = nphases * (1 + 2 * dim);
+
+            constexpr unsigned int internal_energy_offset = nphases * (2 + 2 * dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            std::array<residual_type, num_virtual * num_rows> point_residual;
+
+            std::array<jacobian_type, num_virtual * num_virtual * block_size> point_jacobian;
+
+            PointJacobianBlock<jacobian_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_jacobian), std::end(point_jacobian), jacobian_type());
+
+                for (unsigned int t = 0; t < num_virtual; ++t) {
+                    for (unsigned int s = 0; s < num_virtual; ++s) {
+                        TARDIGRADE_ERROR_TOOLS_CATCH(
+                            (balanceOfEnergy::computeBalanceOfEnergy<
+                                dim, is_per_unit_volume, material_response_dim, cauchy_stress_index,
+                                internal_heat_generation_index, heat_flux_index, interphasic_force_index,
+                                interphasic_heat_transfer_index, num_phase_dof + num_additional_dof>(
+                                std::cbegin(point_dof), std::cbegin(point_dof) + nphases, std::cbegin(point_dof_dot),
+                                std::cbegin(point_dof_dot) + nphases, std::cbegin(point_dof) + num_dof,
+                                std::cbegin(point_dof) + num_dof + nphases * dim,
+                                std::cbegin(point_dof) + internal_energy_offset,
+                                std::cbegin(point_dof) + internal_energy_offset + nphases,
+                                std::cbegin(point_dof_dot) + internal_energy_offset,
+                                std::cbegin(point_dof_dot) + internal_energy_offset + nphases,
+                                std::cbegin(point_dof) + num_dof + dim * internal_energy_offset,
+                                std::cbegin(point_dof) + num_dof + dim * (internal_energy_offset + nphases),
+                                std::cbegin(point_dof_dot) + velocity_offset,
+                                std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                                std::cbegin(point_dof_dot) + num_dof + dim * velocity_offset,
+                                std::cbegin(point_dof_dot) + num_dof + dim * (velocity_offset + nphases * dim),
+                                std::cbegin(material_response), std::cend(material_response),
+                                std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                                std::cbegin(point_dof) + volume_fraction_offset,
+                                std::cbegin(point_dof) + volume_fraction_offset + nphases, virtual_N[t],
+                                std::cbegin(virtual_dNdx) + dim * t, std::cbegin(virtual_dNdx) + dim * (t + 1),
+                                virtual_N[s], std::cbegin(virtual_dNdx) + dim * s,
+                                std::cbegin(virtual_dNdx) + dim * (s + 1), std::cbegin(point_dof) + num_dof,
+                                std::cend(point_dof), dDotdDOF, dDotdDOF, dDotdDOF, std::begin(block.result),
+                                std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                                std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                                std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                                std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                                std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                                std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                        if (s == 0) {
+                            std::copy(std::cbegin(block.result), std::cend(block.result),
+                                      std::begin(point_residual) + num_rows * t);
+                        }
+
+                        block.addTo(std::begin(point_jacobian) + block_size * (num_virtual * t + s),
+                                    std::begin(point_jacobian) + block_size * (num_virtual * t + s + 1));
+                    }
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, num_virtual>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), temperature_offset, Jxw, residual_begin, residual_end)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementJacobian<dim, num_dof, num_rows, num_virtual>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_jacobian),
+                    std::cend(point_jacobian), temperature_offset, Jxw, jacobian_begin, jacobian_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual of the balance of volume fraction of an element. The residual is added to the rows of
+         * the volume fraction field of the node-major element residual. The material model is called as in
+         * computeElementBalanceOfLinearMomentum. The balance of volume fraction does not depend on the gradient of the
+         * test function so the kernel is only evaluated for the virtual test function \f$ (1, 0) \f$.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * mass_change_rate_index: The index of the material response vector where the mass change rate is located
+         * trace_mass_change_velocity_gradient_index: The index of the material response vector where the trace of the
+         * mass change velocity gradient is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &rest_density_begin: The starting iterator of the rest densities of the phases
+         * \param &rest_density_end: The stopping iterator of the rest densities of the phases
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class rest_density_iter, class material_model, class residual_iter>
+        void computeElementBalanceOfVolumeFraction(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const rest_density_iter &rest_density_begin, const rest_density_iter &rest_density_end,
+            material_model &model, residual_iter residual_begin, residual_iter residual_end,
+            const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            node_value_type Jxw;
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (balanceOfVolumeFraction::computeBalanceOfVolumeFraction<dim, mass_change_rate_index,
+                                                                             trace_mass_change_velocity_gradient_index>(
+                        std::cbegin(point_dof), std::cbegin(point_dof) + nphases,
+                        std::cbegin(point_dof_dot) + velocity_offset,
+                        std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                        std::cbegin(point_dof) + volume_fraction_offset,
+                        std::cbegin(point_dof) + volume_fraction_offset + nphases,
+                        std::cbegin(point_dof_dot) + volume_fraction_offset,
+                        std::cbegin(point_dof_dot) + volume_fraction_offset + nphases,
+                        std::cbegin(point_dof) + num_dof + dim * volume_fraction_offset,
+                        std::cbegin(point_dof) + num_dof + dim * (volume_fraction_offset + nphases),
+                        std::cbegin(material_response), std::cend(material_response), rest_density_begin,
+                        rest_density_end, 1., std::begin(point_residual), std::end(point_residual))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), volume_fraction_offset, Jxw, residual_begin, residual_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual and Jacobian of the balance of volume fraction of an element. The residual and
+         * Jacobian are added to the rows of the volume fraction field. The material model is called as in the Jacobian
+         * overload of computeElementBalanceOfLinearMomentum. The chain-rule kernel is evaluated for each virtual
+         * interpolation function and the virtual test function \f$ (1, 0) \f$ at each integration point. The mesh is
+         * held fixed.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * mass_change_rate_index: The index of the material response vector where the mass change rate is located
+         * trace_mass_change_velocity_gradient_index: The index of the material response vector where the trace of the
+         * mass change velocity gradient is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &rest_density_begin: The starting iterator of the rest densities of the phases
+         * \param &rest_density_end: The stopping iterator of the rest densities of the phases
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int mass_change_rate_index,
+                  int trace_mass_change_velocity_gradient_index, int material_response_size, int nphases,
+                  int num_additional_dof, class element_configuration, class dof_iter, class dof_dot_iter,
+                  class rest_density_iter, typename dDotdDOF_type, class material_model, class residual_iter,
+                  class jacobian_iter>
+        void computeElementBalanceOfVolumeFraction(
+            finiteElement::FiniteElementBase<element_configuration> &element,
+            const typename element_configuration::node_in &node_positions_begin,
+            const typename element_configuration::node_in &node_positions_end, const dof_iter &dof_begin,
+            const dof_iter &dof_end, const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+            const rest_density_iter &rest_density_begin, const rest_density_iter &rest_density_end,
+            const dDotdDOF_type &dDotdDOF, material_model &model, residual_iter residual_begin,
+            residual_iter residual_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+            const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+            using jacobian_type         = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_element_dof = node_count * num_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            constexpr unsigned int volume_fraction_offset = nphases * (3 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            std::array<jacobian_type, num_virtual * block_size> point_jacobian;
+
+            PointJacobianBlock<jacobian_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_jacobian), std::end(point_jacobian), jacobian_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (balanceOfVolumeFraction::computeBalanceOfVolumeFraction<
+                            dim, material_response_dim, mass_change_rate_index,
+                            trace_mass_change_velocity_gradient_index, num_phase_dof + num_additional_dof>(
+                            std::cbegin(point_dof), std::cbegin(point_dof) + nphases,
+                            std::cbegin(point_dof_dot) + velocity_offset,
+                            std::cbegin(point_dof_dot) + velocity_offset + nphases * dim,
+                            std::cbegin(point_dof) + volume_fraction_offset,
+                            std::cbegin(point_dof) + volume_fraction_offset + nphases,
+                            std::cbegin(point_dof_dot) + volume_fraction_offset,
+                            std::cbegin(point_dof_dot) + volume_fraction_offset + nphases,
+                            std::cbegin(point_dof) + num_dof + dim * volume_fraction_offset,
+                            std::cbegin(point_dof) + num_dof + dim * (volume_fraction_offset + nphases),
+                            std::cbegin(material_response), std::cend(material_response),
+                            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+                            rest_density_begin, rest_density_end, virtual_N[0], virtual_N[s],
+                            std::cbegin(virtual_dNdx) + dim * s, std::cbegin(virtual_dNdx) + dim * (s + 1),
+                            std::cbegin(point_dof) + num_dof, std::cend(point_dof), dDotdDOF, dDotdDOF,
+                            std::begin(block.result), std::end(block.result), std::begin(block.dRdRho),
+                            std::end(block.dRdRho), std::begin(block.dRdU), std::end(block.dRdU),
+                            std::begin(block.dRdW), std::end(block.dRdW), std::begin(block.dRdTheta),
+                            std::end(block.dRdTheta), std::begin(block.dRdE), std::end(block.dRdE),
+                            std::begin(block.dRdVolumeFraction), std::end(block.dRdVolumeFraction),
+                            std::begin(block.dRdZ), std::end(block.dRdZ), std::begin(block.dRdUMesh),
+                            std::end(block.dRdUMesh))));
+
+                    if (s == 0) {
+                        std::copy(std::cbegin(block.result), std::cend(block.result), std::begin(point_residual));
+                    }
+
+                    block.addTo(std::begin(point_jacobian) + block_size * s,
+                                std::begin(point_jacobian) + block_size * (s + 1));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), volume_fraction_offset, Jxw, residual_begin, residual_end)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementJacobian<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_jacobian),
+                    std::cend(point_jacobian), volume_fraction_offset, Jxw, jacobian_begin, jacobian_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual of the internal energy constraint of an element. The residual is added to the rows of
+         * the internal energy field of the node-major element residual. The material model is called as in
+         * computeElementBalanceOfLinearMomentum. The constraint does not depend on the gradient of the test function
+         * so the kernel is only evaluated for the virtual test function \f$ (1, 0) \f$.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * predicted_internal_energy_index: The index of the material response vector where the predicted internal
+         * energy is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int predicted_internal_energy_index, int material_response_size,
+                  int nphases, int num_additional_dof, class element_configuration, class dof_iter,
+                  class dof_dot_iter, class material_model, class residual_iter>
+        void computeElementInternalEnergyConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                    const typename element_configuration::node_in &node_positions_begin,
+                                                    const typename element_configuration::node_in &node_positions_end,
+                                                    const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                    const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                    material_model &model, residual_iter residual_begin,
+                                                    residual_iter residual_end, const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int internal_energy_offset = nphases * (2 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            node_value_type Jxw;
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(
+                    (constraintEquations::computeInternalEnergyConstraint<predicted_internal_energy_index>(
+                        std::cbegin(point_dof) + internal_energy_offset,
+                        std::cbegin(point_dof) + internal_energy_offset + nphases, std::cbegin(material_response),
+                        std::cend(material_response), 1., std::begin(point_residual), std::end(point_residual))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), internal_energy_offset, Jxw, residual_begin, residual_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual and Jacobian of the internal energy constraint of an element. The residual and Jacobian
+         * are added to the rows of the internal energy field. The material model is called as in the Jacobian overload
+         * of computeElementBalanceOfLinearMomentum. The chain-rule kernel is evaluated for each virtual interpolation
+         * function and the virtual test function \f$ (1, 0) \f$ at each integration point. The mesh is held fixed.
+         *
+         * material_response_dim: The spatial dimension of the material response
+         * predicted_internal_energy_index: The index of the material response vector where the predicted internal
+         * energy is located
+         * material_response_size: The size of the material response vector of a phase
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_begin: The starting iterator of the node-major degrees of freedom of the element
+         * \param &dof_end: The stopping iterator of the node-major degrees of freedom of the element
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param &model: The material model
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int material_response_dim, int predicted_internal_energy_index, int material_response_size,
+                  int nphases, int num_additional_dof, class element_configuration, class dof_iter,
+                  class dof_dot_iter, typename dDotdDOF_type, class material_model, class residual_iter,
+                  class jacobian_iter>
+        void computeElementInternalEnergyConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                    const typename element_configuration::node_in &node_positions_begin,
+                                                    const typename element_configuration::node_in &node_positions_end,
+                                                    const dof_iter &dof_begin, const dof_iter &dof_end,
+                                                    const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                    const dDotdDOF_type &dDotdDOF, material_model &model,
+                                                    residual_iter residual_begin, residual_iter residual_end,
+                                                    jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                                                    const bool configuration) {
+            static_assert(dim == material_response_dim,
+                          "The spatial dimension must be equal to the dimension of the material response");
+
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+            using jacobian_type         = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_element_dof = node_count * num_dof;
+
+            constexpr unsigned int num_rows = nphases;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            constexpr unsigned int internal_energy_offset = nphases * (2 + 2 * dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_end - dof_begin) == node_count * num_dof,
+                                         "The dof has a size of " + std::to_string((size_type)(dof_end - dof_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The degrees of freedom and their rates at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof, point_dof_dot;
+
+            std::array<dof_type, nphases * material_response_size> material_response;
+
+            std::array<dof_type, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            std::array<jacobian_type, num_virtual * block_size> point_jacobian;
+
+            PointJacobianBlock<jacobian_type, dim, nphases, num_additional_dof, num_rows> block;
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_begin, dof_end,
+                    std::begin(point_dof), std::end(point_dof)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((setMaterialResponseVelocity<dim, nphases, num_additional_dof>(
+                    std::cbegin(point_dof_dot), std::cend(point_dof_dot), std::begin(point_dof), std::end(point_dof))));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(model(qp, std::cbegin(point_dof), std::cend(point_dof),
+                                                   std::begin(material_response), std::end(material_response),
+                                                   std::begin(material_response_jacobian),
+                                                   std::end(material_response_jacobian)));
+
+                std::fill(std::begin(point_jacobian), std::end(point_jacobian), jacobian_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(
+                        (constraintEquations::computeInternalEnergyConstraint<
+                            material_response_dim, predicted_internal_energy_index,
+                            num_phase_dof + num_additional_dof>(
+                            std::cbegin(point_dof) + internal_energy_offset,
+                            std::cbegin(point_dof) + internal_energy_offset + nphases, std::cbegin(material_response),
+                            std::cend(material_response), std::cbegin(material_response_jacobian),
+                            std::cend(material_response_jacobian), virtual_N[0], virtual_N[s],
+                            std::cbegin(virtual_dNdx) + dim * s, std::cbegin(virtual_dNdx) + dim * (s + 1),
+                            std::cbegin(point_dof) + num_dof, std::cend(point_dof), dDotdDOF, std::begin(block.result),
+                            std::end(block.result), std::begin(block.dRdRho), std::end(block.dRdRho),
+                            std::begin(block.dRdU), std::end(block.dRdU), std::begin(block.dRdW),
+                            std::end(block.dRdW), std::begin(block.dRdTheta), std::end(block.dRdTheta),
+                            std::begin(block.dRdE), std::end(block.dRdE), std::begin(block.dRdVolumeFraction),
+                            std::end(block.dRdVolumeFraction), std::begin(block.dRdZ), std::end(block.dRdZ),
+                            std::begin(block.dRdUMesh), std::end(block.dRdUMesh))));
+
+                    if (s == 0) {
+                        std::copy(std::cbegin(block.result), std::cend(block.result), std::begin(point_residual));
+                    }
+
+                    block.addTo(std::begin(point_jacobian) + block_size * s,
+                                std::begin(point_jacobian) + block_size * (s + 1));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), internal_energy_offset, Jxw, residual_begin, residual_end)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementJacobian<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_jacobian),
+                    std::cend(point_jacobian), internal_energy_offset, Jxw, jacobian_begin, jacobian_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual of the constraint between the rate of the displacement and the velocity of an element.
+         * The residual is added to the rows of the displacement field of the node-major element residual.
+         *
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_dot_iter,
+                  class residual_iter>
+        void computeElementDisplacementConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                  const typename element_configuration::node_in &node_positions_begin,
+                                                  const typename element_configuration::node_in &node_positions_end,
+                                                  const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                  residual_iter residual_begin, residual_iter residual_end,
+                                                  const bool configuration) {
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_dot_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_rows = nphases * dim;
+
+            constexpr unsigned int displacement_offset = nphases;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot has a size of " +
+                                             std::to_string((size_type)(dof_dot_end - dof_dot_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof dot")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            // The rates of the degrees of freedom at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof_dot;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            node_value_type Jxw;
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(constraintEquations::computeDisplacementConstraint(
+                    std::cbegin(point_dof_dot) + displacement_offset,
+                    std::cbegin(point_dof_dot) + displacement_offset + num_rows,
+                    std::cbegin(point_dof_dot) + velocity_offset,
+                    std::cbegin(point_dof_dot) + velocity_offset + num_rows,
+                    1., std::begin(point_residual), std::end(point_residual)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), displacement_offset, Jxw, residual_begin, residual_end)));
+            }
+        }
+
+        /*!
+         * Compute the residual and Jacobian of the constraint between the rate of the displacement and the velocity of
+         * an element. The residual and Jacobian are added to the rows of the displacement field. The derivatives of
+         * the constraint are diagonal in the displacement and the velocity and only depend on the virtual
+         * interpolation function \f$ (1, 0) \f$. The mesh is held fixed.
+         *
+         * nphases: The number of phases
+         * num_additional_dof: The number of additional degrees of freedom
+         *
+         * \param &element: The finite element
+         * \param &node_positions_begin: The starting iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &node_positions_end: The stopping iterator of the nodal positions in the configuration the
+         * gradients are computed in
+         * \param &dof_dot_begin: The starting iterator of the first time derivative of the degrees of freedom
+         * \param &dof_dot_end: The stopping iterator of the first time derivative of the degrees of freedom
+         * \param &dDotdDOF: The derivative of the first time derivative of a dof w.r.t. the dof
+         * \param residual_begin: The starting iterator of the node-major element residual
+         * \param residual_end: The stopping iterator of the node-major element residual
+         * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param configuration: Integrate over the current configuration ( true ) or reference configuration ( false )
+         */
+        template <int dim, int nphases, int num_additional_dof, class element_configuration, class dof_dot_iter,
+                  typename dDotdDOF_type, class residual_iter, class jacobian_iter>
+        void computeElementDisplacementConstraint(finiteElement::FiniteElementBase<element_configuration> &element,
+                                                  const typename element_configuration::node_in &node_positions_begin,
+                                                  const typename element_configuration::node_in &node_positions_end,
+                                                  const dof_dot_iter &dof_dot_begin, const dof_dot_iter &dof_dot_end,
+                                                  const dDotdDOF_type &dDotdDOF, residual_iter residual_begin,
+                                                  residual_iter residual_end, jacobian_iter jacobian_begin,
+                                                  jacobian_iter jacobian_end, const bool configuration) {
+            using local_node_value_type = typename element_configuration::local_node_value_type;
+            using node_value_type       = typename element_configuration::node_value_type;
+            using dof_type              = typename std::iterator_traits<dof_dot_iter>::value_type;
+            using residual_type         = typename std::iterator_traits<residual_iter>::value_type;
+            using jacobian_type         = typename std::iterator_traits<jacobian_iter>::value_type;
+
+            constexpr unsigned int node_count = element_configuration::node_count;
+
+            constexpr unsigned int num_phase_dof = 4 + 2 * dim;
+
+            constexpr unsigned int num_dof = nphases * num_phase_dof + num_additional_dof;
+
+            constexpr unsigned int num_element_dof = node_count * num_dof;
+
+            constexpr unsigned int num_rows = nphases * dim;
+
+            constexpr unsigned int num_virtual = 1 + dim;
+
+            constexpr unsigned int block_size = num_rows * num_dof;
+
+            constexpr unsigned int displacement_offset = nphases;
+
+            constexpr unsigned int velocity_offset = nphases * (1 + dim);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(dof_dot_end - dof_dot_begin) == node_count * num_dof,
+                                         "The dof dot has a size of " +
+                                             std::to_string((size_type)(dof_dot_end - dof_dot_begin)) +
+                                             " but should have a size of " + std::to_string(node_count * num_dof))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(residual_end - residual_begin) == node_count * num_dof,
+                                         "The residual must have the same size as the dof dot")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(jacobian_end - jacobian_begin) ==
+                                             num_element_dof * num_element_dof,
+                                         "The Jacobian must have a size equal to the square of the number of element "
+                                         "dof")
+
+            std::array<local_node_value_type, node_count> N;
+
+            std::array<local_node_value_type, node_count * dim> dNdx;
+
+            std::array<local_node_value_type, num_virtual> virtual_N;
+
+            std::array<local_node_value_type, num_virtual * dim> virtual_dNdx;
+
+            // The rates of the degrees of freedom at the point followed by their spatial gradients
+            std::array<dof_type, num_dof * (1 + dim)> point_dof_dot;
+
+            std::array<residual_type, num_rows> point_residual;
+
+            std::array<jacobian_type, num_rows> dRdD, dRdV;
+
+            std::array<jacobian_type, num_rows * dim> dRdUMesh;
+
+            std::array<jacobian_type, num_virtual * block_size> point_jacobian;
+
+            // Only the diagonals of the derivatives w.r.t. the displacement and velocity are set below
+            PointJacobianBlock<jacobian_type, dim, nphases, num_additional_dof, num_rows> block{};
+
+            node_value_type Jxw;
+
+            getVirtualShapeFunctions<dim>(std::begin(virtual_N), std::end(virtual_N), std::begin(virtual_dNdx),
+                                          std::end(virtual_dNdx));
+
+            for (unsigned int qp = 0; qp < element_configuration::num_volume_integration_points; ++qp) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(getElementPointData(element, qp, node_positions_begin, node_positions_end,
+                                                                 std::begin(N), std::end(N), std::begin(dNdx),
+                                                                 std::end(dNdx), Jxw, configuration));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(interpolateElementValues<dim>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), dof_dot_begin, dof_dot_end,
+                    std::begin(point_dof_dot), std::end(point_dof_dot)));
+
+                std::fill(std::begin(point_jacobian), std::end(point_jacobian), jacobian_type());
+
+                for (unsigned int s = 0; s < num_virtual; ++s) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH((constraintEquations::computeDisplacementConstraint<dim>(
+                        std::cbegin(point_dof_dot) + displacement_offset,
+                        std::cbegin(point_dof_dot) + displacement_offset + num_rows,
+                        std::cbegin(point_dof_dot) + velocity_offset,
+                        std::cbegin(point_dof_dot) + velocity_offset + num_rows, virtual_N[0], virtual_N[s],
+                        std::cbegin(virtual_dNdx) + dim * s, std::cbegin(virtual_dNdx) + dim * (s + 1), dDotdDOF,
+                        std::begin(block.result), std::end(block.result), std::begin(dRdD), std::end(dRdD),
+                        std::begin(dRdV), std::end(dRdV), std::begin(dRdUMesh), std::end(dRdUMesh))));
+
+                    if (s == 0) {
+                        std::copy(std::cbegin(block.result), std::cend(block.result), std::begin(point_residual));
+                    }
+
+                    // The velocity is the rate of the spatial degree of freedom
+                    for (unsigned int r = 0; r < num_rows; ++r) {
+                        block.dRdW[num_rows * r + r] = dRdD[r];
+
+                        block.dRdU[num_rows * r + r] = dRdV[r] * dDotdDOF;
+                    }
+
+                    block.addTo(std::begin(point_jacobian) + block_size * s,
+                                std::begin(point_jacobian) + block_size * (s + 1));
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementResidual<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_residual),
+                    std::cend(point_residual), displacement_offset, Jxw, residual_begin, residual_end)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH((integrateElementJacobian<dim, num_dof, num_rows, 1>(
+                    std::cbegin(N), std::cend(N), std::cbegin(dNdx), std::cend(dNdx), std::cbegin(point_jacobian),
+                    std::cend(point_jacobian), displacement_offset, Jxw, jacobian_begin, jacobian_end)));
+            }
+        }
+
+    }  // namespace meshAssembly
+
+}  // namespace tardigradeBalanceEquations
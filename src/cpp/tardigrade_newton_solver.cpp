@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_newton_solver.cpp
+ ******************************************************************************
+ * The source file for the nonlinear solution of the assembled balance
+ * equations by Newton's method
+ ******************************************************************************
+ */
+
+#include "tardigrade_newton_solver.h"
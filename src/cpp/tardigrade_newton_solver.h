@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_newton_solver.h
+ ******************************************************************************
+ * The header file for the nonlinear solution of the assembled balance
+ * equations by Newton's method. The assembly of the Jacobian and the setup
+ * of the linear solver are usually the most expensive parts of an iteration
+ * of the coupled mass, momentum, and energy system so the solver supports
+ * modified Newton iterations which reuse the Jacobian and the linear solver
+ * setup for several iterations and a backtracking line search which only
+ * evaluates the residual. The time spent in the residual, the Jacobian, the
+ * linear solver setup, and the linear solve is recorded for each solve.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_NEWTON_SOLVER_H
+#define TARDIGRADE_NEWTON_SOLVER_H
+
+#include <Eigen/Sparse>
+#include <vector>
+
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace newtonSolver {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        typedef meshAssembly::floatType floatType;  //!< Define the float type to be the same as the mesh assembly
+
+        /*!
+         * The options of the Newton solver
+         */
+        struct NewtonOptions {
+            unsigned int max_iterations = 20;  //!< The maximum number of iterations
+
+            floatType absolute_tolerance = 1e-9;  //!< The absolute tolerance of the residual norm
+
+            floatType relative_tolerance = 1e-9;  //!< The tolerance of the residual norm relative to the initial norm
+
+            //! The maximum number of iterations a Jacobian and the linear solver setup are used for. One is full
+            //! Newton and larger values are modified Newton.
+            unsigned int max_jacobian_age = 1;
+
+            //! A reused Jacobian is rebuilt when the ratio of the new to the old residual norm is larger than this
+            floatType max_contraction = 0.5;
+
+            bool line_search = false;  //!< Flag indicating that a backtracking line search should be used
+
+            unsigned int max_line_search_iterations = 10;  //!< The maximum number of backtracking steps
+
+            floatType line_search_reduction = 0.5;  //!< The factor the step length is multiplied by when backtracking
+
+            floatType sufficient_decrease = 1e-4;  //!< The sufficient decrease parameter of the line search
+        };
+
+        /*!
+         * The convergence history and the instrumentation of a Newton solve. The times are in seconds.
+         */
+        struct NewtonStatistics {
+            bool converged = false;  //!< Flag indicating that the solve converged
+
+            unsigned int iterations = 0;  //!< The number of accepted Newton steps
+
+            unsigned int residual_evaluations = 0;  //!< The number of residual-only evaluations
+
+            unsigned int jacobian_evaluations = 0;  //!< The number of residual and Jacobian evaluations
+
+            unsigned int line_search_backtracks = 0;  //!< The number of step length reductions
+
+            double residual_time = 0;  //!< The time spent evaluating residuals
+
+            double jacobian_time = 0;  //!< The time spent evaluating residuals and Jacobians
+
+            double setup_time = 0;  //!< The time spent setting up the linear solver e.g., factorizing
+
+            double solve_time = 0;  //!< The time spent solving the linear systems
+
+            std::vector<floatType> residual_norms;  //!< The residual norm at the start of each iteration and at the end
+        };
+
+        /*!
+         * A direct sparse LU linear solver for the CSR Jacobian. The ordering and the symbolic factorization are
+         * computed for the first matrix and reused for later matrices with the same sparsity pattern.
+         */
+        template <typename T>
+        class SparseLUSolver {
+           public:
+            /*!
+             * Default constructor
+             */
+            SparseLUSolver() : _row_offsets(), _column_indices(), _value_map(), _matrix(), _lu() {}
+
+            void compute(const meshAssembly::CSRMatrix<T> &matrix);
+
+            template <class b_iter, class x_iter>
+            void solve(const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end);
+
+           protected:
+            std::vector<size_type> _row_offsets;  //!< The row offsets of the analyzed matrix
+
+            std::vector<size_type> _column_indices;  //!< The column indices of the analyzed matrix
+
+            std::vector<size_type> _value_map;  //!< The CSR value offset of each column-major value
+
+            Eigen::SparseMatrix<T> _matrix;  //!< The column-major copy of the matrix
+
+            Eigen::SparseLU<Eigen::SparseMatrix<T>, Eigen::COLAMDOrdering<int>> _lu;  //!< The factorization
+        };
+
+        template <class residual_function, class jacobian_function, class jacobian_type, class linear_solver,
+                  class dof_iter>
+        NewtonStatistics solve(residual_function &residual, jacobian_function &residual_and_jacobian,
+                               jacobian_type &jacobian, linear_solver &solver, dof_iter dof_begin, dof_iter dof_end,
+                               const NewtonOptions &options = NewtonOptions());
+
+    }  // namespace newtonSolver
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_newton_solver.tpp"
+
+#endif
@@ -0,0 +1,312 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_newton_solver.tpp
+ ******************************************************************************
+ * The template file for the nonlinear solution of the assembled balance
+ * equations by Newton's method
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+#include "tardigrade_newton_solver.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace newtonSolver {
+
+        /*!
+         * Factorize a CSR matrix. The pattern of the matrix is analyzed when it is the first matrix or its sparsity
+         * pattern differs from the pattern of the last analyzed matrix. Otherwise only the numeric factorization is
+         * computed.
+         *
+         * \param &matrix: The square matrix to factorize
+         */
+        template <typename T>
+        void SparseLUSolver<T>::compute(const meshAssembly::CSRMatrix<T> &matrix) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(matrix.getNumRows() == matrix.getNumColumns(), "The matrix must be square")
+
+            typedef typename Eigen::SparseMatrix<T>::StorageIndex storage_index;
+
+            const std::vector<size_type> &row_offsets    = matrix.getRowOffsets();
+            const std::vector<size_type> &column_indices = matrix.getColumnIndices();
+            const std::vector<T>         &values         = matrix.getValues();
+
+            const bool analyze = _value_map.empty() || (row_offsets != _row_offsets) ||
+                                 (column_indices != _column_indices);
+
+            if (analyze) {
+                const size_type num_rows = matrix.getNumRows();
+
+                _matrix.resize(num_rows, matrix.getNumColumns());
+
+                _matrix.resizeNonZeros(matrix.getNumNonZeros());
+
+                storage_index *column_offsets = _matrix.outerIndexPtr();
+
+                storage_index *row_indices = _matrix.innerIndexPtr();
+
+                // Count the entries of each column and accumulate the counts into the column offsets
+                std::fill(column_offsets, column_offsets + num_rows + 1, storage_index(0));
+
+                for (size_type k = 0; k < matrix.getNumNonZeros(); ++k) {
+                    ++column_offsets[column_indices[k] + 1];
+                }
+
+                for (size_type column = 0; column < num_rows; ++column) {
+                    column_offsets[column + 1] += column_offsets[column];
+                }
+
+                // Place the entries row by row so that the rows of each column are in increasing order
+                std::vector<storage_index> next(column_offsets, column_offsets + num_rows);
+
+                _value_map.resize(matrix.getNumNonZeros());
+
+                for (size_type row = 0; row < num_rows; ++row) {
+                    for (size_type k = row_offsets[row]; k < row_offsets[row + 1]; ++k) {
+                        const storage_index position = next[column_indices[k]]++;
+
+                        row_indices[position] = (storage_index)row;
+
+                        _value_map[position] = k;
+                    }
+                }
+
+                _row_offsets = row_offsets;
+
+                _column_indices = column_indices;
+            }
+
+            for (size_type k = 0; k < _value_map.size(); ++k) {
+                _matrix.valuePtr()[k] = values[_value_map[k]];
+            }
+
+            if (analyze) {
+                _lu.analyzePattern(_matrix);
+            }
+
+            _lu.factorize(_matrix);
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(_lu.info() == Eigen::Success,
+                                         "The factorization of the matrix failed: " + _lu.lastErrorMessage())
+        }
+
+        /*!
+         * Solve \f$ A x = b \f$ with the factorization of the last matrix
+         *
+         * \param &b_begin: The starting iterator of the right hand side
+         * \param &b_end: The stopping iterator of the right hand side
+         * \param x_begin: The starting iterator of the solution
+         * \param x_end: The stopping iterator of the solution
+         */
+        template <typename T>
+        template <class b_iter, class x_iter>
+        void SparseLUSolver<T>::solve(const b_iter &b_begin, const b_iter &b_end, x_iter x_begin, x_iter x_end) {
+            using vector_type = Eigen::Matrix<T, Eigen::Dynamic, 1>;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((b_end - b_begin) == _matrix.rows(),
+                                         "The right hand side must have a size equal to the number of rows")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((x_end - x_begin) == _matrix.rows(),
+                                         "The solution must have a size equal to the number of rows")
+
+            vector_type b(_matrix.rows());
+
+            std::copy(b_begin, b_end, b.data());
+
+            vector_type x = _lu.solve(b);
+
+            std::copy(x.data(), x.data() + x.size(), x_begin);
+        }
+
+        /*!
+         * Solve a nonlinear system \f$ R( u ) = 0 \f$ by Newton's method starting from the current degrees of
+         * freedom. The residual is evaluated with
+         *
+         * residual( dof_begin, dof_end, residual_begin, residual_end )
+         *
+         * and the residual and the Jacobian are evaluated together with
+         *
+         * residual_and_jacobian( dof_begin, dof_end, residual_begin, residual_end, jacobian )
+         *
+         * so that the residual-only element kernels are used wherever the Jacobian is not needed. The linear solver
+         * is set up for a Jacobian with
+         *
+         * solver.compute( jacobian )
+         *
+         * and solves for the Newton update with
+         *
+         * solver.solve( b_begin, b_end, x_begin, x_end )
+         *
+         * The Jacobian and the solver setup are reused for up to options.max_jacobian_age iterations and are rebuilt
+         * early when the residual norm does not contract by options.max_contraction. With the line search the step
+         * length is reduced until the residual norm satisfies the sufficient decrease condition
+         *
+         * \f$ \| R( u + \alpha \Delta u ) \| \leq ( 1 - c \alpha ) \| R( u ) \| \f$
+         *
+         * If a step fails with a reused Jacobian the step is repeated with a new Jacobian. If the line search fails
+         * with a new Jacobian the shortest step is taken. The solve stops without converging if the residual of a step
+         * is not finite.
+         *
+         * \param &residual: The function evaluating the residual
+         * \param &residual_and_jacobian: The function evaluating the residual and the Jacobian
+         * \param &jacobian: The Jacobian storage e.g., a CSR matrix built for the mesh
+         * \param &solver: The linear solver
+         * \param dof_begin: The starting iterator of the degrees of freedom which are updated in place
+         * \param dof_end: The stopping iterator of the degrees of freedom which are updated in place
+         * \param &options: The options of the solver
+         */
+        template <class residual_function, class jacobian_function, class jacobian_type, class linear_solver,
+                  class dof_iter>
+        NewtonStatistics solve(residual_function &residual, jacobian_function &residual_and_jacobian,
+                               jacobian_type &jacobian, linear_solver &solver, dof_iter dof_begin, dof_iter dof_end,
+                               const NewtonOptions &options) {
+            using dof_type = typename std::iterator_traits<dof_iter>::value_type;
+            using clock    = std::chrono::steady_clock;
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(options.max_jacobian_age > 0, "The maximum Jacobian age must be positive")
+
+            const size_type num_dof = (size_type)(dof_end - dof_begin);
+
+            NewtonStatistics statistics;
+
+            std::vector<dof_type> r(num_dof), r_trial(num_dof), r_scratch(num_dof), delta(num_dof), dof_old(num_dof);
+
+            auto timed = [](double &total, auto &&function) {
+                const auto start = clock::now();
+
+                function();
+
+                total += std::chrono::duration<double>(clock::now() - start).count();
+            };
+
+            auto norm = [](const std::vector<dof_type> &v) {
+                floatType sum = 0;
+
+                for (const auto &value : v) {
+                    sum += value * value;
+                }
+
+                return std::sqrt(sum);
+            };
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(
+                timed(statistics.residual_time, [&] { residual(dof_begin, dof_end, std::begin(r), std::end(r)); }));
+
+            ++statistics.residual_evaluations;
+
+            floatType r_norm = norm(r);
+
+            statistics.residual_norms.push_back(r_norm);
+
+            const floatType tolerance = std::max(options.absolute_tolerance, options.relative_tolerance * r_norm);
+
+            unsigned int jacobian_age = options.max_jacobian_age;
+
+            while (true) {
+                if (r_norm <= tolerance) {
+                    statistics.converged = true;
+
+                    break;
+                }
+
+                if (statistics.iterations >= options.max_iterations) {
+                    break;
+                }
+
+                const bool fresh_jacobian = jacobian_age >= options.max_jacobian_age;
+
+                if (fresh_jacobian) {
+                    TARDIGRADE_ERROR_TOOLS_CATCH(timed(statistics.jacobian_time, [&] {
+                        residual_and_jacobian(dof_begin, dof_end, std::begin(r_scratch), std::end(r_scratch),
+                                              jacobian);
+                    }));
+
+                    ++statistics.jacobian_evaluations;
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(timed(statistics.setup_time, [&] { solver.compute(jacobian); }));
+
+                    jacobian_age = 0;
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(timed(statistics.solve_time, [&] {
+                    solver.solve(std::cbegin(r), std::cend(r), std::begin(delta), std::end(delta));
+                }));
+
+                std::copy(dof_begin, dof_end, std::begin(dof_old));
+
+                floatType alpha = 1;
+
+                floatType trial_norm = 0;
+
+                bool accepted = false;
+
+                for (unsigned int step = 0; step <= options.max_line_search_iterations; ++step) {
+                    for (size_type i = 0; i < num_dof; ++i) {
+                        *(dof_begin + i) = dof_old[i] - alpha * delta[i];
+                    }
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH(timed(statistics.residual_time, [&] {
+                        residual(dof_begin, dof_end, std::begin(r_trial), std::end(r_trial));
+                    }));
+
+                    ++statistics.residual_evaluations;
+
+                    trial_norm = norm(r_trial);
+
+                    if (std::isfinite(trial_norm) &&
+                        (!options.line_search || (trial_norm <= (1 - options.sufficient_decrease * alpha) * r_norm))) {
+                        accepted = true;
+
+                        break;
+                    }
+
+                    if (!options.line_search || (step == options.max_line_search_iterations)) {
+                        break;
+                    }
+
+                    alpha *= options.line_search_reduction;
+
+                    ++statistics.line_search_backtracks;
+                }
+
+                if (!accepted) {
+                    if (!fresh_jacobian) {
+                        std::copy(std::cbegin(dof_old), std::cend(dof_old), dof_begin);
+
+                        jacobian_age = options.max_jacobian_age;
+
+                        continue;
+                    }
+
+                    if (!std::isfinite(trial_norm)) {
+                        std::copy(std::cbegin(dof_old), std::cend(dof_old), dof_begin);
+
+                        break;
+                    }
+                }
+
+                ++statistics.iterations;
+
+                ++jacobian_age;
+
+                if (trial_norm > options.max_contraction * r_norm) {
+                    jacobian_age = options.max_jacobian_age;
+                }
+
+                std::swap(r, r_trial);
+
+                r_norm = trial_norm;
+
+                statistics.residual_norms.push_back(r_norm);
+            }
+
+            return statistics;
+        }
+
+    }  // namespace newtonSolver
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_phase_parallel.cpp
+ ******************************************************************************
+ * The source file for evaluating the phases of a multiphase material point
+ * in parallel
+ ******************************************************************************
+ */
+
+#include "tardigrade_phase_parallel.h"
@@ -0,0 +1,40 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_phase_parallel.h
+ ******************************************************************************
+ * The header file for evaluating the phases of a multiphase material point
+ * in parallel. The phases of the multiphase overloads are independent of
+ * each other so they may be distributed over the threads of a thread pool
+ * when the number of phases and the work per phase are large enough to pay
+ * for the dispatch. The threads are owned by the pool so that no threads are
+ * created by the kernels of a single point. The overloads of the multiphase
+ * kernels which take a thread pool are defined here so that the kernels
+ * themselves do not depend on the thread pool.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_PHASE_PARALLEL_H
+#define TARDIGRADE_PHASE_PARALLEL_H
+
+#include "tardigrade_balance_of_energy.h"
+#include "tardigrade_balance_of_mass.h"
+#include "tardigrade_error_tools.h"
+#include "tardigrade_thread_pool.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace phaseParallel {
+
+        constexpr unsigned int default_min_threaded_phases = 4;  //!< The default number of phases to start threading
+
+        template <class phase_function>
+        void forEachPhase(const unsigned int nphases, threadPool::ThreadPool *pool, phase_function function,
+                          const unsigned int min_threaded_phases = default_min_threaded_phases);
+
+    }  // namespace phaseParallel
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_phase_parallel.tpp"
+
+#endif
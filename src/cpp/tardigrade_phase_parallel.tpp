@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_phase_parallel.tpp
+ ******************************************************************************
+ * The template file for evaluating the phases of a multiphase material point
+ * in parallel
+ ******************************************************************************
+ */
+
+#include <algorithm>
+
+#include "tardigrade_phase_parallel.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace phaseParallel {
+
+        /*!
+         * Call a function for each of the phases. If a thread pool is given and there are at least
+         * min_threaded_phases phases the phases are distributed over the threads of the pool where the calling thread
+         * evaluates phases as well. The pool may be the pool the calling element or batch loop is running on. The
+         * function must only write to the outputs of the phase it is called with. Any exception thrown by the function
+         * is re-thrown on the calling thread after all of the phases have finished.
+         *
+         * \param nphases: The number of phases
+         * \param *pool: The thread pool. The phases are evaluated in order on the calling thread if it is null
+         * \param function: The function to call which takes the phase as its only argument
+         * \param min_threaded_phases: The smallest number of phases which will be distributed over the pool
+         */
+        template <class phase_function>
+        void forEachPhase(const unsigned int nphases, threadPool::ThreadPool *pool, phase_function function,
+                          const unsigned int min_threaded_phases) {
+            if ((pool == nullptr) || (pool->getNumThreads() < 2) || (nphases < std::max(min_threaded_phases, 2u))) {
+                for (unsigned int phase = 0; phase < nphases; ++phase) {
+                    function(phase);
+                }
+
+                return;
+            }
+
+            pool->parallelFor(nphases, 1, [&](const unsigned int, const threadPool::size_type phase) {
+                function((unsigned int)phase);
+            });
+        }
+
+    }  // namespace phaseParallel
+
+    namespace balanceOfMass {
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  class density_iter, class densityDot_iter, class result_iter, typename testFunction_type,
+                  typename interpolationFunction_type, class densityGradient_iter, class velocity_iter,
+                  class velocityGradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class interpolationFunctionGradient_iter, class full_material_response_dof_gradient_iter,
+                  class dRdRho_iter, class dRdU_iter, class dRdW_iter, class dRdTheta_iter, class dRdE_iter,
+                  class dRdVF_iter, class dRdZ_iter, class dRdUMesh_iter, typename dDensityDotdDensity_type,
+                  typename dUDotdU_type, int density_index, int displacement_index, int velocity_index,
+                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index>
+        void computeBalanceOfMass(
+            const density_iter &density_begin, const density_iter &density_end,
+            const densityDot_iter &density_dot_begin, const densityDot_iter &density_dot_end,
+            const densityGradient_iter &density_gradient_begin, const densityGradient_iter &density_gradient_end,
+            const velocity_iter &velocity_begin, const velocity_iter &velocity_end,
+            const velocityGradient_iter &velocity_gradient_begin, const velocityGradient_iter &velocity_gradient_end,
+            const material_response_iter &material_response_begin, const material_response_iter &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const testFunction_type &test_function, const interpolationFunction_type &interpolation_function,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_begin,
+            const interpolationFunctionGradient_iter       &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dDensityDotdDensity_type &dDensityDotdDensity, const dUDotdU_type &dUDotdU, result_iter result_begin,
+            result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end, dRdU_iter dRdU_begin,
+            dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end, dRdTheta_iter dRdTheta_begin,
+            dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end, dRdVF_iter dRdVF_begin,
+            dRdVF_iter dRdVF_end, dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin,
+            dRdUMesh_iter dRdUMesh_end, threadPool::ThreadPool *pool) {
+            /*!
+             * Compute the balance of mass of all of the phases where the phases are distributed over a thread pool
+             * with forEachPhase. See computeBalanceOfMassPhaseLoop for the remaining parameters
+             *
+             * \param *pool: The thread pool the phases are distributed over. The phases are evaluated in order on
+             * the calling thread if it is null
+             */
+
+            computeBalanceOfMassPhaseLoop<
+                dim, material_response_dim, mass_change_index, material_response_num_dof, density_iter, densityDot_iter,
+                result_iter, testFunction_type, interpolationFunction_type, densityGradient_iter, velocity_iter,
+                velocityGradient_iter, material_response_iter, material_response_jacobian_iter,
+                interpolationFunctionGradient_iter, full_material_response_dof_gradient_iter, dRdRho_iter, dRdU_iter,
+                dRdW_iter, dRdTheta_iter, dRdE_iter, dRdVF_iter, dRdZ_iter, dRdUMesh_iter, dDensityDotdDensity_type,
+                dUDotdU_type, density_index, displacement_index, velocity_index, temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index>(
+                density_begin, density_end, density_dot_begin, density_dot_end, density_gradient_begin,
+                density_gradient_end, velocity_begin, velocity_end, velocity_gradient_begin, velocity_gradient_end,
+                material_response_begin, material_response_end, material_response_jacobian_begin,
+                material_response_jacobian_end, test_function, interpolation_function,
+                interpolation_function_gradient_begin, interpolation_function_gradient_end,
+                full_material_response_dof_gradient_begin, full_material_response_dof_gradient_end, dDensityDotdDensity,
+                dUDotdU, result_begin, result_end, dRdRho_begin, dRdRho_end, dRdU_begin, dRdU_end, dRdW_begin, dRdW_end,
+                dRdTheta_begin, dRdTheta_end, dRdE_begin, dRdE_end, dRdVF_begin, dRdVF_end, dRdZ_begin, dRdZ_end,
+                dRdUMesh_begin, dRdUMesh_end,
+                [pool](const unsigned int nphases, auto function) {
+                    phaseParallel::forEachPhase(nphases, pool, function);
+                });
+        }
+
+    }  // namespace balanceOfMass
+
+    namespace balanceOfEnergy {
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, class density_iter,
+                  class density_dot_iter, class density_gradient_iter, class internal_energy_iter,
+                  class internal_energy_dot_iter, class internal_energy_gradient_iter, class velocity_iter,
+                  class velocity_gradient_iter, class material_response_iter, class material_response_jacobian_iter,
+                  class volume_fraction_iter, typename test_function_type, class test_function_gradient_iter,
+                  typename interpolation_function_type, class interpolation_function_gradient_iter,
+                  class full_material_response_dof_gradient_iter, typename dRhoDotdRho_type, typename dEDotdE_type,
+                  typename dUDotdU_type, class result_iter, class dRdRho_iter, class dRdU_iter, class dRdW_iter,
+                  class dRdTheta_iter, class dRdE_iter, class dRdVolumeFraction_iter, class dRdZ_iter,
+                  class dRdUMesh_iter, int density_index, int displacement_index, int velocity_index,
+                  int temperature_index, int internal_energy_index, int volume_fraction_index, int additional_dof_index>
+        void computeBalanceOfEnergy(
+            const density_iter &density_begin, const density_iter &density_end,
+            const density_dot_iter &density_dot_begin, const density_dot_iter &density_dot_end,
+            const density_gradient_iter &density_gradient_begin, const density_gradient_iter &density_gradient_end,
+            const internal_energy_iter &internal_energy_begin, const internal_energy_iter &internal_energy_end,
+            const internal_energy_dot_iter      &internal_energy_dot_begin,
+            const internal_energy_dot_iter      &internal_energy_dot_end,
+            const internal_energy_gradient_iter &internal_energy_gradient_begin,
+            const internal_energy_gradient_iter &internal_energy_gradient_end, const velocity_iter &velocity_begin,
+            const velocity_iter &velocity_end, const velocity_gradient_iter &velocity_gradient_begin,
+            const velocity_gradient_iter &velocity_gradient_end, const material_response_iter &material_response_begin,
+            const material_response_iter          &material_response_end,
+            const material_response_jacobian_iter &material_response_jacobian_begin,
+            const material_response_jacobian_iter &material_response_jacobian_end,
+            const volume_fraction_iter &volume_fraction_begin, const volume_fraction_iter &volume_fraction_end,
+            const test_function_type &test_function, const test_function_gradient_iter &test_function_gradient_begin,
+            const test_function_gradient_iter              &test_function_gradient_end,
+            const interpolation_function_type              &interpolation_function,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_begin,
+            const interpolation_function_gradient_iter     &interpolation_function_gradient_end,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_begin,
+            const full_material_response_dof_gradient_iter &full_material_response_dof_gradient_end,
+            const dRhoDotdRho_type &dRhoDotdRho, const dEDotdE_type dEDotdE, const dUDotdU_type &dUDotdU,
+            result_iter result_begin, result_iter result_end, dRdRho_iter dRdRho_begin, dRdRho_iter dRdRho_end,
+            dRdU_iter dRdU_begin, dRdU_iter dRdU_end, dRdW_iter dRdW_begin, dRdW_iter dRdW_end,
+            dRdTheta_iter dRdTheta_begin, dRdTheta_iter dRdTheta_end, dRdE_iter dRdE_begin, dRdE_iter dRdE_end,
+            dRdVolumeFraction_iter dRdVolumeFraction_begin, dRdVolumeFraction_iter dRdVolumeFraction_end,
+            dRdZ_iter dRdZ_begin, dRdZ_iter dRdZ_end, dRdUMesh_iter dRdUMesh_begin, dRdUMesh_iter dRdUMesh_end,
+            threadPool::ThreadPool *pool) {
+            /*!
+             * Compute the balance of energy of all of the phases where the phases are distributed over a thread pool
+             * with forEachPhase. See computeBalanceOfEnergyPhaseLoop for the remaining parameters
+             *
+             * \param *pool: The thread pool the phases are distributed over. The phases are evaluated in order on
+             * the calling thread if it is null
+             */
+
+            computeBalanceOfEnergyPhaseLoop<
+                dim, is_per_unit_volume, material_response_dim, cauchy_stress_index, internal_heat_generation_index,
+                heat_flux_index, interphasic_force_index, interphasic_heat_transfer_index, material_response_num_dof,
+                density_iter, density_dot_iter, density_gradient_iter, internal_energy_iter, internal_energy_dot_iter,
+                internal_energy_gradient_iter, velocity_iter, velocity_gradient_iter, material_response_iter,
+                material_response_jacobian_iter, volume_fraction_iter, test_function_type, test_function_gradient_iter,
+                interpolation_function_type, interpolation_function_gradient_iter,
+                full_material_response_dof_gradient_iter, dRhoDotdRho_type, dEDotdE_type, dUDotdU_type, result_iter,
+                dRdRho_iter, dRdU_iter, dRdW_iter, dRdTheta_iter, dRdE_iter, dRdVolumeFraction_iter, dRdZ_iter,
+                dRdUMesh_iter, density_index, displacement_index, velocity_index, temperature_index,
+                internal_energy_index, volume_fraction_index, additional_dof_index>(
+                density_begin, density_end, density_dot_begin, density_dot_end, density_gradient_begin,
+                density_gradient_end, internal_energy_begin, internal_energy_end, internal_energy_dot_begin,
+                internal_energy_dot_end, internal_energy_gradient_begin, internal_energy_gradient_end, velocity_begin,
+                velocity_end, velocity_gradient_begin, velocity_gradient_end, material_response_begin,
+                material_response_end, material_response_jacobian_begin, material_response_jacobian_end,
+                volume_fraction_begin, volume_fraction_end, test_function, test_function_gradient_begin,
+                test_function_gradient_end, interpolation_function, interpolation_function_gradient_begin,
+                interpolation_function_gradient_end, full_material_response_dof_gradient_begin,
+                full_material_response_dof_gradient_end, dRhoDotdRho, dEDotdE, dUDotdU, result_begin, result_end,
+                dRdRho_begin, dRdRho_end, dRdU_begin, dRdU_end, dRdW_begin, dRdW_end, dRdTheta_begin, dRdTheta_end,
+                dRdE_begin, dRdE_end, dRdVolumeFraction_begin, dRdVolumeFraction_end, dRdZ_begin, dRdZ_end,
+                dRdUMesh_begin, dRdUMesh_end,
+                [pool](const unsigned int nphases, auto function) {
+                    phaseParallel::forEachPhase(nphases, pool, function);
+                });
+        }
+
+    }  // namespace balanceOfEnergy
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_point_state_store.cpp
+ ******************************************************************************
+ * The source file for the storage of the state of the integration points of
+ * a mesh
+ ******************************************************************************
+ */
+
+#include "tardigrade_point_state_store.h"
@@ -0,0 +1,228 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_point_state_store.h
+ ******************************************************************************
+ * The header file for the storage of the state of the integration points of
+ * a mesh e.g., the history variables of the material, the degrees of
+ * freedom of the previous step, and cached material responses. The values
+ * of every field of every point are stored in one contiguous arena as
+ * structures of arrays indexed by the element and the integration point so
+ * that batches of points may be passed to the material providers without
+ * copies. The store holds the state at the start of the step (time n) and
+ * the state being computed (time n + 1) and accepting a step swaps them in
+ * constant time. The arena may be a memory-mapped file so that the states
+ * of very large meshes are paged by the operating system.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_POINT_STATE_STORE_H
+#define TARDIGRADE_POINT_STATE_STORE_H
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "tardigrade_error_policy.h"
+#include "tardigrade_error_tools.h"
+#include "tardigrade_material_provider.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace pointStateStore {
+
+        typedef materialProvider::size_type size_type;  //!< The type of the indices of the points and components
+
+        constexpr std::size_t arena_alignment = 64;  //!< The alignment in bytes of the arena and of each field
+
+        /*!
+         * A zero-initialized block of memory aligned to arena_alignment which is either allocated on the heap or
+         * mapped from a file. A mapped file is truncated when the arena is created and is only a backing store i.e.,
+         * it is not a restart file.
+         */
+        class Arena {
+           public:
+            /*!
+             * Default constructor for an empty arena
+             */
+            Arena() : _data(nullptr), _bytes(0), _mapped(false) {}
+
+            inline explicit Arena(const std::size_t bytes);
+
+            inline Arena(const std::size_t bytes, const std::string &path);
+
+            inline Arena(Arena &&other);
+
+            inline Arena &operator=(Arena &&other);
+
+            Arena(const Arena &) = delete;
+
+            Arena &operator=(const Arena &) = delete;
+
+            inline ~Arena();
+
+            //! Get the first byte of the arena
+            void *data() const { return _data; }
+
+            //! Get the number of bytes of the arena
+            std::size_t size() const { return _bytes; }
+
+            //! Check if the arena is mapped from a file
+            bool isMapped() const { return _mapped; }
+
+            inline void sync();
+
+           protected:
+            inline void release();
+
+            void *_data;  //!< The first byte of the arena
+
+            std::size_t _bytes;  //!< The number of bytes of the arena
+
+            bool _mapped;  //!< Flag indicating that the arena is mapped from a file
+        };
+
+        /*!
+         * The state of the integration points of a mesh at time n (previous) and at time n + 1 (current). Each field
+         * has a fixed number of components at every point and is stored as a structure of arrays over all of the
+         * points of the mesh i.e., the values of one component of the points are contiguous. The points are numbered
+         * element by element so that point points_per_element * element + qp is integration point qp of element.
+         *
+         * The values of the current state are computed from the previous state during a step. acceptStep makes the
+         * current state the previous state of the next step by swapping the two and rejectStep restores the current
+         * state from the previous state.
+         */
+        template <typename T>
+        class PointStateStore {
+            static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_default_constructible<T>::value,
+                          "The values of the store must be trivial since they are stored in raw memory");
+
+           public:
+            PointStateStore(const size_type num_elements, const size_type points_per_element,
+                            const std::vector<size_type> &field_sizes);
+
+            PointStateStore(const size_type num_elements, const size_type points_per_element,
+                            const std::vector<size_type> &field_sizes, const std::string &path);
+
+            //! Get the number of elements
+            size_type getNumElements() const { return _num_elements; }
+
+            //! Get the number of integration points of an element
+            size_type getPointsPerElement() const { return _points_per_element; }
+
+            //! Get the number of points of the mesh
+            size_type getNumPoints() const { return _num_elements * _points_per_element; }
+
+            //! Get the number of fields
+            size_type getNumFields() const { return _field_sizes.size(); }
+
+            /*!
+             * Get the number of components of a field at a point
+             *
+             * \param field: The field
+             */
+            size_type getFieldSize(const size_type field) const { return _field_sizes[field]; }
+
+            //! Get the number of bytes of the arena
+            std::size_t getMemoryBytes() const { return _arena.size(); }
+
+            //! Check if the arena is mapped from a file
+            bool isMapped() const { return _arena.isMapped(); }
+
+            /*!
+             * Get the index of an integration point of an element
+             *
+             * \param element: The element
+             * \param qp: The integration point
+             */
+            size_type getPointIndex(const size_type element, const size_type qp) const {
+                return _points_per_element * element + qp;
+            }
+
+            /*!
+             * Get the values of a field of all of the points at time n
+             *
+             * \param field: The field
+             */
+            materialProvider::PointArray<const T> getPrevious(const size_type field) const {
+                return getField(1 - _current, field);
+            }
+
+            /*!
+             * Get the values of a field of all of the points at time n + 1
+             *
+             * \param field: The field
+             */
+            materialProvider::PointArray<T> getCurrent(const size_type field) { return getField(_current, field); }
+
+            /*!
+             * Get the value of a component of a field of an integration point at time n
+             *
+             * \param field: The field
+             * \param component: The component of the field
+             * \param element: The element
+             * \param qp: The integration point
+             */
+            const T &previous(const size_type field, const size_type component, const size_type element,
+                              const size_type qp) const {
+                return getField(1 - _current, field)(component, getPointIndex(element, qp));
+            }
+
+            /*!
+             * Get the value of a component of a field of an integration point at time n + 1
+             *
+             * \param field: The field
+             * \param component: The component of the field
+             * \param element: The element
+             * \param qp: The integration point
+             */
+            T &current(const size_type field, const size_type component, const size_type element, const size_type qp) {
+                return getField(_current, field)(component, getPointIndex(element, qp));
+            }
+
+            template <class value_iter>
+            void getPreviousPoint(const size_type field, const size_type element, const size_type qp,
+                                  value_iter value_begin, value_iter value_end) const;
+
+            template <class value_iter>
+            void setCurrentPoint(const size_type field, const size_type element, const size_type qp,
+                                 const value_iter &value_begin, const value_iter &value_end);
+
+            /*!
+             * Accept the step i.e., make the state at time n + 1 the state at time n of the next step. The values of
+             * the new current state are those of the old previous state and are expected to be overwritten.
+             */
+            void acceptStep() { _current = 1 - _current; }
+
+            void rejectStep();
+
+            //! Write the values of a mapped arena to its file
+            void sync() { _arena.sync(); }
+
+           protected:
+            std::size_t initializeLayout();
+
+            materialProvider::PointArray<T> getField(const unsigned int buffer, const size_type field) const;
+
+            size_type _num_elements;  //!< The number of elements
+
+            size_type _points_per_element;  //!< The number of integration points of an element
+
+            std::vector<size_type> _field_sizes;  //!< The number of components of each field
+
+            std::vector<size_type> _field_offsets;  //!< The offsets of the fields in a buffer in values
+
+            size_type _buffer_size;  //!< The number of values of the state at one time including padding
+
+            Arena _arena;  //!< The storage of the two states
+
+            unsigned int _current;  //!< The buffer of the state at time n + 1
+        };
+
+    }  // namespace pointStateStore
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_point_state_store.tpp"
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_point_state_store.tpp
+ ******************************************************************************
+ * The template file for the storage of the state of the integration points
+ * of a mesh
+ ******************************************************************************
+ */
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define TARDIGRADE_POINT_STATE_STORE_HAS_MMAP
+#endif
+
+#include "tardigrade_point_state_store.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace pointStateStore {
+
+        /*!
+         * Constructor for an arena allocated on the heap
+         *
+         * \param bytes: The number of bytes of the arena
+         */
+        inline Arena::Arena(const std::size_t bytes) : _data(nullptr), _bytes(bytes), _mapped(false) {
+            if (_bytes > 0) {
+                _data = ::operator new(_bytes, std::align_val_t(arena_alignment));
+
+                std::memset(_data, 0, _bytes);
+            }
+        }
+
+        /*!
+         * Constructor for an arena mapped from a file. The file is created if it does not exist and is truncated.
+         * Memory mapping requires a POSIX system.
+         *
+         * \param bytes: The number of bytes of the arena
+         * \param &path: The path of the file
+         */
+        inline Arena::Arena(const std::size_t bytes, const std::string &path)
+            : _data(nullptr), _bytes(bytes), _mapped(true) {
+#ifdef TARDIGRADE_POINT_STATE_STORE_HAS_MMAP
+            const int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+
+            if (file < 0) {
+                throw std::runtime_error("The arena file " + path + " could not be opened");
+            }
+
+            if ((_bytes > 0) && (::ftruncate(file, (off_t)_bytes) != 0)) {
+                ::close(file);
+
+                throw std::runtime_error("The arena file " + path + " could not be resized to " +
+                                         std::to_string(_bytes) + " bytes");
+            }
+
+            if (_bytes > 0) {
+                void *data = ::mmap(nullptr, _bytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+                if (data == MAP_FAILED) {
+                    ::close(file);
+
+                    throw std::runtime_error("The arena file " + path + " could not be mapped");
+                }
+
+                _data = data;
+            }
+
+            // The mapping is kept after the file is closed
+            ::close(file);
+#else
+            throw std::runtime_error("Memory-mapped arenas are not supported on this platform");
+#endif
+        }
+
+        /*!
+         * Move constructor
+         *
+         * \param &&other: The arena to take the memory of
+         */
+        inline Arena::Arena(Arena &&other) : _data(other._data), _bytes(other._bytes), _mapped(other._mapped) {
+            other._data   = nullptr;
+            other._bytes  = 0;
+            other._mapped = false;
+        }
+
+        /*!
+         * Move assignment operator
+         *
+         * \param &&other: The arena to take the memory of
+         */
+        inline Arena &Arena::operator=(Arena &&other) {
+            if (this != &other) {
+                release();
+
+                _data   = other._data;
+                _bytes  = other._bytes;
+                _mapped = other._mapped;
+
+                other._data   = nullptr;
+                other._bytes  = 0;
+                other._mapped = false;
+            }
+
+            return *this;
+        }
+
+        //! Destructor which frees or unmaps the memory
+        inline Arena::~Arena() { release(); }
+
+        /*!
+         * Write the values of a mapped arena to its file. Heap arenas are unchanged.
+         */
+        inline void Arena::sync() {
+#ifdef TARDIGRADE_POINT_STATE_STORE_HAS_MMAP
+            if (_mapped && (_data != nullptr)) {
+                ::msync(_data, _bytes, MS_SYNC);
+            }
+#endif
+        }
+
+        /*!
+         * Free or unmap the memory of the arena
+         */
+        inline void Arena::release() {
+            if (_data != nullptr) {
+                if (_mapped) {
+#ifdef TARDIGRADE_POINT_STATE_STORE_HAS_MMAP
+                    ::munmap(_data, _bytes);
+#endif
+                } else {
+                    ::operator delete(_data, std::align_val_t(arena_alignment));
+                }
+            }
+
+            _data   = nullptr;
+            _bytes  = 0;
+            _mapped = false;
+        }
+
+        /*!
+         * Constructor for a store whose arena is allocated on the heap. The values of both states are zero.
+         *
+         * \param num_elements: The number of elements
+         * \param points_per_element: The number of integration points of an element
+         * \param &field_sizes: The number of components of each field at a point
+         */
+        template <typename T>
+        PointStateStore<T>::PointStateStore(const size_type num_elements, const size_type points_per_element,
+                                            const std::vector<size_type> &field_sizes)
+            : _num_elements(num_elements),
+              _points_per_element(points_per_element),
+              _field_sizes(field_sizes),
+              _field_offsets(),
+              _buffer_size(0),
+              _arena(),
+              _current(1) {
+            _arena = Arena(initializeLayout());
+        }
+
+        /*!
+         * Constructor for a store whose arena is mapped from a file. The values of both states are zero.
+         *
+         * \param num_elements: The number of elements
+         * \param points_per_element: The number of integration points of an element
+         * \param &field_sizes: The number of components of each field at a point
+         * \param &path: The path of the file of the arena which is created or truncated
+         */
+        template <typename T>
+        PointStateStore<T>::PointStateStore(const size_type num_elements, const size_type points_per_element,
+                                            const std::vector<size_type> &field_sizes, const std::string &path)
+            : _num_elements(num_elements),
+              _points_per_element(points_per_element),
+              _field_sizes(field_sizes),
+              _field_offsets(),
+              _buffer_size(0),
+              _arena(),
+              _current(1) {
+            _arena = Arena(initializeLayout(), path);
+        }
+
+        /*!
+         * Compute the offsets of the fields in a buffer. Each field starts on a multiple of arena_alignment bytes.
+         * Returns the number of bytes of the arena.
+         */
+        template <typename T>
+        std::size_t PointStateStore<T>::initializeLayout() {
+            static_assert(arena_alignment % sizeof(T) == 0, "The size of the values must divide the alignment");
+
+            constexpr size_type values_per_line = arena_alignment / sizeof(T);
+
+            const size_type num_points = getNumPoints();
+
+            _field_offsets.resize(_field_sizes.size());
+
+            _buffer_size = 0;
+
+            for (size_type field = 0; field < _field_sizes.size(); ++field) {
+                _field_offsets[field] = _buffer_size;
+
+                const size_type field_values = _field_sizes[field] * num_points;
+
+                _buffer_size += ((field_values + values_per_line - 1) / values_per_line) * values_per_line;
+            }
+
+            return 2 * _buffer_size * sizeof(T);
+        }
+
+        /*!
+         * Get the values of a field of all of the points in a buffer
+         *
+         * \param buffer: The buffer
+         * \param field: The field
+         */
+        template <typename T>
+        materialProvider::PointArray<T> PointStateStore<T>::getField(const unsigned int buffer,
+                                                                     const size_type    field) const {
+            TARDIGRADE_BALANCE_EQS_CHECK(field < _field_sizes.size(), "The field ", field, " is not one of the ",
+                                         _field_sizes.size(), " fields of the store")
+
+            T *values = static_cast<T *>(_arena.data()) + _buffer_size * buffer + _field_offsets[field];
+
+            return materialProvider::PointArray<T>(values, _field_sizes[field], getNumPoints());
+        }
+
+        /*!
+         * Get the values of a field of an integration point at time n
+         *
+         * \param field: The field
+         * \param element: The element
+         * \param qp: The integration point
+         * \param value_begin: The starting iterator of the values
+         * \param value_end: The stopping iterator of the values
+         */
+        template <typename T>
+        template <class value_iter>
+        void PointStateStore<T>::getPreviousPoint(const size_type field, const size_type element, const size_type qp,
+                                                  value_iter value_begin, value_iter value_end) const {
+            TARDIGRADE_BALANCE_EQS_CHECK((element < _num_elements) && (qp < _points_per_element), "The point (",
+                                         element, ", ", qp, ") is outside of the store")
+
+            const materialProvider::PointArray<const T> values = getPrevious(field);
+
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(value_end - value_begin) == values.getNumComponents(),
+                                         "The values have a size of ", (size_type)(value_end - value_begin),
+                                         " but the field has a size of ", values.getNumComponents())
+
+            const size_type point = getPointIndex(element, qp);
+
+            for (size_type c = 0; c < values.getNumComponents(); ++c) {
+                *(value_begin + c) = values(c, point);
+            }
+        }
+
+        /*!
+         * Set the values of a field of an integration point at time n + 1
+         *
+         * \param field: The field
+         * \param element: The element
+         * \param qp: The integration point
+         * \param &value_begin: The starting iterator of the values
+         * \param &value_end: The stopping iterator of the values
+         */
+        template <typename T>
+        template <class value_iter>
+        void PointStateStore<T>::setCurrentPoint(const size_type field, const size_type element, const size_type qp,
+                                                 const value_iter &value_begin, const value_iter &value_end) {
+            TARDIGRADE_BALANCE_EQS_CHECK((element < _num_elements) && (qp < _points_per_element), "The point (",
+                                         element, ", ", qp, ") is outside of the store")
+
+            const materialProvider::PointArray<T> values = getCurrent(field);
+
+            TARDIGRADE_BALANCE_EQS_CHECK((size_type)(value_end - value_begin) == values.getNumComponents(),
+                                         "The values have a size of ", (size_type)(value_end - value_begin),
+                                         " but the field has a size of ", values.getNumComponents())
+
+            const size_type point = getPointIndex(element, qp);
+
+            for (size_type c = 0; c < values.getNumComponents(); ++c) {
+                values(c, point) = *(value_begin + c);
+            }
+        }
+
+        /*!
+         * Reject the step i.e., restore the state at time n + 1 to the state at time n so that the step may be
+         * computed again
+         */
+        template <typename T>
+        void PointStateStore<T>::rejectStep() {
+            if (_buffer_size == 0) {
+                return;
+            }
+
+            T *values = static_cast<T *>(_arena.data());
+
+            std::memcpy(values + _buffer_size * _current, values + _buffer_size * (1 - _current),
+                        _buffer_size * sizeof(T));
+        }
+
+    }  // namespace pointStateStore
+
+}  // namespace tardigradeBalanceEquations
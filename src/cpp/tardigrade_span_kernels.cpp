@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_span_kernels.cpp
+ ******************************************************************************
+ * The source file for evaluating the multiphase balance equations on views
+ * whose extents are known at compile time
+ ******************************************************************************
+ */
+
+#include "tardigrade_span_kernels.h"
@@ -0,0 +1,153 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_span_kernels.h
+ ******************************************************************************
+ * The header file for evaluating the multiphase balance equations on views
+ * whose extents are known at compile time. The number of phases and the
+ * size of the material response are deduced from the extents of the views
+ * so the sizes of the inputs and outputs are checked by the compiler, the
+ * loops over the phases have constant bounds, and neither the run time size
+ * checks nor the divisions which recover the number of phases from the
+ * iterator distances of the multiphase kernels are required.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_SPAN_KERNELS_H
+#define TARDIGRADE_SPAN_KERNELS_H
+
+#include "tardigrade_balance_of_energy.h"
+#include "tardigrade_balance_of_linear_momentum.h"
+#include "tardigrade_balance_of_mass.h"
+#include "tardigrade_fixed_span.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace spanKernels {
+
+        typedef fixedSpan::size_type size_type;  //!< The type of the extents
+
+        template <typename T, size_type... extents>
+        using Input = fixedSpan::FixedSpan<const T, extents...>;  //!< A read only view of an input
+
+        template <typename T, size_type... extents>
+        using Output = fixedSpan::FixedSpan<T, extents...>;  //!< A writeable view of an output
+
+        /*!
+         * The extents of the degrees of freedom of a multiphase point
+         */
+        template <int material_response_dim, int material_response_num_dof, size_type nphases>
+        struct DofExtents {
+            static constexpr size_type num_phase_dof = 4 + 2 * material_response_dim;  //!< The dof of each phase
+
+            static_assert(material_response_num_dof >= int(num_phase_dof),
+                          "The material response must depend on at least the dof of a phase");
+
+            static constexpr size_type num_additional_dof =
+                material_response_num_dof - num_phase_dof;  //!< The additional dof which are not of a phase
+
+            static constexpr size_type num_dof = nphases * num_phase_dof + num_additional_dof;  //!< The dof of a point
+
+            static constexpr size_type jacobian_columns =
+                num_dof * (1 + material_response_dim);  //!< The columns of the material response Jacobian of a phase
+        };
+
+        template <int dim, int mass_change_index, typename T, size_type nphases, size_type material_response_size>
+        void computeBalanceOfMass(const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+                                  const Input<T, nphases, dim>                    &density_gradient,
+                                  const Input<T, nphases, dim>                    &velocity,
+                                  const Input<T, nphases, dim, dim>               &velocity_gradient,
+                                  const Input<T, nphases, material_response_size> &material_response,
+                                  const T &test_function, const Output<T, nphases> &result);
+
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  typename T, size_type nphases, size_type material_response_size,
+                  typename extents = DofExtents<material_response_dim, material_response_num_dof, nphases>>
+        void computeBalanceOfMass(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases, dim> &velocity,
+            const Input<T, nphases, dim, dim>                                        &velocity_gradient,
+            const Input<T, nphases, material_response_size>                          &material_response,
+            const Input<T, nphases, material_response_size, extents::jacobian_columns> &material_response_jacobian,
+            const T &test_function, const T &interpolation_function,
+            const Input<T, dim>                                             &interpolation_function_gradient,
+            const Input<T, extents::num_dof, material_response_dim>         &full_material_response_dof_gradient,
+            const T &dDensityDotdDensity, const T &dUDotdU, const Output<T, nphases> &result,
+            const Output<T, nphases, nphases> &dRdRho, const Output<T, nphases, nphases, material_response_dim> &dRdU,
+            const Output<T, nphases, nphases, material_response_dim> &dRdW, const Output<T, nphases, nphases> &dRdTheta,
+            const Output<T, nphases, nphases> &dRdE, const Output<T, nphases, nphases> &dRdVF,
+            const Output<T, nphases, extents::num_additional_dof> &dRdZ, const Output<T, nphases, dim> &dRdUMesh);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, typename T, size_type nphases, size_type material_response_size>
+        void computeBalanceOfLinearMomentum(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases, dim> &velocity,
+            const Input<T, nphases, dim> &velocity_dot, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size> &material_response,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const Output<T, nphases, dim> &result);
+
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, typename T, size_type nphases,
+                  size_type material_response_size,
+                  typename extents = DofExtents<material_response_dim, material_response_num_dof, nphases>>
+        void computeBalanceOfLinearMomentum(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases, dim> &velocity,
+            const Input<T, nphases, dim> &velocity_dot, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size>                          &material_response,
+            const Input<T, nphases, material_response_size, extents::jacobian_columns> &material_response_jacobian,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const T &interpolation_function,
+            const Input<T, dim>                                     &interpolation_function_gradient,
+            const Input<T, extents::num_dof, material_response_dim> &full_material_response_dof_gradient,
+            const T &dDensityDotdDensity, const T &dUDotdU, const T &dUDDotdU, const Output<T, nphases, dim> &result,
+            const Output<T, nphases, dim, nphases>                        &dRdRho,
+            const Output<T, nphases, dim, nphases, material_response_dim> &dRdU,
+            const Output<T, nphases, dim, nphases, material_response_dim> &dRdW,
+            const Output<T, nphases, dim, nphases> &dRdTheta, const Output<T, nphases, dim, nphases> &dRdE,
+            const Output<T, nphases, dim, nphases>                      &dRdVF,
+            const Output<T, nphases, dim, extents::num_additional_dof> &dRdZ,
+            const Output<T, nphases, dim, dim>                          &dRdUMesh);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, typename T, size_type nphases, size_type material_response_size>
+        void computeBalanceOfEnergy(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases> &internal_energy,
+            const Input<T, nphases> &internal_energy_dot, const Input<T, nphases, dim> &internal_energy_gradient,
+            const Input<T, nphases, dim> &velocity, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size> &material_response,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const Output<T, nphases> &result);
+
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, typename T, size_type nphases,
+                  size_type material_response_size,
+                  typename extents = DofExtents<material_response_dim, material_response_num_dof, nphases>>
+        void computeBalanceOfEnergy(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases> &internal_energy,
+            const Input<T, nphases> &internal_energy_dot, const Input<T, nphases, dim> &internal_energy_gradient,
+            const Input<T, nphases, dim> &velocity, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size>                          &material_response,
+            const Input<T, nphases, material_response_size, extents::jacobian_columns> &material_response_jacobian,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const T &interpolation_function,
+            const Input<T, dim>                                     &interpolation_function_gradient,
+            const Input<T, extents::num_dof, material_response_dim> &full_material_response_dof_gradient,
+            const T &dRhoDotdRho, const T &dEDotdE, const T &dUDotdU, const Output<T, nphases> &result,
+            const Output<T, nphases, nphases> &dRdRho, const Output<T, nphases, nphases, material_response_dim> &dRdU,
+            const Output<T, nphases, nphases, material_response_dim> &dRdW, const Output<T, nphases, nphases> &dRdTheta,
+            const Output<T, nphases, nphases> &dRdE, const Output<T, nphases, nphases> &dRdVF,
+            const Output<T, nphases, extents::num_additional_dof> &dRdZ, const Output<T, nphases, dim> &dRdUMesh);
+
+    }  // namespace spanKernels
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_span_kernels.tpp"
+
+#endif
@@ -0,0 +1,412 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_span_kernels.tpp
+ ******************************************************************************
+ * The template file for evaluating the multiphase balance equations on views
+ * whose extents are known at compile time
+ ******************************************************************************
+ */
+
+#include "tardigrade_span_kernels.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace spanKernels {
+
+        /*!
+         * Compute the residuals of the balance of mass of a multiphase point. The number of phases and the size of
+         * the material response of a phase are deduced from the extents of the views.
+         *
+         * \param &density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &test_function: The test function \f$ \psi \f$
+         * \param &result: The residuals
+         */
+        template <int dim, int mass_change_index, typename T, size_type nphases, size_type material_response_size>
+        void computeBalanceOfMass(const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+                                  const Input<T, nphases, dim>                    &density_gradient,
+                                  const Input<T, nphases, dim>                    &velocity,
+                                  const Input<T, nphases, dim, dim>               &velocity_gradient,
+                                  const Input<T, nphases, material_response_size> &material_response,
+                                  const T &test_function, const Output<T, nphases> &result) {
+            static_assert(mass_change_index < int(material_response_size),
+                          "The mass change index must be less than the size of the material response");
+
+            for (size_type phase = 0; phase < nphases; ++phase) {
+                balanceOfMass::computeBalanceOfMass<dim, mass_change_index>(
+                    density[phase], density_dot[phase], density_gradient.row(phase).begin(),
+                    density_gradient.row(phase).end(), velocity.row(phase).begin(), velocity.row(phase).end(),
+                    velocity_gradient.row(phase).begin(), velocity_gradient.row(phase).end(),
+                    material_response.row(phase).begin(), material_response.row(phase).end(), test_function,
+                    result[phase]);
+            }
+        }
+
+        /*!
+         * Compute the residuals of the balance of mass of a multiphase point and their derivatives. The number of
+         * phases and the size of the material response of a phase are deduced from the extents of the views. The
+         * extents of the material response Jacobian, the dof gradient, and the derivatives w.r.t. the additional dof
+         * follow from the number of phases and material_response_num_dof.
+         *
+         * \param &density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &material_response_jacobian: The Jacobians of the material responses w.r.t. the dof and their
+         * spatial gradients
+         * \param &test_function: The test function \f$ \psi \f$
+         * \param &interpolation_function: The interpolation function \f$ \phi \f$
+         * \param &interpolation_function_gradient: The spatial gradient of the interpolation function
+         * \param &full_material_response_dof_gradient: The spatial gradient of the dof of the point
+         * \param &dDensityDotdDensity: The derivative of the time rate of change of the density w.r.t. the density
+         * \param &dUDotdU: The derivative of the velocity w.r.t. the displacement
+         * \param &result: The residuals
+         * \param &dRdRho: The derivatives of the residuals w.r.t. the apparent densities
+         * \param &dRdU: The derivatives of the residuals w.r.t. the displacements
+         * \param &dRdW: The derivatives of the residuals w.r.t. the velocities
+         * \param &dRdTheta: The derivatives of the residuals w.r.t. the temperatures
+         * \param &dRdE: The derivatives of the residuals w.r.t. the internal energies
+         * \param &dRdVF: The derivatives of the residuals w.r.t. the volume fractions
+         * \param &dRdZ: The derivatives of the residuals w.r.t. the additional dof
+         * \param &dRdUMesh: The derivatives of the residuals w.r.t. the mesh displacement
+         */
+        template <int dim, int material_response_dim, int mass_change_index, int material_response_num_dof,
+                  typename T, size_type nphases, size_type material_response_size, typename extents>
+        void computeBalanceOfMass(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases, dim> &velocity,
+            const Input<T, nphases, dim, dim>                                        &velocity_gradient,
+            const Input<T, nphases, material_response_size>                          &material_response,
+            const Input<T, nphases, material_response_size, extents::jacobian_columns> &material_response_jacobian,
+            const T &test_function, const T &interpolation_function,
+            const Input<T, dim>                                             &interpolation_function_gradient,
+            const Input<T, extents::num_dof, material_response_dim>         &full_material_response_dof_gradient,
+            const T &dDensityDotdDensity, const T &dUDotdU, const Output<T, nphases> &result,
+            const Output<T, nphases, nphases> &dRdRho, const Output<T, nphases, nphases, material_response_dim> &dRdU,
+            const Output<T, nphases, nphases, material_response_dim> &dRdW, const Output<T, nphases, nphases> &dRdTheta,
+            const Output<T, nphases, nphases> &dRdE, const Output<T, nphases, nphases> &dRdVF,
+            const Output<T, nphases, extents::num_additional_dof> &dRdZ, const Output<T, nphases, dim> &dRdUMesh) {
+            static_assert(mass_change_index < int(material_response_size),
+                          "The mass change index must be less than the size of the material response");
+
+            for (size_type phase = 0; phase < nphases; ++phase) {
+                balanceOfMass::computeBalanceOfMass<dim, material_response_dim, mass_change_index,
+                                                    material_response_num_dof>(
+                    density[phase], density_dot[phase], density_gradient.row(phase).begin(),
+                    density_gradient.row(phase).end(), velocity.row(phase).begin(), velocity.row(phase).end(),
+                    velocity_gradient.row(phase).begin(), velocity_gradient.row(phase).end(),
+                    material_response.row(phase).begin(), material_response.row(phase).end(),
+                    material_response_jacobian.row(phase).begin(), material_response_jacobian.row(phase).end(),
+                    test_function, interpolation_function, interpolation_function_gradient.begin(),
+                    interpolation_function_gradient.end(), full_material_response_dof_gradient.begin(),
+                    full_material_response_dof_gradient.end(), dDensityDotdDensity, dUDotdU, (unsigned int)phase,
+                    result[phase], dRdRho.row(phase).begin(), dRdRho.row(phase).end(), dRdU.row(phase).begin(),
+                    dRdU.row(phase).end(), dRdW.row(phase).begin(), dRdW.row(phase).end(), dRdTheta.row(phase).begin(),
+                    dRdTheta.row(phase).end(), dRdE.row(phase).begin(), dRdE.row(phase).end(),
+                    dRdVF.row(phase).begin(), dRdVF.row(phase).end(), dRdZ.row(phase).begin(), dRdZ.row(phase).end(),
+                    dRdUMesh.row(phase).begin(), dRdUMesh.row(phase).end());
+            }
+        }
+
+        /*!
+         * Compute the residuals of the balance of linear momentum of a multiphase point. The number of phases and the
+         * size of the material response of a phase are deduced from the extents of the views.
+         *
+         * \param &density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param &velocity_dot: The partial time derivatives of the velocities
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &volume_fraction: The volume fractions \f$ \phi^{\alpha} \f$
+         * \param &test_function: The test function \f$ \psi \f$
+         * \param &test_function_gradient: The spatial gradient of the test function
+         * \param &result: The residuals
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, typename T, size_type nphases, size_type material_response_size>
+        void computeBalanceOfLinearMomentum(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases, dim> &velocity,
+            const Input<T, nphases, dim> &velocity_dot, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size> &material_response,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const Output<T, nphases, dim> &result) {
+            static_assert(body_force_index + material_response_dim <= int(material_response_size),
+                          "The body force must be contained in the material response");
+
+            static_assert(cauchy_stress_index + material_response_dim * material_response_dim <=
+                              int(material_response_size),
+                          "The Cauchy stress must be contained in the material response");
+
+            static_assert(interphasic_force_index + material_response_dim <= int(material_response_size),
+                          "The interphasic force must be contained in the material response");
+
+            for (size_type phase = 0; phase < nphases; ++phase) {
+                balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+                    dim, material_response_dim, body_force_index, cauchy_stress_index, interphasic_force_index>(
+                    density[phase], density_dot[phase], density_gradient.row(phase).begin(),
+                    density_gradient.row(phase).end(), velocity.row(phase).begin(), velocity.row(phase).end(),
+                    velocity_dot.row(phase).begin(), velocity_dot.row(phase).end(),
+                    velocity_gradient.row(phase).begin(), velocity_gradient.row(phase).end(),
+                    material_response.row(phase).begin(), material_response.row(phase).end(), volume_fraction[phase],
+                    test_function, test_function_gradient.begin(), test_function_gradient.end(),
+                    result.row(phase).begin(), result.row(phase).end());
+            }
+        }
+
+        /*!
+         * Compute the residuals of the balance of linear momentum of a multiphase point and their derivatives. The
+         * number of phases and the size of the material response of a phase are deduced from the extents of the
+         * views. The extents of the material response Jacobian, the dof gradient, and the derivatives w.r.t. the
+         * additional dof follow from the number of phases and material_response_num_dof.
+         *
+         * \param &density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param &velocity_dot: The partial time derivatives of the velocities
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &material_response_jacobian: The Jacobians of the material responses w.r.t. the dof and their
+         * spatial gradients
+         * \param &volume_fraction: The volume fractions \f$ \phi^{\alpha} \f$
+         * \param &test_function: The test function \f$ \psi \f$
+         * \param &test_function_gradient: The spatial gradient of the test function
+         * \param &interpolation_function: The interpolation function \f$ \phi \f$
+         * \param &interpolation_function_gradient: The spatial gradient of the interpolation function
+         * \param &full_material_response_dof_gradient: The spatial gradient of the dof of the point
+         * \param &dDensityDotdDensity: The derivative of the time rate of change of the density w.r.t. the density
+         * \param &dUDotdU: The derivative of the velocity w.r.t. the displacement
+         * \param &dUDDotdU: The derivative of the acceleration w.r.t. the displacement
+         * \param &result: The residuals
+         * \param &dRdRho: The derivatives of the residuals w.r.t. the apparent densities
+         * \param &dRdU: The derivatives of the residuals w.r.t. the displacements
+         * \param &dRdW: The derivatives of the residuals w.r.t. the velocities
+         * \param &dRdTheta: The derivatives of the residuals w.r.t. the temperatures
+         * \param &dRdE: The derivatives of the residuals w.r.t. the internal energies
+         * \param &dRdVF: The derivatives of the residuals w.r.t. the volume fractions
+         * \param &dRdZ: The derivatives of the residuals w.r.t. the additional dof
+         * \param &dRdUMesh: The derivatives of the residuals w.r.t. the mesh displacement
+         */
+        template <int dim, int material_response_dim, int body_force_index, int cauchy_stress_index,
+                  int interphasic_force_index, int material_response_num_dof, typename T, size_type nphases,
+                  size_type material_response_size, typename extents>
+        void computeBalanceOfLinearMomentum(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases, dim> &velocity,
+            const Input<T, nphases, dim> &velocity_dot, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size>                          &material_response,
+            const Input<T, nphases, material_response_size, extents::jacobian_columns> &material_response_jacobian,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const T &interpolation_function,
+            const Input<T, dim>                                     &interpolation_function_gradient,
+            const Input<T, extents::num_dof, material_response_dim> &full_material_response_dof_gradient,
+            const T &dDensityDotdDensity, const T &dUDotdU, const T &dUDDotdU, const Output<T, nphases, dim> &result,
+            const Output<T, nphases, dim, nphases>                        &dRdRho,
+            const Output<T, nphases, dim, nphases, material_response_dim> &dRdU,
+            const Output<T, nphases, dim, nphases, material_response_dim> &dRdW,
+            const Output<T, nphases, dim, nphases> &dRdTheta, const Output<T, nphases, dim, nphases> &dRdE,
+            const Output<T, nphases, dim, nphases>                      &dRdVF,
+            const Output<T, nphases, dim, extents::num_additional_dof> &dRdZ,
+            const Output<T, nphases, dim, dim>                          &dRdUMesh) {
+            static_assert(body_force_index + material_response_dim <= int(material_response_size),
+                          "The body force must be contained in the material response");
+
+            static_assert(cauchy_stress_index + material_response_dim * material_response_dim <=
+                              int(material_response_size),
+                          "The Cauchy stress must be contained in the material response");
+
+            static_assert(interphasic_force_index + material_response_dim <= int(material_response_size),
+                          "The interphasic force must be contained in the material response");
+
+            for (size_type phase = 0; phase < nphases; ++phase) {
+                balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim, material_response_dim, body_force_index,
+                                                                        cauchy_stress_index, interphasic_force_index,
+                                                                        material_response_num_dof>(
+                    density[phase], density_dot[phase], density_gradient.row(phase).begin(),
+                    density_gradient.row(phase).end(), velocity.row(phase).begin(), velocity.row(phase).end(),
+                    velocity_dot.row(phase).begin(), velocity_dot.row(phase).end(),
+                    velocity_gradient.row(phase).begin(), velocity_gradient.row(phase).end(),
+                    material_response.row(phase).begin(), material_response.row(phase).end(),
+                    material_response_jacobian.row(phase).begin(), material_response_jacobian.row(phase).end(),
+                    volume_fraction[phase], test_function, test_function_gradient.begin(),
+                    test_function_gradient.end(), interpolation_function, interpolation_function_gradient.begin(),
+                    interpolation_function_gradient.end(), full_material_response_dof_gradient.begin(),
+                    full_material_response_dof_gradient.end(), dDensityDotdDensity, dUDotdU, dUDDotdU,
+                    (unsigned int)phase, result.row(phase).begin(), result.row(phase).end(),
+                    dRdRho.row(phase).begin(), dRdRho.row(phase).end(), dRdU.row(phase).begin(),
+                    dRdU.row(phase).end(), dRdW.row(phase).begin(), dRdW.row(phase).end(), dRdTheta.row(phase).begin(),
+                    dRdTheta.row(phase).end(), dRdE.row(phase).begin(), dRdE.row(phase).end(),
+                    dRdVF.row(phase).begin(), dRdVF.row(phase).end(), dRdZ.row(phase).begin(), dRdZ.row(phase).end(),
+                    dRdUMesh.row(phase).begin(), dRdUMesh.row(phase).end());
+            }
+        }
+
+        /*!
+         * Compute the residuals of the balance of energy of a multiphase point. The number of phases and the size of
+         * the material response of a phase are deduced from the extents of the views.
+         *
+         * \param &density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &internal_energy: The internal energies \f$ e^{\alpha} \f$
+         * \param &internal_energy_dot: The partial time derivatives of the internal energies
+         * \param &internal_energy_gradient: The spatial gradients of the internal energies
+         * \param &velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &volume_fraction: The volume fractions \f$ \phi^{\alpha} \f$
+         * \param &test_function: The test function \f$ \psi \f$
+         * \param &test_function_gradient: The spatial gradient of the test function
+         * \param &result: The residuals
+         */
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, typename T, size_type nphases, size_type material_response_size>
+        void computeBalanceOfEnergy(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases> &internal_energy,
+            const Input<T, nphases> &internal_energy_dot, const Input<T, nphases, dim> &internal_energy_gradient,
+            const Input<T, nphases, dim> &velocity, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size> &material_response,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const Output<T, nphases> &result) {
+            static_assert(cauchy_stress_index + material_response_dim * material_response_dim <=
+                              int(material_response_size),
+                          "The Cauchy stress must be contained in the material response");
+
+            static_assert(internal_heat_generation_index < int(material_response_size),
+                          "The internal heat generation must be contained in the material response");
+
+            static_assert(heat_flux_index + material_response_dim <= int(material_response_size),
+                          "The heat flux must be contained in the material response");
+
+            static_assert(interphasic_force_index + material_response_dim <= int(material_response_size),
+                          "The interphasic force must be contained in the material response");
+
+            static_assert(interphasic_heat_transfer_index < int(material_response_size),
+                          "The interphasic heat transfer must be contained in the material response");
+
+            for (size_type phase = 0; phase < nphases; ++phase) {
+                balanceOfEnergy::computeBalanceOfEnergy<dim, is_per_unit_volume, material_response_dim,
+                                                        cauchy_stress_index, internal_heat_generation_index,
+                                                        heat_flux_index, interphasic_force_index,
+                                                        interphasic_heat_transfer_index>(
+                    density[phase], density_dot[phase], density_gradient.row(phase).begin(),
+                    density_gradient.row(phase).end(), internal_energy[phase], internal_energy_dot[phase],
+                    internal_energy_gradient.row(phase).begin(), internal_energy_gradient.row(phase).end(),
+                    velocity.row(phase).begin(), velocity.row(phase).end(), velocity_gradient.row(phase).begin(),
+                    velocity_gradient.row(phase).end(), material_response.row(phase).begin(),
+                    material_response.row(phase).end(), volume_fraction[phase], test_function,
+                    test_function_gradient.begin(), test_function_gradient.end(), result[phase]);
+            }
+        }
+
+        /*!
+         * Compute the residuals of the balance of energy of a multiphase point and their derivatives. The number of
+         * phases and the size of the material response of a phase are deduced from the extents of the views. The
+         * extents of the material response Jacobian, the dof gradient, and the derivatives w.r.t. the additional dof
+         * follow from the number of phases and material_response_num_dof.
+         *
+         * \param &density: The apparent densities \f$ \rho^{\alpha} \f$
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &internal_energy: The internal energies \f$ e^{\alpha} \f$
+         * \param &internal_energy_dot: The partial time derivatives of the internal energies
+         * \param &internal_energy_gradient: The spatial gradients of the internal energies
+         * \param &velocity: The velocities \f$ v_i^{\alpha} \f$
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &material_response_jacobian: The Jacobians of the material responses w.r.t. the dof and their
+         * spatial gradients
+         * \param &volume_fraction: The volume fractions \f$ \phi^{\alpha} \f$
+         * \param &test_function: The test function \f$ \psi \f$
+         * \param &test_function_gradient: The spatial gradient of the test function
+         * \param &interpolation_function: The interpolation function \f$ \phi \f$
+         * \param &interpolation_function_gradient: The spatial gradient of the interpolation function
+         * \param &full_material_response_dof_gradient: The spatial gradient of the dof of the point
+         * \param &dRhoDotdRho: The derivative of the time rate of change of the density w.r.t. the density
+         * \param &dEDotdE: The derivative of the time rate of change of the internal energy w.r.t. the internal
+         * energy
+         * \param &dUDotdU: The derivative of the velocity w.r.t. the displacement
+         * \param &result: The residuals
+         * \param &dRdRho: The derivatives of the residuals w.r.t. the apparent densities
+         * \param &dRdU: The derivatives of the residuals w.r.t. the displacements
+         * \param &dRdW: The derivatives of the residuals w.r.t. the velocities
+         * \param &dRdTheta: The derivatives of the residuals w.r.t. the temperatures
+         * \param &dRdE: The derivatives of the residuals w.r.t. the internal energies
+         * \param &dRdVF: The derivatives of the residuals w.r.t. the volume fractions
+         * \param &dRdZ: The derivatives of the residuals w.r.t. the additional dof
+         * \param &dRdUMesh: The derivatives of the residuals w.r.t. the mesh displacement
+         */
+        template <int dim, bool is_per_unit_volume, int material_response_dim, int cauchy_stress_index,
+                  int internal_heat_generation_index, int heat_flux_index, int interphasic_force_index,
+                  int interphasic_heat_transfer_index, int material_response_num_dof, typename T, size_type nphases,
+                  size_type material_response_size, typename extents>
+        void computeBalanceOfEnergy(
+            const Input<T, nphases> &density, const Input<T, nphases> &density_dot,
+            const Input<T, nphases, dim> &density_gradient, const Input<T, nphases> &internal_energy,
+            const Input<T, nphases> &internal_energy_dot, const Input<T, nphases, dim> &internal_energy_gradient,
+            const Input<T, nphases, dim> &velocity, const Input<T, nphases, dim, dim> &velocity_gradient,
+            const Input<T, nphases, material_response_size>                          &material_response,
+            const Input<T, nphases, material_response_size, extents::jacobian_columns> &material_response_jacobian,
+            const Input<T, nphases> &volume_fraction, const T &test_function,
+            const Input<T, dim> &test_function_gradient, const T &interpolation_function,
+            const Input<T, dim>                                     &interpolation_function_gradient,
+            const Input<T, extents::num_dof, material_response_dim> &full_material_response_dof_gradient,
+            const T &dRhoDotdRho, const T &dEDotdE, const T &dUDotdU, const Output<T, nphases> &result,
+            const Output<T, nphases, nphases> &dRdRho, const Output<T, nphases, nphases, material_response_dim> &dRdU,
+            const Output<T, nphases, nphases, material_response_dim> &dRdW, const Output<T, nphases, nphases> &dRdTheta,
+            const Output<T, nphases, nphases> &dRdE, const Output<T, nphases, nphases> &dRdVF,
+            const Output<T, nphases, extents::num_additional_dof> &dRdZ, const Output<T, nphases, dim> &dRdUMesh) {
+            static_assert(cauchy_stress_index + material_response_dim * material_response_dim <=
+                              int(material_response_size),
+                          "The Cauchy stress must be contained in the material response");
+
+            static_assert(internal_heat_generation_index < int(material_response_size),
+                          "The internal heat generation must be contained in the material response");
+
+            static_assert(heat_flux_index + material_response_dim <= int(material_response_size),
+                          "The heat flux must be contained in the material response");
+
+            static_assert(interphasic_force_index + material_response_dim <= int(material_response_size),
+                          "The interphasic force must be contained in the material response");
+
+            static_assert(interphasic_heat_transfer_index < int(material_response_size),
+                          "The interphasic heat transfer must be contained in the material response");
+
+            for (unsigned int phase = 0; phase < nphases; ++phase) {
+                balanceOfEnergy::computeBalanceOfEnergy<dim, is_per_unit_volume, material_response_dim,
+                                                        cauchy_stress_index, internal_heat_generation_index,
+                                                        heat_flux_index, interphasic_force_index,
+                                                        interphasic_heat_transfer_index, material_response_num_dof>(
+                    density[phase], density_dot[phase], density_gradient.row(phase).begin(),
+                    density_gradient.row(phase).end(), internal_energy[phase], internal_energy_dot[phase],
+                    internal_energy_gradient.row(phase).begin(), internal_energy_gradient.row(phase).end(),
+                    velocity.row(phase).begin(), velocity.row(phase).end(), velocity_gradient.row(phase).begin(),
+                    velocity_gradient.row(phase).end(), material_response.row(phase).begin(),
+                    material_response.row(phase).end(), material_response_jacobian.row(phase).begin(),
+                    material_response_jacobian.row(phase).end(), volume_fraction[phase], test_function,
+                    test_function_gradient.begin(), test_function_gradient.end(), interpolation_function,
+                    interpolation_function_gradient.begin(), interpolation_function_gradient.end(),
+                    full_material_response_dof_gradient.begin(), full_material_response_dof_gradient.end(),
+                    dRhoDotdRho, dEDotdE, dUDotdU, phase, result[phase], dRdRho.row(phase).begin(),
+                    dRdRho.row(phase).end(), dRdU.row(phase).begin(), dRdU.row(phase).end(), dRdW.row(phase).begin(),
+                    dRdW.row(phase).end(), dRdTheta.row(phase).begin(), dRdTheta.row(phase).end(),
+                    dRdE.row(phase).begin(), dRdE.row(phase).end(), dRdVF.row(phase).begin(), dRdVF.row(phase).end(),
+                    dRdZ.row(phase).begin(), dRdZ.row(phase).end(), dRdUMesh.row(phase).begin(),
+                    dRdUMesh.row(phase).end());
+            }
+        }
+
+    }  // namespace spanKernels
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_static_condensation.cpp
+ ******************************************************************************
+ * The source file for the element-level static condensation of degrees of
+ * freedom which are local to an element
+ ******************************************************************************
+ */
+
+#include "tardigrade_static_condensation.h"
@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_static_condensation.h
+ ******************************************************************************
+ * The header file for the element-level static condensation of degrees of
+ * freedom which belong to a single element e.g., internal variables or
+ * bubble modes. The condensed degrees of freedom of an element are
+ * eliminated from the element residual and Jacobian by a Schur complement
+ * before the global assembly and are recovered from the solution of the
+ * global system afterwards. The fields of the dof numbering are shared
+ * between the elements through the nodes and their gradients enter the
+ * balance equations so they are never condensed.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_STATIC_CONDENSATION_H
+#define TARDIGRADE_STATIC_CONDENSATION_H
+
+#include <vector>
+
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace staticCondensation {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        typedef meshAssembly::floatType floatType;  //!< Define the float type to be the same as the mesh assembly
+
+        /*!
+         * The static condensation of the element systems of a mesh. The degrees of freedom of an element system are
+         * split into the retained degrees of freedom, which are scattered into the global system, and the condensed
+         * degrees of freedom, which are local to the element. With the Newton update \f$ J \Delta u = -R \f$ the
+         * condensed degrees of freedom are eliminated as
+         *
+         * \f$ J^{*} = J_{rr} - J_{rc} J_{cc}^{-1} J_{cr} \f$
+         *
+         * \f$ R^{*} = R_{r} - J_{rc} J_{cc}^{-1} R_{c} \f$
+         *
+         * and recovered from the update of the retained degrees of freedom as
+         *
+         * \f$ \Delta u_{c} = -J_{cc}^{-1} \left( R_{c} + J_{cr} \Delta u_{r} \right) \f$
+         *
+         * The terms \f$ J_{cc}^{-1} R_{c} \f$ and \f$ J_{cc}^{-1} J_{cr} \f$ of each element are stored when the
+         * element is condensed for the recovery. Different elements may be condensed concurrently. The condensation is
+         * only exact if the condensed degrees of freedom of an element are not coupled to any other element.
+         */
+        class ElementCondensation {
+           public:
+            /*!
+             * Default constructor
+             */
+            ElementCondensation()
+                : _num_elements(0),
+                  _num_element_dof(0),
+                  _retained_dof(),
+                  _condensed_dof(),
+                  _condensed_solution(),
+                  _coupling() {}
+
+            template <class index_iter>
+            ElementCondensation(const size_type num_elements, const size_type num_element_dof,
+                                const index_iter &condensed_dof_begin, const index_iter &condensed_dof_end);
+
+            inline ElementCondensation(const meshAssembly::MeshConnectivity &connectivity,
+                                       const meshAssembly::DofNumbering     &numbering,
+                                       const size_type                       num_element_local_dof);
+
+            //! Get the number of elements
+            size_type getNumElements() const { return _num_elements; }
+
+            //! Get the number of degrees of freedom of each element system before the condensation
+            size_type getNumElementDOF() const { return _num_element_dof; }
+
+            //! Get the number of retained degrees of freedom of each element
+            size_type getNumRetainedDOF() const { return (size_type)_retained_dof.size(); }
+
+            //! Get the number of condensed degrees of freedom of each element
+            size_type getNumCondensedDOF() const { return (size_type)_condensed_dof.size(); }
+
+            //! Get the indices of the retained degrees of freedom in the element system
+            const std::vector<size_type> &getRetainedDOF() const { return _retained_dof; }
+
+            //! Get the indices of the condensed degrees of freedom in the element system
+            const std::vector<size_type> &getCondensedDOF() const { return _condensed_dof; }
+
+            template <class element_residual_iter, class element_jacobian_iter, class condensed_residual_iter,
+                      class condensed_jacobian_iter>
+            void condenseElement(const size_type element, const element_residual_iter &element_residual_begin,
+                                 const element_residual_iter &element_residual_end,
+                                 const element_jacobian_iter &element_jacobian_begin,
+                                 const element_jacobian_iter &element_jacobian_end,
+                                 condensed_residual_iter condensed_residual_begin,
+                                 condensed_residual_iter condensed_residual_end,
+                                 condensed_jacobian_iter condensed_jacobian_begin,
+                                 condensed_jacobian_iter condensed_jacobian_end);
+
+            template <class retained_iter, class condensed_iter>
+            void recoverElement(const size_type element, const retained_iter &delta_retained_begin,
+                                const retained_iter &delta_retained_end, condensed_iter delta_condensed_begin,
+                                condensed_iter delta_condensed_end) const;
+
+           protected:
+            size_type _num_elements;  //!< The number of elements
+
+            size_type _num_element_dof;  //!< The number of degrees of freedom of each element system
+
+            std::vector<size_type> _retained_dof;  //!< The sorted indices of the retained degrees of freedom
+
+            std::vector<size_type> _condensed_dof;  //!< The sorted indices of the condensed degrees of freedom
+
+            std::vector<floatType> _condensed_solution;  //!< The term \f$ J_{cc}^{-1} R_{c} \f$ of each element
+
+            std::vector<floatType> _coupling;  //!< The row-major term \f$ J_{cc}^{-1} J_{cr} \f$ of each element
+        };
+
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const meshAssembly::MeshConnectivity &connectivity,
+                                         const meshAssembly::DofNumbering &numbering, ElementCondensation &condensation,
+                                         element_kernel &kernel, residual_iter residual_begin,
+                                         residual_iter residual_end, meshAssembly::CSRMatrix<T> &jacobian);
+
+        template <class global_iter, class condensed_iter>
+        void recoverCondensedDOF(const meshAssembly::MeshConnectivity &connectivity,
+                                 const meshAssembly::DofNumbering &numbering, const ElementCondensation &condensation,
+                                 const global_iter &delta_begin, const global_iter &delta_end,
+                                 condensed_iter delta_condensed_begin, condensed_iter delta_condensed_end);
+
+    }  // namespace staticCondensation
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_static_condensation.tpp"
+
+#endif
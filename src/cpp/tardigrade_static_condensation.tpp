@@ -0,0 +1,353 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_static_condensation.tpp
+ ******************************************************************************
+ * The template file for the element-level static condensation of degrees of
+ * freedom which belong to a single element
+ ******************************************************************************
+ */
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+#include "tardigrade_static_condensation.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace staticCondensation {
+
+        /*!
+         * Constructor for the static condensation from the indices of the condensed degrees of freedom in the element
+         * systems. The remaining degrees of freedom are retained in their original order. The condensed degrees of
+         * freedom must belong to the element alone.
+         *
+         * \param num_elements: The number of elements
+         * \param num_element_dof: The number of degrees of freedom of each element system
+         * \param &condensed_dof_begin: The starting iterator of the indices of the condensed degrees of freedom
+         * \param &condensed_dof_end: The stopping iterator of the indices of the condensed degrees of freedom
+         */
+        template <class index_iter>
+        ElementCondensation::ElementCondensation(const size_type num_elements, const size_type num_element_dof,
+                                                 const index_iter &condensed_dof_begin,
+                                                 const index_iter &condensed_dof_end)
+            : _num_elements(num_elements),
+              _num_element_dof(num_element_dof),
+              _retained_dof(),
+              _condensed_dof(condensed_dof_begin, condensed_dof_end) {
+            std::sort(std::begin(_condensed_dof), std::end(_condensed_dof));
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                std::adjacent_find(std::cbegin(_condensed_dof), std::cend(_condensed_dof)) == std::cend(_condensed_dof),
+                "The condensed degrees of freedom must be unique")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(_condensed_dof.empty() || (_condensed_dof.back() < num_element_dof),
+                                         "The condensed degree of freedom " + std::to_string(_condensed_dof.back()) +
+                                             " is not less than the number of element dof " +
+                                             std::to_string(num_element_dof))
+
+            _retained_dof.reserve(num_element_dof - _condensed_dof.size());
+
+            for (size_type i = 0; i < num_element_dof; ++i) {
+                if (!std::binary_search(std::cbegin(_condensed_dof), std::cend(_condensed_dof), i)) {
+                    _retained_dof.push_back(i);
+                }
+            }
+
+            _condensed_solution.resize(num_elements * getNumCondensedDOF());
+
+            _coupling.resize(num_elements * getNumCondensedDOF() * getNumRetainedDOF());
+        }
+
+        /*!
+         * Constructor for the static condensation of the element-local degrees of freedom of a mesh. The element
+         * systems are node-major in the layout of the numbering followed by num_element_local_dof degrees of freedom
+         * which belong to the element alone e.g., internal variables or bubble modes. Only the element-local degrees
+         * of freedom are condensed. The node degrees of freedom are retained since they are shared with the
+         * neighbouring elements.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the global degrees of freedom
+         * \param num_element_local_dof: The number of degrees of freedom of each element which follow the node
+         *     degrees of freedom
+         */
+        ElementCondensation::ElementCondensation(const meshAssembly::MeshConnectivity &connectivity,
+                                                 const meshAssembly::DofNumbering     &numbering,
+                                                 const size_type                       num_element_local_dof)
+            : ElementCondensation() {
+            const size_type num_element_node_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+            std::vector<size_type> condensed_dof(num_element_local_dof);
+
+            std::iota(std::begin(condensed_dof), std::end(condensed_dof), num_element_node_dof);
+
+            *this = ElementCondensation(connectivity.getNumElements(), num_element_node_dof + num_element_local_dof,
+                                        std::cbegin(condensed_dof), std::cend(condensed_dof));
+        }
+
+        /*!
+         * Condense an element system. The condensed terms needed to recover the condensed degrees of freedom are
+         * stored for the element.
+         *
+         * \param element: The element
+         * \param &element_residual_begin: The starting iterator of the element residual
+         * \param &element_residual_end: The stopping iterator of the element residual
+         * \param &element_jacobian_begin: The starting iterator of the row-major element Jacobian
+         * \param &element_jacobian_end: The stopping iterator of the row-major element Jacobian
+         * \param condensed_residual_begin: The starting iterator of the condensed residual of the retained dof
+         * \param condensed_residual_end: The stopping iterator of the condensed residual of the retained dof
+         * \param condensed_jacobian_begin: The starting iterator of the row-major condensed Jacobian of the retained
+         *     dof
+         * \param condensed_jacobian_end: The stopping iterator of the row-major condensed Jacobian of the retained
+         *     dof
+         */
+        template <class element_residual_iter, class element_jacobian_iter, class condensed_residual_iter,
+                  class condensed_jacobian_iter>
+        void ElementCondensation::condenseElement(
+            const size_type element, const element_residual_iter &element_residual_begin,
+            const element_residual_iter &element_residual_end, const element_jacobian_iter &element_jacobian_begin,
+            const element_jacobian_iter &element_jacobian_end, condensed_residual_iter condensed_residual_begin,
+            condensed_residual_iter condensed_residual_end, condensed_jacobian_iter condensed_jacobian_begin,
+            condensed_jacobian_iter condensed_jacobian_end) {
+            using matrix_type = Eigen::Matrix<floatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+            using vector_type = Eigen::Matrix<floatType, Eigen::Dynamic, 1>;
+
+            const size_type num_retained  = getNumRetainedDOF();
+            const size_type num_condensed = getNumCondensedDOF();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(element < _num_elements, "The element " + std::to_string(element) +
+                                                                      " is not less than the number of elements " +
+                                                                      std::to_string(_num_elements))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(element_residual_end - element_residual_begin) == _num_element_dof,
+                                         "The element residual must have a size equal to the number of element dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(element_jacobian_end - element_jacobian_begin) == _num_element_dof * _num_element_dof,
+                "The element Jacobian must have a size equal to the square of the number of element dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(condensed_residual_end - condensed_residual_begin) == num_retained,
+                                         "The condensed residual must have a size equal to the number of retained dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(condensed_jacobian_end - condensed_jacobian_begin) == num_retained * num_retained,
+                "The condensed Jacobian must have a size equal to the square of the number of retained dof")
+
+            auto J = [&](const size_type i, const size_type j) {
+                return *(element_jacobian_begin + _num_element_dof * i + j);
+            };
+
+            vector_type R_r(num_retained), R_c(num_condensed);
+
+            matrix_type J_rr(num_retained, num_retained), J_rc(num_retained, num_condensed),
+                J_cr(num_condensed, num_retained), J_cc(num_condensed, num_condensed);
+
+            for (size_type i = 0; i < num_retained; ++i) {
+                R_r(i) = *(element_residual_begin + _retained_dof[i]);
+
+                for (size_type j = 0; j < num_retained; ++j) {
+                    J_rr(i, j) = J(_retained_dof[i], _retained_dof[j]);
+                }
+
+                for (size_type j = 0; j < num_condensed; ++j) {
+                    J_rc(i, j) = J(_retained_dof[i], _condensed_dof[j]);
+                }
+            }
+
+            for (size_type i = 0; i < num_condensed; ++i) {
+                R_c(i) = *(element_residual_begin + _condensed_dof[i]);
+
+                for (size_type j = 0; j < num_retained; ++j) {
+                    J_cr(i, j) = J(_condensed_dof[i], _retained_dof[j]);
+                }
+
+                for (size_type j = 0; j < num_condensed; ++j) {
+                    J_cc(i, j) = J(_condensed_dof[i], _condensed_dof[j]);
+                }
+            }
+
+            Eigen::Map<vector_type> condensed_solution(_condensed_solution.data() + num_condensed * element,
+                                                       num_condensed);
+
+            Eigen::Map<matrix_type> coupling(_coupling.data() + num_condensed * num_retained * element, num_condensed,
+                                             num_retained);
+
+            if (num_condensed > 0) {
+                Eigen::FullPivLU<matrix_type> lu(J_cc);
+
+                TARDIGRADE_ERROR_TOOLS_CHECK(lu.isInvertible(), "The condensed block of the Jacobian of element " +
+                                                                    std::to_string(element) + " is singular")
+
+                condensed_solution = lu.solve(R_c);
+
+                coupling = lu.solve(J_cr);
+
+                R_r -= J_rc * condensed_solution;
+
+                J_rr -= J_rc * coupling;
+            }
+
+            std::copy(R_r.data(), R_r.data() + num_retained, condensed_residual_begin);
+
+            std::copy(J_rr.data(), J_rr.data() + num_retained * num_retained, condensed_jacobian_begin);
+        }
+
+        /*!
+         * Recover the update of the condensed degrees of freedom of an element from the update of its retained
+         * degrees of freedom \f$ \Delta u_{c} = -J_{cc}^{-1} \left( R_{c} + J_{cr} \Delta u_{r} \right) \f$ using the
+         * terms stored when the element was condensed.
+         *
+         * \param element: The element
+         * \param &delta_retained_begin: The starting iterator of the update of the retained dof of the element
+         * \param &delta_retained_end: The stopping iterator of the update of the retained dof of the element
+         * \param delta_condensed_begin: The starting iterator of the update of the condensed dof of the element
+         * \param delta_condensed_end: The stopping iterator of the update of the condensed dof of the element
+         */
+        template <class retained_iter, class condensed_iter>
+        void ElementCondensation::recoverElement(const size_type element, const retained_iter &delta_retained_begin,
+                                                 const retained_iter &delta_retained_end,
+                                                 condensed_iter delta_condensed_begin,
+                                                 condensed_iter delta_condensed_end) const {
+            const size_type num_retained  = getNumRetainedDOF();
+            const size_type num_condensed = getNumCondensedDOF();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(element < _num_elements, "The element " + std::to_string(element) +
+                                                                      " is not less than the number of elements " +
+                                                                      std::to_string(_num_elements))
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(delta_retained_end - delta_retained_begin) == num_retained,
+                                         "The retained update must have a size equal to the number of retained dof")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((size_type)(delta_condensed_end - delta_condensed_begin) == num_condensed,
+                                         "The condensed update must have a size equal to the number of condensed dof")
+
+            const floatType *condensed_solution = _condensed_solution.data() + num_condensed * element;
+
+            const floatType *coupling = _coupling.data() + num_condensed * num_retained * element;
+
+            for (size_type i = 0; i < num_condensed; ++i) {
+                floatType value = condensed_solution[i];
+
+                for (size_type j = 0; j < num_retained; ++j) {
+                    value += coupling[num_retained * i + j] * (*(delta_retained_begin + j));
+                }
+
+                *(delta_condensed_begin + i) = -value;
+            }
+        }
+
+        /*!
+         * Assemble the condensed global residual and CSR Jacobian of a mesh. The element kernel is called as
+         *
+         * kernel( element, element_residual_begin, element_residual_end, element_jacobian_begin, element_jacobian_end )
+         *
+         * and adds the residual and the row-major Jacobian of the full element system, including the condensed
+         * degrees of freedom, to the zero-initialized element vectors. Each element system is condensed and the
+         * retained system is scattered into the global system of the numbering. The retained degrees of freedom must
+         * be the node degrees of freedom of the element. The Jacobian must be built with
+         * meshAssembly::buildCSRMatrix from the same numbering.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the global degrees of freedom
+         * \param &condensation: The static condensation of the element systems
+         * \param &kernel: The element kernel
+         * \param residual_begin: The starting iterator of the condensed global residual
+         * \param residual_end: The stopping iterator of the condensed global residual
+         * \param &jacobian: The condensed global Jacobian
+         */
+        template <typename T, class element_kernel, class residual_iter>
+        void assembleResidualAndJacobian(const meshAssembly::MeshConnectivity &connectivity,
+                                         const meshAssembly::DofNumbering &numbering, ElementCondensation &condensation,
+                                         element_kernel &kernel, residual_iter residual_begin,
+                                         residual_iter residual_end, meshAssembly::CSRMatrix<T> &jacobian) {
+            using residual_type = typename std::iterator_traits<residual_iter>::value_type;
+
+            const size_type num_element_dof  = condensation.getNumElementDOF();
+            const size_type num_retained_dof = condensation.getNumRetainedDOF();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(condensation.getNumElements() == connectivity.getNumElements(),
+                                         "The condensation must have a number of elements equal to the mesh")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (num_retained_dof == connectivity.getNodesPerElement() * numbering.getNumNodeDOF()) &&
+                    ((num_retained_dof == 0) || (condensation.getRetainedDOF().back() + 1 == num_retained_dof)),
+                "The retained dof must be the node dof of an element so that only the element-local dof are condensed")
+
+            std::vector<residual_type> element_residual(num_element_dof);
+
+            std::vector<T> element_jacobian(num_element_dof * num_element_dof);
+
+            std::vector<residual_type> condensed_residual(num_retained_dof);
+
+            std::vector<T> condensed_jacobian(num_retained_dof * num_retained_dof);
+
+            std::fill(residual_begin, residual_end, residual_type());
+
+            jacobian.setZero();
+
+            for (size_type e = 0; e < connectivity.getNumElements(); ++e) {
+                std::fill(std::begin(element_residual), std::end(element_residual), residual_type());
+
+                std::fill(std::begin(element_jacobian), std::end(element_jacobian), T());
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(kernel(e, std::begin(element_residual), std::end(element_residual),
+                                                    std::begin(element_jacobian), std::end(element_jacobian)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(condensation.condenseElement(
+                    e, std::cbegin(element_residual), std::cend(element_residual), std::cbegin(element_jacobian),
+                    std::cend(element_jacobian), std::begin(condensed_residual), std::end(condensed_residual),
+                    std::begin(condensed_jacobian), std::end(condensed_jacobian)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::scatterElementResidual(
+                    connectivity, numbering, e, std::cbegin(condensed_residual), std::cend(condensed_residual),
+                    residual_begin, residual_end));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::scatterElementJacobian(
+                    connectivity, numbering, e, std::cbegin(condensed_jacobian), std::cend(condensed_jacobian),
+                    jacobian));
+            }
+        }
+
+        /*!
+         * Recover the update of the condensed degrees of freedom of every element from the update of the global
+         * degrees of freedom of the condensed system. The condensed updates are element-major.
+         *
+         * \param &connectivity: The mesh connectivity
+         * \param &numbering: The numbering of the global degrees of freedom
+         * \param &condensation: The static condensation of the element systems
+         * \param &delta_begin: The starting iterator of the update of the global dof
+         * \param &delta_end: The stopping iterator of the update of the global dof
+         * \param delta_condensed_begin: The starting iterator of the update of the condensed dof of all elements
+         * \param delta_condensed_end: The stopping iterator of the update of the condensed dof of all elements
+         */
+        template <class global_iter, class condensed_iter>
+        void recoverCondensedDOF(const meshAssembly::MeshConnectivity &connectivity,
+                                 const meshAssembly::DofNumbering &numbering, const ElementCondensation &condensation,
+                                 const global_iter &delta_begin, const global_iter &delta_end,
+                                 condensed_iter delta_condensed_begin, condensed_iter delta_condensed_end) {
+            using delta_type = typename std::iterator_traits<global_iter>::value_type;
+
+            const size_type num_condensed = condensation.getNumCondensedDOF();
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(
+                (size_type)(delta_condensed_end - delta_condensed_begin) ==
+                    num_condensed * connectivity.getNumElements(),
+                "The condensed update must have a size equal to the number of condensed dof of all of the elements")
+
+            std::vector<delta_type> delta_retained(condensation.getNumRetainedDOF());
+
+            for (size_type e = 0; e < connectivity.getNumElements(); ++e) {
+                TARDIGRADE_ERROR_TOOLS_CATCH(meshAssembly::gatherElement(connectivity, numbering, e, delta_begin,
+                                                                         delta_end, std::begin(delta_retained),
+                                                                         std::end(delta_retained)));
+
+                TARDIGRADE_ERROR_TOOLS_CATCH(condensation.recoverElement(
+                    e, std::cbegin(delta_retained), std::cend(delta_retained),
+                    delta_condensed_begin + num_condensed * e, delta_condensed_begin + num_condensed * (e + 1)));
+            }
+        }
+
+    }  // namespace staticCondensation
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,9 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_thread_pool.cpp
+ ******************************************************************************
+ * The source file for a work-stealing thread pool
+ ******************************************************************************
+ */
+
+#include "tardigrade_thread_pool.h"
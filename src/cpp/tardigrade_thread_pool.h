@@ -0,0 +1,189 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_thread_pool.h
+ ******************************************************************************
+ * The header file for a work-stealing thread pool. The cost of an element
+ * varies with the element type, the number of active phases, and the faces
+ * which are growing, so a static partition of the elements over threads
+ * leaves threads idle. Each thread of the pool owns a queue of tasks which
+ * are contiguous ranges of indices. Threads take tasks from the front of
+ * their own queue and steal from the back of the queues of the other threads
+ * when their queue is empty. A loop may be started from within a task, e.g.
+ * over the integration points of an element, in which case the thread which
+ * started it works on the loop until it is finished.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_THREAD_POOL_H
+#define TARDIGRADE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tardigrade_error_tools.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace threadPool {
+
+        typedef std::size_t size_type;  //!< The type of the indices of a loop
+
+        constexpr std::size_t cache_line_size = 64;  //!< The assumed size of a cache line in bytes
+
+        /*!
+         * A pool of threads which evaluates loops by work stealing. A thread outside of the pool which starts a loop
+         * is worker 0 and takes part in the loop. Loops may be started from any number of threads outside of the pool
+         * at the same time. The pool runs one of them at a time and the others wait until it has finished, so worker 0
+         * and its per-thread scratch belong to one outside thread at a time. Loops started from within a task of the
+         * pool (nested loops) do not wait.
+         */
+        class ThreadPool {
+           public:
+            inline explicit ThreadPool(const unsigned int num_threads = std::thread::hardware_concurrency());
+
+            inline ~ThreadPool();
+
+            ThreadPool(const ThreadPool &) = delete;
+
+            ThreadPool &operator=(const ThreadPool &) = delete;
+
+            //! Get the number of threads including the calling thread
+            unsigned int getNumThreads() const { return _num_threads; }
+
+            inline unsigned int getCurrentWorker() const;
+
+            template <class index_function>
+            void parallelFor(const size_type num_indices, const size_type grain_size, index_function function);
+
+            template <typename T, class map_function, class combine_function>
+            T parallelReduce(const size_type num_indices, const size_type grain_size, const T &identity,
+                             map_function map, combine_function combine, const bool deterministic = true);
+
+           protected:
+            /*!
+             * A loop which has been split into tasks
+             */
+            struct Job {
+                std::function<void(unsigned int, size_type, size_type)> function;  //!< The function of a range
+
+                std::atomic<size_type> remaining;  //!< The number of tasks which have not finished
+
+                std::mutex error_mutex;  //!< The mutex protecting the error
+
+                std::exception_ptr error;  //!< The first exception thrown by a task
+            };
+
+            /*!
+             * A contiguous range of the indices of a job
+             */
+            struct Task {
+                Job *job;  //!< The job the task belongs to
+
+                size_type first;  //!< The first index of the task
+
+                size_type last;  //!< One past the last index of the task
+            };
+
+            /*!
+             * The task queue of a thread which is padded to a cache line to avoid false sharing
+             */
+            struct alignas(cache_line_size) WorkerQueue {
+                std::mutex mutex;  //!< The mutex protecting the tasks
+
+                std::deque<Task> tasks;  //!< The tasks owned by the thread
+            };
+
+            inline bool popTask(const unsigned int worker, Task &task);
+
+            inline bool stealTask(const unsigned int worker, Task &task);
+
+            inline bool popJobTask(const unsigned int worker, const Job &job, Task &task);
+
+            inline void runTask(const unsigned int worker, const Task &task);
+
+            inline void runJob(Job &job, const size_type num_indices, const size_type grain_size);
+
+            inline void workerLoop(const unsigned int worker);
+
+            unsigned int _num_threads;  //!< The number of threads including the calling thread
+
+            std::unique_ptr<WorkerQueue[]> _queues;  //!< The task queue of each thread
+
+            std::vector<std::thread> _threads;  //!< The threads of the pool other than the calling thread
+
+            std::atomic<size_type> _queued_tasks;  //!< The number of tasks in all of the queues
+
+            std::atomic<bool> _stop;  //!< Flag indicating that the threads should exit
+
+            std::mutex _sleep_mutex;  //!< The mutex idle threads wait on
+
+            std::condition_variable _wake;  //!< The condition variable which wakes idle threads
+
+            std::mutex _entry_mutex;  //!< The mutex held by the outside thread whose loop the pool is running
+
+            std::atomic<std::thread::id> _entry_owner;  //!< The outside thread whose loop the pool is running
+
+            inline static thread_local const ThreadPool *_current_pool = nullptr;  //!< The pool of the thread
+
+            inline static thread_local unsigned int _current_worker = 0;  //!< The worker index of the thread
+        };
+
+        /*!
+         * Scratch storage with one value for each thread of a pool. Each value is aligned to a cache line so that
+         * threads writing to their own value do not invalidate the cache lines of the other threads.
+         */
+        template <typename T>
+        class PerThreadScratch {
+           public:
+            /*!
+             * Constructor for the per-thread scratch
+             *
+             * \param num_threads: The number of threads
+             * \param &prototype: The initial value of the scratch of each thread
+             */
+            PerThreadScratch(const unsigned int num_threads, const T &prototype = T())
+                : _values(num_threads, Padded{prototype}) {}
+
+            //! Get the number of threads
+            unsigned int size() const { return (unsigned int)_values.size(); }
+
+            /*!
+             * Get the scratch of a thread
+             *
+             * \param worker: The index of the thread
+             */
+            T &operator[](const unsigned int worker) { return _values[worker].value; }
+
+            /*!
+             * Get the scratch of a thread
+             *
+             * \param worker: The index of the thread
+             */
+            const T &operator[](const unsigned int worker) const { return _values[worker].value; }
+
+           protected:
+            /*!
+             * A value padded to a cache line
+             */
+            struct alignas(cache_line_size) Padded {
+                T value;  //!< The value
+            };
+
+            std::vector<Padded> _values;  //!< The values of each thread
+        };
+
+    }  // namespace threadPool
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_thread_pool.tpp"
+
+#endif
@@ -0,0 +1,358 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_thread_pool.tpp
+ ******************************************************************************
+ * The template file for a work-stealing thread pool
+ ******************************************************************************
+ */
+
+#include <algorithm>
+
+#include "tardigrade_thread_pool.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace threadPool {
+
+        /*!
+         * Constructor for the thread pool. The pool starts num_threads - 1 threads and the calling thread is the
+         * remaining worker.
+         *
+         * \param num_threads: The number of threads including the calling thread. 0 is treated as 1
+         */
+        ThreadPool::ThreadPool(const unsigned int num_threads)
+            : _num_threads(std::max(num_threads, 1u)),
+              _queues(new WorkerQueue[std::max(num_threads, 1u)]),
+              _queued_tasks(0),
+              _stop(false) {
+            _threads.reserve(_num_threads - 1);
+
+            for (unsigned int worker = 1; worker < _num_threads; ++worker) {
+                _threads.emplace_back(&ThreadPool::workerLoop, this, worker);
+            }
+        }
+
+        /*!
+         * Destructor for the thread pool which joins the threads
+         */
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(_sleep_mutex);
+
+                _stop = true;
+            }
+
+            _wake.notify_all();
+
+            for (auto &thread : _threads) {
+                thread.join();
+            }
+        }
+
+        /*!
+         * Get the worker index of the calling thread. Threads outside of the pool are worker 0 which is only used by
+         * the outside thread whose loop the pool is running.
+         */
+        unsigned int ThreadPool::getCurrentWorker() const { return (_current_pool == this) ? _current_worker : 0; }
+
+        /*!
+         * Take the first task from the queue of a thread
+         *
+         * \param worker: The index of the thread
+         * \param &task: The task
+         */
+        bool ThreadPool::popTask(const unsigned int worker, Task &task) {
+            std::lock_guard<std::mutex> lock(_queues[worker].mutex);
+
+            if (_queues[worker].tasks.empty()) {
+                return false;
+            }
+
+            task = _queues[worker].tasks.front();
+
+            _queues[worker].tasks.pop_front();
+
+            --_queued_tasks;
+
+            return true;
+        }
+
+        /*!
+         * Take the last task from the queue of another thread. The queues are visited starting from the next thread
+         * so that the thieves spread over the victims.
+         *
+         * \param worker: The index of the stealing thread
+         * \param &task: The task
+         */
+        bool ThreadPool::stealTask(const unsigned int worker, Task &task) {
+            for (unsigned int offset = 1; offset < _num_threads; ++offset) {
+                const unsigned int victim = (worker + offset) % _num_threads;
+
+                std::lock_guard<std::mutex> lock(_queues[victim].mutex);
+
+                if (!_queues[victim].tasks.empty()) {
+                    task = _queues[victim].tasks.back();
+
+                    _queues[victim].tasks.pop_back();
+
+                    --_queued_tasks;
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /*!
+         * Take the last task from the queue of a thread if it belongs to a job. The tasks of a nested job are the last
+         * tasks of the queue of the thread which started it.
+         *
+         * \param worker: The index of the thread
+         * \param &job: The job
+         * \param &task: The task
+         */
+        bool ThreadPool::popJobTask(const unsigned int worker, const Job &job, Task &task) {
+            std::lock_guard<std::mutex> lock(_queues[worker].mutex);
+
+            if (_queues[worker].tasks.empty() || (_queues[worker].tasks.back().job != &job)) {
+                return false;
+            }
+
+            task = _queues[worker].tasks.back();
+
+            _queues[worker].tasks.pop_back();
+
+            --_queued_tasks;
+
+            return true;
+        }
+
+        /*!
+         * Run a task and mark it as finished. An exception thrown by the task is stored in its job.
+         *
+         * \param worker: The index of the thread running the task
+         * \param &task: The task
+         */
+        void ThreadPool::runTask(const unsigned int worker, const Task &task) {
+            Job *job = task.job;
+
+            try {
+                job->function(worker, task.first, task.last);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(job->error_mutex);
+
+                if (!job->error) {
+                    job->error = std::current_exception();
+                }
+            }
+
+            // This must be the last access of the job since the thread waiting on it may return once it is zero
+            job->remaining.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        /*!
+         * Split a job into tasks, queue them, and work on the tasks of the pool until the job is finished. A job
+         * started outside of a task is split over the queues of all of the threads in contiguous blocks. A job started
+         * inside of a task (a nested loop) is queued on the calling thread so that it is worked on by that thread and
+         * by any thread which runs out of work. While waiting on a nested job the calling thread only runs the tasks
+         * of that job so that the per-thread scratch of the task which started the job is not reused by an unrelated
+         * task on the same thread. A job started by a thread outside of the pool which is not already running a job of
+         * the pool waits until the jobs started by other outside threads have finished so that only one outside thread
+         * is worker 0 at a time.
+         *
+         * \param &job: The job
+         * \param num_indices: The number of indices of the loop
+         * \param grain_size: The number of indices of each task
+         */
+        void ThreadPool::runJob(Job &job, const size_type num_indices, const size_type grain_size) {
+            const size_type grain     = std::max(grain_size, (size_type)1);
+            const size_type num_tasks = (num_indices + grain - 1) / grain;
+            const unsigned int worker = getCurrentWorker();
+            const bool nested         = (_current_pool == this) || (_entry_owner.load() == std::this_thread::get_id());
+
+            job.remaining = num_tasks;
+
+            if (num_tasks == 0) {
+                return;
+            }
+
+            std::unique_lock<std::mutex> entry_lock(_entry_mutex, std::defer_lock);
+
+            if (!nested) {
+                entry_lock.lock();
+
+                _entry_owner = std::this_thread::get_id();
+            }
+
+            _queued_tasks += num_tasks;
+
+            for (unsigned int owner = 0; owner < _num_threads; ++owner) {
+                const size_type first_task = nested ? ((owner == worker) ? 0 : num_tasks)
+                                                    : (num_tasks * owner) / _num_threads;
+                const size_type last_task  = nested ? ((owner == worker) ? num_tasks : 0)
+                                                    : (num_tasks * (owner + 1)) / _num_threads;
+
+                if (first_task == last_task) {
+                    continue;
+                }
+
+                std::lock_guard<std::mutex> lock(_queues[owner].mutex);
+
+                for (size_type t = first_task; t < last_task; ++t) {
+                    _queues[owner].tasks.push_back(
+                        Task{&job, grain * t, std::min(grain * (t + 1), num_indices)});
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_sleep_mutex);
+            }
+
+            _wake.notify_all();
+
+            Task task;
+
+            while (job.remaining.load(std::memory_order_acquire) > 0) {
+                if (nested ? popJobTask(worker, job, task) : (popTask(worker, task) || stealTask(worker, task))) {
+                    runTask(worker, task);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+
+            if (!nested) {
+                _entry_owner = std::thread::id();
+            }
+
+            if (job.error) {
+                std::rethrow_exception(job.error);
+            }
+        }
+
+        /*!
+         * The loop of a thread of the pool which runs tasks until the pool is destroyed
+         *
+         * \param worker: The index of the thread
+         */
+        void ThreadPool::workerLoop(const unsigned int worker) {
+            _current_pool   = this;
+            _current_worker = worker;
+
+            Task task;
+
+            while (true) {
+                if (popTask(worker, task) || stealTask(worker, task)) {
+                    runTask(worker, task);
+
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(_sleep_mutex);
+
+                _wake.wait(lock, [&] { return _stop || (_queued_tasks > 0); });
+
+                if (_stop && (_queued_tasks == 0)) {
+                    return;
+                }
+            }
+        }
+
+        /*!
+         * Call a function for each index of a loop. The indices are split into tasks of grain_size contiguous indices
+         * which are balanced over the threads by work stealing. The function is called as
+         *
+         * function( worker, index )
+         *
+         * where worker is the index of the thread in [0, getNumThreads()) which may be used to select per-thread
+         * scratch storage. The function may start loops of its own which must use scratch storage separate from the
+         * scratch of the outer loop. Any exception thrown by the function is re-thrown on the calling thread after all
+         * of the tasks of the loop have finished.
+         *
+         * \param num_indices: The number of indices of the loop
+         * \param grain_size: The number of indices of each task
+         * \param function: The function to call for each index
+         */
+        template <class index_function>
+        void ThreadPool::parallelFor(const size_type num_indices, const size_type grain_size,
+                                     index_function function) {
+            Job job;
+
+            job.function = [&function](const unsigned int worker, const size_type first, const size_type last) {
+                for (size_type index = first; index < last; ++index) {
+                    function(worker, index);
+                }
+            };
+
+            runJob(job, num_indices, grain_size);
+        }
+
+        /*!
+         * Reduce a loop. The map function is called as
+         *
+         * map( worker, index, partial )
+         *
+         * and adds the contribution of an index to a partial result which starts as the identity. The partial results
+         * are combined with
+         *
+         * combine( result, partial )
+         *
+         * which adds a partial result to the result. If deterministic is true each task has its own partial result and
+         * the partial results are combined in the order of the tasks so that the result only depends on the grain size
+         * and not on the number of threads or the order in which the tasks ran. Otherwise each thread has its own
+         * partial result which uses less memory but the result may change between runs in the last bits.
+         *
+         * \param num_indices: The number of indices of the loop
+         * \param grain_size: The number of indices of each task
+         * \param &identity: The identity of the reduction
+         * \param map: The function adding the contribution of an index to a partial result
+         * \param combine: The function adding a partial result to the result
+         * \param deterministic: Flag indicating that the order of the reduction should be fixed
+         */
+        template <typename T, class map_function, class combine_function>
+        T ThreadPool::parallelReduce(const size_type num_indices, const size_type grain_size, const T &identity,
+                                     map_function map, combine_function combine, const bool deterministic) {
+            const size_type grain = std::max(grain_size, (size_type)1);
+
+            T result = identity;
+
+            Job job;
+
+            if (deterministic) {
+                std::vector<T> partials((num_indices + grain - 1) / grain, identity);
+
+                job.function = [&](const unsigned int worker, const size_type first, const size_type last) {
+                    T &partial = partials[first / grain];
+
+                    for (size_type index = first; index < last; ++index) {
+                        map(worker, index, partial);
+                    }
+                };
+
+                runJob(job, num_indices, grain);
+
+                for (const auto &partial : partials) {
+                    combine(result, partial);
+                }
+            } else {
+                PerThreadScratch<T> partials(_num_threads, identity);
+
+                job.function = [&](const unsigned int worker, const size_type first, const size_type last) {
+                    for (size_type index = first; index < last; ++index) {
+                        map(worker, index, partials[worker]);
+                    }
+                };
+
+                runJob(job, num_indices, grain);
+
+                for (unsigned int worker = 0; worker < _num_threads; ++worker) {
+                    combine(result, partials[worker]);
+                }
+            }
+
+            return result;
+        }
+
+    }  // namespace threadPool
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,10 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_time_integration.cpp
+ ******************************************************************************
+ * The source file for the implicit time integration of the nodal degrees of
+ * freedom
+ ******************************************************************************
+ */
+
+#include "tardigrade_time_integration.h"
@@ -0,0 +1,165 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_time_integration.h
+ ******************************************************************************
+ * The header file for the implicit time integration of the nodal degrees of
+ * freedom. Every multiphase kernel takes the rates of the degrees of freedom
+ * and the derivatives of the first and second rates w.r.t. the degrees of
+ * freedom as scalars. The time integrator stores the values, rates, and
+ * accelerations of the previous step as contiguous arrays over all of the
+ * global degrees of freedom, computes the state the balance equations are
+ * evaluated at for a trial solution, and supplies the derivative scalars
+ * which are consistent with the scheme. All of the fields are updated in a
+ * single branch-free sweep. The schemes are backward Euler, Newmark-beta,
+ * and the generalized-alpha method of Chung and Hulbert.
+ ******************************************************************************
+ */
+
+#ifndef TARDIGRADE_TIME_INTEGRATION_H
+#define TARDIGRADE_TIME_INTEGRATION_H
+
+#include <vector>
+
+#include "tardigrade_error_tools.h"
+#include "tardigrade_mesh_assembly.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace timeIntegration {
+
+        typedef meshAssembly::size_type size_type;  //!< Define the size type to be the same as the mesh assembly
+
+        typedef meshAssembly::floatType floatType;  //!< Define the float type to be the same as the mesh assembly
+
+        /*!
+         * The time integration schemes
+         */
+        enum TimeIntegrationScheme : unsigned int {
+            BACKWARD_EULER    = 0,  //!< First order backward differences of the values and the rates
+            NEWMARK_BETA      = 1,  //!< The Newmark-beta method
+            GENERALIZED_ALPHA = 2   //!< The generalized-alpha method
+        };
+
+        /*!
+         * The parameters of a time integration scheme. The balance equations are evaluated at the values and rates
+         * \f$ u_{n + \alpha_f} \f$ and \f$ \dot{u}_{n + \alpha_f} \f$ and the accelerations \f$ \ddot{u}_{n + \alpha_m}
+         * \f$ where \f$ \alpha = 1 \f$ is the end of the step. The new rates and accelerations follow from the Newmark
+         * relations with beta and gamma.
+         */
+        struct TimeIntegrationParameters {
+            TimeIntegrationScheme scheme = BACKWARD_EULER;  //!< The scheme
+
+            floatType beta = 0.25;  //!< The Newmark parameter of the displacement update
+
+            floatType gamma = 0.5;  //!< The Newmark parameter of the velocity update
+
+            floatType alpha_m = 1;  //!< The fraction of the step the accelerations are evaluated at
+
+            floatType alpha_f = 1;  //!< The fraction of the step the values and rates are evaluated at
+        };
+
+        inline TimeIntegrationParameters backwardEuler();
+
+        inline TimeIntegrationParameters newmarkBeta(const floatType beta = 0.25, const floatType gamma = 0.5);
+
+        inline TimeIntegrationParameters generalizedAlpha(const floatType rho_infinity);
+
+        /*!
+         * The time history of the global degrees of freedom and the update of the rates and accelerations. The
+         * history is stored as three contiguous arrays (values, rates, and accelerations) indexed by the global
+         * degree of freedom.
+         *
+         * The derivative of the residual w.r.t. the values at the end of the step is the Jacobian computed by the
+         * kernels at the evaluation state with the scalars getDOFDotdDOF and getDOFDDotdDOF multiplied by
+         * getJacobianScale. The scale is one for backward Euler and Newmark-beta.
+         */
+        template <typename T>
+        class TimeIntegrator {
+           public:
+            /*!
+             * Default constructor
+             */
+            TimeIntegrator() : _parameters(), _values(), _rates(), _accelerations() {}
+
+            TimeIntegrator(const size_type num_dof, const TimeIntegrationParameters &parameters = backwardEuler());
+
+            //! Get the number of degrees of freedom
+            size_type getNumDOF() const { return (size_type)_values.size(); }
+
+            //! Get the parameters of the scheme
+            const TimeIntegrationParameters &getParameters() const { return _parameters; }
+
+            //! Get the values of the previous step
+            const std::vector<T> &getPreviousValues() const { return _values; }
+
+            //! Get the rates of the previous step
+            const std::vector<T> &getPreviousRates() const { return _rates; }
+
+            //! Get the accelerations of the previous step
+            const std::vector<T> &getPreviousAccelerations() const { return _accelerations; }
+
+            template <class values_iter, class rates_iter, class accelerations_iter>
+            void setHistory(const values_iter &values_begin, const values_iter &values_end,
+                            const rates_iter &rates_begin, const rates_iter &rates_end,
+                            const accelerations_iter &accelerations_begin, const accelerations_iter &accelerations_end);
+
+            T getDOFDotdDOF(const T &dt) const;
+
+            T getDOFDDotdDOF(const T &dt) const;
+
+            //! Get the factor the kernel Jacobians are multiplied by
+            T getJacobianScale() const { return _parameters.alpha_f; }
+
+            template <class dof_iter, class rate_iter, class acceleration_iter>
+            void computeRates(const T &dt, const dof_iter &dof_begin, const dof_iter &dof_end, rate_iter rate_begin,
+                              rate_iter rate_end, acceleration_iter acceleration_begin,
+                              acceleration_iter acceleration_end) const;
+
+            template <class dof_iter, class value_iter, class rate_iter, class acceleration_iter>
+            void computeEvaluationState(const T &dt, const dof_iter &dof_begin, const dof_iter &dof_end,
+                                        value_iter value_begin, value_iter value_end, rate_iter rate_begin,
+                                        rate_iter rate_end, acceleration_iter acceleration_begin,
+                                        acceleration_iter acceleration_end) const;
+
+            template <class dof_iter>
+            void advance(const T &dt, const dof_iter &dof_begin, const dof_iter &dof_end);
+
+           protected:
+            /*!
+             * The coefficients of the new rate and acceleration of a degree of freedom in terms of the increment of
+             * its value and its previous rate and acceleration
+             */
+            struct Coefficients {
+                T rate_increment;  //!< The coefficient of the increment in the rate
+
+                T rate_rate;  //!< The coefficient of the previous rate in the rate
+
+                T rate_acceleration;  //!< The coefficient of the previous acceleration in the rate
+
+                T acceleration_increment;  //!< The coefficient of the increment in the acceleration
+
+                T acceleration_rate;  //!< The coefficient of the previous rate in the acceleration
+
+                T acceleration_acceleration;  //!< The coefficient of the previous acceleration in the acceleration
+            };
+
+            Coefficients getCoefficients(const T &dt) const;
+
+            void checkSize(const size_type size, const std::string &name) const;
+
+            TimeIntegrationParameters _parameters;  //!< The parameters of the scheme
+
+            std::vector<T> _values;  //!< The values of the previous step
+
+            std::vector<T> _rates;  //!< The rates of the previous step
+
+            std::vector<T> _accelerations;  //!< The accelerations of the previous step
+        };
+
+    }  // namespace timeIntegration
+
+}  // namespace tardigradeBalanceEquations
+
+#include "tardigrade_time_integration.tpp"
+
+#endif
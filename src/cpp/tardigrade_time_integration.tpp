@@ -0,0 +1,333 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_time_integration.tpp
+ ******************************************************************************
+ * The template file for the implicit time integration of the nodal degrees of
+ * freedom
+ ******************************************************************************
+ */
+
+#include <algorithm>
+#include <string>
+
+#include "tardigrade_time_integration.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace timeIntegration {
+
+        /*!
+         * The parameters of backward Euler where the rate is the backward difference of the values and the
+         * acceleration is the backward difference of the rates
+         */
+        TimeIntegrationParameters backwardEuler() { return TimeIntegrationParameters(); }
+
+        /*!
+         * The parameters of the Newmark-beta method. The defaults are the unconditionally stable average
+         * acceleration method.
+         *
+         * \param beta: The Newmark parameter of the displacement update
+         * \param gamma: The Newmark parameter of the velocity update
+         */
+        TimeIntegrationParameters newmarkBeta(const floatType beta, const floatType gamma) {
+            TARDIGRADE_ERROR_TOOLS_CHECK(beta > 0, "The Newmark beta must be positive")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK(gamma > 0, "The Newmark gamma must be positive")
+
+            TimeIntegrationParameters parameters;
+
+            parameters.scheme = NEWMARK_BETA;
+            parameters.beta   = beta;
+            parameters.gamma  = gamma;
+
+            return parameters;
+        }
+
+        /*!
+         * The parameters of the generalized-alpha method of Chung and Hulbert written so that the values and rates
+         * are evaluated at \f$ n + \alpha_f \f$ and the accelerations at \f$ n + \alpha_m \f$. The method is
+         * second order accurate and unconditionally stable with the high frequency dissipation controlled by the
+         * spectral radius at infinity.
+         *
+         * \f$ \alpha_m = \frac{2 - \rho_\infty}{1 + \rho_\infty} \f$, \f$ \alpha_f = \frac{1}{1 +
+         * \rho_\infty} \f$, \f$ \gamma = \frac{1}{2} + \alpha_m - \alpha_f \f$, \f$ \beta = \frac{1}{4} \left( 1 +
+         * \alpha_m - \alpha_f \right)^2 \f$
+         *
+         * \param rho_infinity: The spectral radius at infinity between zero (maximum dissipation) and one (none)
+         */
+        TimeIntegrationParameters generalizedAlpha(const floatType rho_infinity) {
+            TARDIGRADE_ERROR_TOOLS_CHECK((rho_infinity >= 0) && (rho_infinity <= 1),
+                                         "The spectral radius at infinity must be between zero and one")
+
+            TimeIntegrationParameters parameters;
+
+            parameters.scheme  = GENERALIZED_ALPHA;
+            parameters.alpha_m = (2 - rho_infinity) / (1 + rho_infinity);
+            parameters.alpha_f = 1 / (1 + rho_infinity);
+            parameters.gamma   = 0.5 + parameters.alpha_m - parameters.alpha_f;
+            parameters.beta    = 0.25 * (1 + parameters.alpha_m - parameters.alpha_f) *
+                              (1 + parameters.alpha_m - parameters.alpha_f);
+
+            return parameters;
+        }
+
+        /*!
+         * Constructor for the time integrator. The history starts at zero.
+         *
+         * \param num_dof: The number of global degrees of freedom
+         * \param &parameters: The parameters of the scheme
+         */
+        template <typename T>
+        TimeIntegrator<T>::TimeIntegrator(const size_type num_dof, const TimeIntegrationParameters &parameters)
+            : _parameters(parameters), _values(num_dof), _rates(num_dof), _accelerations(num_dof) {
+            TARDIGRADE_ERROR_TOOLS_CHECK((parameters.alpha_m > 0) && (parameters.alpha_f > 0),
+                                         "The evaluation fractions of the step must be positive")
+
+            TARDIGRADE_ERROR_TOOLS_CHECK((parameters.scheme == BACKWARD_EULER) ||
+                                             ((parameters.beta > 0) && (parameters.gamma > 0)),
+                                         "The Newmark parameters must be positive")
+        }
+
+        /*!
+         * Check that a vector has one entry for each degree of freedom
+         *
+         * \param size: The size of the vector
+         * \param &name: The name of the vector
+         */
+        template <typename T>
+        void TimeIntegrator<T>::checkSize(const size_type size, const std::string &name) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK(size == getNumDOF(), "The " + name + " has a size of " +
+                                                                  std::to_string(size) + " but should have a size of " +
+                                                                  std::to_string(getNumDOF()))
+        }
+
+        /*!
+         * Set the values, rates, and accelerations of the previous step e.g., the initial conditions
+         *
+         * \param &values_begin: The starting iterator of the values
+         * \param &values_end: The stopping iterator of the values
+         * \param &rates_begin: The starting iterator of the rates
+         * \param &rates_end: The stopping iterator of the rates
+         * \param &accelerations_begin: The starting iterator of the accelerations
+         * \param &accelerations_end: The stopping iterator of the accelerations
+         */
+        template <typename T>
+        template <class values_iter, class rates_iter, class accelerations_iter>
+        void TimeIntegrator<T>::setHistory(const values_iter &values_begin, const values_iter &values_end,
+                                           const rates_iter &rates_begin, const rates_iter &rates_end,
+                                           const accelerations_iter &accelerations_begin,
+                                           const accelerations_iter &accelerations_end) {
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(values_end - values_begin), "values"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(rates_end - rates_begin), "rates"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(
+                checkSize((size_type)(accelerations_end - accelerations_begin), "accelerations"));
+
+            std::copy(values_begin, values_end, std::begin(_values));
+
+            std::copy(rates_begin, rates_end, std::begin(_rates));
+
+            std::copy(accelerations_begin, accelerations_end, std::begin(_accelerations));
+        }
+
+        /*!
+         * Get the coefficients of the new rates and accelerations for a time increment
+         *
+         * \param &dt: The time increment
+         */
+        template <typename T>
+        typename TimeIntegrator<T>::Coefficients TimeIntegrator<T>::getCoefficients(const T &dt) const {
+            TARDIGRADE_ERROR_TOOLS_CHECK(dt > 0, "The time increment must be positive")
+
+            Coefficients c;
+
+            if (_parameters.scheme == BACKWARD_EULER) {
+                c.rate_increment            = 1 / dt;
+                c.rate_rate                 = 0;
+                c.rate_acceleration         = 0;
+                c.acceleration_increment    = 1 / (dt * dt);
+                c.acceleration_rate         = -1 / dt;
+                c.acceleration_acceleration = 0;
+            } else {
+                const T beta  = _parameters.beta;
+                const T gamma = _parameters.gamma;
+
+                c.acceleration_increment    = 1 / (beta * dt * dt);
+                c.acceleration_rate         = -1 / (beta * dt);
+                c.acceleration_acceleration = 1 - 1 / (2 * beta);
+                c.rate_increment            = gamma / (beta * dt);
+                c.rate_rate                 = 1 - gamma / beta;
+                c.rate_acceleration         = dt * (1 - gamma / (2 * beta));
+            }
+
+            return c;
+        }
+
+        /*!
+         * Get the derivative of the rates at the evaluation state w.r.t. the values at the evaluation state. This is
+         * the scalar dUDotdU (and dDensityDotdDensity etc.) of the kernels.
+         *
+         * \param &dt: The time increment
+         */
+        template <typename T>
+        T TimeIntegrator<T>::getDOFDotdDOF(const T &dt) const {
+            Coefficients c;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(c = getCoefficients(dt));
+
+            return c.rate_increment;
+        }
+
+        /*!
+         * Get the derivative of the accelerations at the evaluation state w.r.t. the values at the evaluation state.
+         * This is the scalar dUDDotdU of the kernels.
+         *
+         * \param &dt: The time increment
+         */
+        template <typename T>
+        T TimeIntegrator<T>::getDOFDDotdDOF(const T &dt) const {
+            Coefficients c;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(c = getCoefficients(dt));
+
+            return _parameters.alpha_m * c.acceleration_increment / _parameters.alpha_f;
+        }
+
+        /*!
+         * Compute the rates and accelerations at the end of the step for trial values of the degrees of freedom
+         *
+         * \param &dt: The time increment
+         * \param &dof_begin: The starting iterator of the values at the end of the step
+         * \param &dof_end: The stopping iterator of the values at the end of the step
+         * \param rate_begin: The starting iterator of the rates at the end of the step
+         * \param rate_end: The stopping iterator of the rates at the end of the step
+         * \param acceleration_begin: The starting iterator of the accelerations at the end of the step
+         * \param acceleration_end: The stopping iterator of the accelerations at the end of the step
+         */
+        template <typename T>
+        template <class dof_iter, class rate_iter, class acceleration_iter>
+        void TimeIntegrator<T>::computeRates(const T &dt, const dof_iter &dof_begin, const dof_iter &dof_end,
+                                             rate_iter rate_begin, rate_iter rate_end,
+                                             acceleration_iter acceleration_begin,
+                                             acceleration_iter acceleration_end) const {
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(dof_end - dof_begin), "dof"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(rate_end - rate_begin), "rate"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(
+                checkSize((size_type)(acceleration_end - acceleration_begin), "acceleration"));
+
+            Coefficients c;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(c = getCoefficients(dt));
+
+            const size_type n = getNumDOF();
+
+            for (size_type i = 0; i < n; ++i) {
+                const T increment = *(dof_begin + i) - _values[i];
+
+                *(rate_begin + i) =
+                    c.rate_increment * increment + c.rate_rate * _rates[i] + c.rate_acceleration * _accelerations[i];
+
+                *(acceleration_begin + i) = c.acceleration_increment * increment + c.acceleration_rate * _rates[i] +
+                                            c.acceleration_acceleration * _accelerations[i];
+            }
+        }
+
+        /*!
+         * Compute the values, rates, and accelerations the balance equations are evaluated at for trial values of the
+         * degrees of freedom at the end of the step. For backward Euler and Newmark-beta this is the end of the step.
+         *
+         * \param &dt: The time increment
+         * \param &dof_begin: The starting iterator of the values at the end of the step
+         * \param &dof_end: The stopping iterator of the values at the end of the step
+         * \param value_begin: The starting iterator of the values at the evaluation state
+         * \param value_end: The stopping iterator of the values at the evaluation state
+         * \param rate_begin: The starting iterator of the rates at the evaluation state
+         * \param rate_end: The stopping iterator of the rates at the evaluation state
+         * \param acceleration_begin: The starting iterator of the accelerations at the evaluation state
+         * \param acceleration_end: The stopping iterator of the accelerations at the evaluation state
+         */
+        template <typename T>
+        template <class dof_iter, class value_iter, class rate_iter, class acceleration_iter>
+        void TimeIntegrator<T>::computeEvaluationState(const T &dt, const dof_iter &dof_begin,
+                                                       const dof_iter &dof_end, value_iter value_begin,
+                                                       value_iter value_end, rate_iter rate_begin, rate_iter rate_end,
+                                                       acceleration_iter acceleration_begin,
+                                                       acceleration_iter acceleration_end) const {
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(dof_end - dof_begin), "dof"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(value_end - value_begin), "value"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(rate_end - rate_begin), "rate"));
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(
+                checkSize((size_type)(acceleration_end - acceleration_begin), "acceleration"));
+
+            Coefficients c;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(c = getCoefficients(dt));
+
+            const T alpha_f = _parameters.alpha_f;
+
+            const T alpha_m = _parameters.alpha_m;
+
+            const size_type n = getNumDOF();
+
+            for (size_type i = 0; i < n; ++i) {
+                const T increment = *(dof_begin + i) - _values[i];
+
+                const T rate =
+                    c.rate_increment * increment + c.rate_rate * _rates[i] + c.rate_acceleration * _accelerations[i];
+
+                const T acceleration = c.acceleration_increment * increment + c.acceleration_rate * _rates[i] +
+                                       c.acceleration_acceleration * _accelerations[i];
+
+                *(value_begin + i) = _values[i] + alpha_f * increment;
+
+                *(rate_begin + i) = _rates[i] + alpha_f * (rate - _rates[i]);
+
+                *(acceleration_begin + i) = _accelerations[i] + alpha_m * (acceleration - _accelerations[i]);
+            }
+        }
+
+        /*!
+         * Accept the values of the degrees of freedom at the end of the step and update the history of all of the
+         * degrees of freedom in a single sweep
+         *
+         * \param &dt: The time increment
+         * \param &dof_begin: The starting iterator of the converged values at the end of the step
+         * \param &dof_end: The stopping iterator of the converged values at the end of the step
+         */
+        template <typename T>
+        template <class dof_iter>
+        void TimeIntegrator<T>::advance(const T &dt, const dof_iter &dof_begin, const dof_iter &dof_end) {
+            TARDIGRADE_ERROR_TOOLS_CATCH(checkSize((size_type)(dof_end - dof_begin), "dof"));
+
+            Coefficients c;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH(c = getCoefficients(dt));
+
+            const size_type n = getNumDOF();
+
+            for (size_type i = 0; i < n; ++i) {
+                const T value = *(dof_begin + i);
+
+                const T increment = value - _values[i];
+
+                const T rate =
+                    c.rate_increment * increment + c.rate_rate * _rates[i] + c.rate_acceleration * _accelerations[i];
+
+                const T acceleration = c.acceleration_increment * increment + c.acceleration_rate * _rates[i] +
+                                       c.acceleration_acceleration * _accelerations[i];
+
+                _values[i]        = value;
+                _rates[i]         = rate;
+                _accelerations[i] = acceleration;
+            }
+        }
+
+    }  // namespace timeIntegration
+
+}  // namespace tardigradeBalanceEquations
@@ -0,0 +1,111 @@
+/**
+ * \file tardigrade_compressed_jacobian_checks.h
+ *
+ * Checks shared by the tests of the compressed Jacobians of the balance equations and constraints
+ */
+
+#ifndef TARDIGRADE_COMPRESSED_JACOBIAN_CHECKS_H
+#define TARDIGRADE_COMPRESSED_JACOBIAN_CHECKS_H
+
+#include <tardigrade_jacobian_sparsity.h>
+
+#include <array>
+#include <iterator>
+
+#include <boost/test/unit_test.hpp>
+
+namespace compressedJacobianChecks {
+
+    namespace sparsity = tardigradeBalanceEquations::jacobianSparsity;
+
+    /*!
+     * Zero the columns of a material response Jacobian which are outside of a material response sparsity pattern
+     * so that the dense Jacobians of a kernel only couple to the fields in the pattern.
+     *
+     * \param phase: The phase of the material response
+     * \param &material_response_jacobian: The Jacobian of the material response with respect to the degrees of
+     *     freedom and their spatial gradients
+     */
+    template <class material_response_pattern, unsigned int dim, unsigned int nphases, unsigned int num_additional_dof,
+              unsigned int material_response_size, class material_response_jacobian_type>
+    void maskMaterialResponseJacobian(const unsigned int phase,
+                                      material_response_jacobian_type &material_response_jacobian) {
+        constexpr unsigned int num_dof = nphases * 10 + num_additional_dof;
+
+        // The first degree of freedom of each field block in the ordering of the degree of freedom vector
+        const std::array<unsigned int, sparsity::num_field_blocks> field_indices = {0, 4, 1, 7, 8, 9, 10};
+
+        for (unsigned int f = 0; f < sparsity::num_field_blocks; ++f) {
+            const unsigned int field = 1u << f;
+            const unsigned int width = sparsity::getFieldWidth(field, dim, num_additional_dof);
+
+            for (unsigned int p = 0; p < ((field == sparsity::ADDITIONAL_DOF) ? 1 : nphases); ++p) {
+                const bool is_coupled =
+                    material_response_pattern::hasField(field) &&
+                    ((field == sparsity::ADDITIONAL_DOF) || material_response_pattern::isGlobal(field) || (p == phase));
+
+                if (is_coupled) {
+                    continue;
+                }
+
+                for (unsigned int k = 0; k < width; ++k) {
+                    const unsigned int K = nphases * field_indices[f] + width * p + k;
+
+                    for (unsigned int r = 0; r < material_response_size; ++r) {
+                        material_response_jacobian[num_dof * (1 + dim) * r + K] = 0;
+
+                        for (unsigned int a = 0; a < dim; ++a) {
+                            material_response_jacobian[num_dof * (1 + dim) * r + num_dof + dim * K + a] = 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * Expand a compressed Jacobian and check it against the dense Jacobians of the same kernel. The number of rows
+     * of the Jacobians is taken from the sizes of the dense Jacobians.
+     *
+     * \param nphases: The number of phases
+     * \param num_additional_dof: The number of additional degrees of freedom
+     * \param phase: The phase of the kernel
+     * \param &jacobian: The compressed Jacobian
+     * \param &dRdRho: The dense Jacobian with respect to the densities
+     * \param &dRdU: The dense Jacobian with respect to the displacements
+     * \param &dRdW: The dense Jacobian with respect to the rotations
+     * \param &dRdTheta: The dense Jacobian with respect to the temperatures
+     * \param &dRdE: The dense Jacobian with respect to the internal energies
+     * \param &dRdVF: The dense Jacobian with respect to the volume fractions
+     * \param &dRdZ: The dense Jacobian with respect to the additional degrees of freedom
+     */
+    template <class pattern, unsigned int dim, class jacobian_type, class phase_jacobian_type,
+              class vector_jacobian_type, class additional_jacobian_type>
+    void checkCompressedJacobian(const unsigned int nphases, const unsigned int num_additional_dof,
+                                 const unsigned int phase, const jacobian_type &jacobian,
+                                 const phase_jacobian_type &dRdRho, const vector_jacobian_type &dRdU,
+                                 const vector_jacobian_type &dRdW, const phase_jacobian_type &dRdTheta,
+                                 const phase_jacobian_type &dRdE, const phase_jacobian_type &dRdVF,
+                                 const additional_jacobian_type &dRdZ) {
+        phase_jacobian_type      dRdRho_c, dRdTheta_c, dRdE_c, dRdVF_c;
+        vector_jacobian_type     dRdU_c, dRdW_c;
+        additional_jacobian_type dRdZ_c;
+
+        sparsity::expandCompressedJacobian<pattern, dim>(
+            nphases, num_additional_dof, phase, std::cbegin(jacobian), std::cend(jacobian), std::begin(dRdRho_c),
+            std::end(dRdRho_c), std::begin(dRdU_c), std::end(dRdU_c), std::begin(dRdW_c), std::end(dRdW_c),
+            std::begin(dRdTheta_c), std::end(dRdTheta_c), std::begin(dRdE_c), std::end(dRdE_c), std::begin(dRdVF_c),
+            std::end(dRdVF_c), std::begin(dRdZ_c), std::end(dRdZ_c));
+
+        BOOST_TEST(dRdRho_c == dRdRho, boost::test_tools::per_element());
+        BOOST_TEST(dRdU_c == dRdU, boost::test_tools::per_element());
+        BOOST_TEST(dRdW_c == dRdW, boost::test_tools::per_element());
+        BOOST_TEST(dRdTheta_c == dRdTheta, boost::test_tools::per_element());
+        BOOST_TEST(dRdE_c == dRdE, boost::test_tools::per_element());
+        BOOST_TEST(dRdVF_c == dRdVF, boost::test_tools::per_element());
+        BOOST_TEST(dRdZ_c == dRdZ, boost::test_tools::per_element());
+    }
+
+}  // namespace compressedJacobianChecks
+
+#endif
@@ -0,0 +1,387 @@
+/**
+ * \file test_tardigrade_automatic_differentiation.cpp
+ *
+ * Tests for tardigrade_automatic_differentiation
+ */
+
+#include <tardigrade_automatic_differentiation.h>
+#include <tardigrade_balance_of_energy.h>
+#include <tardigrade_balance_of_linear_momentum.h>
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#define BOOST_TEST_MODULE test_tardigrade_automatic_differentiation
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+namespace ad = tardigradeBalanceEquations::automaticDifferentiation;
+
+BOOST_AUTO_TEST_CASE(test_Dual_arithmetic, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the arithmetic and elementary functions of the dual number
+     */
+
+    using dual = ad::Dual<floatType, 2>;
+
+    const floatType x0 = 1.3, y0 = 0.7;
+
+    dual x(x0, 0);
+
+    dual y(y0, 1);
+
+    dual f = (x * y + 2. * x - y / x) / (1. + y) - 3.;
+
+    BOOST_TEST(f.value == (x0 * y0 + 2 * x0 - y0 / x0) / (1 + y0) - 3);
+
+    BOOST_TEST(f.derivatives[0] == (y0 + 2 + y0 / (x0 * x0)) / (1 + y0));
+
+    BOOST_TEST(f.derivatives[1] ==
+               (x0 - 1 / x0) / (1 + y0) - (x0 * y0 + 2 * x0 - y0 / x0) / ((1 + y0) * (1 + y0)));
+
+    dual g = ad::sqrt(x) + ad::exp(y) - ad::log(x * y) + ad::pow(x, 3.) - ad::abs(-y);
+
+    BOOST_TEST(g.value == std::sqrt(x0) + std::exp(y0) - std::log(x0 * y0) + std::pow(x0, 3) - y0);
+
+    BOOST_TEST(g.derivatives[0] == 0.5 / std::sqrt(x0) - 1 / x0 + 3 * x0 * x0);
+
+    BOOST_TEST(g.derivatives[1] == std::exp(y0) - 1 / y0 - 1);
+
+    dual h = -x;
+
+    h += y;
+
+    h -= 1.;
+
+    h *= x;
+
+    h /= y;
+
+    BOOST_TEST(h.value == (y0 - x0 - 1) * x0 / y0);
+
+    BOOST_TEST(h.derivatives[0] == (y0 - 2 * x0 - 1) / y0);
+
+    BOOST_TEST(h.derivatives[1] == x0 / y0 - (y0 - x0 - 1) * x0 / (y0 * y0));
+
+    BOOST_TEST((x > y));
+
+    BOOST_TEST((x < 2.));
+
+    BOOST_TEST((x != y));
+
+    boost::test_tools::output_test_stream result;
+
+    result << x;
+
+    BOOST_TEST(result.is_equal("1.3 [ 1 0 ]"));
+}
+
+BOOST_AUTO_TEST_CASE(test_seedLanes_extractLanes, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test seeding and extracting the derivative lanes
+     */
+
+    using dual = ad::Dual<floatType, 4>;
+
+    std::array<floatType, 2> values = {2.0, 3.0};
+
+    std::array<dual, 2> x;
+
+    ad::seedLanes<floatType, 4>(std::cbegin(values), std::cend(values), 1, std::begin(x), std::end(x));
+
+    std::array<dual, 2> f = {x[0] * x[1], x[0] / x[1]};
+
+    std::array<floatType, 2> f_value;
+
+    std::array<floatType, 8> f_derivatives;
+
+    ad::extractLanes<floatType, 4>(std::cbegin(f), std::cend(f), std::begin(f_value), std::end(f_value),
+                                   std::begin(f_derivatives), std::end(f_derivatives));
+
+    std::array<floatType, 2> value_answer = {6.0, 2.0 / 3.0};
+
+    std::array<floatType, 8> derivative_answer = {0, 3.0, 2.0, 0, 0, 1.0 / 3.0, -2.0 / 9.0, 0};
+
+    BOOST_TEST(f_value == value_answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(f_derivatives == derivative_answer, CHECK_PER_ELEMENT);
+
+    BOOST_CHECK_THROW(
+        (ad::seedLanes<floatType, 4>(std::cbegin(values), std::cend(values), 3, std::begin(x), std::end(x))),
+        std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentum_ad, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the Jacobian computed by passing dual numbers through the residual overload of the balance of linear
+     * momentum matches the hand-coded Jacobian
+     */
+
+    constexpr unsigned int dim = 3;
+
+    // Lanes: density (1), displacement (dim), body force (dim), cauchy stress (dim * dim), volume fraction (1)
+    constexpr int num_lanes = 1 + dim + dim + dim * dim + 1;
+
+    using dual = ad::Dual<floatType, num_lanes>;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = 0.5 + 0.3 * std::sin(1.7 * i + offset);
+        }
+    };
+
+    floatType density = 1.2, density_dot = 0.3, volume_fraction = 0.4;
+
+    floatType test_function = 0.6, interpolation_function = 0.45;
+
+    floatType dRhoDotdRho = 1.4, dUDotdU = 2.1, dUDDotdU = 3.3;
+
+    std::array<floatType, dim> density_gradient, velocity, velocity_dot, body_force, test_function_gradient,
+        interpolation_function_gradient;
+
+    std::array<floatType, dim * dim> velocity_gradient, cauchy_stress;
+
+    fill(density_gradient, 0.1);
+    fill(velocity, 0.2);
+    fill(velocity_dot, 0.3);
+    fill(body_force, 0.4);
+    fill(test_function_gradient, 0.5);
+    fill(interpolation_function_gradient, 0.6);
+    fill(velocity_gradient, 0.7);
+    fill(cauchy_stress, 0.8);
+
+    // Hand-coded Jacobian
+    std::array<floatType, dim>             result, dRdRho, dRdVolumeFraction;
+    std::array<floatType, dim * dim>       dRdU, dRdB, dRdUMesh;
+    std::array<floatType, dim * dim * dim> dRdCauchy;
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim>(
+        density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity),
+        std::cend(velocity), std::cbegin(velocity_dot), std::cend(velocity_dot), std::cbegin(velocity_gradient),
+        std::cend(velocity_gradient), std::cbegin(body_force), std::cend(body_force), std::cbegin(cauchy_stress),
+        std::cend(cauchy_stress), volume_fraction, test_function, std::cbegin(test_function_gradient),
+        std::cend(test_function_gradient), interpolation_function, std::cbegin(interpolation_function_gradient),
+        std::cend(interpolation_function_gradient), dRhoDotdRho, dUDotdU, dUDDotdU, std::begin(result),
+        std::end(result), std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU), std::end(dRdU), std::begin(dRdB),
+        std::end(dRdB), std::begin(dRdCauchy), std::end(dRdCauchy), std::begin(dRdVolumeFraction),
+        std::end(dRdVolumeFraction), std::begin(dRdUMesh), std::end(dRdUMesh));
+
+    // Seed the lanes following the interpolation of the degrees of freedom
+    dual ad_density(density, 0, interpolation_function);
+
+    dual ad_density_dot(density_dot, 0, dRhoDotdRho * interpolation_function);
+
+    dual ad_volume_fraction(volume_fraction, num_lanes - 1);
+
+    std::array<dual, dim> ad_density_gradient, ad_velocity, ad_velocity_dot, ad_body_force;
+
+    std::array<dual, dim * dim> ad_velocity_gradient, ad_cauchy_stress;
+
+    for (unsigned int i = 0; i < dim; ++i) {
+        ad_density_gradient[i] = dual(density_gradient[i], 0, interpolation_function_gradient[i]);
+
+        ad_velocity[i] = dual(velocity[i], 1 + i, dUDotdU * interpolation_function);
+
+        ad_velocity_dot[i] = dual(velocity_dot[i], 1 + i, dUDDotdU * interpolation_function);
+
+        for (unsigned int j = 0; j < dim; ++j) {
+            ad_velocity_gradient[dim * i + j] =
+                dual(velocity_gradient[dim * i + j], 1 + i, dUDotdU * interpolation_function_gradient[j]);
+        }
+    }
+
+    ad::seedLanes<floatType, num_lanes>(std::cbegin(body_force), std::cend(body_force), 1 + dim,
+                                        std::begin(ad_body_force), std::end(ad_body_force));
+
+    ad::seedLanes<floatType, num_lanes>(std::cbegin(cauchy_stress), std::cend(cauchy_stress), 1 + 2 * dim,
+                                        std::begin(ad_cauchy_stress), std::end(ad_cauchy_stress));
+
+    std::array<dual, dim> ad_result;
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim>(
+        ad_density, ad_density_dot, std::cbegin(ad_density_gradient), std::cend(ad_density_gradient),
+        std::cbegin(ad_velocity), std::cend(ad_velocity), std::cbegin(ad_velocity_dot), std::cend(ad_velocity_dot),
+        std::cbegin(ad_velocity_gradient), std::cend(ad_velocity_gradient), std::cbegin(ad_body_force),
+        std::cend(ad_body_force), std::cbegin(ad_cauchy_stress), std::cend(ad_cauchy_stress), ad_volume_fraction,
+        dual(test_function), std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        std::begin(ad_result), std::end(ad_result));
+
+    std::array<floatType, dim> ad_value;
+
+    std::array<floatType, dim * num_lanes> ad_jacobian;
+
+    ad::extractLanes<floatType, num_lanes>(std::cbegin(ad_result), std::cend(ad_result), std::begin(ad_value),
+                                           std::end(ad_value), std::begin(ad_jacobian), std::end(ad_jacobian));
+
+    BOOST_TEST(ad_value == result, CHECK_PER_ELEMENT);
+
+    for (unsigned int i = 0; i < dim; ++i) {
+        BOOST_TEST(ad_jacobian[num_lanes * i + 0] == dRdRho[i]);
+
+        for (unsigned int j = 0; j < dim; ++j) {
+            BOOST_TEST(ad_jacobian[num_lanes * i + 1 + j] == dRdU[dim * i + j]);
+
+            BOOST_TEST(ad_jacobian[num_lanes * i + 1 + dim + j] == dRdB[dim * i + j]);
+        }
+
+        for (unsigned int j = 0; j < dim * dim; ++j) {
+            BOOST_TEST(ad_jacobian[num_lanes * i + 1 + 2 * dim + j] == dRdCauchy[dim * dim * i + j]);
+        }
+
+        BOOST_TEST(ad_jacobian[num_lanes * i + num_lanes - 1] == dRdVolumeFraction[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergy_ad, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the Jacobian computed by passing dual numbers through the residual overload of the balance of energy
+     * matches the hand-coded Jacobian
+     */
+
+    constexpr unsigned int dim = 3;
+
+    // Lanes: density (1), internal energy (1), displacement (dim), cauchy stress (dim * dim), volume fraction (1),
+    // internal heat generation (1), net interphase force (dim), heat flux (dim)
+    constexpr int num_lanes = 1 + 1 + dim + dim * dim + 1 + 1 + dim + dim;
+
+    using dual = ad::Dual<floatType, num_lanes>;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = 0.5 + 0.3 * std::sin(1.7 * i + offset);
+        }
+    };
+
+    floatType density = 1.2, density_dot = 0.3, internal_energy = 2.4, internal_energy_dot = -0.2;
+
+    floatType volume_fraction = 0.4, internal_heat_generation = 0.8;
+
+    floatType test_function = 0.6, interpolation_function = 0.45;
+
+    floatType dRhoDotdRho = 1.4, dEDotdE = 1.9, dUDotdU = 2.1;
+
+    std::array<floatType, dim> density_gradient, internal_energy_gradient, velocity, net_interphase_force, heat_flux,
+        test_function_gradient, interpolation_function_gradient;
+
+    std::array<floatType, dim * dim> velocity_gradient, cauchy_stress;
+
+    fill(density_gradient, 0.1);
+    fill(internal_energy_gradient, 0.2);
+    fill(velocity, 0.3);
+    fill(net_interphase_force, 0.4);
+    fill(heat_flux, 0.5);
+    fill(test_function_gradient, 0.6);
+    fill(interpolation_function_gradient, 0.7);
+    fill(velocity_gradient, 0.8);
+    fill(cauchy_stress, 0.9);
+
+    // Hand-coded Jacobian
+    floatType result, dRdRho, dRdE, dRdVolumeFraction, dRdr;
+
+    std::array<floatType, dim> dRdU, dRdpi, dRdq, dRdUMesh;
+
+    std::array<floatType, dim * dim> dRdCauchy;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false>(
+        density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), internal_energy,
+        internal_energy_dot, std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient),
+        std::cbegin(velocity), std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+        std::cbegin(cauchy_stress), std::cend(cauchy_stress), volume_fraction, internal_heat_generation,
+        std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+        std::cend(heat_flux), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        interpolation_function, std::cbegin(interpolation_function_gradient),
+        std::cend(interpolation_function_gradient), dRhoDotdRho, dEDotdE, dUDotdU, result, dRdRho, dRdE,
+        std::begin(dRdU), std::end(dRdU), std::begin(dRdCauchy), std::end(dRdCauchy), dRdVolumeFraction, dRdr,
+        std::begin(dRdpi), std::end(dRdpi), std::begin(dRdq), std::end(dRdq), std::begin(dRdUMesh),
+        std::end(dRdUMesh));
+
+    // Seed the lanes following the interpolation of the degrees of freedom
+    constexpr int cauchy_lane = 2 + dim;
+
+    constexpr int volume_fraction_lane = cauchy_lane + dim * dim;
+
+    constexpr int pi_lane = volume_fraction_lane + 2;
+
+    constexpr int q_lane = pi_lane + dim;
+
+    dual ad_density(density, 0, interpolation_function);
+
+    dual ad_density_dot(density_dot, 0, dRhoDotdRho * interpolation_function);
+
+    dual ad_internal_energy(internal_energy, 1, interpolation_function);
+
+    dual ad_internal_energy_dot(internal_energy_dot, 1, dEDotdE * interpolation_function);
+
+    dual ad_volume_fraction(volume_fraction, volume_fraction_lane);
+
+    dual ad_internal_heat_generation(internal_heat_generation, volume_fraction_lane + 1);
+
+    std::array<dual, dim> ad_density_gradient, ad_internal_energy_gradient, ad_velocity, ad_net_interphase_force,
+        ad_heat_flux;
+
+    std::array<dual, dim * dim> ad_velocity_gradient, ad_cauchy_stress;
+
+    for (unsigned int i = 0; i < dim; ++i) {
+        ad_density_gradient[i] = dual(density_gradient[i], 0, interpolation_function_gradient[i]);
+
+        ad_internal_energy_gradient[i] = dual(internal_energy_gradient[i], 1, interpolation_function_gradient[i]);
+
+        ad_velocity[i] = dual(velocity[i], 2 + i, dUDotdU * interpolation_function);
+
+        for (unsigned int j = 0; j < dim; ++j) {
+            ad_velocity_gradient[dim * i + j] =
+                dual(velocity_gradient[dim * i + j], 2 + i, dUDotdU * interpolation_function_gradient[j]);
+        }
+    }
+
+    ad::seedLanes<floatType, num_lanes>(std::cbegin(cauchy_stress), std::cend(cauchy_stress), cauchy_lane,
+                                        std::begin(ad_cauchy_stress), std::end(ad_cauchy_stress));
+
+    ad::seedLanes<floatType, num_lanes>(std::cbegin(net_interphase_force), std::cend(net_interphase_force), pi_lane,
+                                        std::begin(ad_net_interphase_force), std::end(ad_net_interphase_force));
+
+    ad::seedLanes<floatType, num_lanes>(std::cbegin(heat_flux), std::cend(heat_flux), q_lane,
+                                        std::begin(ad_heat_flux), std::end(ad_heat_flux));
+
+    dual ad_result;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false>(
+        ad_density, ad_density_dot, std::cbegin(ad_density_gradient), std::cend(ad_density_gradient),
+        ad_internal_energy, ad_internal_energy_dot, std::cbegin(ad_internal_energy_gradient),
+        std::cend(ad_internal_energy_gradient), std::cbegin(ad_velocity), std::cend(ad_velocity),
+        std::cbegin(ad_velocity_gradient), std::cend(ad_velocity_gradient), std::cbegin(ad_cauchy_stress),
+        std::cend(ad_cauchy_stress), ad_volume_fraction, ad_internal_heat_generation,
+        std::cbegin(ad_net_interphase_force), std::cend(ad_net_interphase_force), std::cbegin(ad_heat_flux),
+        std::cend(ad_heat_flux), dual(test_function), std::cbegin(test_function_gradient),
+        std::cend(test_function_gradient), ad_result);
+
+    BOOST_TEST(ad_result.value == result);
+
+    BOOST_TEST(ad_result.derivatives[0] == dRdRho);
+
+    BOOST_TEST(ad_result.derivatives[1] == dRdE);
+
+    for (unsigned int i = 0; i < dim; ++i) {
+        BOOST_TEST(ad_result.derivatives[2 + i] == dRdU[i]);
+
+        BOOST_TEST(ad_result.derivatives[pi_lane + i] == dRdpi[i]);
+
+        BOOST_TEST(ad_result.derivatives[q_lane + i] == dRdq[i]);
+    }
+
+    for (unsigned int i = 0; i < dim * dim; ++i) {
+        BOOST_TEST(ad_result.derivatives[cauchy_lane + i] == dRdCauchy[i]);
+    }
+
+    BOOST_TEST(ad_result.derivatives[volume_fraction_lane] == dRdVolumeFraction);
+
+    BOOST_TEST(ad_result.derivatives[volume_fraction_lane + 1] == dRdr);
+}
@@ -11,6 +11,7 @@
 #define USE_EIGEN
 #include <tardigrade_vector_tools.h>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -19,6 +20,8 @@
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include "tardigrade_compressed_jacobian_checks.h"
+
 #define DEFAULT_TEST_TOLERANCE 1e-6
 #define CHECK_PER_ELEMENT boost::test_tools::per_element()
 
@@ -7387,3 +7390,342 @@ BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergy_hydra_fea_multiphase, *boost::u
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergyJVP, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the Jacobian-vector product of the balance of energy is consistent with the dense Jacobians
+     */
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 17;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, nphases>                                                density, density_dot, vf;
+    std::array<floatType, nphases>                                                internal_energy, internal_energy_dot;
+    std::array<floatType, nphases * dim>                                          density_gradient, v;
+    std::array<floatType, nphases * dim>                                          internal_energy_gradient;
+    std::array<floatType, nphases * dim * dim>                                    v_gradient;
+    std::array<floatType, nphases * material_response_size>                       material_response;
+    std::array<floatType, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                          dof_gradient;
+    std::array<floatType, dim>                                                    test_function_gradient;
+    std::array<floatType, dim>                                                    interp_gradient;
+    std::array<floatType, num_dof>                                                delta;
+    std::array<floatType, dim>                                                    delta_mesh;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(internal_energy, 0.25);
+    fill(internal_energy_dot, 0.35);
+    fill(vf, 0.3);
+    fill(density_gradient, 0.4);
+    fill(internal_energy_gradient, 0.45);
+    fill(v, 0.5);
+    fill(v_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(material_response_jacobian, 0.9);
+    fill(dof_gradient, 1.0);
+    fill(test_function_gradient, 1.1);
+    fill(interp_gradient, 1.2);
+    fill(delta, 1.3);
+    fill(delta_mesh, 1.4);
+
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dEDotdE = 1.7, dUDotdU = 2.1;
+
+    // Dense Jacobians
+    std::array<floatType, nphases>                      result;
+    std::array<floatType, nphases * nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+    std::array<floatType, nphases * nphases * dim>      dRdU, dRdW;
+    std::array<floatType, nphases * num_additional_dof> dRdZ;
+    std::array<floatType, nphases * dim>                dRdUMesh;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 9, 10, 13, 16,
+                                                                        material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(material_response), std::cend(material_response),
+        std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), std::cbegin(vf),
+        std::cend(vf), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient), interp,
+        std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient),
+        dRhoDotdRho, dEDotdE, dUDotdU, std::begin(result), std::end(result), std::begin(dRdRho), std::end(dRdRho),
+        std::begin(dRdU), std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+        std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ),
+        std::begin(dRdUMesh), std::end(dRdUMesh));
+
+    std::array<floatType, nphases> answer;
+    std::fill(std::begin(answer), std::end(answer), 0);
+
+    for (unsigned int i = 0; i < nphases; ++i) {
+        for (unsigned int p = 0; p < nphases; ++p) {
+            answer[i] += dRdRho[nphases * i + p] * delta[nphases * 0 + p];
+            answer[i] += dRdTheta[nphases * i + p] * delta[nphases * 7 + p];
+            answer[i] += dRdE[nphases * i + p] * delta[nphases * 8 + p];
+            answer[i] += dRdVF[nphases * i + p] * delta[nphases * 9 + p];
+        }
+
+        for (unsigned int k = 0; k < nphases * dim; ++k) {
+            answer[i] += dRdW[nphases * dim * i + k] * delta[nphases * 1 + k];
+            answer[i] += dRdU[nphases * dim * i + k] * delta[nphases * 4 + k];
+        }
+
+        for (unsigned int z = 0; z < num_additional_dof; ++z) {
+            answer[i] += dRdZ[num_additional_dof * i + z] * delta[nphases * 10 + z];
+        }
+
+        for (unsigned int a = 0; a < dim; ++a) {
+            answer[i] += dRdUMesh[dim * i + a] * delta_mesh[a];
+        }
+    }
+
+    // Interpolate the nodal perturbation to the point
+    std::array<floatType, num_dof>       dof_perturbation;
+    std::array<floatType, num_dof * dim> dof_perturbation_gradient;
+    std::array<floatType, dim * dim>     mesh_displacement_perturbation_gradient;
+
+    for (unsigned int K = 0; K < num_dof; ++K) {
+        dof_perturbation[K] = interp * delta[K];
+        for (unsigned int a = 0; a < dim; ++a) {
+            dof_perturbation_gradient[dim * K + a] = interp_gradient[a] * delta[K];
+        }
+    }
+
+    for (unsigned int a = 0; a < dim; ++a) {
+        for (unsigned int k = 0; k < dim; ++k) {
+            mesh_displacement_perturbation_gradient[dim * a + k] = delta_mesh[a] * interp_gradient[k];
+        }
+    }
+
+    std::array<floatType, nphases> result_jvp, jvp;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyJVP<dim, false, dim, 0, 9, 10, 13, 16,
+                                                                           material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(material_response), std::cend(material_response),
+        std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), std::cbegin(vf),
+        std::cend(vf), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        std::cbegin(dof_gradient), std::cend(dof_gradient), std::cbegin(dof_perturbation),
+        std::cend(dof_perturbation), std::cbegin(dof_perturbation_gradient), std::cend(dof_perturbation_gradient),
+        std::cbegin(mesh_displacement_perturbation_gradient), std::cend(mesh_displacement_perturbation_gradient),
+        dRhoDotdRho, dEDotdE, dUDotdU, std::begin(result_jvp), std::end(result_jvp), std::begin(jvp),
+        std::end(jvp));
+
+    BOOST_TEST(result_jvp == result, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(jvp == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergyPhaseBatched, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the phase-batched balance of energy is consistent with the multiphase balance of energy
+     */
+
+    constexpr unsigned int dim     = 3;
+    constexpr unsigned int nphases = 5;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, nphases>             density, density_dot, internal_energy, internal_energy_dot;
+    std::array<floatType, nphases>             vf, internal_heat_generation;
+    std::array<floatType, nphases * dim>       density_gradient, internal_energy_gradient, v;
+    std::array<floatType, nphases * dim>       net_interphase_force, heat_flux;
+    std::array<floatType, nphases * dim * dim> v_gradient, cauchy_stress;
+    std::array<floatType, dim>                 test_function_gradient;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(internal_energy, 0.25);
+    fill(internal_energy_dot, 0.35);
+    fill(vf, 0.3);
+    fill(internal_heat_generation, 0.32);
+    fill(density_gradient, 0.4);
+    fill(internal_energy_gradient, 0.45);
+    fill(v, 0.5);
+    fill(net_interphase_force, 0.55);
+    fill(heat_flux, 0.6);
+    fill(v_gradient, 0.7);
+    fill(cauchy_stress, 0.75);
+    fill(test_function_gradient, 1.1);
+
+    const floatType test_function = 0.34;
+
+    std::array<floatType, nphases> answer, result;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(cauchy_stress), std::cend(cauchy_stress),
+        std::cbegin(vf), std::cend(vf), std::cbegin(internal_heat_generation), std::cend(internal_heat_generation),
+        std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+        std::cend(heat_flux), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        std::begin(answer), std::end(answer));
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyPhaseBatched<dim, false, nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(cauchy_stress), std::cend(cauchy_stress),
+        std::cbegin(vf), std::cend(vf), std::cbegin(internal_heat_generation), std::cend(internal_heat_generation),
+        std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+        std::cend(heat_flux), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        std::begin(result), std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    // Internal energy per unit volume
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, true>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(cauchy_stress), std::cend(cauchy_stress),
+        std::cbegin(vf), std::cend(vf), std::cbegin(internal_heat_generation), std::cend(internal_heat_generation),
+        std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+        std::cend(heat_flux), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        std::begin(answer), std::end(answer));
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyPhaseBatched<dim, true, nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(cauchy_stress), std::cend(cauchy_stress),
+        std::cbegin(vf), std::cend(vf), std::cbegin(internal_heat_generation), std::cend(internal_heat_generation),
+        std::cbegin(net_interphase_force), std::cend(net_interphase_force), std::cbegin(heat_flux),
+        std::cend(heat_flux), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient),
+        std::begin(result), std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergyCompressed, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the compressed Jacobian of the balance of energy is consistent with the dense Jacobians
+     */
+
+    namespace sparsity = tardigradeBalanceEquations::jacobianSparsity;
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 17;
+    constexpr unsigned int phase                     = 1;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, dim * dim>                                    velocity_gradient;
+    std::array<floatType, dim>                                          density_gradient, internal_energy_gradient;
+    std::array<floatType, dim>                                          velocity;
+    std::array<floatType, material_response_size>                       material_response;
+    std::array<floatType, material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                dof_gradient;
+    std::array<floatType, dim>                                          test_function_gradient, interp_gradient;
+
+    fill(density_gradient, 0.4);
+    fill(internal_energy_gradient, 0.45);
+    fill(velocity, 0.5);
+    fill(velocity_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(dof_gradient, 1.0);
+    fill(test_function_gradient, 1.1);
+    fill(interp_gradient, 1.2);
+
+    const floatType density = 1.1, density_dot = 0.2, internal_energy = 0.6, internal_energy_dot = 0.15;
+    const floatType volume_fraction = 0.3, test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dEDotdE = 1.7, dUDotdU = 2.1;
+
+    auto check = [&](auto pattern_tag) {
+        using material_response_pattern = decltype(pattern_tag);
+        using pattern = tardigradeBalanceEquations::balanceOfEnergy::BalanceOfEnergySparsity<material_response_pattern>;
+
+        // Zero the material response Jacobian outside of the pattern
+        fill(material_response_jacobian, 0.9);
+
+        compressedJacobianChecks::maskMaterialResponseJacobian<material_response_pattern, dim, nphases,
+                                                               num_additional_dof, material_response_size>(
+            phase, material_response_jacobian);
+
+        // Dense Jacobians
+        floatType                                 result;
+        std::array<floatType, nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+        std::array<floatType, nphases * dim>      dRdU, dRdW;
+        std::array<floatType, num_additional_dof> dRdZ;
+        std::array<floatType, dim>                dRdUMesh;
+
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 9, 10, 13, 16,
+                                                                            material_response_num_dof>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), internal_energy,
+            internal_energy_dot, std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient),
+            std::cbegin(velocity), std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), volume_fraction, test_function, std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), interp, std::cbegin(interp_gradient), std::cend(interp_gradient),
+            std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dEDotdE, dUDotdU, phase, result,
+            std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU), std::end(dRdU), std::begin(dRdW), std::end(dRdW),
+            std::begin(dRdTheta), std::end(dRdTheta), std::begin(dRdE), std::end(dRdE), std::begin(dRdVF),
+            std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ), std::begin(dRdUMesh), std::end(dRdUMesh));
+
+        // Compressed Jacobian
+        constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+        floatType                          result_compressed;
+        std::array<floatType, num_columns> jacobian;
+        std::array<floatType, dim>         dRdUMesh_compressed;
+
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyCompressed<
+            dim, false, dim, 0, 9, 10, 13, 16, material_response_num_dof, material_response_pattern>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), internal_energy,
+            internal_energy_dot, std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient),
+            std::cbegin(velocity), std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), volume_fraction, test_function, std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), interp, std::cbegin(interp_gradient), std::cend(interp_gradient),
+            std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dEDotdE, dUDotdU, nphases, phase,
+            result_compressed, std::begin(jacobian), std::end(jacobian), std::begin(dRdUMesh_compressed),
+            std::end(dRdUMesh_compressed));
+
+        BOOST_TEST(result_compressed == result);
+        compressedJacobianChecks::checkCompressedJacobian<pattern, dim>(
+            nphases, num_additional_dof, phase, jacobian, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ);
+        BOOST_TEST(dRdUMesh_compressed == dRdUMesh, CHECK_PER_ELEMENT);
+
+        return num_columns;
+    };
+
+    // A material response which depends on every degree of freedom of every phase
+    BOOST_TEST(check(sparsity::DensePattern()) == nphases * 10 + num_additional_dof);
+
+    // A material response which depends only on the temperature of its own phase
+    BOOST_TEST(check(sparsity::SparsityPattern<sparsity::TEMPERATURE, 0>()) == 1 + dim + 1 + 1 + 1);
+
+    // A material response which depends on the density of all of the phases and the additional dof
+    BOOST_TEST(check(sparsity::SparsityPattern<0, sparsity::DENSITY | sparsity::ADDITIONAL_DOF>()) ==
+               nphases + dim + 1 + 1 + num_additional_dof);
+}
@@ -11,6 +11,7 @@
 #define USE_EIGEN
 #include <tardigrade_vector_tools.h>
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -19,6 +20,8 @@
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include "tardigrade_compressed_jacobian_checks.h"
+
 #define DEFAULT_TEST_TOLERANCE 1e-6
 #define CHECK_PER_ELEMENT boost::test_tools::per_element()
 
@@ -4482,3 +4485,246 @@ BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentum_hydra_multiphase_fea, *
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentumJVP, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the Jacobian-vector product of the balance of linear momentum is consistent with the dense Jacobians
+     */
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 16;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, nphases>                                                density, density_dot, vf;
+    std::array<floatType, nphases * dim>                                          density_gradient, v, v_dot;
+    std::array<floatType, nphases * dim * dim>                                    v_gradient;
+    std::array<floatType, nphases * material_response_size>                       material_response;
+    std::array<floatType, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                          dof_gradient;
+    std::array<floatType, dim>                                                    test_function_gradient;
+    std::array<floatType, dim>                                                    interp_gradient;
+    std::array<floatType, num_dof>                                                delta;
+    std::array<floatType, dim>                                                    delta_mesh;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(vf, 0.3);
+    fill(density_gradient, 0.4);
+    fill(v, 0.5);
+    fill(v_dot, 0.6);
+    fill(v_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(material_response_jacobian, 0.9);
+    fill(dof_gradient, 1.0);
+    fill(test_function_gradient, 1.1);
+    fill(interp_gradient, 1.2);
+    fill(delta, 1.3);
+    fill(delta_mesh, 1.4);
+
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dUDotdU = 2.1, dUDDotdU = 3.4;
+
+    // Dense Jacobians
+    std::array<floatType, dim * nphases>                      result;
+    std::array<floatType, dim * nphases * nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+    std::array<floatType, dim * nphases * nphases * dim>      dRdU, dRdW;
+    std::array<floatType, dim * nphases * num_additional_dof> dRdZ;
+    std::array<floatType, dim * nphases * dim>                dRdUMesh;
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim, dim, 0, 3, 12,
+                                                                                        material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(v), std::cend(v), std::cbegin(v_dot),
+        std::cend(v_dot), std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(material_response),
+        std::cend(material_response), std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+        std::cbegin(vf), std::cend(vf), test_function, std::cbegin(test_function_gradient),
+        std::cend(test_function_gradient), interp, std::cbegin(interp_gradient), std::cend(interp_gradient),
+        std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dUDotdU, dUDDotdU, std::begin(result),
+        std::end(result), std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU), std::end(dRdU), std::begin(dRdW),
+        std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta), std::begin(dRdE), std::end(dRdE),
+        std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ), std::begin(dRdUMesh),
+        std::end(dRdUMesh));
+
+    std::array<floatType, dim * nphases> answer;
+    std::fill(std::begin(answer), std::end(answer), 0);
+
+    for (unsigned int i = 0; i < dim * nphases; ++i) {
+        for (unsigned int p = 0; p < nphases; ++p) {
+            answer[i] += dRdRho[nphases * i + p] * delta[nphases * 0 + p];
+            answer[i] += dRdTheta[nphases * i + p] * delta[nphases * 7 + p];
+            answer[i] += dRdE[nphases * i + p] * delta[nphases * 8 + p];
+            answer[i] += dRdVF[nphases * i + p] * delta[nphases * 9 + p];
+        }
+
+        for (unsigned int k = 0; k < nphases * dim; ++k) {
+            answer[i] += dRdW[nphases * dim * i + k] * delta[nphases * 1 + k];
+            answer[i] += dRdU[nphases * dim * i + k] * delta[nphases * 4 + k];
+        }
+
+        for (unsigned int z = 0; z < num_additional_dof; ++z) {
+            answer[i] += dRdZ[num_additional_dof * i + z] * delta[nphases * 10 + z];
+        }
+
+        for (unsigned int a = 0; a < dim; ++a) {
+            answer[i] += dRdUMesh[dim * i + a] * delta_mesh[a];
+        }
+    }
+
+    // Interpolate the nodal perturbation to the point
+    std::array<floatType, num_dof>       dof_perturbation;
+    std::array<floatType, num_dof * dim> dof_perturbation_gradient;
+    std::array<floatType, dim * dim>     mesh_displacement_perturbation_gradient;
+
+    for (unsigned int K = 0; K < num_dof; ++K) {
+        dof_perturbation[K] = interp * delta[K];
+        for (unsigned int a = 0; a < dim; ++a) {
+            dof_perturbation_gradient[dim * K + a] = interp_gradient[a] * delta[K];
+        }
+    }
+
+    for (unsigned int a = 0; a < dim; ++a) {
+        for (unsigned int k = 0; k < dim; ++k) {
+            mesh_displacement_perturbation_gradient[dim * a + k] = delta_mesh[a] * interp_gradient[k];
+        }
+    }
+
+    std::array<floatType, dim * nphases> result_jvp, jvp;
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentumJVP<dim, dim, 0, 3, 12,
+                                                                                           material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(v), std::cend(v), std::cbegin(v_dot),
+        std::cend(v_dot), std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(material_response),
+        std::cend(material_response), std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+        std::cbegin(vf), std::cend(vf), test_function, std::cbegin(test_function_gradient),
+        std::cend(test_function_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient),
+        std::cbegin(dof_perturbation), std::cend(dof_perturbation), std::cbegin(dof_perturbation_gradient),
+        std::cend(dof_perturbation_gradient), std::cbegin(mesh_displacement_perturbation_gradient),
+        std::cend(mesh_displacement_perturbation_gradient), dRhoDotdRho, dUDotdU, dUDDotdU, std::begin(result_jvp),
+        std::end(result_jvp), std::begin(jvp), std::end(jvp));
+
+    BOOST_TEST(result_jvp == result, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(jvp == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentumCompressed,
+                     *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the compressed Jacobian of the balance of linear momentum is consistent with the dense Jacobians
+     */
+
+    namespace sparsity = tardigradeBalanceEquations::jacobianSparsity;
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 16;
+    constexpr unsigned int phase                     = 1;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, dim * dim>                                    v_gradient;
+    std::array<floatType, dim>                                          density_gradient, v, v_dot;
+    std::array<floatType, material_response_size>                       material_response;
+    std::array<floatType, material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                dof_gradient;
+    std::array<floatType, dim>                                          test_function_gradient, interp_gradient;
+
+    fill(density_gradient, 0.4);
+    fill(v, 0.5);
+    fill(v_dot, 0.6);
+    fill(v_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(dof_gradient, 1.0);
+    fill(test_function_gradient, 1.1);
+    fill(interp_gradient, 1.2);
+
+    const floatType density = 1.1, density_dot = 0.2, vf = 0.3;
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dUDotdU = 2.1, dUDDotdU = 3.4;
+
+    auto check = [&](auto pattern_tag) {
+        using material_response_pattern = decltype(pattern_tag);
+        using pattern = tardigradeBalanceEquations::balanceOfLinearMomentum::BalanceOfLinearMomentumSparsity<
+            material_response_pattern>;
+
+        // Zero the material response Jacobian outside of the pattern
+        fill(material_response_jacobian, 0.9);
+
+        compressedJacobianChecks::maskMaterialResponseJacobian<material_response_pattern, dim, nphases,
+                                                               num_additional_dof, material_response_size>(
+            phase, material_response_jacobian);
+
+        // Dense Jacobians
+        std::array<floatType, dim>                      result;
+        std::array<floatType, dim * nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+        std::array<floatType, dim * nphases * dim>      dRdU, dRdW;
+        std::array<floatType, dim * num_additional_dof> dRdZ;
+        std::array<floatType, dim * dim>                dRdUMesh;
+
+        tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim, dim, 0, 3, 12,
+                                                                                            material_response_num_dof>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(v),
+            std::cend(v), std::cbegin(v_dot), std::cend(v_dot), std::cbegin(v_gradient), std::cend(v_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), vf, test_function, std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), interp, std::cbegin(interp_gradient), std::cend(interp_gradient),
+            std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dUDotdU, dUDDotdU, phase,
+            std::begin(result), std::end(result), std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU),
+            std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+            std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ),
+            std::begin(dRdUMesh), std::end(dRdUMesh));
+
+        // Compressed Jacobian
+        constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+        std::array<floatType, dim>               result_compressed;
+        std::array<floatType, dim * num_columns> jacobian;
+        std::array<floatType, dim * dim>         dRdUMesh_compressed;
+
+        tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentumCompressed<
+            dim, dim, 0, 3, 12, material_response_num_dof, material_response_pattern>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(v),
+            std::cend(v), std::cbegin(v_dot), std::cend(v_dot), std::cbegin(v_gradient), std::cend(v_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), vf, test_function, std::cbegin(test_function_gradient),
+            std::cend(test_function_gradient), interp, std::cbegin(interp_gradient), std::cend(interp_gradient),
+            std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dUDotdU, dUDDotdU, nphases, phase,
+            std::begin(result_compressed), std::end(result_compressed), std::begin(jacobian), std::end(jacobian),
+            std::begin(dRdUMesh_compressed), std::end(dRdUMesh_compressed));
+
+        BOOST_TEST(result_compressed == result, CHECK_PER_ELEMENT);
+        compressedJacobianChecks::checkCompressedJacobian<pattern, dim>(
+            nphases, num_additional_dof, phase, jacobian, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ);
+        BOOST_TEST(dRdUMesh_compressed == dRdUMesh, CHECK_PER_ELEMENT);
+
+        return num_columns;
+    };
+
+    // A material response which depends on every degree of freedom of every phase
+    BOOST_TEST(check(sparsity::DensePattern()) == nphases * 10 + num_additional_dof);
+
+    // A material response which depends only on the displacement and temperature of its own phase
+    BOOST_TEST(check(sparsity::SparsityPattern<sparsity::DISPLACEMENT | sparsity::TEMPERATURE, 0>()) ==
+               1 + dim + dim + 1 + 1);
+
+    // A material response which depends on the temperature of all of the phases and the additional dof
+    BOOST_TEST(check(sparsity::SparsityPattern<0, sparsity::TEMPERATURE | sparsity::ADDITIONAL_DOF>()) ==
+               1 + dim + nphases + 1 + num_additional_dof);
+}
@@ -20,6 +20,8 @@
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include "tardigrade_compressed_jacobian_checks.h"
+
 #define DEFAULT_TEST_TOLERANCE 1e-6
 #define CHECK_PER_ELEMENT boost::test_tools::per_element()
 
@@ -5577,3 +5579,173 @@ BOOST_AUTO_TEST_CASE(test_computeBalanceOfMass_hydra_diffusionTerm_fea_multiphas
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfMassPhaseBatched, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the phase-batched balance of mass is consistent with the multiphase balance of mass
+     */
+
+    constexpr unsigned int nphases = 5;
+    constexpr unsigned int dim     = 3;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, nphases>             density, density_dot;
+    std::array<floatType, nphases * dim>       density_gradient, velocity;
+    std::array<floatType, nphases * dim * dim> velocity_gradient;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(density_gradient, 0.3);
+    fill(velocity, 0.4);
+    fill(velocity_gradient, 0.5);
+
+    std::array<floatType, nphases>             answer, dRdRho_answer, dRdRhoDot_answer;
+    std::array<floatType, nphases * dim>       dRdGradRho_answer, dRdV_answer;
+    std::array<floatType, nphases * dim * dim> dRdGradV_answer;
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(answer), std::end(answer),
+        std::begin(dRdRho_answer), std::end(dRdRho_answer), std::begin(dRdRhoDot_answer), std::end(dRdRhoDot_answer),
+        std::begin(dRdGradRho_answer), std::end(dRdGradRho_answer), std::begin(dRdV_answer), std::end(dRdV_answer),
+        std::begin(dRdGradV_answer), std::end(dRdGradV_answer));
+
+    std::array<floatType, nphases> result;
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(result), std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    std::array<floatType, nphases>             dRdRho, dRdRhoDot;
+    std::array<floatType, nphases * dim>       dRdGradRho, dRdV;
+    std::array<floatType, nphases * dim * dim> dRdGradV;
+
+    std::fill(std::begin(result), std::end(result), 0);
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(result), std::end(result),
+        std::begin(dRdRho), std::end(dRdRho), std::begin(dRdRhoDot), std::end(dRdRhoDot), std::begin(dRdGradRho),
+        std::end(dRdGradRho), std::begin(dRdV), std::end(dRdV), std::begin(dRdGradV), std::end(dRdGradV));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdRho == dRdRho_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdRhoDot == dRdRhoDot_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdGradRho == dRdGradRho_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdV == dRdV_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdGradV == dRdGradV_answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfMassCompressed, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the compressed Jacobian of the balance of mass is consistent with the dense Jacobians
+     */
+
+    namespace sparsity = tardigradeBalanceEquations::jacobianSparsity;
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 17;
+    constexpr unsigned int phase                     = 1;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, dim * dim>                                    velocity_gradient;
+    std::array<floatType, dim>                                          density_gradient, velocity;
+    std::array<floatType, material_response_size>                       material_response;
+    std::array<floatType, material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                dof_gradient;
+    std::array<floatType, dim>                                          interp_gradient;
+
+    fill(density_gradient, 0.4);
+    fill(velocity, 0.5);
+    fill(velocity_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(dof_gradient, 1.0);
+    fill(interp_gradient, 1.2);
+
+    const floatType density = 1.1, density_dot = 0.2;
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dUDotdU = 2.1;
+
+    auto check = [&](auto pattern_tag) {
+        using material_response_pattern = decltype(pattern_tag);
+        using pattern = tardigradeBalanceEquations::balanceOfMass::BalanceOfMassSparsity<material_response_pattern>;
+
+        // Zero the material response Jacobian outside of the pattern
+        fill(material_response_jacobian, 0.9);
+
+        compressedJacobianChecks::maskMaterialResponseJacobian<material_response_pattern, dim, nphases,
+                                                               num_additional_dof, material_response_size>(
+            phase, material_response_jacobian);
+
+        // Dense Jacobians
+        floatType                                 result;
+        std::array<floatType, nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+        std::array<floatType, nphases * dim>      dRdU, dRdW;
+        std::array<floatType, num_additional_dof> dRdZ;
+        std::array<floatType, dim>                dRdUMesh;
+
+        tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, dim, 10, material_response_num_dof>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity),
+            std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), test_function, interp, std::cbegin(interp_gradient),
+            std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dUDotdU,
+            phase, result, std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU), std::end(dRdU), std::begin(dRdW),
+            std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta), std::begin(dRdE), std::end(dRdE),
+            std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ), std::begin(dRdUMesh),
+            std::end(dRdUMesh));
+
+        // Compressed Jacobian
+        constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+        floatType                          result_compressed;
+        std::array<floatType, num_columns> jacobian;
+        std::array<floatType, dim>         dRdUMesh_compressed;
+
+        tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassCompressed<
+            dim, dim, 10, material_response_num_dof, material_response_pattern>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity),
+            std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(material_response), std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), test_function, interp, std::cbegin(interp_gradient),
+            std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient), dRhoDotdRho, dUDotdU,
+            nphases, phase, result_compressed, std::begin(jacobian), std::end(jacobian),
+            std::begin(dRdUMesh_compressed), std::end(dRdUMesh_compressed));
+
+        BOOST_TEST(result_compressed == result);
+        compressedJacobianChecks::checkCompressedJacobian<pattern, dim>(
+            nphases, num_additional_dof, phase, jacobian, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ);
+        BOOST_TEST(dRdUMesh_compressed == dRdUMesh, CHECK_PER_ELEMENT);
+
+        return num_columns;
+    };
+
+    // A material response which depends on every degree of freedom of every phase
+    BOOST_TEST(check(sparsity::DensePattern()) == nphases * 10 + num_additional_dof);
+
+    // A material response which depends only on the temperature of its own phase
+    BOOST_TEST(check(sparsity::SparsityPattern<sparsity::TEMPERATURE, 0>()) == 1 + dim + 1);
+
+    // A material response which depends on the density of all of the phases and the additional dof
+    BOOST_TEST(check(sparsity::SparsityPattern<0, sparsity::DENSITY | sparsity::ADDITIONAL_DOF>()) ==
+               nphases + dim + num_additional_dof);
+}
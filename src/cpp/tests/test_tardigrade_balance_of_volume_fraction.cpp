@@ -20,6 +20,8 @@
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include "tardigrade_compressed_jacobian_checks.h"
+
 #define DEFAULT_TEST_TOLERANCE 1e-6
 #define CHECK_PER_ELEMENT boost::test_tools::per_element()
 
@@ -3460,3 +3462,107 @@ BOOST_AUTO_TEST_CASE(test_computeBalanceOfVolumeFraction_multiphase_hydra_fea, *
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfVolumeFractionCompressed,
+                     *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the compressed Jacobian of the balance of volume fraction is consistent with the dense Jacobians
+     */
+
+    namespace sparsity       = tardigradeBalanceEquations::jacobianSparsity;
+    namespace volumeFraction = tardigradeBalanceEquations::balanceOfVolumeFraction;
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 23;
+    constexpr unsigned int phase                     = 1;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, dim>                                          velocity, volume_fraction_gradient;
+    std::array<floatType, material_response_size>                       material_response;
+    std::array<floatType, material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                dof_gradient;
+    std::array<floatType, dim>                                          interp_gradient;
+
+    fill(velocity, 0.5);
+    fill(volume_fraction_gradient, 0.6);
+    fill(material_response, 0.8);
+    fill(dof_gradient, 1.0);
+    fill(interp_gradient, 1.2);
+
+    const floatType density = 1.1, volume_fraction = 0.3, volume_fraction_dot = 0.2, rest_density = 2.4;
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dUDotdU = 2.1, dVolumeFractionDotdVolumeFraction = 1.4;
+
+    auto check = [&](auto pattern_tag) {
+        using material_response_pattern = decltype(pattern_tag);
+        using pattern                   = volumeFraction::BalanceOfVolumeFractionSparsity<material_response_pattern>;
+
+        // Zero the material response Jacobian outside of the pattern
+        fill(material_response_jacobian, 0.9);
+
+        compressedJacobianChecks::maskMaterialResponseJacobian<material_response_pattern, dim, nphases,
+                                                               num_additional_dof, material_response_size>(
+            phase, material_response_jacobian);
+
+        // Dense Jacobians
+        floatType                                 result;
+        std::array<floatType, nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+        std::array<floatType, nphases * dim>      dRdU, dRdW;
+        std::array<floatType, num_additional_dof> dRdZ;
+        std::array<floatType, dim>                dRdUMesh;
+
+        volumeFraction::computeBalanceOfVolumeFraction<dim, dim, 10, 22, material_response_num_dof>(
+            density, std::cbegin(velocity), std::cend(velocity), volume_fraction, volume_fraction_dot,
+            std::cbegin(volume_fraction_gradient), std::cend(volume_fraction_gradient), std::cbegin(material_response),
+            std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), rest_density, test_function, interp, std::cbegin(interp_gradient),
+            std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient), dUDotdU,
+            dVolumeFractionDotdVolumeFraction, phase, result, std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU),
+            std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+            std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ),
+            std::begin(dRdUMesh), std::end(dRdUMesh));
+
+        // Compressed Jacobian
+        constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+        floatType                          result_compressed;
+        std::array<floatType, num_columns> jacobian;
+        std::array<floatType, dim>         dRdUMesh_compressed;
+
+        volumeFraction::computeBalanceOfVolumeFractionCompressed<dim, dim, 10, 22, material_response_num_dof,
+                                                                 material_response_pattern>(
+            density, std::cbegin(velocity), std::cend(velocity), volume_fraction, volume_fraction_dot,
+            std::cbegin(volume_fraction_gradient), std::cend(volume_fraction_gradient), std::cbegin(material_response),
+            std::cend(material_response), std::cbegin(material_response_jacobian),
+            std::cend(material_response_jacobian), rest_density, test_function, interp, std::cbegin(interp_gradient),
+            std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient), dUDotdU,
+            dVolumeFractionDotdVolumeFraction, nphases, phase, result_compressed, std::begin(jacobian),
+            std::end(jacobian), std::begin(dRdUMesh_compressed), std::end(dRdUMesh_compressed));
+
+        BOOST_TEST(result_compressed == result);
+        compressedJacobianChecks::checkCompressedJacobian<pattern, dim>(
+            nphases, num_additional_dof, phase, jacobian, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ);
+        BOOST_TEST(dRdUMesh_compressed == dRdUMesh, CHECK_PER_ELEMENT);
+
+        return num_columns;
+    };
+
+    // A material response which depends on every degree of freedom of every phase
+    BOOST_TEST(check(sparsity::DensePattern()) == nphases * 10 + num_additional_dof);
+
+    // A material response which depends only on the temperature of its own phase
+    BOOST_TEST(check(sparsity::SparsityPattern<sparsity::TEMPERATURE, 0>()) == 1 + dim + 1 + 1);
+
+    // A material response which depends on the density of all of the phases and the additional dof
+    BOOST_TEST(check(sparsity::SparsityPattern<0, sparsity::DENSITY | sparsity::ADDITIONAL_DOF>()) ==
+               nphases + dim + 1 + num_additional_dof);
+}
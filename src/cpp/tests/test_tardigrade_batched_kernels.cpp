@@ -0,0 +1,274 @@
+/**
+ * \file test_tardigrade_batched_kernels.cpp
+ *
+ * Tests for tardigrade_batched_kernels
+ */
+
+#include <tardigrade_batched_kernels.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_batched_kernels
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+typedef std::vector<floatType> floatVector;  //!< Define a vector of floats
+
+namespace batched = tardigradeBalanceEquations::batchedKernels;
+
+namespace pool = tardigradeBalanceEquations::threadPool;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int nphases = 2;  //!< The number of phases of each point
+
+constexpr unsigned int num_points = 37;  //!< The number of points of the batch
+
+constexpr unsigned int material_response_size = 23;  //!< The number of values of the material response of a phase
+
+/*!
+ * Fill a vector with values which vary with the index
+ *
+ * \param &v: The vector
+ * \param offset: The offset of the values
+ */
+void fill(floatVector &v, const floatType offset) {
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = 0.5 + 0.25 * std::sin(1.3 * i + offset);
+    }
+}
+
+/*!
+ * The point-major values of a batch of points
+ */
+struct Batch {
+    floatVector density = floatVector(num_points * nphases);  //!< The densities
+
+    floatVector density_dot = floatVector(num_points * nphases);  //!< The density rates
+
+    floatVector density_gradient = floatVector(num_points * nphases * dim);  //!< The density gradients
+
+    floatVector internal_energy = floatVector(num_points * nphases);  //!< The internal energies
+
+    floatVector internal_energy_dot = floatVector(num_points * nphases);  //!< The internal energy rates
+
+    floatVector internal_energy_gradient = floatVector(num_points * nphases * dim);  //!< The energy gradients
+
+    floatVector velocity = floatVector(num_points * nphases * dim);  //!< The velocities
+
+    floatVector velocity_dot = floatVector(num_points * nphases * dim);  //!< The velocity rates
+
+    floatVector velocity_gradient = floatVector(num_points * nphases * dim * dim);  //!< The velocity gradients
+
+    floatVector material_response = floatVector(num_points * nphases * material_response_size);  //!< The responses
+
+    floatVector volume_fraction = floatVector(num_points * nphases);  //!< The volume fractions
+
+    floatVector test_function = floatVector(num_points);  //!< The test functions
+
+    floatVector test_function_gradient = floatVector(num_points * dim);  //!< The test function gradients
+
+    Batch() {
+        floatType offset = 0;
+        for (auto v : {&density, &density_dot, &density_gradient, &internal_energy, &internal_energy_dot,
+                       &internal_energy_gradient, &velocity, &velocity_dot, &velocity_gradient, &material_response,
+                       &volume_fraction, &test_function, &test_function_gradient}) {
+            fill(*v, offset);
+            offset += 0.7;
+        }
+    }
+};
+
+/*!
+ * Get the start of the values of a point
+ *
+ * \param &v: The point-major values
+ * \param size: The number of values of each point
+ * \param point: The point
+ */
+const floatType *at(const floatVector &v, const unsigned int size, const unsigned int point) {
+    return v.data() + size * point;
+}
+
+BOOST_AUTO_TEST_CASE(test_forEachPoint, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that every point of a batch is visited exactly once with and without a thread pool
+     */
+
+    pool::ThreadPool thread_pool(3);
+
+    for (pool::ThreadPool *p : {(pool::ThreadPool *)nullptr, &thread_pool}) {
+        std::vector<unsigned int> visits(1000, 0);
+
+        batched::forEachPoint(visits.size(), p, 7, [&](const batched::size_type point) { ++visits[point]; });
+
+        BOOST_TEST(visits == std::vector<unsigned int>(1000, 1), CHECK_PER_ELEMENT);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_forEachValidatedPoint, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that every point of a batch is visited exactly once and that only the first point is not trusted
+     */
+
+    pool::ThreadPool thread_pool(3);
+
+    for (pool::ThreadPool *p : {(pool::ThreadPool *)nullptr, &thread_pool}) {
+        std::vector<unsigned int> visits(1000, 0);
+
+        std::vector<unsigned int> trusted(1000, 0);
+
+        batched::forEachValidatedPoint(visits.size(), p, 7, [&](const batched::size_type point) {
+            ++visits[point];
+
+            trusted[point] = tardigradeBalanceEquations::errorPolicy::isTrusted();
+        });
+
+        std::vector<unsigned int> answer(1000, 1);
+
+        answer[0] = 0;
+
+        BOOST_TEST(visits == std::vector<unsigned int>(1000, 1), CHECK_PER_ELEMENT);
+
+        BOOST_TEST(trusted == answer, CHECK_PER_ELEMENT);
+
+        BOOST_TEST(!tardigradeBalanceEquations::errorPolicy::isTrusted());
+    }
+
+    BOOST_CHECK_NO_THROW(batched::forEachValidatedPoint(
+        0, nullptr, 7, [](const batched::size_type) { throw std::runtime_error("visited"); }));
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfMass, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the batched residuals of the balance of mass against the point kernel
+     */
+
+    const Batch b;
+
+    floatVector answer(num_points * nphases);
+
+    for (unsigned int point = 0; point < num_points; ++point) {
+        tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, 10>(
+            at(b.density, nphases, point), at(b.density, nphases, point + 1), at(b.density_dot, nphases, point),
+            at(b.density_dot, nphases, point + 1), at(b.density_gradient, nphases * dim, point),
+            at(b.density_gradient, nphases * dim, point + 1), at(b.velocity, nphases * dim, point),
+            at(b.velocity, nphases * dim, point + 1), at(b.velocity_gradient, nphases * dim * dim, point),
+            at(b.velocity_gradient, nphases * dim * dim, point + 1),
+            at(b.material_response, nphases * material_response_size, point),
+            at(b.material_response, nphases * material_response_size, point + 1), b.test_function[point],
+            answer.data() + nphases * point, answer.data() + nphases * (point + 1));
+    }
+
+    pool::ThreadPool thread_pool(3);
+
+    for (pool::ThreadPool *p : {(pool::ThreadPool *)nullptr, &thread_pool}) {
+        floatVector result(num_points * nphases);
+
+        batched::computeBalanceOfMass<dim, 10>(num_points, nphases, material_response_size, b.density.data(),
+                                               b.density_dot.data(), b.density_gradient.data(), b.velocity.data(),
+                                               b.velocity_gradient.data(), b.material_response.data(),
+                                               b.test_function.data(), result.data(), p, 4);
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+    }
+
+    floatVector result(num_points * nphases);
+
+    BOOST_CHECK_THROW((batched::computeBalanceOfMass<dim, 10>(
+                          num_points, 0, material_response_size, b.density.data(), b.density_dot.data(),
+                          b.density_gradient.data(), b.velocity.data(), b.velocity_gradient.data(),
+                          b.material_response.data(), b.test_function.data(), result.data())),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentum, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the batched residuals of the balance of linear momentum against the point kernel
+     */
+
+    const Batch b;
+
+    floatVector answer(num_points * nphases * dim);
+
+    for (unsigned int point = 0; point < num_points; ++point) {
+        tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim, dim, 11, 0, 14>(
+            at(b.density, nphases, point), at(b.density, nphases, point + 1), at(b.density_dot, nphases, point),
+            at(b.density_dot, nphases, point + 1), at(b.density_gradient, nphases * dim, point),
+            at(b.density_gradient, nphases * dim, point + 1), at(b.velocity, nphases * dim, point),
+            at(b.velocity, nphases * dim, point + 1), at(b.velocity_dot, nphases * dim, point),
+            at(b.velocity_dot, nphases * dim, point + 1), at(b.velocity_gradient, nphases * dim * dim, point),
+            at(b.velocity_gradient, nphases * dim * dim, point + 1),
+            at(b.material_response, nphases * material_response_size, point),
+            at(b.material_response, nphases * material_response_size, point + 1),
+            at(b.volume_fraction, nphases, point), at(b.volume_fraction, nphases, point + 1), b.test_function[point],
+            at(b.test_function_gradient, dim, point), at(b.test_function_gradient, dim, point + 1),
+            answer.data() + nphases * dim * point, answer.data() + nphases * dim * (point + 1));
+    }
+
+    pool::ThreadPool thread_pool(3);
+
+    for (pool::ThreadPool *p : {(pool::ThreadPool *)nullptr, &thread_pool}) {
+        floatVector result(num_points * nphases * dim);
+
+        batched::computeBalanceOfLinearMomentum<dim, dim, 11, 0, 14>(
+            num_points, nphases, material_response_size, b.density.data(), b.density_dot.data(),
+            b.density_gradient.data(), b.velocity.data(), b.velocity_dot.data(), b.velocity_gradient.data(),
+            b.material_response.data(), b.volume_fraction.data(), b.test_function.data(),
+            b.test_function_gradient.data(), result.data(), p, 4);
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergy, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the batched residuals of the balance of energy against the point kernel
+     */
+
+    const Batch b;
+
+    floatVector answer(num_points * nphases);
+
+    for (unsigned int point = 0; point < num_points; ++point) {
+        tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 20, 17, 14, 21>(
+            at(b.density, nphases, point), at(b.density, nphases, point + 1), at(b.density_dot, nphases, point),
+            at(b.density_dot, nphases, point + 1), at(b.density_gradient, nphases * dim, point),
+            at(b.density_gradient, nphases * dim, point + 1), at(b.internal_energy, nphases, point),
+            at(b.internal_energy, nphases, point + 1), at(b.internal_energy_dot, nphases, point),
+            at(b.internal_energy_dot, nphases, point + 1), at(b.internal_energy_gradient, nphases * dim, point),
+            at(b.internal_energy_gradient, nphases * dim, point + 1), at(b.velocity, nphases * dim, point),
+            at(b.velocity, nphases * dim, point + 1), at(b.velocity_gradient, nphases * dim * dim, point),
+            at(b.velocity_gradient, nphases * dim * dim, point + 1),
+            at(b.material_response, nphases * material_response_size, point),
+            at(b.material_response, nphases * material_response_size, point + 1),
+            at(b.volume_fraction, nphases, point), at(b.volume_fraction, nphases, point + 1), b.test_function[point],
+            at(b.test_function_gradient, dim, point), at(b.test_function_gradient, dim, point + 1),
+            answer.data() + nphases * point, answer.data() + nphases * (point + 1));
+    }
+
+    pool::ThreadPool thread_pool(3);
+
+    for (pool::ThreadPool *p : {(pool::ThreadPool *)nullptr, &thread_pool}) {
+        floatVector result(num_points * nphases);
+
+        batched::computeBalanceOfEnergy<dim, false, dim, 0, 20, 17, 14, 21>(
+            num_points, nphases, material_response_size, b.density.data(), b.density_dot.data(),
+            b.density_gradient.data(), b.internal_energy.data(), b.internal_energy_dot.data(),
+            b.internal_energy_gradient.data(), b.velocity.data(), b.velocity_gradient.data(),
+            b.material_response.data(), b.volume_fraction.data(), b.test_function.data(),
+            b.test_function_gradient.data(), result.data(), p, 4);
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+    }
+}
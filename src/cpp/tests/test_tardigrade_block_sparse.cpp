@@ -0,0 +1,197 @@
+/**
+ * \file test_tardigrade_block_sparse.cpp
+ *
+ * Tests for tardigrade_block_sparse
+ */
+
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_block_sparse.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_block_sparse
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace block = tardigradeBalanceEquations::blockSparse;
+
+BOOST_AUTO_TEST_CASE(test_node_block_size, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the node block size matches the dof numbering
+     */
+
+    BOOST_TEST((block::node_block_size<3, 1, 0>) == 10);
+
+    BOOST_TEST((block::node_block_size<3, 2, 1>) == assembly::DofNumbering(1, 3, 2, 1).getNumNodeDOF());
+
+    BOOST_TEST((block::node_block_size<2, 3, 2>) == assembly::DofNumbering(1, 2, 3, 2).getNumNodeDOF());
+}
+
+BOOST_AUTO_TEST_CASE(test_BSRMatrix, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the storage and product of a BSR matrix with 2x2 blocks
+     *
+     * | 1 2 | 0 0 |
+     * | 3 4 | 0 0 |
+     * | 5 6 | 7 8 |
+     * | 0 1 | 9 2 |
+     */
+
+    std::vector<assembly::size_type> row_offsets = {0, 1, 3};
+
+    std::vector<assembly::size_type> column_indices = {0, 0, 1};
+
+    block::BSRMatrix<floatType, 2> matrix(2, 2, std::cbegin(row_offsets), std::cend(row_offsets),
+                                          std::cbegin(column_indices), std::cend(column_indices));
+
+    BOOST_TEST(matrix.getNumRows() == 4);
+
+    BOOST_TEST(matrix.getNumBlocks() == 3);
+
+    BOOST_TEST(matrix.getNumNonZeros() == 12);
+
+    BOOST_TEST(matrix.findBlock(1, 1) == 2);
+
+    BOOST_CHECK_THROW(matrix.findBlock(0, 1), std::exception);
+
+    matrix.getValues() = {1, 2, 3, 4, 5, 6, 0, 1, 7, 8, 9, 2};
+
+    std::vector<floatType> x = {1, -1, 2, 0.5};
+
+    std::vector<floatType> y(4);
+
+    std::vector<floatType> answer = {-1, -1, 17, 18};
+
+    matrix.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    std::vector<assembly::size_type> unsorted_indices = {0, 1, 0};
+
+    BOOST_CHECK_THROW((block::BSRMatrix<floatType, 2>(2, 2, std::cbegin(row_offsets), std::cend(row_offsets),
+                                                      std::cbegin(unsorted_indices), std::cend(unsorted_indices))),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_assembleResidualAndJacobian, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the BSR assembly stores the same Jacobian as the CSR assembly with less memory
+     */
+
+    constexpr int block_size = block::node_block_size<3, 1, 1>;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<QuadraticHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 1);
+
+    auto kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end, auto jacobian_begin,
+                      auto jacobian_end) {
+        for (auto r = residual_begin; r != residual_end; ++r) {
+            *r += (e + 1.) * (1. + 0.01 * (r - residual_begin));
+        }
+
+        for (auto j = jacobian_begin; j != jacobian_end; ++j) {
+            *j += (e + 1.) * std::cos(0.001 * (j - jacobian_begin));
+        }
+    };
+
+    std::vector<floatType> csr_residual(numbering.getNumDOF()), bsr_residual(numbering.getNumDOF());
+
+    auto csr = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    auto bsr = block::buildBSRMatrix<floatType, block_size>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(csr_residual),
+                                          std::end(csr_residual), csr);
+
+    block::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(bsr_residual),
+                                       std::end(bsr_residual), bsr);
+
+    BOOST_TEST(bsr_residual == csr_residual, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(bsr.getNumNonZeros() == csr.getNumNonZeros());
+
+    std::vector<std::array<assembly::size_type, 2>> entries = {{0, 0}, {3, 17}, {block_size * 5 + 2, 7}};
+
+    for (const auto &entry : entries) {
+        const assembly::size_type index =
+            bsr.findBlock(entry[0] / block_size, entry[1] / block_size) * block_size * block_size +
+            block_size * (entry[0] % block_size) + entry[1] % block_size;
+
+        BOOST_TEST(bsr.getValues()[index] == csr.getValues()[csr.findEntry(entry[0], entry[1])]);
+    }
+
+    std::vector<floatType> x(numbering.getNumDOF());
+
+    for (unsigned int i = 0; i < x.size(); ++i) {
+        x[i] = std::sin(0.37 * i);
+    }
+
+    std::vector<floatType> csr_y(x.size()), bsr_y(x.size());
+
+    csr.multiply(std::cbegin(x), std::cend(x), std::begin(csr_y), std::end(csr_y));
+
+    bsr.multiply(std::cbegin(x), std::cend(x), std::begin(bsr_y), std::end(bsr_y));
+
+    BOOST_TEST(bsr_y == csr_y, CHECK_PER_ELEMENT);
+
+    const std::size_t csr_bytes = csr.getValues().size() * sizeof(floatType) +
+                                  (csr.getColumnIndices().size() + csr.getRowOffsets().size()) *
+                                      sizeof(assembly::size_type);
+
+    BOOST_TEST(bsr.getMemoryBytes() < csr_bytes);
+
+    // The block size must match the dof numbering
+    BOOST_CHECK_THROW((block::buildBSRMatrix<floatType, block_size + 1>(connectivity, numbering)), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_BlockJacobi, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the block-Jacobi preconditioner inverts the diagonal blocks
+     */
+
+    std::vector<assembly::size_type> row_offsets = {0, 2, 3};
+
+    std::vector<assembly::size_type> column_indices = {0, 1, 1};
+
+    block::BSRMatrix<floatType, 2> matrix(2, 2, std::cbegin(row_offsets), std::cend(row_offsets),
+                                          std::cbegin(column_indices), std::cend(column_indices));
+
+    matrix.getValues() = {4, 1, 2, 3, 9, 9, 9, 9, 2, 0, 1, 5};
+
+    block::BlockJacobi<floatType, 2> preconditioner(matrix);
+
+    BOOST_TEST(preconditioner.getNumBlocks() == 2);
+
+    std::vector<floatType> r = {1, 2, 3, 4};
+
+    std::vector<floatType> z(4);
+
+    preconditioner.apply(std::cbegin(r), std::cend(r), std::begin(z), std::end(z));
+
+    std::vector<floatType> answer = {0.1, 0.6, 1.5, 0.5};
+
+    BOOST_TEST(z == answer, CHECK_PER_ELEMENT);
+
+    matrix.getValues() = {1, 2, 2, 4, 9, 9, 9, 9, 2, 0, 1, 5};
+
+    BOOST_CHECK_THROW(preconditioner.compute(matrix), std::exception);
+}
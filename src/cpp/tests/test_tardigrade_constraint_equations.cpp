@@ -20,6 +20,8 @@
 #include <boost/test/included/unit_test.hpp>
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include "tardigrade_compressed_jacobian_checks.h"
+
 #define DEFAULT_TEST_TOLERANCE 1e-6
 #define CHECK_PER_ELEMENT boost::test_tools::per_element()
 
@@ -4057,3 +4059,132 @@ BOOST_AUTO_TEST_CASE(test_computeMixtureMaterialResponse, *boost::unit_test::tol
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_computeInternalEnergyConstraintCompressed,
+                     *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the compressed Jacobians of the internal energy constraints are consistent with the dense Jacobians
+     */
+
+    namespace sparsity    = tardigradeBalanceEquations::jacobianSparsity;
+    namespace constraints = tardigradeBalanceEquations::constraintEquations;
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 2;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 17;
+    constexpr unsigned int phase                     = 1;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, material_response_size>                       material_response;
+    std::array<floatType, material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                dof_gradient;
+    std::array<floatType, dim>                                          interp_gradient;
+
+    fill(material_response, 0.8);
+    fill(dof_gradient, 1.0);
+    fill(interp_gradient, 1.2);
+
+    const floatType internal_energy = 0.6, density = 1.1;
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dUDotdU = 2.1;
+
+    auto check = [&](auto pattern_tag) {
+        using material_response_pattern = decltype(pattern_tag);
+        using pattern         = constraints::InternalEnergyConstraintSparsity<material_response_pattern>;
+        using density_pattern = constraints::DensityInternalEnergyConstraintSparsity<material_response_pattern>;
+
+        // Zero the material response Jacobian outside of the pattern
+        fill(material_response_jacobian, 0.9);
+
+        compressedJacobianChecks::maskMaterialResponseJacobian<material_response_pattern, dim, nphases,
+                                                               num_additional_dof, material_response_size>(
+            phase, material_response_jacobian);
+
+        floatType                                 result, result_compressed;
+        std::array<floatType, nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+        std::array<floatType, nphases * dim>      dRdU, dRdW;
+        std::array<floatType, num_additional_dof> dRdZ;
+        std::array<floatType, dim>                dRdUMesh, dRdUMesh_compressed;
+
+        // The constraint on the internal energy
+        constraints::computeInternalEnergyConstraint<dim, 9, material_response_num_dof>(
+            internal_energy, std::cbegin(material_response), std::cend(material_response),
+            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), test_function, interp,
+            std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient),
+            std::cend(dof_gradient), dUDotdU, phase, result, std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU),
+            std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+            std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ),
+            std::begin(dRdUMesh), std::end(dRdUMesh));
+
+        constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, num_additional_dof);
+
+        std::array<floatType, num_columns> jacobian;
+
+        constraints::computeInternalEnergyConstraintCompressed<dim, 9, material_response_num_dof,
+                                                               material_response_pattern>(
+            internal_energy, std::cbegin(material_response), std::cend(material_response),
+            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), test_function, interp,
+            std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient),
+            std::cend(dof_gradient), dUDotdU, nphases, phase, result_compressed, std::begin(jacobian),
+            std::end(jacobian), std::begin(dRdUMesh_compressed), std::end(dRdUMesh_compressed));
+
+        BOOST_TEST(result_compressed == result);
+        BOOST_TEST(dRdUMesh_compressed == dRdUMesh, CHECK_PER_ELEMENT);
+        compressedJacobianChecks::checkCompressedJacobian<pattern, dim>(
+            nphases, num_additional_dof, phase, jacobian, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ);
+
+        // The constraint on the internal energy scaled by the density
+        constraints::computeInternalEnergyConstraint<dim, 9, material_response_num_dof>(
+            internal_energy, density, std::cbegin(material_response), std::cend(material_response),
+            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), test_function, interp,
+            std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient),
+            std::cend(dof_gradient), dUDotdU, phase, result, std::begin(dRdRho), std::end(dRdRho), std::begin(dRdU),
+            std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+            std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ),
+            std::begin(dRdUMesh), std::end(dRdUMesh));
+
+        constexpr unsigned int num_density_columns =
+            sparsity::getNumColumns<density_pattern>(dim, nphases, num_additional_dof);
+
+        std::array<floatType, num_density_columns> density_jacobian;
+
+        constraints::computeInternalEnergyConstraintCompressed<dim, 9, material_response_num_dof,
+                                                               material_response_pattern>(
+            internal_energy, density, std::cbegin(material_response), std::cend(material_response),
+            std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), test_function, interp,
+            std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient),
+            std::cend(dof_gradient), dUDotdU, nphases, phase, result_compressed, std::begin(density_jacobian),
+            std::end(density_jacobian), std::begin(dRdUMesh_compressed), std::end(dRdUMesh_compressed));
+
+        BOOST_TEST(result_compressed == result);
+        BOOST_TEST(dRdUMesh_compressed == dRdUMesh, CHECK_PER_ELEMENT);
+        compressedJacobianChecks::checkCompressedJacobian<density_pattern, dim>(
+            nphases, num_additional_dof, phase, density_jacobian, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ);
+
+        return std::array<unsigned int, 2>({num_columns, num_density_columns});
+    };
+
+    // A material response which depends on every degree of freedom of every phase
+    std::array<unsigned int, 2> answer = {nphases * 10 + num_additional_dof, nphases * 10 + num_additional_dof};
+
+    BOOST_TEST(check(sparsity::DensePattern()) == answer, CHECK_PER_ELEMENT);
+
+    // A material response which depends only on the temperature of its own phase
+    answer = {2, 3};
+
+    BOOST_TEST(check(sparsity::SparsityPattern<sparsity::TEMPERATURE, 0>()) == answer, CHECK_PER_ELEMENT);
+
+    // A material response which depends on the density of all of the phases and the additional dof
+    answer = {nphases + 1 + num_additional_dof, nphases + 1 + num_additional_dof};
+
+    BOOST_TEST(check(sparsity::SparsityPattern<0, sparsity::DENSITY | sparsity::ADDITIONAL_DOF>()) == answer,
+               CHECK_PER_ELEMENT);
+}
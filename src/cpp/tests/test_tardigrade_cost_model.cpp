@@ -0,0 +1,138 @@
+/**
+ * \file test_tardigrade_cost_model.cpp
+ *
+ * Tests for tardigrade_cost_model
+ */
+
+#include <tardigrade_cost_model.h>
+
+#define BOOST_TEST_MODULE test_tardigrade_cost_model
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+namespace costModel = tardigradeBalanceEquations::costModel;
+
+BOOST_AUTO_TEST_CASE(test_getMaterialPointDOFCount) {
+    /*!
+     * Test the counts of the degrees of freedom and the material response values
+     */
+
+    BOOST_TEST(costModel::getPhaseDOFCount(3) == 10);
+
+    BOOST_TEST(costModel::getMaterialPointDOFCount(2, 3, 11) == 21);
+
+    BOOST_TEST(costModel::getMaterialPointDOFCount(1, 2, 8) == 8);
+
+    BOOST_TEST(costModel::getMaterialResponseSize(3) == 23);
+}
+
+BOOST_AUTO_TEST_CASE(test_residualCosts, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the costs of the residuals against the operations counted for a spatial dimension of three
+     */
+
+    BOOST_TEST(costModel::getBalanceOfMassResidualCost(3).flops == 15.);
+
+    BOOST_TEST(costModel::getBalanceOfLinearMomentumResidualCost(3).flops == 99.);
+
+    BOOST_TEST(costModel::getBalanceOfEnergyResidualCost(3).flops == 92.);
+
+    BOOST_TEST(costModel::getBalanceOfVolumeFractionResidualCost(3).flops == 12.);
+
+    BOOST_TEST(costModel::getInternalEnergyConstraintResidualCost().flops == 2.);
+
+    BOOST_TEST(costModel::getSurfaceGrowthResidualCost(3).flops == 15.);
+
+    const costModel::KernelCost mass = costModel::getBalanceOfMassResidualCost(3);
+
+    BOOST_TEST(mass.chain_rule_flops == 0.);
+
+    BOOST_TEST(mass.bytes_read == 8. * 19);
+
+    BOOST_TEST(mass.bytes_written == 8.);
+
+    BOOST_TEST(mass.getBytes() == 160.);
+
+    BOOST_TEST(mass.getArithmeticIntensity() == 15. / 160);
+
+    BOOST_TEST(costModel::getBalanceOfLinearMomentumResidualCost(3).bytes_written == 24.);
+}
+
+BOOST_AUTO_TEST_CASE(test_jacobianCosts, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the costs of the Jacobians against the operations counted for two phases with a spatial dimension of
+     * three and one additional degree of freedom
+     */
+
+    BOOST_TEST(costModel::getBalanceOfMassJacobianCost(3, 2, 3, 11).flops == 240. + 48 * 21 + 12 * 2);
+
+    BOOST_TEST(costModel::getBalanceOfLinearMomentumJacobianCost(3, 2, 3, 11).flops == 1020. + 1872 * 21 + 468 * 2);
+
+    BOOST_TEST(costModel::getBalanceOfEnergyJacobianCost(3, 2, 3, 11).flops == 520. + 816 * 21 + 204 * 2);
+
+    BOOST_TEST(costModel::getBalanceOfEnergyJacobianCost(3, 2, 3, 11).chain_rule_flops == 816. * 21 + 204 * 2);
+
+    BOOST_TEST(costModel::getBalanceOfVolumeFractionJacobianCost(3, 2, 3, 11).flops == 89. + 96 * 21 + 24 * 2);
+
+    BOOST_TEST(costModel::getInternalEnergyConstraintJacobianCost(2, 3, 11).flops == 9. + 48 * 21 + 12 * 2);
+
+    BOOST_TEST(costModel::getSurfaceGrowthJacobianCost(3).flops == 84.);
+
+    // One phase with a spatial dimension of two
+    BOOST_TEST(costModel::getBalanceOfLinearMomentumJacobianCost(2, 1, 2, 8).flops == 352. + 350 * 8 + 84);
+
+    // The residual, the interpolation function and its gradient, the rate derivative scalars, the density row of the
+    // material response Jacobian, and the gradients of the degrees of freedom are read
+    const costModel::KernelCost mass = costModel::getBalanceOfMassJacobianCost(3, 1, 3, 10);
+
+    BOOST_TEST(mass.bytes_read == 8. * (19 + 4 + 2 + 4 * 10 + 3 * 10));
+
+    BOOST_TEST(mass.bytes_written == 8. * (10 + 3 + 1));
+
+    BOOST_TEST(costModel::getMixtureMaterialResponseCost(3, 2, 21).flops == 2. * (64 + 172 * 21 + 20 * 2));
+}
+
+BOOST_AUTO_TEST_CASE(test_elementCosts, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the costs of the element kernels
+     */
+
+    BOOST_TEST(costModel::getInterpolationCost(8, 3).flops == 48.);
+
+    BOOST_TEST(costModel::getInterpolationCost(8, 3).bytes_read == 8. * 32);
+
+    BOOST_TEST(costModel::getQuantityGradientCost(8, 3, 3).flops == 144.);
+
+    BOOST_TEST(costModel::getShapeFunctionGradientCost(8, 3).flops == 4. * 8 * 9 + 2 * 27);
+
+    BOOST_TEST(costModel::getJacobianOfTransformationCost(27, 3).flops == 2. * 27 * 9 + 27);
+
+    BOOST_TEST(costModel::getShapeFunctionCost(8, 3).bytes_written == 64.);
+}
+
+BOOST_AUTO_TEST_CASE(test_KernelCost, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the accumulation and scaling of the costs
+     */
+
+    costModel::KernelCost cost = costModel::getBalanceOfMassJacobianCost(3, 1, 3, 10) * 4;
+
+    const costModel::KernelCost single = costModel::getBalanceOfMassJacobianCost(3, 1, 3, 10);
+
+    BOOST_TEST(cost.flops == 4 * single.flops);
+
+    BOOST_TEST(cost.chain_rule_flops == 4 * single.chain_rule_flops);
+
+    BOOST_TEST(cost.getArithmeticIntensity() == single.getArithmeticIntensity());
+
+    cost += single;
+
+    BOOST_TEST(cost.getBytes() == 5 * single.getBytes());
+
+    BOOST_TEST(costModel::KernelCost().getArithmeticIntensity() == 0.);
+}
@@ -0,0 +1,251 @@
+/**
+ * \file test_tardigrade_element_coloring.cpp
+ *
+ * Tests for tardigrade_element_coloring
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_element_coloring.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_element_coloring
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace coloring = tardigradeBalanceEquations::elementColoring;
+
+BOOST_AUTO_TEST_CASE(test_ElementColoring, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the grouping of the elements by color
+     */
+
+    std::vector<assembly::size_type> colors = {1, 0, 1, 2, 0};
+
+    coloring::ElementColoring element_coloring(std::cbegin(colors), std::cend(colors));
+
+    BOOST_TEST(element_coloring.getNumColors() == 3);
+
+    BOOST_TEST(element_coloring.getNumElements() == 5);
+
+    BOOST_TEST(element_coloring.getColor(3) == 2);
+
+    std::vector<std::vector<assembly::size_type>> answers = {{1, 4}, {0, 2}, {3}};
+
+    for (unsigned int color = 0; color < 3; ++color) {
+        std::vector<assembly::size_type> result(element_coloring.getColorElementsBegin(color),
+                                                element_coloring.getColorElementsEnd(color));
+
+        BOOST_TEST(element_coloring.getColorSize(color) == answers[color].size());
+
+        BOOST_TEST(result == answers[color], CHECK_PER_ELEMENT);
+    }
+
+    coloring::ElementColoring empty;
+
+    BOOST_TEST(empty.getNumColors() == 0);
+
+    std::vector<assembly::size_type> skipped_colors = {0, 2};
+
+    BOOST_CHECK_THROW(coloring::ElementColoring(std::cbegin(skipped_colors), std::cend(skipped_colors)),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_getElementAdjacency, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the elements which share a node on a row of three elements
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(3, 1, 1, 3., 1., 1., coordinates);
+
+    std::vector<assembly::size_type> adjacency_offsets, adjacency;
+
+    coloring::getElementAdjacency(connectivity, adjacency_offsets, adjacency);
+
+    std::vector<assembly::size_type> answer_offsets = {0, 1, 3, 4};
+
+    std::vector<assembly::size_type> answer = {1, 0, 2, 1};
+
+    BOOST_TEST(adjacency_offsets == answer_offsets, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(adjacency == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_colorElements, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the greedy and balanced colorings of linear and quadratic hex blocks are valid
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity row = assembly::generateHexBlock<LinearHex>(3, 1, 1, 3., 1., 1., coordinates);
+
+    coloring::ElementColoring row_coloring = coloring::colorElements(row);
+
+    BOOST_TEST(row_coloring.getNumColors() == 2);
+
+    BOOST_TEST(row_coloring.getColor(0) == 0);
+
+    BOOST_TEST(row_coloring.getColor(1) == 1);
+
+    BOOST_TEST(row_coloring.getColor(2) == 0);
+
+    std::vector<assembly::MeshConnectivity> meshes = {
+        assembly::generateHexBlock<LinearHex>(5, 4, 3, 1., 1., 1., coordinates),
+        assembly::generateHexBlock<QuadraticHex>(3, 3, 2, 1., 1., 1., coordinates)};
+
+    for (const auto &mesh : meshes) {
+        coloring::ElementColoring greedy = coloring::colorElements(mesh, coloring::GREEDY);
+
+        coloring::ElementColoring balanced = coloring::colorElements(mesh, coloring::BALANCED);
+
+        BOOST_TEST(coloring::isValidColoring(mesh, greedy));
+
+        BOOST_TEST(coloring::isValidColoring(mesh, balanced));
+
+        // A structured hex mesh needs eight colors
+        BOOST_TEST(greedy.getNumColors() == 8);
+
+        BOOST_TEST(balanced.getNumColors() == greedy.getNumColors());
+
+        assembly::size_type greedy_max = 0, balanced_max = 0;
+
+        for (assembly::size_type color = 0; color < greedy.getNumColors(); ++color) {
+            greedy_max   = std::max(greedy_max, greedy.getColorSize(color));
+            balanced_max = std::max(balanced_max, balanced.getColorSize(color));
+        }
+
+        BOOST_TEST(balanced_max <= greedy_max);
+    }
+
+    // Greedy puts all of the isolated elements into the first color and balancing moves one of them to the second
+    std::vector<assembly::size_type> segments = {0, 1, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    assembly::MeshConnectivity segment_mesh(9, 2, std::cbegin(segments), std::cend(segments));
+
+    coloring::ElementColoring segment_greedy = coloring::colorElements(segment_mesh, coloring::GREEDY);
+
+    coloring::ElementColoring segment_balanced = coloring::colorElements(segment_mesh, coloring::BALANCED);
+
+    std::vector<assembly::size_type> greedy_answer = {0, 1, 0, 0, 0}, balanced_answer = {0, 1, 1, 0, 0};
+
+    for (unsigned int e = 0; e < 5; ++e) {
+        BOOST_TEST(segment_greedy.getColor(e) == greedy_answer[e]);
+
+        BOOST_TEST(segment_balanced.getColor(e) == balanced_answer[e]);
+    }
+
+    BOOST_TEST(coloring::isValidColoring(segment_mesh, segment_balanced));
+
+    // Giving two neighboring elements the same color is invalid
+    std::vector<assembly::size_type> colors = {0, 0, 1};
+
+    BOOST_TEST(!coloring::isValidColoring(row, coloring::ElementColoring(std::cbegin(colors), std::cend(colors))));
+}
+
+BOOST_AUTO_TEST_CASE(test_assembleResidualAndJacobian, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the colored assembly matches the serial assembly for any number of threads
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<QuadraticHex>(3, 2, 2, 1., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 1);
+
+    coloring::ElementColoring element_coloring = coloring::colorElements(connectivity, coloring::BALANCED);
+
+    auto kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end, auto jacobian_begin,
+                      auto jacobian_end) {
+        for (auto r = residual_begin; r != residual_end; ++r) {
+            *r += (e + 1.) * (1. + 0.01 * (r - residual_begin));
+        }
+
+        for (auto j = jacobian_begin; j != jacobian_end; ++j) {
+            *j += (e + 1.) + 0.001 * (j - jacobian_begin);
+        }
+    };
+
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        for (auto r = residual_begin; r != residual_end; ++r) {
+            *r += (e + 1.) * (1. + 0.01 * (r - residual_begin));
+        }
+    };
+
+    std::vector<floatType> answer_residual(numbering.getNumDOF());
+
+    auto answer_jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(answer_residual),
+                                          std::end(answer_residual), answer_jacobian);
+
+    // The work-stealing pool gives the same result for any number of threads and grain size
+    for (const unsigned int num_threads : {1u, 3u, 8u, 64u}) {
+        tardigradeBalanceEquations::threadPool::ThreadPool pool(num_threads);
+
+        std::vector<floatType> residual(numbering.getNumDOF(), 1.);
+
+        std::vector<floatType> residual_only(numbering.getNumDOF(), 1.);
+
+        auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+        coloring::assembleResidualAndJacobian(connectivity, numbering, element_coloring, kernel,
+                                              std::begin(residual), std::end(residual), jacobian, pool);
+
+        coloring::assembleResidual(connectivity, numbering, element_coloring, residual_kernel,
+                                   std::begin(residual_only), std::end(residual_only), pool, 2);
+
+        BOOST_TEST(residual == answer_residual, CHECK_PER_ELEMENT);
+
+        BOOST_TEST(residual_only == answer_residual, CHECK_PER_ELEMENT);
+
+        BOOST_TEST(jacobian.getValues() == answer_jacobian.getValues(), CHECK_PER_ELEMENT);
+    }
+
+    // Errors in the kernel are re-thrown on the calling thread
+    auto throwing_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        if (e == 5) {
+            throw std::runtime_error("element failure");
+        }
+    };
+
+    std::vector<floatType> residual(numbering.getNumDOF());
+
+    tardigradeBalanceEquations::threadPool::ThreadPool pool(4);
+
+    BOOST_CHECK_THROW(coloring::assembleResidual(connectivity, numbering, element_coloring, throwing_kernel,
+                                                 std::begin(residual), std::end(residual), pool),
+                      std::exception);
+
+    // The coloring must belong to the mesh
+    coloring::ElementColoring other_coloring = coloring::colorElements(
+        assembly::generateHexBlock<QuadraticHex>(1, 1, 1, 1., 1., 1., coordinates));
+
+    BOOST_CHECK_THROW(coloring::assembleResidual(connectivity, numbering, other_coloring, residual_kernel,
+                                                 std::begin(residual), std::end(residual), pool),
+                      std::exception);
+}
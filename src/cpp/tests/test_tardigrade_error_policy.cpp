@@ -0,0 +1,140 @@
+/**
+ * \file test_tardigrade_error_policy.cpp
+ *
+ * Tests for tardigrade_error_policy
+ */
+
+#include <tardigrade_error_policy.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#define BOOST_TEST_MODULE test_tardigrade_error_policy
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+namespace policy = tardigradeBalanceEquations::errorPolicy;
+
+/*!
+ * A kernel whose sizes are checked by the checks of the kernels
+ *
+ * \param size: The size of the input
+ * \param expected: The expected size of the input
+ */
+void checkedKernel(const unsigned int size, const unsigned int expected) {
+    TARDIGRADE_BALANCE_EQS_EVAL(const unsigned int difference = expected - size;)
+
+    TARDIGRADE_BALANCE_EQS_CHECK(difference == 0, "The size ", size, " must be ", expected)
+}
+
+/*!
+ * An entry point whose sizes are checked by the checks of the entry points
+ *
+ * \param size: The size of the input
+ */
+void checkedEntry(const unsigned int size) {
+    TARDIGRADE_BALANCE_EQS_ENTRY_CHECK(size > 0, "The size must be positive")
+}
+
+BOOST_AUTO_TEST_CASE(test_formatMessage, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test formatting the parts of a message
+     */
+
+    BOOST_TEST(policy::formatMessage("The size ", 3, " must be ", 4.5) == "The size 3 must be 4.5");
+
+    BOOST_TEST(policy::formatMessage(std::string("no parts")) == "no parts");
+}
+
+BOOST_AUTO_TEST_CASE(test_throwError, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the error thrown by a failed check
+     */
+
+    std::string message;
+
+    try {
+        policy::throwError("kernel", "size ", 2, " vs. ", 3);
+    } catch (const std::runtime_error &e) {
+        message = e.what();
+    }
+
+    BOOST_TEST(message == "kernel: size 2 vs. 3");
+
+    try {
+        checkedKernel(2, 3);
+    } catch (const std::runtime_error &e) {
+        message = e.what();
+    }
+
+    if (policy::check_level >= policy::CHECK_KERNEL) {
+        BOOST_TEST(message == "checkedKernel: The size 2 must be 3");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_checks, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the checks of the kernels and the entry points at the compiled check level
+     */
+
+    BOOST_CHECK_NO_THROW(checkedKernel(3, 3));
+
+    BOOST_CHECK_NO_THROW(checkedEntry(1));
+
+    if (policy::check_level >= policy::CHECK_KERNEL) {
+        BOOST_CHECK_THROW(checkedKernel(2, 3), std::exception);
+    } else {
+        BOOST_CHECK_NO_THROW(checkedKernel(2, 3));
+    }
+
+    if (policy::check_level >= policy::CHECK_ENTRY) {
+        BOOST_CHECK_THROW(checkedEntry(0), std::exception);
+    } else {
+        BOOST_CHECK_NO_THROW(checkedEntry(0));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_TrustedBatch, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that a trusted batch skips the checks of the kernels but not the checks of the entry points
+     */
+
+    BOOST_TEST(!policy::isTrusted());
+
+    {
+        policy::TrustedBatch outer;
+
+        BOOST_TEST(policy::getTrustedDepth() == 1);
+
+        {
+            policy::TrustedBatch inner;
+
+            BOOST_TEST(policy::getTrustedDepth() == 2);
+        }
+
+        BOOST_TEST(policy::isTrusted());
+
+        BOOST_CHECK_NO_THROW(checkedKernel(2, 3));
+
+        if (policy::check_level >= policy::CHECK_ENTRY) {
+            BOOST_CHECK_THROW(checkedEntry(0), std::exception);
+        }
+    }
+
+    BOOST_TEST(!policy::isTrusted());
+
+    try {
+        policy::TrustedBatch batch;
+
+        throw std::runtime_error("leave the batch");
+    } catch (const std::runtime_error &) {
+    }
+
+    BOOST_TEST(policy::getTrustedDepth() == 0);
+}
@@ -0,0 +1,313 @@
+/**
+ * \file test_tardigrade_explicit_dynamics.cpp
+ *
+ * Tests for tardigrade_explicit_dynamics
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_explicit_dynamics.h>
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#define BOOST_TEST_MODULE test_tardigrade_explicit_dynamics
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+struct cout_redirect {
+    cout_redirect(std::streambuf *new_buffer) : old(std::cout.rdbuf(new_buffer)) {}
+
+    ~cout_redirect() { std::cout.rdbuf(old); }
+
+   private:
+    std::streambuf *old;
+};
+
+struct cerr_redirect {
+    cerr_redirect(std::streambuf *new_buffer) : old(std::cerr.rdbuf(new_buffer)) {}
+
+    ~cerr_redirect() { std::cerr.rdbuf(old); }
+
+   private:
+    std::streambuf *old;
+};
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+typedef tardigradeBalanceEquations::finiteElement::floatVector
+    floatVector;  //!< Define the float vector type to be the same as in the finite element utilities
+
+typedef tardigradeBalanceEquations::finiteElement::secondOrderTensor
+    secondOrderTensor;  //!< Define the second order tensor type to be the same as in the finite element utilities
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+BOOST_AUTO_TEST_CASE(test_computeLumpedMass_LinearHex, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the computation of the lumped mass of a linear hex element with two phases
+     */
+
+    std::array<floatType, 24> X = {0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 1, 0, 0, 0, 1, 2, 0, 1, 2, 1, 1, 0, 1, 1};
+
+    std::array<floatType, 16> density;
+
+    for (unsigned int node = 0; node < 8; ++node) {
+        density[2 * node + 0] = 1.5;
+        density[2 * node + 1] = 0.25;
+    }
+
+    std::array<floatType, 16> mass;
+
+    std::array<floatType, 16> answer;
+
+    for (unsigned int node = 0; node < 8; ++node) {
+        answer[2 * node + 0] = 1.5 * 2 / 8;
+        answer[2 * node + 1] = 0.25 * 2 / 8;
+    }
+
+    LinearHex e(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+    tardigradeBalanceEquations::explicitDynamics::computeLumpedMass<2>(e, std::cbegin(density), std::cend(density),
+                                                                       std::begin(mass), std::end(mass));
+
+    BOOST_TEST(mass == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeLumpedMass_QuadraticHex, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the computation of the lumped mass of a quadratic hex element. The corner nodes must have a positive mass
+     * and the total mass must be conserved.
+     */
+
+    std::array<floatType, 60> X = {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0,
+                                   1.0, 0.0, 1.0, 1.0, 1.0, 1.0, 0.0, 1.0, 1.0, 0.5, 0.0, 0.0, 1.0, 0.5, 0.0,
+                                   0.5, 1.0, 0.0, 0.0, 0.5, 0.0, 0.5, 0.0, 1.0, 1.0, 0.5, 1.0, 0.5, 1.0, 1.0,
+                                   0.0, 0.5, 1.0, 0.0, 0.0, 0.5, 1.0, 0.0, 0.5, 1.0, 1.0, 0.5, 0.0, 1.0, 0.5};
+
+    std::array<floatType, 20> density;
+
+    std::fill(std::begin(density), std::end(density), 3.0);
+
+    std::array<floatType, 20> mass;
+
+    QuadraticHex e(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+    tardigradeBalanceEquations::explicitDynamics::computeLumpedMass<1>(e, std::cbegin(density), std::cend(density),
+                                                                       std::begin(mass), std::end(mass));
+
+    BOOST_TEST(std::accumulate(std::cbegin(mass), std::cend(mass), 0.) == 3.0);
+
+    for (unsigned int node = 0; node < 20; ++node) {
+        BOOST_TEST(mass[node] > 0);
+    }
+
+    for (unsigned int node = 1; node < 8; ++node) {
+        BOOST_TEST(mass[node] == mass[0]);
+    }
+
+    for (unsigned int node = 9; node < 20; ++node) {
+        BOOST_TEST(mass[node] == mass[8]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentumForce, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the computation of the element force vector for a uniform stress and body force. The first phase carries
+     * a uniform stress and the second phase carries a body force and an interphasic force.
+     */
+
+    constexpr unsigned int nphases = 2;
+
+    constexpr unsigned int response_size = 15;
+
+    std::array<floatType, 24> X = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1};
+
+    std::array<floatType, 8 * nphases> density;
+
+    std::array<floatType, 8 * nphases> density_dot;
+
+    std::array<floatType, 8 * nphases * 3> velocity;
+
+    std::array<floatType, 8 * nphases> volume_fraction;
+
+    std::array<floatType, 8 * nphases * response_size> material_response;
+
+    std::fill(std::begin(density_dot), std::end(density_dot), 0);
+
+    std::fill(std::begin(velocity), std::end(velocity), 0);
+
+    std::fill(std::begin(material_response), std::end(material_response), 0);
+
+    for (unsigned int node = 0; node < 8; ++node) {
+        density[nphases * node + 0]         = 2.0;
+        density[nphases * node + 1]         = 0.5;
+        volume_fraction[nphases * node + 0] = 0.6;
+        volume_fraction[nphases * node + 1] = 0.4;
+    }
+
+    const secondOrderTensor sigma = {1.0, 0.2, 0.3, 0.2, 2.0, 0.4, 0.3, 0.4, 3.0};
+
+    const floatVector b = {0.1, -0.2, 0.3};
+
+    const floatVector f = {-0.4, 0.5, 0.6};
+
+    for (unsigned int qp = 0; qp < 8; ++qp) {
+        std::copy(std::cbegin(sigma), std::cend(sigma),
+                  std::begin(material_response) + nphases * response_size * qp + 3);
+        std::copy(std::cbegin(b), std::cend(b),
+                  std::begin(material_response) + nphases * response_size * qp + response_size);
+        std::copy(std::cbegin(f), std::cend(f),
+                  std::begin(material_response) + nphases * response_size * qp + response_size + 12);
+    }
+
+    std::array<floatType, 8 * nphases * 3> result;
+
+    // The integral of the global shape function gradients over the unit cube
+    std::array<floatType, 24> dN_integral;
+
+    for (unsigned int node = 0; node < 8; ++node) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            dN_integral[3 * node + i] = 0.25 * (2 * X[3 * node + i] - 1);
+        }
+    }
+
+    std::array<floatType, 8 * nphases * 3> answer;
+
+    for (unsigned int node = 0; node < 8; ++node) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            answer[nphases * 3 * node + i] = 0;
+
+            for (unsigned int j = 0; j < 3; ++j) {
+                answer[nphases * 3 * node + i] -= 0.6 * dN_integral[3 * node + j] * sigma[3 * j + i];
+            }
+
+            answer[nphases * 3 * node + 3 + i] = (0.5 * b[i] + f[i]) / 8;
+        }
+    }
+
+    LinearHex e(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+    tardigradeBalanceEquations::explicitDynamics::computeBalanceOfLinearMomentumForce<3, 3, 0, 3, 12, nphases>(
+        e, std::cbegin(X), std::cend(X), std::cbegin(density), std::cend(density), std::cbegin(density_dot),
+        std::cend(density_dot), std::cbegin(velocity), std::cend(velocity), std::cbegin(material_response),
+        std::cend(material_response), std::cbegin(volume_fraction), std::cend(volume_fraction), std::begin(result),
+        std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeLumpedAcceleration, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the computation of the acceleration from the lumped mass
+     */
+
+    std::array<floatType, 2> mass = {2.0, 4.0};
+
+    std::array<floatType, 6> force = {1, 2, 3, 4, 5, 6};
+
+    std::array<floatType, 6> answer = {0.5, 1.0, 1.5, 1.0, 1.25, 1.5};
+
+    std::array<floatType, 6> result;
+
+    tardigradeBalanceEquations::explicitDynamics::computeLumpedAcceleration(
+        std::cbegin(mass), std::cend(mass), std::cbegin(force), std::cend(force), std::begin(result), std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_centralDifferenceUpdate, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the central-difference update of a free element under a constant body force. The central-difference
+     * scheme integrates a constant acceleration exactly.
+     */
+
+    std::array<floatType, 24> X = {0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1};
+
+    std::array<floatType, 8> density;
+
+    std::array<floatType, 8> density_dot;
+
+    std::array<floatType, 8> volume_fraction;
+
+    std::array<floatType, 24> velocity;
+
+    std::array<floatType, 24> displacement;
+
+    std::array<floatType, 8 * 15> material_response;
+
+    std::array<floatType, 8> mass;
+
+    std::array<floatType, 24> force;
+
+    std::array<floatType, 24> acceleration;
+
+    const floatVector b = {0.1, -0.2, 0.3};
+
+    std::fill(std::begin(density), std::end(density), 2.0);
+
+    std::fill(std::begin(density_dot), std::end(density_dot), 0);
+
+    std::fill(std::begin(volume_fraction), std::end(volume_fraction), 1);
+
+    std::fill(std::begin(velocity), std::end(velocity), 0);
+
+    std::fill(std::begin(displacement), std::end(displacement), 0);
+
+    std::fill(std::begin(material_response), std::end(material_response), 0);
+
+    for (unsigned int qp = 0; qp < 8; ++qp) {
+        std::copy(std::cbegin(b), std::cend(b), std::begin(material_response) + 15 * qp);
+    }
+
+    const floatType dt = 0.1;
+
+    const unsigned int nsteps = 10;
+
+    LinearHex e(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+    tardigradeBalanceEquations::explicitDynamics::computeLumpedMass<1>(e, std::cbegin(density), std::cend(density),
+                                                                       std::begin(mass), std::end(mass));
+
+    for (unsigned int n = 0; n < nsteps; ++n) {
+        tardigradeBalanceEquations::explicitDynamics::computeBalanceOfLinearMomentumForce<3, 3, 0, 3, 12, 1>(
+            e, std::cbegin(X), std::cend(X), std::cbegin(density), std::cend(density), std::cbegin(density_dot),
+            std::cend(density_dot), std::cbegin(velocity), std::cend(velocity), std::cbegin(material_response),
+            std::cend(material_response), std::cbegin(volume_fraction), std::cend(volume_fraction),
+            std::begin(force), std::end(force));
+
+        tardigradeBalanceEquations::explicitDynamics::computeLumpedAcceleration(
+            std::cbegin(mass), std::cend(mass), std::cbegin(force), std::cend(force), std::begin(acceleration),
+            std::end(acceleration));
+
+        tardigradeBalanceEquations::explicitDynamics::centralDifferenceUpdate(
+            (n == 0) ? 0. : dt, dt, std::cbegin(acceleration), std::cend(acceleration), std::begin(velocity),
+            std::end(velocity), std::begin(displacement), std::end(displacement));
+    }
+
+    std::array<floatType, 24> velocity_answer;
+
+    std::array<floatType, 24> displacement_answer;
+
+    for (unsigned int node = 0; node < 8; ++node) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            velocity_answer[3 * node + i]     = (nsteps - 0.5) * dt * b[i];
+            displacement_answer[3 * node + i] = 0.5 * nsteps * nsteps * dt * dt * b[i];
+        }
+    }
+
+    BOOST_TEST(velocity == velocity_answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(displacement == displacement_answer, CHECK_PER_ELEMENT);
+}
@@ -0,0 +1,549 @@
+/**
+ * \file test_tardigrade_explicit_instantiations.cpp
+ *
+ * Tests for tardigrade_explicit_instantiations
+ */
+
+#include <tardigrade_explicit_instantiations.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_explicit_instantiations
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+typedef std::vector<floatType> floatVector;  //!< Define a vector of floats
+
+namespace standard = tardigradeBalanceEquations::explicitInstantiations;
+
+/*!
+ * The iterators of the vectors which are instantiated implicitly in this file
+ */
+struct VectorIterators {
+    //! Get the starting iterator of an incoming vector
+    static floatVector::const_iterator in(const floatVector &v) { return std::cbegin(v); }
+
+    //! Get the starting iterator of an outgoing vector
+    static floatVector::iterator out(floatVector &v) { return std::begin(v); }
+};
+
+/*!
+ * The pointers i.e., the iterators of std::array, which are instantiated in the library
+ */
+struct PointerIterators {
+    //! Get the starting pointer of an incoming vector
+    static const floatType *in(const floatVector &v) { return v.data(); }
+
+    //! Get the starting pointer of an outgoing vector
+    static floatType *out(floatVector &v) { return v.data(); }
+};
+
+/*!
+ * Fill a vector with values which vary with the index
+ *
+ * \param &v: The vector
+ * \param offset: The offset of the values
+ */
+void fill(floatVector &v, const floatType offset) {
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = 0.5 + 0.25 * std::sin(1.3 * i + offset);
+    }
+}
+
+/*!
+ * The inputs and outputs of the point kernels of the standard configuration
+ */
+struct PointState {
+    static constexpr unsigned int nphases = 2;  //!< The number of phases
+
+    static constexpr unsigned int dim = standard::dim;  //!< The spatial dimension
+
+    static constexpr unsigned int num_dof =
+        nphases * standard::material_response_num_dof + standard::num_additional_dof;  //!< The dof of a point
+
+    static constexpr unsigned int rows = nphases * dim;  //!< The largest number of rows of a kernel
+
+    floatVector density, density_dot, internal_energy, internal_energy_dot, volume_fraction, volume_fraction_dot,
+        rest_density;  //!< The phase scalars
+
+    floatVector density_gradient, internal_energy_gradient, volume_fraction_gradient, velocity,
+        velocity_dot;  //!< The phase vectors
+
+    floatVector velocity_gradient;  //!< The velocity gradients
+
+    floatVector material_response, material_response_jacobian;  //!< The material response and its Jacobian
+
+    floatVector dof_gradient;  //!< The spatial gradient of the point dof vector
+
+    floatVector test_function_gradient, interpolation_function_gradient;  //!< The gradients of the functions
+
+    floatVector result, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ, dRdUMesh;  //!< The outputs
+
+    floatVector mixture_response, mixture_jacobian;  //!< The mixture material response and its Jacobian
+
+    floatType test_function = 0.6, interpolation_function = 0.45;  //!< The test and interpolation functions
+
+    floatType dRhoDotdRho = 1.4, dEDotdE = 1.9, dUDotdU = 2.1, dUDDotdU = 3.7, dVFDotdVF = 1.3;  //!< The rates
+
+    PointState()
+        : density(nphases),
+          density_dot(nphases),
+          internal_energy(nphases),
+          internal_energy_dot(nphases),
+          volume_fraction(nphases),
+          volume_fraction_dot(nphases),
+          rest_density(nphases),
+          density_gradient(nphases * dim),
+          internal_energy_gradient(nphases * dim),
+          volume_fraction_gradient(nphases * dim),
+          velocity(nphases * dim),
+          velocity_dot(nphases * dim),
+          velocity_gradient(nphases * dim * dim),
+          material_response(nphases * standard::material_response_size),
+          material_response_jacobian(nphases * standard::material_response_size * num_dof * (1 + dim)),
+          dof_gradient(num_dof * dim),
+          test_function_gradient(dim),
+          interpolation_function_gradient(dim),
+          result(rows),
+          dRdRho(rows * nphases),
+          dRdU(rows * nphases * dim),
+          dRdW(rows * nphases * dim),
+          dRdTheta(rows * nphases),
+          dRdE(rows * nphases),
+          dRdVF(rows * nphases),
+          dRdZ(rows * standard::num_additional_dof),
+          dRdUMesh(rows * dim),
+          mixture_response(standard::material_response_size),
+          mixture_jacobian(standard::material_response_size * num_dof * (1 + dim)) {
+        floatType offset = 0;
+        for (auto v : {&density, &density_dot, &internal_energy, &internal_energy_dot, &volume_fraction,
+                       &volume_fraction_dot, &rest_density, &density_gradient, &internal_energy_gradient,
+                       &volume_fraction_gradient, &velocity, &velocity_dot, &velocity_gradient, &material_response,
+                       &material_response_jacobian, &dof_gradient, &test_function_gradient,
+                       &interpolation_function_gradient}) {
+            fill(*v, offset);
+            offset += 0.7;
+        }
+    }
+
+    //! Append the outputs of a kernel to a vector
+    void append(floatVector &outputs) const {
+        for (auto v : {&result, &dRdRho, &dRdU, &dRdW, &dRdTheta, &dRdE, &dRdVF, &dRdZ, &dRdUMesh}) {
+            outputs.insert(std::end(outputs), std::begin(*v), std::end(*v));
+        }
+    }
+};
+
+/*!
+ * Evaluate the residuals and the Jacobians of the balance equations of all of the phases
+ *
+ * \param &s: The state of the point
+ */
+template <class iterators>
+floatVector evaluateBalanceEquations(PointState &s) {
+    using I = iterators;
+
+    constexpr unsigned int nphases = PointState::nphases;
+
+    constexpr unsigned int rows = PointState::rows;
+
+    floatVector outputs;
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<standard::dim, standard::mass_change_index>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.density_dot), I::in(s.density_dot) + nphases,
+        I::in(s.density_gradient), I::in(s.density_gradient) + s.density_gradient.size(), I::in(s.velocity),
+        I::in(s.velocity) + s.velocity.size(), I::in(s.velocity_gradient),
+        I::in(s.velocity_gradient) + s.velocity_gradient.size(), I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), s.test_function, I::out(s.result),
+        I::out(s.result) + nphases);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<standard::dim, standard::material_response_dim,
+                                                                     standard::mass_change_index,
+                                                                     standard::material_response_num_dof>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.density_dot), I::in(s.density_dot) + nphases,
+        I::in(s.density_gradient), I::in(s.density_gradient) + s.density_gradient.size(), I::in(s.velocity),
+        I::in(s.velocity) + s.velocity.size(), I::in(s.velocity_gradient),
+        I::in(s.velocity_gradient) + s.velocity_gradient.size(), I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), I::in(s.material_response_jacobian),
+        I::in(s.material_response_jacobian) + s.material_response_jacobian.size(), s.test_function,
+        s.interpolation_function, I::in(s.interpolation_function_gradient),
+        I::in(s.interpolation_function_gradient) + PointState::dim, I::in(s.dof_gradient),
+        I::in(s.dof_gradient) + s.dof_gradient.size(), s.dRhoDotdRho, s.dUDotdU, I::out(s.result),
+        I::out(s.result) + nphases, I::out(s.dRdRho), I::out(s.dRdRho) + nphases * nphases, I::out(s.dRdU),
+        I::out(s.dRdU) + nphases * nphases * PointState::dim, I::out(s.dRdW),
+        I::out(s.dRdW) + nphases * nphases * PointState::dim, I::out(s.dRdTheta),
+        I::out(s.dRdTheta) + nphases * nphases, I::out(s.dRdE), I::out(s.dRdE) + nphases * nphases, I::out(s.dRdVF),
+        I::out(s.dRdVF) + nphases * nphases, I::out(s.dRdZ), I::out(s.dRdZ) + nphases * standard::num_additional_dof,
+        I::out(s.dRdUMesh), I::out(s.dRdUMesh) + nphases * PointState::dim);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+        standard::dim, standard::material_response_dim, standard::body_force_index, standard::cauchy_stress_index,
+        standard::interphasic_force_index>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.density_dot), I::in(s.density_dot) + nphases,
+        I::in(s.density_gradient), I::in(s.density_gradient) + s.density_gradient.size(), I::in(s.velocity),
+        I::in(s.velocity) + s.velocity.size(), I::in(s.velocity_dot), I::in(s.velocity_dot) + s.velocity_dot.size(),
+        I::in(s.velocity_gradient), I::in(s.velocity_gradient) + s.velocity_gradient.size(),
+        I::in(s.material_response), I::in(s.material_response) + s.material_response.size(),
+        I::in(s.volume_fraction), I::in(s.volume_fraction) + nphases, s.test_function,
+        I::in(s.test_function_gradient), I::in(s.test_function_gradient) + PointState::dim, I::out(s.result),
+        I::out(s.result) + rows);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<
+        standard::dim, standard::material_response_dim, standard::body_force_index, standard::cauchy_stress_index,
+        standard::interphasic_force_index, standard::material_response_num_dof>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.density_dot), I::in(s.density_dot) + nphases,
+        I::in(s.density_gradient), I::in(s.density_gradient) + s.density_gradient.size(), I::in(s.velocity),
+        I::in(s.velocity) + s.velocity.size(), I::in(s.velocity_dot), I::in(s.velocity_dot) + s.velocity_dot.size(),
+        I::in(s.velocity_gradient), I::in(s.velocity_gradient) + s.velocity_gradient.size(),
+        I::in(s.material_response), I::in(s.material_response) + s.material_response.size(),
+        I::in(s.material_response_jacobian), I::in(s.material_response_jacobian) + s.material_response_jacobian.size(),
+        I::in(s.volume_fraction), I::in(s.volume_fraction) + nphases, s.test_function,
+        I::in(s.test_function_gradient), I::in(s.test_function_gradient) + PointState::dim, s.interpolation_function,
+        I::in(s.interpolation_function_gradient), I::in(s.interpolation_function_gradient) + PointState::dim,
+        I::in(s.dof_gradient), I::in(s.dof_gradient) + s.dof_gradient.size(), s.dRhoDotdRho, s.dUDotdU, s.dUDDotdU,
+        I::out(s.result), I::out(s.result) + rows, I::out(s.dRdRho), I::out(s.dRdRho) + rows * nphases,
+        I::out(s.dRdU), I::out(s.dRdU) + rows * nphases * PointState::dim, I::out(s.dRdW),
+        I::out(s.dRdW) + rows * nphases * PointState::dim, I::out(s.dRdTheta), I::out(s.dRdTheta) + rows * nphases,
+        I::out(s.dRdE), I::out(s.dRdE) + rows * nphases, I::out(s.dRdVF), I::out(s.dRdVF) + rows * nphases,
+        I::out(s.dRdZ), I::out(s.dRdZ) + rows * standard::num_additional_dof, I::out(s.dRdUMesh),
+        I::out(s.dRdUMesh) + rows * PointState::dim);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<
+        standard::dim, standard::is_per_unit_volume, standard::material_response_dim, standard::cauchy_stress_index,
+        standard::internal_heat_generation_index, standard::heat_flux_index, standard::interphasic_force_index,
+        standard::interphasic_heat_transfer_index>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.density_dot), I::in(s.density_dot) + nphases,
+        I::in(s.density_gradient), I::in(s.density_gradient) + s.density_gradient.size(), I::in(s.internal_energy),
+        I::in(s.internal_energy) + nphases, I::in(s.internal_energy_dot), I::in(s.internal_energy_dot) + nphases,
+        I::in(s.internal_energy_gradient), I::in(s.internal_energy_gradient) + s.internal_energy_gradient.size(),
+        I::in(s.velocity), I::in(s.velocity) + s.velocity.size(), I::in(s.velocity_gradient),
+        I::in(s.velocity_gradient) + s.velocity_gradient.size(), I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), I::in(s.volume_fraction),
+        I::in(s.volume_fraction) + nphases, s.test_function, I::in(s.test_function_gradient),
+        I::in(s.test_function_gradient) + PointState::dim, I::out(s.result), I::out(s.result) + nphases);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<
+        standard::dim, standard::is_per_unit_volume, standard::material_response_dim, standard::cauchy_stress_index,
+        standard::internal_heat_generation_index, standard::heat_flux_index, standard::interphasic_force_index,
+        standard::interphasic_heat_transfer_index, standard::material_response_num_dof>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.density_dot), I::in(s.density_dot) + nphases,
+        I::in(s.density_gradient), I::in(s.density_gradient) + s.density_gradient.size(), I::in(s.internal_energy),
+        I::in(s.internal_energy) + nphases, I::in(s.internal_energy_dot), I::in(s.internal_energy_dot) + nphases,
+        I::in(s.internal_energy_gradient), I::in(s.internal_energy_gradient) + s.internal_energy_gradient.size(),
+        I::in(s.velocity), I::in(s.velocity) + s.velocity.size(), I::in(s.velocity_gradient),
+        I::in(s.velocity_gradient) + s.velocity_gradient.size(), I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), I::in(s.material_response_jacobian),
+        I::in(s.material_response_jacobian) + s.material_response_jacobian.size(), I::in(s.volume_fraction),
+        I::in(s.volume_fraction) + nphases, s.test_function, I::in(s.test_function_gradient),
+        I::in(s.test_function_gradient) + PointState::dim, s.interpolation_function,
+        I::in(s.interpolation_function_gradient), I::in(s.interpolation_function_gradient) + PointState::dim,
+        I::in(s.dof_gradient), I::in(s.dof_gradient) + s.dof_gradient.size(), s.dRhoDotdRho, s.dEDotdE, s.dUDotdU,
+        I::out(s.result), I::out(s.result) + nphases, I::out(s.dRdRho), I::out(s.dRdRho) + nphases * nphases,
+        I::out(s.dRdU), I::out(s.dRdU) + nphases * nphases * PointState::dim, I::out(s.dRdW),
+        I::out(s.dRdW) + nphases * nphases * PointState::dim, I::out(s.dRdTheta),
+        I::out(s.dRdTheta) + nphases * nphases, I::out(s.dRdE), I::out(s.dRdE) + nphases * nphases, I::out(s.dRdVF),
+        I::out(s.dRdVF) + nphases * nphases, I::out(s.dRdZ), I::out(s.dRdZ) + nphases * standard::num_additional_dof,
+        I::out(s.dRdUMesh), I::out(s.dRdUMesh) + nphases * PointState::dim);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfVolumeFraction::computeBalanceOfVolumeFraction<
+        standard::dim, standard::mass_change_index, standard::trace_mass_change_velocity_gradient_index>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.velocity), I::in(s.velocity) + s.velocity.size(),
+        I::in(s.volume_fraction), I::in(s.volume_fraction) + nphases, I::in(s.volume_fraction_dot),
+        I::in(s.volume_fraction_dot) + nphases, I::in(s.volume_fraction_gradient),
+        I::in(s.volume_fraction_gradient) + s.volume_fraction_gradient.size(), I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), I::in(s.rest_density),
+        I::in(s.rest_density) + nphases, s.test_function, I::out(s.result), I::out(s.result) + nphases);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::balanceOfVolumeFraction::computeBalanceOfVolumeFraction<
+        standard::dim, standard::material_response_dim, standard::mass_change_index,
+        standard::trace_mass_change_velocity_gradient_index, standard::material_response_num_dof>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.velocity), I::in(s.velocity) + s.velocity.size(),
+        I::in(s.volume_fraction), I::in(s.volume_fraction) + nphases, I::in(s.volume_fraction_dot),
+        I::in(s.volume_fraction_dot) + nphases, I::in(s.volume_fraction_gradient),
+        I::in(s.volume_fraction_gradient) + s.volume_fraction_gradient.size(), I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), I::in(s.material_response_jacobian),
+        I::in(s.material_response_jacobian) + s.material_response_jacobian.size(), I::in(s.rest_density),
+        I::in(s.rest_density) + nphases, s.test_function, s.interpolation_function,
+        I::in(s.interpolation_function_gradient), I::in(s.interpolation_function_gradient) + PointState::dim,
+        I::in(s.dof_gradient), I::in(s.dof_gradient) + s.dof_gradient.size(), s.dUDotdU, s.dVFDotdVF,
+        I::out(s.result), I::out(s.result) + nphases, I::out(s.dRdRho), I::out(s.dRdRho) + nphases * nphases,
+        I::out(s.dRdU), I::out(s.dRdU) + nphases * nphases * PointState::dim, I::out(s.dRdW),
+        I::out(s.dRdW) + nphases * nphases * PointState::dim, I::out(s.dRdTheta),
+        I::out(s.dRdTheta) + nphases * nphases, I::out(s.dRdE), I::out(s.dRdE) + nphases * nphases, I::out(s.dRdVF),
+        I::out(s.dRdVF) + nphases * nphases, I::out(s.dRdZ), I::out(s.dRdZ) + nphases * standard::num_additional_dof,
+        I::out(s.dRdUMesh), I::out(s.dRdUMesh) + nphases * PointState::dim);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::constraintEquations::computeInternalEnergyConstraint<
+        standard::predicted_internal_energy_index>(I::in(s.internal_energy), I::in(s.internal_energy) + nphases,
+                                                   I::in(s.material_response),
+                                                   I::in(s.material_response) + s.material_response.size(),
+                                                   s.test_function, I::out(s.result), I::out(s.result) + nphases);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::constraintEquations::computeInternalEnergyConstraint<
+        standard::material_response_dim, standard::predicted_internal_energy_index,
+        standard::material_response_num_dof>(
+        I::in(s.internal_energy), I::in(s.internal_energy) + nphases, I::in(s.material_response),
+        I::in(s.material_response) + s.material_response.size(), I::in(s.material_response_jacobian),
+        I::in(s.material_response_jacobian) + s.material_response_jacobian.size(), s.test_function,
+        s.interpolation_function, I::in(s.interpolation_function_gradient),
+        I::in(s.interpolation_function_gradient) + PointState::dim, I::in(s.dof_gradient),
+        I::in(s.dof_gradient) + s.dof_gradient.size(), s.dUDotdU, I::out(s.result), I::out(s.result) + nphases,
+        I::out(s.dRdRho), I::out(s.dRdRho) + nphases * nphases, I::out(s.dRdU),
+        I::out(s.dRdU) + nphases * nphases * PointState::dim, I::out(s.dRdW),
+        I::out(s.dRdW) + nphases * nphases * PointState::dim, I::out(s.dRdTheta),
+        I::out(s.dRdTheta) + nphases * nphases, I::out(s.dRdE), I::out(s.dRdE) + nphases * nphases, I::out(s.dRdVF),
+        I::out(s.dRdVF) + nphases * nphases, I::out(s.dRdZ), I::out(s.dRdZ) + nphases * standard::num_additional_dof,
+        I::out(s.dRdUMesh), I::out(s.dRdUMesh) + nphases * PointState::dim);
+
+    s.append(outputs);
+
+    tardigradeBalanceEquations::constraintEquations::computeMixtureMaterialResponse<
+        standard::dim, standard::cauchy_stress_index, standard::predicted_internal_energy_index,
+        standard::mass_change_index, standard::body_force_index, standard::interphasic_force_index,
+        standard::heat_flux_index, standard::internal_heat_generation_index, standard::interphasic_heat_transfer_index,
+        standard::trace_mass_change_velocity_gradient_index>(
+        I::in(s.density), I::in(s.density) + nphases, I::in(s.volume_fraction), I::in(s.volume_fraction) + nphases,
+        I::in(s.material_response), I::in(s.material_response) + s.material_response.size(),
+        I::in(s.material_response_jacobian), I::in(s.material_response_jacobian) + s.material_response_jacobian.size(),
+        I::out(s.mixture_response), I::out(s.mixture_response) + s.mixture_response.size(),
+        I::out(s.mixture_jacobian), I::out(s.mixture_jacobian) + s.mixture_jacobian.size());
+
+    outputs.insert(std::end(outputs), std::begin(s.mixture_response), std::end(s.mixture_response));
+
+    outputs.insert(std::end(outputs), std::begin(s.mixture_jacobian), std::end(s.mixture_jacobian));
+
+    return outputs;
+}
+
+BOOST_AUTO_TEST_CASE(test_balanceEquations, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the instantiations of the library agree with the implicit instantiations for vectors
+     */
+
+    BOOST_TEST(standard::has_pointer_iterators);
+
+    PointState vector_state, pointer_state;
+
+    const floatVector answer = evaluateBalanceEquations<VectorIterators>(vector_state);
+
+    const floatVector result = evaluateBalanceEquations<PointerIterators>(pointer_state);
+
+    BOOST_TEST(answer.size() > 0);
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+}
+
+/*!
+ * Test the phase batched kernels of the library for a number of phases against the implicit instantiations
+ */
+template <unsigned int nphases>
+void checkPhaseBatched() {
+    constexpr unsigned int dim = standard::dim;
+
+    floatVector density(nphases), density_dot(nphases), internal_energy(nphases), internal_energy_dot(nphases),
+        volume_fraction(nphases), internal_heat_generation(nphases), density_gradient(nphases * dim),
+        internal_energy_gradient(nphases * dim), velocity(nphases * dim), net_interphase_force(nphases * dim),
+        heat_flux(nphases * dim), velocity_gradient(nphases * dim * dim), cauchy_stress(nphases * dim * dim),
+        test_function_gradient(dim);
+
+    floatType offset = 0;
+    for (auto v : {&density, &density_dot, &internal_energy, &internal_energy_dot, &volume_fraction,
+                   &internal_heat_generation, &density_gradient, &internal_energy_gradient, &velocity,
+                   &net_interphase_force, &heat_flux, &velocity_gradient, &cauchy_stress, &test_function_gradient}) {
+        fill(*v, offset);
+        offset += 0.9;
+    }
+
+    std::array<floatType, nphases> result, answer;
+
+    std::array<floatType, nphases> dRdRho, dRdRho_answer, dRdRhoDot, dRdRhoDot_answer;
+
+    std::array<floatType, nphases * dim> dRdGradRho, dRdGradRho_answer, dRdV, dRdV_answer;
+
+    std::array<floatType, nphases * dim * dim> dRdGradV, dRdGradV_answer;
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(answer), std::end(answer),
+        std::begin(dRdRho_answer), std::end(dRdRho_answer), std::begin(dRdRhoDot_answer), std::end(dRdRhoDot_answer),
+        std::begin(dRdGradRho_answer), std::end(dRdGradRho_answer), std::begin(dRdV_answer), std::end(dRdV_answer),
+        std::begin(dRdGradV_answer), std::end(dRdGradV_answer));
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+        density.data(), density.data() + nphases, density_dot.data(), density_dot.data() + nphases,
+        density_gradient.data(), density_gradient.data() + nphases * dim, velocity.data(),
+        velocity.data() + nphases * dim, velocity_gradient.data(), velocity_gradient.data() + nphases * dim * dim,
+        std::begin(result), std::end(result), std::begin(dRdRho), std::end(dRdRho), std::begin(dRdRhoDot),
+        std::end(dRdRhoDot), std::begin(dRdGradRho), std::end(dRdGradRho), std::begin(dRdV), std::end(dRdV),
+        std::begin(dRdGradV), std::end(dRdGradV));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdRho == dRdRho_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdRhoDot == dRdRhoDot_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdGradRho == dRdGradRho_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdV == dRdV_answer, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdGradV == dRdGradV_answer, CHECK_PER_ELEMENT);
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::begin(answer), std::end(answer));
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMassPhaseBatched<dim, nphases>(
+        density.data(), density.data() + nphases, density_dot.data(), density_dot.data() + nphases,
+        density_gradient.data(), density_gradient.data() + nphases * dim, velocity.data(),
+        velocity.data() + nphases * dim, velocity_gradient.data(), velocity_gradient.data() + nphases * dim * dim,
+        std::begin(result), std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    const floatType test_function = 0.6;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyPhaseBatched<dim, standard::is_per_unit_volume,
+                                                                                    nphases>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(velocity),
+        std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::cbegin(cauchy_stress),
+        std::cend(cauchy_stress), std::cbegin(volume_fraction), std::cend(volume_fraction),
+        std::cbegin(internal_heat_generation), std::cend(internal_heat_generation), std::cbegin(net_interphase_force),
+        std::cend(net_interphase_force), std::cbegin(heat_flux), std::cend(heat_flux), test_function,
+        std::cbegin(test_function_gradient), std::cend(test_function_gradient), std::begin(answer), std::end(answer));
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergyPhaseBatched<dim, standard::is_per_unit_volume,
+                                                                                    nphases>(
+        density.data(), density.data() + nphases, density_dot.data(), density_dot.data() + nphases,
+        density_gradient.data(), density_gradient.data() + nphases * dim, internal_energy.data(),
+        internal_energy.data() + nphases, internal_energy_dot.data(), internal_energy_dot.data() + nphases,
+        internal_energy_gradient.data(), internal_energy_gradient.data() + nphases * dim, velocity.data(),
+        velocity.data() + nphases * dim, velocity_gradient.data(), velocity_gradient.data() + nphases * dim * dim,
+        cauchy_stress.data(), cauchy_stress.data() + nphases * dim * dim, volume_fraction.data(),
+        volume_fraction.data() + nphases, internal_heat_generation.data(), internal_heat_generation.data() + nphases,
+        net_interphase_force.data(), net_interphase_force.data() + nphases * dim, heat_flux.data(),
+        heat_flux.data() + nphases * dim, test_function, test_function_gradient.data(),
+        test_function_gradient.data() + dim, std::begin(result), std::end(result));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_phaseBatched, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the phase batched kernels for each instantiated number of phases
+     */
+
+    static_assert(standard::max_nphases == 4, "The instantiated numbers of phases have changed");
+
+    checkPhaseBatched<1>();
+
+    checkPhaseBatched<2>();
+
+    checkPhaseBatched<3>();
+
+    checkPhaseBatched<4>();
+}
+
+/*!
+ * Test the interpolation of an element of the library against the implicit instantiations
+ *
+ * \param &node_positions: The positions of the nodes
+ */
+template <class element_type, unsigned int node_count>
+void checkElement(const std::array<floatType, 3 * node_count> &node_positions) {
+    constexpr unsigned int dim = standard::dim;
+
+    element_type e(std::cbegin(node_positions), std::cend(node_positions), std::cbegin(node_positions),
+                   std::cend(node_positions));
+
+    const std::array<floatType, dim> xi = {0.1, -0.2, 0.3};
+
+    floatVector quantity(node_count * 2);
+
+    fill(quantity, 0.4);
+
+    std::array<floatType, 2> value;
+
+    floatVector value_answer(2);
+
+    std::array<floatType, 2 * dim> gradient;
+
+    floatVector gradient_answer(2 * dim);
+
+    e.InterpolateQuantity(std::cbegin(xi), std::cend(xi), std::cbegin(quantity), std::cend(quantity),
+                          std::begin(value_answer), std::end(value_answer));
+
+    e.InterpolateQuantity(std::cbegin(xi), std::cend(xi), static_cast<const floatType *>(quantity.data()),
+                          static_cast<const floatType *>(quantity.data() + quantity.size()), std::begin(value),
+                          std::end(value));
+
+    BOOST_TEST(value == value_answer, CHECK_PER_ELEMENT);
+
+    e.GetGlobalQuantityGradient(std::cbegin(xi), std::cend(xi), std::cbegin(quantity), std::cend(quantity),
+                                std::begin(gradient_answer), std::end(gradient_answer));
+
+    e.GetGlobalQuantityGradient(std::cbegin(xi), std::cend(xi), static_cast<const floatType *>(quantity.data()),
+                                static_cast<const floatType *>(quantity.data() + quantity.size()),
+                                std::begin(gradient), std::end(gradient));
+
+    BOOST_TEST(gradient == gradient_answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_elements, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the interpolation of the linear and quadratic hexahedral elements
+     */
+
+    using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+        tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+    using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+        tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+    std::array<floatType, 24> linear_nodes;
+
+    std::copy(std::begin(LinearHex::local_nodes), std::end(LinearHex::local_nodes), std::begin(linear_nodes));
+
+    std::array<floatType, 60> quadratic_nodes;
+
+    std::copy(std::begin(QuadraticHex::local_nodes), std::end(QuadraticHex::local_nodes),
+              std::begin(quadratic_nodes));
+
+    // Distort the elements so that the gradients are not trivial
+    for (unsigned int i = 0; i < linear_nodes.size(); ++i) {
+        linear_nodes[i] *= 1 + 0.05 * std::sin(1.7 * i);
+    }
+
+    for (unsigned int i = 0; i < quadratic_nodes.size(); ++i) {
+        quadratic_nodes[i] *= 1 + 0.05 * std::sin(1.7 * i);
+    }
+
+    checkElement<LinearHex, 8>(linear_nodes);
+
+    checkElement<QuadraticHex, 20>(quadratic_nodes);
+}
@@ -64,3 +64,51 @@ BOOST_AUTO_TEST_CASE(test_computeGradientSpatialJacobian, *boost::unit_test::tol
 
     BOOST_TEST(answer == result, CHECK_PER_ELEMENT);
 }
+
+BOOST_AUTO_TEST_CASE(test_computeMaterialResponseDirectionalDerivative,
+                     *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the computation of the directional derivative of a material response entry
+     */
+
+    constexpr unsigned int num_dof = 10;
+
+    std::array<floatType, 2 * num_dof * 4> jacobian;
+    std::fill(std::begin(jacobian), std::end(jacobian), 0);
+
+    // Density value, velocity value, and the gradient of the first velocity component
+    jacobian[num_dof * 4 + 0]                = 2;
+    jacobian[num_dof * 4 + 4]                = 3;
+    jacobian[num_dof * 4 + num_dof + 12 + 1] = 5;
+
+    std::array<floatType, num_dof> dof_perturbation;
+    std::fill(std::begin(dof_perturbation), std::end(dof_perturbation), 0);
+    dof_perturbation[0] = 0.5;
+    dof_perturbation[4] = 0.2;
+
+    std::array<floatType, num_dof * 3> dof_perturbation_gradient;
+    std::fill(std::begin(dof_perturbation_gradient), std::end(dof_perturbation_gradient), 0);
+    dof_perturbation_gradient[12 + 1] = 0.7;
+
+    std::array<floatType, num_dof * 3> dof_gradient;
+    std::fill(std::begin(dof_gradient), std::end(dof_gradient), 0);
+    dof_gradient[12 + 0] = 1;
+    dof_gradient[12 + 1] = 2;
+    dof_gradient[12 + 2] = 3;
+
+    secondOrderTensor mesh_displacement_perturbation_gradient = {0., 0.1, 0., 0., 0.2, 0., 0., 0.3, 0.};
+
+    const floatType dUDotdU = 1.5;
+
+    const floatType answer = 2 * 0.5 + 3 * 1.5 * 0.2 + 5 * (1.5 * 0.7 - (1 * 0.1 + 2 * 0.2 + 3 * 0.3));
+
+    floatType result;
+
+    tardigradeBalanceEquations::finiteElement::computeMaterialResponseDirectionalDerivative<3, 10, 4>(
+        1, std::cbegin(jacobian), std::cend(jacobian), std::cbegin(dof_perturbation), std::cend(dof_perturbation),
+        std::cbegin(dof_perturbation_gradient), std::cend(dof_perturbation_gradient), std::cbegin(dof_gradient),
+        std::cend(dof_gradient), std::cbegin(mesh_displacement_perturbation_gradient),
+        std::cend(mesh_displacement_perturbation_gradient), dUDotdU, result);
+
+    BOOST_TEST(answer == result);
+}
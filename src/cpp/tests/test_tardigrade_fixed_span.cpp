@@ -0,0 +1,120 @@
+/**
+ * \file test_tardigrade_fixed_span.cpp
+ *
+ * Tests for tardigrade_fixed_span
+ */
+
+#include <tardigrade_fixed_span.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_fixed_span
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+typedef std::vector<floatType> floatVector;  //!< Define a vector of floats
+
+namespace fixedSpan = tardigradeBalanceEquations::fixedSpan;
+
+BOOST_AUTO_TEST_CASE(test_FixedSpan_extents, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the compile time extents of a view
+     */
+
+    typedef fixedSpan::FixedSpan<floatType, 2, 3, 4> view_type;
+
+    static_assert(view_type::rank == 3, "The rank must be the number of extents");
+
+    static_assert(view_type::static_size == 24, "The size must be the product of the extents");
+
+    static_assert(view_type::size() == 24, "The size must be a constant");
+
+    static_assert(sizeof(view_type) == sizeof(floatType *), "The view must be the size of a pointer");
+
+    typedef decltype(std::declval<view_type>().row(0)) row_type;
+
+    static_assert(std::is_same<row_type, fixedSpan::FixedSpan<floatType, 3, 4>>::value,
+                  "The row of a view must be a view of the trailing extents");
+
+    static_assert(std::is_convertible<view_type, fixedSpan::FixedSpan<const floatType, 2, 3, 4>>::value,
+                  "A view must convert to a read only view");
+
+    static_assert(!std::is_convertible<fixedSpan::FixedSpan<const floatType, 2, 3, 4>, view_type>::value,
+                  "A read only view must not convert to a writeable view");
+
+    static_assert(!std::is_convertible<view_type, fixedSpan::FixedSpan<floatType, 3, 2, 4>>::value,
+                  "A view must not convert to a view of different extents");
+}
+
+BOOST_AUTO_TEST_CASE(test_FixedSpan_indexing, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the elements of a view are in row-major order
+     */
+
+    floatVector values(24);
+
+    for (unsigned int i = 0; i < values.size(); ++i) {
+        values[i] = 0.5 * i;
+    }
+
+    auto view = fixedSpan::makeFixedSpan<2, 3, 4>(values.data());
+
+    BOOST_TEST(view.data() == values.data());
+
+    BOOST_TEST(view.end() - view.begin() == 24);
+
+    for (unsigned int i = 0; i < 2; ++i) {
+        for (unsigned int j = 0; j < 3; ++j) {
+            for (unsigned int k = 0; k < 4; ++k) {
+                BOOST_TEST(view(i, j, k) == values[12 * i + 4 * j + k]);
+
+                BOOST_TEST(view.row(i)(j, k) == values[12 * i + 4 * j + k]);
+
+                BOOST_TEST(view.row(i).row(j)[k] == values[12 * i + 4 * j + k]);
+            }
+        }
+    }
+
+    view(1, 2, 3) = -1;
+
+    BOOST_TEST(values[23] == -1);
+
+    fixedSpan::FixedSpan<const floatType, 2, 3, 4> read_only(view);
+
+    BOOST_TEST(read_only.data() == values.data());
+
+    floatVector rows(std::begin(read_only.row(1)), std::end(read_only.row(1)));
+
+    floatVector answer(std::begin(values) + 12, std::end(values));
+
+    BOOST_TEST(rows == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_FixedSpan_array, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the views of std::array
+     */
+
+    std::array<floatType, 6> values = {1, 2, 3, 4, 5, 6};
+
+    fixedSpan::FixedSpan<floatType, 2, 3> view(values);
+
+    view(0, 1) = 7;
+
+    BOOST_TEST(values[1] == 7);
+
+    const std::array<floatType, 6> &constant = values;
+
+    fixedSpan::FixedSpan<const floatType, 3, 2> read_only(constant);
+
+    BOOST_TEST(read_only(2, 1) == 6);
+
+    BOOST_TEST(read_only.row(1)[0] == 3);
+}
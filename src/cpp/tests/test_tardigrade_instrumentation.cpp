@@ -0,0 +1,189 @@
+/**
+ * \file test_tardigrade_instrumentation.cpp
+ *
+ * Tests for tardigrade_instrumentation
+ */
+
+#ifndef TARDIGRADE_BALANCE_EQUATIONS_ENABLE_INSTRUMENTATION
+#define TARDIGRADE_BALANCE_EQUATIONS_ENABLE_INSTRUMENTATION
+#endif
+
+#include <tardigrade_balance_of_mass.h>
+#include <tardigrade_balance_of_volume_fraction.h>
+#include <tardigrade_instrumentation.h>
+
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_instrumentation
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+namespace instrumentation = tardigradeBalanceEquations::instrumentation;
+
+/*!
+ * Evaluate the residual of the balance of mass with a mass change
+ *
+ * \param num_evaluations: The number of evaluations
+ */
+floatType evaluateBalanceOfMass(const unsigned int num_evaluations) {
+    constexpr unsigned int dim = 3;
+
+    floatType density = 1.2, density_dot = 0.3, test_function = 0.7, result = 0, sum = 0;
+
+    std::array<floatType, dim> density_gradient = {0.1, -0.2, 0.3};
+
+    std::array<floatType, dim> velocity = {0.4, 0.5, -0.6};
+
+    std::array<floatType, dim * dim> velocity_gradient = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9};
+
+    std::array<floatType, 1> material_response = {0.25};
+
+    for (unsigned int i = 0; i < num_evaluations; ++i) {
+        tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, 0>(
+            density, density_dot, std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity),
+            std::cend(velocity), std::cbegin(velocity_gradient), std::cend(velocity_gradient),
+            std::cbegin(material_response), std::cend(material_response), test_function, result);
+
+        sum += result;
+    }
+
+    return sum;
+}
+
+BOOST_AUTO_TEST_CASE(test_getKernelName) {
+    /*!
+     * Test the names of the kernels
+     */
+
+    BOOST_TEST(instrumentation::isEnabled());
+
+    BOOST_TEST(std::string(instrumentation::getKernelName(instrumentation::VOLUME_FRACTION_CUTOFF)) ==
+               "volume fraction cutoff");
+
+    BOOST_CHECK_THROW(instrumentation::getKernelName(instrumentation::NUM_KERNELS), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_counters, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the counts of the calls, ticks, and estimated operations of the kernels
+     */
+
+    instrumentation::resetCounters();
+
+    evaluateBalanceOfMass(10);
+
+    std::array<instrumentation::KernelCounters, instrumentation::NUM_KERNELS> counters =
+        instrumentation::getCounters();
+
+    BOOST_TEST(counters[instrumentation::BALANCE_OF_MASS_RESIDUAL].calls == 10);
+
+    BOOST_TEST(counters[instrumentation::BALANCE_OF_MASS_RESIDUAL].flops == 150);
+
+    BOOST_TEST(counters[instrumentation::BALANCE_OF_MASS_JACOBIAN].calls == 0);
+
+    // The volume fraction cutoff is only counted when the volume fraction is below the tolerance
+    constexpr unsigned int dim = 3;
+
+    std::array<floatType, dim> velocity = {0.4, 0.5, -0.6};
+
+    std::array<floatType, dim> volume_fraction_gradient = {0.1, 0.2, 0.3};
+
+    floatType result;
+
+    for (floatType volume_fraction : {0.5, 1e-12, 0.25, 0.}) {
+        tardigradeBalanceEquations::balanceOfVolumeFraction::computeBalanceOfVolumeFraction<dim>(
+            1.2, std::cbegin(velocity), std::cend(velocity), volume_fraction, 0.1,
+            std::cbegin(volume_fraction_gradient), std::cend(volume_fraction_gradient), 0.3, 2.0, 0.2, 0.7, result,
+            1e-8);
+    }
+
+    counters = instrumentation::getCounters();
+
+    BOOST_TEST(counters[instrumentation::VOLUME_FRACTION_CUTOFF].calls == 2);
+
+    BOOST_TEST(counters[instrumentation::VOLUME_FRACTION_CUTOFF].flops == 0);
+
+    instrumentation::resetCounters();
+
+    counters = instrumentation::getCounters();
+
+    for (auto c : counters) {
+        BOOST_TEST(c.calls == 0);
+
+        BOOST_TEST(c.ticks == 0);
+
+        BOOST_TEST(c.flops == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_thread_counters, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the counters of each thread are merged
+     */
+
+    instrumentation::resetCounters();
+
+    const unsigned int num_threads = 4;
+
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < num_threads; ++i) {
+        threads.emplace_back([i] { evaluateBalanceOfMass(100 * (i + 1)); });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    evaluateBalanceOfMass(1);
+
+    const std::array<instrumentation::KernelCounters, instrumentation::NUM_KERNELS> counters =
+        instrumentation::getCounters();
+
+    BOOST_TEST(counters[instrumentation::BALANCE_OF_MASS_RESIDUAL].calls == 1001);
+
+    BOOST_TEST(counters[instrumentation::BALANCE_OF_MASS_RESIDUAL].flops == 15015);
+
+    BOOST_TEST(counters[instrumentation::BALANCE_OF_MASS_RESIDUAL].ticks > 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_writeReport) {
+    /*!
+     * Test the report of the merged counters
+     */
+
+    instrumentation::resetCounters();
+
+    evaluateBalanceOfMass(3);
+
+    std::stringstream report;
+
+    instrumentation::writeReport(report);
+
+    const std::string result = report.str();
+
+    BOOST_TEST(result.find("balance of mass residual") != std::string::npos);
+
+    BOOST_TEST(result.find("balance of mass jacobian") == std::string::npos);
+
+    BOOST_TEST(result.find("flops/tick") != std::string::npos);
+
+    // The report should not change the formatting of the stream
+    std::stringstream stream;
+
+    instrumentation::writeReport(stream);
+
+    stream << 0.5;
+
+    BOOST_TEST(stream.str().find("0.5") != std::string::npos);
+}
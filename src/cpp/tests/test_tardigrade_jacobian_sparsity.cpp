@@ -0,0 +1,179 @@
+/**
+ * \file test_tardigrade_jacobian_sparsity.cpp
+ *
+ * Tests for tardigrade_jacobian_sparsity
+ */
+
+#include <tardigrade_jacobian_sparsity.h>
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#define BOOST_TEST_MODULE test_tardigrade_jacobian_sparsity
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+namespace sparsity = tardigradeBalanceEquations::jacobianSparsity;
+
+BOOST_AUTO_TEST_CASE(test_SparsityPattern, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the sparsity patterns and their unions
+     */
+
+    using pattern_a = sparsity::SparsityPattern<sparsity::DENSITY | sparsity::VELOCITY, sparsity::TEMPERATURE>;
+
+    using pattern_b = sparsity::SparsityPattern<sparsity::TEMPERATURE, sparsity::VELOCITY | sparsity::ADDITIONAL_DOF>;
+
+    using pattern_ab = sparsity::PatternUnion<pattern_a, pattern_b>;
+
+    static_assert(pattern_a::hasField(sparsity::DENSITY), "The density must be in pattern a");
+
+    static_assert(!pattern_a::hasField(sparsity::DISPLACEMENT), "The displacement must not be in pattern a");
+
+    static_assert(pattern_ab::local_fields == sparsity::DENSITY, "Only the density is phase-local in the union");
+
+    static_assert(pattern_ab::global_fields ==
+                      (sparsity::VELOCITY | sparsity::TEMPERATURE | sparsity::ADDITIONAL_DOF),
+                  "A global field in either pattern must be global in the union");
+
+    static_assert(sparsity::DensePattern::fields == sparsity::all_fields, "The dense pattern must have every field");
+
+    BOOST_TEST(!pattern_ab::isGlobal(sparsity::DENSITY));
+
+    BOOST_TEST(pattern_ab::isGlobal(sparsity::VELOCITY));
+
+    BOOST_TEST(!pattern_ab::hasField(sparsity::INTERNAL_ENERGY));
+}
+
+BOOST_AUTO_TEST_CASE(test_getNumColumns, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the sizes and offsets of the field blocks of the compressed Jacobian
+     */
+
+    constexpr unsigned int dim = 3, nphases = 4, nadd = 2;
+
+    using pattern = sparsity::SparsityPattern<sparsity::DENSITY | sparsity::DISPLACEMENT,
+                                              sparsity::TEMPERATURE | sparsity::ADDITIONAL_DOF>;
+
+    static_assert(sparsity::getNumColumns<pattern>(dim, nphases, nadd) == 1 + dim + nphases + nadd,
+                  "The number of compressed columns must be known at compile time");
+
+    static_assert(sparsity::getNumColumns<sparsity::DensePattern>(dim, nphases, nadd) == 10 * nphases + nadd,
+                  "The dense pattern must have all of the columns");
+
+    BOOST_TEST(sparsity::getFieldWidth(sparsity::VELOCITY, dim, nadd) == dim);
+
+    BOOST_TEST(sparsity::getFieldWidth(sparsity::ADDITIONAL_DOF, dim, nadd) == nadd);
+
+    BOOST_TEST(sparsity::getFieldWidth(sparsity::INTERNAL_ENERGY, dim, nadd) == 1);
+
+    BOOST_TEST(sparsity::getFieldColumns<pattern>(sparsity::VELOCITY, dim, nphases, nadd) == 0);
+
+    BOOST_TEST(sparsity::getFieldColumns<pattern>(sparsity::DISPLACEMENT, dim, nphases, nadd) == dim);
+
+    BOOST_TEST(sparsity::getFieldColumns<pattern>(sparsity::TEMPERATURE, dim, nphases, nadd) == nphases);
+
+    BOOST_TEST(sparsity::getFieldOffset<pattern>(sparsity::DENSITY, dim, nphases, nadd) == 0);
+
+    BOOST_TEST(sparsity::getFieldOffset<pattern>(sparsity::DISPLACEMENT, dim, nphases, nadd) == 1);
+
+    BOOST_TEST(sparsity::getFieldOffset<pattern>(sparsity::TEMPERATURE, dim, nphases, nadd) == 1 + dim);
+
+    BOOST_TEST(sparsity::getFieldOffset<pattern>(sparsity::ADDITIONAL_DOF, dim, nphases, nadd) == 1 + dim + nphases);
+}
+
+BOOST_AUTO_TEST_CASE(test_getDenseColumnIndices, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the map from the compressed to the dense columns
+     */
+
+    constexpr unsigned int dim = 2, nphases = 3, nadd = 1, phase = 1;
+
+    using pattern = sparsity::SparsityPattern<sparsity::VELOCITY, sparsity::VOLUME_FRACTION | sparsity::ADDITIONAL_DOF>;
+
+    constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, nadd);
+
+    std::array<unsigned int, num_columns> columns;
+
+    // Rho: 0-2, U: 3-8, W: 9-14, Theta: 15-17, E: 18-20, VF: 21-23, Z: 24
+    std::array<unsigned int, num_columns> answer = {5, 6, 21, 22, 23, 24};
+
+    sparsity::getDenseColumnIndices<pattern, dim>(nphases, nadd, phase, std::begin(columns), std::end(columns));
+
+    BOOST_TEST(columns == answer, CHECK_PER_ELEMENT);
+
+    std::array<unsigned int, num_columns + 1> bad_columns;
+
+    BOOST_CHECK_THROW((sparsity::getDenseColumnIndices<pattern, dim>(nphases, nadd, phase, std::begin(bad_columns),
+                                                                     std::end(bad_columns))),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_expandCompressedJacobian, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the expansion of a compressed Jacobian into the dense multiphase Jacobians
+     */
+
+    constexpr unsigned int dim = 2, nphases = 3, nadd = 1, phase = 2, num_rows = 2;
+
+    using pattern = sparsity::SparsityPattern<sparsity::VELOCITY, sparsity::VOLUME_FRACTION | sparsity::ADDITIONAL_DOF>;
+
+    constexpr unsigned int num_columns = sparsity::getNumColumns<pattern>(dim, nphases, nadd);
+
+    constexpr unsigned int num_dense_columns = sparsity::getNumColumns<sparsity::DensePattern>(dim, nphases, nadd);
+
+    std::array<floatType, num_rows * num_columns> compressed;
+
+    for (unsigned int i = 0; i < compressed.size(); ++i) {
+        compressed[i] = std::sin(1.3 * i + 0.1);
+    }
+
+    std::array<floatType, num_rows * nphases>       dRdRho, dRdTheta, dRdE, dRdVF;
+    std::array<floatType, num_rows * nphases * dim> dRdU, dRdW;
+    std::array<floatType, num_rows * nadd>          dRdZ;
+
+    std::fill(std::begin(dRdRho), std::end(dRdRho), 1.);
+
+    sparsity::expandCompressedJacobian<pattern, dim>(
+        nphases, nadd, phase, std::cbegin(compressed), std::cend(compressed), std::begin(dRdRho), std::end(dRdRho),
+        std::begin(dRdU), std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+        std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ));
+
+    // Scatter the compressed Jacobian through the dense column map and compare
+    std::array<unsigned int, num_columns> columns;
+
+    sparsity::getDenseColumnIndices<pattern, dim>(nphases, nadd, phase, std::begin(columns), std::end(columns));
+
+    std::array<floatType, num_rows * num_dense_columns> answer;
+    std::fill(std::begin(answer), std::end(answer), 0.);
+
+    for (unsigned int i = 0; i < num_rows; ++i) {
+        for (unsigned int j = 0; j < num_columns; ++j) {
+            answer[num_dense_columns * i + columns[j]] = compressed[num_columns * i + j];
+        }
+    }
+
+    std::array<floatType, num_rows * num_dense_columns> result;
+
+    for (unsigned int i = 0; i < num_rows; ++i) {
+        auto row = std::begin(result) + num_dense_columns * i;
+
+        row = std::copy(std::begin(dRdRho) + nphases * i, std::begin(dRdRho) + nphases * (i + 1), row);
+        row = std::copy(std::begin(dRdU) + nphases * dim * i, std::begin(dRdU) + nphases * dim * (i + 1), row);
+        row = std::copy(std::begin(dRdW) + nphases * dim * i, std::begin(dRdW) + nphases * dim * (i + 1), row);
+        row = std::copy(std::begin(dRdTheta) + nphases * i, std::begin(dRdTheta) + nphases * (i + 1), row);
+        row = std::copy(std::begin(dRdE) + nphases * i, std::begin(dRdE) + nphases * (i + 1), row);
+        row = std::copy(std::begin(dRdVF) + nphases * i, std::begin(dRdVF) + nphases * (i + 1), row);
+        row = std::copy(std::begin(dRdZ) + nadd * i, std::begin(dRdZ) + nadd * (i + 1), row);
+    }
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+}
@@ -0,0 +1,383 @@
+/**
+ * \file test_tardigrade_krylov_solvers.cpp
+ *
+ * Tests for tardigrade_krylov_solvers
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_krylov_solvers.h>
+#include <tardigrade_newton_solver.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_krylov_solvers
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace block = tardigradeBalanceEquations::blockSparse;
+
+namespace krylov = tardigradeBalanceEquations::krylovSolvers;
+
+namespace newton = tardigradeBalanceEquations::newtonSolver;
+
+namespace pool = tardigradeBalanceEquations::threadPool;
+
+constexpr int block_size = block::node_block_size<3, 1, 0>;  //!< The size of the node blocks of the test meshes
+
+/*!
+ * A non-symmetric system assembled over a block of linear hex elements in the CSR and BSR formats
+ */
+struct MeshSystem {
+    std::vector<floatType> coordinates;  //!< The nodal coordinates
+
+    assembly::MeshConnectivity connectivity;  //!< The mesh connectivity
+
+    assembly::DofNumbering numbering;  //!< The numbering of the degrees of freedom
+
+    assembly::CSRMatrix<floatType> csr;  //!< The CSR Jacobian
+
+    block::BSRMatrix<floatType, block_size> bsr;  //!< The BSR Jacobian
+
+    std::vector<floatType> solution;  //!< The solution of the system
+
+    std::vector<floatType> rhs;  //!< The right hand side of the system
+
+    MeshSystem()
+        : connectivity(assembly::generateHexBlock<LinearHex>(3, 2, 2, 3., 2., 2., coordinates)),
+          numbering(connectivity.getNumNodes(), 3, 1, 0) {
+        const assembly::size_type num_element_dof = connectivity.getNodesPerElement() * block_size;
+
+        auto kernel = [&](const assembly::size_type e, auto, auto, auto jacobian_begin, auto) {
+            for (assembly::size_type i = 0; i < num_element_dof; ++i) {
+                for (assembly::size_type j = 0; j < num_element_dof; ++j) {
+                    *(jacobian_begin + num_element_dof * i + j) =
+                        0.05 * std::cos(0.1 * (e + i + 3 * j)) + ((i == j) ? 1.0 + 0.1 * (i % 7) : 0.0);
+                }
+            }
+        };
+
+        std::vector<floatType> residual(numbering.getNumDOF());
+
+        csr = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+        bsr = block::buildBSRMatrix<floatType, block_size>(connectivity, numbering);
+
+        assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(residual),
+                                              std::end(residual), csr);
+
+        block::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(residual), std::end(residual),
+                                           bsr);
+
+        solution.resize(numbering.getNumDOF());
+
+        for (unsigned int i = 0; i < solution.size(); ++i) {
+            solution[i] = std::sin(0.37 * i);
+        }
+
+        rhs.resize(numbering.getNumDOF());
+
+        csr.multiply(std::cbegin(solution), std::cend(solution), std::begin(rhs), std::end(rhs));
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_multiply, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the threaded products and the conversion of a BSR matrix to CSR
+     */
+
+    MeshSystem system;
+
+    pool::ThreadPool thread_pool(3);
+
+    std::vector<floatType> y(system.rhs.size());
+
+    krylov::multiply(system.csr, std::cbegin(system.solution), std::cend(system.solution), std::begin(y),
+                     std::end(y), thread_pool);
+
+    BOOST_TEST(y == system.rhs, CHECK_PER_ELEMENT);
+
+    krylov::MatrixOperator<block::BSRMatrix<floatType, block_size>> bsr_operator(system.bsr, &thread_pool);
+
+    BOOST_TEST(bsr_operator.getNumRows() == system.rhs.size());
+
+    bsr_operator.multiply(std::cbegin(system.solution), std::cend(system.solution), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == system.rhs, CHECK_PER_ELEMENT);
+
+    assembly::CSRMatrix<floatType> converted = krylov::convertToCSR(system.bsr);
+
+    BOOST_TEST(converted.getRowOffsets() == system.csr.getRowOffsets(), CHECK_PER_ELEMENT);
+
+    BOOST_TEST(converted.getColumnIndices() == system.csr.getColumnIndices(), CHECK_PER_ELEMENT);
+
+    BOOST_TEST(converted.getValues() == system.csr.getValues(), CHECK_PER_ELEMENT);
+
+    BOOST_TEST(krylov::dot(system.solution, system.rhs, &thread_pool) ==
+               krylov::dot(system.solution, system.rhs));
+}
+
+BOOST_AUTO_TEST_CASE(test_preconditioners, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the Jacobi, block Jacobi, and ILU(0) preconditioners
+     */
+
+    // [ 4 1 0 ]
+    // [ 2 5 1 ]
+    // [ 0 3 6 ]
+    std::vector<assembly::size_type> row_offsets = {0, 2, 5, 7}, column_indices = {0, 1, 0, 1, 2, 1, 2};
+
+    assembly::CSRMatrix<floatType> A(3, 3, std::cbegin(row_offsets), std::cend(row_offsets),
+                                     std::cbegin(column_indices), std::cend(column_indices));
+
+    A.getValues() = {4, 1, 2, 5, 1, 3, 6};
+
+    std::vector<floatType> r = {6, 15, 24}, z(3);
+
+    krylov::Jacobi<floatType> jacobi;
+
+    jacobi.compute(A);
+
+    jacobi.apply(std::cbegin(r), std::cend(r), std::begin(z), std::end(z));
+
+    std::vector<floatType> answer = {1.5, 3, 4};
+
+    BOOST_TEST(z == answer, CHECK_PER_ELEMENT);
+
+    // The ILU(0) factorization of a tridiagonal matrix has no fill so it is the exact LU factorization
+    krylov::ILU0<floatType> ilu;
+
+    ilu.compute(A);
+
+    BOOST_TEST(ilu.getNumLowerLevels() == 3);
+
+    BOOST_TEST(ilu.getNumUpperLevels() == 3);
+
+    ilu.apply(std::cbegin(r), std::cend(r), std::begin(z), std::end(z));
+
+    answer = {1, 2, 3};
+
+    BOOST_TEST(z == answer, CHECK_PER_ELEMENT);
+
+    A.getValues() = {0, 1, 2, 5, 1, 3, 6};
+
+    BOOST_CHECK_THROW(ilu.compute(A), std::exception);
+
+    BOOST_CHECK_THROW(jacobi.compute(A), std::exception);
+
+    // The CSR and BSR preconditioners agree on the mesh system and the threaded applications match the serial ones
+    MeshSystem system;
+
+    pool::ThreadPool thread_pool(3);
+
+    const std::vector<floatType> &x = system.solution;
+
+    std::vector<floatType> serial(x.size()), threaded(x.size());
+
+    auto check = [&](auto serial_preconditioner, auto threaded_preconditioner, const auto &serial_matrix,
+                     const auto &threaded_matrix) {
+        serial_preconditioner.compute(serial_matrix);
+
+        threaded_preconditioner.compute(threaded_matrix);
+
+        serial_preconditioner.apply(std::cbegin(x), std::cend(x), std::begin(serial), std::end(serial));
+
+        threaded_preconditioner.apply(std::cbegin(x), std::cend(x), std::begin(threaded), std::end(threaded));
+
+        BOOST_TEST(threaded == serial, CHECK_PER_ELEMENT);
+    };
+
+    check(krylov::Jacobi<floatType>(), krylov::Jacobi<floatType>(&thread_pool), system.csr, system.bsr);
+
+    check(krylov::BlockJacobi<floatType>(block_size), krylov::BlockJacobi<floatType>(1, &thread_pool), system.csr,
+          system.bsr);
+
+    check(krylov::ILU0<floatType>(), krylov::ILU0<floatType>(&thread_pool), system.csr, system.bsr);
+
+    // The block Jacobi preconditioner matches the BSR block Jacobi preconditioner
+    block::BlockJacobi<floatType, block_size> bsr_block_jacobi(system.bsr);
+
+    krylov::BlockJacobi<floatType> block_jacobi(block_size);
+
+    block_jacobi.compute(system.csr);
+
+    BOOST_TEST(block_jacobi.getInverseBlocks() == bsr_block_jacobi.getInverseBlocks(), CHECK_PER_ELEMENT);
+
+    krylov::BlockJacobi<floatType> bad_block_jacobi(7);
+
+    BOOST_CHECK_THROW(bad_block_jacobi.compute(system.csr), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_solvers, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test GMRES and BiCGStab with each preconditioner on the CSR and BSR matrices with and without threads
+     */
+
+    MeshSystem system;
+
+    pool::ThreadPool thread_pool(3);
+
+    krylov::KrylovOptions options;
+
+    options.relative_tolerance = 1e-10;
+
+    options.restart = 10;
+
+    auto check = [&](const auto &A, const auto &preconditioner, pool::ThreadPool *p) {
+        for (const auto method : {krylov::GMRES, krylov::BICGSTAB}) {
+            std::vector<floatType> x(system.rhs.size(), 0.);
+
+            krylov::KrylovStatistics statistics =
+                (method == krylov::GMRES)
+                    ? krylov::gmres(A, preconditioner, std::cbegin(system.rhs), std::cend(system.rhs), std::begin(x),
+                                    std::end(x), options, p)
+                    : krylov::bicgstab(A, preconditioner, std::cbegin(system.rhs), std::cend(system.rhs),
+                                       std::begin(x), std::end(x), options, p);
+
+            BOOST_TEST(statistics.converged);
+
+            BOOST_TEST(statistics.iterations > 0);
+
+            BOOST_TEST(statistics.residual_norm <= 1e-10 * std::sqrt(krylov::dot(system.rhs, system.rhs)));
+
+            BOOST_TEST(x == system.solution, CHECK_PER_ELEMENT);
+        }
+    };
+
+    krylov::Jacobi<floatType> jacobi(&thread_pool);
+
+    krylov::BlockJacobi<floatType> block_jacobi(block_size, &thread_pool);
+
+    krylov::ILU0<floatType> ilu(&thread_pool);
+
+    krylov::IdentityPreconditioner identity;
+
+    jacobi.compute(system.csr);
+
+    block_jacobi.compute(system.csr);
+
+    ilu.compute(system.csr);
+
+    krylov::MatrixOperator<assembly::CSRMatrix<floatType>> csr_operator(system.csr, &thread_pool);
+
+    krylov::MatrixOperator<block::BSRMatrix<floatType, block_size>> bsr_operator(system.bsr, &thread_pool);
+
+    check(system.csr, identity, nullptr);
+
+    check(system.csr, jacobi, nullptr);
+
+    check(csr_operator, block_jacobi, &thread_pool);
+
+    check(bsr_operator, ilu, &thread_pool);
+
+    check(system.bsr, ilu, nullptr);
+
+    // The preconditioners reduce the number of iterations
+    std::vector<floatType> x(system.rhs.size(), 0.);
+
+    const unsigned int unpreconditioned =
+        krylov::gmres(system.csr, identity, std::cbegin(system.rhs), std::cend(system.rhs), std::begin(x),
+                      std::end(x), options)
+            .iterations;
+
+    std::fill(std::begin(x), std::end(x), 0.);
+
+    const unsigned int preconditioned =
+        krylov::gmres(system.csr, ilu, std::cbegin(system.rhs), std::cend(system.rhs), std::begin(x), std::end(x),
+                      options)
+            .iterations;
+
+    BOOST_TEST(preconditioned < unpreconditioned);
+
+    // The iteration limit is reported as not converged
+    options.max_iterations = 2;
+
+    std::fill(std::begin(x), std::end(x), 0.);
+
+    BOOST_TEST(!krylov::bicgstab(system.csr, identity, std::cbegin(system.rhs), std::cend(system.rhs),
+                                 std::begin(x), std::end(x), options)
+                    .converged);
+}
+
+BOOST_AUTO_TEST_CASE(test_KrylovSolver, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the Krylov solver as the linear solver of the Newton solver where the system is
+     * \f$ R = A u + 0.1 u^3 - b \f$
+     */
+
+    MeshSystem system;
+
+    pool::ThreadPool thread_pool(2);
+
+    krylov::KrylovOptions options;
+
+    options.relative_tolerance = 1e-12;
+
+    krylov::KrylovSolver<block::BSRMatrix<floatType, block_size>, krylov::ILU0<floatType>> solver(
+        krylov::GMRES, options, krylov::ILU0<floatType>(&thread_pool), &thread_pool);
+
+    auto residual = [&](auto dof_begin, auto dof_end, auto residual_begin, auto residual_end) {
+        system.csr.multiply(dof_begin, dof_end, residual_begin, residual_end);
+
+        for (unsigned int i = 0; i < system.rhs.size(); ++i) {
+            const floatType u = *(dof_begin + i);
+
+            *(residual_begin + i) += 0.1 * u * u * u - system.rhs[i];
+        }
+    };
+
+    block::BSRMatrix<floatType, block_size> jacobian = system.bsr;
+
+    auto residual_and_jacobian = [&](auto dof_begin, auto dof_end, auto residual_begin, auto residual_end,
+                                     block::BSRMatrix<floatType, block_size> &J) {
+        residual(dof_begin, dof_end, residual_begin, residual_end);
+
+        J.getValues() = system.bsr.getValues();
+
+        for (unsigned int i = 0; i < system.rhs.size(); ++i) {
+            const floatType u = *(dof_begin + i);
+
+            J.getValues()[block_size * block_size * J.findBlock(i / block_size, i / block_size) +
+                          (block_size + 1) * (i % block_size)] += 0.3 * u * u;
+        }
+    };
+
+    std::vector<floatType> dof(system.rhs.size(), 0.);
+
+    newton::NewtonOptions newton_options;
+
+    newton_options.absolute_tolerance = 1e-10;
+
+    newton::NewtonStatistics statistics =
+        newton::solve(residual, residual_and_jacobian, jacobian, solver, std::begin(dof), std::end(dof),
+                      newton_options);
+
+    BOOST_TEST(statistics.converged);
+
+    BOOST_TEST(solver.getStatistics().converged);
+
+    std::vector<floatType> r(dof.size());
+
+    residual(std::cbegin(dof), std::cend(dof), std::begin(r), std::end(r));
+
+    BOOST_TEST(r == std::vector<floatType>(r.size(), 0.), CHECK_PER_ELEMENT);
+
+    krylov::KrylovSolver<assembly::CSRMatrix<floatType>, krylov::Jacobi<floatType>> unset_solver;
+
+    BOOST_CHECK_THROW(unset_solver.solve(std::cbegin(r), std::cend(r), std::begin(dof), std::end(dof)),
+                      std::exception);
+}
@@ -0,0 +1,435 @@
+/**
+ * \file test_tardigrade_material_provider.cpp
+ *
+ * Tests for tardigrade_material_provider
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_material_provider.h>
+#include <tardigrade_mesh_assembly.h>
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_material_provider
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+typedef std::vector<floatType> floatVector;  //!< Define a vector of floats
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+namespace provider = tardigradeBalanceEquations::materialProvider;
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+/*!
+ * A material model whose response is linear in the point dof vector and depends on the integration point
+ */
+struct LinearModel {
+    unsigned int point_dof_size;  //!< The size of the point dof vector
+
+    unsigned int response_size;  //!< The size of the material response
+
+    unsigned int calls = 0;  //!< The number of calls of the model
+
+    /*!
+     * Get the coefficient of the response w.r.t. the point dof vector
+     *
+     * \param i: The component of the response
+     * \param j: The component of the point dof vector
+     */
+    floatType coefficient(const unsigned int i, const unsigned int j) const {
+        return 0.1 * std::sin(1.3 * i + 0.7 * j);
+    }
+
+    /*!
+     * Compute the material response
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        ++calls;
+
+        for (unsigned int i = 0; i < response_size; ++i) {
+            *(response_begin + i) = 0.01 * qp;
+
+            for (unsigned int j = 0; j < point_dof_size; ++j) {
+                *(response_begin + i) += coefficient(i, j) * (*(point_dof_begin + j));
+            }
+        }
+    }
+
+    /*!
+     * Compute the material response and its Jacobian
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        (*this)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+
+        for (unsigned int i = 0; i < response_size; ++i) {
+            for (unsigned int j = 0; j < point_dof_size; ++j) {
+                *(jacobian_begin + point_dof_size * i + j) = coefficient(i, j);
+            }
+        }
+    }
+};
+
+/*!
+ * A batched provider of the linear model which loops over the points innermost
+ */
+class LinearProvider : public provider::BatchedMaterialProvider<floatType> {
+   public:
+    /*!
+     * Constructor for the provider
+     *
+     * \param &model: The model the coefficients are taken from
+     * \param points_per_element: The number of integration points of an element
+     */
+    LinearProvider(const LinearModel &model, const unsigned int points_per_element)
+        : _model(model), _points_per_element(points_per_element) {}
+
+    //! Get the size of the point dof vector of a point
+    virtual provider::size_type getPointDofSize() const override { return _model.point_dof_size; }
+
+    //! Get the size of the material response of a point
+    virtual provider::size_type getResponseSize() const override { return _model.response_size; }
+
+    std::vector<provider::size_type> first_points;  //!< The first points of the evaluated batches
+
+   protected:
+    /*!
+     * Compute the material responses of a batch of points
+     *
+     * \param first_point: The index of the first point of the batch
+     * \param &point_dof: The point dof vectors
+     * \param &response: The material responses
+     */
+    virtual void computeResponse(const provider::size_type                    first_point,
+                                 const provider::PointArray<const floatType> &point_dof,
+                                 const provider::PointArray<floatType>       &response) override {
+        first_points.push_back(first_point);
+
+        for (unsigned int i = 0; i < _model.response_size; ++i) {
+            floatType *r = response.component(i);
+
+            for (provider::size_type p = 0; p < point_dof.getNumPoints(); ++p) {
+                r[p] = 0.01 * ((first_point + p) % _points_per_element);
+            }
+
+            for (unsigned int j = 0; j < _model.point_dof_size; ++j) {
+                const floatType  c = _model.coefficient(i, j);
+                const floatType *u = point_dof.component(j);
+
+                for (provider::size_type p = 0; p < point_dof.getNumPoints(); ++p) {
+                    r[p] += c * u[p];
+                }
+            }
+        }
+    }
+
+    /*!
+     * Compute the material responses and their Jacobians of a batch of points
+     *
+     * \param first_point: The index of the first point of the batch
+     * \param &point_dof: The point dof vectors
+     * \param &response: The material responses
+     * \param &jacobian: The material response Jacobians
+     */
+    virtual void computeResponseAndJacobian(const provider::size_type                    first_point,
+                                            const provider::PointArray<const floatType> &point_dof,
+                                            const provider::PointArray<floatType>       &response,
+                                            const provider::PointArray<floatType>       &jacobian) override {
+        computeResponse(first_point, point_dof, response);
+
+        for (unsigned int i = 0; i < _model.response_size; ++i) {
+            for (unsigned int j = 0; j < _model.point_dof_size; ++j) {
+                floatType *d = jacobian.component(_model.point_dof_size * i + j);
+
+                std::fill(d, d + point_dof.getNumPoints(), _model.coefficient(i, j));
+            }
+        }
+    }
+
+    const LinearModel &_model;  //!< The model the coefficients are taken from
+
+    unsigned int _points_per_element;  //!< The number of integration points of an element
+};
+
+BOOST_AUTO_TEST_CASE(test_PointArray, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the layout of a structure of arrays view and of the view of a subset of its points
+     */
+
+    floatVector values(3 * 5);
+
+    for (unsigned int i = 0; i < values.size(); ++i) {
+        values[i] = i;
+    }
+
+    provider::PointArray<floatType> view(values.data(), 3, 5);
+
+    BOOST_TEST(view.getNumComponents() == 3);
+
+    BOOST_TEST(view.getNumPoints() == 5);
+
+    BOOST_TEST(view.getStride() == 5);
+
+    BOOST_TEST(view(2, 1) == 11.);
+
+    BOOST_TEST(view.component(1)[4] == 9.);
+
+    provider::PointArray<const floatType> block = view.block(2, 3);
+
+    BOOST_TEST(block.getNumPoints() == 3);
+
+    BOOST_TEST(block.getStride() == 5);
+
+    BOOST_TEST(block(0, 0) == 2.);
+
+    BOOST_TEST(block(2, 2) == 14.);
+}
+
+BOOST_AUTO_TEST_CASE(test_PointwiseMaterialProvider, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the batched provider of a material model against the batched provider which loops over the points
+     */
+
+    constexpr unsigned int num_points = 13, points_per_element = 4;
+
+    LinearModel model{5, 7};
+
+    provider::PointwiseMaterialProvider<floatType, LinearModel> pointwise(model, model.point_dof_size,
+                                                                          model.response_size, points_per_element);
+
+    LinearProvider batched(model, points_per_element);
+
+    BOOST_TEST(pointwise.getJacobianSize() == 35);
+
+    floatVector point_dof(model.point_dof_size * num_points);
+
+    for (unsigned int i = 0; i < point_dof.size(); ++i) {
+        point_dof[i] = 0.5 + 0.3 * std::sin(1.1 * i);
+    }
+
+    const provider::PointArray<const floatType> u(point_dof.data(), model.point_dof_size, num_points);
+
+    floatVector response(model.response_size * num_points), jacobian(pointwise.getJacobianSize() * num_points);
+
+    floatVector answer_response(response.size()), answer_jacobian(jacobian.size());
+
+    provider::PointArray<floatType> r(response.data(), model.response_size, num_points);
+
+    provider::PointArray<floatType> J(jacobian.data(), pointwise.getJacobianSize(), num_points);
+
+    pointwise.evaluate(6, u, r, J);
+
+    batched.evaluate(6, u, provider::PointArray<floatType>(answer_response.data(), model.response_size, num_points),
+                     provider::PointArray<floatType>(answer_jacobian.data(), batched.getJacobianSize(), num_points));
+
+    BOOST_TEST(response == answer_response, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(jacobian == answer_jacobian, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(model.calls == num_points);
+
+    std::fill(std::begin(response), std::end(response), 0);
+
+    pointwise.evaluate(6, u, r);
+
+    BOOST_TEST(response == answer_response, CHECK_PER_ELEMENT);
+
+    BOOST_CHECK_THROW(pointwise.evaluate(6, u.block(0, num_points - 1), r), std::exception);
+
+    BOOST_CHECK_THROW(pointwise.evaluate(6, provider::PointArray<const floatType>(point_dof.data(), 4, num_points), r),
+                      std::exception);
+
+    BOOST_CHECK_THROW(pointwise.evaluate(6, u, r, r), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_MaterialResponseBlock, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test evaluating a block of elements with one call of a provider and reading back the values of the points
+     */
+
+    constexpr unsigned int max_elements = 3, points_per_element = 2;
+
+    LinearModel model{4, 3};
+
+    LinearProvider batched(model, points_per_element);
+
+    provider::MaterialResponseBlock<floatType> block(max_elements, points_per_element, model.point_dof_size,
+                                                     model.response_size);
+
+    BOOST_TEST(block.getNumPoints() == 6);
+
+    BOOST_TEST(block.getJacobian().getNumComponents() == 0);
+
+    std::array<floatType, 4> point_dof;
+
+    for (unsigned int e = 0; e < 2; ++e) {
+        for (unsigned int qp = 0; qp < points_per_element; ++qp) {
+            for (unsigned int i = 0; i < point_dof.size(); ++i) {
+                point_dof[i] = 0.1 * (i + 1) + e + 0.5 * qp;
+            }
+
+            block.setPointDof(e, qp, std::cbegin(point_dof), std::cend(point_dof));
+        }
+    }
+
+    block.evaluate(batched, 5, 2, true);
+
+    BOOST_TEST(batched.first_points == std::vector<provider::size_type>({10}), CHECK_PER_ELEMENT);
+
+    BOOST_TEST(block.getJacobian().getNumComponents() == block.getJacobianSize());
+
+    std::array<floatType, 3> response, answer_response;
+
+    std::array<floatType, 12> jacobian, answer_jacobian;
+
+    for (unsigned int e = 0; e < 2; ++e) {
+        for (unsigned int qp = 0; qp < points_per_element; ++qp) {
+            for (unsigned int i = 0; i < point_dof.size(); ++i) {
+                point_dof[i] = 0.1 * (i + 1) + e + 0.5 * qp;
+            }
+
+            model(qp, std::cbegin(point_dof), std::cend(point_dof), std::begin(answer_response),
+                  std::end(answer_response), std::begin(answer_jacobian), std::end(answer_jacobian));
+
+            provider::BlockMaterialModel<floatType> block_model(block, e);
+
+            block_model(qp, std::cbegin(point_dof), std::cend(point_dof), std::begin(response), std::end(response),
+                        std::begin(jacobian), std::end(jacobian));
+
+            BOOST_TEST(response == answer_response, CHECK_PER_ELEMENT);
+
+            BOOST_TEST(jacobian == answer_jacobian, CHECK_PER_ELEMENT);
+        }
+    }
+
+    BOOST_CHECK_THROW(block.evaluate(batched, 0, max_elements + 1, false), std::exception);
+
+    BOOST_CHECK_THROW(block.setPointDof(max_elements, 0, std::cbegin(point_dof), std::cend(point_dof)),
+                      std::exception);
+
+    BOOST_CHECK_THROW(block.getResponse(0, 0, std::begin(jacobian), std::end(jacobian)), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_interpolatePointDof, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that integrating the elements of a block with the responses of one batched evaluation of the block
+     * matches integrating the elements with the material model at each integration point
+     */
+
+    static constexpr unsigned int dim = 3, nphases = 1, nadd = 0, node_count = 8, material_response_size = 16;
+
+    static constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + nadd;
+
+    static constexpr unsigned int points_per_element =
+        tardigradeBalanceEquations::finiteElement::LinearHexConfiguration::num_volume_integration_points;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    const unsigned int num_elements = connectivity.getNumElements();
+
+    LinearModel model{num_dof * (1 + dim), nphases * material_response_size};
+
+    provider::PointwiseMaterialProvider<floatType, LinearModel> pointwise(model, model.point_dof_size,
+                                                                          model.response_size, points_per_element);
+
+    provider::MaterialResponseBlock<floatType> block(num_elements, points_per_element, model.point_dof_size,
+                                                     model.response_size);
+
+    std::vector<std::array<floatType, node_count * dim>> x(num_elements);
+
+    std::vector<std::array<floatType, node_count * num_dof>> u(num_elements), u_dot(num_elements),
+        u_ddot(num_elements);
+
+    for (unsigned int e = 0; e < num_elements; ++e) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(x[e]) + dim * a);
+        }
+
+        for (unsigned int i = 0; i < node_count * num_dof; ++i) {
+            u[e][i]      = 0.5 + 0.3 * std::sin(1.7 * i + e);
+            u_dot[e][i]  = 0.1 * std::cos(0.9 * i + e);
+            u_ddot[e][i] = 0.2 * std::sin(0.4 * i + e);
+        }
+
+        LinearHex element(std::cbegin(x[e]), std::cend(x[e]), std::cbegin(x[e]), std::cend(x[e]));
+
+        provider::interpolatePointDof<dim, nphases, nadd>(element, std::cbegin(x[e]), std::cend(x[e]),
+                                                          std::cbegin(u[e]), std::cend(u[e]), std::cbegin(u_dot[e]),
+                                                          std::cend(u_dot[e]), block, e);
+    }
+
+    block.evaluate(pointwise, 0, num_elements, true);
+
+    const unsigned int calls = model.calls;
+
+    BOOST_TEST(calls == num_elements * points_per_element);
+
+    for (unsigned int e = 0; e < num_elements; ++e) {
+        LinearHex element(std::cbegin(x[e]), std::cend(x[e]), std::cbegin(x[e]), std::cend(x[e]));
+
+        std::array<floatType, node_count * num_dof> residual, answer_residual;
+
+        std::array<floatType, node_count * num_dof * node_count * num_dof> jacobian, answer_jacobian;
+
+        std::fill(std::begin(residual), std::end(residual), 0);
+        std::fill(std::begin(answer_residual), std::end(answer_residual), 0);
+        std::fill(std::begin(jacobian), std::end(jacobian), 0);
+        std::fill(std::begin(answer_jacobian), std::end(answer_jacobian), 0);
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, material_response_size, nphases, nadd>(
+            element, std::cbegin(x[e]), std::cend(x[e]), std::cbegin(u[e]), std::cend(u[e]), std::cbegin(u_dot[e]),
+            std::cend(u_dot[e]), std::cbegin(u_ddot[e]), std::cend(u_ddot[e]), 10., 100., model,
+            std::begin(answer_residual), std::end(answer_residual), std::begin(answer_jacobian),
+            std::end(answer_jacobian));
+
+        provider::BlockMaterialModel<floatType> block_model(block, e);
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, material_response_size, nphases, nadd>(
+            element, std::cbegin(x[e]), std::cend(x[e]), std::cbegin(u[e]), std::cend(u[e]), std::cbegin(u_dot[e]),
+            std::cend(u_dot[e]), std::cbegin(u_ddot[e]), std::cend(u_ddot[e]), 10., 100., block_model,
+            std::begin(residual), std::end(residual), std::begin(jacobian), std::end(jacobian));
+
+        BOOST_TEST(residual == answer_residual, CHECK_PER_ELEMENT);
+
+        BOOST_TEST(jacobian == answer_jacobian, CHECK_PER_ELEMENT);
+    }
+
+    BOOST_TEST(model.calls == calls + num_elements * points_per_element);
+}
@@ -0,0 +1,773 @@
+/**
+ * \file test_tardigrade_matrix_free.cpp
+ *
+ * Tests for tardigrade_matrix_free
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_krylov_solvers.h>
+#include <tardigrade_matrix_free.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_matrix_free
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace coloring = tardigradeBalanceEquations::elementColoring;
+
+namespace krylov = tardigradeBalanceEquations::krylovSolvers;
+
+namespace matrix_free = tardigradeBalanceEquations::matrixFree;
+
+namespace pool = tardigradeBalanceEquations::threadPool;
+
+/*!
+ * A non-linear material model for the balance of linear momentum which counts its Jacobian evaluations. Each phase has
+ * a small-strain elastic stress from the gradient of its displacement plus a pressure quadratic in its temperature and
+ * a body force proportional to its density.
+ */
+template <int dim, int nphases, int num_additional_dof>
+struct CountingModel {
+    static constexpr unsigned int material_response_size = 16;  //!< The size of the material response of a phase
+
+    static constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The number of dof
+
+    floatType lambda = 1.2, mu = 0.7, thermal = 0.3, gravity = -0.4;
+
+    std::atomic<unsigned int> jacobian_evaluations{0};  //!< The number of calls for the Jacobian
+
+    /*!
+     * Compute the material response and optionally its Jacobian w.r.t. the point dof vector
+     *
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     * \param compute_jacobian: Flag indicating that the Jacobian should be computed
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void evaluate(const dof_iter &point_dof_begin, response_iter response_begin, response_iter response_end,
+                  jacobian_iter jacobian_begin, jacobian_iter jacobian_end, const bool compute_jacobian) {
+        constexpr unsigned int num_columns = num_dof * (1 + dim);
+
+        std::fill(response_begin, response_end, 0);
+
+        if (compute_jacobian) {
+            std::fill(jacobian_begin, jacobian_end, 0);
+        }
+
+        for (unsigned int p = 0; p < nphases; ++p) {
+            auto response = response_begin + material_response_size * p;
+
+            const unsigned int rho   = p;
+            const unsigned int theta = nphases * (1 + 2 * dim) + p;
+
+            auto grad_w = [&](const unsigned int i, const unsigned int j) {
+                return num_dof + dim * (nphases + dim * p + i) + j;
+            };
+
+            auto d = [&](const unsigned int row, const unsigned int column) -> floatType * {
+                return &(*(jacobian_begin + num_columns * (material_response_size * p + row) + column));
+            };
+
+            const floatType temperature = *(point_dof_begin + theta);
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                *(response + i) = gravity * (i + 1) * (*(point_dof_begin + rho));
+
+                *(response + 3 + dim * i + i) += thermal * temperature * temperature;
+
+                if (compute_jacobian) {
+                    *d(i, rho) = gravity * (i + 1);
+
+                    *d(3 + dim * i + i, theta) += 2 * thermal * temperature;
+                }
+
+                for (unsigned int j = 0; j < dim; ++j) {
+                    *(response + 3 + dim * i + j) +=
+                        mu * (*(point_dof_begin + grad_w(i, j)) + *(point_dof_begin + grad_w(j, i)));
+
+                    if (compute_jacobian) {
+                        *d(3 + dim * i + j, grad_w(i, j)) += mu;
+                        *d(3 + dim * i + j, grad_w(j, i)) += mu;
+                    }
+                }
+
+                for (unsigned int k = 0; k < dim; ++k) {
+                    *(response + 3 + dim * i + i) += lambda * (*(point_dof_begin + grad_w(k, k)));
+
+                    if (compute_jacobian) {
+                        *d(3 + dim * i + i, grad_w(k, k)) += lambda;
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * Compute the material response
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        evaluate(point_dof_begin, response_begin, response_end, response_begin, response_begin, false);
+    }
+
+    /*!
+     * Compute the material response and its Jacobian
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        ++jacobian_evaluations;
+
+        evaluate(point_dof_begin, response_begin, response_end, jacobian_begin, jacobian_end, true);
+    }
+};
+
+/*!
+ * A linear material model for all of the balance equations. Each entry of the material response of each phase is an
+ * affine function of every entry of the point dof vector with pseudo-random coefficients. The material response of a
+ * phase is the body force (0), the cauchy stress (3), the interphasic force (12), the mass change rate (15), the trace
+ * of the mass change velocity gradient (16), the internal heat generation (17), the heat flux (18), the interphasic
+ * heat transfer (21), and the predicted internal energy (22).
+ */
+template <int dim, int nphases, int num_additional_dof>
+struct LinearMixtureModel {
+    static constexpr unsigned int material_response_size = 23;  //!< The size of the material response of a phase
+
+    static constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The number of dof
+
+    static constexpr unsigned int num_columns = num_dof * (1 + dim);  //!< The size of the point dof vector
+
+    /*!
+     * The coefficient of a column of the point dof vector in a row of the material response
+     *
+     * \param row: The row of the phase-major material response
+     * \param column: The column of the point dof vector
+     */
+    static floatType coefficient(const unsigned int row, const unsigned int column) {
+        return 0.05 * std::sin(0.37 * row + 1.3 * column + 0.2);
+    }
+
+    /*!
+     * Compute the material response
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        BOOST_TEST((unsigned int)(point_dof_end - point_dof_begin) == num_columns);
+
+        for (unsigned int row = 0; row < (unsigned int)(response_end - response_begin); ++row) {
+            *(response_begin + row) = 0.2 * std::cos(0.7 * row);
+
+            for (unsigned int column = 0; column < num_columns; ++column) {
+                *(response_begin + row) += coefficient(row, column) * (*(point_dof_begin + column));
+            }
+        }
+    }
+
+    /*!
+     * Compute the material response and its Jacobian
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        (*this)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+
+        BOOST_TEST((unsigned int)(jacobian_end - jacobian_begin) ==
+                   num_columns * (unsigned int)(response_end - response_begin));
+
+        for (unsigned int row = 0; row < (unsigned int)(response_end - response_begin); ++row) {
+            for (unsigned int column = 0; column < num_columns; ++column) {
+                *(jacobian_begin + num_columns * row + column) = coefficient(row, column);
+            }
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_MaterialTangentCache, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the cache only calls the material model for points which are not cached
+     */
+
+    using model_type = CountingModel<3, 1, 0>;
+
+    constexpr unsigned int response_size = model_type::material_response_size;
+
+    constexpr unsigned int jacobian_size = response_size * model_type::num_dof * 4;
+
+    model_type model;
+
+    matrix_free::MaterialTangentCache<floatType> cache(2, 3, response_size, jacobian_size);
+
+    BOOST_TEST(cache.getNumElements() == 2);
+
+    BOOST_TEST(cache.getNumPoints() == 3);
+
+    BOOST_TEST(cache.getMemoryBytes() == 6 * ((response_size + jacobian_size) * sizeof(floatType) + sizeof(char)));
+
+    std::array<floatType, model_type::num_dof * 4> point_dof;
+
+    for (unsigned int i = 0; i < point_dof.size(); ++i) {
+        point_dof[i] = 0.1 * (i + 1);
+    }
+
+    std::array<floatType, response_size> response, answer_response;
+
+    std::array<floatType, jacobian_size> jacobian, answer_jacobian;
+
+    model(1, std::cbegin(point_dof), std::cend(point_dof), std::begin(answer_response), std::end(answer_response),
+          std::begin(answer_jacobian), std::end(answer_jacobian));
+
+    auto cached_model = matrix_free::CachedMaterialModel<floatType, model_type>(cache, 1, model);
+
+    BOOST_TEST(!cache.isCached(1, 1));
+
+    cached_model(1, std::cbegin(point_dof), std::cend(point_dof), std::begin(response), std::end(response),
+                 std::begin(jacobian), std::end(jacobian));
+
+    BOOST_TEST(model.jacobian_evaluations == 2);
+
+    BOOST_TEST(cache.isCached(1, 1));
+
+    BOOST_TEST(!cache.isCached(0, 1));
+
+    BOOST_TEST(response == answer_response, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(jacobian == answer_jacobian, CHECK_PER_ELEMENT);
+
+    // The cached values are returned regardless of the point dof vector
+    std::array<floatType, model_type::num_dof * 4> other_point_dof;
+
+    std::fill(std::begin(other_point_dof), std::end(other_point_dof), 2.0);
+
+    cached_model(1, std::cbegin(other_point_dof), std::cend(other_point_dof), std::begin(response),
+                 std::end(response), std::begin(jacobian), std::end(jacobian));
+
+    BOOST_TEST(model.jacobian_evaluations == 2);
+
+    BOOST_TEST(response == answer_response, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(jacobian == answer_jacobian, CHECK_PER_ELEMENT);
+
+    // The material response alone is not cached
+    cached_model(1, std::cbegin(other_point_dof), std::cend(other_point_dof), std::begin(response),
+                 std::end(response));
+
+    model(1, std::cbegin(other_point_dof), std::cend(other_point_dof), std::begin(answer_response),
+          std::end(answer_response), std::begin(answer_jacobian), std::end(answer_jacobian));
+
+    BOOST_TEST(response == answer_response, CHECK_PER_ELEMENT);
+
+    cache.invalidate();
+
+    BOOST_TEST(!cache.isCached(1, 1));
+
+    cached_model(1, std::cbegin(other_point_dof), std::cend(other_point_dof), std::begin(response),
+                 std::end(response), std::begin(jacobian), std::end(jacobian));
+
+    BOOST_TEST(model.jacobian_evaluations == 4);
+
+    BOOST_TEST(jacobian == answer_jacobian, CHECK_PER_ELEMENT);
+
+    BOOST_CHECK_THROW(cached_model(3, std::cbegin(point_dof), std::cend(point_dof), std::begin(response),
+                                   std::end(response), std::begin(jacobian), std::end(jacobian)),
+                      std::exception);
+
+    BOOST_CHECK_THROW(cached_model(0, std::cbegin(point_dof), std::cend(point_dof), std::begin(response),
+                                   std::end(response), std::begin(jacobian), std::begin(jacobian) + 1),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_ElementOperator, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the matrix-free product of the Jacobian of the balance of linear momentum and its diagonal against the
+     * assembled CSR Jacobian with and without the material tangent cache and with and without a thread pool
+     */
+
+    static constexpr unsigned int dim = 3, nphases = 2, nadd = 1, node_count = 8;
+
+    using model_type = CountingModel<dim, nphases, nadd>;
+
+    static constexpr unsigned int num_dof = model_type::num_dof;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(3, 2, 1, 3., 2., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, nadd);
+
+    coloring::ElementColoring element_coloring = coloring::colorElements(connectivity);
+
+    const unsigned int num_global_dof = numbering.getNumDOF();
+
+    std::vector<floatType> dof(num_global_dof), x(num_global_dof);
+
+    for (unsigned int i = 0; i < num_global_dof; ++i) {
+        dof[i] = 0.5 + 0.3 * std::sin(1.7 * i + 0.1);
+        x[i]   = std::cos(0.37 * i);
+    }
+
+    model_type model;
+
+    matrix_free::MaterialTangentCache<floatType> cache(connectivity.getNumElements(), 8,
+                                                       nphases * model_type::material_response_size,
+                                                       nphases * model_type::material_response_size * num_dof * 4);
+
+    auto element_data = [&](const assembly::size_type e, std::array<floatType, node_count * dim> &X,
+                            std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(X) + dim * a);
+        }
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof), std::cend(dof), std::begin(u),
+                                std::end(u));
+
+        for (unsigned int i = 0; i < node_count * num_dof; ++i) {
+            u_dot[i] = 0.1 * u[i];
+        }
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     X;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, X, u, u_dot);
+
+        LinearHex element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, model_type::material_response_size,
+                                                        nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), 10.0, 100.0, model, residual_begin, residual_end, jacobian_begin,
+            jacobian_end);
+    };
+
+    auto element_product = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                               auto product_end, auto &element_model) {
+        std::array<floatType, node_count * dim>     X;
+        std::array<floatType, node_count * num_dof> u, u_dot;
+
+        element_data(e, X, u, u_dot);
+
+        LinearHex element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+        matrix_free::applyElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, model_type::material_response_size,
+                                                         nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_dot), std::cend(u_dot), 10.0, 100.0, element_model, x_begin, x_end, product_begin,
+            product_end);
+    };
+
+    auto product_kernel = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                              auto product_end) {
+        element_product(e, x_begin, x_end, product_begin, product_end, model);
+    };
+
+    auto cached_kernel = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                             auto product_end) {
+        matrix_free::CachedMaterialModel<floatType, model_type> cached_model(cache, e, model);
+
+        element_product(e, x_begin, x_end, product_begin, product_end, cached_model);
+    };
+
+    auto assembleAnswer = [&](std::vector<floatType> &answer, std::vector<floatType> &answer_diagonal) {
+        std::vector<floatType> residual(num_global_dof);
+
+        auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+        assembly::assembleResidualAndJacobian(connectivity, numbering, jacobian_kernel, std::begin(residual),
+                                              std::end(residual), jacobian);
+
+        answer.resize(num_global_dof);
+
+        jacobian.multiply(std::cbegin(x), std::cend(x), std::begin(answer), std::end(answer));
+
+        answer_diagonal.resize(num_global_dof);
+
+        for (unsigned int row = 0; row < num_global_dof; ++row) {
+            answer_diagonal[row] = jacobian.getValues()[jacobian.findEntry(row, row)];
+        }
+    };
+
+    std::vector<floatType> answer, answer_diagonal;
+
+    assembleAnswer(answer, answer_diagonal);
+
+    std::vector<floatType> y(num_global_dof), diagonal(num_global_dof);
+
+    // Recompute the material tangents for every product
+    auto serial_operator =
+        matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring, product_kernel);
+
+    BOOST_TEST(serial_operator.getNumRows() == num_global_dof);
+
+    BOOST_TEST(serial_operator.getNumElementDOF() == node_count * num_dof);
+
+    BOOST_TEST(serial_operator.getMemoryBytes() == 2 * node_count * num_dof * sizeof(floatType));
+
+    serial_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    matrix_free::assembleDiagonal<floatType>(connectivity, numbering, element_coloring, jacobian_kernel,
+                                             std::begin(diagonal), std::end(diagonal));
+
+    BOOST_TEST(diagonal == answer_diagonal, CHECK_PER_ELEMENT);
+
+    pool::ThreadPool thread_pool(4);
+
+    auto threaded_operator = matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring,
+                                                                         product_kernel, &thread_pool);
+
+    threaded_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    std::fill(std::begin(diagonal), std::end(diagonal), 0);
+
+    matrix_free::assembleDiagonal<floatType>(connectivity, numbering, element_coloring, jacobian_kernel,
+                                             std::begin(diagonal), std::end(diagonal), &thread_pool);
+
+    BOOST_TEST(diagonal == answer_diagonal, CHECK_PER_ELEMENT);
+
+    // Cache the material tangents on the first product
+    auto cached_operator = matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring,
+                                                                       cached_kernel, &thread_pool);
+
+    model.jacobian_evaluations = 0;
+
+    cached_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(model.jacobian_evaluations == 8 * connectivity.getNumElements());
+
+    cached_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(model.jacobian_evaluations == 8 * connectivity.getNumElements());
+
+    // The cached tangents are those of the degrees of freedom the cache was filled at until it is invalidated
+    for (unsigned int i = 0; i < num_global_dof; ++i) {
+        dof[i] += 0.2 * std::cos(0.3 * i);
+    }
+
+    std::vector<floatType> updated_answer, updated_answer_diagonal;
+
+    assembleAnswer(updated_answer, updated_answer_diagonal);
+
+    cached_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y != updated_answer);
+
+    cache.invalidate();
+
+    cached_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == updated_answer, CHECK_PER_ELEMENT);
+
+    BOOST_CHECK_THROW(cached_operator.multiply(std::cbegin(x), std::cend(x) - 1, std::begin(y), std::end(y)),
+                      std::exception);
+
+    coloring::ElementColoring empty_coloring;
+
+    BOOST_CHECK_THROW(matrix_free::makeElementOperator<floatType>(connectivity, numbering, empty_coloring,
+                                                                  product_kernel),
+                      std::exception);
+
+    BOOST_CHECK_THROW(matrix_free::assembleDiagonal<floatType>(connectivity, numbering, element_coloring,
+                                                               jacobian_kernel, std::begin(diagonal),
+                                                               std::end(diagonal) - 1),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_applyElementBalanceEquations, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the matrix-free products of the Jacobians of all of the balance equations and constraints against the
+     * product of the assembled CSR Jacobian and a vector
+     */
+
+    static constexpr unsigned int dim = 3, nphases = 2, nadd = 1, node_count = 8;
+
+    using model_type = LinearMixtureModel<dim, nphases, nadd>;
+
+    static constexpr unsigned int num_dof = model_type::num_dof;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(2, 2, 1, 2., 2., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, nadd);
+
+    coloring::ElementColoring element_coloring = coloring::colorElements(connectivity);
+
+    const unsigned int num_global_dof = numbering.getNumDOF();
+
+    std::vector<floatType> dof(num_global_dof), x(num_global_dof);
+
+    for (unsigned int i = 0; i < num_global_dof; ++i) {
+        dof[i] = 0.5 + 0.3 * std::sin(1.7 * i + 0.1);
+        x[i]   = std::cos(0.37 * i);
+    }
+
+    const std::array<floatType, nphases> rest_density = {1.3, 0.9};
+
+    const floatType dt = 0.1;
+
+    model_type model;
+
+    constexpr unsigned int mrs = model_type::material_response_size;
+
+    auto element_data = [&](const assembly::size_type e, std::array<floatType, node_count * dim> &X,
+                            std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot,
+                            std::array<floatType, node_count * num_dof> &u_ddot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(X) + dim * a);
+        }
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof), std::cend(dof), std::begin(u),
+                                std::end(u));
+
+        for (unsigned int i = 0; i < node_count * num_dof; ++i) {
+            u_dot[i]  = 0.1 * std::cos(u[i]);
+            u_ddot[i] = 0.2 * std::sin(u[i]);
+        }
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     X;
+        std::array<floatType, node_count * num_dof> u, u_dot, u_ddot;
+
+        element_data(e, X, u, u_dot, u_ddot);
+
+        LinearHex element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+        assembly::computeElementBalanceOfMass<dim, dim, 15, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, residual_begin, residual_end, jacobian_begin, jacobian_end);
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_ddot), std::cend(u_ddot), 1 / dt, 1 / (dt * dt), model, residual_begin, residual_end,
+            jacobian_begin, jacobian_end);
+
+        assembly::computeElementBalanceOfEnergy<dim, false, dim, 3, 17, 18, 12, 21, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, residual_begin, residual_end, jacobian_begin, jacobian_end);
+
+        assembly::computeElementBalanceOfVolumeFraction<dim, dim, 15, 16, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(rest_density), std::cend(rest_density), 1 / dt, model, residual_begin, residual_end,
+            jacobian_begin, jacobian_end);
+
+        assembly::computeElementInternalEnergyConstraint<dim, dim, 22, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, residual_begin, residual_end, jacobian_begin, jacobian_end);
+
+        assembly::computeElementDisplacementConstraint<dim, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u_dot), std::cend(u_dot), 1 / dt, residual_begin,
+            residual_end, jacobian_begin, jacobian_end);
+    };
+
+    auto product_kernel = [&](const assembly::size_type e, auto x_begin, auto x_end, auto product_begin,
+                              auto product_end) {
+        std::array<floatType, node_count * dim>     X;
+        std::array<floatType, node_count * num_dof> u, u_dot, u_ddot;
+
+        element_data(e, X, u, u_dot, u_ddot);
+
+        LinearHex element(std::cbegin(X), std::cend(X), std::cbegin(X), std::cend(X));
+
+        matrix_free::applyElementBalanceOfMass<dim, dim, 15, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, x_begin, x_end, product_begin, product_end);
+
+        matrix_free::applyElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_ddot), std::cend(u_ddot), 1 / dt, 1 / (dt * dt), model, x_begin, x_end, product_begin,
+            product_end);
+
+        matrix_free::applyElementBalanceOfEnergy<dim, false, dim, 3, 17, 18, 12, 21, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, x_begin, x_end, product_begin, product_end);
+
+        matrix_free::applyElementBalanceOfVolumeFraction<dim, dim, 15, 16, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(rest_density), std::cend(rest_density), 1 / dt, model, x_begin, x_end, product_begin,
+            product_end);
+
+        matrix_free::applyElementInternalEnergyConstraint<dim, dim, 22, mrs, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, x_begin, x_end, product_begin, product_end);
+
+        matrix_free::applyElementDisplacementConstraint<dim, nphases, nadd>(
+            element, std::cbegin(X), std::cend(X), std::cbegin(u_dot), std::cend(u_dot), 1 / dt, x_begin, x_end,
+            product_begin, product_end);
+    };
+
+    std::vector<floatType> residual(num_global_dof), answer(num_global_dof);
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, jacobian_kernel, std::begin(residual),
+                                          std::end(residual), jacobian);
+
+    jacobian.multiply(std::cbegin(x), std::cend(x), std::begin(answer), std::end(answer));
+
+    std::vector<floatType> y(num_global_dof);
+
+    auto serial_operator =
+        matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring, product_kernel);
+
+    serial_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    pool::ThreadPool thread_pool(4);
+
+    auto threaded_operator = matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring,
+                                                                         product_kernel, &thread_pool);
+
+    std::fill(std::begin(y), std::end(y), 0);
+
+    threaded_operator.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_solve, *boost::unit_test::tolerance(1e-5)) {
+    /*!
+     * Test a Jacobi preconditioned GMRES solve with the matrix-free operator of a non-symmetric system
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(3, 2, 2, 3., 2., 2., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 0);
+
+    coloring::ElementColoring element_coloring = coloring::colorElements(connectivity);
+
+    const assembly::size_type num_element_dof = connectivity.getNodesPerElement() * numbering.getNumNodeDOF();
+
+    auto element_jacobian = [&](const assembly::size_type e, const assembly::size_type i, const assembly::size_type j) {
+        return 0.05 * std::cos(0.1 * (e + i + 3 * j)) + ((i == j) ? 1.0 + 0.1 * (i % 7) : 0.0);
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto, auto, auto jacobian_begin, auto) {
+        for (assembly::size_type i = 0; i < num_element_dof; ++i) {
+            for (assembly::size_type j = 0; j < num_element_dof; ++j) {
+                *(jacobian_begin + num_element_dof * i + j) = element_jacobian(e, i, j);
+            }
+        }
+    };
+
+    auto product_kernel = [&](const assembly::size_type e, auto x_begin, auto, auto product_begin, auto) {
+        for (assembly::size_type i = 0; i < num_element_dof; ++i) {
+            for (assembly::size_type j = 0; j < num_element_dof; ++j) {
+                *(product_begin + i) += element_jacobian(e, i, j) * (*(x_begin + j));
+            }
+        }
+    };
+
+    pool::ThreadPool thread_pool(3);
+
+    auto element_operator = matrix_free::makeElementOperator<floatType>(connectivity, numbering, element_coloring,
+                                                                        product_kernel, &thread_pool);
+
+    std::vector<floatType> solution(numbering.getNumDOF()), rhs(numbering.getNumDOF()), diagonal(numbering.getNumDOF());
+
+    for (unsigned int i = 0; i < solution.size(); ++i) {
+        solution[i] = std::sin(0.37 * i);
+    }
+
+    element_operator.multiply(std::cbegin(solution), std::cend(solution), std::begin(rhs), std::end(rhs));
+
+    matrix_free::assembleDiagonal<floatType>(connectivity, numbering, element_coloring, jacobian_kernel,
+                                             std::begin(diagonal), std::end(diagonal), &thread_pool);
+
+    krylov::Jacobi<floatType> jacobi(&thread_pool);
+
+    jacobi.setDiagonal(std::cbegin(diagonal), std::cend(diagonal));
+
+    BOOST_TEST(jacobi.getInverseDiagonal()[0] == 1 / diagonal[0]);
+
+    std::vector<floatType> x(numbering.getNumDOF());
+
+    krylov::KrylovOptions options;
+
+    options.relative_tolerance = 1e-10;
+
+    krylov::KrylovStatistics statistics = krylov::gmres(element_operator, jacobi, std::cbegin(rhs), std::cend(rhs),
+                                                        std::begin(x), std::end(x), options, &thread_pool);
+
+    BOOST_TEST(statistics.converged);
+
+    BOOST_TEST(x == solution, CHECK_PER_ELEMENT);
+
+    diagonal[3] = 0;
+
+    BOOST_CHECK_THROW(jacobi.setDiagonal(std::cbegin(diagonal), std::cend(diagonal)), std::exception);
+}
@@ -0,0 +1,930 @@
+/**
+ * \file test_tardigrade_mesh_assembly.cpp
+ *
+ * Tests for tardigrade_mesh_assembly
+ */
+
+#include <tardigrade_LinearHex.h>
+#include <tardigrade_QuadraticHex.h>
+#include <tardigrade_mesh_assembly.h>
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_mesh_assembly
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+using LinearHex = tardigradeBalanceEquations::finiteElement::LinearHex<
+    tardigradeBalanceEquations::finiteElement::LinearHexConfiguration>;
+
+using QuadraticHex = tardigradeBalanceEquations::finiteElement::QuadraticHex<
+    tardigradeBalanceEquations::finiteElement::QuadraticHexConfiguration>;
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+/*!
+ * A linear material model for the balance of linear momentum. Each phase has a small-strain elastic stress from the
+ * gradient of its displacement plus a thermal pressure, a body force proportional to its density, and an interphasic
+ * force from its internal energy and the additional degree of freedom.
+ */
+template <int dim, int nphases, int num_additional_dof>
+struct LinearMomentumModel {
+    static constexpr unsigned int material_response_size = 16;  //!< The size of the material response of a phase
+
+    static constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The number of dof
+
+    floatType lambda = 1.2, mu = 0.7, thermal = 0.3, gravity = -0.4, coupling = 0.25, exchange = 0.15;
+
+    /*!
+     * Compute the material response and its Jacobian w.r.t. the point dof vector
+     *
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void evaluate(const dof_iter &point_dof_begin, const dof_iter &point_dof_end, response_iter response_begin,
+                  response_iter response_end, jacobian_iter jacobian_begin, jacobian_iter jacobian_end,
+                  const bool compute_jacobian) {
+        constexpr unsigned int num_columns = num_dof * (1 + dim);
+
+        std::fill(response_begin, response_end, 0);
+
+        if (compute_jacobian) {
+            std::fill(jacobian_begin, jacobian_end, 0);
+        }
+
+        for (unsigned int p = 0; p < nphases; ++p) {
+            auto response = response_begin + material_response_size * p;
+
+            const unsigned int rho   = p;
+            const unsigned int theta = nphases * (1 + 2 * dim) + p;
+            const unsigned int e     = nphases * (2 + 2 * dim) + p;
+            const unsigned int z     = nphases * (4 + 2 * dim);
+
+            auto grad_w = [&](const unsigned int i, const unsigned int j) {
+                return num_dof + dim * (nphases + dim * p + i) + j;
+            };
+
+            auto d = [&](const unsigned int row, const unsigned int column) -> floatType * {
+                return &(*(jacobian_begin + num_columns * (material_response_size * p + row) + column));
+            };
+
+            for (unsigned int i = 0; i < dim; ++i) {
+                *(response + i) = gravity * (i + 1) * (*(point_dof_begin + rho));
+
+                *(response + 12 + i) =
+                    coupling * (*(point_dof_begin + e)) * (i + 1) + exchange * (*(point_dof_begin + z));
+
+                if (compute_jacobian) {
+                    *d(i, rho)      = gravity * (i + 1);
+                    *d(12 + i, e)   = coupling * (i + 1);
+                    *d(12 + i, z)   = exchange;
+                }
+
+                for (unsigned int j = 0; j < dim; ++j) {
+                    *(response + 3 + dim * i + j) =
+                        mu * (*(point_dof_begin + grad_w(i, j)) + *(point_dof_begin + grad_w(j, i)));
+
+                    if (compute_jacobian) {
+                        *d(3 + dim * i + j, grad_w(i, j)) += mu;
+                        *d(3 + dim * i + j, grad_w(j, i)) += mu;
+                    }
+                }
+
+                *(response + 3 + dim * i + i) += thermal * (*(point_dof_begin + theta));
+
+                if (compute_jacobian) {
+                    *d(3 + dim * i + i, theta) += thermal;
+                }
+
+                for (unsigned int k = 0; k < dim; ++k) {
+                    *(response + 3 + dim * i + i) += lambda * (*(point_dof_begin + grad_w(k, k)));
+
+                    if (compute_jacobian) {
+                        *d(3 + dim * i + i, grad_w(k, k)) += lambda;
+                    }
+                }
+            }
+        }
+    }
+
+    /*!
+     * Compute the material response
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        evaluate(point_dof_begin, point_dof_end, response_begin, response_end, response_begin, response_begin, false);
+    }
+
+    /*!
+     * Compute the material response and its Jacobian
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        evaluate(point_dof_begin, point_dof_end, response_begin, response_end, jacobian_begin, jacobian_end, true);
+    }
+};
+
+/*!
+ * A linear material model for all of the balance equations. Each entry of the material response of each phase is an
+ * affine function of every entry of the point dof vector with pseudo-random coefficients. The material response of a
+ * phase is the body force (0), the cauchy stress (3), the interphasic force (12), the mass change rate (15), the trace
+ * of the mass change velocity gradient (16), the internal heat generation (17), the heat flux (18), the interphasic
+ * heat transfer (21), and the predicted internal energy (22).
+ */
+template <int dim, int nphases, int num_additional_dof>
+struct LinearMixtureModel {
+    static constexpr unsigned int material_response_size = 23;  //!< The size of the material response of a phase
+
+    static constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The number of dof
+
+    static constexpr unsigned int num_columns = num_dof * (1 + dim);  //!< The size of the point dof vector
+
+    /*!
+     * The coefficient of a column of the point dof vector in a row of the material response
+     *
+     * \param row: The row of the phase-major material response
+     * \param column: The column of the point dof vector
+     */
+    static floatType coefficient(const unsigned int row, const unsigned int column) {
+        return 0.05 * std::sin(0.37 * row + 1.3 * column + 0.2);
+    }
+
+    /*!
+     * Compute the material response
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     */
+    template <class dof_iter, class response_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end) {
+        BOOST_TEST((unsigned int)(point_dof_end - point_dof_begin) == num_columns);
+
+        for (unsigned int row = 0; row < (unsigned int)(response_end - response_begin); ++row) {
+            *(response_begin + row) = 0.2 * std::cos(0.7 * row);
+
+            for (unsigned int column = 0; column < num_columns; ++column) {
+                *(response_begin + row) += coefficient(row, column) * (*(point_dof_begin + column));
+            }
+        }
+    }
+
+    /*!
+     * Compute the material response and its Jacobian
+     *
+     * \param qp: The integration point
+     * \param &point_dof_begin: The starting iterator of the point dof vector
+     * \param &point_dof_end: The stopping iterator of the point dof vector
+     * \param response_begin: The starting iterator of the material response
+     * \param response_end: The stopping iterator of the material response
+     * \param jacobian_begin: The starting iterator of the material response Jacobian
+     * \param jacobian_end: The stopping iterator of the material response Jacobian
+     */
+    template <class dof_iter, class response_iter, class jacobian_iter>
+    void operator()(const unsigned int qp, const dof_iter &point_dof_begin, const dof_iter &point_dof_end,
+                    response_iter response_begin, response_iter response_end, jacobian_iter jacobian_begin,
+                    jacobian_iter jacobian_end) {
+        (*this)(qp, point_dof_begin, point_dof_end, response_begin, response_end);
+
+        BOOST_TEST((unsigned int)(jacobian_end - jacobian_begin) ==
+                   num_columns * (unsigned int)(response_end - response_begin));
+
+        for (unsigned int row = 0; row < (unsigned int)(response_end - response_begin); ++row) {
+            for (unsigned int column = 0; column < num_columns; ++column) {
+                *(jacobian_begin + num_columns * row + column) = coefficient(row, column);
+            }
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_generateHexBlock, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the generation of blocks of linear and quadratic hex elements
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity linear = assembly::generateHexBlock<LinearHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    BOOST_TEST(linear.getNumNodes() == 12);
+
+    BOOST_TEST(linear.getNumElements() == 2);
+
+    BOOST_TEST(linear.getNodesPerElement() == 8);
+
+    BOOST_TEST(coordinates.size() == 3 * 12);
+
+    std::vector<assembly::size_type> linear_answer = {0, 1, 4, 3, 6, 7, 10, 9, 1, 2, 5, 4, 7, 8, 11, 10};
+
+    BOOST_TEST(linear.getConnectivity() == linear_answer, CHECK_PER_ELEMENT);
+
+    // The nodes of each element are at the local nodes of the element mapped to the element's box
+    for (unsigned int e = 0; e < 2; ++e) {
+        for (unsigned int a = 0; a < 8; ++a) {
+            const assembly::size_type node = *(linear.getElementNodesBegin(e) + a);
+
+            BOOST_TEST(coordinates[3 * node + 0] == e + 0.5 * (LinearHex::local_nodes[3 * a + 0] + 1));
+            BOOST_TEST(coordinates[3 * node + 1] == 0.5 * (LinearHex::local_nodes[3 * a + 1] + 1));
+            BOOST_TEST(coordinates[3 * node + 2] == 0.5 * (LinearHex::local_nodes[3 * a + 2] + 1));
+        }
+    }
+
+    assembly::MeshConnectivity quadratic =
+        assembly::generateHexBlock<QuadraticHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    BOOST_TEST(quadratic.getNumNodes() == 32);
+
+    BOOST_TEST(quadratic.getNumElements() == 2);
+
+    BOOST_TEST(quadratic.getNodesPerElement() == 20);
+
+    for (unsigned int e = 0; e < 2; ++e) {
+        for (unsigned int a = 0; a < 20; ++a) {
+            const assembly::size_type node = *(quadratic.getElementNodesBegin(e) + a);
+
+            BOOST_TEST(coordinates[3 * node + 0] == e + 0.5 * (QuadraticHex::local_nodes[3 * a + 0] + 1));
+            BOOST_TEST(coordinates[3 * node + 1] == 0.5 * (QuadraticHex::local_nodes[3 * a + 1] + 1));
+            BOOST_TEST(coordinates[3 * node + 2] == 0.5 * (QuadraticHex::local_nodes[3 * a + 2] + 1));
+        }
+    }
+
+    std::array<assembly::size_type, 3> bad_connectivity = {0, 1, 5};
+
+    BOOST_CHECK_THROW(assembly::MeshConnectivity(5, 3, std::cbegin(bad_connectivity), std::cend(bad_connectivity)),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_DofNumbering, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the numbering of the degrees of freedom
+     */
+
+    assembly::DofNumbering numbering(5, 3, 2, 1);
+
+    BOOST_TEST(numbering.getNumNodeDOF() == 21);
+
+    BOOST_TEST(numbering.getNumDOF() == 105);
+
+    std::array<assembly::size_type, assembly::num_fields> offsets;
+
+    std::array<assembly::size_type, assembly::num_fields> offsets_answer = {0, 2, 8, 14, 16, 18, 20};
+
+    for (unsigned int f = 0; f < assembly::num_fields; ++f) {
+        offsets[f] = numbering.getFieldOffset(static_cast<assembly::Field>(f));
+    }
+
+    BOOST_TEST(offsets == offsets_answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(numbering.getLocalDOF(assembly::VELOCITY, 1, 2) == 13);
+
+    BOOST_TEST(numbering.getLocalDOF(assembly::ADDITIONAL_DOF, 1, 0) == 20);
+
+    BOOST_TEST(numbering.getGlobalDOF(3, assembly::VELOCITY, 1, 2) == 76);
+
+    BOOST_CHECK_THROW(numbering.getLocalDOF(assembly::DENSITY, 2), std::exception);
+
+    BOOST_CHECK_THROW(numbering.getLocalDOF(assembly::DISPLACEMENT, 0, 3), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_CSRMatrix, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the CSR matrix
+     */
+
+    // [ 1 0 2 ]
+    // [ 0 3 0 ]
+    // [ 4 0 5 ]
+    std::array<assembly::size_type, 4> row_offsets    = {0, 2, 3, 5};
+    std::array<assembly::size_type, 5> column_indices = {0, 2, 1, 0, 2};
+
+    assembly::CSRMatrix<floatType> A(3, 3, std::cbegin(row_offsets), std::cend(row_offsets),
+                                     std::cbegin(column_indices), std::cend(column_indices));
+
+    BOOST_TEST(A.getNumNonZeros() == 5);
+
+    A.addValue(0, 0, 1);
+    A.addValue(0, 2, 2);
+    A.addValue(1, 1, 3);
+    A.addValue(2, 0, 4);
+    A.addValue(2, 2, 5);
+
+    BOOST_TEST(A.findEntry(2, 2) == 4);
+
+    BOOST_CHECK_THROW(A.findEntry(1, 0), std::exception);
+
+    std::array<floatType, 3> x = {1, 2, 3};
+
+    std::array<floatType, 3> y;
+
+    std::array<floatType, 3> answer = {7, 6, 19};
+
+    A.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    BOOST_TEST(y == answer, CHECK_PER_ELEMENT);
+
+    A.setZero();
+
+    A.multiply(std::cbegin(x), std::cend(x), std::begin(y), std::end(y));
+
+    std::array<floatType, 3> zero = {0, 0, 0};
+
+    BOOST_TEST(y == zero, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_buildCSRMatrix, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the construction of the sparsity pattern of the Jacobian of a mesh
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 0);
+
+    const assembly::size_type num_node_dof = numbering.getNumNodeDOF();
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    BOOST_TEST(jacobian.getNumRows() == 12 * num_node_dof);
+
+    BOOST_TEST(jacobian.getNumColumns() == 12 * num_node_dof);
+
+    // The nodes on the ends of the block are adjacent to 8 nodes and the nodes in the middle to 12
+    BOOST_TEST(jacobian.getNumNonZeros() == num_node_dof * num_node_dof * (8 * 8 + 4 * 12));
+
+    const auto &row_offsets    = jacobian.getRowOffsets();
+    const auto &column_indices = jacobian.getColumnIndices();
+
+    for (unsigned int node = 0; node < 12; ++node) {
+        const unsigned int expected = (coordinates[3 * node] == 1.) ? 12 : 8;
+
+        for (unsigned int i = 0; i < num_node_dof; ++i) {
+            const unsigned int row = num_node_dof * node + i;
+
+            BOOST_TEST(row_offsets[row + 1] - row_offsets[row] == expected * num_node_dof);
+
+            BOOST_TEST(std::is_sorted(std::cbegin(column_indices) + row_offsets[row],
+                                      std::cbegin(column_indices) + row_offsets[row + 1]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_assembleResidualAndJacobian, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the element loop with a kernel which sets each element contribution to the element number plus one
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 2);
+
+    const assembly::size_type num_node_dof = numbering.getNumNodeDOF();
+
+    auto kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end, auto jacobian_begin,
+                      auto jacobian_end) {
+        std::fill(residual_begin, residual_end, e + 1.);
+
+        std::fill(jacobian_begin, jacobian_end, e + 1.);
+    };
+
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        std::fill(residual_begin, residual_end, e + 1.);
+    };
+
+    std::vector<floatType> residual(numbering.getNumDOF());
+
+    std::vector<floatType> residual_only(numbering.getNumDOF());
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(residual), std::end(residual),
+                                          jacobian);
+
+    assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_only),
+                               std::end(residual_only));
+
+    BOOST_TEST(residual == residual_only, CHECK_PER_ELEMENT);
+
+    for (unsigned int node = 0; node < 12; ++node) {
+        const floatType x = coordinates[3 * node];
+
+        const floatType answer = (x == 0.) ? 1. : (x == 1.) ? 3. : 2.;
+
+        for (unsigned int i = 0; i < num_node_dof; ++i) {
+            BOOST_TEST(residual[num_node_dof * node + i] == answer);
+        }
+    }
+
+    // Node 1 and node 4 are shared by both elements, node 0 and node 2 are not adjacent
+    BOOST_TEST(jacobian.getValues()[jacobian.findEntry(num_node_dof * 1 + 2, num_node_dof * 4 + 3)] == 3.);
+
+    BOOST_TEST(jacobian.getValues()[jacobian.findEntry(num_node_dof * 0 + 2, num_node_dof * 4 + 3)] == 1.);
+
+    BOOST_TEST(jacobian.getValues()[jacobian.findEntry(num_node_dof * 2 + 2, num_node_dof * 4 + 3)] == 2.);
+
+    BOOST_CHECK_THROW(jacobian.findEntry(num_node_dof * 0, num_node_dof * 2), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_ScatterMap, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the precomputed scatter map points at the entries found by searching the Jacobian and that the
+     * assembly with the map matches the assembly with the connectivity
+     */
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity =
+        assembly::generateHexBlock<QuadraticHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), 3, 1, 1);
+
+    const assembly::size_type num_node_dof    = numbering.getNumNodeDOF();
+    const assembly::size_type num_element_dof = 20 * num_node_dof;
+
+    assembly::ScatterMap scatter_map;
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering, scatter_map);
+
+    BOOST_TEST(scatter_map.getNumElements() == 2);
+
+    BOOST_TEST(scatter_map.getNumElementDOF() == num_element_dof);
+
+    BOOST_TEST(scatter_map.getNumNonZeros() == jacobian.getNumNonZeros());
+
+    for (assembly::size_type e = 0; e < 2; ++e) {
+        auto nodes   = connectivity.getElementNodesBegin(e);
+        auto dof     = scatter_map.getElementDOFBegin(e);
+        auto offsets = scatter_map.getElementOffsetsBegin(e);
+
+        BOOST_TEST((assembly::size_type)(scatter_map.getElementOffsetsEnd(e) - offsets) ==
+                   num_element_dof * num_element_dof);
+
+        for (assembly::size_type k = 0; k < num_element_dof; ++k) {
+            const assembly::size_type row = num_node_dof * (*(nodes + k / num_node_dof)) + k % num_node_dof;
+
+            BOOST_TEST(*(dof + k) == row);
+
+            for (assembly::size_type l = 0; l < num_element_dof; ++l) {
+                const assembly::size_type column = num_node_dof * (*(nodes + l / num_node_dof)) + l % num_node_dof;
+
+                BOOST_TEST(*(offsets + num_element_dof * k + l) == jacobian.findEntry(row, column));
+            }
+        }
+    }
+
+    auto kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end, auto jacobian_begin,
+                      auto jacobian_end) {
+        for (auto r = residual_begin; r != residual_end; ++r) {
+            *r += (e + 1.) * (1. + 0.01 * (r - residual_begin));
+        }
+
+        for (auto j = jacobian_begin; j != jacobian_end; ++j) {
+            *j += (e + 1.) + 0.001 * (j - jacobian_begin);
+        }
+    };
+
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        for (auto r = residual_begin; r != residual_end; ++r) {
+            *r += (e + 1.) * (1. + 0.01 * (r - residual_begin));
+        }
+    };
+
+    std::vector<floatType> answer_residual(numbering.getNumDOF());
+
+    auto answer_jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, kernel, std::begin(answer_residual),
+                                          std::end(answer_residual), answer_jacobian);
+
+    std::vector<floatType> residual(numbering.getNumDOF(), 1.), residual_only(numbering.getNumDOF(), 1.);
+
+    assembly::assembleResidualAndJacobian(scatter_map, kernel, std::begin(residual), std::end(residual), jacobian);
+
+    assembly::assembleResidual(scatter_map, residual_kernel, std::begin(residual_only), std::end(residual_only));
+
+    BOOST_TEST(residual == answer_residual, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(residual_only == answer_residual, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(jacobian.getValues() == answer_jacobian.getValues(), CHECK_PER_ELEMENT);
+
+    // The map may not be used with a Jacobian of a different mesh
+    std::vector<floatType> other_coordinates;
+
+    assembly::MeshConnectivity other_connectivity =
+        assembly::generateHexBlock<QuadraticHex>(1, 1, 1, 1., 1., 1., other_coordinates);
+
+    auto other_jacobian = assembly::buildCSRMatrix<floatType>(
+        other_connectivity, assembly::DofNumbering(other_connectivity.getNumNodes(), 3, 1, 1));
+
+    std::vector<floatType> element_jacobian(num_element_dof * num_element_dof);
+
+    BOOST_CHECK_THROW(assembly::scatterElementJacobian(scatter_map, 0, std::cbegin(element_jacobian),
+                                                       std::cend(element_jacobian), other_jacobian),
+                      std::exception);
+
+    BOOST_CHECK_THROW(assembly::scatterElementJacobian(scatter_map, 2, std::cbegin(element_jacobian),
+                                                       std::cend(element_jacobian), jacobian),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeElementBalanceOfLinearMomentum, *boost::unit_test::tolerance(1e-5)) {
+    /*!
+     * Test the assembly of the balance of linear momentum on a block of linear hex elements. The assembled CSR
+     * Jacobian is compared to a finite difference of the assembled residual where the rates of the degrees of freedom
+     * follow from a backward difference in time.
+     */
+
+    static constexpr unsigned int dim = 3, nphases = 2, nadd = 1, node_count = 8;
+
+    using model_type = LinearMomentumModel<dim, nphases, nadd>;
+
+    static constexpr unsigned int num_dof = model_type::num_dof;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, nadd);
+
+    const unsigned int num_global_dof = numbering.getNumDOF();
+
+    std::vector<floatType> dof(num_global_dof), dof_previous(num_global_dof), dof_dot_previous(num_global_dof);
+
+    for (unsigned int i = 0; i < num_global_dof; ++i) {
+        dof[i]              = 0.5 + 0.3 * std::sin(1.7 * i + 0.1);
+        dof_previous[i]     = 0.5 + 0.3 * std::sin(1.7 * i + 0.2);
+        dof_dot_previous[i] = 0.1 * std::cos(0.9 * i);
+    }
+
+    const floatType dt = 0.1;
+
+    model_type model;
+
+    auto element_data = [&](const assembly::size_type e, const std::vector<floatType> &global_dof,
+                            std::array<floatType, node_count * dim> &x, std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot,
+                            std::array<floatType, node_count * num_dof> &u_ddot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(x) + dim * a);
+        }
+
+        std::array<floatType, node_count * num_dof> u_previous, u_dot_previous;
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(global_dof), std::cend(global_dof),
+                                std::begin(u), std::end(u));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_previous), std::cend(dof_previous),
+                                std::begin(u_previous), std::end(u_previous));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_dot_previous), std::cend(dof_dot_previous),
+                                std::begin(u_dot_previous), std::end(u_dot_previous));
+
+        for (unsigned int i = 0; i < node_count * num_dof; ++i) {
+            u_dot[i]  = (u[i] - u_previous[i]) / dt;
+            u_ddot[i] = (u_dot[i] - u_dot_previous[i]) / dt;
+        }
+    };
+
+    // The degrees of freedom the residual kernel is evaluated at
+    const std::vector<floatType> *evaluation_dof = &dof;
+
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot, u_ddot;
+
+        element_data(e, *evaluation_dof, x, u, u_dot, u_ddot);
+
+        LinearHex element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, model_type::material_response_size,
+                                                        nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_ddot), std::cend(u_ddot), model, residual_begin, residual_end);
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot, u_ddot;
+
+        element_data(e, dof, x, u, u_dot, u_ddot);
+
+        LinearHex element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, model_type::material_response_size,
+                                                        nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_ddot), std::cend(u_ddot), 1 / dt, 1 / (dt * dt), model, residual_begin, residual_end,
+            jacobian_begin, jacobian_end);
+    };
+
+    std::vector<floatType> residual(num_global_dof), residual_only(num_global_dof);
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, jacobian_kernel, std::begin(residual),
+                                          std::end(residual), jacobian);
+
+    assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_only),
+                               std::end(residual_only));
+
+    BOOST_TEST(residual == residual_only, CHECK_PER_ELEMENT);
+
+    // Only the rows of the velocity field are non-zero
+    for (unsigned int node = 0; node < connectivity.getNumNodes(); ++node) {
+        for (unsigned int i = 0; i < num_dof; ++i) {
+            const bool is_velocity = (i >= numbering.getFieldOffset(assembly::VELOCITY)) &&
+                                     (i < numbering.getFieldOffset(assembly::TEMPERATURE));
+
+            if (!is_velocity) {
+                BOOST_TEST(residual[num_dof * node + i] == 0.);
+            }
+        }
+    }
+
+    // Compare the Jacobian to a finite difference of the residual
+    std::vector<floatType> dense(num_global_dof * num_global_dof, 0);
+
+    for (unsigned int row = 0; row < num_global_dof; ++row) {
+        for (unsigned int k = jacobian.getRowOffsets()[row]; k < jacobian.getRowOffsets()[row + 1]; ++k) {
+            dense[num_global_dof * row + jacobian.getColumnIndices()[k]] = jacobian.getValues()[k];
+        }
+    }
+
+    std::vector<floatType> residual_p(num_global_dof), residual_m(num_global_dof);
+
+    const floatType eps = 1e-6;
+
+    for (unsigned int j = 0; j < num_global_dof; ++j) {
+        std::vector<floatType> dof_p = dof, dof_m = dof;
+
+        dof_p[j] += eps;
+        dof_m[j] -= eps;
+
+        evaluation_dof = &dof_p;
+
+        assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_p),
+                                   std::end(residual_p));
+
+        evaluation_dof = &dof_m;
+
+        assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_m),
+                                   std::end(residual_m));
+
+        for (unsigned int i = 0; i < num_global_dof; ++i) {
+            const floatType finite_difference = (residual_p[i] - residual_m[i]) / (2 * eps);
+
+            BOOST_TEST(dense[num_global_dof * i + j] + 1 == finite_difference + 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_computeElementBalanceEquations, *boost::unit_test::tolerance(1e-5)) {
+    /*!
+     * Test the assembly of all of the balance equations and constraints on a block of linear hex elements. Every row
+     * of the primary fields is filled and the assembled CSR Jacobian is compared to a finite difference of the
+     * assembled residual where the rates of the degrees of freedom follow from a backward difference in time.
+     */
+
+    static constexpr unsigned int dim = 3, nphases = 2, nadd = 1, node_count = 8;
+
+    using model_type = LinearMixtureModel<dim, nphases, nadd>;
+
+    static constexpr unsigned int num_dof = model_type::num_dof;
+
+    std::vector<floatType> coordinates;
+
+    assembly::MeshConnectivity connectivity = assembly::generateHexBlock<LinearHex>(2, 1, 1, 2., 1., 1., coordinates);
+
+    assembly::DofNumbering numbering(connectivity.getNumNodes(), dim, nphases, nadd);
+
+    const unsigned int num_global_dof = numbering.getNumDOF();
+
+    std::vector<floatType> dof(num_global_dof), dof_previous(num_global_dof), dof_dot_previous(num_global_dof);
+
+    for (unsigned int i = 0; i < num_global_dof; ++i) {
+        dof[i]              = 0.5 + 0.3 * std::sin(1.7 * i + 0.1);
+        dof_previous[i]     = 0.5 + 0.3 * std::sin(1.7 * i + 0.2);
+        dof_dot_previous[i] = 0.1 * std::cos(0.9 * i);
+    }
+
+    const std::array<floatType, nphases> rest_density = {1.3, 0.9};
+
+    const floatType dt = 0.1;
+
+    model_type model;
+
+    constexpr unsigned int mrs = model_type::material_response_size;
+
+    auto element_data = [&](const assembly::size_type e, const std::vector<floatType> &global_dof,
+                            std::array<floatType, node_count * dim> &x, std::array<floatType, node_count * num_dof> &u,
+                            std::array<floatType, node_count * num_dof> &u_dot,
+                            std::array<floatType, node_count * num_dof> &u_ddot) {
+        for (unsigned int a = 0; a < node_count; ++a) {
+            const assembly::size_type node = *(connectivity.getElementNodesBegin(e) + a);
+
+            std::copy(std::begin(coordinates) + dim * node, std::begin(coordinates) + dim * (node + 1),
+                      std::begin(x) + dim * a);
+        }
+
+        std::array<floatType, node_count * num_dof> u_previous, u_dot_previous;
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(global_dof), std::cend(global_dof),
+                                std::begin(u), std::end(u));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_previous), std::cend(dof_previous),
+                                std::begin(u_previous), std::end(u_previous));
+
+        assembly::gatherElement(connectivity, numbering, e, std::cbegin(dof_dot_previous), std::cend(dof_dot_previous),
+                                std::begin(u_dot_previous), std::end(u_dot_previous));
+
+        for (unsigned int i = 0; i < node_count * num_dof; ++i) {
+            u_dot[i]  = (u[i] - u_previous[i]) / dt;
+            u_ddot[i] = (u_dot[i] - u_dot_previous[i]) / dt;
+        }
+    };
+
+    // The degrees of freedom the residual kernel is evaluated at
+    const std::vector<floatType> *evaluation_dof = &dof;
+
+    auto residual_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot, u_ddot;
+
+        element_data(e, *evaluation_dof, x, u, u_dot, u_ddot);
+
+        LinearHex element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        assembly::computeElementBalanceOfMass<dim, dim, 15, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            model, residual_begin, residual_end);
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_ddot), std::cend(u_ddot), model, residual_begin, residual_end);
+
+        assembly::computeElementBalanceOfEnergy<dim, false, dim, 3, 17, 18, 12, 21, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            model, residual_begin, residual_end);
+
+        assembly::computeElementBalanceOfVolumeFraction<dim, dim, 15, 16, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(rest_density), std::cend(rest_density), model, residual_begin, residual_end);
+
+        assembly::computeElementInternalEnergyConstraint<dim, dim, 22, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            model, residual_begin, residual_end);
+
+        assembly::computeElementDisplacementConstraint<dim, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u_dot), std::cend(u_dot), residual_begin,
+            residual_end);
+    };
+
+    auto jacobian_kernel = [&](const assembly::size_type e, auto residual_begin, auto residual_end,
+                               auto jacobian_begin, auto jacobian_end) {
+        std::array<floatType, node_count * dim>     x;
+        std::array<floatType, node_count * num_dof> u, u_dot, u_ddot;
+
+        element_data(e, dof, x, u, u_dot, u_ddot);
+
+        LinearHex element(std::cbegin(x), std::cend(x), std::cbegin(x), std::cend(x));
+
+        assembly::computeElementBalanceOfMass<dim, dim, 15, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, residual_begin, residual_end, jacobian_begin, jacobian_end);
+
+        assembly::computeElementBalanceOfLinearMomentum<dim, dim, 0, 3, 12, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(u_ddot), std::cend(u_ddot), 1 / dt, 1 / (dt * dt), model, residual_begin, residual_end,
+            jacobian_begin, jacobian_end);
+
+        assembly::computeElementBalanceOfEnergy<dim, false, dim, 3, 17, 18, 12, 21, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, residual_begin, residual_end, jacobian_begin, jacobian_end);
+
+        assembly::computeElementBalanceOfVolumeFraction<dim, dim, 15, 16, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            std::cbegin(rest_density), std::cend(rest_density), 1 / dt, model, residual_begin, residual_end,
+            jacobian_begin, jacobian_end);
+
+        assembly::computeElementInternalEnergyConstraint<dim, dim, 22, mrs, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u), std::cend(u), std::cbegin(u_dot), std::cend(u_dot),
+            1 / dt, model, residual_begin, residual_end, jacobian_begin, jacobian_end);
+
+        assembly::computeElementDisplacementConstraint<dim, nphases, nadd>(
+            element, std::cbegin(x), std::cend(x), std::cbegin(u_dot), std::cend(u_dot), 1 / dt, residual_begin,
+            residual_end, jacobian_begin, jacobian_end);
+    };
+
+    std::vector<floatType> residual(num_global_dof), residual_only(num_global_dof);
+
+    auto jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    assembly::assembleResidualAndJacobian(connectivity, numbering, jacobian_kernel, std::begin(residual),
+                                          std::end(residual), jacobian);
+
+    assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_only),
+                               std::end(residual_only));
+
+    BOOST_TEST(residual == residual_only, CHECK_PER_ELEMENT);
+
+    std::vector<floatType> dense(num_global_dof * num_global_dof, 0);
+
+    for (unsigned int row = 0; row < num_global_dof; ++row) {
+        for (unsigned int k = jacobian.getRowOffsets()[row]; k < jacobian.getRowOffsets()[row + 1]; ++k) {
+            dense[num_global_dof * row + jacobian.getColumnIndices()[k]] = jacobian.getValues()[k];
+        }
+    }
+
+    // Every row of the primary fields has an equation and only the rows of the additional dof are empty
+    for (unsigned int node = 0; node < connectivity.getNumNodes(); ++node) {
+        for (unsigned int i = 0; i < num_dof; ++i) {
+            const unsigned int row = num_dof * node + i;
+
+            floatType row_norm = 0;
+
+            for (unsigned int j = 0; j < num_global_dof; ++j) {
+                row_norm += std::fabs(dense[num_global_dof * row + j]);
+            }
+
+            if (i < numbering.getFieldOffset(assembly::ADDITIONAL_DOF)) {
+                BOOST_TEST(row_norm > 0.);
+            } else {
+                BOOST_TEST(residual[row] == 0.);
+
+                BOOST_TEST(row_norm == 0.);
+            }
+        }
+    }
+
+    // Compare the Jacobian to a finite difference of the residual
+    std::vector<floatType> residual_p(num_global_dof), residual_m(num_global_dof);
+
+    const floatType eps = 1e-6;
+
+    for (unsigned int j = 0; j < num_global_dof; ++j) {
+        std::vector<floatType> dof_p = dof, dof_m = dof;
+
+        dof_p[j] += eps;
+        dof_m[j] -= eps;
+
+        evaluation_dof = &dof_p;
+
+        assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_p),
+                                   std::end(residual_p));
+
+        evaluation_dof = &dof_m;
+
+        assembly::assembleResidual(connectivity, numbering, residual_kernel, std::begin(residual_m),
+                                   std::end(residual_m));
+
+        for (unsigned int i = 0; i < num_global_dof; ++i) {
+            const floatType finite_difference = (residual_p[i] - residual_m[i]) / (2 * eps);
+
+            BOOST_TEST(dense[num_global_dof * i + j] + 1 == finite_difference + 1);
+        }
+    }
+}
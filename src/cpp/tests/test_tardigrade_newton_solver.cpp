@@ -0,0 +1,296 @@
+/**
+ * \file test_tardigrade_newton_solver.cpp
+ *
+ * Tests for tardigrade_newton_solver
+ */
+
+#include <tardigrade_newton_solver.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_newton_solver
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace newton = tardigradeBalanceEquations::newtonSolver;
+
+/*!
+ * Build a tridiagonal CSR matrix
+ *
+ * \param n: The number of rows
+ */
+assembly::CSRMatrix<floatType> buildTridiagonal(const assembly::size_type n) {
+    std::vector<assembly::size_type> row_offsets(1, 0), column_indices;
+
+    for (assembly::size_type i = 0; i < n; ++i) {
+        for (assembly::size_type j = (i > 0) ? i - 1 : 0; j < std::min(i + 2, n); ++j) {
+            column_indices.push_back(j);
+        }
+
+        row_offsets.push_back(column_indices.size());
+    }
+
+    return assembly::CSRMatrix<floatType>(n, n, std::cbegin(row_offsets), std::cend(row_offsets),
+                                          std::cbegin(column_indices), std::cend(column_indices));
+}
+
+/*!
+ * The nonlinear system \f$ R_i = \arctan( u_i - c_i ) + k ( 2 u_i - u_{i-1} - u_{i+1} ) \f$ with
+ * \f$ u_{-1} = u_{n} = 0 \f$. Newton's method without a line search diverges from starting points far from the
+ * solution when k is small.
+ */
+struct ArctanProblem {
+    floatType k = 0.01;  //!< The coupling between neighboring degrees of freedom
+
+    /*!
+     * The offset of the degree of freedom i
+     *
+     * \param i: The degree of freedom
+     */
+    static floatType c(const assembly::size_type i) { return 0.1 * i - 0.2; }
+
+    /*!
+     * Evaluate the residual
+     *
+     * \param dof_begin: The starting iterator of the degrees of freedom
+     * \param dof_end: The stopping iterator of the degrees of freedom
+     * \param residual_begin: The starting iterator of the residual
+     * \param residual_end: The stopping iterator of the residual
+     */
+    template <class dof_iter, class residual_iter>
+    void operator()(const dof_iter &dof_begin, const dof_iter &dof_end, residual_iter residual_begin,
+                    residual_iter residual_end) const {
+        const assembly::size_type n = (assembly::size_type)(dof_end - dof_begin);
+
+        BOOST_TEST((assembly::size_type)(residual_end - residual_begin) == n);
+
+        for (assembly::size_type i = 0; i < n; ++i) {
+            const floatType left  = (i > 0) ? *(dof_begin + i - 1) : 0.;
+            const floatType right = (i + 1 < n) ? *(dof_begin + i + 1) : 0.;
+
+            *(residual_begin + i) = std::atan(*(dof_begin + i) - c(i)) + k * (2 * (*(dof_begin + i)) - left - right);
+        }
+    }
+
+    /*!
+     * Evaluate the residual and the Jacobian
+     *
+     * \param dof_begin: The starting iterator of the degrees of freedom
+     * \param dof_end: The stopping iterator of the degrees of freedom
+     * \param residual_begin: The starting iterator of the residual
+     * \param residual_end: The stopping iterator of the residual
+     * \param &jacobian: The tridiagonal Jacobian
+     */
+    template <class dof_iter, class residual_iter>
+    void operator()(const dof_iter &dof_begin, const dof_iter &dof_end, residual_iter residual_begin,
+                    residual_iter residual_end, assembly::CSRMatrix<floatType> &jacobian) const {
+        const assembly::size_type n = (assembly::size_type)(dof_end - dof_begin);
+
+        (*this)(dof_begin, dof_end, residual_begin, residual_end);
+
+        jacobian.setZero();
+
+        for (assembly::size_type i = 0; i < n; ++i) {
+            const floatType x = *(dof_begin + i) - c(i);
+
+            jacobian.addValue(i, i, 1 / (1 + x * x) + 2 * k);
+
+            if (i > 0) {
+                jacobian.addValue(i, i - 1, -k);
+            }
+
+            if (i + 1 < n) {
+                jacobian.addValue(i, i + 1, -k);
+            }
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_SparseLUSolver, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the direct solver including the reuse of the analyzed pattern for new values
+     */
+
+    assembly::CSRMatrix<floatType> A = buildTridiagonal(3);
+
+    // [ 4 1 0 ]
+    // [ 2 5 1 ]
+    // [ 0 3 6 ]
+    A.getValues() = {4, 1, 2, 5, 1, 3, 6};
+
+    newton::SparseLUSolver<floatType> solver;
+
+    solver.compute(A);
+
+    std::vector<floatType> b = {6, 15, 24}, x(3);
+
+    std::vector<floatType> answer = {1, 2, 3};
+
+    solver.solve(std::cbegin(b), std::cend(b), std::begin(x), std::end(x));
+
+    BOOST_TEST(x == answer, CHECK_PER_ELEMENT);
+
+    A.getValues() = {2, 0, 0, 3, 0, 0, 4};
+
+    solver.compute(A);
+
+    answer = {3, 5, 6};
+
+    solver.solve(std::cbegin(b), std::cend(b), std::begin(x), std::end(x));
+
+    BOOST_TEST(x == answer, CHECK_PER_ELEMENT);
+
+    // A new pattern with the same number of stored entries is analyzed again
+    std::vector<assembly::size_type> upper_offsets = {0, 2, 3}, upper_columns = {0, 1, 1};
+
+    std::vector<assembly::size_type> lower_offsets = {0, 1, 3}, lower_columns = {0, 0, 1};
+
+    assembly::CSRMatrix<floatType> upper(2, 2, std::cbegin(upper_offsets), std::cend(upper_offsets),
+                                         std::cbegin(upper_columns), std::cend(upper_columns));
+
+    assembly::CSRMatrix<floatType> lower(2, 2, std::cbegin(lower_offsets), std::cend(lower_offsets),
+                                         std::cbegin(lower_columns), std::cend(lower_columns));
+
+    // [ 2 1 ]
+    // [ 0 3 ]
+    upper.getValues() = {2, 1, 3};
+
+    // [ 2 0 ]
+    // [ 1 3 ]
+    lower.getValues() = {2, 1, 3};
+
+    std::vector<floatType> small_b = {2, 4}, small_x(2);
+
+    solver.compute(upper);
+
+    solver.compute(lower);
+
+    solver.solve(std::cbegin(small_b), std::cend(small_b), std::begin(small_x), std::end(small_x));
+
+    answer = {1, 1};
+
+    BOOST_TEST(small_x == answer, CHECK_PER_ELEMENT);
+
+    A.getValues() = {0, 0, 0, 0, 0, 0, 0};
+
+    BOOST_CHECK_THROW(solver.compute(A), std::exception);
+
+    std::vector<floatType> short_b = {1, 2};
+
+    BOOST_CHECK_THROW(solver.solve(std::cbegin(short_b), std::cend(short_b), std::begin(x), std::end(x)),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_solve, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test full Newton, modified Newton, and the line search
+     */
+
+    constexpr assembly::size_type n = 10;
+
+    ArctanProblem problem;
+
+    assembly::CSRMatrix<floatType> jacobian = buildTridiagonal(n);
+
+    newton::SparseLUSolver<floatType> solver;
+
+    std::vector<floatType> residual(n);
+
+    // Full Newton from a nearby starting point
+    std::vector<floatType> full_dof(n, 0.);
+
+    newton::NewtonOptions options;
+
+    options.absolute_tolerance = 1e-12;
+
+    newton::NewtonStatistics full =
+        newton::solve(problem, problem, jacobian, solver, std::begin(full_dof), std::end(full_dof), options);
+
+    BOOST_TEST(full.converged);
+
+    BOOST_TEST(full.iterations <= 6);
+
+    BOOST_TEST(full.jacobian_evaluations == full.iterations);
+
+    BOOST_TEST(full.residual_evaluations == full.iterations + 1);
+
+    BOOST_TEST(full.residual_norms.size() == full.iterations + 1);
+
+    BOOST_TEST(full.residual_norms.back() <= 1e-12);
+
+    BOOST_TEST(full.line_search_backtracks == 0);
+
+    BOOST_TEST(full.residual_time >= 0);
+
+    BOOST_TEST(full.jacobian_time >= 0);
+
+    BOOST_TEST(full.setup_time >= 0);
+
+    BOOST_TEST(full.solve_time >= 0);
+
+    problem(std::cbegin(full_dof), std::cend(full_dof), std::begin(residual), std::end(residual));
+
+    BOOST_TEST(residual == std::vector<floatType>(n, 0.), CHECK_PER_ELEMENT);
+
+    // Modified Newton reuses the Jacobian
+    std::vector<floatType> modified_dof(n, 0.);
+
+    options.max_jacobian_age = 10;
+
+    options.max_contraction = 0.9;
+
+    newton::NewtonStatistics modified =
+        newton::solve(problem, problem, jacobian, solver, std::begin(modified_dof), std::end(modified_dof), options);
+
+    BOOST_TEST(modified.converged);
+
+    BOOST_TEST(modified.jacobian_evaluations < modified.iterations);
+
+    BOOST_TEST(modified.jacobian_evaluations < full.jacobian_evaluations);
+
+    BOOST_TEST(modified_dof == full_dof, CHECK_PER_ELEMENT);
+
+    // Full Newton diverges from a distant starting point without the line search
+    options.max_jacobian_age = 1;
+
+    std::vector<floatType> distant_dof(n, 10.);
+
+    newton::NewtonStatistics diverged =
+        newton::solve(problem, problem, jacobian, solver, std::begin(distant_dof), std::end(distant_dof), options);
+
+    BOOST_TEST(!diverged.converged);
+
+    std::fill(std::begin(distant_dof), std::end(distant_dof), 10.);
+
+    options.line_search = true;
+
+    newton::NewtonStatistics damped =
+        newton::solve(problem, problem, jacobian, solver, std::begin(distant_dof), std::end(distant_dof), options);
+
+    BOOST_TEST(damped.converged);
+
+    BOOST_TEST(damped.line_search_backtracks > 0);
+
+    BOOST_TEST(damped.residual_evaluations == damped.iterations + damped.line_search_backtracks + 1);
+
+    BOOST_TEST(distant_dof == full_dof, CHECK_PER_ELEMENT);
+
+    // Exceptions of the residual are passed to the caller
+    auto failing_residual = [](auto, auto, auto, auto) { throw std::runtime_error("failing residual"); };
+
+    BOOST_CHECK_THROW(newton::solve(failing_residual, problem, jacobian, solver, std::begin(full_dof),
+                                    std::end(full_dof), options),
+                      std::exception);
+}
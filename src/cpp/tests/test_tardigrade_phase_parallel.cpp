@@ -0,0 +1,283 @@
+/**
+ * \file test_tardigrade_phase_parallel.cpp
+ *
+ * Tests for tardigrade_phase_parallel
+ */
+
+#include <tardigrade_phase_parallel.h>
+
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#define BOOST_TEST_MODULE test_tardigrade_phase_parallel
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+namespace phaseParallel = tardigradeBalanceEquations::phaseParallel;
+
+BOOST_AUTO_TEST_CASE(test_forEachPhase, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that every phase is evaluated exactly once without a pool and for any number of threads of a pool
+     */
+
+    constexpr unsigned int nphases = 7;
+
+    std::array<floatType, nphases> answer;
+
+    for (unsigned int phase = 0; phase < nphases; ++phase) {
+        answer[phase] = 1.5 * phase + 0.1;
+    }
+
+    auto check = [&](tardigradeBalanceEquations::threadPool::ThreadPool *pool, const unsigned int min_threaded_phases) {
+        std::array<floatType, nphases>    result{};
+        std::array<unsigned int, nphases> counts{};
+
+        phaseParallel::forEachPhase(
+            nphases, pool,
+            [&](const unsigned int phase) {
+                result[phase] += 1.5 * phase + 0.1;
+                counts[phase] += 1;
+            },
+            min_threaded_phases);
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+        for (unsigned int phase = 0; phase < nphases; ++phase) {
+            BOOST_TEST(counts[phase] == 1);
+        }
+    };
+
+    check(nullptr, phaseParallel::default_min_threaded_phases);
+
+    for (unsigned int num_threads = 1; num_threads <= nphases + 2; ++num_threads) {
+        tardigradeBalanceEquations::threadPool::ThreadPool pool(num_threads);
+
+        check(&pool, 1);
+
+        check(&pool, nphases + 1);
+
+        // The phases may be distributed from within a loop of the same pool e.g., over the elements
+        pool.parallelFor(3, 1, [&](const unsigned int, const tardigradeBalanceEquations::threadPool::size_type) {
+            std::array<unsigned int, nphases> counts{};
+
+            phaseParallel::forEachPhase(nphases, &pool, [&](const unsigned int phase) { counts[phase] += 1; });
+
+            for (unsigned int phase = 0; phase < nphases; ++phase) {
+                BOOST_TEST(counts[phase] == 1);
+            }
+        });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_forEachPhase_exception, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that an error in one of the phases is passed back to the calling thread
+     */
+
+    constexpr unsigned int nphases = 6;
+
+    auto function = [](const unsigned int phase) {
+        if (phase == 3) {
+            throw std::runtime_error("phase 3 failed");
+        }
+    };
+
+    tardigradeBalanceEquations::threadPool::ThreadPool pool(4);
+
+    BOOST_CHECK_THROW(phaseParallel::forEachPhase(nphases, nullptr, function), std::runtime_error);
+
+    BOOST_CHECK_THROW(phaseParallel::forEachPhase(nphases, &pool, function), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfMass_phaseThreaded, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that distributing the phases of the multiphase balance of mass over a thread pool gives the same Jacobians
+     */
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 5;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 17;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, nphases>                                                density, density_dot;
+    std::array<floatType, nphases * dim>                                          density_gradient, velocity;
+    std::array<floatType, nphases * dim * dim>                                    velocity_gradient;
+    std::array<floatType, nphases * material_response_size>                       material_response;
+    std::array<floatType, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                          dof_gradient;
+    std::array<floatType, dim>                                                    interp_gradient;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(density_gradient, 0.4);
+    fill(velocity, 0.5);
+    fill(velocity_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(material_response_jacobian, 0.9);
+    fill(dof_gradient, 1.0);
+    fill(interp_gradient, 1.2);
+
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dUDotdU = 2.1;
+
+    std::array<floatType, nphases>                      result, result_threaded;
+    std::array<floatType, nphases * nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+    std::array<floatType, nphases * nphases>            dRdRho_threaded, dRdTheta_threaded, dRdE_threaded;
+    std::array<floatType, nphases * nphases>            dRdVF_threaded;
+    std::array<floatType, nphases * nphases * dim>      dRdU, dRdW, dRdU_threaded, dRdW_threaded;
+    std::array<floatType, nphases * num_additional_dof> dRdZ, dRdZ_threaded;
+    std::array<floatType, nphases * dim>                dRdUMesh, dRdUMesh_threaded;
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, dim, 10, material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::cbegin(material_response),
+        std::cend(material_response), std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+        test_function, interp, std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient),
+        std::cend(dof_gradient), dRhoDotdRho, dUDotdU, std::begin(result), std::end(result), std::begin(dRdRho),
+        std::end(dRdRho), std::begin(dRdU), std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta),
+        std::end(dRdTheta), std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ),
+        std::end(dRdZ), std::begin(dRdUMesh), std::end(dRdUMesh));
+
+    tardigradeBalanceEquations::threadPool::ThreadPool pool(3);
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, dim, 10, material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(velocity), std::cend(velocity),
+        std::cbegin(velocity_gradient), std::cend(velocity_gradient), std::cbegin(material_response),
+        std::cend(material_response), std::cbegin(material_response_jacobian), std::cend(material_response_jacobian),
+        test_function, interp, std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient),
+        std::cend(dof_gradient), dRhoDotdRho, dUDotdU, std::begin(result_threaded), std::end(result_threaded),
+        std::begin(dRdRho_threaded), std::end(dRdRho_threaded), std::begin(dRdU_threaded), std::end(dRdU_threaded),
+        std::begin(dRdW_threaded), std::end(dRdW_threaded), std::begin(dRdTheta_threaded), std::end(dRdTheta_threaded),
+        std::begin(dRdE_threaded), std::end(dRdE_threaded), std::begin(dRdVF_threaded), std::end(dRdVF_threaded),
+        std::begin(dRdZ_threaded), std::end(dRdZ_threaded), std::begin(dRdUMesh_threaded), std::end(dRdUMesh_threaded),
+        &pool);
+
+    BOOST_TEST(result_threaded == result, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdRho_threaded == dRdRho, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdU_threaded == dRdU, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdW_threaded == dRdW, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdTheta_threaded == dRdTheta, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdE_threaded == dRdE, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdVF_threaded == dRdVF, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdZ_threaded == dRdZ, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdUMesh_threaded == dRdUMesh, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergy_phaseThreaded, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that distributing the phases of the multiphase balance of energy over a thread pool gives the same Jacobians
+     */
+
+    constexpr unsigned int dim                       = 3;
+    constexpr unsigned int nphases                   = 5;
+    constexpr unsigned int num_additional_dof        = 2;
+    constexpr unsigned int material_response_num_dof = 10 + num_additional_dof;
+    constexpr unsigned int num_dof                   = nphases * 10 + num_additional_dof;
+    constexpr unsigned int material_response_size    = 17;
+
+    auto fill = [](auto &v, const floatType offset) {
+        for (unsigned int i = 0; i < v.size(); ++i) {
+            v[i] = std::sin(1.3 * i + offset);
+        }
+    };
+
+    std::array<floatType, nphases>                                                density, density_dot, vf;
+    std::array<floatType, nphases>                                                internal_energy, internal_energy_dot;
+    std::array<floatType, nphases * dim>                                          density_gradient, v;
+    std::array<floatType, nphases * dim>                                          internal_energy_gradient;
+    std::array<floatType, nphases * dim * dim>                                    v_gradient;
+    std::array<floatType, nphases * material_response_size>                       material_response;
+    std::array<floatType, nphases * material_response_size * num_dof * (1 + dim)> material_response_jacobian;
+    std::array<floatType, num_dof * dim>                                          dof_gradient;
+    std::array<floatType, dim>                                                    test_function_gradient;
+    std::array<floatType, dim>                                                    interp_gradient;
+
+    fill(density, 0.1);
+    fill(density_dot, 0.2);
+    fill(internal_energy, 0.25);
+    fill(internal_energy_dot, 0.35);
+    fill(vf, 0.3);
+    fill(density_gradient, 0.4);
+    fill(internal_energy_gradient, 0.45);
+    fill(v, 0.5);
+    fill(v_gradient, 0.7);
+    fill(material_response, 0.8);
+    fill(material_response_jacobian, 0.9);
+    fill(dof_gradient, 1.0);
+    fill(test_function_gradient, 1.1);
+    fill(interp_gradient, 1.2);
+
+    const floatType test_function = 0.34, interp = 0.71;
+    const floatType dRhoDotdRho = 1.3, dEDotdE = 1.7, dUDotdU = 2.1;
+
+    std::array<floatType, nphases>                      result, result_threaded;
+    std::array<floatType, nphases * nphases>            dRdRho, dRdTheta, dRdE, dRdVF;
+    std::array<floatType, nphases * nphases>            dRdRho_threaded, dRdTheta_threaded, dRdE_threaded;
+    std::array<floatType, nphases * nphases>            dRdVF_threaded;
+    std::array<floatType, nphases * nphases * dim>      dRdU, dRdW, dRdU_threaded, dRdW_threaded;
+    std::array<floatType, nphases * num_additional_dof> dRdZ, dRdZ_threaded;
+    std::array<floatType, nphases * dim>                dRdUMesh, dRdUMesh_threaded;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 9, 10, 13, 16,
+                                                                        material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(material_response), std::cend(material_response),
+        std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), std::cbegin(vf),
+        std::cend(vf), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient), interp,
+        std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient),
+        dRhoDotdRho, dEDotdE, dUDotdU, std::begin(result), std::end(result), std::begin(dRdRho), std::end(dRdRho),
+        std::begin(dRdU), std::end(dRdU), std::begin(dRdW), std::end(dRdW), std::begin(dRdTheta), std::end(dRdTheta),
+        std::begin(dRdE), std::end(dRdE), std::begin(dRdVF), std::end(dRdVF), std::begin(dRdZ), std::end(dRdZ),
+        std::begin(dRdUMesh), std::end(dRdUMesh));
+
+    tardigradeBalanceEquations::threadPool::ThreadPool pool(3);
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 9, 10, 13, 16,
+                                                                        material_response_num_dof>(
+        std::cbegin(density), std::cend(density), std::cbegin(density_dot), std::cend(density_dot),
+        std::cbegin(density_gradient), std::cend(density_gradient), std::cbegin(internal_energy),
+        std::cend(internal_energy), std::cbegin(internal_energy_dot), std::cend(internal_energy_dot),
+        std::cbegin(internal_energy_gradient), std::cend(internal_energy_gradient), std::cbegin(v), std::cend(v),
+        std::cbegin(v_gradient), std::cend(v_gradient), std::cbegin(material_response), std::cend(material_response),
+        std::cbegin(material_response_jacobian), std::cend(material_response_jacobian), std::cbegin(vf),
+        std::cend(vf), test_function, std::cbegin(test_function_gradient), std::cend(test_function_gradient), interp,
+        std::cbegin(interp_gradient), std::cend(interp_gradient), std::cbegin(dof_gradient), std::cend(dof_gradient),
+        dRhoDotdRho, dEDotdE, dUDotdU, std::begin(result_threaded), std::end(result_threaded),
+        std::begin(dRdRho_threaded), std::end(dRdRho_threaded), std::begin(dRdU_threaded), std::end(dRdU_threaded),
+        std::begin(dRdW_threaded), std::end(dRdW_threaded), std::begin(dRdTheta_threaded), std::end(dRdTheta_threaded),
+        std::begin(dRdE_threaded), std::end(dRdE_threaded), std::begin(dRdVF_threaded), std::end(dRdVF_threaded),
+        std::begin(dRdZ_threaded), std::end(dRdZ_threaded), std::begin(dRdUMesh_threaded), std::end(dRdUMesh_threaded),
+        &pool);
+
+    BOOST_TEST(result_threaded == result, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdRho_threaded == dRdRho, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdU_threaded == dRdU, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdW_threaded == dRdW, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdTheta_threaded == dRdTheta, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdE_threaded == dRdE, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdVF_threaded == dRdVF, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdZ_threaded == dRdZ, CHECK_PER_ELEMENT);
+    BOOST_TEST(dRdUMesh_threaded == dRdUMesh, CHECK_PER_ELEMENT);
+}
@@ -0,0 +1,184 @@
+/**
+ * \file test_tardigrade_point_state_store.cpp
+ *
+ * Tests for tardigrade_point_state_store
+ */
+
+#include <tardigrade_point_state_store.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_point_state_store
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+typedef std::vector<floatType> floatVector;  //!< Define a vector of floats
+
+namespace state = tardigradeBalanceEquations::pointStateStore;
+
+/*!
+ * Fill the current state of a store with values which depend on the field, component, and point
+ *
+ * \param &store: The store
+ * \param offset: The offset of the values
+ */
+void fillCurrent(state::PointStateStore<floatType> &store, const floatType offset) {
+    for (unsigned int field = 0; field < store.getNumFields(); ++field) {
+        for (unsigned int c = 0; c < store.getFieldSize(field); ++c) {
+            for (unsigned int e = 0; e < store.getNumElements(); ++e) {
+                for (unsigned int qp = 0; qp < store.getPointsPerElement(); ++qp) {
+                    store.current(field, c, e, qp) = offset + 100 * field + 10 * c + store.getPointIndex(e, qp);
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * Check the state of a store at time n against the values of fillCurrent
+ *
+ * \param &store: The store
+ * \param offset: The offset of the values
+ */
+bool checkPrevious(const state::PointStateStore<floatType> &store, const floatType offset) {
+    for (unsigned int field = 0; field < store.getNumFields(); ++field) {
+        for (unsigned int c = 0; c < store.getFieldSize(field); ++c) {
+            for (unsigned int e = 0; e < store.getNumElements(); ++e) {
+                for (unsigned int qp = 0; qp < store.getPointsPerElement(); ++qp) {
+                    if (store.previous(field, c, e, qp) !=
+                        offset + 100 * field + 10 * c + store.getPointIndex(e, qp)) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(test_PointStateStore, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the layout of the store and the swap of the states when a step is accepted
+     */
+
+    state::PointStateStore<floatType> store(5, 3, {4, 1, 2});
+
+    BOOST_TEST(store.getNumPoints() == 15);
+
+    BOOST_TEST(store.getNumFields() == 3);
+
+    BOOST_TEST(!store.isMapped());
+
+    // Each field of 15 points is padded to a multiple of 8 values
+    BOOST_TEST(store.getMemoryBytes() == 2 * (64 + 16 + 32) * sizeof(floatType));
+
+    for (unsigned int field = 0; field < store.getNumFields(); ++field) {
+        BOOST_TEST(((std::uintptr_t)store.getCurrent(field).data()) % state::arena_alignment == 0);
+
+        BOOST_TEST(((std::uintptr_t)store.getPrevious(field).data()) % state::arena_alignment == 0);
+
+        BOOST_TEST(store.getCurrent(field).getNumComponents() == store.getFieldSize(field));
+
+        BOOST_TEST(store.getCurrent(field).getStride() == 15);
+    }
+
+    BOOST_TEST(checkPrevious(store, 0) == false);
+
+    BOOST_TEST(store.previous(0, 3, 4, 2) == 0.);
+
+    fillCurrent(store, 1);
+
+    const floatType *current = store.getCurrent(1).data();
+
+    store.acceptStep();
+
+    BOOST_TEST(store.getPrevious(1).data() == current);
+
+    BOOST_TEST(checkPrevious(store, 1));
+
+    fillCurrent(store, 2);
+
+    store.rejectStep();
+
+    BOOST_TEST(checkPrevious(store, 1));
+
+    BOOST_TEST(store.current(2, 1, 3, 0) == store.previous(2, 1, 3, 0));
+
+    fillCurrent(store, 2);
+
+    store.acceptStep();
+
+    BOOST_TEST(checkPrevious(store, 2));
+
+    // The values of a point are read and written as a whole
+    floatVector values(4), answer = {1., 2., 3., 4.};
+
+    store.setCurrentPoint(0, 2, 1, std::cbegin(answer), std::cend(answer));
+
+    store.acceptStep();
+
+    store.getPreviousPoint(0, 2, 1, std::begin(values), std::end(values));
+
+    BOOST_TEST(values == answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(store.getPrevious(0)(2, store.getPointIndex(2, 1)) == 3.);
+
+    // The previous state of the points of a block of elements is a view of the store
+    tardigradeBalanceEquations::materialProvider::PointArray<const floatType> block =
+        store.getPrevious(0).block(store.getPointIndex(2, 0), 2 * store.getPointsPerElement());
+
+    BOOST_TEST(block(3, 1) == 4.);
+
+    BOOST_CHECK_THROW(store.getPreviousPoint(0, 5, 0, std::begin(values), std::end(values)), std::exception);
+
+    BOOST_CHECK_THROW(store.setCurrentPoint(1, 0, 0, std::cbegin(answer), std::cend(answer)), std::exception);
+
+    BOOST_CHECK_THROW(store.getCurrent(3), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_PointStateStore_mapped, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test a store whose arena is mapped from a file
+     */
+
+#if defined(__unix__) || defined(__APPLE__)
+    const std::string path = "test_tardigrade_point_state_store.arena";
+
+    {
+        state::PointStateStore<floatType> store(7, 8, {3, 5}, path);
+
+        BOOST_TEST(store.isMapped());
+
+        BOOST_TEST(store.getMemoryBytes() == 2 * (168 + 280) * sizeof(floatType));
+
+        BOOST_TEST(store.previous(1, 4, 6, 7) == 0.);
+
+        fillCurrent(store, 3);
+
+        store.acceptStep();
+
+        BOOST_TEST(checkPrevious(store, 3));
+
+        store.sync();
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+        BOOST_TEST((std::size_t)file.tellg() == store.getMemoryBytes());
+    }
+
+    BOOST_TEST(std::remove(path.c_str()) == 0);
+
+    BOOST_CHECK_THROW(state::PointStateStore<floatType>(1, 1, {1}, "missing_directory/arena"), std::exception);
+#endif
+}
@@ -0,0 +1,339 @@
+/**
+ * \file test_tardigrade_span_kernels.cpp
+ *
+ * Tests for tardigrade_span_kernels
+ */
+
+#include <tardigrade_span_kernels.h>
+
+#include <cmath>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_span_kernels
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef double floatType;  //!< Define the float type
+
+typedef std::vector<floatType> floatVector;  //!< Define a vector of floats
+
+namespace span = tardigradeBalanceEquations::spanKernels;
+
+using tardigradeBalanceEquations::fixedSpan::makeFixedSpan;
+
+constexpr unsigned int dim = 3;  //!< The spatial dimension
+
+constexpr unsigned int nphases = 2;  //!< The number of phases
+
+constexpr unsigned int material_response_size = 23;  //!< The number of values of the material response of a phase
+
+constexpr unsigned int num_additional_dof = 1;  //!< The number of additional dof
+
+constexpr unsigned int material_response_num_dof = 4 + 2 * dim + num_additional_dof;  //!< The dof of a phase
+
+constexpr unsigned int num_dof = nphases * (4 + 2 * dim) + num_additional_dof;  //!< The dof of a point
+
+/*!
+ * Fill a vector with values which vary with the index
+ *
+ * \param &v: The vector
+ * \param offset: The offset of the values
+ */
+void fill(floatVector &v, const floatType offset) {
+    for (unsigned int i = 0; i < v.size(); ++i) {
+        v[i] = 0.5 + 0.25 * std::sin(1.3 * i + offset);
+    }
+}
+
+/*!
+ * The inputs of a multiphase point
+ */
+struct PointState {
+    floatVector density = floatVector(nphases);  //!< The densities
+
+    floatVector density_dot = floatVector(nphases);  //!< The density rates
+
+    floatVector density_gradient = floatVector(nphases * dim);  //!< The density gradients
+
+    floatVector internal_energy = floatVector(nphases);  //!< The internal energies
+
+    floatVector internal_energy_dot = floatVector(nphases);  //!< The internal energy rates
+
+    floatVector internal_energy_gradient = floatVector(nphases * dim);  //!< The internal energy gradients
+
+    floatVector velocity = floatVector(nphases * dim);  //!< The velocities
+
+    floatVector velocity_dot = floatVector(nphases * dim);  //!< The velocity rates
+
+    floatVector velocity_gradient = floatVector(nphases * dim * dim);  //!< The velocity gradients
+
+    floatVector material_response = floatVector(nphases * material_response_size);  //!< The material responses
+
+    floatVector material_response_jacobian =
+        floatVector(nphases * material_response_size * num_dof * (1 + dim));  //!< The material response Jacobians
+
+    floatVector volume_fraction = floatVector(nphases);  //!< The volume fractions
+
+    floatVector test_function_gradient = floatVector(dim);  //!< The test function gradient
+
+    floatVector interpolation_function_gradient = floatVector(dim);  //!< The interpolation function gradient
+
+    floatVector dof_gradient = floatVector(num_dof * dim);  //!< The spatial gradient of the dof
+
+    floatType test_function = 0.6, interpolation_function = 0.45;  //!< The test and interpolation functions
+
+    floatType dRhoDotdRho = 1.4, dEDotdE = 1.9, dUDotdU = 2.1, dUDDotdU = 3.7;  //!< The rates
+
+    PointState() {
+        floatType offset = 0;
+        for (auto v : {&density, &density_dot, &density_gradient, &internal_energy, &internal_energy_dot,
+                       &internal_energy_gradient, &velocity, &velocity_dot, &velocity_gradient, &material_response,
+                       &material_response_jacobian, &volume_fraction, &test_function_gradient,
+                       &interpolation_function_gradient, &dof_gradient}) {
+            fill(*v, offset);
+            offset += 0.7;
+        }
+    }
+};
+
+/*!
+ * The outputs of the Jacobian of a balance equation
+ */
+struct Outputs {
+    floatVector result, dRdRho, dRdU, dRdW, dRdTheta, dRdE, dRdVF, dRdZ, dRdUMesh;  //!< The outputs
+
+    /*!
+     * Constructor
+     *
+     * \param rows: The number of residuals
+     */
+    explicit Outputs(const unsigned int rows)
+        : result(rows),
+          dRdRho(rows * nphases),
+          dRdU(rows * nphases * dim),
+          dRdW(rows * nphases * dim),
+          dRdTheta(rows * nphases),
+          dRdE(rows * nphases),
+          dRdVF(rows * nphases),
+          dRdZ(rows * num_additional_dof),
+          dRdUMesh(rows * dim) {}
+
+    //! Get all of the outputs
+    floatVector all() const {
+        floatVector outputs;
+        for (auto v : {&result, &dRdRho, &dRdU, &dRdW, &dRdTheta, &dRdE, &dRdVF, &dRdZ, &dRdUMesh}) {
+            outputs.insert(std::end(outputs), std::begin(*v), std::end(*v));
+        }
+        return outputs;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfMass, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the residuals and Jacobians of the balance of mass on views against the multiphase iterator kernels
+     */
+
+    const PointState s;
+
+    floatVector answer(nphases), result(nphases);
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, 10>(
+        std::begin(s.density), std::end(s.density), std::begin(s.density_dot), std::end(s.density_dot),
+        std::begin(s.density_gradient), std::end(s.density_gradient), std::begin(s.velocity), std::end(s.velocity),
+        std::begin(s.velocity_gradient), std::end(s.velocity_gradient), std::begin(s.material_response),
+        std::end(s.material_response), s.test_function, std::begin(answer), std::end(answer));
+
+    span::computeBalanceOfMass<dim, 10>(
+        makeFixedSpan<nphases>(s.density.data()), makeFixedSpan<nphases>(s.density_dot.data()),
+        makeFixedSpan<nphases, dim>(s.density_gradient.data()), makeFixedSpan<nphases, dim>(s.velocity.data()),
+        makeFixedSpan<nphases, dim, dim>(s.velocity_gradient.data()),
+        makeFixedSpan<nphases, material_response_size>(s.material_response.data()), s.test_function,
+        makeFixedSpan<nphases>(result.data()));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    Outputs jacobian_answer(nphases), jacobian_result(nphases);
+
+    Outputs &a = jacobian_answer;
+
+    tardigradeBalanceEquations::balanceOfMass::computeBalanceOfMass<dim, dim, 10, material_response_num_dof>(
+        std::begin(s.density), std::end(s.density), std::begin(s.density_dot), std::end(s.density_dot),
+        std::begin(s.density_gradient), std::end(s.density_gradient), std::begin(s.velocity), std::end(s.velocity),
+        std::begin(s.velocity_gradient), std::end(s.velocity_gradient), std::begin(s.material_response),
+        std::end(s.material_response), std::begin(s.material_response_jacobian), std::end(s.material_response_jacobian),
+        s.test_function, s.interpolation_function, std::begin(s.interpolation_function_gradient),
+        std::end(s.interpolation_function_gradient), std::begin(s.dof_gradient), std::end(s.dof_gradient),
+        s.dRhoDotdRho, s.dUDotdU, std::begin(a.result), std::end(a.result), std::begin(a.dRdRho), std::end(a.dRdRho),
+        std::begin(a.dRdU), std::end(a.dRdU), std::begin(a.dRdW), std::end(a.dRdW), std::begin(a.dRdTheta),
+        std::end(a.dRdTheta), std::begin(a.dRdE), std::end(a.dRdE), std::begin(a.dRdVF), std::end(a.dRdVF),
+        std::begin(a.dRdZ), std::end(a.dRdZ), std::begin(a.dRdUMesh), std::end(a.dRdUMesh));
+
+    Outputs &r = jacobian_result;
+
+    span::computeBalanceOfMass<dim, dim, 10, material_response_num_dof>(
+        makeFixedSpan<nphases>(s.density.data()), makeFixedSpan<nphases>(s.density_dot.data()),
+        makeFixedSpan<nphases, dim>(s.density_gradient.data()), makeFixedSpan<nphases, dim>(s.velocity.data()),
+        makeFixedSpan<nphases, dim, dim>(s.velocity_gradient.data()),
+        makeFixedSpan<nphases, material_response_size>(s.material_response.data()),
+        makeFixedSpan<nphases, material_response_size, num_dof *(1 + dim)>(s.material_response_jacobian.data()),
+        s.test_function, s.interpolation_function, makeFixedSpan<dim>(s.interpolation_function_gradient.data()),
+        makeFixedSpan<num_dof, dim>(s.dof_gradient.data()), s.dRhoDotdRho, s.dUDotdU,
+        makeFixedSpan<nphases>(r.result.data()), makeFixedSpan<nphases, nphases>(r.dRdRho.data()),
+        makeFixedSpan<nphases, nphases, dim>(r.dRdU.data()), makeFixedSpan<nphases, nphases, dim>(r.dRdW.data()),
+        makeFixedSpan<nphases, nphases>(r.dRdTheta.data()), makeFixedSpan<nphases, nphases>(r.dRdE.data()),
+        makeFixedSpan<nphases, nphases>(r.dRdVF.data()), makeFixedSpan<nphases, num_additional_dof>(r.dRdZ.data()),
+        makeFixedSpan<nphases, dim>(r.dRdUMesh.data()));
+
+    BOOST_TEST(jacobian_result.all() == jacobian_answer.all(), CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfLinearMomentum, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the residuals and Jacobians of the balance of linear momentum on views against the multiphase iterator
+     * kernels
+     */
+
+    const PointState s;
+
+    floatVector answer(nphases * dim), result(nphases * dim);
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim, dim, 11, 0, 14>(
+        std::begin(s.density), std::end(s.density), std::begin(s.density_dot), std::end(s.density_dot),
+        std::begin(s.density_gradient), std::end(s.density_gradient), std::begin(s.velocity), std::end(s.velocity),
+        std::begin(s.velocity_dot), std::end(s.velocity_dot), std::begin(s.velocity_gradient),
+        std::end(s.velocity_gradient), std::begin(s.material_response), std::end(s.material_response),
+        std::begin(s.volume_fraction), std::end(s.volume_fraction), s.test_function,
+        std::begin(s.test_function_gradient), std::end(s.test_function_gradient), std::begin(answer), std::end(answer));
+
+    span::computeBalanceOfLinearMomentum<dim, dim, 11, 0, 14>(
+        makeFixedSpan<nphases>(s.density.data()), makeFixedSpan<nphases>(s.density_dot.data()),
+        makeFixedSpan<nphases, dim>(s.density_gradient.data()), makeFixedSpan<nphases, dim>(s.velocity.data()),
+        makeFixedSpan<nphases, dim>(s.velocity_dot.data()),
+        makeFixedSpan<nphases, dim, dim>(s.velocity_gradient.data()),
+        makeFixedSpan<nphases, material_response_size>(s.material_response.data()),
+        makeFixedSpan<nphases>(s.volume_fraction.data()), s.test_function,
+        makeFixedSpan<dim>(s.test_function_gradient.data()), makeFixedSpan<nphases, dim>(result.data()));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    Outputs jacobian_answer(nphases * dim), jacobian_result(nphases * dim);
+
+    Outputs &a = jacobian_answer;
+
+    tardigradeBalanceEquations::balanceOfLinearMomentum::computeBalanceOfLinearMomentum<dim, dim, 11, 0, 14,
+                                                                                        material_response_num_dof>(
+        std::begin(s.density), std::end(s.density), std::begin(s.density_dot), std::end(s.density_dot),
+        std::begin(s.density_gradient), std::end(s.density_gradient), std::begin(s.velocity), std::end(s.velocity),
+        std::begin(s.velocity_dot), std::end(s.velocity_dot), std::begin(s.velocity_gradient),
+        std::end(s.velocity_gradient), std::begin(s.material_response), std::end(s.material_response),
+        std::begin(s.material_response_jacobian), std::end(s.material_response_jacobian),
+        std::begin(s.volume_fraction), std::end(s.volume_fraction), s.test_function,
+        std::begin(s.test_function_gradient), std::end(s.test_function_gradient), s.interpolation_function,
+        std::begin(s.interpolation_function_gradient), std::end(s.interpolation_function_gradient),
+        std::begin(s.dof_gradient), std::end(s.dof_gradient), s.dRhoDotdRho, s.dUDotdU, s.dUDDotdU,
+        std::begin(a.result), std::end(a.result), std::begin(a.dRdRho), std::end(a.dRdRho), std::begin(a.dRdU),
+        std::end(a.dRdU), std::begin(a.dRdW), std::end(a.dRdW), std::begin(a.dRdTheta), std::end(a.dRdTheta),
+        std::begin(a.dRdE), std::end(a.dRdE), std::begin(a.dRdVF), std::end(a.dRdVF), std::begin(a.dRdZ),
+        std::end(a.dRdZ), std::begin(a.dRdUMesh), std::end(a.dRdUMesh));
+
+    Outputs &r = jacobian_result;
+
+    span::computeBalanceOfLinearMomentum<dim, dim, 11, 0, 14, material_response_num_dof>(
+        makeFixedSpan<nphases>(s.density.data()), makeFixedSpan<nphases>(s.density_dot.data()),
+        makeFixedSpan<nphases, dim>(s.density_gradient.data()), makeFixedSpan<nphases, dim>(s.velocity.data()),
+        makeFixedSpan<nphases, dim>(s.velocity_dot.data()),
+        makeFixedSpan<nphases, dim, dim>(s.velocity_gradient.data()),
+        makeFixedSpan<nphases, material_response_size>(s.material_response.data()),
+        makeFixedSpan<nphases, material_response_size, num_dof *(1 + dim)>(s.material_response_jacobian.data()),
+        makeFixedSpan<nphases>(s.volume_fraction.data()), s.test_function,
+        makeFixedSpan<dim>(s.test_function_gradient.data()), s.interpolation_function,
+        makeFixedSpan<dim>(s.interpolation_function_gradient.data()),
+        makeFixedSpan<num_dof, dim>(s.dof_gradient.data()),
+        s.dRhoDotdRho, s.dUDotdU, s.dUDDotdU, makeFixedSpan<nphases, dim>(r.result.data()),
+        makeFixedSpan<nphases, dim, nphases>(r.dRdRho.data()), makeFixedSpan<nphases, dim, nphases, dim>(r.dRdU.data()),
+        makeFixedSpan<nphases, dim, nphases, dim>(r.dRdW.data()),
+        makeFixedSpan<nphases, dim, nphases>(r.dRdTheta.data()), makeFixedSpan<nphases, dim, nphases>(r.dRdE.data()),
+        makeFixedSpan<nphases, dim, nphases>(r.dRdVF.data()),
+        makeFixedSpan<nphases, dim, num_additional_dof>(r.dRdZ.data()),
+        makeFixedSpan<nphases, dim, dim>(r.dRdUMesh.data()));
+
+    BOOST_TEST(jacobian_result.all() == jacobian_answer.all(), CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_computeBalanceOfEnergy, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the residuals and Jacobians of the balance of energy on views against the multiphase iterator kernels
+     */
+
+    const PointState s;
+
+    floatVector answer(nphases), result(nphases);
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 20, 17, 14, 21>(
+        std::begin(s.density), std::end(s.density), std::begin(s.density_dot), std::end(s.density_dot),
+        std::begin(s.density_gradient), std::end(s.density_gradient), std::begin(s.internal_energy),
+        std::end(s.internal_energy), std::begin(s.internal_energy_dot), std::end(s.internal_energy_dot),
+        std::begin(s.internal_energy_gradient), std::end(s.internal_energy_gradient), std::begin(s.velocity),
+        std::end(s.velocity), std::begin(s.velocity_gradient), std::end(s.velocity_gradient),
+        std::begin(s.material_response), std::end(s.material_response), std::begin(s.volume_fraction),
+        std::end(s.volume_fraction), s.test_function, std::begin(s.test_function_gradient),
+        std::end(s.test_function_gradient), std::begin(answer), std::end(answer));
+
+    span::computeBalanceOfEnergy<dim, false, dim, 0, 20, 17, 14, 21>(
+        makeFixedSpan<nphases>(s.density.data()), makeFixedSpan<nphases>(s.density_dot.data()),
+        makeFixedSpan<nphases, dim>(s.density_gradient.data()), makeFixedSpan<nphases>(s.internal_energy.data()),
+        makeFixedSpan<nphases>(s.internal_energy_dot.data()),
+        makeFixedSpan<nphases, dim>(s.internal_energy_gradient.data()), makeFixedSpan<nphases, dim>(s.velocity.data()),
+        makeFixedSpan<nphases, dim, dim>(s.velocity_gradient.data()),
+        makeFixedSpan<nphases, material_response_size>(s.material_response.data()),
+        makeFixedSpan<nphases>(s.volume_fraction.data()), s.test_function,
+        makeFixedSpan<dim>(s.test_function_gradient.data()), makeFixedSpan<nphases>(result.data()));
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    Outputs jacobian_answer(nphases), jacobian_result(nphases);
+
+    Outputs &a = jacobian_answer;
+
+    tardigradeBalanceEquations::balanceOfEnergy::computeBalanceOfEnergy<dim, false, dim, 0, 20, 17, 14, 21,
+                                                                        material_response_num_dof>(
+        std::begin(s.density), std::end(s.density), std::begin(s.density_dot), std::end(s.density_dot),
+        std::begin(s.density_gradient), std::end(s.density_gradient), std::begin(s.internal_energy),
+        std::end(s.internal_energy), std::begin(s.internal_energy_dot), std::end(s.internal_energy_dot),
+        std::begin(s.internal_energy_gradient), std::end(s.internal_energy_gradient), std::begin(s.velocity),
+        std::end(s.velocity), std::begin(s.velocity_gradient), std::end(s.velocity_gradient),
+        std::begin(s.material_response), std::end(s.material_response), std::begin(s.material_response_jacobian),
+        std::end(s.material_response_jacobian), std::begin(s.volume_fraction), std::end(s.volume_fraction),
+        s.test_function, std::begin(s.test_function_gradient), std::end(s.test_function_gradient),
+        s.interpolation_function, std::begin(s.interpolation_function_gradient),
+        std::end(s.interpolation_function_gradient), std::begin(s.dof_gradient), std::end(s.dof_gradient),
+        s.dRhoDotdRho, s.dEDotdE, s.dUDotdU, std::begin(a.result), std::end(a.result), std::begin(a.dRdRho),
+        std::end(a.dRdRho), std::begin(a.dRdU), std::end(a.dRdU), std::begin(a.dRdW), std::end(a.dRdW),
+        std::begin(a.dRdTheta), std::end(a.dRdTheta), std::begin(a.dRdE), std::end(a.dRdE), std::begin(a.dRdVF),
+        std::end(a.dRdVF), std::begin(a.dRdZ), std::end(a.dRdZ), std::begin(a.dRdUMesh), std::end(a.dRdUMesh));
+
+    Outputs &r = jacobian_result;
+
+    span::computeBalanceOfEnergy<dim, false, dim, 0, 20, 17, 14, 21, material_response_num_dof>(
+        makeFixedSpan<nphases>(s.density.data()), makeFixedSpan<nphases>(s.density_dot.data()),
+        makeFixedSpan<nphases, dim>(s.density_gradient.data()), makeFixedSpan<nphases>(s.internal_energy.data()),
+        makeFixedSpan<nphases>(s.internal_energy_dot.data()),
+        makeFixedSpan<nphases, dim>(s.internal_energy_gradient.data()), makeFixedSpan<nphases, dim>(s.velocity.data()),
+        makeFixedSpan<nphases, dim, dim>(s.velocity_gradient.data()),
+        makeFixedSpan<nphases, material_response_size>(s.material_response.data()),
+        makeFixedSpan<nphases, material_response_size, num_dof *(1 + dim)>(s.material_response_jacobian.data()),
+        makeFixedSpan<nphases>(s.volume_fraction.data()), s.test_function,
+        makeFixedSpan<dim>(s.test_function_gradient.data()), s.interpolation_function,
+        makeFixedSpan<dim>(s.interpolation_function_gradient.data()),
+        makeFixedSpan<num_dof, dim>(s.dof_gradient.data()),
+        s.dRhoDotdRho, s.dEDotdE, s.dUDotdU, makeFixedSpan<nphases>(r.result.data()),
+        makeFixedSpan<nphases, nphases>(r.dRdRho.data()), makeFixedSpan<nphases, nphases, dim>(r.dRdU.data()),
+        makeFixedSpan<nphases, nphases, dim>(r.dRdW.data()), makeFixedSpan<nphases, nphases>(r.dRdTheta.data()),
+        makeFixedSpan<nphases, nphases>(r.dRdE.data()), makeFixedSpan<nphases, nphases>(r.dRdVF.data()),
+        makeFixedSpan<nphases, num_additional_dof>(r.dRdZ.data()), makeFixedSpan<nphases, dim>(r.dRdUMesh.data()));
+
+    BOOST_TEST(jacobian_result.all() == jacobian_answer.all(), CHECK_PER_ELEMENT);
+}
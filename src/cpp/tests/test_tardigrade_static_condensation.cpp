@@ -0,0 +1,289 @@
+/**
+ * \file test_tardigrade_static_condensation.cpp
+ *
+ * Tests for tardigrade_static_condensation
+ */
+
+#include <tardigrade_static_condensation.h>
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_static_condensation
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace assembly = tardigradeBalanceEquations::meshAssembly;
+
+namespace condensation = tardigradeBalanceEquations::staticCondensation;
+
+using dense_matrix = Eigen::Matrix<floatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+using dense_vector = Eigen::Matrix<floatType, Eigen::Dynamic, 1>;
+
+/*!
+ * A nonsymmetric, diagonally dominant element system which differs between the elements
+ */
+struct ElementSystem {
+    /*!
+     * Fill the residual and Jacobian of an element system
+     *
+     * \param element: The element
+     * \param residual_begin: The starting iterator of the element residual
+     * \param residual_end: The stopping iterator of the element residual
+     * \param jacobian_begin: The starting iterator of the row-major element Jacobian
+     * \param jacobian_end: The stopping iterator of the row-major element Jacobian
+     */
+    template <class residual_iter, class jacobian_iter>
+    void operator()(const assembly::size_type element, residual_iter residual_begin, residual_iter residual_end,
+                    jacobian_iter jacobian_begin, jacobian_iter jacobian_end) {
+        const assembly::size_type n = (assembly::size_type)(residual_end - residual_begin);
+
+        BOOST_TEST((assembly::size_type)(jacobian_end - jacobian_begin) == n * n);
+
+        for (assembly::size_type i = 0; i < n; ++i) {
+            *(residual_begin + i) = std::cos(1.0 * i + 2.0 * element);
+
+            for (assembly::size_type j = 0; j < n; ++j) {
+                *(jacobian_begin + n * i + j) =
+                    (i == j) ? 2.0 * n + element + 0.1 * i : std::sin(1.0 + 13.0 * i + 7.0 * j + 3.0 * element);
+            }
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(test_ElementCondensation, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the construction of the static condensation
+     */
+
+    std::vector<assembly::size_type> condensed_dof = {3, 1};
+
+    condensation::ElementCondensation element_condensation(2, 5, std::cbegin(condensed_dof), std::cend(condensed_dof));
+
+    std::vector<assembly::size_type> retained_answer = {0, 2, 4};
+
+    std::vector<assembly::size_type> condensed_answer = {1, 3};
+
+    BOOST_TEST(element_condensation.getNumElements() == 2);
+
+    BOOST_TEST(element_condensation.getNumElementDOF() == 5);
+
+    BOOST_TEST(element_condensation.getRetainedDOF() == retained_answer, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(element_condensation.getCondensedDOF() == condensed_answer, CHECK_PER_ELEMENT);
+
+    std::vector<assembly::size_type> repeated_dof = {1, 1};
+
+    BOOST_CHECK_THROW(
+        condensation::ElementCondensation(2, 5, std::cbegin(repeated_dof), std::cend(repeated_dof)), std::exception);
+
+    std::vector<assembly::size_type> outside_dof = {5};
+
+    BOOST_CHECK_THROW(
+        condensation::ElementCondensation(2, 5, std::cbegin(outside_dof), std::cend(outside_dof)), std::exception);
+
+    // Condense two element-local dof of two-node elements
+    std::vector<assembly::size_type> connectivity_vector = {0, 1, 1, 2};
+
+    assembly::MeshConnectivity connectivity(3, 2, std::cbegin(connectivity_vector), std::cend(connectivity_vector));
+
+    assembly::DofNumbering numbering(3, 1, 1, 0);
+
+    condensation::ElementCondensation local_condensation(connectivity, numbering, 2);
+
+    std::vector<assembly::size_type> local_condensed_answer = {12, 13};
+
+    BOOST_TEST(local_condensation.getNumElements() == 2);
+
+    BOOST_TEST(local_condensation.getNumElementDOF() == 14);
+
+    BOOST_TEST(local_condensation.getNumRetainedDOF() == 2 * numbering.getNumNodeDOF());
+
+    BOOST_TEST(local_condensation.getCondensedDOF() == local_condensed_answer, CHECK_PER_ELEMENT);
+}
+
+BOOST_AUTO_TEST_CASE(test_condenseElement, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the condensed element system and the recovery reproduce the solution of the full element system
+     */
+
+    constexpr assembly::size_type n = 6;
+
+    std::vector<assembly::size_type> condensed_dof = {1, 4, 5};
+
+    condensation::ElementCondensation element_condensation(2, n, std::cbegin(condensed_dof), std::cend(condensed_dof));
+
+    ElementSystem system;
+
+    for (assembly::size_type e = 0; e < 2; ++e) {
+        std::vector<floatType> residual(n), jacobian(n * n);
+
+        system(e, std::begin(residual), std::end(residual), std::begin(jacobian), std::end(jacobian));
+
+        std::vector<floatType> condensed_residual(3), condensed_jacobian(9);
+
+        element_condensation.condenseElement(e, std::cbegin(residual), std::cend(residual), std::cbegin(jacobian),
+                                             std::cend(jacobian), std::begin(condensed_residual),
+                                             std::end(condensed_residual), std::begin(condensed_jacobian),
+                                             std::end(condensed_jacobian));
+
+        dense_vector full_delta = -Eigen::Map<const dense_matrix>(jacobian.data(), n, n).fullPivLu().solve(
+                                       Eigen::Map<const dense_vector>(residual.data(), n));
+
+        dense_vector retained_delta = -Eigen::Map<const dense_matrix>(condensed_jacobian.data(), 3, 3)
+                                           .fullPivLu()
+                                           .solve(Eigen::Map<const dense_vector>(condensed_residual.data(), 3));
+
+        std::vector<floatType> condensed_delta(3);
+
+        element_condensation.recoverElement(e, retained_delta.data(), retained_delta.data() + 3,
+                                            std::begin(condensed_delta), std::end(condensed_delta));
+
+        std::vector<floatType> result = {retained_delta(0),  condensed_delta[0], retained_delta(1),
+                                         retained_delta(2),  condensed_delta[1], condensed_delta[2]};
+
+        std::vector<floatType> answer(full_delta.data(), full_delta.data() + n);
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+    }
+
+    std::vector<floatType> residual(n), jacobian(n * n), condensed_residual(3), condensed_jacobian(9);
+
+    BOOST_CHECK_THROW(element_condensation.condenseElement(
+                          2, std::cbegin(residual), std::cend(residual), std::cbegin(jacobian), std::cend(jacobian),
+                          std::begin(condensed_residual), std::end(condensed_residual),
+                          std::begin(condensed_jacobian), std::end(condensed_jacobian)),
+                      std::exception);
+
+    // A singular condensed block
+    BOOST_CHECK_THROW(element_condensation.condenseElement(
+                          0, std::cbegin(residual), std::cend(residual), std::cbegin(jacobian), std::cend(jacobian),
+                          std::begin(condensed_residual), std::end(condensed_residual),
+                          std::begin(condensed_jacobian), std::end(condensed_jacobian)),
+                      std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_assembleResidualAndJacobian, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the solution of the condensed global system and the recovered element-local degrees of freedom
+     * reproduce the solution of the full system of the global degrees of freedom of the numbering and the
+     * element-local degrees of freedom of each element
+     */
+
+    std::vector<assembly::size_type> connectivity_vector = {0, 1, 1, 2, 2, 3};
+
+    assembly::MeshConnectivity connectivity(4, 2, std::cbegin(connectivity_vector), std::cend(connectivity_vector));
+
+    assembly::DofNumbering numbering(4, 1, 1, 0);
+
+    condensation::ElementCondensation element_condensation(connectivity, numbering, 2);
+
+    const assembly::size_type num_dof           = numbering.getNumDOF();
+    const assembly::size_type num_node_dof      = numbering.getNumNodeDOF();
+    const assembly::size_type num_condensed_dof = element_condensation.getNumCondensedDOF();
+    const assembly::size_type num_full_dof      = num_dof + connectivity.getNumElements() * num_condensed_dof;
+    const assembly::size_type num_element_dof   = element_condensation.getNumElementDOF();
+
+    BOOST_TEST(num_dof == 24);
+
+    BOOST_TEST(num_full_dof == 30);
+
+    ElementSystem system;
+
+    // The full system where the element-local dof of the elements follow the global dof of the numbering
+    dense_matrix full_jacobian = dense_matrix::Zero(num_full_dof, num_full_dof);
+
+    dense_vector full_residual = dense_vector::Zero(num_full_dof);
+
+    for (assembly::size_type e = 0; e < connectivity.getNumElements(); ++e) {
+        std::vector<floatType> residual(num_element_dof), jacobian(num_element_dof * num_element_dof);
+
+        system(e, std::begin(residual), std::end(residual), std::begin(jacobian), std::end(jacobian));
+
+        std::vector<assembly::size_type> full_dof(num_element_dof);
+
+        for (assembly::size_type k = 0; k < 2 * num_node_dof; ++k) {
+            full_dof[k] = numbering.getGlobalDOF(connectivity_vector[2 * e + k / num_node_dof], assembly::DENSITY, 0) +
+                          k % num_node_dof;
+        }
+
+        for (assembly::size_type k = 0; k < num_condensed_dof; ++k) {
+            full_dof[2 * num_node_dof + k] = num_dof + num_condensed_dof * e + k;
+        }
+
+        for (assembly::size_type i = 0; i < num_element_dof; ++i) {
+            full_residual(full_dof[i]) += residual[i];
+
+            for (assembly::size_type j = 0; j < num_element_dof; ++j) {
+                full_jacobian(full_dof[i], full_dof[j]) += jacobian[num_element_dof * i + j];
+            }
+        }
+    }
+
+    dense_vector full_delta = -full_jacobian.fullPivLu().solve(full_residual);
+
+    // The condensed system
+    assembly::CSRMatrix<floatType> jacobian = assembly::buildCSRMatrix<floatType>(connectivity, numbering);
+
+    std::vector<floatType> residual(num_dof);
+
+    condensation::assembleResidualAndJacobian(connectivity, numbering, element_condensation, system,
+                                              std::begin(residual), std::end(residual), jacobian);
+
+    dense_matrix condensed_jacobian = dense_matrix::Zero(num_dof, num_dof);
+
+    for (assembly::size_type row = 0; row < num_dof; ++row) {
+        for (assembly::size_type k = jacobian.getRowOffsets()[row]; k < jacobian.getRowOffsets()[row + 1]; ++k) {
+            condensed_jacobian(row, jacobian.getColumnIndices()[k]) = jacobian.getValues()[k];
+        }
+    }
+
+    dense_vector delta =
+        -condensed_jacobian.fullPivLu().solve(Eigen::Map<const dense_vector>(residual.data(), num_dof));
+
+    std::vector<floatType> condensed_delta(num_full_dof - num_dof);
+
+    condensation::recoverCondensedDOF(connectivity, numbering, element_condensation, delta.data(),
+                                      delta.data() + num_dof, std::begin(condensed_delta), std::end(condensed_delta));
+
+    std::vector<floatType> result(delta.data(), delta.data() + num_dof);
+
+    result.insert(std::end(result), std::cbegin(condensed_delta), std::cend(condensed_delta));
+
+    std::vector<floatType> answer(full_delta.data(), full_delta.data() + num_full_dof);
+
+    BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+    // The numbering must match the condensation
+    assembly::DofNumbering other_numbering(4, 1, 1, 1);
+
+    assembly::CSRMatrix<floatType> other_csr = assembly::buildCSRMatrix<floatType>(connectivity, other_numbering);
+
+    std::vector<floatType> other_residual(other_numbering.getNumDOF());
+
+    BOOST_CHECK_THROW(
+        condensation::assembleResidualAndJacobian(connectivity, other_numbering, element_condensation, system,
+                                                  std::begin(other_residual), std::end(other_residual), other_csr),
+        std::exception);
+
+    // Node dof are shared between the elements and may not be condensed
+    std::vector<assembly::size_type> node_dof = {1, 13};
+
+    condensation::ElementCondensation node_condensation(connectivity.getNumElements(), num_element_dof,
+                                                        std::cbegin(node_dof), std::cend(node_dof));
+
+    BOOST_CHECK_THROW(condensation::assembleResidualAndJacobian(connectivity, numbering, node_condensation, system,
+                                                                std::begin(residual), std::end(residual), jacobian),
+                      std::exception);
+}
@@ -0,0 +1,271 @@
+/**
+ * \file test_tardigrade_thread_pool.cpp
+ *
+ * Tests for tardigrade_thread_pool
+ */
+
+#include <tardigrade_thread_pool.h>
+
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_thread_pool
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+namespace pool = tardigradeBalanceEquations::threadPool;
+
+BOOST_AUTO_TEST_CASE(test_parallelFor, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that every index of a loop is visited exactly once for any number of threads and grain size
+     */
+
+    BOOST_TEST(pool::ThreadPool(0).getNumThreads() == 1);
+
+    for (const unsigned int num_threads : {1u, 2u, 4u, 8u}) {
+        pool::ThreadPool thread_pool(num_threads);
+
+        BOOST_TEST(thread_pool.getNumThreads() == num_threads);
+
+        BOOST_TEST(thread_pool.getCurrentWorker() == 0);
+
+        for (const pool::size_type grain_size : {0u, 1u, 7u, 2000u}) {
+            std::vector<unsigned int> visits(1000, 0), workers(1000, num_threads);
+
+            thread_pool.parallelFor(1000, grain_size, [&](const unsigned int worker, const pool::size_type index) {
+                ++visits[index];
+
+                workers[index] = worker;
+            });
+
+            for (unsigned int i = 0; i < 1000; ++i) {
+                BOOST_TEST(visits[i] == 1);
+
+                BOOST_TEST(workers[i] < num_threads);
+            }
+        }
+
+        // Empty loops return immediately
+        thread_pool.parallelFor(0, 1, [&](const unsigned int worker, const pool::size_type index) {
+            throw std::runtime_error("empty loops should not call the function");
+        });
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallelFor_nested, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test a loop over elements which starts a loop over integration points with per-thread scratch for both
+     */
+
+    constexpr unsigned int num_elements = 40, num_points = 8;
+
+    std::vector<double> answer(num_elements * num_points);
+
+    for (unsigned int e = 0; e < num_elements; ++e) {
+        for (unsigned int q = 0; q < num_points; ++q) {
+            answer[num_points * e + q] = (e + 1.) * (q + 1.);
+        }
+    }
+
+    for (const unsigned int num_threads : {1u, 3u, 8u}) {
+        pool::ThreadPool thread_pool(num_threads);
+
+        pool::PerThreadScratch<std::vector<double>> element_scratch(num_threads, std::vector<double>(num_points));
+
+        pool::PerThreadScratch<double> point_scratch(num_threads);
+
+        BOOST_TEST(element_scratch.size() == num_threads);
+
+        std::vector<double> result(num_elements * num_points);
+
+        std::vector<unsigned int> worker_mismatches(num_elements, 0);
+
+        thread_pool.parallelFor(num_elements, 1, [&](const unsigned int worker, const pool::size_type e) {
+            auto &values = element_scratch[worker];
+
+            std::fill(std::begin(values), std::end(values), 0.);
+
+            if (thread_pool.getCurrentWorker() != worker) {
+                ++worker_mismatches[e];
+            }
+
+            thread_pool.parallelFor(num_points, 1, [&](const unsigned int point_worker, const pool::size_type q) {
+                point_scratch[point_worker] = (e + 1.) * (q + 1.);
+
+                values[q] = point_scratch[point_worker];
+            });
+
+            // The element scratch must not have been reused by another element while waiting on the points
+            std::copy(std::begin(values), std::end(values), std::begin(result) + num_points * e);
+        });
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+        BOOST_TEST(std::accumulate(std::begin(worker_mismatches), std::end(worker_mismatches), 0u) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallelReduce, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the deterministic reduction gives bitwise identical results for any number of threads
+     */
+
+    constexpr unsigned int num_indices = 20000;
+
+    auto map = [](const unsigned int worker, const pool::size_type index, std::vector<double> &partial) {
+        partial[0] += 1. / (index + 1.);
+
+        partial[1] += std::sin(0.1 * index);
+    };
+
+    auto combine = [](std::vector<double> &result, const std::vector<double> &partial) {
+        result[0] += partial[0];
+
+        result[1] += partial[1];
+    };
+
+    std::vector<double> answer(2, 0);
+
+    for (unsigned int i = 0; i < num_indices; ++i) {
+        answer[0] += 1. / (i + 1.);
+
+        answer[1] += std::sin(0.1 * i);
+    }
+
+    std::vector<double> reference;
+
+    for (const unsigned int num_threads : {1u, 2u, 3u, 8u}) {
+        pool::ThreadPool thread_pool(num_threads);
+
+        std::vector<double> result =
+            thread_pool.parallelReduce(num_indices, 64, std::vector<double>(2, 0), map, combine);
+
+        std::vector<double> unordered =
+            thread_pool.parallelReduce(num_indices, 64, std::vector<double>(2, 0), map, combine, false);
+
+        BOOST_TEST(result == answer, CHECK_PER_ELEMENT);
+
+        BOOST_TEST(unordered == answer, CHECK_PER_ELEMENT);
+
+        if (reference.empty()) {
+            reference = result;
+        }
+
+        BOOST_CHECK(result[0] == reference[0]);
+
+        BOOST_CHECK(result[1] == reference[1]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_exceptions, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that exceptions in a task are re-thrown on the calling thread and that the pool may still be used
+     */
+
+    pool::ThreadPool thread_pool(4);
+
+    BOOST_CHECK_THROW(thread_pool.parallelFor(100, 3,
+                                              [&](const unsigned int worker, const pool::size_type index) {
+                                                  if (index == 37) {
+                                                      throw std::runtime_error("task failure");
+                                                  }
+                                              }),
+                      std::exception);
+
+    BOOST_CHECK_THROW(thread_pool.parallelFor(10, 1,
+                                              [&](const unsigned int worker, const pool::size_type e) {
+                                                  thread_pool.parallelFor(
+                                                      8, 1, [&](const unsigned int, const pool::size_type q) {
+                                                          if ((e == 3) && (q == 5)) {
+                                                              throw std::runtime_error("nested failure");
+                                                          }
+                                                      });
+                                              }),
+                      std::exception);
+
+    std::vector<unsigned int> visits(100, 0);
+
+    thread_pool.parallelFor(100, 3, [&](const unsigned int worker, const pool::size_type index) { ++visits[index]; });
+
+    BOOST_TEST(std::accumulate(std::begin(visits), std::end(visits), 0u) == 100);
+}
+
+BOOST_AUTO_TEST_CASE(test_outsideThreads, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that loops started from several threads outside of the pool at the same time do not share worker 0
+     */
+
+    constexpr unsigned int num_callers = 4, num_repeats = 20, num_indices = 500;
+
+    pool::ThreadPool thread_pool(3);
+
+    pool::PerThreadScratch<double> scratch(3);
+
+    std::vector<std::atomic<unsigned int>> busy(3);
+
+    std::vector<unsigned int> mismatches(num_callers, 0);
+
+    std::vector<double> sums(num_callers, 0);
+
+    const double answer = 0.5 * num_indices * (num_indices - 1.);
+
+    auto caller = [&](const unsigned int c) {
+        for (unsigned int r = 0; r < num_repeats; ++r) {
+            std::vector<double> values(num_indices, 0);
+
+            thread_pool.parallelFor(num_indices, 7, [&](const unsigned int worker, const pool::size_type index) {
+                // Only one thread may use the scratch of a worker at a time
+                if (busy[worker].fetch_add(1) != 0) {
+                    ++mismatches[c];
+                }
+
+                scratch[worker] = index;
+
+                std::this_thread::yield();
+
+                if (scratch[worker] != index) {
+                    ++mismatches[c];
+                }
+
+                values[index] = scratch[worker];
+
+                busy[worker].fetch_sub(1);
+            });
+
+            sums[c] += std::accumulate(std::begin(values), std::end(values), 0.) - answer;
+
+            std::vector<double> reduced = thread_pool.parallelReduce(
+                num_indices, 16, std::vector<double>(1, 0),
+                [](const unsigned int, const pool::size_type index, std::vector<double> &partial) {
+                    partial[0] += index;
+                },
+                [](std::vector<double> &result, const std::vector<double> &partial) { result[0] += partial[0]; });
+
+            sums[c] += reduced[0] - answer;
+        }
+    };
+
+    std::vector<std::thread> callers;
+
+    for (unsigned int c = 0; c < num_callers; ++c) {
+        callers.emplace_back(caller, c);
+    }
+
+    for (auto &thread : callers) {
+        thread.join();
+    }
+
+    BOOST_TEST(std::accumulate(std::begin(mismatches), std::end(mismatches), 0u) == 0);
+
+    BOOST_TEST(sums == std::vector<double>(num_callers, 0), CHECK_PER_ELEMENT);
+}
@@ -0,0 +1,294 @@
+/**
+ * \file test_tardigrade_time_integration.cpp
+ *
+ * Tests for tardigrade_time_integration
+ */
+
+#include <tardigrade_time_integration.h>
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#define BOOST_TEST_MODULE test_tardigrade_time_integration
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+#define DEFAULT_TEST_TOLERANCE 1e-6
+#define CHECK_PER_ELEMENT boost::test_tools::per_element()
+
+typedef tardigradeBalanceEquations::finiteElement::floatType
+    floatType;  //!< Define the float type to be the same as in the finite element utilities
+
+namespace integration = tardigradeBalanceEquations::timeIntegration;
+
+/*!
+ * Integrate the undamped oscillators \f$ \ddot{u}_i + \omega_i^2 u_i = 0 \f$ with unit initial values and zero
+ * initial rates and return the largest error of the values at the final time. The residual is evaluated at the
+ * evaluation state and each step is solved with one Newton iteration using the derivative scalars of the
+ * integrator.
+ *
+ * \param &parameters: The parameters of the scheme
+ * \param &omega: The angular frequencies of the oscillators
+ * \param final_time: The final time
+ * \param num_steps: The number of time steps
+ */
+floatType integrateOscillators(const integration::TimeIntegrationParameters &parameters,
+                               const std::vector<floatType> &omega, const floatType final_time,
+                               const unsigned int num_steps) {
+    const integration::size_type n = omega.size();
+
+    const floatType dt = final_time / num_steps;
+
+    integration::TimeIntegrator<floatType> integrator(n, parameters);
+
+    std::vector<floatType> values(n, 1), rates(n, 0), accelerations(n);
+
+    for (integration::size_type i = 0; i < n; ++i) {
+        accelerations[i] = -omega[i] * omega[i];
+    }
+
+    integrator.setHistory(std::begin(values), std::end(values), std::begin(rates), std::end(rates),
+                          std::begin(accelerations), std::end(accelerations));
+
+    const floatType dDDotdDOF = integrator.getDOFDDotdDOF(dt);
+
+    const floatType scale = integrator.getJacobianScale();
+
+    std::vector<floatType> dof(n), eval_dof(n), eval_dot(n), eval_ddot(n);
+
+    for (unsigned int step = 0; step < num_steps; ++step) {
+        dof = integrator.getPreviousValues();
+
+        integrator.computeEvaluationState(dt, std::begin(dof), std::end(dof), std::begin(eval_dof),
+                                          std::end(eval_dof), std::begin(eval_dot), std::end(eval_dot),
+                                          std::begin(eval_ddot), std::end(eval_ddot));
+
+        for (integration::size_type i = 0; i < n; ++i) {
+            const floatType residual = eval_ddot[i] + omega[i] * omega[i] * eval_dof[i];
+
+            dof[i] -= residual / (scale * (dDDotdDOF + omega[i] * omega[i]));
+        }
+
+        integrator.advance(dt, std::begin(dof), std::end(dof));
+    }
+
+    floatType error = 0;
+
+    for (integration::size_type i = 0; i < n; ++i) {
+        error = std::fmax(error, std::fabs(integrator.getPreviousValues()[i] - std::cos(omega[i] * final_time)));
+    }
+
+    return error;
+}
+
+BOOST_AUTO_TEST_CASE(test_TimeIntegrationParameters, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the parameters of the time integration schemes
+     */
+
+    integration::TimeIntegrationParameters euler = integration::backwardEuler();
+
+    BOOST_TEST(euler.scheme == integration::BACKWARD_EULER);
+
+    BOOST_TEST(euler.alpha_m == 1.);
+
+    BOOST_TEST(euler.alpha_f == 1.);
+
+    integration::TimeIntegrationParameters newmark = integration::newmarkBeta(0.3, 0.6);
+
+    BOOST_TEST(newmark.scheme == integration::NEWMARK_BETA);
+
+    BOOST_TEST(newmark.beta == 0.3);
+
+    BOOST_TEST(newmark.gamma == 0.6);
+
+    BOOST_TEST(newmark.alpha_m == 1.);
+
+    BOOST_TEST(newmark.alpha_f == 1.);
+
+    integration::TimeIntegrationParameters no_dissipation = integration::generalizedAlpha(1.);
+
+    BOOST_TEST(no_dissipation.scheme == integration::GENERALIZED_ALPHA);
+
+    BOOST_TEST(no_dissipation.alpha_m == 0.5);
+
+    BOOST_TEST(no_dissipation.alpha_f == 0.5);
+
+    BOOST_TEST(no_dissipation.gamma == 0.5);
+
+    BOOST_TEST(no_dissipation.beta == 0.25);
+
+    integration::TimeIntegrationParameters dissipation = integration::generalizedAlpha(0.);
+
+    BOOST_TEST(dissipation.alpha_m == 2.);
+
+    BOOST_TEST(dissipation.alpha_f == 1.);
+
+    BOOST_TEST(dissipation.gamma == 1.5);
+
+    BOOST_TEST(dissipation.beta == 1.);
+
+    BOOST_CHECK_THROW(integration::newmarkBeta(0., 0.5), std::exception);
+
+    BOOST_CHECK_THROW(integration::generalizedAlpha(1.5), std::exception);
+
+    BOOST_CHECK_THROW(integration::TimeIntegrator<floatType>(3, euler).getDOFDotdDOF(0.), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_TimeIntegrator_derivatives, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test that the derivative scalars are the derivatives of the evaluation state w.r.t. the values at the end
+     * of the step divided by the derivative of the evaluated values
+     */
+
+    const floatType dt = 0.1;
+
+    const floatType eps = 1e-6;
+
+    std::vector<floatType> values = {0.1, -0.2, 0.3};
+
+    std::vector<floatType> rates = {1.2, 0.4, -0.7};
+
+    std::vector<floatType> accelerations = {-2.1, 0.5, 3.3};
+
+    std::vector<floatType> dof = {0.25, -0.1, 0.2};
+
+    for (auto parameters : {integration::backwardEuler(), integration::newmarkBeta(0.3025, 0.6),
+                            integration::generalizedAlpha(0.5)}) {
+        integration::TimeIntegrator<floatType> integrator(3, parameters);
+
+        integrator.setHistory(std::begin(values), std::end(values), std::begin(rates), std::end(rates),
+                              std::begin(accelerations), std::end(accelerations));
+
+        std::vector<floatType> eval_dof(3), eval_dot(3), eval_ddot(3);
+
+        integrator.computeEvaluationState(dt, std::begin(dof), std::end(dof), std::begin(eval_dof),
+                                          std::end(eval_dof), std::begin(eval_dot), std::end(eval_dot),
+                                          std::begin(eval_ddot), std::end(eval_ddot));
+
+        for (unsigned int i = 0; i < 3; ++i) {
+            std::vector<floatType> dofp = dof;
+
+            dofp[i] += eps;
+
+            std::vector<floatType> eval_dofp(3), eval_dotp(3), eval_ddotp(3);
+
+            integrator.computeEvaluationState(dt, std::begin(dofp), std::end(dofp), std::begin(eval_dofp),
+                                              std::end(eval_dofp), std::begin(eval_dotp), std::end(eval_dotp),
+                                              std::begin(eval_ddotp), std::end(eval_ddotp));
+
+            const floatType dEvaldDOF = (eval_dofp[i] - eval_dof[i]) / eps;
+
+            BOOST_TEST(dEvaldDOF == integrator.getJacobianScale());
+
+            BOOST_TEST((eval_dotp[i] - eval_dot[i]) / eps / dEvaldDOF == integrator.getDOFDotdDOF(dt));
+
+            BOOST_TEST((eval_ddotp[i] - eval_ddot[i]) / eps / dEvaldDOF == integrator.getDOFDDotdDOF(dt));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_TimeIntegrator_advance, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the update of the history
+     */
+
+    const floatType dt = 0.2;
+
+    std::vector<floatType> values = {0.1, -0.2, 0.3};
+
+    std::vector<floatType> rates = {1.2, 0.4, -0.7};
+
+    std::vector<floatType> accelerations = {-2.1, 0.5, 3.3};
+
+    std::vector<floatType> dof = {0.25, -0.1, 0.2};
+
+    integration::TimeIntegrator<floatType> euler(3, integration::backwardEuler());
+
+    euler.setHistory(std::begin(values), std::end(values), std::begin(rates), std::end(rates),
+                     std::begin(accelerations), std::end(accelerations));
+
+    euler.advance(dt, std::begin(dof), std::end(dof));
+
+    std::vector<floatType> answer_rates(3), answer_accelerations(3);
+
+    for (unsigned int i = 0; i < 3; ++i) {
+        answer_rates[i] = (dof[i] - values[i]) / dt;
+
+        answer_accelerations[i] = (answer_rates[i] - rates[i]) / dt;
+    }
+
+    BOOST_TEST(euler.getPreviousValues() == dof, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(euler.getPreviousRates() == answer_rates, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(euler.getPreviousAccelerations() == answer_accelerations, CHECK_PER_ELEMENT);
+
+    const floatType beta = 0.3025, gamma = 0.6;
+
+    integration::TimeIntegrator<floatType> newmark(3, integration::newmarkBeta(beta, gamma));
+
+    newmark.setHistory(std::begin(values), std::end(values), std::begin(rates), std::end(rates),
+                       std::begin(accelerations), std::end(accelerations));
+
+    std::vector<floatType> result_rates(3), result_accelerations(3);
+
+    newmark.computeRates(dt, std::begin(dof), std::end(dof), std::begin(result_rates), std::end(result_rates),
+                         std::begin(result_accelerations), std::end(result_accelerations));
+
+    newmark.advance(dt, std::begin(dof), std::end(dof));
+
+    for (unsigned int i = 0; i < 3; ++i) {
+        answer_accelerations[i] =
+            (dof[i] - values[i] - dt * rates[i] - dt * dt * (0.5 - beta) * accelerations[i]) / (beta * dt * dt);
+
+        answer_rates[i] = rates[i] + dt * ((1 - gamma) * accelerations[i] + gamma * answer_accelerations[i]);
+    }
+
+    BOOST_TEST(result_rates == answer_rates, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(result_accelerations == answer_accelerations, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(newmark.getPreviousValues() == dof, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(newmark.getPreviousRates() == answer_rates, CHECK_PER_ELEMENT);
+
+    BOOST_TEST(newmark.getPreviousAccelerations() == answer_accelerations, CHECK_PER_ELEMENT);
+
+    std::vector<floatType> short_dof(2);
+
+    BOOST_CHECK_THROW(newmark.advance(dt, std::begin(short_dof), std::end(short_dof)), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_TimeIntegrator_convergence, *boost::unit_test::tolerance(DEFAULT_TEST_TOLERANCE)) {
+    /*!
+     * Test the accuracy and the order of convergence of the schemes for undamped oscillators
+     */
+
+    const std::vector<floatType> omega = {1., 2., 3.};
+
+    const floatType final_time = 1.;
+
+    struct Case {
+        integration::TimeIntegrationParameters parameters;  //!< The parameters of the scheme
+
+        floatType order;  //!< The expected order of convergence
+
+        floatType tolerance;  //!< The bound on the error of the fine integration
+    };
+
+    for (auto c : {Case{integration::backwardEuler(), 1, 2e-2}, Case{integration::newmarkBeta(), 2, 1e-4},
+                   Case{integration::generalizedAlpha(1.), 2, 1e-4},
+                   Case{integration::generalizedAlpha(0.8), 2, 1e-4}}) {
+        const floatType coarse = integrateOscillators(c.parameters, omega, final_time, 200);
+
+        const floatType fine = integrateOscillators(c.parameters, omega, final_time, 400);
+
+        BOOST_TEST(std::fabs(std::log2(coarse / fine) - c.order) < 0.1);
+
+        BOOST_TEST(fine < c.tolerance);
+    }
+}
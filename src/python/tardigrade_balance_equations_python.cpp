@@ -0,0 +1,403 @@
+/**
+ ******************************************************************************
+ * \file tardigrade_balance_equations_python.cpp
+ ******************************************************************************
+ * The python bindings of the batched residuals of the multiphase balance
+ * equations for the standard configuration. The arrays are NumPy arrays of
+ * float64 values which must be C-contiguous and whose first index is the
+ * point. The kernels read and write the buffers of the arrays directly so
+ * nothing is copied. The GIL is released while a batch is evaluated and the
+ * points are distributed over a thread pool which is shared by the calls.
+ *
+ * Each function takes the number of threads and the grain size i.e., the
+ * number of points of each task, as optional keyword arguments. A number of
+ * threads of zero uses the hardware concurrency and one evaluates the batch
+ * on the calling thread.
+ ******************************************************************************
+ */
+
+#include <Python.h>
+
+#include <boost/python.hpp>
+#include <boost/python/numpy.hpp>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tardigrade_batched_kernels.h"
+#include "tardigrade_explicit_instantiations.h"
+
+namespace tardigradeBalanceEquations {
+
+    namespace python {
+
+        namespace np = boost::python::numpy;
+
+        namespace standard = explicitInstantiations;
+
+        typedef batchedKernels::size_type size_type;  //!< The type of the indices of the points
+
+        /*!
+         * Release the GIL for the lifetime of the object
+         */
+        class ReleaseGIL {
+           public:
+            ReleaseGIL() : _state(PyEval_SaveThread()) {}
+
+            ~ReleaseGIL() { PyEval_RestoreThread(_state); }
+
+            ReleaseGIL(const ReleaseGIL &) = delete;
+
+            ReleaseGIL &operator=(const ReleaseGIL &) = delete;
+
+           protected:
+            PyThreadState *_state;  //!< The state of the thread which released the GIL
+        };
+
+        /*!
+         * The thread pool shared by the calls. The pool serializes the batches of concurrent calls itself so the lock
+         * is only held while the pool is looked up. The pool is rebuilt when a call asks for a different number of
+         * threads and a call which is still using the previous pool keeps it alive until its batch is finished.
+         */
+        class SharedPool {
+           public:
+            /*!
+             * Get the pool with the requested number of threads or nullptr if the batch is evaluated serially
+             *
+             * \param num_threads: The number of threads. 0 uses the hardware concurrency
+             */
+            std::shared_ptr<threadPool::ThreadPool> acquire(const unsigned int num_threads) {
+                const unsigned int threads = (num_threads == 0) ? std::thread::hardware_concurrency() : num_threads;
+
+                if (threads < 2) {
+                    return nullptr;
+                }
+
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                if ((!_pool) || (_pool->getNumThreads() != threads)) {
+                    _pool = std::make_shared<threadPool::ThreadPool>(threads);
+                }
+
+                return _pool;
+            }
+
+           protected:
+            std::mutex _mutex;  //!< The mutex held while the pool is looked up
+
+            std::shared_ptr<threadPool::ThreadPool> _pool;  //!< The pool
+        };
+
+        /*!
+         * Get the shared pool of the module
+         */
+        SharedPool &getSharedPool() {
+            static SharedPool pool;
+
+            return pool;
+        }
+
+        /*!
+         * Get the shape of an array as a string
+         *
+         * \param &array: The array
+         */
+        std::string getShapeString(const np::ndarray &array) {
+            std::string shape = "(";
+
+            for (int i = 0; i < array.get_nd(); ++i) {
+                shape += ((i > 0) ? ", " : "") + std::to_string(array.shape(i));
+            }
+
+            return shape + ")";
+        }
+
+        /*!
+         * Check that an array may be used as a buffer of the kernels and has the expected shape. A negative extent
+         * matches any extent.
+         *
+         * \param &array: The array
+         * \param *name: The name of the argument
+         * \param &shape: The expected shape
+         * \param writeable: Flag indicating that the kernels write to the array
+         */
+        void checkArray(const np::ndarray &array, const char *name, const std::vector<Py_intptr_t> &shape,
+                        const bool writeable = false) {
+            if (!np::equivalent(array.get_dtype(), np::dtype::get_builtin<double>())) {
+                throw std::invalid_argument(std::string(name) + " must have a dtype of float64");
+            }
+
+            if (!(array.get_flags() & np::ndarray::C_CONTIGUOUS) || !(array.get_flags() & np::ndarray::ALIGNED)) {
+                throw std::invalid_argument(std::string(name) + " must be C-contiguous and aligned");
+            }
+
+            if (writeable && !(array.get_flags() & np::ndarray::WRITEABLE)) {
+                throw std::invalid_argument(std::string(name) + " must be writeable");
+            }
+
+            bool matches = (array.get_nd() == (int)shape.size());
+
+            for (int i = 0; matches && (i < array.get_nd()); ++i) {
+                matches = (shape[i] < 0) || (array.shape(i) == shape[i]);
+            }
+
+            if (!matches) {
+                std::string expected = "(";
+
+                for (unsigned int i = 0; i < shape.size(); ++i) {
+                    expected += (i > 0) ? ", " : "";
+
+                    expected += (shape[i] < 0) ? std::string("any") : std::to_string(shape[i]);
+                }
+
+                throw std::invalid_argument(std::string(name) + " must have a shape of " + expected + ") but has " +
+                                            getShapeString(array));
+            }
+        }
+
+        /*!
+         * Get the buffer of an incoming array
+         *
+         * \param &array: The array
+         */
+        const double *in(const np::ndarray &array) { return reinterpret_cast<const double *>(array.get_data()); }
+
+        /*!
+         * Get the buffer of an outgoing array
+         *
+         * \param &array: The array
+         */
+        double *out(const np::ndarray &array) { return reinterpret_cast<double *>(array.get_data()); }
+
+        /*!
+         * Check the arrays which are common to the balance equations and get the number of points and phases
+         *
+         * \param &density: The apparent densities with a shape of ( num_points, nphases )
+         * \param &density_dot: The partial time derivatives of the apparent densities
+         * \param &density_gradient: The spatial gradients of the apparent densities
+         * \param &velocity: The velocities
+         * \param &velocity_gradient: The spatial gradients of the velocities
+         * \param &material_response: The material responses
+         * \param &test_function: The test functions
+         * \param &num_points: The number of points
+         * \param &nphases: The number of phases
+         */
+        void checkCommonArrays(const np::ndarray &density, const np::ndarray &density_dot,
+                               const np::ndarray &density_gradient, const np::ndarray &velocity,
+                               const np::ndarray &velocity_gradient, const np::ndarray &material_response,
+                               const np::ndarray &test_function, Py_intptr_t &num_points, Py_intptr_t &nphases) {
+            checkArray(density, "density", {-1, -1});
+
+            num_points = density.shape(0);
+
+            nphases = density.shape(1);
+
+            if (nphases < 1) {
+                throw std::invalid_argument("density must have at least one phase");
+            }
+
+            const Py_intptr_t dim = standard::dim;
+
+            checkArray(density_dot, "density_dot", {num_points, nphases});
+            checkArray(density_gradient, "density_gradient", {num_points, nphases, dim});
+            checkArray(velocity, "velocity", {num_points, nphases, dim});
+            checkArray(velocity_gradient, "velocity_gradient", {num_points, nphases, dim, dim});
+            checkArray(material_response, "material_response",
+                       {num_points, nphases, (Py_intptr_t)standard::material_response_size});
+            checkArray(test_function, "test_function", {num_points});
+        }
+
+        /*!
+         * Compute the residuals of the balance of mass of a batch of points
+         *
+         * \param &density: The apparent densities with a shape of ( num_points, nphases )
+         * \param &density_dot: The partial time derivatives of the apparent densities ( num_points, nphases )
+         * \param &density_gradient: The spatial gradients of the apparent densities ( num_points, nphases, 3 )
+         * \param &velocity: The velocities ( num_points, nphases, 3 )
+         * \param &velocity_gradient: The spatial gradients of the velocities ( num_points, nphases, 3, 3 )
+         * \param &material_response: The material responses ( num_points, nphases, material_response_size )
+         * \param &test_function: The test functions ( num_points )
+         * \param &result: The residuals ( num_points, nphases )
+         * \param num_threads: The number of threads. 0 uses the hardware concurrency
+         * \param grain_size: The number of points of each task
+         */
+        void computeBalanceOfMass(const np::ndarray &density, const np::ndarray &density_dot,
+                                  const np::ndarray &density_gradient, const np::ndarray &velocity,
+                                  const np::ndarray &velocity_gradient, const np::ndarray &material_response,
+                                  const np::ndarray &test_function, const np::ndarray &result,
+                                  const unsigned int num_threads, const size_type grain_size) {
+            Py_intptr_t num_points, nphases;
+
+            checkCommonArrays(density, density_dot, density_gradient, velocity, velocity_gradient, material_response,
+                              test_function, num_points, nphases);
+
+            checkArray(result, "result", {num_points, nphases}, true);
+
+            ReleaseGIL release;
+
+            auto pool = getSharedPool().acquire(num_threads);
+
+            batchedKernels::computeBalanceOfMass<standard::dim, standard::mass_change_index>(
+                num_points, nphases, standard::material_response_size, in(density), in(density_dot),
+                in(density_gradient), in(velocity), in(velocity_gradient), in(material_response), in(test_function),
+                out(result), pool.get(), grain_size);
+        }
+
+        /*!
+         * Compute the residuals of the balance of linear momentum of a batch of points
+         *
+         * \param &density: The apparent densities with a shape of ( num_points, nphases )
+         * \param &density_dot: The partial time derivatives of the apparent densities ( num_points, nphases )
+         * \param &density_gradient: The spatial gradients of the apparent densities ( num_points, nphases, 3 )
+         * \param &velocity: The velocities ( num_points, nphases, 3 )
+         * \param &velocity_dot: The partial time derivatives of the velocities ( num_points, nphases, 3 )
+         * \param &velocity_gradient: The spatial gradients of the velocities ( num_points, nphases, 3, 3 )
+         * \param &material_response: The material responses ( num_points, nphases, material_response_size )
+         * \param &volume_fraction: The volume fractions ( num_points, nphases )
+         * \param &test_function: The test functions ( num_points )
+         * \param &test_function_gradient: The spatial gradients of the test functions ( num_points, 3 )
+         * \param &result: The residuals ( num_points, nphases, 3 )
+         * \param num_threads: The number of threads. 0 uses the hardware concurrency
+         * \param grain_size: The number of points of each task
+         */
+        void computeBalanceOfLinearMomentum(const np::ndarray &density, const np::ndarray &density_dot,
+                                            const np::ndarray &density_gradient, const np::ndarray &velocity,
+                                            const np::ndarray &velocity_dot, const np::ndarray &velocity_gradient,
+                                            const np::ndarray &material_response, const np::ndarray &volume_fraction,
+                                            const np::ndarray &test_function,
+                                            const np::ndarray &test_function_gradient, const np::ndarray &result,
+                                            const unsigned int num_threads, const size_type grain_size) {
+            Py_intptr_t num_points, nphases;
+
+            checkCommonArrays(density, density_dot, density_gradient, velocity, velocity_gradient, material_response,
+                              test_function, num_points, nphases);
+
+            const Py_intptr_t dim = standard::dim;
+
+            checkArray(velocity_dot, "velocity_dot", {num_points, nphases, dim});
+            checkArray(volume_fraction, "volume_fraction", {num_points, nphases});
+            checkArray(test_function_gradient, "test_function_gradient", {num_points, dim});
+            checkArray(result, "result", {num_points, nphases, dim}, true);
+
+            ReleaseGIL release;
+
+            auto pool = getSharedPool().acquire(num_threads);
+
+            batchedKernels::computeBalanceOfLinearMomentum<standard::dim, standard::material_response_dim,
+                                                           standard::body_force_index, standard::cauchy_stress_index,
+                                                           standard::interphasic_force_index>(
+                num_points, nphases, standard::material_response_size, in(density), in(density_dot),
+                in(density_gradient), in(velocity), in(velocity_dot), in(velocity_gradient), in(material_response),
+                in(volume_fraction), in(test_function), in(test_function_gradient), out(result), pool.get(),
+                grain_size);
+        }
+
+        /*!
+         * Compute the residuals of the balance of energy of a batch of points
+         *
+         * \param &density: The apparent densities with a shape of ( num_points, nphases )
+         * \param &density_dot: The partial time derivatives of the apparent densities ( num_points, nphases )
+         * \param &density_gradient: The spatial gradients of the apparent densities ( num_points, nphases, 3 )
+         * \param &internal_energy: The internal energies ( num_points, nphases )
+         * \param &internal_energy_dot: The partial time derivatives of the internal energies ( num_points, nphases )
+         * \param &internal_energy_gradient: The spatial gradients of the internal energies ( num_points, nphases, 3 )
+         * \param &velocity: The velocities ( num_points, nphases, 3 )
+         * \param &velocity_gradient: The spatial gradients of the velocities ( num_points, nphases, 3, 3 )
+         * \param &material_response: The material responses ( num_points, nphases, material_response_size )
+         * \param &volume_fraction: The volume fractions ( num_points, nphases )
+         * \param &test_function: The test functions ( num_points )
+         * \param &test_function_gradient: The spatial gradients of the test functions ( num_points, 3 )
+         * \param &result: The residuals ( num_points, nphases )
+         * \param num_threads: The number of threads. 0 uses the hardware concurrency
+         * \param grain_size: The number of points of each task
+         */
+        void computeBalanceOfEnergy(const np::ndarray &density, const np::ndarray &density_dot,
+                                    const np::ndarray &density_gradient, const np::ndarray &internal_energy,
+                                    const np::ndarray &internal_energy_dot, const np::ndarray &internal_energy_gradient,
+                                    const np::ndarray &velocity, const np::ndarray &velocity_gradient,
+                                    const np::ndarray &material_response, const np::ndarray &volume_fraction,
+                                    const np::ndarray &test_function, const np::ndarray &test_function_gradient,
+                                    const np::ndarray &result, const unsigned int num_threads,
+                                    const size_type grain_size) {
+            Py_intptr_t num_points, nphases;
+
+            checkCommonArrays(density, density_dot, density_gradient, velocity, velocity_gradient, material_response,
+                              test_function, num_points, nphases);
+
+            const Py_intptr_t dim = standard::dim;
+
+            checkArray(internal_energy, "internal_energy", {num_points, nphases});
+            checkArray(internal_energy_dot, "internal_energy_dot", {num_points, nphases});
+            checkArray(internal_energy_gradient, "internal_energy_gradient", {num_points, nphases, dim});
+            checkArray(volume_fraction, "volume_fraction", {num_points, nphases});
+            checkArray(test_function_gradient, "test_function_gradient", {num_points, dim});
+            checkArray(result, "result", {num_points, nphases}, true);
+
+            ReleaseGIL release;
+
+            auto pool = getSharedPool().acquire(num_threads);
+
+            batchedKernels::computeBalanceOfEnergy<
+                standard::dim, standard::is_per_unit_volume, standard::material_response_dim,
+                standard::cauchy_stress_index, standard::internal_heat_generation_index, standard::heat_flux_index,
+                standard::interphasic_force_index, standard::interphasic_heat_transfer_index>(
+                num_points, nphases, standard::material_response_size, in(density), in(density_dot),
+                in(density_gradient), in(internal_energy), in(internal_energy_dot), in(internal_energy_gradient),
+                in(velocity), in(velocity_gradient), in(material_response), in(volume_fraction), in(test_function),
+                in(test_function_gradient), out(result), pool.get(), grain_size);
+        }
+
+    }  // namespace python
+
+}  // namespace tardigradeBalanceEquations
+
+BOOST_PYTHON_MODULE(tardigrade_balance_equations_python) {
+    namespace bp = boost::python;
+
+    namespace tbe = tardigradeBalanceEquations::python;
+
+    namespace standard = tardigradeBalanceEquations::explicitInstantiations;
+
+    boost::python::numpy::initialize();
+
+    bp::scope().attr("dim")                                       = standard::dim;
+    bp::scope().attr("material_response_size")                    = standard::material_response_size;
+    bp::scope().attr("cauchy_stress_index")                       = standard::cauchy_stress_index;
+    bp::scope().attr("predicted_internal_energy_index")           = standard::predicted_internal_energy_index;
+    bp::scope().attr("mass_change_index")                         = standard::mass_change_index;
+    bp::scope().attr("body_force_index")                          = standard::body_force_index;
+    bp::scope().attr("interphasic_force_index")                   = standard::interphasic_force_index;
+    bp::scope().attr("heat_flux_index")                           = standard::heat_flux_index;
+    bp::scope().attr("internal_heat_generation_index")            = standard::internal_heat_generation_index;
+    bp::scope().attr("interphasic_heat_transfer_index")           = standard::interphasic_heat_transfer_index;
+    bp::scope().attr("trace_mass_change_velocity_gradient_index") = standard::trace_mass_change_velocity_gradient_index;
+    bp::scope().attr("default_grain_size")                        = tbe::size_type(
+        tardigradeBalanceEquations::batchedKernels::default_point_grain_size);
+
+    bp::def("compute_balance_of_mass", &tbe::computeBalanceOfMass,
+            (bp::arg("density"), bp::arg("density_dot"), bp::arg("density_gradient"), bp::arg("velocity"),
+             bp::arg("velocity_gradient"), bp::arg("material_response"), bp::arg("test_function"), bp::arg("result"),
+             bp::arg("num_threads") = 0,
+             bp::arg("grain_size")  = tardigradeBalanceEquations::batchedKernels::default_point_grain_size),
+            "Compute the residuals of the balance of mass of a batch of points into result");
+
+    bp::def("compute_balance_of_linear_momentum", &tbe::computeBalanceOfLinearMomentum,
+            (bp::arg("density"), bp::arg("density_dot"), bp::arg("density_gradient"), bp::arg("velocity"),
+             bp::arg("velocity_dot"), bp::arg("velocity_gradient"), bp::arg("material_response"),
+             bp::arg("volume_fraction"), bp::arg("test_function"), bp::arg("test_function_gradient"),
+             bp::arg("result"), bp::arg("num_threads") = 0,
+             bp::arg("grain_size") = tardigradeBalanceEquations::batchedKernels::default_point_grain_size),
+            "Compute the residuals of the balance of linear momentum of a batch of points into result");
+
+    bp::def("compute_balance_of_energy", &tbe::computeBalanceOfEnergy,
+            (bp::arg("density"), bp::arg("density_dot"), bp::arg("density_gradient"), bp::arg("internal_energy"),
+             bp::arg("internal_energy_dot"), bp::arg("internal_energy_gradient"), bp::arg("velocity"),
+             bp::arg("velocity_gradient"), bp::arg("material_response"), bp::arg("volume_fraction"),
+             bp::arg("test_function"), bp::arg("test_function_gradient"), bp::arg("result"),
+             bp::arg("num_threads") = 0,
+             bp::arg("grain_size")  = tardigradeBalanceEquations::batchedKernels::default_point_grain_size),
+            "Compute the residuals of the balance of energy of a batch of points into result");
+}
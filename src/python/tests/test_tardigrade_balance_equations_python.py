@@ -0,0 +1,164 @@
+"""Tests for the python bindings of the batched balance equations"""
+
+import unittest
+
+import numpy
+
+import tardigrade_balance_equations_python as tbe
+
+
+def make_batch(num_points, nphases, seed=0):
+    """Make the point-major inputs of a batch of points
+
+    :param int num_points: The number of points
+    :param int nphases: The number of phases of each point
+    :param int seed: The seed of the random values
+
+    :returns: A dictionary of the inputs
+    """
+    rng = numpy.random.default_rng(seed)
+    dim = tbe.dim
+
+    shapes = {
+        "density": (num_points, nphases),
+        "density_dot": (num_points, nphases),
+        "density_gradient": (num_points, nphases, dim),
+        "internal_energy": (num_points, nphases),
+        "internal_energy_dot": (num_points, nphases),
+        "internal_energy_gradient": (num_points, nphases, dim),
+        "velocity": (num_points, nphases, dim),
+        "velocity_dot": (num_points, nphases, dim),
+        "velocity_gradient": (num_points, nphases, dim, dim),
+        "material_response": (num_points, nphases, tbe.material_response_size),
+        "volume_fraction": (num_points, nphases),
+        "test_function": (num_points,),
+        "test_function_gradient": (num_points, dim),
+    }
+
+    return {name: rng.uniform(0.25, 0.75, shape) for name, shape in shapes.items()}
+
+
+def mass_arguments(batch):
+    """Get the arguments of the balance of mass from a batch
+
+    :param dict batch: The batch
+    """
+    names = ["density", "density_dot", "density_gradient", "velocity", "velocity_gradient", "material_response"]
+    return [batch[name] for name in names] + [batch["test_function"]]
+
+
+def momentum_arguments(batch):
+    """Get the arguments of the balance of linear momentum from a batch
+
+    :param dict batch: The batch
+    """
+    names = [
+        "density",
+        "density_dot",
+        "density_gradient",
+        "velocity",
+        "velocity_dot",
+        "velocity_gradient",
+        "material_response",
+        "volume_fraction",
+        "test_function",
+        "test_function_gradient",
+    ]
+    return [batch[name] for name in names]
+
+
+def energy_arguments(batch):
+    """Get the arguments of the balance of energy from a batch
+
+    :param dict batch: The batch
+    """
+    names = [
+        "density",
+        "density_dot",
+        "density_gradient",
+        "internal_energy",
+        "internal_energy_dot",
+        "internal_energy_gradient",
+        "velocity",
+        "velocity_gradient",
+        "material_response",
+        "volume_fraction",
+        "test_function",
+        "test_function_gradient",
+    ]
+    return [batch[name] for name in names]
+
+
+class TestBatchedBalanceEquations(unittest.TestCase):
+
+    num_points = 101
+
+    nphases = 2
+
+    def test_compute_balance_of_mass(self):
+        """Test the residuals of the balance of mass against the balance written with NumPy"""
+        batch = make_batch(self.num_points, self.nphases)
+
+        result = numpy.zeros((self.num_points, self.nphases))
+        tbe.compute_balance_of_mass(*mass_arguments(batch), result)
+
+        answer = batch["test_function"][:, None] * (
+            batch["density_dot"]
+            + numpy.einsum("pai,pai->pa", batch["density_gradient"], batch["velocity"])
+            + batch["density"] * numpy.trace(batch["velocity_gradient"], axis1=2, axis2=3)
+            - batch["material_response"][:, :, tbe.mass_change_index]
+        )
+
+        numpy.testing.assert_allclose(result, answer, rtol=1e-12, atol=1e-12)
+
+    def test_threads(self):
+        """Test that the residuals do not depend on the number of threads or the grain size"""
+        batch = make_batch(self.num_points, self.nphases, seed=1)
+
+        cases = [
+            (tbe.compute_balance_of_mass, mass_arguments(batch), (self.num_points, self.nphases)),
+            (tbe.compute_balance_of_linear_momentum, momentum_arguments(batch), (self.num_points, self.nphases, 3)),
+            (tbe.compute_balance_of_energy, energy_arguments(batch), (self.num_points, self.nphases)),
+        ]
+
+        for function, arguments, shape in cases:
+            serial = numpy.zeros(shape)
+            function(*arguments, serial, num_threads=1)
+
+            for num_threads, grain_size in [(2, 1), (4, 7), (0, tbe.default_grain_size)]:
+                threaded = numpy.zeros(shape)
+                function(*arguments, threaded, num_threads=num_threads, grain_size=grain_size)
+
+                numpy.testing.assert_array_equal(threaded, serial)
+
+    def test_invalid_arrays(self):
+        """Test that arrays which can not be used without a copy or have the wrong shape are rejected"""
+        batch = make_batch(self.num_points, self.nphases)
+
+        arguments = mass_arguments(batch)
+
+        result = numpy.zeros((self.num_points, self.nphases))
+
+        invalid = [
+            (1, arguments[1].astype(numpy.float32)),
+            (1, numpy.asfortranarray(arguments[1])),
+            (2, arguments[2][:, :, :2]),
+            (6, arguments[6][:-1]),
+        ]
+
+        for index, array in invalid:
+            modified = list(arguments)
+            modified[index] = array
+
+            with self.assertRaises(ValueError):
+                tbe.compute_balance_of_mass(*modified, result)
+
+        read_only = numpy.zeros((self.num_points, self.nphases))
+        read_only.flags.writeable = False
+
+        with self.assertRaises(ValueError):
+            tbe.compute_balance_of_mass(*arguments, read_only)
+
+
+if __name__ == "__main__":
+    unittest.main()